@@ -0,0 +1,199 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Benchmarks the hash table used by the REST VOL connector to track
+ *          open objects and visited links.
+ *
+ *          For table sizes from 1,000 entries up to a maximum (10,000,000 by
+ *          default, or the first command-line argument), this times inserting
+ *          object ID strings shaped like those returned by HSDS, looking each
+ *          of them up, looking up IDs which are not in the table, and
+ *          removing every entry. Each result is checked, so the benchmark
+ *          fails if the table returns a wrong answer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "util/rest_vol_hash_string.h"
+#include "util/rest_vol_hash_table.h"
+
+#define KEY_LENGTH          48
+#define DEFAULT_MAX_ENTRIES 10000000
+
+static int
+compare_string_keys(void *value1, void *value2)
+{
+    return !strcmp((const char *)value1, (const char *)value2);
+}
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Write an ID shaped like "g-d38a6a8c-3ec5c93a-7c09-a2f6d1-4ba5e3" for entry i. As with
+ * HSDS, the trailing portion of the ID is random, and keys to look up but not
+ * insert use a different prefix. */
+static void
+make_key(char *key, size_t i, int miss)
+{
+    unsigned long long x = (unsigned long long)i * 0x9E3779B97F4A7C15ULL + 0x2545F4914F6CDD1DULL;
+
+    x ^= x >> 31;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+
+    snprintf(key, KEY_LENGTH, "%c-d38a6a8c-3ec5c93a-%04llx-%06llx-%06llx", miss ? 't' : 'g', x >> 48,
+             (x >> 24) & 0xFFFFFF, x & 0xFFFFFF);
+}
+
+static void
+print_result(size_t num_entries, const char *op, double seconds)
+{
+    printf("%10zu  %-12s %10.2f ns/op\n", num_entries, op, seconds * 1e9 / (double)num_entries);
+}
+
+static int
+bench_size(size_t num_entries)
+{
+    rv_hash_table_t *table     = NULL;
+    char            *keys      = NULL;
+    char            *miss_keys = NULL;
+    size_t          *order     = NULL;
+    double           start;
+    size_t           i;
+    int              ret_value = 0;
+
+    if (NULL == (keys = malloc(2 * num_entries * KEY_LENGTH))) {
+        fprintf(stderr, "can't allocate keys for %zu entries\n", num_entries);
+        ret_value = -1;
+        goto done;
+    }
+
+    if (NULL == (order = malloc(num_entries * sizeof(*order)))) {
+        fprintf(stderr, "can't allocate lookup order for %zu entries\n", num_entries);
+        ret_value = -1;
+        goto done;
+    }
+
+    miss_keys = keys + num_entries * KEY_LENGTH;
+
+    for (i = 0; i < num_entries; i++) {
+        make_key(keys + i * KEY_LENGTH, i, 0);
+        make_key(miss_keys + i * KEY_LENGTH, i, 1);
+        order[i] = i;
+    }
+
+    /* Look up and remove entries in a different order than they were inserted */
+    srand(42);
+    for (i = num_entries - 1; i > 0; i--) {
+        size_t j   = (((size_t)rand() << 16) ^ (size_t)rand()) % (i + 1);
+        size_t tmp = order[i];
+
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    if (NULL == (table = rv_hash_table_new(rv_hash_string, compare_string_keys))) {
+        fprintf(stderr, "can't create hash table\n");
+        ret_value = -1;
+        goto done;
+    }
+
+    start = now_seconds();
+    for (i = 0; i < num_entries; i++) {
+        if (!rv_hash_table_insert(table, keys + i * KEY_LENGTH, keys + i * KEY_LENGTH)) {
+            fprintf(stderr, "can't insert entry %zu\n", i);
+            ret_value = -1;
+            goto done;
+        }
+    }
+    print_result(num_entries, "insert", now_seconds() - start);
+
+    if (rv_hash_table_num_entries(table) != num_entries) {
+        fprintf(stderr, "table has %u entries, expected %zu\n", rv_hash_table_num_entries(table),
+                num_entries);
+        ret_value = -1;
+        goto done;
+    }
+
+    start = now_seconds();
+    for (i = 0; i < num_entries; i++) {
+        char *key = keys + order[i] * KEY_LENGTH;
+
+        if (rv_hash_table_lookup(table, key) != key) {
+            fprintf(stderr, "lookup of entry %zu failed\n", order[i]);
+            ret_value = -1;
+            goto done;
+        }
+    }
+    print_result(num_entries, "lookup", now_seconds() - start);
+
+    start = now_seconds();
+    for (i = 0; i < num_entries; i++) {
+        if (rv_hash_table_lookup(table, miss_keys + order[i] * KEY_LENGTH) != RV_HASH_TABLE_NULL) {
+            fprintf(stderr, "lookup of missing entry %zu succeeded\n", order[i]);
+            ret_value = -1;
+            goto done;
+        }
+    }
+    print_result(num_entries, "lookup miss", now_seconds() - start);
+
+    start = now_seconds();
+    for (i = 0; i < num_entries; i++) {
+        if (!rv_hash_table_remove(table, keys + order[i] * KEY_LENGTH)) {
+            fprintf(stderr, "removal of entry %zu failed\n", order[i]);
+            ret_value = -1;
+            goto done;
+        }
+    }
+    print_result(num_entries, "remove", now_seconds() - start);
+
+    if (rv_hash_table_num_entries(table) != 0) {
+        fprintf(stderr, "table has %u entries after removing all\n", rv_hash_table_num_entries(table));
+        ret_value = -1;
+        goto done;
+    }
+
+done:
+    if (table)
+        rv_hash_table_free(table);
+    free(order);
+    free(keys);
+
+    return ret_value;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t max_entries = DEFAULT_MAX_ENTRIES;
+    size_t num_entries;
+
+    if (argc > 1)
+        max_entries = (size_t)strtoull(argv[1], NULL, 10);
+
+    printf("%10s  %-12s %16s\n", "entries", "operation", "time");
+
+    for (num_entries = 1000; num_entries <= max_entries; num_entries *= 10)
+        if (bench_size(num_entries) < 0)
+            return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
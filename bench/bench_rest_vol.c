@@ -0,0 +1,755 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: End-to-end benchmarks of the REST VOL connector: file open,
+ *          dataset open, small and large dataset reads and writes,
+ *          multi-dataset I/O, link iteration and visiting, and
+ *          attribute-heavy workloads.
+ *
+ *          For each workload, the latency of a single operation is reported
+ *          as its mean, median and 99th percentile, along with the number of
+ *          HTTP requests the connector made per operation. Large transfers
+ *          also report their throughput.
+ *
+ *          The benchmarks can be run against an HSDS server, or against the
+ *          mock_hsds stand-in server with run_bench_rest_vol.sh. The domain
+ *          is the first command-line argument, or
+ *          /home/${HSDS_USERNAME}/bench_rest_vol.h5 by default, and is
+ *          overwritten. The number of repetitions of each workload is
+ *          multiplied by the second command-line argument, 1 by default.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hdf5.h"
+#include "rest_vol_public.h"
+
+#define FILE_NAME_MAX_LENGTH 256
+#define OBJ_NAME_MAX_LENGTH  64
+
+#define NUM_FILE_OPENS   20
+#define NUM_DSET_OPENS   50
+#define SMALL_DSET_ELEMS (1024 * 1024)
+#define SMALL_IO_ELEMS   256
+#define NUM_SMALL_IOS    200
+#define LARGE_IO_ELEMS   (8 * 1024 * 1024)
+#define NUM_LARGE_IOS    3
+#define NUM_MULTI_DSETS  16
+#define MULTI_DSET_ELEMS 4096
+#define NUM_MULTI_IOS    20
+#define NUM_LINKS        500
+#define NUM_TREE_GROUPS  16
+#define NUM_ITERATIONS   10
+#define NUM_ATTRS        200
+#define ATTR_ELEMS       16
+
+static double  *samples_g    = NULL;
+static size_t   nsamples_g   = 0;
+static uint64_t requests_g   = 0;
+static double   start_time_g = 0.0;
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static uint64_t
+count_requests(void)
+{
+    static H5rest_stats_t stats;
+    uint64_t              requests = 0;
+
+    if (H5rest_get_stats(&stats) < 0)
+        return 0;
+
+    for (int i = 0; i < H5REST_NUM_OP_TYPES; i++)
+        requests += stats.op[i].requests;
+
+    return requests;
+}
+
+static int
+compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Starts timing the operations of a workload */
+static void
+begin_workload(void)
+{
+    nsamples_g = 0;
+    requests_g = count_requests();
+}
+
+static void
+begin_op(void)
+{
+    start_time_g = now_seconds();
+}
+
+static void
+end_op(void)
+{
+    samples_g[nsamples_g++] = now_seconds() - start_time_g;
+}
+
+/* Prints the latency of a workload's operations. If bytes_per_op is
+ * non-zero, the workload's throughput is printed as well. */
+static void
+end_workload(const char *name, size_t bytes_per_op)
+{
+    double   total    = 0.0;
+    uint64_t requests = count_requests() - requests_g;
+
+    if (nsamples_g == 0)
+        return;
+
+    for (size_t i = 0; i < nsamples_g; i++)
+        total += samples_g[i];
+
+    qsort(samples_g, nsamples_g, sizeof(*samples_g), compare_doubles);
+
+    printf("%-28s %10.3f ms %10.3f ms %10.3f ms %8.1f", name, total / (double)nsamples_g * 1e3,
+           samples_g[nsamples_g / 2] * 1e3, samples_g[(nsamples_g * 99) / 100] * 1e3,
+           (double)requests / (double)nsamples_g);
+
+    if (bytes_per_op)
+        printf(" %10.1f MiB/s", (double)bytes_per_op * (double)nsamples_g / total / (1024.0 * 1024.0));
+
+    printf("\n");
+}
+
+static int
+bench_file_open(const char *filename, hid_t fapl_id, int scale)
+{
+    hid_t file_id = H5I_INVALID_HID;
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_FILE_OPENS * scale; i++) {
+        begin_op();
+
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0 || H5Fclose(file_id) < 0) {
+            fprintf(stderr, "can't open and close domain %s\n", filename);
+            return -1;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Fopen + H5Fclose", 0);
+
+    return 0;
+}
+
+static int
+bench_dataset_open(hid_t file_id, int scale)
+{
+    hid_t   space_id = H5I_INVALID_HID;
+    hid_t   dset_id  = H5I_INVALID_HID;
+    hsize_t dims[]   = {MULTI_DSET_ELEMS};
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0 ||
+        (dset_id = H5Dcreate2(file_id, "open_dset", H5T_STD_I32LE, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0 ||
+        H5Dclose(dset_id) < 0 || H5Sclose(space_id) < 0) {
+        fprintf(stderr, "can't create dataset for open benchmark\n");
+        return -1;
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_DSET_OPENS * scale; i++) {
+        begin_op();
+
+        if ((dset_id = H5Dopen2(file_id, "open_dset", H5P_DEFAULT)) < 0 || H5Dclose(dset_id) < 0) {
+            fprintf(stderr, "can't open and close dataset\n");
+            return -1;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Dopen2 + H5Dclose", 0);
+
+    return 0;
+}
+
+/* Small reads and writes at scattered offsets within a larger dataset */
+static int
+bench_small_io(hid_t file_id, int scale)
+{
+    hid_t    file_space_id = H5I_INVALID_HID;
+    hid_t    mem_space_id  = H5I_INVALID_HID;
+    hid_t    dset_id       = H5I_INVALID_HID;
+    hsize_t  dims[]        = {SMALL_DSET_ELEMS};
+    hsize_t  count[]       = {SMALL_IO_ELEMS};
+    hsize_t  start[1];
+    int      buf[SMALL_IO_ELEMS];
+    herr_t   status;
+    uint32_t offset_seed = 1;
+    int      ret_value   = -1;
+
+    for (int i = 0; i < SMALL_IO_ELEMS; i++)
+        buf[i] = i;
+
+    if ((file_space_id = H5Screate_simple(1, dims, NULL)) < 0 ||
+        (mem_space_id = H5Screate_simple(1, count, NULL)) < 0 ||
+        (dset_id = H5Dcreate2(file_id, "small_io", H5T_STD_I32LE, file_space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        fprintf(stderr, "can't create dataset for small I/O benchmark\n");
+        goto done;
+    }
+
+    for (int write = 1; write >= 0; write--) {
+        begin_workload();
+
+        for (int i = 0; i < NUM_SMALL_IOS * scale; i++) {
+            offset_seed = offset_seed * 1103515245 + 12345;
+            start[0]    = (offset_seed >> 8) % (SMALL_DSET_ELEMS - SMALL_IO_ELEMS);
+
+            if (H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+                fprintf(stderr, "can't select hyperslab\n");
+                goto done;
+            }
+
+            begin_op();
+
+            if (write)
+                status = H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, file_space_id, H5P_DEFAULT, buf);
+            else
+                status = H5Dread(dset_id, H5T_NATIVE_INT, mem_space_id, file_space_id, H5P_DEFAULT, buf);
+
+            if (status < 0) {
+                fprintf(stderr, "can't %s dataset\n", write ? "write" : "read");
+                goto done;
+            }
+
+            end_op();
+        }
+
+        end_workload(write ? "small H5Dwrite (1 KiB)" : "small H5Dread (1 KiB)", sizeof(buf));
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Sclose(mem_space_id);
+        H5Sclose(file_space_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+}
+
+/* Reads and writes of a whole large dataset */
+static int
+bench_large_io(hid_t file_id, int scale)
+{
+    hid_t   space_id  = H5I_INVALID_HID;
+    hid_t   dset_id   = H5I_INVALID_HID;
+    hsize_t dims[]    = {LARGE_IO_ELEMS};
+    double *write_buf = NULL;
+    double *read_buf  = NULL;
+    int     ret_value = -1;
+
+    if (NULL == (write_buf = malloc(LARGE_IO_ELEMS * sizeof(double))) ||
+        NULL == (read_buf = malloc(LARGE_IO_ELEMS * sizeof(double)))) {
+        fprintf(stderr, "can't allocate buffers for large I/O benchmark\n");
+        goto done;
+    }
+
+    for (size_t i = 0; i < LARGE_IO_ELEMS; i++)
+        write_buf[i] = (double)i;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0 ||
+        (dset_id = H5Dcreate2(file_id, "large_io", H5T_IEEE_F64LE, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        fprintf(stderr, "can't create dataset for large I/O benchmark\n");
+        goto done;
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_LARGE_IOS * scale; i++) {
+        begin_op();
+
+        if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
+            fprintf(stderr, "can't write dataset\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("large H5Dwrite (64 MiB)", LARGE_IO_ELEMS * sizeof(double));
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_LARGE_IOS * scale; i++) {
+        begin_op();
+
+        if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
+            fprintf(stderr, "can't read dataset\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("large H5Dread (64 MiB)", LARGE_IO_ELEMS * sizeof(double));
+
+    if (memcmp(write_buf, read_buf, LARGE_IO_ELEMS * sizeof(double))) {
+        fprintf(stderr, "data read from large dataset doesn't match data written\n");
+        goto done;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    free(write_buf);
+    free(read_buf);
+
+    return ret_value;
+}
+
+/* Reads and writes of several whole datasets in a single call */
+static int
+bench_multi_io(hid_t file_id, int scale)
+{
+    hid_t   space_id = H5I_INVALID_HID;
+    hid_t   dset_ids[NUM_MULTI_DSETS];
+    hid_t   mem_type_ids[NUM_MULTI_DSETS];
+    hid_t   space_ids[NUM_MULTI_DSETS];
+    void   *bufs[NUM_MULTI_DSETS];
+    hsize_t dims[] = {MULTI_DSET_ELEMS};
+    int    *data   = NULL;
+    char    dset_name[OBJ_NAME_MAX_LENGTH];
+    int     ret_value = -1;
+
+    for (int i = 0; i < NUM_MULTI_DSETS; i++)
+        dset_ids[i] = H5I_INVALID_HID;
+
+    if (NULL == (data = calloc(NUM_MULTI_DSETS * MULTI_DSET_ELEMS, sizeof(int)))) {
+        fprintf(stderr, "can't allocate buffer for multi-dataset I/O benchmark\n");
+        goto done;
+    }
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0) {
+        fprintf(stderr, "can't create dataspace\n");
+        goto done;
+    }
+
+    for (int i = 0; i < NUM_MULTI_DSETS; i++) {
+        snprintf(dset_name, sizeof(dset_name), "multi_%02d", i);
+
+        if ((dset_ids[i] = H5Dcreate2(file_id, dset_name, H5T_STD_I32LE, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                                      H5P_DEFAULT)) < 0) {
+            fprintf(stderr, "can't create dataset for multi-dataset I/O benchmark\n");
+            goto done;
+        }
+
+        mem_type_ids[i] = H5T_NATIVE_INT;
+        space_ids[i]    = H5S_ALL;
+        bufs[i]         = data + (size_t)i * MULTI_DSET_ELEMS;
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_MULTI_IOS * scale; i++) {
+        begin_op();
+
+        if (H5Dwrite_multi(NUM_MULTI_DSETS, dset_ids, mem_type_ids, space_ids, space_ids, H5P_DEFAULT,
+                           (const void **)bufs) < 0) {
+            fprintf(stderr, "can't write datasets\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Dwrite_multi (16 x 16 KiB)", NUM_MULTI_DSETS * MULTI_DSET_ELEMS * sizeof(int));
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_MULTI_IOS * scale; i++) {
+        begin_op();
+
+        if (H5Dread_multi(NUM_MULTI_DSETS, dset_ids, mem_type_ids, space_ids, space_ids, H5P_DEFAULT, bufs) <
+            0) {
+            fprintf(stderr, "can't read datasets\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Dread_multi (16 x 16 KiB)", NUM_MULTI_DSETS * MULTI_DSET_ELEMS * sizeof(int));
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        for (int i = 0; i < NUM_MULTI_DSETS; i++)
+            H5Dclose(dset_ids[i]);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    free(data);
+
+    return ret_value;
+}
+
+static herr_t
+count_links_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    (void)group_id;
+    (void)name;
+    (void)info;
+
+    (*(size_t *)op_data)++;
+
+    return 0;
+}
+
+/* Iteration over the links in a large group, and visiting the links in a
+ * tree of groups */
+static int
+bench_links(hid_t file_id, int scale)
+{
+    hid_t  group_id = H5I_INVALID_HID;
+    hid_t  child_id = H5I_INVALID_HID;
+    char   group_name[OBJ_NAME_MAX_LENGTH];
+    size_t nlinks;
+    int    ret_value = -1;
+
+    if ((group_id = H5Gcreate2(file_id, "links", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        fprintf(stderr, "can't create group for link benchmarks\n");
+        goto done;
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_LINKS; i++) {
+        snprintf(group_name, sizeof(group_name), "group_%05d", i);
+
+        begin_op();
+
+        if ((child_id = H5Gcreate2(group_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0 ||
+            H5Gclose(child_id) < 0) {
+            fprintf(stderr, "can't create group\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Gcreate2 + H5Gclose", 0);
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_ITERATIONS * scale; i++) {
+        nlinks = 0;
+
+        begin_op();
+
+        if (H5Literate2(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, count_links_cb, &nlinks) < 0 ||
+            nlinks != NUM_LINKS) {
+            fprintf(stderr, "can't iterate over links\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Literate2 (500 links)", 0);
+
+    if (H5Gclose(group_id) < 0) {
+        fprintf(stderr, "can't close group\n");
+        goto done;
+    }
+
+    /* A tree of NUM_TREE_GROUPS groups, each with NUM_TREE_GROUPS subgroups */
+    if ((group_id = H5Gcreate2(file_id, "tree", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        fprintf(stderr, "can't create group for link visit benchmark\n");
+        goto done;
+    }
+
+    for (int i = 0; i < NUM_TREE_GROUPS * NUM_TREE_GROUPS; i++) {
+        if (i % NUM_TREE_GROUPS == 0)
+            snprintf(group_name, sizeof(group_name), "group_%02d", i / NUM_TREE_GROUPS);
+        else
+            snprintf(group_name, sizeof(group_name), "group_%02d/group_%02d", i / NUM_TREE_GROUPS,
+                     i % NUM_TREE_GROUPS);
+
+        if ((child_id = H5Gcreate2(group_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0 ||
+            H5Gclose(child_id) < 0) {
+            fprintf(stderr, "can't create group\n");
+            goto done;
+        }
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_ITERATIONS * scale; i++) {
+        nlinks = 0;
+
+        begin_op();
+
+        if (H5Lvisit2(group_id, H5_INDEX_NAME, H5_ITER_INC, count_links_cb, &nlinks) < 0 ||
+            nlinks != NUM_TREE_GROUPS * NUM_TREE_GROUPS) {
+            fprintf(stderr, "can't visit links\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Lvisit2 (16 x 16 groups)", 0);
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(child_id);
+        H5Gclose(group_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+}
+
+static herr_t
+count_attrs_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *op_data)
+{
+    (void)loc_id;
+    (void)name;
+    (void)info;
+
+    (*(size_t *)op_data)++;
+
+    return 0;
+}
+
+/* Creating, iterating over and reading many small attributes on a dataset */
+static int
+bench_attributes(hid_t file_id, int scale)
+{
+    hid_t   space_id      = H5I_INVALID_HID;
+    hid_t   attr_space_id = H5I_INVALID_HID;
+    hid_t   dset_id       = H5I_INVALID_HID;
+    hid_t   attr_id       = H5I_INVALID_HID;
+    hsize_t dims[]        = {1};
+    hsize_t attr_dims[]   = {ATTR_ELEMS};
+    double  buf[ATTR_ELEMS];
+    char    attr_name[OBJ_NAME_MAX_LENGTH];
+    size_t  nattrs;
+    int     ret_value = -1;
+
+    for (int i = 0; i < ATTR_ELEMS; i++)
+        buf[i] = (double)i;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0 ||
+        (attr_space_id = H5Screate_simple(1, attr_dims, NULL)) < 0 ||
+        (dset_id = H5Dcreate2(file_id, "attrs", H5T_STD_I32LE, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        fprintf(stderr, "can't create dataset for attribute benchmark\n");
+        goto done;
+    }
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_ATTRS; i++) {
+        snprintf(attr_name, sizeof(attr_name), "attr_%05d", i);
+
+        begin_op();
+
+        if ((attr_id = H5Acreate2(dset_id, attr_name, H5T_IEEE_F64LE, attr_space_id, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0 ||
+            H5Awrite(attr_id, H5T_NATIVE_DOUBLE, buf) < 0 || H5Aclose(attr_id) < 0) {
+            fprintf(stderr, "can't create and write attribute\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Acreate2 + H5Awrite", 0);
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_ITERATIONS * scale; i++) {
+        nattrs = 0;
+
+        begin_op();
+
+        if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_INC, NULL, count_attrs_cb, &nattrs) < 0 ||
+            nattrs != NUM_ATTRS) {
+            fprintf(stderr, "can't iterate over attributes\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Aiterate2 (200 attributes)", 0);
+
+    begin_workload();
+
+    for (int i = 0; i < NUM_ATTRS; i++) {
+        snprintf(attr_name, sizeof(attr_name), "attr_%05d", i);
+
+        begin_op();
+
+        if ((attr_id = H5Aopen(dset_id, attr_name, H5P_DEFAULT)) < 0 ||
+            H5Aread(attr_id, H5T_NATIVE_DOUBLE, buf) < 0 || H5Aclose(attr_id) < 0) {
+            fprintf(stderr, "can't open and read attribute\n");
+            goto done;
+        }
+
+        end_op();
+    }
+
+    end_workload("H5Aopen + H5Aread", 0);
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Dclose(dset_id);
+        H5Sclose(attr_space_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *username;
+    char        filename[FILE_NAME_MAX_LENGTH];
+    hid_t       fapl_id = H5I_INVALID_HID;
+    hid_t       file_id = H5I_INVALID_HID;
+    int         scale   = 1;
+    size_t      max_samples;
+
+    if (argc > 1)
+        snprintf(filename, FILE_NAME_MAX_LENGTH, "%s", argv[1]);
+    else {
+        if (NULL == (username = getenv("HSDS_USERNAME"))) {
+            fprintf(stderr, "HSDS_USERNAME must be set if no domain is given\n");
+            return EXIT_FAILURE;
+        }
+
+        snprintf(filename, FILE_NAME_MAX_LENGTH, "/home/%s/bench_rest_vol.h5", username);
+    }
+
+    if (argc > 2 && (scale = atoi(argv[2])) < 1) {
+        fprintf(stderr, "repetition multiplier must be positive\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Enough room for the timings of the longest workload */
+    max_samples = (size_t)(NUM_SMALL_IOS * scale);
+    if (max_samples < NUM_LINKS)
+        max_samples = NUM_LINKS;
+    if (max_samples < (size_t)(NUM_DSET_OPENS * scale))
+        max_samples = (size_t)(NUM_DSET_OPENS * scale);
+
+    if (NULL == (samples_g = malloc(max_samples * sizeof(*samples_g)))) {
+        fprintf(stderr, "can't allocate timing buffer\n");
+        return EXIT_FAILURE;
+    }
+
+    if (H5rest_init() < 0) {
+        fprintf(stderr, "can't initialize REST VOL connector\n");
+        free(samples_g);
+        return EXIT_FAILURE;
+    }
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0 || H5Pset_fapl_rest_vol(fapl_id) < 0) {
+        fprintf(stderr, "can't set up FAPL\n");
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        fprintf(stderr, "can't create domain %s\n", filename);
+        goto error;
+    }
+
+    printf("Domain: %s\n\n", filename);
+    printf("%-28s %13s %13s %13s %8s %16s\n", "workload", "mean", "median", "p99", "req/op", "throughput");
+
+    if (bench_file_open(filename, fapl_id, scale) < 0 || bench_dataset_open(file_id, scale) < 0 ||
+        bench_small_io(file_id, scale) < 0 || bench_large_io(file_id, scale) < 0 ||
+        bench_multi_io(file_id, scale) < 0 || bench_links(file_id, scale) < 0 ||
+        bench_attributes(file_id, scale) < 0)
+        goto error;
+
+    if (H5Fclose(file_id) < 0) {
+        fprintf(stderr, "can't close domain\n");
+        goto error;
+    }
+    file_id = H5I_INVALID_HID;
+
+    if (H5Pclose(fapl_id) < 0) {
+        fprintf(stderr, "can't close FAPL\n");
+        goto error;
+    }
+    fapl_id = H5I_INVALID_HID;
+
+    H5rest_term();
+    free(samples_g);
+
+    return EXIT_SUCCESS;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    H5rest_term();
+    free(samples_g);
+
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Benchmarks the startup latency of the REST VOL connector, as seen
+ *          by a short-lived tool which opens a single domain: the time from
+ *          H5rest_init() through the first H5Fopen(), broken down by step.
+ *          It then times further opens of the same domain, which don't need
+ *          to set up the connector or read its connection information again.
+ *
+ *          The domain is the first command-line argument, or
+ *          /home/${HSDS_USERNAME}/bench_startup.h5 by default. It is created
+ *          if it doesn't exist, in which case the first access is a create
+ *          rather than an open. The number of further opens is the second
+ *          command-line argument, 10 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "hdf5.h"
+#include "rest_vol_public.h"
+
+#define FILE_NAME_MAX_LENGTH 256
+#define DEFAULT_NUM_REOPENS  10
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void
+print_result(const char *step, double seconds)
+{
+    printf("%-28s %10.3f ms\n", step, seconds * 1e3);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *username;
+    char        filename[FILE_NAME_MAX_LENGTH];
+    hid_t       fapl_id     = H5I_INVALID_HID;
+    hid_t       file_id     = H5I_INVALID_HID;
+    int         num_reopens = DEFAULT_NUM_REOPENS;
+    int         created     = 0;
+    double      start, init_done, fapl_done, open_done;
+
+    if (argc > 1)
+        snprintf(filename, FILE_NAME_MAX_LENGTH, "%s", argv[1]);
+    else {
+        if (NULL == (username = getenv("HSDS_USERNAME"))) {
+            fprintf(stderr, "HSDS_USERNAME must be set if no domain is given\n");
+            return EXIT_FAILURE;
+        }
+
+        snprintf(filename, FILE_NAME_MAX_LENGTH, "/home/%s/bench_startup.h5", username);
+    }
+
+    if (argc > 2)
+        num_reopens = atoi(argv[2]);
+
+    start = now_seconds();
+
+    if (H5rest_init() < 0) {
+        fprintf(stderr, "can't initialize REST VOL connector\n");
+        return EXIT_FAILURE;
+    }
+
+    init_done = now_seconds();
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0 || H5Pset_fapl_rest_vol(fapl_id) < 0) {
+        fprintf(stderr, "can't set up FAPL\n");
+        goto error;
+    }
+
+    fapl_done = now_seconds();
+
+    H5E_BEGIN_TRY
+    {
+        file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    }
+    H5E_END_TRY;
+
+    if (file_id < 0) {
+        created = 1;
+
+        if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+            fprintf(stderr, "can't open or create domain %s\n", filename);
+            goto error;
+        }
+    }
+
+    open_done = now_seconds();
+
+    if (H5Fclose(file_id) < 0) {
+        fprintf(stderr, "can't close domain\n");
+        goto error;
+    }
+    file_id = H5I_INVALID_HID;
+
+    printf("Domain: %s\n\n", filename);
+    print_result("H5rest_init", init_done - start);
+    print_result("FAPL setup", fapl_done - init_done);
+    print_result(created ? "first H5Fcreate" : "first H5Fopen", open_done - fapl_done);
+    print_result("total to first file access", open_done - start);
+
+    if (num_reopens > 0) {
+        double reopen_start = now_seconds();
+
+        for (int i = 0; i < num_reopens; i++) {
+            if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+                fprintf(stderr, "can't reopen domain %s\n", filename);
+                goto error;
+            }
+
+            if (H5Fclose(file_id) < 0) {
+                fprintf(stderr, "can't close domain\n");
+                goto error;
+            }
+            file_id = H5I_INVALID_HID;
+        }
+
+        print_result("later H5Fopen + H5Fclose", (now_seconds() - reopen_start) / num_reopens);
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        fprintf(stderr, "can't close FAPL\n");
+        goto error;
+    }
+    fapl_id = H5I_INVALID_HID;
+
+    H5rest_term();
+
+    return EXIT_SUCCESS;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    H5rest_term();
+
+    return EXIT_FAILURE;
+}
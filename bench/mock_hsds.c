@@ -0,0 +1,544 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A small, in-memory stand-in for an HSDS server, so that the
+ *          connector's end-to-end benchmarks can be run without setting up
+ *          a real server. Requests are served by the same in-process store
+ *          as the connector's local transport (see
+ *          src/util/rest_vol_local_store.c); this file only adds the HTTP
+ *          layer on top of it.
+ *
+ *          The server is single-threaded and keeps everything in memory, so
+ *          its own cost per request is small and roughly constant. Timings
+ *          taken against it therefore mostly reflect the connector and the
+ *          HTTP round trips, not the storage behind a real server.
+ *
+ *          Usage: mock_hsds [port]
+ *
+ *          The server listens on 127.0.0.1 on the given port, 5101 by
+ *          default, and runs until it receives SIGINT or SIGTERM. Point the
+ *          connector at it by setting HSDS_ENDPOINT=http://127.0.0.1:<port>;
+ *          any HSDS_USERNAME and HSDS_PASSWORD are accepted.
+ *
+ *          The server also stands in for the Active Directory token
+ *          endpoint, at /<tenant>/oauth2/v2.0/token, so that the connector's
+ *          token handling can be tested by setting HSDS_AD_AUTHORITY to the
+ *          same URL. Any client credentials are accepted, and tokens are
+ *          issued for MOCK_HSDS_TOKEN_LIFETIME seconds, 3600 by default.
+ *          Refresh tokens are rejected for tenants whose names start with
+ *          "fail". A GET of the endpoint returns how many tokens were issued
+ *          and refreshed for the tenant, and how many refreshes failed.
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "util/rest_vol_local_store.h"
+
+#define DEFAULT_PORT    5101
+#define MAX_CONNECTIONS 64
+#define RECV_CHUNK_SIZE 65536
+
+#define TOKEN_PATH_SUFFIX      "/oauth2/v2.0/token"
+#define DEFAULT_TOKEN_LIFETIME 3600
+#define MAX_TENANTS            16
+#define MAX_TENANT_NAME        64
+
+typedef struct connection_t {
+    int               fd;
+    RV_local_buffer_t in;
+} connection_t;
+
+/* Token requests counted for an Active Directory tenant */
+typedef struct tenant_t {
+    char name[MAX_TENANT_NAME];
+    int  issued;
+    int  refreshed;
+    int  failed;
+} tenant_t;
+
+static volatile int done_g = 0;
+
+static tenant_t tenants_g[MAX_TENANTS];
+static int      ntenants_g = 0;
+
+static void
+out_of_memory(void)
+{
+    fprintf(stderr, "mock_hsds: out of memory\n");
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * Active Directory token endpoint
+ */
+
+/* Returns the tenant with the given name, adding it if it's new, or NULL if
+ * there are too many tenants */
+static tenant_t *
+find_tenant(const char *name, size_t name_len)
+{
+    for (int i = 0; i < ntenants_g; i++)
+        if (strlen(tenants_g[i].name) == name_len && !strncmp(tenants_g[i].name, name, name_len))
+            return &tenants_g[i];
+
+    if (ntenants_g == MAX_TENANTS || name_len >= MAX_TENANT_NAME)
+        return NULL;
+
+    memset(&tenants_g[ntenants_g], 0, sizeof(tenants_g[ntenants_g]));
+    memcpy(tenants_g[ntenants_g].name, name, name_len);
+
+    return &tenants_g[ntenants_g++];
+}
+
+static void
+set_json_response(RV_local_response_t *resp, int status, const char *body, int body_len)
+{
+    resp->status       = status;
+    resp->content_type = "application/json";
+    RV_local_buffer_append(&resp->body, body, (size_t)body_len);
+}
+
+/* Handles a request of the token endpoint if the target is one, returning
+ * whether it was */
+static int
+handle_token_request(const RV_local_request_t *req, RV_local_response_t *resp)
+{
+    const char *target     = req->target;
+    size_t      target_len = strcspn(target, "?");
+    size_t      suffix_len = strlen(TOKEN_PATH_SUFFIX);
+    const char *lifetime   = getenv("MOCK_HSDS_TOKEN_LIFETIME");
+    tenant_t   *tenant;
+    char        body[512];
+    int         body_len;
+
+    if (target[0] != '/' || target_len <= suffix_len + 1 ||
+        strncmp(target + target_len - suffix_len, TOKEN_PATH_SUFFIX, suffix_len) ||
+        memchr(target + 1, '/', target_len - suffix_len - 1))
+        return 0;
+
+    if (NULL == (tenant = find_tenant(target + 1, target_len - suffix_len - 1))) {
+        body_len = snprintf(body, sizeof(body), "{\"error\": \"too many tenants\"}");
+        set_json_response(resp, 400, body, body_len);
+        return 1;
+    }
+
+    if (!strcmp(req->method, "GET")) {
+        body_len = snprintf(body, sizeof(body), "{\"issued\": %d, \"refreshed\": %d, \"failed\": %d}",
+                            tenant->issued, tenant->refreshed, tenant->failed);
+        set_json_response(resp, 200, body, body_len);
+    }
+    else if (!strcmp(req->method, "POST")) {
+        int refresh = strstr(req->body, "grant_type=refresh_token") != NULL;
+
+        if (refresh && !strncmp(tenant->name, "fail", 4)) {
+            tenant->failed++;
+            body_len = snprintf(body, sizeof(body), "{\"error\": \"invalid_grant\"}");
+            set_json_response(resp, 400, body, body_len);
+        }
+        else {
+            int count = refresh ? ++tenant->refreshed : ++tenant->issued;
+
+            body_len = snprintf(body, sizeof(body),
+                                "{\"token_type\": \"Bearer\", \"access_token\": \"mock-%s-%s-%d\", "
+                                "\"refresh_token\": \"mock-refresh-%s-%d\", \"expires_in\": %d}",
+                                refresh ? "refreshed" : "issued", tenant->name, count, tenant->name,
+                                tenant->issued + tenant->refreshed,
+                                lifetime ? atoi(lifetime) : DEFAULT_TOKEN_LIFETIME);
+            set_json_response(resp, 200, body, body_len);
+        }
+    }
+    else {
+        body_len = snprintf(body, sizeof(body), "{\"error\": \"method not allowed\"}");
+        set_json_response(resp, 405, body, body_len);
+    }
+
+    return 1;
+}
+
+/*
+ * HTTP
+ */
+
+static const char *
+status_text(int status)
+{
+    switch (status) {
+        case 200:
+            return "OK";
+        case 201:
+            return "Created";
+        case 204:
+            return "No Content";
+        case 400:
+            return "Bad Request";
+        case 403:
+            return "Forbidden";
+        case 404:
+            return "Not Found";
+        case 405:
+            return "Method Not Allowed";
+        case 409:
+            return "Conflict";
+        case 501:
+            return "Not Implemented";
+        default:
+            return "Internal Server Error";
+    }
+}
+
+static int
+send_all(int fd, const char *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t sent = send(fd, data, size, 0);
+
+        if (sent < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        data += sent;
+        size -= (size_t)sent;
+    }
+
+    return 0;
+}
+
+static int
+send_response(int fd, RV_local_response_t *resp)
+{
+    char   header[256];
+    int    header_len;
+    size_t body_len = resp->status == 204 ? 0 : resp->body.size;
+
+    header_len = snprintf(header, sizeof(header),
+                          "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n", resp->status,
+                          status_text(resp->status), resp->content_type, body_len);
+
+    if (send_all(fd, header, (size_t)header_len) < 0 ||
+        (resp->headers.size && send_all(fd, resp->headers.data, resp->headers.size) < 0) ||
+        send_all(fd, "\r\n", 2) < 0)
+        return -1;
+
+    return body_len ? send_all(fd, resp->body.data, body_len) : 0;
+}
+
+/* Returns the first occurrence of the given bytes in a buffer which may
+ * contain binary data, or NULL */
+static const char *
+find_bytes(const char *buf, size_t buf_len, const char *bytes, size_t bytes_len)
+{
+    for (size_t i = 0; i + bytes_len <= buf_len; i++)
+        if (!memcmp(buf + i, bytes, bytes_len))
+            return buf + i;
+
+    return NULL;
+}
+
+/* Returns a copy of the value of the given header, or NULL if the request
+ * doesn't have the header. Parameters such as "; charset=..." are dropped. */
+static char *
+find_header(const char *headers, const char *name)
+{
+    size_t name_len = strlen(name);
+
+    for (const char *line = headers; line; line = strstr(line, "\r\n") ? strstr(line, "\r\n") + 2 : NULL) {
+        if (!strncasecmp(line, name, name_len) && line[name_len] == ':') {
+            const char *value = line + name_len + 1;
+            char       *copy;
+
+            while (*value == ' ')
+                value++;
+
+            if (NULL == (copy = strdup(value)))
+                out_of_memory();
+
+            copy[strcspn(copy, "\r;")] = '\0';
+
+            return copy;
+        }
+    }
+
+    return NULL;
+}
+
+/* Decodes a chunked request body into the given buffer. Returns the number
+ * of bytes of input consumed, 0 if the body isn't complete yet or -1 if
+ * the body is malformed. */
+static ssize_t
+decode_chunked(const char *in, size_t in_len, RV_local_buffer_t *out)
+{
+    size_t pos = 0;
+
+    out->size = 0;
+
+    for (;;) {
+        const char *line_end = find_bytes(in + pos, in_len - pos, "\r\n", 2);
+        size_t      chunk_size;
+        char       *end;
+
+        if (!line_end)
+            return 0;
+
+        chunk_size = strtoul(in + pos, &end, 16);
+        if (end == in + pos)
+            return -1;
+
+        pos = (size_t)(line_end - in) + 2;
+
+        if (chunk_size == 0) {
+            const char *trailer_end = find_bytes(in + pos, in_len - pos, "\r\n", 2);
+
+            return trailer_end ? (ssize_t)(trailer_end - in) + 2 : 0;
+        }
+
+        if (in_len - pos < chunk_size + 2)
+            return 0;
+
+        RV_local_buffer_append(out, in + pos, chunk_size);
+        pos += chunk_size + 2;
+    }
+}
+
+/* Handles each complete request in a connection's input buffer. The
+ * buffer is left untouched until a whole request has arrived, and the
+ * request line, headers and body are copied out of it before they are
+ * parsed. Returns a negative value if the connection should be closed. */
+static int
+process_input(connection_t *conn)
+{
+    for (;;) {
+        const char         *headers_end;
+        char               *headers, *value;
+        RV_local_request_t  req  = {0};
+        RV_local_response_t resp = {0};
+        RV_local_buffer_t   body = {0};
+        size_t              headers_len, consumed;
+        int                 keep_alive = 1, ret;
+
+        headers_end = find_bytes(conn->in.data, conn->in.size, "\r\n\r\n", 4);
+        if (!headers_end)
+            return 0;
+
+        headers_len = (size_t)(headers_end - conn->in.data) + 4;
+
+        if (NULL == (headers = malloc(headers_len + 1)))
+            out_of_memory();
+
+        memcpy(headers, conn->in.data, headers_len);
+        headers[headers_len] = '\0';
+
+        value = find_header(headers, "Transfer-Encoding");
+        if (value && !strncasecmp(value, "chunked", 7)) {
+            ssize_t chunked_len =
+                decode_chunked(conn->in.data + headers_len, conn->in.size - headers_len, &body);
+
+            free(value);
+
+            if (chunked_len <= 0) {
+                RV_local_buffer_free(&body);
+                free(headers);
+                return chunked_len < 0 ? -1 : 0;
+            }
+
+            consumed = headers_len + (size_t)chunked_len;
+        }
+        else {
+            size_t content_length = 0;
+
+            free(value);
+
+            if (NULL != (value = find_header(headers, "Content-Length"))) {
+                content_length = strtoul(value, NULL, 10);
+                free(value);
+            }
+
+            /* Wait for the rest of the body */
+            if (conn->in.size - headers_len < content_length) {
+                free(headers);
+                return 0;
+            }
+
+            /* Copy the body, which also terminates it for the JSON parser */
+            RV_local_buffer_append(&body, conn->in.data + headers_len, content_length);
+            consumed = headers_len + content_length;
+        }
+
+        if (NULL != (value = find_header(headers, "Connection"))) {
+            keep_alive = strncasecmp(value, "close", 5) != 0;
+            free(value);
+        }
+
+        req.domain       = find_header(headers, "X-Hdf-domain");
+        req.content_type = find_header(headers, "Content-Type");
+        req.body         = body.data ? body.data : "";
+        req.body_len     = body.size;
+
+        /* Request line */
+        headers[strcspn(headers, "\r")] = '\0';
+        req.method                      = headers;
+
+        if (NULL == (req.target = strchr(req.method, ' ')))
+            ret = -1;
+        else {
+            *req.target++ = '\0';
+            if (NULL != (value = strchr(req.target, ' ')))
+                *value = '\0';
+
+            if (!handle_token_request(&req, &resp))
+                RV_local_store_handle_request(&req, &resp);
+            ret = send_response(conn->fd, &resp);
+        }
+
+        free((char *)req.domain);
+        free((char *)req.content_type);
+        free(headers);
+        RV_local_buffer_free(&resp.headers);
+        RV_local_buffer_free(&resp.body);
+        RV_local_buffer_free(&body);
+
+        memmove(conn->in.data, conn->in.data + consumed, conn->in.size - consumed);
+        conn->in.size -= consumed;
+        conn->in.data[conn->in.size] = '\0';
+
+        if (ret < 0 || !keep_alive)
+            return -1;
+    }
+}
+
+static void
+handle_signal(int sig)
+{
+    (void)sig;
+    done_g = 1;
+}
+
+int
+main(int argc, char **argv)
+{
+    struct sockaddr_in addr;
+    struct pollfd      fds[MAX_CONNECTIONS + 1];
+    connection_t       conns[MAX_CONNECTIONS];
+    int                nconns = 0;
+    int                listen_fd, one = 1;
+    int                port = argc > 1 ? atoi(argv[1]) : DEFAULT_PORT;
+
+    if (RV_local_store_open(NULL) < 0) {
+        fprintf(stderr, "mock_hsds: can't open store\n");
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, handle_signal);
+    signal(SIGTERM, handle_signal);
+
+    if ((listen_fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        perror("mock_hsds: socket");
+        return EXIT_FAILURE;
+    }
+
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listen_fd, 64) < 0) {
+        perror("mock_hsds: bind");
+        close(listen_fd);
+        return EXIT_FAILURE;
+    }
+
+    printf("mock_hsds listening on http://127.0.0.1:%d\n", port);
+    fflush(stdout);
+
+    while (!done_g) {
+        fds[0].fd     = listen_fd;
+        fds[0].events = POLLIN;
+        for (int i = 0; i < nconns; i++) {
+            fds[i + 1].fd     = conns[i].fd;
+            fds[i + 1].events = POLLIN;
+        }
+
+        if (poll(fds, (nfds_t)nconns + 1, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("mock_hsds: poll");
+            break;
+        }
+
+        /* Service the existing connections first, since accepting a new
+         * connection changes their positions in the poll array */
+        for (int i = nconns - 1; i >= 0; i--) {
+            ssize_t received;
+
+            if (!(fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+
+            RV_local_buffer_reserve(&conns[i].in, RECV_CHUNK_SIZE);
+            received = recv(conns[i].fd, conns[i].in.data + conns[i].in.size, RECV_CHUNK_SIZE, 0);
+
+            if (received < 0 && errno == EINTR)
+                continue;
+
+            if (received > 0) {
+                conns[i].in.size += (size_t)received;
+                conns[i].in.data[conns[i].in.size] = '\0';
+            }
+
+            if (received <= 0 || process_input(&conns[i]) < 0) {
+                close(conns[i].fd);
+                RV_local_buffer_free(&conns[i].in);
+                conns[i] = conns[--nconns];
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd = accept(listen_fd, NULL, NULL);
+
+            if (fd >= 0) {
+                if (nconns == MAX_CONNECTIONS)
+                    close(fd);
+                else {
+                    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                    memset(&conns[nconns], 0, sizeof(conns[nconns]));
+                    conns[nconns++].fd = fd;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < nconns; i++) {
+        close(conns[i].fd);
+        RV_local_buffer_free(&conns[i].in);
+    }
+
+    RV_local_store_close();
+
+    close(listen_fd);
+
+    return EXIT_SUCCESS;
+}
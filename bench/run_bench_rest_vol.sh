@@ -0,0 +1,42 @@
+#!/bin/sh
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of the HDF5 REST VOL connector. The full copyright
+# notice, including terms governing use, modification, and redistribution,
+# is contained in the COPYING file, which can be found at the root of the
+# source code distribution tree.
+#
+# A script used to run the end-to-end REST VOL connector benchmarks against
+# the mock_hsds stand-in server. It starts the server on a local port, points
+# the connector at it, runs bench_rest_vol with the script's arguments and
+# then stops the server.
+#
+# The programs are taken from the MOCK_HSDS and BENCH_REST_VOL environment
+# variables, or from the current directory by default. The server listens
+# on the port given by MOCK_HSDS_PORT, 5101 by default.
+
+MOCK_HSDS="${MOCK_HSDS:-./mock_hsds}"
+BENCH_REST_VOL="${BENCH_REST_VOL:-./bench_rest_vol}"
+MOCK_HSDS_PORT="${MOCK_HSDS_PORT:-5101}"
+
+"$MOCK_HSDS" "$MOCK_HSDS_PORT" > /dev/null &
+MOCK_HSDS_PID=$!
+
+trap 'kill $MOCK_HSDS_PID 2> /dev/null' EXIT INT TERM
+
+# Give the server a moment to start listening, and make sure it did
+sleep 1
+if ! kill -0 $MOCK_HSDS_PID 2> /dev/null; then
+    echo "mock_hsds failed to start on port $MOCK_HSDS_PORT" >&2
+    exit 1
+fi
+
+# The mock server accepts any credentials
+HSDS_ENDPOINT="http://127.0.0.1:$MOCK_HSDS_PORT"
+HSDS_USERNAME=bench
+HSDS_PASSWORD=bench
+export HSDS_ENDPOINT HSDS_USERNAME HSDS_PASSWORD
+
+"$BENCH_REST_VOL" "$@"
@@ -32,6 +32,7 @@ CHECK_FUNCTION_EXISTS (clock_gettime CLOCK_GETTIME_IN_LIBC)
 CHECK_FUNCTION_EXISTS (gettimeofday RV_HAVE_GETTIMEOFDAY)
 CHECK_FUNCTION_EXISTS(strtok_r RV_HAVE_STRTOK_R)
 CHECK_FUNCTION_EXISTS(strtok_s RV_HAVE_STRTOK_S)
+CHECK_FUNCTION_EXISTS(glob RV_HAVE_GLOB)
 CHECK_LIBRARY_EXISTS (rt clock_gettime "" CLOCK_GETTIME_IN_LIBRT)
 CHECK_LIBRARY_EXISTS (posix4 clock_gettime "" CLOCK_GETTIME_IN_LIBPOSIX4)
 if (CLOCK_GETTIME_IN_LIBC)
@@ -25,6 +25,13 @@
  */
 
 #include "rest_vol.h"
+#include "util/rest_vol_local_store.h"  /* In-process store behind the local transport */
+#include "util/rest_vol_socket_paths.h" /* Local sockets that requests are spread across */
+
+#ifdef WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#endif
 
 /* Default size for buffer used when transforming an HDF5 dataspace into JSON. */
 #define DATASPACE_SHAPE_BUFFER_DEFAULT_SIZE 256
@@ -96,6 +103,30 @@ typedef struct H5_rest_ad_info_t {
     hbool_t unattended;
 } H5_rest_ad_info_t;
 
+/* An Active Directory access token, cached for the process by the tenant,
+ * client and resource it was issued for. Before the token expires, a refresh
+ * request is started on its own multi handle and advanced whenever another
+ * request is made, so that requests don't wait on the token endpoint unless
+ * the token has actually expired. */
+typedef struct RV_ad_token_t {
+    H5_rest_ad_info_t ad_info;
+    char             *access_token;
+    char             *refresh_token;
+    time_t            issued;
+    time_t            expires;
+    time_t            next_refresh;
+    CURLM            *refresh_multi_handle;
+    CURL             *refresh_handle;
+    char             *refresh_response;
+    size_t            refresh_response_len;
+} RV_ad_token_t;
+
+static RV_ad_token_t **RV_ad_tokens_g     = NULL;
+static size_t          RV_num_ad_tokens_g = 0;
+
+/* The token currently used to authenticate requests, if any */
+static RV_ad_token_t *RV_ad_token_g = NULL;
+
 /* Global array containing information about open objects */
 RV_type_info *RV_type_info_array_g[H5I_MAX_NUM_TYPES] = {0};
 
@@ -156,16 +187,208 @@ const char *h5paths_keys[] = {"h5paths", (const char *)0};
 /* JSON key to retrieve the version of server from a request to a file. */
 const char *server_version_keys[] = {"version", (const char *)0};
 
+/* JSON key by which a server advertises, in its response to a request to a file,
+ * that it accepts point selection writes as binary */
+const char *server_binary_point_write_keys[] = {"binaryPointWrite", (const char *)0};
+
 /* Used for cURL's base URL if the connection is through a local socket */
 const char *socket_base_url = "0";
 
+/* Local socket paths that requests are distributed across when connecting
+ * through local sockets */
+static RV_socket_paths_t RV_socket_paths_g = {NULL, 0, 0};
+
+#ifndef WIN32
+/* Source of random bytes for new object IDs, opened on first use */
+static FILE *RV_random_source_g = NULL;
+#endif
+
+/* File that requests are traced to, if tracing is enabled, and its format */
+static FILE             *RV_trace_file_g       = NULL;
+static RV_trace_format_t RV_trace_format_g     = RV_TRACE_FORMAT_JSON_LINES;
+static size_t            RV_trace_num_events_g = 0;
+
+/* Request metrics counted since the connector was initialized or the metrics were last reset */
+static H5rest_stats_t RV_stats_g;
+
+/* A request loaded from a capture for replay, and whether it has been replayed yet */
+typedef struct RV_replay_entry_t {
+    RV_capture_record_t record;
+    char               *method;
+    char               *url;
+    off_t               body_pos; /* Offset of the response body in the capture file, if stored there */
+    hbool_t             used;
+} RV_replay_entry_t;
+
+/* A request which was served in process, either replayed from a capture or served by the
+ * transport, whose response a cURL handle currently holds */
+typedef struct RV_served_t {
+    CURL    *curl_handle;
+    char    *url;
+    long     response_code;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    uint64_t latency_usec;
+} RV_served_t;
+
+/* A transport that requests are sent through. Requests are sent to the server
+ * through cURL unless the transport serves them in process, in which case serve
+ * appends the response body to resp_buffer, if it isn't NULL, and returns the
+ * HTTP response code. serves_chunks is set if the transport serves the chunk
+ * routes which direct chunk transfers use, which aren't part of the REST API
+ * that HSDS implements. */
+typedef struct RV_transport_class_t {
+    const char *name;
+    herr_t (*init)(const char *endpoint);
+    herr_t (*term)(void);
+    herr_t (*serve)(const RV_request_t *request, long *response_code, struct response_buffer *resp_buffer);
+    hbool_t serves_chunks;
+} RV_transport_class_t;
+
+/* Files that requests are recorded to, if capturing is enabled, and the name of
+ * the data file for large response bodies, which is only opened once needed */
+static FILE *RV_capture_file_g           = NULL;
+static FILE *RV_capture_data_file_g      = NULL;
+static char *RV_capture_data_file_name_g = NULL;
+
+/* Capture that responses are served from, if replaying is enabled. Requests on
+ * the global cURL handle are taken in order from the next single-stream entry,
+ * while concurrent transfers are matched against the multi-stream entries from
+ * the first unused one onward. Transfers served in the same round are reported
+ * as finished through a queue of cURL messages. */
+static FILE              *RV_replay_file_g             = NULL;
+static FILE              *RV_replay_data_file_g        = NULL;
+static RV_replay_entry_t *RV_replay_entries_g          = NULL;
+static size_t             RV_replay_num_entries_g      = 0;
+static size_t             RV_replay_entries_nalloc_g   = 0;
+static size_t             RV_replay_next_single_g      = 0;
+static size_t             RV_replay_next_multi_g       = 0;
+static hbool_t            RV_replay_original_latency_g = FALSE;
+static uint64_t           RV_replay_round_latency_g    = 0;
+
+/* Requests served in process, whether replayed or served by the transport. The
+ * request each cURL handle was last served is kept for its response code and
+ * metrics. */
+static RV_served_t *RV_served_g             = NULL;
+static size_t       RV_num_served_g         = 0;
+static size_t       RV_served_nalloc_g      = 0;
+static CURLMsg     *RV_served_msgs_g        = NULL;
+static size_t       RV_num_served_msgs_g    = 0;
+static size_t       RV_next_served_msg_g    = 0;
+static size_t       RV_served_msgs_nalloc_g = 0;
+
+static herr_t RV_local_transport_init(const char *endpoint);
+static herr_t RV_local_transport_term(void);
+static herr_t RV_local_transport_serve(const RV_request_t *request, long *response_code,
+                                       struct response_buffer *resp_buffer);
+
+/* Transports which requests can be sent through, selected by the HSDS_ENDPOINT */
+static const RV_transport_class_t RV_curl_transport_g  = {"curl", NULL, NULL, NULL, FALSE};
+static const RV_transport_class_t RV_local_transport_g = {
+    "local", RV_local_transport_init, RV_local_transport_term, RV_local_transport_serve, TRUE};
+
+static const RV_transport_class_t *RV_transport_g = &RV_curl_transport_g;
+
+/* Endpoint of the local transport, which is stripped from the URLs of requests it serves */
+static char *RV_local_endpoint_g = NULL;
+
+/* A queued request to create an object, which is sent to the server in a
+ * batch with other queued requests. Requests in the same wave don't depend
+ * on each other and are sent concurrently, after those in earlier waves. */
+typedef struct RV_deferred_create_t {
+    char              *request_url;
+    char              *filepath_name;
+    char              *request_body;
+    char               URI[URI_MAX_LENGTH];
+    H5I_type_t         obj_type;
+    size_t             wave;
+    hbool_t            created;
+    hbool_t            rejected;
+    size_t             num_attempts;
+    CURL              *curl_handle;
+    struct curl_slist *curl_headers;
+
+    /* State for retrying a request which the server turned away */
+    hbool_t retry_pending;
+    size_t  num_retries;
+    size_t  current_backoff_duration;
+    size_t  time_of_fail;
+} RV_deferred_create_t;
+
+static RV_deferred_create_t *RV_deferred_creates_g        = NULL;
+static size_t                RV_num_deferred_creates_g    = 0;
+static size_t                RV_deferred_creates_nalloc_g = 0;
+
+/* Connection information read from the environment or config file, which
+ * is read once and then copied for each file that is opened */
+static server_info_t H5_rest_connection_info_g        = {0};
+static hbool_t       H5_rest_connection_info_cached_g = FALSE;
+
 /* Internal initialization/termination functions which are called by
  * the public functions H5rest_init() and H5rest_term() */
 static herr_t H5_rest_init(hid_t vipl_id);
 static herr_t H5_rest_term(void);
 
+static herr_t H5_rest_read_connection_information(server_info_t *server_info);
 static herr_t H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL);
 
+static const char    *RV_ad_authority(void);
+static RV_ad_token_t *RV_ad_token_find(const H5_rest_ad_info_t *ad_info);
+static herr_t RV_ad_token_store(const H5_rest_ad_info_t *ad_info, const char *access_token,
+                                const char *refresh_token, time_t expires);
+static herr_t RV_ad_token_start_refresh(RV_ad_token_t *token);
+static herr_t RV_ad_token_finish_refresh(RV_ad_token_t *token, hbool_t wait);
+static size_t RV_ad_token_write_cb(char *buffer, size_t size, size_t nmemb, void *userp);
+static void   RV_ad_token_cancel_refresh(RV_ad_token_t *token);
+static void   RV_ad_tokens_free(void);
+
+static herr_t H5_rest_set_socket_paths(void);
+
+static herr_t H5_rest_trace_open(void);
+static herr_t H5_rest_trace_close(void);
+
+static herr_t              H5_rest_capture_open(void);
+static herr_t              H5_rest_capture_close(void);
+static herr_t              RV_capture_request(CURL *curl_handle, const char *method, const char *url,
+                                              uint8_t stream, const struct response_buffer *resp_buffer);
+static void                RV_capture_encode(uint8_t **p, uint64_t value, size_t size);
+static uint64_t            RV_capture_decode(const uint8_t **p, size_t size);
+static herr_t              RV_replay_load_index(void);
+static herr_t              RV_replay_read_body(const RV_replay_entry_t *entry,
+                                               struct response_buffer  *resp_buffer);
+static herr_t              RV_replay_serve(CURL *curl_handle, const char *method, const char *url,
+                                           struct response_buffer *resp_buffer, hbool_t concurrent);
+static void                RV_replay_end_round(void);
+static void                RV_replay_sleep(uint64_t usec);
+static CURLMsg            *RV_curl_multi_info_read(CURLM *curl_multi_handle, int *num_msgs);
+
+static hbool_t      RV_serving_in_process(void);
+static herr_t       RV_transport_serve(CURL *curl_handle, const RV_request_t *request,
+                                       struct response_buffer *resp_buffer, hbool_t concurrent);
+static herr_t       RV_served_record(CURL *curl_handle, const char *url, long response_code,
+                                     uint64_t bytes_sent, uint64_t bytes_received, uint64_t latency_usec,
+                                     hbool_t concurrent);
+static RV_served_t *RV_served_find(CURL *curl_handle);
+static void         RV_served_begin_round(void);
+static void         RV_served_free(void);
+static herr_t       RV_response_buffer_reserve(struct response_buffer *resp_buffer, size_t extra);
+
+static size_t   RV_stats_latency_bucket(uint64_t latency_usec);
+static uint64_t RV_stats_bucket_max_latency(size_t bucket);
+static herr_t   H5_rest_stats_dump(void);
+
+static herr_t RV_random_bytes(unsigned char *buf, size_t size);
+static herr_t RV_generate_object_id(const char *root_URI, H5I_type_t obj_type, char *URI_out);
+static size_t RV_deferred_create_write_cb(char *buffer, size_t size, size_t nmemb, void *userp);
+static herr_t RV_deferred_create_send_wave(RV_deferred_create_t *creates, size_t num_creates, size_t wave);
+static void   RV_deferred_creates_free(RV_deferred_create_t *creates, size_t num_creates);
+static void   RV_discard_deferred_creates(void);
+
+static herr_t RV_dataset_setup_selections(RV_object_t *dset, size_t count, hid_t mem_type_id,
+                                          const hid_t mem_space_ids[], const hid_t file_space_ids[],
+                                          void ***dsets_out, hid_t **mem_type_ids_out,
+                                          hid_t **mem_space_ids_out, hid_t **file_space_ids_out);
+
 /* Introspection callbacks */
 static herr_t H5_rest_get_conn_cls(void *obj, H5VL_get_conn_lvl_t lvl, const struct H5VL_class_t **conn_cls);
 static herr_t H5_rest_get_cap_flags(const void *info, uint64_t *cap_flags);
@@ -188,6 +411,11 @@ herr_t RV_parse_creation_properties_callback(yajl_val parse_tree, char **GCPL_bu
 herr_t RV_get_index_of_matching_handle(dataset_transfer_info *transfer_info, size_t count, CURL *handle,
                                        size_t *handle_index);
 
+/* Return the HTTP method of a dataset transfer, and the request it makes */
+static const char *RV_dataset_transfer_method(const dataset_transfer_info *transfer_info);
+static void        RV_dataset_transfer_request(const dataset_transfer_info *transfer_info,
+                                               RV_request_t                *request);
+
 /* Stub that throws an error when called */
 void *RV_wrap_get_object(const void *obj);
 
@@ -240,7 +468,7 @@ static const H5VL_class_t H5VL_rest_g = {
         RV_dataset_write,
         RV_dataset_get,
         RV_dataset_specific,
-        NULL,
+        RV_dataset_optional,
         RV_dataset_close,
     },
 
@@ -415,6 +643,10 @@ H5_rest_init(hid_t vipl_id)
     H5_rest_curr_alloc_bytes = 0;
 #endif
 
+    /* Set up logging first, so that the rest of initialization can be logged */
+    if (RV_log_init() < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up logging");
+
     /* Initialize cURL */
     if (!H5_rest_curl_initialized_g && (CURLE_OK != curl_global_init(CURL_GLOBAL_ALL)))
         FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize cURL");
@@ -433,6 +665,7 @@ H5_rest_init(hid_t vipl_id)
         FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate cURL response buffer");
     response_buffer.buffer_size  = CURL_RESPONSE_BUFFER_DEFAULT_SIZE;
     response_buffer.curr_buf_ptr = response_buffer.buffer;
+    response_buffer.data_size    = 0;
 
     /* Redirect cURL output to response buffer */
     if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, H5_rest_curl_write_data_callback))
@@ -455,23 +688,38 @@ H5_rest_init(hid_t vipl_id)
     const char *URL = getenv("HSDS_ENDPOINT");
 
     if (URL && !strncmp(URL, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX))) {
-        const char *socket_path = "/tmp/hs/sn_1.sock";
+        if (H5_rest_set_socket_paths() < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up local socket paths");
 
-        if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_UNIX_SOCKET_PATH, socket_path))
-            FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't set cURL socket path header: %s",
-                            curl_err_buf);
+        if (RV_set_socket_path(curl) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL socket path");
+    }
+
+    /* Serve requests in process instead of sending them to a server, if asked to */
+    if (URL && !strncmp(URL, LOCAL_STORE_PREFIX, strlen(LOCAL_STORE_PREFIX))) {
+        if (RV_local_transport_g.init(URL) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up %s transport",
+                            RV_local_transport_g.name);
+
+        RV_transport_g = &RV_local_transport_g;
     }
 
+    if (H5_rest_trace_open() < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up request tracing");
+
+    if (H5_rest_capture_open() < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up request capture or replay");
+
+    if (RV_transport_g->serve && (RV_capture_file_g || RV_replay_file_g))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL,
+                        "requests can't be captured or replayed with the %s transport", RV_transport_g->name);
+
 #ifdef RV_CURL_DEBUG
     /* Enable cURL debugging output if desired */
     curl_easy_setopt(curl, CURLOPT_VERBOSE, 1);
 #endif
 
-    /* Set up global type info array */
-    for (size_t i = 0; i < H5I_MAX_NUM_TYPES; i++) {
-        RV_type_info_array_g[i]        = RV_calloc(sizeof(RV_type_info));
-        RV_type_info_array_g[i]->table = rv_hash_table_new(rv_hash_string, H5_rest_compare_string_keys);
-    }
+    /* Entries in the global type info array are set up when an object of that type is first opened */
 
     /* Register the connector with HDF5's error reporting API */
     if ((H5_rest_err_class_g = H5Eregister_class(HDF5_VOL_REST_ERR_CLS_NAME, HDF5_VOL_REST_LIB_NAME,
@@ -619,12 +867,32 @@ H5_rest_term(void)
     if (!H5_rest_initialized_g)
         FUNC_GOTO_DONE(SUCCEED);
 
+    /* Send any object creation requests that are still queued */
+    if (curl && RV_flush_deferred_creates() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't send deferred object creation requests");
+
+    /* Nothing will retry the requests which couldn't be sent */
+    RV_discard_deferred_creates();
+
+    /* Send any dataset writes that are still held back */
+    if (curl && RV_dataset_flush_write_buffers(NULL) < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't send buffered dataset writes");
+
+    /* Shut down the transport once no more requests will be sent through it */
+    if (RV_transport_g->term && RV_transport_g->term() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't shut down %s transport", RV_transport_g->name);
+
+    RV_transport_g = &RV_curl_transport_g;
+
     /* Free memory for cURL response buffer */
     if (response_buffer.buffer) {
         RV_free(response_buffer.buffer);
         response_buffer.buffer = NULL;
     }
 
+    /* Cancel any access token refreshes in progress and free cached tokens */
+    RV_ad_tokens_free();
+
     /* Allow cURL to clean up */
     if (curl) {
         curl_easy_cleanup(curl);
@@ -632,6 +900,36 @@ H5_rest_term(void)
         curl_global_cleanup();
     } /* end if */
 
+    /* Free the list of local socket paths */
+    RV_socket_paths_free(&RV_socket_paths_g);
+
+    /* Free the cached connection information, so that it is read again if the connector is re-initialized */
+    RV_free(H5_rest_connection_info_g.username);
+    RV_free(H5_rest_connection_info_g.password);
+    RV_free(H5_rest_connection_info_g.base_URL);
+    memset(&H5_rest_connection_info_g, 0, sizeof(H5_rest_connection_info_g));
+    H5_rest_connection_info_cached_g = FALSE;
+
+#ifndef WIN32
+    if (RV_random_source_g) {
+        fclose(RV_random_source_g);
+        RV_random_source_g = NULL;
+    }
+#endif
+
+    if (H5_rest_trace_close() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request trace file");
+
+    if (H5_rest_capture_close() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request capture");
+
+    if (H5_rest_stats_dump() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't write request metrics");
+    memset(&RV_stats_g, 0, sizeof(RV_stats_g));
+
+    if (RV_log_term() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close log file");
+
     /* Cleanup type info array */
     if (RV_type_info_array_g) {
         for (size_t i = 0; i < H5I_MAX_NUM_TYPES; i++) {
@@ -657,212 +955,3126 @@ done:
 } /* end H5_rest_term() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5Pset_fapl_rest_vol
+ * Function:    H5_rest_set_socket_paths
  *
- * Purpose:     Modify the file access property list to use the REST VOL
- *              connector
+ * Purpose:     Builds the list of local socket paths which requests are
+ *              distributed across when connecting to the server through
+ *              local sockets.
  *
- * Return:      Non-negative on success/Negative on failure
+ *              The list is read from the HSDS_SOCKET_PATHS environment
+ *              variable, which contains one or more socket paths
+ *              separated by ':'. Where supported, an entry can also be a
+ *              glob pattern, such as "/tmp/hs/sn_*.sock", which is
+ *              expanded to all of the matching sockets; elsewhere,
+ *              patterns are skipped. If the variable isn't set, all
+ *              sockets matching DEFAULT_SOCKET_PATH_PATTERN are used,
+ *              falling back to DEFAULT_SOCKET_PATH.
  *
- * Programmer:  Jordan Henderson
- *              March, 2017
+ * Return:      Non-negative on success/Negative on failure
  */
-herr_t
-H5Pset_fapl_rest_vol(hid_t fapl_id)
+static herr_t
+H5_rest_set_socket_paths(void)
 {
-    htri_t is_fapl;
-    herr_t ret_value = SUCCEED;
+    const char *socket_paths_env = NULL;
+    size_t      num_skipped      = 0;
+    herr_t      ret_value        = SUCCEED;
 
-    if (H5_rest_id_g < 0)
-        FUNC_GOTO_ERROR(H5E_VOL, H5E_UNINITIALIZED, FAIL, "REST VOL connector not initialized");
+    if (NULL == (socket_paths_env = getenv("HSDS_SOCKET_PATHS")) || !strlen(socket_paths_env))
+        socket_paths_env = DEFAULT_SOCKET_PATH_PATTERN;
 
-    if (H5P_DEFAULT == fapl_id)
-        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL,
-                        "can't set REST VOL connector for default property list");
+    if (RV_socket_paths_add_list(&RV_socket_paths_g, socket_paths_env, &num_skipped) < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't build list of local socket paths from '%s'",
+                        socket_paths_env);
 
-    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
-        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if (!is_fapl)
-        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (num_skipped > 0)
+        RV_LOG_WARN(RV_LOG_CAT_CONNECTOR, "glob() is unavailable; skipped %zu socket path pattern(s) in '%s'",
+                    num_skipped, socket_paths_env);
 
-    if ((ret_value = H5Pset_vol(fapl_id, H5_rest_id_g, NULL)) < 0)
-        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set REST VOL connector in FAPL");
+    /* Nothing was matched, so fall back to the default socket */
+    if (RV_socket_paths_g.num_paths == 0)
+        if (RV_socket_paths_add_list(&RV_socket_paths_g, DEFAULT_SOCKET_PATH, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't add default socket path");
 
-done:
-    PRINT_ERROR_STACK;
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Distributing requests across %zu local socket(s)",
+                 RV_socket_paths_g.num_paths);
 
+done:
     return ret_value;
-} /* end H5Pset_fapl_rest_vol() */
+} /* end H5_rest_set_socket_paths() */
 
-const char *
-H5rest_get_object_uri(hid_t obj_id)
+/*-------------------------------------------------------------------------
+ * Function:    RV_set_socket_path
+ *
+ * Purpose:     If connecting to the server through local sockets, sets
+ *              the socket used by the given cURL handle to the next one
+ *              in a round-robin rotation over all local sockets. This
+ *              spreads concurrent requests, such as the transfers of a
+ *              multi-dataset read or write, across all of the local
+ *              server nodes. Does nothing if not using local sockets.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_set_socket_path(CURL *curl_handle)
 {
-    RV_object_t *VOL_obj;
-    char        *ret_value = NULL;
+    const char *socket_path = NULL;
+    herr_t      ret_value   = SUCCEED;
 
-    /* TODO: Route through REST VOL optional catch-all function */
+    if (NULL == (socket_path = RV_socket_paths_next(&RV_socket_paths_g)))
+        FUNC_GOTO_DONE(SUCCEED);
 
-    if (NULL == (VOL_obj = (RV_object_t *)H5VLobject(obj_id)))
-        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, NULL, "invalid identifier");
-    ret_value = VOL_obj->URI;
+    if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_UNIX_SOCKET_PATH, socket_path))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL socket path");
 
 done:
-    PRINT_ERROR_STACK;
+    return ret_value;
+} /* end RV_set_socket_path() */
 
-    return (const char *)ret_value;
-} /* end H5rest_get_object_uri() */
+/*-------------------------------------------------------------------------
+ * Function:    RV_random_bytes
+ *
+ * Purpose:     Fills a buffer with random bytes from the operating
+ *              system's cryptographically secure generator. On Windows
+ *              this is BCryptGenRandom(); elsewhere, /dev/urandom is
+ *              opened on first use and kept open until the connector is
+ *              terminated, so that its reads are buffered.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_random_bytes(unsigned char *buf, size_t size)
+{
+    herr_t ret_value = SUCCEED;
+
+#ifdef WIN32
+    if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, buf, (ULONG)size, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't generate random bytes");
+#else
+    if (!RV_random_source_g && NULL == (RV_random_source_g = fopen("/dev/urandom", "rb")))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTOPENFILE, FAIL, "can't open /dev/urandom");
+
+    if (fread(buf, 1, size, RV_random_source_g) != size)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't read random bytes");
+#endif
+
+done:
+    return ret_value;
+} /* end RV_random_bytes() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_rest_set_connection_information
+ * Function:    RV_generate_object_id
  *
- * Purpose:     Set the connection information for the REST VOL by first
- *              attempting to get the information from the environment,
- *              then, failing that, attempting to pull the information from
- *              a config file in the user's home directory.
+ * Purpose:     Generates a new ID for an object of the given type in the
+ *              domain with the given root group ID. As HSDS does, the ID
+ *              keeps the leading portion of the root group's ID and takes
+ *              its last 16 hex digits from the variant and node fields of
+ *              a new random UUID, e.g.
+ *              "g-XXXXXXXX-XXXXXXXX-xxxx-xxxxxx-xxxxxx". Only those 8
+ *              bytes are generated, with the RFC 4122 variant bits set on
+ *              the first of them as in HSDS's IDs.
  *
  * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_generate_object_id(const char *root_URI, H5I_type_t obj_type, char *URI_out)
+{
+    unsigned char rand_bytes[8];
+    const char   *root_id = NULL;
+    char          prefix;
+    int           id_len    = 0;
+    herr_t        ret_value = SUCCEED;
+
+    switch (obj_type) {
+        case H5I_GROUP:
+            prefix = 'g';
+            break;
+        case H5I_DATASET:
+            prefix = 'd';
+            break;
+        case H5I_DATATYPE:
+            prefix = 't';
+            break;
+        default:
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object not a group, dataset or datatype");
+    }
+
+    /* Skip the root group's type prefix, and keep the following "XXXXXXXX-XXXXXXXX" */
+    if (strlen(root_URI) < 19 || root_URI[1] != '-')
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "root group ID '%s' is malformed", root_URI);
+
+    root_id = root_URI + 2;
+
+    if (RV_random_bytes(rand_bytes, sizeof(rand_bytes)) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't generate random bytes for object ID");
+
+    /* Set the variant (RFC 4122) bits */
+    rand_bytes[0] = (unsigned char)((rand_bytes[0] & 0x3F) | 0x80);
+
+    /* The random digits follow the root group's digits */
+    if ((id_len = snprintf(URI_out, URI_MAX_LENGTH, "%c-%.17s-%02x%02x-%02x%02x%02x-%02x%02x%02x", prefix,
+                           root_id, rand_bytes[0], rand_bytes[1], rand_bytes[2], rand_bytes[3], rand_bytes[4],
+                           rand_bytes[5], rand_bytes[6], rand_bytes[7])) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if (id_len >= URI_MAX_LENGTH)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_SYSERRSTR, FAIL, "object ID exceeded maximum URI size");
+
+done:
+    return ret_value;
+} /* end RV_generate_object_id() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_deferred_create
  *
- * Programmer:  Jordan Henderson
- *              June, 2018
+ * Purpose:     Queues a request to create an object of the given type in
+ *              the given domain, instead of sending it immediately. The
+ *              object is assigned a new ID, which is added to the
+ *              request body and copied to URI_out.
+ *
+ *              parent_URI is the ID of the group the object is linked
+ *              into, if known. A queued group whose parent is also queued
+ *              is sent in the wave after its parent. Datasets and
+ *              datatypes are sent after all groups and datatypes queued
+ *              before them, since they may be linked under those groups
+ *              or use those datatypes.
+ *
+ *              If the queue is full, all queued requests are sent.
+ *
+ * Return:      Non-negative on success/Negative on failure
  */
 herr_t
-H5_rest_set_connection_information(server_info_t *server_info)
+RV_deferred_create(RV_object_t *domain, H5I_type_t obj_type, const char *parent_URI, const char *request_body,
+                   char *URI_out)
 {
-    H5_rest_ad_info_t ad_info;
-    FILE             *config_file = NULL;
-    herr_t            ret_value   = SUCCEED;
+    RV_deferred_create_t *new_create = NULL;
+    const char           *body_start = NULL;
+    const char           *endpoint   = NULL;
+    size_t                body_nalloc;
+    size_t                url_nalloc;
+    size_t                wave = 0;
+    int                   body_len;
+    herr_t                ret_value = SUCCEED;
+
+    if (!domain || !URI_out)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid deferred object creation arguments");
+
+    if (RV_generate_object_id(domain->URI, obj_type, URI_out) < 0)
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "can't generate ID for new object");
+
+    /* Determine which wave this request can be sent in */
+    for (size_t i = 0; i < RV_num_deferred_creates_g; i++) {
+        RV_deferred_create_t *queued = &RV_deferred_creates_g[i];
+
+        if (obj_type == H5I_GROUP) {
+            if (parent_URI && !strcmp(queued->URI, parent_URI))
+                wave = queued->wave + 1;
+        }
+        else if (queued->obj_type != H5I_DATASET && queued->wave + 1 > wave)
+            wave = queued->wave + 1;
+    }
 
-    const char *username = NULL;
-    const char *password = NULL;
-    const char *base_URL = NULL;
+    if (RV_num_deferred_creates_g == RV_deferred_creates_nalloc_g) {
+        RV_deferred_create_t *tmp_realloc = NULL;
+        size_t                new_nalloc  = 16;
 
-    memset(&ad_info, 0, sizeof(ad_info));
+        if (RV_deferred_creates_nalloc_g)
+            new_nalloc = 2 * RV_deferred_creates_nalloc_g;
 
-    /*
-     * Attempt to pull in configuration/authentication information from
-     * the environment.
-     */
+        if (NULL ==
+            (tmp_realloc = RV_realloc(RV_deferred_creates_g, new_nalloc * sizeof(RV_deferred_create_t))))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate deferred creation queue");
 
-    if (base_URL = getenv("HSDS_ENDPOINT")) {
+        RV_deferred_creates_g        = tmp_realloc;
+        RV_deferred_creates_nalloc_g = new_nalloc;
+    }
 
-        username = getenv("HSDS_USERNAME");
-        password = getenv("HSDS_PASSWORD");
+    new_create = &RV_deferred_creates_g[RV_num_deferred_creates_g];
+    memset(new_create, 0, sizeof(*new_create));
 
-        if (!strncmp(base_URL, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX))) {
-            base_URL = socket_base_url;
-        }
+    new_create->obj_type = obj_type;
+    new_create->wave     = wave;
+    strcpy(new_create->URI, URI_out);
 
-        if (!username && !password) {
-            const char *clientID      = getenv("HSDS_AD_CLIENT_ID");
-            const char *tenantID      = getenv("HSDS_AD_TENANT_ID");
-            const char *resourceID    = getenv("HSDS_AD_RESOURCE_ID");
-            const char *client_secret = getenv("HSDS_AD_CLIENT_SECRET");
+    /* Add the new ID as the first member of the request body */
+    body_start = (request_body && request_body[0] == '{') ? request_body + 1 : "}";
+    while (*body_start == ' ')
+        body_start++;
 
-            if (clientID)
-                strncpy(ad_info.clientID, clientID, sizeof(ad_info.clientID) - 1);
-            if (tenantID)
-                strncpy(ad_info.tenantID, tenantID, sizeof(ad_info.tenantID) - 1);
-            if (resourceID)
-                strncpy(ad_info.resourceID, resourceID, sizeof(ad_info.resourceID) - 1);
-            if (client_secret) {
-                ad_info.unattended = TRUE;
-                strncpy(ad_info.client_secret, client_secret, sizeof(ad_info.client_secret) - 1);
-            } /* end if */
+    body_nalloc = strlen(body_start) + strlen(URI_out) + 16;
 
-            /* Attempt authentication with Active Directory */
-            if (H5_rest_authenticate_with_AD(&ad_info, base_URL) < 0)
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't authenticate with Active Directory");
-        } /* end else */
-    }     /* end if */
-    else {
-        const char *cfg_file_name = ".hscfg";
-        size_t      pathname_len  = 0;
-        char       *home_dir      = NULL;
-        char       *pathname      = NULL;
-        char        file_line[1024];
-        int         file_path_len = 0;
+    if (NULL == (new_create->request_body = RV_malloc(body_nalloc)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate space for deferred request body");
 
-        /*
-         * If a valid endpoint was not obtained from the environment,
-         * try to get the connection information from a config file
-         * in the user's home directory.
-         */
-#ifdef WIN32
-        char *home_drive = NULL;
+    if ((body_len = snprintf(new_create->request_body, body_nalloc, "{\"id\": \"%s\"%s%s", URI_out,
+                             (*body_start == '}') ? "" : ", ", body_start)) < 0)
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_SYSERRSTR, FAIL, "snprintf error");
 
-        if (NULL == (home_drive = getenv("HOMEDRIVE")))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
-                            "reading config file - unable to retrieve location of home directory");
+    if ((size_t)body_len >= body_nalloc)
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_SYSERRSTR, FAIL, "deferred request body exceeded allocated size");
 
-        if (NULL == (home_dir = getenv("HOMEPATH")))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
-                            "reading config file - unable to retrieve location of home directory");
+    switch (obj_type) {
+        case H5I_GROUP:
+            endpoint = "/groups";
+            break;
+        case H5I_DATASET:
+            endpoint = "/datasets";
+            break;
+        case H5I_DATATYPE:
+        default:
+            endpoint = "/datatypes";
+            break;
+    }
 
-        pathname_len = strlen(home_drive) + strlen(home_dir) + strlen(cfg_file_name) + 3;
-        if (NULL == (pathname = RV_malloc(pathname_len)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL,
-                            "unable to allocate space for config file pathname");
+    url_nalloc = strlen(domain->u.file.server_info.base_URL) + strlen(endpoint) + 1;
 
-        if ((file_path_len =
-                 snprintf(pathname, pathname_len, "%s\\%s\\%s", home_drive, home_dir, cfg_file_name)) < 0)
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "snprintf error");
+    if (NULL == (new_create->request_url = RV_malloc(url_nalloc)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate space for request URL");
 
-        if (file_path_len >= pathname_len)
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL,
-                            "config file path length exceeded maximum path length");
-#else
-        if (NULL == (home_dir = getenv("HOME")))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
-                            "reading config file - unable to retrieve location of home directory");
+    snprintf(new_create->request_url, url_nalloc, "%s%s", domain->u.file.server_info.base_URL, endpoint);
 
-        pathname_len = strlen(home_dir) + strlen(cfg_file_name) + 2;
-        if (NULL == (pathname = RV_malloc(pathname_len)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL,
-                            "unable to allocate space for config file pathname");
+    if (NULL == (new_create->filepath_name = RV_malloc(strlen(domain->u.file.filepath_name) + 1)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate space for copy of domain path");
 
-        if ((file_path_len = snprintf(pathname, pathname_len, "%s/%s", home_dir, cfg_file_name)) < 0)
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+    strcpy(new_create->filepath_name, domain->u.file.filepath_name);
 
-        if (file_path_len >= pathname_len)
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL,
-                            "config file path length exceeded maximum path length");
-#endif
+    RV_num_deferred_creates_g++;
+    new_create = NULL;
 
-        if (NULL == (config_file = fopen(pathname, "r")))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "unable to open config file");
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Queued creation of object %s in wave %zu", URI_out, wave);
 
-        /*
-         * Parse the connection information by searching for
-         * URL, username and password key-value pairs.
-         */
-        while (fgets(file_line, sizeof(file_line), config_file) != NULL) {
-            char *key;
-            char *val;
+    if (RV_num_deferred_creates_g >= DEFERRED_CREATE_QUEUE_MAX)
+        if (RV_flush_deferred_creates() < 0)
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
 
-            if ((file_line[0] == '#') || !strlen(file_line))
-                continue;
-            key = strtok(file_line, " =\n");
-            val = strtok(NULL, " =\n");
+done:
+    /* Discard a partially set up request */
+    if (new_create) {
+        RV_free(new_create->request_body);
+        RV_free(new_create->request_url);
+        RV_free(new_create->filepath_name);
+    }
 
-            if (!strcmp(key, "hs_endpoint")) {
-                if (val) {
-                    if (!strncmp(base_URL, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX))) {
-                        base_URL = socket_base_url;
-                    }
-                    else {
-                        base_URL = val;
-                    }
-                } /* end if */
-            }     /* end if */
-            else if (!strcmp(key, "hs_ad_app_id")) {
-                if (val && strlen(val))
-                    strncpy(ad_info.clientID, val, sizeof(ad_info.clientID) - 1);
-            } /* end else */
-            else if (!strcmp(key, "hs_ad_tenant_id")) {
-                if (val && strlen(val))
-                    strncpy(ad_info.tenantID, val, sizeof(ad_info.tenantID) - 1);
-            } /* end else */
-            else if (!strcmp(key, "hs_ad_resource_id")) {
+    return ret_value;
+} /* end RV_deferred_create() */
+
+/* Write callback for deferred creation requests, whose responses aren't needed */
+static size_t
+RV_deferred_create_write_cb(char *buffer, size_t size, size_t nmemb, void *userp)
+{
+    (void)buffer;
+    (void)userp;
+
+    return size * nmemb;
+} /* end RV_deferred_create_write_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_deferred_create_send_wave
+ *
+ * Purpose:     Concurrently sends all of the queued object creation
+ *              requests in the given wave which haven't been created
+ *              yet. Requests which the server turns away with a 503 are
+ *              retried after a backoff, as for dataset transfers. Each
+ *              request which succeeds is marked as created, even if
+ *              others in the wave fail.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_deferred_create_send_wave(RV_deferred_create_t *creates, size_t num_creates, size_t wave)
+{
+    CURLM   *curl_multi_handle   = NULL;
+    CURLMsg *curl_multi_msg      = NULL;
+    size_t   num_retries_pending = 0;
+    int      num_still_running   = 0;
+    int      num_curlm_msgs      = 0;
+    herr_t   ret_value           = SUCCEED;
+
+    if (RV_refresh_access_token() < 0)
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't refresh access token");
+
+    if (NULL == (curl_multi_handle = curl_multi_init()))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't initialize cURL multi handle");
+
+    if (CURLM_OK != curl_multi_setopt(curl_multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, NUM_MAX_HOST_CONNS))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "can't set max connections for cURL multi handle");
+
+    for (size_t i = 0; i < num_creates; i++) {
+        RV_deferred_create_t *create      = &creates[i];
+        char                 *host_header = NULL;
+
+        if (create->wave != wave || create->created || create->rejected)
+            continue;
+
+        if (NULL == (create->curl_handle = curl_easy_duphandle(curl)))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't duplicate cURL handle");
+
+        if (RV_set_socket_path(create->curl_handle) < 0)
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "can't set socket path for request");
+
+        if (NULL == (host_header = RV_malloc(strlen(host_string) + strlen(create->filepath_name) + 1)))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate space for request Host header");
+
+        strcpy(host_header, host_string);
+        strcat(host_header, create->filepath_name);
+
+        /* cURL copies the header strings, so the host header can be freed immediately */
+        create->curl_headers = curl_slist_append(create->curl_headers, host_header);
+        create->curl_headers = curl_slist_append(create->curl_headers, "Content-Type: application/json");
+        create->curl_headers = curl_slist_append(create->curl_headers, "Expect:");
+
+        RV_free(host_header);
+
+        if (CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_UPLOAD, 0) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_CUSTOMREQUEST, NULL) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_POST, 1) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_POSTFIELDS, create->request_body) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_POSTFIELDSIZE_LARGE,
+                                         (curl_off_t)strlen(create->request_body)) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_HTTPHEADER, create->curl_headers) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_WRITEFUNCTION,
+                                         RV_deferred_create_write_cb) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_PRIVATE, create) ||
+            CURLE_OK != curl_easy_setopt(create->curl_handle, CURLOPT_URL, create->request_url))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "can't set up cURL request for deferred creation");
+
+        if (CURLM_OK != curl_multi_add_handle(curl_multi_handle, create->curl_handle))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "can't add cURL handle to multi handle");
+
+        create->num_attempts++;
+    }
+
+    do {
+        if (RV_serving_in_process()) {
+            /* Serve every request in flight in process, as if they all finished together.
+             * Requests waiting to be retried are still running, and are served once re-added. */
+            RV_served_begin_round();
+            num_still_running = 0;
+
+            for (size_t i = 0; i < num_creates; i++) {
+                RV_deferred_create_t *create = &creates[i];
+
+                if (create->wave != wave || !create->curl_handle)
+                    continue;
+
+                num_still_running++;
+
+                if (create->retry_pending)
+                    continue;
+
+                if (RV_replay_file_g) {
+                    if (RV_replay_serve(create->curl_handle, "POST", create->request_url, NULL, TRUE) < 0)
+                        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL,
+                                        "can't replay deferred object creation");
+                }
+                else {
+                    RV_request_t request = {"POST",
+                                            create->request_url,
+                                            create->filepath_name,
+                                            "application/json",
+                                            create->request_body,
+                                            strlen(create->request_body)};
+
+                    if (RV_transport_serve(create->curl_handle, &request, NULL, TRUE) < 0)
+                        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL,
+                                        "can't serve deferred object creation");
+                }
+            }
+
+            RV_replay_end_round();
+        }
+        else if (CURLM_OK != curl_multi_perform(curl_multi_handle, &num_still_running))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "cURL multi perform error");
+
+        while ((curl_multi_msg = RV_curl_multi_info_read(curl_multi_handle, &num_curlm_msgs))) {
+            RV_deferred_create_t *create        = NULL;
+            long                  response_code = 0;
+
+            if (curl_multi_msg->msg != CURLMSG_DONE)
+                continue;
+
+            if (CURLE_OK !=
+                curl_easy_getinfo(curl_multi_msg->easy_handle, CURLINFO_PRIVATE, (char **)&create))
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get deferred creation request");
+
+            if (CURLE_OK != curl_multi_msg->data.result)
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "deferred creation of object %s failed: %s",
+                                create->URI, curl_easy_strerror(curl_multi_msg->data.result));
+
+            if (RV_curl_get_response_code(curl_multi_msg->easy_handle, &response_code) < 0)
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get HTTP response code");
+
+            if (RV_trace_request(curl_multi_msg->easy_handle, "POST", "deferred create",
+                                 create->filepath_name, 0, create->num_retries) < 0)
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't trace deferred creation request");
+
+            if (RV_stats_record_request(curl_multi_msg->easy_handle, H5REST_OP_POST) < 0)
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL,
+                                "can't count deferred creation request in metrics");
+
+            if (RV_capture_request(curl_multi_msg->easy_handle, "POST", create->request_url,
+                                   RV_CAPTURE_STREAM_MULTI, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_WRITEERROR, FAIL, "can't record deferred creation request");
+
+            /* Gracefully handle 503 Error, which can result from sending too many simultaneous
+             * requests */
+            if (response_code == 503) {
+                create->num_retries++;
+
+                if (CURLM_OK != curl_multi_remove_handle(curl_multi_handle, curl_multi_msg->easy_handle))
+                    FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTREMOVE, FAIL, "failed to remove denied cURL handle");
+
+                create->retry_pending = TRUE;
+                create->time_of_fail  = (size_t)RV_now_usec();
+
+                create->current_backoff_duration =
+                    (create->current_backoff_duration == 0)
+                        ? BACKOFF_INITIAL_DURATION
+                        : (size_t)((double)create->current_backoff_duration * BACKOFF_SCALE_FACTOR);
+
+                /* Randomize time to avoid doing all retry attempts at once */
+                create->current_backoff_duration = (size_t)((double)create->current_backoff_duration *
+                                                            (1.0 + ((double)rand() / (double)RAND_MAX)));
+
+                if (create->current_backoff_duration >= BACKOFF_MAX_BEFORE_FAIL)
+                    FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL,
+                                    "Unable to reach server to create object %s: 503 service unavailable",
+                                    create->URI);
+
+                RV_stats_record_retry(H5REST_OP_POST, (uint64_t)create->current_backoff_duration);
+                num_retries_pending++;
+
+                continue;
+            }
+
+            /* A request sent in an earlier flush which failed may have reached the server */
+            if (response_code == 409 && create->num_attempts > 1)
+                RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Object %s was already created by an earlier attempt",
+                             create->URI);
+            else {
+                /* Sending a request which the server rejected again won't help */
+                if (HTTP_CLIENT_ERROR(response_code))
+                    create->rejected = TRUE;
+
+                HANDLE_RESPONSE(response_code, H5E_OBJECT, H5E_CANTCREATE, FAIL);
+            }
+
+            create->created = TRUE;
+
+            if (CURLM_OK != curl_multi_remove_handle(curl_multi_handle, curl_multi_msg->easy_handle))
+                FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTREMOVE, FAIL, "failed to remove finished cURL handle");
+
+            curl_easy_cleanup(create->curl_handle);
+            create->curl_handle = NULL;
+
+            curl_slist_free_all(create->curl_headers);
+            create->curl_headers = NULL;
+        }
+
+        /* Re-add the requests which have waited out their backoff */
+        if (num_retries_pending > 0) {
+            size_t curr_time_us = (size_t)RV_now_usec();
+
+            for (size_t i = 0; i < num_creates; i++) {
+                RV_deferred_create_t *create = &creates[i];
+
+                if (create->wave != wave || !create->retry_pending ||
+                    (curr_time_us - create->time_of_fail) < create->current_backoff_duration)
+                    continue;
+
+                /* Send the retry to a different local server node, if there are several */
+                if (RV_set_socket_path(create->curl_handle) < 0)
+                    FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "can't set socket path for retry");
+
+                if (CURLM_OK != curl_multi_add_handle(curl_multi_handle, create->curl_handle))
+                    FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTSET, FAIL, "failed to re-add denied cURL handle");
+
+                create->retry_pending = FALSE;
+                num_retries_pending--;
+            }
+        }
+
+        if (!RV_serving_in_process() && num_still_running > 0 &&
+            CURLM_OK != curl_multi_wait(curl_multi_handle, NULL, 0, DEFAULT_POLL_TIMEOUT_MS, NULL))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "cURL multi wait error");
+    } while (num_still_running > 0 || num_retries_pending > 0);
+
+done:
+    for (size_t i = 0; i < num_creates; i++) {
+        if (creates[i].curl_handle) {
+            if (curl_multi_handle && !creates[i].retry_pending)
+                curl_multi_remove_handle(curl_multi_handle, creates[i].curl_handle);
+            curl_easy_cleanup(creates[i].curl_handle);
+            creates[i].curl_handle = NULL;
+        }
+
+        if (creates[i].curl_headers) {
+            curl_slist_free_all(creates[i].curl_headers);
+            creates[i].curl_headers = NULL;
+        }
+
+        /* A later flush starts the backoff over */
+        creates[i].retry_pending            = FALSE;
+        creates[i].current_backoff_duration = 0;
+    }
+
+    if (curl_multi_handle)
+        curl_multi_cleanup(curl_multi_handle);
+
+    return ret_value;
+} /* end RV_deferred_create_send_wave() */
+
+/* Helper to free queued object creation requests */
+static void
+RV_deferred_creates_free(RV_deferred_create_t *creates, size_t num_creates)
+{
+    for (size_t i = 0; i < num_creates; i++) {
+        RV_free(creates[i].request_body);
+        RV_free(creates[i].request_url);
+        RV_free(creates[i].filepath_name);
+    }
+
+    RV_free(creates);
+} /* end RV_deferred_creates_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_flush_deferred_creates
+ *
+ * Purpose:     Sends all queued object creation requests to the server,
+ *              one wave at a time, stopping at the first wave which
+ *              fails. Requests which the server rejected are dropped,
+ *              but those which weren't sent or may have failed for
+ *              transient reasons are put back at the front of the queue,
+ *              so that the objects whose IDs were handed out are created
+ *              by a later flush.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_flush_deferred_creates(void)
+{
+    RV_deferred_create_t *creates        = RV_deferred_creates_g;
+    size_t                num_creates    = RV_num_deferred_creates_g;
+    size_t                creates_nalloc = RV_deferred_creates_nalloc_g;
+    size_t                num_remaining  = 0;
+    size_t                max_wave       = 0;
+    herr_t                ret_value      = SUCCEED;
+
+    if (num_creates == 0)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    /* Take the queue, so that requests made while sending it start a new one */
+    RV_deferred_creates_g        = NULL;
+    RV_num_deferred_creates_g    = 0;
+    RV_deferred_creates_nalloc_g = 0;
+
+    for (size_t i = 0; i < num_creates; i++)
+        if (creates[i].wave > max_wave)
+            max_wave = creates[i].wave;
+
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Sending %zu deferred object creation requests in %zu wave(s)",
+                 num_creates, max_wave + 1);
+
+    for (size_t wave = 0; wave <= max_wave; wave++)
+        if (RV_deferred_create_send_wave(creates, num_creates, wave) < 0)
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
+
+done:
+    if (creates) {
+        size_t max_remaining_wave = 0;
+
+        /* Keep the requests which may still succeed, in their original order */
+        for (size_t i = 0; i < num_creates; i++) {
+            if (creates[i].created || creates[i].rejected) {
+                RV_free(creates[i].request_body);
+                RV_free(creates[i].request_url);
+                RV_free(creates[i].filepath_name);
+                continue;
+            }
+
+            if (creates[i].wave > max_remaining_wave)
+                max_remaining_wave = creates[i].wave;
+
+            creates[num_remaining++] = creates[i];
+        }
+
+        if (num_remaining == 0)
+            RV_free(creates);
+        else {
+            RV_LOG_WARN(RV_LOG_CAT_CONNECTOR, "%zu object creation request(s) left queued for retry",
+                        num_remaining);
+
+            /* Requests queued while sending go after the remaining ones, in later waves */
+            if (num_remaining + RV_num_deferred_creates_g > creates_nalloc) {
+                RV_deferred_create_t *tmp_realloc = NULL;
+
+                creates_nalloc = num_remaining + RV_num_deferred_creates_g;
+
+                if (NULL == (tmp_realloc = RV_realloc(creates, creates_nalloc * sizeof(RV_deferred_create_t)))) {
+                    RV_deferred_creates_free(creates, num_remaining);
+                    FUNC_DONE_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL,
+                                    "can't re-queue deferred object creation requests");
+                    creates = NULL;
+                }
+                else
+                    creates = tmp_realloc;
+            }
+
+            if (creates) {
+                for (size_t i = 0; i < RV_num_deferred_creates_g; i++) {
+                    creates[num_remaining] = RV_deferred_creates_g[i];
+                    creates[num_remaining].wave += max_remaining_wave + 1;
+                    num_remaining++;
+                }
+
+                RV_free(RV_deferred_creates_g);
+
+                RV_deferred_creates_g        = creates;
+                RV_num_deferred_creates_g    = num_remaining;
+                RV_deferred_creates_nalloc_g = creates_nalloc;
+            }
+        }
+    }
+
+    return ret_value;
+} /* end RV_flush_deferred_creates() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_discard_deferred_creates
+ *
+ * Purpose:     Drops all queued object creation requests without sending
+ *              them, e.g. once the connector is shutting down and a
+ *              final flush has failed.
+ *
+ * Return:      Nothing
+ */
+static void
+RV_discard_deferred_creates(void)
+{
+    if (RV_num_deferred_creates_g)
+        RV_LOG_WARN(RV_LOG_CAT_CONNECTOR, "Discarding %zu unsent object creation request(s)",
+                    RV_num_deferred_creates_g);
+
+    RV_deferred_creates_free(RV_deferred_creates_g, RV_num_deferred_creates_g);
+
+    RV_deferred_creates_g        = NULL;
+    RV_num_deferred_creates_g    = 0;
+    RV_deferred_creates_nalloc_g = 0;
+} /* end RV_discard_deferred_creates() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_trace_open
+ *
+ * Purpose:     Opens the request trace file named by the HSDS_TRACE_FILE
+ *              environment variable, if it is set. The format of the
+ *              trace is chosen by HSDS_TRACE_FORMAT, which is either
+ *              "json" for JSON lines (the default) or "chrome" for the
+ *              Chrome trace event format.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+H5_rest_trace_open(void)
+{
+    const char *trace_file_name = NULL;
+    const char *trace_format    = NULL;
+    herr_t      ret_value       = SUCCEED;
+
+    if (NULL == (trace_file_name = getenv(TRACE_FILE_ENV_VAR)) || !strlen(trace_file_name))
+        FUNC_GOTO_DONE(SUCCEED);
+
+    RV_trace_format_g = RV_TRACE_FORMAT_JSON_LINES;
+
+    if ((trace_format = getenv(TRACE_FORMAT_ENV_VAR)) && strlen(trace_format)) {
+        if (!strcmp(trace_format, "chrome"))
+            RV_trace_format_g = RV_TRACE_FORMAT_CHROME;
+        else if (strcmp(trace_format, "json"))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "unknown request trace format '%s'", trace_format);
+    }
+
+    if (NULL == (RV_trace_file_g = fopen(trace_file_name, "w")))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open request trace file '%s'",
+                        trace_file_name);
+
+    RV_trace_num_events_g = 0;
+
+    if (RV_trace_format_g == RV_TRACE_FORMAT_CHROME)
+        fputs("[\n", RV_trace_file_g);
+
+done:
+    return ret_value;
+} /* end H5_rest_trace_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_trace_close
+ *
+ * Purpose:     Finishes and closes the request trace file, if tracing is
+ *              enabled.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+H5_rest_trace_close(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    if (!RV_trace_file_g)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (RV_trace_format_g == RV_TRACE_FORMAT_CHROME)
+        fputs("\n]\n", RV_trace_file_g);
+
+    if (fclose(RV_trace_file_g) != 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request trace file");
+
+    RV_trace_file_g = NULL;
+
+done:
+    return ret_value;
+} /* end H5_rest_trace_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_trace_request
+ *
+ * Purpose:     Records a request which has just completed on the given
+ *              cURL handle to the trace file, if tracing is enabled.
+ *
+ *              Each record holds the HTTP method, the HDF5 operation
+ *              which made the request (if known), the domain and URL of
+ *              the request, the HTTP status, the number of retries
+ *              before this attempt, the bytes sent and received and the
+ *              time spent in each phase of the request, as reported by
+ *              cURL. All times are in microseconds. The phase times are
+ *              cumulative from the start of the request, as in cURL.
+ *
+ *              For the Chrome trace format, transfer_index is used as
+ *              the thread ID of the event, so that concurrent transfers
+ *              of a multi-dataset operation appear on separate tracks.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_trace_request(CURL *curl_handle, const char *method, const char *operation, const char *domain,
+                 size_t transfer_index, size_t num_retries)
+{
+    const char         *url           = NULL;
+    long                response_code = 0;
+    curl_off_t          bytes_up      = 0;
+    curl_off_t          bytes_down    = 0;
+    curl_off_t          dns_time      = 0;
+    curl_off_t          connect_time  = 0;
+    curl_off_t          tls_time      = 0;
+    curl_off_t          ttfb_time     = 0;
+    curl_off_t          total_time    = 0;
+    uint64_t            start_time    = 0;
+    RV_served_t        *served        = NULL;
+    herr_t              ret_value     = SUCCEED;
+
+    if (!RV_trace_file_g)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    /* Requests served in process never reach the network, so only their result and latency are known */
+    if (NULL != (served = RV_served_find(curl_handle))) {
+        url           = served->url;
+        response_code = served->response_code;
+        bytes_up      = (curl_off_t)served->bytes_sent;
+        bytes_down    = (curl_off_t)served->bytes_received;
+        ttfb_time     = (curl_off_t)served->latency_usec;
+        total_time    = (curl_off_t)served->latency_usec;
+    }
+    else if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_EFFECTIVE_URL, &url) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &response_code) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_SIZE_UPLOAD_T, &bytes_up) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_SIZE_DOWNLOAD_T, &bytes_down) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_NAMELOOKUP_TIME_T, &dns_time) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_CONNECT_TIME_T, &connect_time) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_APPCONNECT_TIME_T, &tls_time) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_STARTTRANSFER_TIME_T, &ttfb_time) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_TOTAL_TIME_T, &total_time))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get request information for trace");
+
+    /* The request has just finished, so work back from now to its start */
+    start_time = RV_now_usec() - (uint64_t)total_time;
+
+    if (RV_trace_format_g == RV_TRACE_FORMAT_CHROME) {
+        if (RV_trace_num_events_g > 0)
+            fputs(",\n", RV_trace_file_g);
+
+        fputs("{\"name\": ", RV_trace_file_g);
+        RV_log_write_json_string(RV_trace_file_g, operation ? operation : method);
+        fputs(", \"cat\": ", RV_trace_file_g);
+        RV_log_write_json_string(RV_trace_file_g, method);
+        fprintf(RV_trace_file_g,
+                ", \"ph\": \"X\", \"ts\": %llu, \"dur\": %" CURL_FORMAT_CURL_OFF_T
+                ", \"pid\": 0, \"tid\": %zu, \"args\": {",
+                (unsigned long long)start_time, total_time, transfer_index);
+    }
+    else
+        fprintf(RV_trace_file_g, "{\"ts\": %llu, ", (unsigned long long)start_time);
+
+    fputs("\"method\": ", RV_trace_file_g);
+    RV_log_write_json_string(RV_trace_file_g, method);
+    fputs(", \"operation\": ", RV_trace_file_g);
+    RV_log_write_json_string(RV_trace_file_g, operation);
+    fputs(", \"domain\": ", RV_trace_file_g);
+    RV_log_write_json_string(RV_trace_file_g, domain);
+    fputs(", \"url\": ", RV_trace_file_g);
+    RV_log_write_json_string(RV_trace_file_g, url);
+    fprintf(RV_trace_file_g,
+            ", \"status\": %ld, \"retries\": %zu, \"bytes_up\": %" CURL_FORMAT_CURL_OFF_T
+            ", \"bytes_down\": %" CURL_FORMAT_CURL_OFF_T ", \"dns\": %" CURL_FORMAT_CURL_OFF_T
+            ", \"connect\": %" CURL_FORMAT_CURL_OFF_T ", \"tls\": %" CURL_FORMAT_CURL_OFF_T
+            ", \"ttfb\": %" CURL_FORMAT_CURL_OFF_T ", \"total\": %" CURL_FORMAT_CURL_OFF_T "}",
+            response_code, num_retries, bytes_up, bytes_down, dns_time, connect_time, tls_time, ttfb_time,
+            total_time);
+
+    if (RV_trace_format_g == RV_TRACE_FORMAT_CHROME)
+        fputc('}', RV_trace_file_g);
+    else
+        fputc('\n', RV_trace_file_g);
+
+    RV_trace_num_events_g++;
+
+done:
+    return ret_value;
+} /* end RV_trace_request() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_capture_open
+ *
+ * Purpose:     Opens the capture file named by the HSDS_CAPTURE_FILE
+ *              environment variable, to which requests are recorded, or
+ *              loads the capture named by the HSDS_REPLAY_FILE
+ *              environment variable, from which responses are replayed
+ *              instead of sending requests to the server. Nothing is
+ *              done if neither is set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+H5_rest_capture_open(void)
+{
+    const char    *capture_file_name = getenv(CAPTURE_FILE_ENV_VAR);
+    const char    *replay_file_name  = getenv(REPLAY_FILE_ENV_VAR);
+    const char    *latency_mode      = NULL;
+    const char    *file_name         = NULL;
+    char           magic[sizeof(RV_CAPTURE_MAGIC) - 1];
+    uint8_t        version_buf[4];
+    uint8_t       *version_out = version_buf;
+    const uint8_t *version_in  = version_buf;
+    uint32_t       version     = 0;
+    herr_t         ret_value   = SUCCEED;
+
+    if (capture_file_name && !strlen(capture_file_name))
+        capture_file_name = NULL;
+    if (replay_file_name && !strlen(replay_file_name))
+        replay_file_name = NULL;
+
+    if (!capture_file_name && !replay_file_name)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (capture_file_name && replay_file_name)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "can't both record and replay requests");
+
+    file_name = capture_file_name ? capture_file_name : replay_file_name;
+
+    if (NULL == (RV_capture_data_file_name_g =
+                     RV_malloc(strlen(file_name) + strlen(CAPTURE_DATA_FILE_SUFFIX) + 1)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate space for capture data file name");
+
+    strcpy(RV_capture_data_file_name_g, file_name);
+    strcat(RV_capture_data_file_name_g, CAPTURE_DATA_FILE_SUFFIX);
+
+    if (capture_file_name) {
+        if (NULL == (RV_capture_file_g = fopen(capture_file_name, "wb")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open request capture file '%s'",
+                            capture_file_name);
+
+        RV_capture_encode(&version_out, RV_CAPTURE_VERSION, sizeof(version_buf));
+
+        if (fwrite(RV_CAPTURE_MAGIC, 1, sizeof(magic), RV_capture_file_g) != sizeof(magic) ||
+            fwrite(version_buf, 1, sizeof(version_buf), RV_capture_file_g) != sizeof(version_buf))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't write request capture file header");
+    }
+    else {
+        if (NULL == (RV_replay_file_g = fopen(replay_file_name, "rb")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open request capture file '%s'",
+                            replay_file_name);
+
+        if (fread(magic, 1, sizeof(magic), RV_replay_file_g) != sizeof(magic) ||
+            memcmp(magic, RV_CAPTURE_MAGIC, sizeof(magic)) ||
+            fread(version_buf, 1, sizeof(version_buf), RV_replay_file_g) != sizeof(version_buf))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADFILE, FAIL, "'%s' is not a request capture file",
+                            replay_file_name);
+
+        version = (uint32_t)RV_capture_decode(&version_in, sizeof(version_buf));
+
+        if (version != RV_CAPTURE_VERSION)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_VERSION, FAIL,
+                            "request capture file '%s' has format version %" PRIu32 ", but %d is supported",
+                            replay_file_name, version, RV_CAPTURE_VERSION);
+
+        if (RV_replay_load_index() < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't load requests from capture file '%s'",
+                            replay_file_name);
+
+        latency_mode                 = getenv(REPLAY_LATENCY_ENV_VAR);
+        RV_replay_original_latency_g = latency_mode && !strcmp(latency_mode, "original");
+    }
+
+done:
+    return ret_value;
+} /* end H5_rest_capture_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_capture_close
+ *
+ * Purpose:     Closes the files of the request capture being recorded or
+ *              replayed, if any, and frees the replay state.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+H5_rest_capture_close(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    if (RV_capture_file_g && fclose(RV_capture_file_g) != 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request capture file");
+    if (RV_capture_data_file_g && fclose(RV_capture_data_file_g) != 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request capture data file");
+    if (RV_replay_file_g)
+        fclose(RV_replay_file_g);
+    if (RV_replay_data_file_g)
+        fclose(RV_replay_data_file_g);
+
+    RV_capture_file_g      = NULL;
+    RV_capture_data_file_g = NULL;
+    RV_replay_file_g       = NULL;
+    RV_replay_data_file_g  = NULL;
+
+    RV_free(RV_capture_data_file_name_g);
+    RV_capture_data_file_name_g = NULL;
+
+    for (size_t i = 0; i < RV_replay_num_entries_g; i++) {
+        RV_free(RV_replay_entries_g[i].method);
+        RV_free(RV_replay_entries_g[i].url);
+    }
+
+    RV_free(RV_replay_entries_g);
+
+    RV_replay_entries_g          = NULL;
+    RV_replay_num_entries_g      = 0;
+    RV_replay_entries_nalloc_g   = 0;
+    RV_replay_next_single_g      = 0;
+    RV_replay_next_multi_g       = 0;
+    RV_replay_original_latency_g = FALSE;
+    RV_replay_round_latency_g    = 0;
+
+    RV_served_free();
+
+    return ret_value;
+} /* end H5_rest_capture_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_capture_request
+ *
+ * Purpose:     Appends a request which has just completed on the given
+ *              cURL handle, and its response, to the capture file, if
+ *              requests are being recorded.
+ *
+ *              The method and URL should be those the request was set
+ *              up with, which are what replayed requests are matched
+ *              against. If either is NULL, it is taken from cURL where
+ *              it is able to report it. The response body is the
+ *              contents of the given response buffer, which may be NULL
+ *              if the response body was discarded. Bodies too large to
+ *              store inline are appended to the capture data file
+ *              instead, so that a capture of large dataset transfers
+ *              stays cheap to scan.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_capture_request(CURL *curl_handle, const char *method, const char *url, uint8_t stream,
+                   const struct response_buffer *resp_buffer)
+{
+    RV_capture_record_t record;
+    uint8_t             record_buf[RV_CAPTURE_RECORD_SIZE];
+    uint8_t            *record_ptr    = record_buf;
+    long                response_code = 0;
+    curl_off_t          bytes_up      = 0;
+    curl_off_t          total_time    = 0;
+    off_t               data_offset   = 0;
+    herr_t              ret_value     = SUCCEED;
+
+    if (!RV_capture_file_g)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if ((!url && CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_EFFECTIVE_URL, &url)) ||
+        CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &response_code) ||
+        CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_SIZE_UPLOAD_T, &bytes_up) ||
+        CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_TOTAL_TIME_T, &total_time))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get request information for capture");
+
+#if LIBCURL_VERSION_NUM >= 0x074800
+    if (!method && CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_EFFECTIVE_METHOD, &method))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get request method for capture");
+#endif
+
+    if (!method)
+        method = "";
+    if (!url)
+        url = "";
+
+    memset(&record, 0, sizeof(record));
+    record.latency_usec  = (uint64_t)total_time;
+    record.bytes_sent    = (uint64_t)bytes_up;
+    record.response_code = (int32_t)response_code;
+    record.url_len       = (uint32_t)strlen(url);
+    record.method_len    = (uint16_t)strlen(method);
+    record.stream        = stream;
+
+    if (resp_buffer && resp_buffer->buffer)
+        record.body_size = (uint64_t)(resp_buffer->curr_buf_ptr - resp_buffer->buffer);
+
+    if (record.body_size > CAPTURE_INLINE_BODY_MAX) {
+        if (!RV_capture_data_file_g &&
+            NULL == (RV_capture_data_file_g = fopen(RV_capture_data_file_name_g, "wb")))
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTOPENFILE, FAIL, "can't open request capture data file '%s'",
+                            RV_capture_data_file_name_g);
+
+        if ((data_offset = ftello(RV_capture_data_file_g)) < 0)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get offset in request capture data file");
+
+        if (fwrite(resp_buffer->buffer, 1, (size_t)record.body_size, RV_capture_data_file_g) !=
+            (size_t)record.body_size)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_WRITEERROR, FAIL, "can't write response to capture data file");
+
+        record.flags |= RV_CAPTURE_FLAG_BODY_IN_DATA_FILE;
+        record.body_offset = (uint64_t)data_offset;
+    }
+
+    RV_capture_encode(&record_ptr, record.latency_usec, 8);
+    RV_capture_encode(&record_ptr, record.bytes_sent, 8);
+    RV_capture_encode(&record_ptr, record.body_size, 8);
+    RV_capture_encode(&record_ptr, record.body_offset, 8);
+    RV_capture_encode(&record_ptr, (uint32_t)record.response_code, 4);
+    RV_capture_encode(&record_ptr, record.url_len, 4);
+    RV_capture_encode(&record_ptr, record.method_len, 2);
+    RV_capture_encode(&record_ptr, record.stream, 1);
+    RV_capture_encode(&record_ptr, record.flags, 1);
+
+    if (fwrite(record_buf, 1, sizeof(record_buf), RV_capture_file_g) != sizeof(record_buf) ||
+        fwrite(method, 1, record.method_len, RV_capture_file_g) != record.method_len ||
+        fwrite(url, 1, record.url_len, RV_capture_file_g) != record.url_len)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_WRITEERROR, FAIL, "can't write request to capture file");
+
+    if (!(record.flags & RV_CAPTURE_FLAG_BODY_IN_DATA_FILE) && record.body_size > 0 &&
+        fwrite(resp_buffer->buffer, 1, (size_t)record.body_size, RV_capture_file_g) !=
+            (size_t)record.body_size)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_WRITEERROR, FAIL, "can't write response to capture file");
+
+done:
+    return ret_value;
+} /* end RV_capture_request() */
+
+/* Helper to encode an unsigned integer of the given size in bytes into a capture file
+ * buffer in little-endian byte order, advancing the buffer pointer past it */
+static void
+RV_capture_encode(uint8_t **p, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        *(*p)++ = (uint8_t)(value & 0xFF);
+        value >>= 8;
+    }
+} /* end RV_capture_encode() */
+
+/* Counterpart of RV_capture_encode() which decodes an unsigned integer from a capture file buffer */
+static uint64_t
+RV_capture_decode(const uint8_t **p, size_t size)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < size; i++)
+        value |= (uint64_t)(*(*p)++) << (8 * i);
+
+    return value;
+} /* end RV_capture_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_replay_load_index
+ *
+ * Purpose:     Reads the header, method and URL of every request in the
+ *              capture being replayed. Response bodies are left in the
+ *              capture and data files and only read when replayed. A
+ *              record cut short at the end of the capture, as left by a
+ *              process which did not terminate the connector, is
+ *              ignored.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_replay_load_index(void)
+{
+    RV_capture_record_t record;
+    uint8_t             record_buf[RV_CAPTURE_RECORD_SIZE];
+    herr_t              ret_value = SUCCEED;
+
+    while (fread(record_buf, 1, sizeof(record_buf), RV_replay_file_g) == sizeof(record_buf)) {
+        RV_replay_entry_t *entry      = NULL;
+        const uint8_t     *record_ptr = record_buf;
+
+        record.latency_usec  = RV_capture_decode(&record_ptr, 8);
+        record.bytes_sent    = RV_capture_decode(&record_ptr, 8);
+        record.body_size     = RV_capture_decode(&record_ptr, 8);
+        record.body_offset   = RV_capture_decode(&record_ptr, 8);
+        record.response_code = (int32_t)(uint32_t)RV_capture_decode(&record_ptr, 4);
+        record.url_len       = (uint32_t)RV_capture_decode(&record_ptr, 4);
+        record.method_len    = (uint16_t)RV_capture_decode(&record_ptr, 2);
+        record.stream        = (uint8_t)RV_capture_decode(&record_ptr, 1);
+        record.flags         = (uint8_t)RV_capture_decode(&record_ptr, 1);
+
+        if (RV_replay_num_entries_g == RV_replay_entries_nalloc_g) {
+            size_t             new_nalloc = RV_replay_entries_nalloc_g ? 2 * RV_replay_entries_nalloc_g : 256;
+            RV_replay_entry_t *tmp_realloc;
+
+            if (NULL == (tmp_realloc = RV_realloc(RV_replay_entries_g, new_nalloc * sizeof(*tmp_realloc))))
+                FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL,
+                                "can't allocate space for replayed requests");
+
+            RV_replay_entries_g        = tmp_realloc;
+            RV_replay_entries_nalloc_g = new_nalloc;
+        }
+
+        entry = &RV_replay_entries_g[RV_replay_num_entries_g];
+        memset(entry, 0, sizeof(*entry));
+        entry->record = record;
+
+        if (NULL == (entry->method = RV_malloc((size_t)record.method_len + 1)) ||
+            NULL == (entry->url = RV_malloc((size_t)record.url_len + 1))) {
+            RV_free(entry->method);
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't allocate space for replayed request");
+        }
+
+        RV_replay_num_entries_g++;
+
+        if (fread(entry->method, 1, record.method_len, RV_replay_file_g) != record.method_len ||
+            fread(entry->url, 1, record.url_len, RV_replay_file_g) != record.url_len)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "request capture file is truncated");
+
+        entry->method[record.method_len] = '\0';
+        entry->url[record.url_len]       = '\0';
+
+        if ((entry->body_pos = ftello(RV_replay_file_g)) < 0)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get offset in request capture file");
+
+        if (!(record.flags & RV_CAPTURE_FLAG_BODY_IN_DATA_FILE) &&
+            fseeko(RV_replay_file_g, (off_t)record.body_size, SEEK_CUR) < 0)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_SEEKERROR, FAIL, "can't skip response in request capture file");
+    }
+
+    if (ferror(RV_replay_file_g))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't read request capture file");
+
+done:
+    return ret_value;
+} /* end RV_replay_load_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_replay_read_body
+ *
+ * Purpose:     Appends the recorded response body of a replayed request
+ *              to a response buffer, growing the buffer in the same way
+ *              as the cURL write callbacks do.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_replay_read_body(const RV_replay_entry_t *entry, struct response_buffer *resp_buffer)
+{
+    FILE  *body_file = RV_replay_file_g;
+    off_t  body_pos  = entry->body_pos;
+    size_t body_size = (size_t)entry->record.body_size;
+    herr_t ret_value = SUCCEED;
+
+    if (entry->record.flags & RV_CAPTURE_FLAG_BODY_IN_DATA_FILE) {
+        if (!RV_replay_data_file_g &&
+            NULL == (RV_replay_data_file_g = fopen(RV_capture_data_file_name_g, "rb")))
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTOPENFILE, FAIL, "can't open request capture data file '%s'",
+                            RV_capture_data_file_name_g);
+
+        body_file = RV_replay_data_file_g;
+        body_pos  = (off_t)entry->record.body_offset;
+    }
+
+    if (RV_response_buffer_reserve(resp_buffer, body_size) < 0)
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate space for response buffer");
+
+    if (fseeko(body_file, body_pos, SEEK_SET) < 0 ||
+        fread(resp_buffer->curr_buf_ptr, 1, body_size, body_file) != body_size)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't read recorded response");
+
+    resp_buffer->curr_buf_ptr += body_size;
+    *resp_buffer->curr_buf_ptr = '\0';
+
+done:
+    return ret_value;
+} /* end RV_replay_read_body() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_replay_serve
+ *
+ * Purpose:     Serves the recorded response to a request from the
+ *              capture being replayed, in place of sending the request.
+ *
+ *              If the request isn't concurrent, it was made with the
+ *              global cURL handle and is served the next recorded
+ *              request on that stream, which must have the same method
+ *              and URL, since the application has otherwise diverged
+ *              from the recorded run. The recorded latency is then
+ *              reproduced here, if requested. Otherwise, the request is
+ *              one of a round of concurrent transfers and is served the
+ *              earliest unused recording with the same method and URL,
+ *              and a message that it finished is queued for
+ *              RV_curl_multi_info_read(). The latency of a round is
+ *              that of its slowest transfer, and is reproduced by
+ *              RV_replay_end_round().
+ *
+ *              The response body is appended to resp_buffer, unless it
+ *              is NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_replay_serve(CURL *curl_handle, const char *method, const char *url, struct response_buffer *resp_buffer,
+                hbool_t concurrent)
+{
+    RV_replay_entry_t *entry        = NULL;
+    uint64_t           latency_usec = 0;
+    herr_t             ret_value    = SUCCEED;
+
+    if (!concurrent) {
+        while (RV_replay_next_single_g < RV_replay_num_entries_g &&
+               (RV_replay_entries_g[RV_replay_next_single_g].used ||
+                RV_replay_entries_g[RV_replay_next_single_g].record.stream != RV_CAPTURE_STREAM_SINGLE))
+            RV_replay_next_single_g++;
+
+        if (RV_replay_next_single_g == RV_replay_num_entries_g)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_NOTFOUND, FAIL, "no more recorded requests to replay for %s %s",
+                            method, url);
+
+        entry = &RV_replay_entries_g[RV_replay_next_single_g];
+
+        /* Captures made with a cURL too old to report the method only record the URL */
+        if ((entry->method[0] && strcmp(entry->method, method)) || strcmp(entry->url, url))
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_BADVALUE, FAIL,
+                            "request %s %s doesn't match recorded request %s %s", method, url,
+                            entry->method, entry->url);
+    }
+    else {
+        while (RV_replay_next_multi_g < RV_replay_num_entries_g &&
+               (RV_replay_entries_g[RV_replay_next_multi_g].used ||
+                RV_replay_entries_g[RV_replay_next_multi_g].record.stream != RV_CAPTURE_STREAM_MULTI))
+            RV_replay_next_multi_g++;
+
+        for (size_t i = RV_replay_next_multi_g; i < RV_replay_num_entries_g; i++) {
+            RV_replay_entry_t *candidate = &RV_replay_entries_g[i];
+
+            if (!candidate->used && candidate->record.stream == RV_CAPTURE_STREAM_MULTI &&
+                !strcmp(candidate->method, method) && !strcmp(candidate->url, url)) {
+                entry = candidate;
+                break;
+            }
+        }
+
+        if (!entry)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_NOTFOUND, FAIL, "no recorded response to replay for %s %s",
+                            method, url);
+    }
+
+    entry->used = TRUE;
+
+    if (resp_buffer && RV_replay_read_body(entry, resp_buffer) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_READERROR, FAIL, "can't replay response to %s", entry->url);
+
+    latency_usec = RV_replay_original_latency_g ? entry->record.latency_usec : 0;
+
+    /* Remember which request the handle was served, for its response code and metrics */
+    if (RV_served_record(curl_handle, entry->url, (long)entry->record.response_code, entry->record.bytes_sent,
+                         entry->record.body_size, latency_usec, concurrent) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't record replayed request");
+
+    if (!concurrent)
+        RV_replay_sleep(latency_usec);
+    else if (latency_usec > RV_replay_round_latency_g)
+        RV_replay_round_latency_g = latency_usec;
+
+done:
+    return ret_value;
+} /* end RV_replay_serve() */
+
+/* Helper to reproduce the latency of the round of concurrent replayed transfers which was just served */
+static void
+RV_replay_end_round(void)
+{
+    RV_replay_sleep(RV_replay_round_latency_g);
+    RV_replay_round_latency_g = 0;
+} /* end RV_replay_end_round() */
+
+/* Helper to wait for the given number of microseconds */
+static void
+RV_replay_sleep(uint64_t usec)
+{
+    struct timespec delay;
+
+    if (!usec)
+        return;
+
+    delay.tv_sec  = (time_t)(usec / 1000000);
+    delay.tv_nsec = (long)((usec % 1000000) * 1000);
+
+    nanosleep(&delay, NULL);
+} /* end RV_replay_sleep() */
+
+/* Counterpart of curl_multi_info_read() which returns the messages for transfers served in process */
+static CURLMsg *
+RV_curl_multi_info_read(CURLM *curl_multi_handle, int *num_msgs)
+{
+    if (!RV_serving_in_process())
+        return curl_multi_info_read(curl_multi_handle, num_msgs);
+
+    if (RV_next_served_msg_g == RV_num_served_msgs_g) {
+        *num_msgs = 0;
+        return NULL;
+    }
+
+    *num_msgs = (int)(RV_num_served_msgs_g - RV_next_served_msg_g - 1);
+
+    return &RV_served_msgs_g[RV_next_served_msg_g++];
+} /* end RV_curl_multi_info_read() */
+
+/* Helper to check whether requests are served in process, rather than sent to the server through cURL */
+static hbool_t
+RV_serving_in_process(void)
+{
+    return RV_replay_file_g != NULL || RV_transport_g->serve != NULL;
+} /* end RV_serving_in_process() */
+
+/* Helper to check whether chunks can be transferred directly, which only the local transport supports */
+hbool_t
+RV_transport_serves_chunks(void)
+{
+    return RV_replay_file_g == NULL && RV_transport_g->serves_chunks;
+} /* end RV_transport_serves_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_served_record
+ *
+ * Purpose:     Remembers the result of a request which was just served
+ *              in process on the given cURL handle, in place of the
+ *              information cURL would have about it. If the request is
+ *              one of a round of concurrent transfers, a message that
+ *              it finished is also queued for RV_curl_multi_info_read().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_served_record(CURL *curl_handle, const char *url, long response_code, uint64_t bytes_sent,
+                 uint64_t bytes_received, uint64_t latency_usec, hbool_t concurrent)
+{
+    RV_served_t *served    = NULL;
+    char        *url_copy  = NULL;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (url_copy = RV_malloc(strlen(url) + 1)))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't allocate space for served request URL");
+
+    strcpy(url_copy, url);
+
+    if (NULL == (served = RV_served_find(curl_handle))) {
+        if (RV_num_served_g == RV_served_nalloc_g) {
+            size_t       new_nalloc = RV_served_nalloc_g ? 2 * RV_served_nalloc_g : 16;
+            RV_served_t *tmp_realloc;
+
+            if (NULL == (tmp_realloc = RV_realloc(RV_served_g, new_nalloc * sizeof(*tmp_realloc))))
+                FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL,
+                                "can't allocate space for served request handles");
+
+            RV_served_g        = tmp_realloc;
+            RV_served_nalloc_g = new_nalloc;
+        }
+
+        served              = &RV_served_g[RV_num_served_g++];
+        served->curl_handle = curl_handle;
+        served->url         = NULL;
+    }
+
+    RV_free(served->url);
+
+    served->url            = url_copy;
+    served->response_code  = response_code;
+    served->bytes_sent     = bytes_sent;
+    served->bytes_received = bytes_received;
+    served->latency_usec   = latency_usec;
+    url_copy               = NULL;
+
+    if (!concurrent)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (RV_num_served_msgs_g == RV_served_msgs_nalloc_g) {
+        size_t   new_nalloc = RV_served_msgs_nalloc_g ? 2 * RV_served_msgs_nalloc_g : 16;
+        CURLMsg *tmp_realloc;
+
+        if (NULL == (tmp_realloc = RV_realloc(RV_served_msgs_g, new_nalloc * sizeof(*tmp_realloc))))
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL,
+                            "can't allocate space for served transfer messages");
+
+        RV_served_msgs_g        = tmp_realloc;
+        RV_served_msgs_nalloc_g = new_nalloc;
+    }
+
+    memset(&RV_served_msgs_g[RV_num_served_msgs_g], 0, sizeof(CURLMsg));
+    RV_served_msgs_g[RV_num_served_msgs_g].msg         = CURLMSG_DONE;
+    RV_served_msgs_g[RV_num_served_msgs_g].easy_handle = curl_handle;
+    RV_served_msgs_g[RV_num_served_msgs_g].data.result = CURLE_OK;
+    RV_num_served_msgs_g++;
+
+done:
+    RV_free(url_copy);
+
+    return ret_value;
+} /* end RV_served_record() */
+
+/* Helper to find the request which a cURL handle was last served, if requests are served in process */
+static RV_served_t *
+RV_served_find(CURL *curl_handle)
+{
+    if (!RV_serving_in_process())
+        return NULL;
+
+    for (size_t i = 0; i < RV_num_served_g; i++)
+        if (RV_served_g[i].curl_handle == curl_handle)
+            return &RV_served_g[i];
+
+    return NULL;
+} /* end RV_served_find() */
+
+/* Helper to start a new round of concurrent transfers served in process. The handles of
+ * earlier rounds have all been cleaned up by now, so only the global handle's served
+ * request is kept. */
+static void
+RV_served_begin_round(void)
+{
+    size_t num_kept = 0;
+
+    for (size_t i = 0; i < RV_num_served_g; i++) {
+        if (RV_served_g[i].curl_handle == curl)
+            RV_served_g[num_kept++] = RV_served_g[i];
+        else
+            RV_free(RV_served_g[i].url);
+    }
+
+    RV_num_served_g           = num_kept;
+    RV_num_served_msgs_g      = 0;
+    RV_next_served_msg_g      = 0;
+    RV_replay_round_latency_g = 0;
+} /* end RV_served_begin_round() */
+
+/* Helper to forget every request served in process */
+static void
+RV_served_free(void)
+{
+    for (size_t i = 0; i < RV_num_served_g; i++)
+        RV_free(RV_served_g[i].url);
+
+    RV_free(RV_served_g);
+    RV_free(RV_served_msgs_g);
+
+    RV_served_g             = NULL;
+    RV_num_served_g         = 0;
+    RV_served_nalloc_g      = 0;
+    RV_served_msgs_g        = NULL;
+    RV_num_served_msgs_g    = 0;
+    RV_next_served_msg_g    = 0;
+    RV_served_msgs_nalloc_g = 0;
+} /* end RV_served_free() */
+
+/* Helper to grow a response buffer, in the same way as the cURL write callbacks do,
+ * until it can hold another extra bytes plus a NUL terminator */
+static herr_t
+RV_response_buffer_reserve(struct response_buffer *resp_buffer, size_t extra)
+{
+    ptrdiff_t buf_used  = resp_buffer->curr_buf_ptr - resp_buffer->buffer;
+    herr_t    ret_value = SUCCEED;
+
+    while ((size_t)buf_used + extra + 1 > resp_buffer->buffer_size) {
+        char *tmp_realloc;
+
+        if (NULL == (tmp_realloc = (char *)RV_realloc(resp_buffer->buffer, 2 * resp_buffer->buffer_size)))
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate space for response buffer");
+
+        resp_buffer->curr_buf_ptr = tmp_realloc + buf_used;
+        resp_buffer->buffer       = tmp_realloc;
+        resp_buffer->buffer_size *= 2;
+    } /* end while */
+
+done:
+    return ret_value;
+} /* end RV_response_buffer_reserve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_transport_serve
+ *
+ * Purpose:     Serves a request in process through the transport, in
+ *              place of sending it on the given cURL handle, and
+ *              remembers its result for the handle. The response body
+ *              is appended to resp_buffer, unless it is NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_transport_serve(CURL *curl_handle, const RV_request_t *request, struct response_buffer *resp_buffer,
+                   hbool_t concurrent)
+{
+    uint64_t  start_usec    = RV_now_usec();
+    ptrdiff_t buf_used      = resp_buffer ? resp_buffer->curr_buf_ptr - resp_buffer->buffer : 0;
+    long      response_code = 0;
+    herr_t    ret_value     = SUCCEED;
+
+    if (!request)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "request can't be served by the %s transport",
+                        RV_transport_g->name);
+
+    if (RV_transport_g->serve(request, &response_code, resp_buffer) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "%s transport can't serve %s %s",
+                        RV_transport_g->name, request->method, request->url);
+
+    if (RV_served_record(curl_handle, request->url, response_code, (uint64_t)request->body_size,
+                         resp_buffer ? (uint64_t)(resp_buffer->curr_buf_ptr - resp_buffer->buffer - buf_used)
+                                     : 0,
+                         RV_now_usec() - start_usec, concurrent) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't record served request");
+
+done:
+    return ret_value;
+} /* end RV_transport_serve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_local_transport_init
+ *
+ * Purpose:     Opens the store that the local transport serves requests
+ *              from. The store is kept in the directory following the
+ *              LOCAL_STORE_PREFIX of the endpoint, or in memory only if
+ *              the endpoint names no directory.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_local_transport_init(const char *endpoint)
+{
+    const char *store_dir = endpoint + strlen(LOCAL_STORE_PREFIX);
+    herr_t      ret_value = SUCCEED;
+
+    if (NULL == (RV_local_endpoint_g = RV_malloc(strlen(endpoint) + 1)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate space for local endpoint");
+
+    strcpy(RV_local_endpoint_g, endpoint);
+
+    if (RV_local_store_open(strlen(store_dir) ? store_dir : NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open local store '%s'", store_dir);
+
+    RV_LOG_INFO(RV_LOG_CAT_CONNECTOR, "Serving requests in process from %s%s",
+                strlen(store_dir) ? "local store " : "an in-memory local store", store_dir);
+
+done:
+    if (ret_value < 0) {
+        RV_free(RV_local_endpoint_g);
+        RV_local_endpoint_g = NULL;
+    }
+
+    return ret_value;
+} /* end RV_local_transport_init() */
+
+/* Helper to close the local transport's store, saving its domains if it has a directory */
+static herr_t
+RV_local_transport_term(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    if (RV_local_store_close() < 0)
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't save local store");
+
+    RV_free(RV_local_endpoint_g);
+    RV_local_endpoint_g = NULL;
+
+    return ret_value;
+} /* end RV_local_transport_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_local_transport_serve
+ *
+ * Purpose:     Serves a request from the local transport's store. The
+ *              endpoint is stripped from the request URL, leaving the
+ *              path and query that a server would see. JSON request
+ *              bodies are copied so that they can be NUL-terminated for
+ *              the store; binary bodies are passed through untouched.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_local_transport_serve(const RV_request_t *request, long *response_code,
+                         struct response_buffer *resp_buffer)
+{
+    RV_local_request_t  local_request  = {0};
+    RV_local_response_t local_response = {0};
+    size_t              endpoint_len   = strlen(RV_local_endpoint_g);
+    char               *target         = NULL;
+    char               *body_copy      = NULL;
+    herr_t              ret_value      = SUCCEED;
+
+    if (strncmp(request->url, RV_local_endpoint_g, endpoint_len))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_BADVALUE, FAIL, "request URL '%s' is not under the local endpoint",
+                        request->url);
+
+    /* The store splits and decodes the target in place */
+    if (NULL == (target = RV_malloc(strlen(request->url + endpoint_len) + 1)))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't allocate space for request target");
+
+    strcpy(target, request->url + endpoint_len);
+
+    local_request.method       = request->method;
+    local_request.target       = target;
+    local_request.domain       = request->domain;
+    local_request.content_type = request->content_type;
+    local_request.body         = request->body ? (const char *)request->body : "";
+    local_request.body_len     = request->body ? request->body_size : 0;
+
+    if (local_request.body_len &&
+        (!request->content_type || !strcmp(request->content_type, "application/json"))) {
+        if (NULL == (body_copy = RV_malloc(local_request.body_len + 1)))
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTALLOC, FAIL, "can't allocate space for request body");
+
+        memcpy(body_copy, request->body, local_request.body_len);
+        body_copy[local_request.body_len] = '\0';
+        local_request.body                = body_copy;
+    }
+
+    if (RV_local_store_handle_request(&local_request, &local_response) < 0)
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "local store ran out of memory serving %s %s",
+                        request->method, request->url);
+
+    *response_code = (long)local_response.status;
+
+    /* Hand each header line, with its line ending, to the request's header callback */
+    if (request->header_cb && local_response.headers.size) {
+        char *line = local_response.headers.data;
+        char *end  = local_response.headers.data + local_response.headers.size;
+
+        while (line < end) {
+            char  *next     = strstr(line, "\r\n");
+            size_t line_len = next ? (size_t)(next - line) + 2 : (size_t)(end - line);
+
+            if (request->header_cb(line, 1, line_len, request->header_data) != line_len)
+                FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "header callback failed");
+
+            line += line_len;
+        }
+    }
+
+    if (resp_buffer && local_response.body.size) {
+        if (RV_response_buffer_reserve(resp_buffer, local_response.body.size) < 0)
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate space for response buffer");
+
+        memcpy(resp_buffer->curr_buf_ptr, local_response.body.data, local_response.body.size);
+        resp_buffer->curr_buf_ptr += local_response.body.size;
+        *resp_buffer->curr_buf_ptr = '\0';
+    }
+
+done:
+    RV_local_buffer_free(&local_response.headers);
+    RV_local_buffer_free(&local_response.body);
+    RV_free(body_copy);
+    RV_free(target);
+
+    return ret_value;
+} /* end RV_local_transport_serve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_curl_easy_perform
+ *
+ * Purpose:     Performs the request set up on a cURL handle, whose
+ *              response body is written to the given response buffer.
+ *              The request and its response are recorded to the capture
+ *              file if capturing, and the request is served from the
+ *              capture instead of being sent if replaying.
+ *
+ *              If the transport serves requests in process or requests
+ *              are replayed, the request is served from its description
+ *              in request instead, which must then not be NULL.
+ *
+ * Return:      The cURL result code of the request
+ */
+CURLcode
+RV_curl_easy_perform(CURL *curl_handle, const RV_request_t *request, struct response_buffer *resp_buffer)
+{
+    CURLcode ret_value = CURLE_OK;
+
+    if (RV_transport_g->serve) {
+        if (RV_transport_serve(curl_handle, request, resp_buffer, FALSE) < 0)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, CURLE_READ_ERROR, "can't serve request");
+
+        FUNC_GOTO_DONE(CURLE_OK);
+    }
+
+    if (RV_replay_file_g) {
+        if (!request)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_BADVALUE, CURLE_READ_ERROR,
+                            "can't replay request without its description");
+
+        if (RV_replay_serve(curl_handle, request->method, request->url, resp_buffer, FALSE) < 0)
+            FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, CURLE_READ_ERROR, "can't replay request");
+
+        FUNC_GOTO_DONE(CURLE_OK);
+    }
+
+    ret_value = curl_easy_perform(curl_handle);
+
+    if (CURLE_OK == ret_value &&
+        RV_capture_request(curl_handle, request ? request->method : NULL, request ? request->url : NULL,
+                           RV_CAPTURE_STREAM_SINGLE, resp_buffer) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_WRITEERROR, CURLE_WRITE_ERROR, "can't record request to capture");
+
+done:
+    return ret_value;
+} /* end RV_curl_easy_perform() */
+
+/* Helper to get the HTTP response code of the last request on a cURL handle, even if served in process */
+herr_t
+RV_curl_get_response_code(CURL *curl_handle, long *response_code)
+{
+    RV_served_t *served    = NULL;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL != (served = RV_served_find(curl_handle)))
+        *response_code = served->response_code;
+    else if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, response_code))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get HTTP response code");
+
+done:
+    return ret_value;
+} /* end RV_curl_get_response_code() */
+
+/* Helper to find the latency histogram bucket that counts the given latency */
+static size_t
+RV_stats_latency_bucket(uint64_t latency_usec)
+{
+    size_t exponent = 0;
+    size_t bucket;
+
+    if (latency_usec < H5REST_LATENCY_SUB_BUCKETS)
+        return (size_t)latency_usec;
+
+    /* Find the highest set bit; the next three bits pick the sub-bucket */
+    for (uint64_t v = latency_usec; v > 1; v >>= 1)
+        exponent++;
+
+    bucket = (exponent - 2) * H5REST_LATENCY_SUB_BUCKETS +
+             (size_t)((latency_usec >> (exponent - 3)) & (H5REST_LATENCY_SUB_BUCKETS - 1));
+
+    return (bucket < H5REST_LATENCY_NUM_BUCKETS) ? bucket : H5REST_LATENCY_NUM_BUCKETS - 1;
+} /* end RV_stats_latency_bucket() */
+
+/* Helper to find the largest latency counted by the given latency histogram bucket */
+static uint64_t
+RV_stats_bucket_max_latency(size_t bucket)
+{
+    size_t   exponent;
+    uint64_t sub_bucket;
+
+    if (bucket < H5REST_LATENCY_SUB_BUCKETS)
+        return (uint64_t)bucket;
+
+    exponent   = bucket / H5REST_LATENCY_SUB_BUCKETS + 2;
+    sub_bucket = bucket % H5REST_LATENCY_SUB_BUCKETS;
+
+    return ((H5REST_LATENCY_SUB_BUCKETS + sub_bucket + 1) << (exponent - 3)) - 1;
+} /* end RV_stats_bucket_max_latency() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_stats_record_request
+ *
+ * Purpose:     Counts a request which has just completed on the given
+ *              cURL handle in the request metrics for its type of
+ *              request, along with the bytes it transferred, the class of
+ *              its HTTP response and its latency, as reported by cURL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_stats_record_request(CURL *curl_handle, H5rest_op_type_t op_type)
+{
+    H5rest_op_stats_t *op_stats      = NULL;
+    RV_served_t       *served        = NULL;
+    long               response_code = 0;
+    curl_off_t         bytes_up      = 0;
+    curl_off_t         bytes_down    = 0;
+    curl_off_t         total_time    = 0;
+    herr_t             ret_value     = SUCCEED;
+
+    if ((unsigned)op_type >= H5REST_NUM_OP_TYPES)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid request type");
+
+    /* Requests served in process are counted with the result and latency they were served with */
+    if (NULL != (served = RV_served_find(curl_handle))) {
+        response_code = served->response_code;
+        bytes_up      = (curl_off_t)served->bytes_sent;
+        bytes_down    = (curl_off_t)served->bytes_received;
+        total_time    = (curl_off_t)served->latency_usec;
+    }
+    else if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &response_code) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_SIZE_UPLOAD_T, &bytes_up) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_SIZE_DOWNLOAD_T, &bytes_down) ||
+             CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_TOTAL_TIME_T, &total_time))
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get request information for metrics");
+
+    op_stats = &RV_stats_g.op[op_type];
+
+    op_stats->requests++;
+    op_stats->bytes_sent += (uint64_t)bytes_up;
+    op_stats->bytes_received += (uint64_t)bytes_down;
+
+    if (response_code >= 200 && response_code < 300)
+        op_stats->responses_2xx++;
+    else if (response_code >= 400 && response_code < 500)
+        op_stats->responses_4xx++;
+    else if (response_code >= 500 && response_code < 600)
+        op_stats->responses_5xx++;
+
+    op_stats->latency_total_usec += (uint64_t)total_time;
+    if ((uint64_t)total_time > op_stats->latency_max_usec)
+        op_stats->latency_max_usec = (uint64_t)total_time;
+    op_stats->latency_histogram[RV_stats_latency_bucket((uint64_t)total_time)]++;
+
+done:
+    return ret_value;
+} /* end RV_stats_record_request() */
+
+/* Count a request which is to be retried after backing off for the given time */
+void
+RV_stats_record_retry(H5rest_op_type_t op_type, uint64_t backoff_usec)
+{
+    if ((unsigned)op_type >= H5REST_NUM_OP_TYPES)
+        return;
+
+    RV_stats_g.op[op_type].retries++;
+    RV_stats_g.op[op_type].backoff_usec += backoff_usec;
+} /* end RV_stats_record_retry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_get_stats
+ *
+ * Purpose:     Copies the connector's request metrics, counted since the
+ *              connector was initialized or the metrics were last reset,
+ *              into the given structure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_get_stats(H5rest_stats_t *stats)
+{
+    herr_t ret_value = SUCCEED;
+
+    if (!stats)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output pointer was NULL");
+
+    memcpy(stats, &RV_stats_g, sizeof(*stats));
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_get_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_reset_stats
+ *
+ * Purpose:     Sets all of the connector's request metrics back to zero.
+ *
+ * Return:      SUCCEED (can't fail)
+ */
+herr_t
+H5rest_reset_stats(void)
+{
+    memset(&RV_stats_g, 0, sizeof(RV_stats_g));
+
+    return SUCCEED;
+} /* end H5rest_reset_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_get_latency_percentile
+ *
+ * Purpose:     Estimates the given percentile (between 0 and 100) of the
+ *              latencies counted in a latency histogram, as the largest
+ *              latency counted by the bucket the percentile falls in, or
+ *              the largest latency seen if that is smaller.
+ *
+ * Return:      The estimated latency in microseconds, or 0 if no
+ *              latencies were counted
+ */
+uint64_t
+H5rest_get_latency_percentile(const H5rest_op_stats_t *op_stats, double percentile)
+{
+    uint64_t total_count = 0;
+    uint64_t rank        = 0;
+    uint64_t seen        = 0;
+
+    if (!op_stats)
+        return 0;
+
+    for (size_t i = 0; i < H5REST_LATENCY_NUM_BUCKETS; i++)
+        total_count += op_stats->latency_histogram[i];
+
+    if (total_count == 0)
+        return 0;
+
+    if (percentile < 0.0)
+        percentile = 0.0;
+    if (percentile > 100.0)
+        percentile = 100.0;
+
+    /* Rank of the percentile's latency among all counted latencies, starting from 1 */
+    rank = (uint64_t)((percentile / 100.0) * (double)total_count + 0.5);
+    if (rank < 1)
+        rank = 1;
+
+    for (size_t i = 0; i < H5REST_LATENCY_NUM_BUCKETS; i++) {
+        seen += op_stats->latency_histogram[i];
+
+        if (seen >= rank) {
+            uint64_t bucket_max = RV_stats_bucket_max_latency(i);
+
+            return (bucket_max < op_stats->latency_max_usec) ? bucket_max : op_stats->latency_max_usec;
+        }
+    }
+
+    return op_stats->latency_max_usec;
+} /* end H5rest_get_latency_percentile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_stats_dump
+ *
+ * Purpose:     Writes the request metrics as a JSON object, keyed by type
+ *              of request, to the file named by the HSDS_STATS_FILE
+ *              environment variable, if it is set. Latencies are in
+ *              microseconds.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+H5_rest_stats_dump(void)
+{
+    const char *op_names[H5REST_NUM_OP_TYPES] = {"GET",    "PUT",          "POST",
+                                                 "DELETE", "dataset read", "dataset write"};
+    const char *stats_file_name               = NULL;
+    FILE       *stats_file                    = NULL;
+    herr_t      ret_value                     = SUCCEED;
+
+    if (NULL == (stats_file_name = getenv(STATS_FILE_ENV_VAR)) || !strlen(stats_file_name))
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (!strcmp(stats_file_name, "-"))
+        stats_file = stderr;
+    else if (NULL == (stats_file = fopen(stats_file_name, "w")))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open request metrics file '%s'",
+                        stats_file_name);
+
+    fputs("{\n", stats_file);
+
+    for (size_t i = 0; i < H5REST_NUM_OP_TYPES; i++) {
+        const H5rest_op_stats_t *op_stats = &RV_stats_g.op[i];
+
+        fprintf(stats_file,
+                "  \"%s\": {\"requests\": %llu, \"bytes_sent\": %llu, \"bytes_received\": %llu, "
+                "\"2xx\": %llu, \"4xx\": %llu, \"5xx\": %llu, \"retries\": %llu, \"backoff\": %llu, "
+                "\"mean\": %llu, \"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"max\": %llu}%s\n",
+                op_names[i], (unsigned long long)op_stats->requests,
+                (unsigned long long)op_stats->bytes_sent, (unsigned long long)op_stats->bytes_received,
+                (unsigned long long)op_stats->responses_2xx, (unsigned long long)op_stats->responses_4xx,
+                (unsigned long long)op_stats->responses_5xx, (unsigned long long)op_stats->retries,
+                (unsigned long long)op_stats->backoff_usec,
+                (unsigned long long)(op_stats->requests ? op_stats->latency_total_usec / op_stats->requests
+                                                        : 0),
+                (unsigned long long)H5rest_get_latency_percentile(op_stats, 50.0),
+                (unsigned long long)H5rest_get_latency_percentile(op_stats, 90.0),
+                (unsigned long long)H5rest_get_latency_percentile(op_stats, 99.0),
+                (unsigned long long)op_stats->latency_max_usec, (i + 1 < H5REST_NUM_OP_TYPES) ? "," : "");
+    }
+
+    fputs("}\n", stats_file);
+
+    if (stats_file != stderr && fclose(stats_file) != 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close request metrics file");
+
+done:
+    return ret_value;
+} /* end H5_rest_stats_dump() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_rest_vol
+ *
+ * Purpose:     Modify the file access property list to use the REST VOL
+ *              connector
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              March, 2017
+ */
+herr_t
+H5Pset_fapl_rest_vol(hid_t fapl_id)
+{
+    htri_t is_fapl;
+    herr_t ret_value = SUCCEED;
+
+    if (H5_rest_id_g < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_UNINITIALIZED, FAIL, "REST VOL connector not initialized");
+
+    if (H5P_DEFAULT == fapl_id)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL,
+                        "can't set REST VOL connector for default property list");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if ((ret_value = H5Pset_vol(fapl_id, H5_rest_id_g, NULL)) < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set REST VOL connector in FAPL");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pset_fapl_rest_vol() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_rest_deferred_create
+ *
+ * Purpose:     Sets whether files opened or created with the given file
+ *              access property list defer object creation.
+ *
+ *              When deferred creation is enabled, creating a group,
+ *              dataset or committed datatype assigns the new object an
+ *              ID on the client and queues the request to create it,
+ *              rather than waiting for the server to respond. Queued
+ *              requests are sent to the server in concurrent batches
+ *              when the queue fills, when the file is flushed or closed
+ *              and before any other request is made to the server, so
+ *              that later operations always see the new objects.
+ *
+ *              Since requests are sent later, an error creating an
+ *              object is reported by the operation which sends it,
+ *              rather than by the create call itself. Requests which
+ *              weren't sent, or which failed for reasons other than
+ *              being rejected by the server, stay queued and are sent
+ *              again by the next operation. This mode also requires a
+ *              server which accepts client-assigned object IDs.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pset_fapl_rest_deferred_create(hid_t fapl_id, hbool_t deferred_create)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (H5P_DEFAULT == fapl_id)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set deferred creation for default FAPL");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if ((prop_exists = H5Pexist(fapl_id, DEFERRED_CREATE_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for deferred creation property");
+
+    if (prop_exists) {
+        if (H5Pset(fapl_id, DEFERRED_CREATE_PROP_NAME, &deferred_create) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set deferred creation property");
+    }
+    else if (H5Pinsert2(fapl_id, DEFERRED_CREATE_PROP_NAME, sizeof(hbool_t), &deferred_create, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert deferred creation property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pset_fapl_rest_deferred_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_rest_deferred_create
+ *
+ * Purpose:     Retrieves whether files opened or created with the given
+ *              file access property list defer object creation. This is
+ *              FALSE unless set with H5Pset_fapl_rest_deferred_create().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pget_fapl_rest_deferred_create(hid_t fapl_id, hbool_t *deferred_create)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (!deferred_create)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output pointer was NULL");
+
+    *deferred_create = FALSE;
+
+    if (H5P_DEFAULT == fapl_id || H5P_FILE_ACCESS_DEFAULT == fapl_id)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if ((prop_exists = H5Pexist(fapl_id, DEFERRED_CREATE_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for deferred creation property");
+
+    if (prop_exists && H5Pget(fapl_id, DEFERRED_CREATE_PROP_NAME, deferred_create) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get deferred creation property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pget_fapl_rest_deferred_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_rest_storage_size_max_age
+ *
+ * Purpose:     Sets how old, in seconds, the storage sizes returned by
+ *              H5Dget_storage_size() and H5rest_get_storage_sizes() may
+ *              be for files opened or created with the given file access
+ *              property list.
+ *
+ *              The server only updates the sizes of datasets when their
+ *              domain is flushed and rescanned, which is costly for large
+ *              domains. By default every storage size query rescans the
+ *              domain first. With a maximum age set, a query made within
+ *              that many seconds of the last rescan of the domain by the
+ *              connector, including one made by H5Fflush(), returns the
+ *              sizes found by that rescan instead. These don't count data
+ *              written since.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pset_fapl_rest_storage_size_max_age(hid_t fapl_id, double max_age)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (H5P_DEFAULT == fapl_id)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set storage size maximum age for default FAPL");
+
+    if (max_age < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "storage size maximum age can't be negative");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if ((prop_exists = H5Pexist(fapl_id, STORAGE_SIZE_MAX_AGE_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for storage size maximum age property");
+
+    if (prop_exists) {
+        if (H5Pset(fapl_id, STORAGE_SIZE_MAX_AGE_PROP_NAME, &max_age) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set storage size maximum age property");
+    }
+    else if (H5Pinsert2(fapl_id, STORAGE_SIZE_MAX_AGE_PROP_NAME, sizeof(double), &max_age, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert storage size maximum age property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pset_fapl_rest_storage_size_max_age() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_rest_storage_size_max_age
+ *
+ * Purpose:     Retrieves how old, in seconds, the storage sizes of
+ *              datasets in files opened or created with the given file
+ *              access property list may be. This is 0, meaning that
+ *              every query rescans the domain, unless set with
+ *              H5Pset_fapl_rest_storage_size_max_age().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pget_fapl_rest_storage_size_max_age(hid_t fapl_id, double *max_age)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (!max_age)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output pointer was NULL");
+
+    *max_age = 0;
+
+    if (H5P_DEFAULT == fapl_id || H5P_FILE_ACCESS_DEFAULT == fapl_id)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if ((prop_exists = H5Pexist(fapl_id, STORAGE_SIZE_MAX_AGE_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for storage size maximum age property");
+
+    if (prop_exists && H5Pget(fapl_id, STORAGE_SIZE_MAX_AGE_PROP_NAME, max_age) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get storage size maximum age property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pget_fapl_rest_storage_size_max_age() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_dapl_rest_write_buffer
+ *
+ * Purpose:     Sets the size of the write-back buffer of datasets opened
+ *              or created with the given dataset access property list. A
+ *              size of 0, the default, disables write-back buffering.
+ *
+ *              When write-back buffering is enabled, small writes to the
+ *              dataset are held back and merged with later writes which
+ *              overlap or adjoin them, so that writing a dataset a row at
+ *              a time sends one larger request rather than one per row.
+ *              Only writes of a single block of the dataset's dataspace,
+ *              in the dataset's own datatype and no larger than the
+ *              buffer, are held back. The buffered writes are sent to the
+ *              server when they fill the buffer, when a write or read
+ *              which can't be merged with them is made, and when the
+ *              dataset or its file is flushed or the dataset is closed.
+ *
+ *              Since writes are sent later, an error writing to the
+ *              dataset may be reported by the operation which sends them,
+ *              rather than by the write itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pset_dapl_rest_write_buffer(hid_t dapl_id, size_t buffer_size)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (H5P_DEFAULT == dapl_id)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set write-back buffer size for default DAPL");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    if ((prop_exists = H5Pexist(dapl_id, WRITE_BUFFER_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for write-back buffer property");
+
+    if (prop_exists) {
+        if (H5Pset(dapl_id, WRITE_BUFFER_PROP_NAME, &buffer_size) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set write-back buffer property");
+    }
+    else if (H5Pinsert2(dapl_id, WRITE_BUFFER_PROP_NAME, sizeof(size_t), &buffer_size, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert write-back buffer property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pset_dapl_rest_write_buffer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_dapl_rest_write_buffer
+ *
+ * Purpose:     Retrieves the size of the write-back buffer of datasets
+ *              opened or created with the given dataset access property
+ *              list. This is 0 unless set with
+ *              H5Pset_dapl_rest_write_buffer().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pget_dapl_rest_write_buffer(hid_t dapl_id, size_t *buffer_size)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (!buffer_size)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output pointer was NULL");
+
+    *buffer_size = 0;
+
+    if (H5P_DEFAULT == dapl_id || H5P_DATASET_ACCESS_DEFAULT == dapl_id)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if ((prop_exists = H5Pexist(dapl_id, WRITE_BUFFER_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for write-back buffer property");
+
+    if (prop_exists && H5Pget(dapl_id, WRITE_BUFFER_PROP_NAME, buffer_size) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get write-back buffer property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pget_dapl_rest_write_buffer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_dapl_rest_read_ahead
+ *
+ * Purpose:     Sets how far ahead of a sequential scan datasets opened or
+ *              created with the given dataset access property list read.
+ *              A depth or size of 0, the default, disables read-ahead.
+ *
+ *              When read-ahead is enabled, a dataset handle watches for
+ *              reads which each move a block of the dataset's dataspace
+ *              of the same shape, advancing by the same distance along
+ *              one dimension, as when a dataset is read a slab of rows
+ *              at a time. Once such a scan is detected, the read of one
+ *              block also reads up to depth blocks after it, as long as
+ *              they fit in max_size bytes, and later reads of those
+ *              blocks through the handle are served from memory. Only
+ *              reads in the dataset's own datatype are read ahead.
+ *
+ *              Blocks read ahead are dropped when the dataset is written
+ *              to through any of its handles, when its extent is changed
+ *              and when it is refreshed. Changes made to the dataset by
+ *              other clients may not be seen by reads served from them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pset_dapl_rest_read_ahead(hid_t dapl_id, unsigned depth, size_t max_size)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (H5P_DEFAULT == dapl_id)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set read-ahead for default DAPL");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    if ((prop_exists = H5Pexist(dapl_id, READ_AHEAD_DEPTH_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for read-ahead depth property");
+
+    if (prop_exists) {
+        if (H5Pset(dapl_id, READ_AHEAD_DEPTH_PROP_NAME, &depth) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set read-ahead depth property");
+    }
+    else if (H5Pinsert2(dapl_id, READ_AHEAD_DEPTH_PROP_NAME, sizeof(unsigned), &depth, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert read-ahead depth property");
+
+    if ((prop_exists = H5Pexist(dapl_id, READ_AHEAD_SIZE_PROP_NAME)) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for read-ahead size property");
+
+    if (prop_exists) {
+        if (H5Pset(dapl_id, READ_AHEAD_SIZE_PROP_NAME, &max_size) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set read-ahead size property");
+    }
+    else if (H5Pinsert2(dapl_id, READ_AHEAD_SIZE_PROP_NAME, sizeof(size_t), &max_size, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert read-ahead size property");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pset_dapl_rest_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_dapl_rest_read_ahead
+ *
+ * Purpose:     Retrieves how far ahead of a sequential scan datasets
+ *              opened or created with the given dataset access property
+ *              list read, as set with H5Pset_dapl_rest_read_ahead().
+ *              Either output pointer may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5Pget_dapl_rest_read_ahead(hid_t dapl_id, unsigned *depth, size_t *max_size)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    if (depth)
+        *depth = 0;
+    if (max_size)
+        *max_size = 0;
+
+    if (H5P_DEFAULT == dapl_id || H5P_DATASET_ACCESS_DEFAULT == dapl_id)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (depth) {
+        if ((prop_exists = H5Pexist(dapl_id, READ_AHEAD_DEPTH_PROP_NAME)) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for read-ahead depth property");
+
+        if (prop_exists && H5Pget(dapl_id, READ_AHEAD_DEPTH_PROP_NAME, depth) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get read-ahead depth property");
+    }
+
+    if (max_size) {
+        if ((prop_exists = H5Pexist(dapl_id, READ_AHEAD_SIZE_PROP_NAME)) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for read-ahead size property");
+
+        if (prop_exists && H5Pget(dapl_id, READ_AHEAD_SIZE_PROP_NAME, max_size) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get read-ahead size property");
+    }
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5Pget_dapl_rest_read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_append
+ *
+ * Purpose:     Grows a chunked dataset by the given number of elements
+ *              along one of its dimensions and writes the data for the
+ *              new elements, in the same way as H5DOappend(). The buffer
+ *              holds the new elements in row-major order.
+ *
+ *              Each append otherwise takes two requests to the server,
+ *              one to change the dataset's extent and one to write the
+ *              data. If the dataset was opened with a write-back buffer
+ *              (see H5Pset_dapl_rest_write_buffer()), appends which fit
+ *              in the buffer are held back and merged, and the server's
+ *              extent is only changed when they are sent. The dataset's
+ *              dataspace, as returned by H5Dget_space(), includes the
+ *              appended elements immediately.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_append(hid_t dset_id, hid_t dxpl_id, unsigned axis, size_t extension, hid_t mem_type_id,
+                      const void *buf)
+{
+    RV_object_t *dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    if (RV_dataset_append(dset, dxpl_id, axis, extension, mem_type_id, buf) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't append to dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_append() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_read_batch
+ *
+ * Purpose:     Reads several selections of a dataset, each into its own
+ *              buffer according to its memory dataspace, as a series of
+ *              H5Dread() calls with the same memory datatype would.
+ *
+ *              Rather than making a request to the server for each
+ *              selection, nearby hyperslab selections are merged into a
+ *              read of their bounding box whenever the extra data read
+ *              costs less than the extra request would have, and each
+ *              selection is then copied out of the data read. The
+ *              remaining requests are made concurrently. Selections are
+ *              only merged if the memory datatype has no variable-length
+ *              or reference data.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_read_batch(hid_t dset_id, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                          const hid_t file_space_ids[], hid_t dxpl_id, void *bufs[])
+{
+    RV_object_t *dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    if (RV_dataset_read_batch(dset, count, mem_type_id, mem_space_ids, file_space_ids, dxpl_id, bufs) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read batch of selections from dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_read_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_read_selections
+ *
+ * Purpose:     Reads several selections of a dataset, each into its own
+ *              buffer according to its memory dataspace, as a series of
+ *              H5Dread() calls with the same memory datatype would, but
+ *              making the requests for all of them to the server
+ *              concurrently and returning once they have all completed.
+ *
+ *              Unlike H5rest_dataset_read_batch(), each selection is read
+ *              with a request of its own. This is the same as calling
+ *              H5Dread_multi() with the dataset's ID repeated for each
+ *              selection, which is also how to read the selections
+ *              asynchronously, with H5Dread_multi_async(). The connector
+ *              completes asynchronous operations before returning.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_read_selections(hid_t dset_id, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                               const hid_t file_space_ids[], hid_t dxpl_id, void *bufs[])
+{
+    RV_object_t *dset;
+    void       **dsets           = NULL;
+    hid_t       *mem_type_ids    = NULL;
+    hid_t       *_mem_space_ids  = NULL;
+    hid_t       *_file_space_ids = NULL;
+    herr_t       ret_value       = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (!count)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (!mem_space_ids || !file_space_ids || !bufs)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace ID or buffer array was NULL");
+
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    if (RV_dataset_setup_selections(dset, count, mem_type_id, mem_space_ids, file_space_ids, &dsets,
+                                    &mem_type_ids, &_mem_space_ids, &_file_space_ids) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up reads of dataset selections");
+
+    if (RV_dataset_read(count, dsets, mem_type_ids, _mem_space_ids, _file_space_ids, dxpl_id, bufs, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read selections of dataset");
+
+done:
+    RV_free(dsets);
+    RV_free(mem_type_ids);
+    RV_free(_mem_space_ids);
+    RV_free(_file_space_ids);
+
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_read_selections() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_write_selections
+ *
+ * Purpose:     Writes several selections of a dataset, each from its own
+ *              buffer according to its memory dataspace, as a series of
+ *              H5Dwrite() calls with the same memory datatype would, but
+ *              making the requests for all of them to the server
+ *              concurrently and returning once they have all completed.
+ *
+ *              This is the same as calling H5Dwrite_multi() with the
+ *              dataset's ID repeated for each selection, which is also
+ *              how to write the selections asynchronously, with
+ *              H5Dwrite_multi_async(). If the dataset has a write-back
+ *              buffer which can hold all of the writes, they are buffered
+ *              as H5Dwrite() would buffer them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_write_selections(hid_t dset_id, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                                const hid_t file_space_ids[], hid_t dxpl_id, const void *bufs[])
+{
+    RV_object_t *dset;
+    void       **dsets           = NULL;
+    hid_t       *mem_type_ids    = NULL;
+    hid_t       *_mem_space_ids  = NULL;
+    hid_t       *_file_space_ids = NULL;
+    herr_t       ret_value       = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (!count)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (!mem_space_ids || !file_space_ids || !bufs)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace ID or buffer array was NULL");
+
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    if (RV_dataset_setup_selections(dset, count, mem_type_id, mem_space_ids, file_space_ids, &dsets,
+                                    &mem_type_ids, &_mem_space_ids, &_file_space_ids) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up writes of dataset selections");
+
+    if (RV_dataset_write(count, dsets, mem_type_ids, _mem_space_ids, _file_space_ids, dxpl_id, bufs, NULL) <
+        0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write selections of dataset");
+
+done:
+    RV_free(dsets);
+    RV_free(mem_type_ids);
+    RV_free(_mem_space_ids);
+    RV_free(_file_space_ids);
+
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_write_selections() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_read_chunks
+ *
+ * Purpose:     Reads chunks of a chunked dataset as the bytes they are
+ *              stored as, as a series of H5Dread_chunk() calls would, but
+ *              making the requests for all of them to the server
+ *              concurrently. Each chunk is given by the offset of its
+ *              first element, and is read into its own buffer along with
+ *              its filter mask.
+ *
+ *              If buf_sizes is not NULL, each of its entries gives the
+ *              size of a buffer, and is set to the size of the chunk
+ *              read into it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_read_chunks(hid_t dset_id, size_t count, const hsize_t *offsets[], uint32_t filter_masks[],
+                           size_t buf_sizes[], void *bufs[])
+{
+    RV_object_t *dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (count && (!offsets || !filter_masks || !bufs))
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset, filter mask or buffer array was NULL");
+
+    if (RV_dataset_read_chunks(dset, count, offsets, filter_masks, buf_sizes, bufs) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunks from dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_read_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_write_chunks
+ *
+ * Purpose:     Writes chunks of a chunked dataset as the bytes they are
+ *              stored as, as a series of H5Dwrite_chunk() calls would,
+ *              but making the requests for all of them to the server
+ *              concurrently. Each chunk is given by the offset of its
+ *              first element, and is sent with its filter mask and size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_write_chunks(hid_t dset_id, size_t count, const hsize_t *offsets[],
+                            const uint32_t filter_masks[], const size_t sizes[], const void *bufs[])
+{
+    RV_object_t *dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (count && (!offsets || !filter_masks || !sizes || !bufs))
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset, filter mask, size or buffer array was NULL");
+
+    if (RV_dataset_write_chunks(dset, count, offsets, filter_masks, sizes, bufs) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunks to dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_write_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_dataset_query
+ *
+ * Purpose:     Reads the rows of a one-dimensional compound dataset which
+ *              match a query, such as "temp > 20.0 & pressure < 1000",
+ *              with the query evaluated by the server so that only the
+ *              matching rows are transferred. At most max_rows rows are
+ *              returned, starting the search at row start; to read the
+ *              next page of matches, call again with start set to one
+ *              past the last index returned.
+ *
+ *              The number of matching rows is returned in num_rows, their
+ *              indices in the dataset in indices, and the rows themselves
+ *              in buf, packed and converted to the compound datatype
+ *              mem_type_id. Either of indices or buf may be NULL if it
+ *              isn't wanted.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_dataset_query(hid_t dset_id, const char *query, hsize_t start, size_t max_rows, hid_t mem_type_id,
+                     size_t *num_rows, hsize_t indices[], void *buf)
+{
+    RV_object_t *dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (NULL == (dset = (RV_object_t *)H5VLobject(dset_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (RV_dataset_query(dset, query, start, max_rows, mem_type_id, num_rows, indices, buf) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't query dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5rest_dataset_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_setup_selections
+ *
+ * Purpose:     Sets up the arrays to pass to RV_dataset_read() or
+ *              RV_dataset_write() to transfer several selections of a
+ *              single dataset at once, with the dataset and memory
+ *              datatype repeated for each selection. The arrays must be
+ *              freed by the caller, even on failure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_dataset_setup_selections(RV_object_t *dset, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                            const hid_t file_space_ids[], void ***dsets_out, hid_t **mem_type_ids_out,
+                            hid_t **mem_space_ids_out, hid_t **file_space_ids_out)
+{
+    herr_t ret_value = SUCCEED;
+
+    if (NULL == (*dsets_out = RV_malloc(count * sizeof(**dsets_out))) ||
+        NULL == (*mem_type_ids_out = RV_malloc(count * sizeof(**mem_type_ids_out))) ||
+        NULL == (*mem_space_ids_out = RV_malloc(count * sizeof(**mem_space_ids_out))) ||
+        NULL == (*file_space_ids_out = RV_malloc(count * sizeof(**file_space_ids_out))))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset selections");
+
+    for (size_t i = 0; i < count; i++) {
+        (*dsets_out)[i]          = dset;
+        (*mem_type_ids_out)[i]   = mem_type_id;
+        (*mem_space_ids_out)[i]  = mem_space_ids[i];
+        (*file_space_ids_out)[i] = file_space_ids[i];
+    }
+
+done:
+    return ret_value;
+} /* end RV_dataset_setup_selections() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5rest_get_storage_sizes
+ *
+ * Purpose:     Retrieves the storage sizes of several datasets in a file,
+ *              as H5Dget_storage_size() would for each of them, but
+ *              rescanning the file's domain on the server at most once
+ *              rather than once per dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+H5rest_get_storage_sizes(hid_t file_id, size_t count, const hid_t dset_ids[], hsize_t sizes[])
+{
+    RV_object_t  *obj       = NULL;
+    RV_object_t **dsets     = NULL;
+    herr_t        ret_value = SUCCEED;
+
+    if (count && (!dset_ids || !sizes))
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset ID or storage size array was NULL");
+
+    if (NULL == (obj = (RV_object_t *)H5VLobject(file_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid identifier");
+
+    if (!count)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (NULL == (dsets = RV_malloc(count * sizeof(*dsets))))
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate list of datasets");
+
+    for (size_t i = 0; i < count; i++)
+        if (NULL == (dsets[i] = (RV_object_t *)H5VLobject(dset_ids[i])))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid dataset identifier");
+
+    if (RV_dataset_get_storage_sizes(obj->domain, count, dsets, sizes) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get storage sizes of datasets");
+
+done:
+    PRINT_ERROR_STACK;
+
+    RV_free(dsets);
+
+    return ret_value;
+} /* end H5rest_get_storage_sizes() */
+
+const char *
+H5rest_get_object_uri(hid_t obj_id)
+{
+    RV_object_t *VOL_obj;
+    char        *ret_value = NULL;
+
+    /* TODO: Route through REST VOL optional catch-all function */
+
+    if (NULL == (VOL_obj = (RV_object_t *)H5VLobject(obj_id)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, NULL, "invalid identifier");
+    ret_value = VOL_obj->URI;
+
+done:
+    PRINT_ERROR_STACK;
+
+    return (const char *)ret_value;
+} /* end H5rest_get_object_uri() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_set_connection_information
+ *
+ * Purpose:     Set the connection information for the REST VOL. The
+ *              information is read from the environment or config file
+ *              the first time this is called, and copied from that cached
+ *              information afterwards, so that opening many files doesn't
+ *              read the config file or authenticate with the server again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              June, 2018
+ */
+herr_t
+H5_rest_set_connection_information(server_info_t *server_info)
+{
+    const server_info_t *cached    = &H5_rest_connection_info_g;
+    herr_t               ret_value = SUCCEED;
+
+    if (!H5_rest_connection_info_cached_g) {
+        if (H5_rest_read_connection_information(&H5_rest_connection_info_g) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't read connection information");
+
+        H5_rest_connection_info_cached_g = TRUE;
+    }
+
+    /* Copy server information */
+    if (server_info) {
+        memset(server_info, 0, sizeof(*server_info));
+
+        if (cached->username) {
+            if ((server_info->username = RV_calloc(strlen(cached->username) + 1)) == NULL)
+                FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't allocate space for username");
+
+            strcpy(server_info->username, cached->username);
+        }
+
+        if (cached->password) {
+            if ((server_info->password = RV_calloc(strlen(cached->password) + 1)) == NULL)
+                FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't allocate space for password");
+
+            strcpy(server_info->password, cached->password);
+        }
+
+        if ((server_info->base_URL = RV_calloc(strlen(cached->base_URL) + 1)) == NULL)
+            FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't allocate space for URL");
+
+        strcpy(server_info->base_URL, cached->base_URL);
+    }
+
+done:
+    if (ret_value < 0 && server_info) {
+        RV_free(server_info->username);
+        server_info->username = NULL;
+
+        RV_free(server_info->password);
+        server_info->password = NULL;
+
+        RV_free(server_info->base_URL);
+        server_info->base_URL = NULL;
+    }
+
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end H5_rest_set_connection_information() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_rest_read_connection_information
+ *
+ * Purpose:     Read the connection information for the REST VOL by first
+ *              attempting to get the information from the environment,
+ *              then, failing that, attempting to pull the information from
+ *              a config file in the user's home directory.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              June, 2018
+ */
+static herr_t
+H5_rest_read_connection_information(server_info_t *server_info)
+{
+    H5_rest_ad_info_t ad_info;
+    FILE             *config_file = NULL;
+    char              config_endpoint[1024];
+    herr_t            ret_value = SUCCEED;
+
+    const char *username = NULL;
+    const char *password = NULL;
+    const char *base_URL = NULL;
+
+    memset(&ad_info, 0, sizeof(ad_info));
+
+    /*
+     * Attempt to pull in configuration/authentication information from
+     * the environment.
+     */
+
+    if (base_URL = getenv("HSDS_ENDPOINT")) {
+
+        username = getenv("HSDS_USERNAME");
+        password = getenv("HSDS_PASSWORD");
+
+        if (!strncmp(base_URL, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX))) {
+            base_URL = socket_base_url;
+        }
+
+        /* Requests served in process by the local transport need no authentication */
+        if (!username && !password && strncmp(base_URL, LOCAL_STORE_PREFIX, strlen(LOCAL_STORE_PREFIX))) {
+            const char *clientID      = getenv("HSDS_AD_CLIENT_ID");
+            const char *tenantID      = getenv("HSDS_AD_TENANT_ID");
+            const char *resourceID    = getenv("HSDS_AD_RESOURCE_ID");
+            const char *client_secret = getenv("HSDS_AD_CLIENT_SECRET");
+
+            if (clientID)
+                strncpy(ad_info.clientID, clientID, sizeof(ad_info.clientID) - 1);
+            if (tenantID)
+                strncpy(ad_info.tenantID, tenantID, sizeof(ad_info.tenantID) - 1);
+            if (resourceID)
+                strncpy(ad_info.resourceID, resourceID, sizeof(ad_info.resourceID) - 1);
+            if (client_secret) {
+                ad_info.unattended = TRUE;
+                strncpy(ad_info.client_secret, client_secret, sizeof(ad_info.client_secret) - 1);
+            } /* end if */
+
+            /* Attempt authentication with Active Directory */
+            if (H5_rest_authenticate_with_AD(&ad_info, base_URL) < 0)
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't authenticate with Active Directory");
+        } /* end else */
+    }     /* end if */
+    else {
+        const char *cfg_file_name = ".hscfg";
+        size_t      pathname_len  = 0;
+        char       *home_dir      = NULL;
+        char       *pathname      = NULL;
+        char        file_line[1024];
+        int         file_path_len = 0;
+
+        /*
+         * If a valid endpoint was not obtained from the environment,
+         * try to get the connection information from a config file
+         * in the user's home directory.
+         */
+#ifdef WIN32
+        char *home_drive = NULL;
+
+        if (NULL == (home_drive = getenv("HOMEDRIVE")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
+                            "reading config file - unable to retrieve location of home directory");
+
+        if (NULL == (home_dir = getenv("HOMEPATH")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
+                            "reading config file - unable to retrieve location of home directory");
+
+        pathname_len = strlen(home_drive) + strlen(home_dir) + strlen(cfg_file_name) + 3;
+        if (NULL == (pathname = RV_malloc(pathname_len)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL,
+                            "unable to allocate space for config file pathname");
+
+        if ((file_path_len =
+                 snprintf(pathname, pathname_len, "%s\\%s\\%s", home_drive, home_dir, cfg_file_name)) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "snprintf error");
+
+        if (file_path_len >= pathname_len)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL,
+                            "config file path length exceeded maximum path length");
+#else
+        if (NULL == (home_dir = getenv("HOME")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL,
+                            "reading config file - unable to retrieve location of home directory");
+
+        pathname_len = strlen(home_dir) + strlen(cfg_file_name) + 2;
+        if (NULL == (pathname = RV_malloc(pathname_len)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL,
+                            "unable to allocate space for config file pathname");
+
+        if ((file_path_len = snprintf(pathname, pathname_len, "%s/%s", home_dir, cfg_file_name)) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+        if (file_path_len >= pathname_len)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL,
+                            "config file path length exceeded maximum path length");
+#endif
+
+        if (NULL == (config_file = fopen(pathname, "r")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "unable to open config file");
+
+        /*
+         * Parse the connection information by searching for
+         * URL, username and password key-value pairs.
+         */
+        while (fgets(file_line, sizeof(file_line), config_file) != NULL) {
+            char *key;
+            char *val;
+
+            if ((file_line[0] == '#') || !strlen(file_line))
+                continue;
+            key = strtok(file_line, " =\n");
+            val = strtok(NULL, " =\n");
+
+            if (!strcmp(key, "hs_endpoint")) {
+                if (val) {
+                    if (!strncmp(val, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX))) {
+                        base_URL = socket_base_url;
+                    }
+                    else {
+                        /* Copy the endpoint, since the line buffer is reused for the following lines */
+                        strncpy(config_endpoint, val, sizeof(config_endpoint) - 1);
+                        config_endpoint[sizeof(config_endpoint) - 1] = '\0';
+                        base_URL                                     = config_endpoint;
+                    }
+                } /* end if */
+            }     /* end if */
+            else if (!strcmp(key, "hs_ad_app_id")) {
+                if (val && strlen(val))
+                    strncpy(ad_info.clientID, val, sizeof(ad_info.clientID) - 1);
+            } /* end else */
+            else if (!strcmp(key, "hs_ad_tenant_id")) {
+                if (val && strlen(val))
+                    strncpy(ad_info.tenantID, val, sizeof(ad_info.tenantID) - 1);
+            } /* end else */
+            else if (!strcmp(key, "hs_ad_resource_id")) {
                 if (val && strlen(val))
                     strncpy(ad_info.resourceID, val, sizeof(ad_info.resourceID) - 1);
             } /* end else if */
@@ -933,10 +4145,8 @@ done:
         server_info->base_URL = NULL;
     }
 
-    PRINT_ERROR_STACK;
-
     return ret_value;
-} /* end H5_rest_set_connection_information() */
+} /* end H5_rest_read_connection_information() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_rest_authenticate_with_AD
@@ -948,8 +4158,8 @@ done:
  *              authenticate according to instructions that get printed out
  *              before the authentication process can complete.
  *
- *              TODO: if the authentication token expires, there should be
- *                    logic for attempting a re-authentication.
+ *              The access token is cached for the process and refreshed
+ *              before it expires; see RV_refresh_access_token().
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -958,21 +4168,24 @@ done:
 static herr_t
 H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
 {
-    const char *access_token_key[]  = {"access_token", (const char *)0};
-    const char *refresh_token_key[] = {"refresh_token", (const char *)0};
-    const char *expires_in_key[]    = {"expires_in", (const char *)0};
-    const char *token_cfg_file_name = ".hstokencfg";
-    yajl_val    parse_tree = NULL, key_obj = NULL;
-    size_t      token_cfg_file_pathname_len = 0;
-    FILE       *token_cfg_file              = NULL;
-    char       *token_cfg_file_pathname     = NULL;
-    char       *home_dir                    = NULL;
-    char       *access_token                = NULL;
-    char       *refresh_token               = NULL;
-    time_t      token_expires               = -1;
-    char        tenant_string[1024];
-    char        data_string[1024];
-    herr_t      ret_value = SUCCEED;
+    const char    *access_token_key[]  = {"access_token", (const char *)0};
+    const char    *refresh_token_key[] = {"refresh_token", (const char *)0};
+    const char    *expires_in_key[]    = {"expires_in", (const char *)0};
+    const char    *token_cfg_file_name = ".hstokencfg";
+    yajl_val       parse_tree = NULL, key_obj = NULL;
+    size_t         token_cfg_file_pathname_len = 0;
+    FILE          *token_cfg_file              = NULL;
+    char          *token_cfg_file_pathname     = NULL;
+    char          *home_dir                    = NULL;
+    char          *access_token                = NULL;
+    char          *refresh_token               = NULL;
+    time_t         token_expires               = -1;
+    long           http_status                 = 0;
+    RV_ad_token_t *cached_token                = NULL;
+    RV_request_t   auth_request                = {0};
+    char           tenant_string[1024];
+    char           data_string[1024];
+    herr_t         ret_value = SUCCEED;
 
     if (!ad_info)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Active Directory info structure is NULL");
@@ -985,6 +4198,17 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
     if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_DEFAULT_PROTOCOL, "https"))
         FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set default protocol to HTTPS: %s", curl_err_buf);
 
+    /* Reuse a token already issued to this process for the same tenant, client and resource */
+    if (NULL != (cached_token = RV_ad_token_find(ad_info)) && time(NULL) < cached_token->expires) {
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Using cached access token");
+        RV_ad_token_g = cached_token;
+
+        if (CURLE_OK != (curl_easy_setopt(curl, CURLOPT_XOAUTH2_BEARER, cached_token->access_token)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set OAuth access token: %s", curl_err_buf);
+
+        FUNC_GOTO_DONE(SUCCEED);
+    }
+
     curl_headers = curl_slist_append(curl_headers, "Content-Type: application/x-www-form-urlencoded");
 
     if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_HTTPHEADER, curl_headers))
@@ -1029,9 +4253,7 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
         FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
 #endif
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Token config file location: %s\n", token_cfg_file_pathname);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Token config file location: %s", token_cfg_file_pathname);
     if ((token_cfg_file = fopen(token_cfg_file_pathname, "rb"))) {
         char       *cfg_json = NULL; /* Buffer for token config file content */
         size_t      file_size;
@@ -1039,9 +4261,7 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
         const char *cfg_refresh_token[] = {base_URL, "refreshToken", (const char *)0};
         const char *cfg_token_expires[] = {base_URL, "expiresOn", (const char *)0};
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Token config file %s found\n", token_cfg_file_pathname);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Token config file %s found", token_cfg_file_pathname);
 
         /* Read entire token config file content */
         if (fseek(token_cfg_file, 0, SEEK_END) != 0)
@@ -1058,10 +4278,6 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
             FUNC_GOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "Failed to read token config file");
         fclose(token_cfg_file);
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> JSON read from \"%s\":\n-> BEGIN JSON>%s<END JSON\n", token_cfg_file_pathname, cfg_json);
-#endif
-
         /* Parse token config file */
         if (NULL == (parse_tree = yajl_tree_parse(cfg_json, NULL, 0)))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "Failed to parse token config JSON");
@@ -1071,54 +4287,41 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token");
         if (NULL == (access_token = YAJL_GET_STRING(key_obj)))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token's value");
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Access token:\n-> \"%s\"\n", access_token);
-#endif
 
         /* Get refresh token for the HSDS endpoint */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, cfg_refresh_token, yajl_t_string)))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve refresh token");
         if (NULL == (refresh_token = YAJL_GET_STRING(key_obj)))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve refresh token's value");
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Refresh token:\n-> \"%s\"\n", refresh_token);
-#endif
 
         /* Get token expiration for the HSDS endpoint */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, cfg_token_expires, yajl_t_number)))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve token expiration");
         if (!YAJL_IS_NUMBER(key_obj))
             FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "token expiration's value is not a number");
+        /* An expired token is refreshed below, using the refresh token */
         token_expires = (time_t)YAJL_GET_DOUBLE(key_obj);
-        if (time(NULL) > token_expires)
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "Access token expired");
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Access token expires on: %ld\n", token_expires);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Access token expires on: %ld", token_expires);
 
         /* Clean up */
         RV_free(cfg_json);
     } /* end if */
     else {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Token config file %s not found\n", token_cfg_file_pathname);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Token config file %s not found", token_cfg_file_pathname);
         if (ad_info->unattended) {
             if (ad_info->client_secret[0] == '\0')
                 FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL,
                                 "Active Directory authentication client secret is NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Performing unattended authentication\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Performing unattended authentication");
 
             /* Set cURL up to authenticate device with AD in unattended manner */
             if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "POST"))
                 FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set HTTP GET operation: %s", curl_err_buf);
 
             /* Form URL from tenant ID string */
-            if (snprintf(tenant_string, sizeof(tenant_string),
-                         "https://login.microsoftonline.com/%s/oauth2/v2.0/token", ad_info->tenantID) < 0)
+            if (snprintf(tenant_string, sizeof(tenant_string), "%s/%s/oauth2/v2.0/token", RV_ad_authority(),
+                         ad_info->tenantID) < 0)
                 FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
 
             if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, tenant_string))
@@ -1133,14 +4336,17 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
             if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data_string))
                 FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL POST data: %s", curl_err_buf);
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server URL: \"%s\"\n", tenant_string);
-            printf("-> Request payload: \"%s\"\n", data_string);
-#endif
-            CURL_PERFORM(curl, H5E_VOL, H5E_CANTGET, FAIL);
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server response:\n-> \"%s\"\n", response_buffer.buffer);
-#endif
+            /* The request body carries the client secret, so only the grant type is logged */
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Requesting client_credentials token from \"%s\"", tenant_string);
+            auth_request.method       = "POST";
+            auth_request.url          = tenant_string;
+            auth_request.content_type = "application/x-www-form-urlencoded";
+            auth_request.body         = data_string;
+            auth_request.body_size    = strlen(data_string);
+
+            CURL_PERFORM(curl, &auth_request, H5E_VOL, H5E_CANTGET, FAIL);
+            if (RV_curl_get_response_code(curl, &http_status) >= 0)
+                RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Authentication server returned HTTP %ld", http_status);
         } /* end if */
         else {
             const char *ad_auth_message_keys[] = {"message", (const char *)0};
@@ -1150,166 +4356,583 @@ H5_rest_authenticate_with_AD(H5_rest_ad_info_t *ad_info, const char *base_URL)
 
             /* Set cURL up to authenticate device with AD in attended manner */
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "POST"))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set HTTP POST operation: %s",
-                                curl_err_buf);
+            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "POST"))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set HTTP POST operation: %s",
+                                curl_err_buf);
+
+            /* Form URL from tenant ID string */
+            if (snprintf(tenant_string, sizeof(tenant_string), "%s/%s/oauth2/v2.0/devicecode",
+                         RV_ad_authority(), ad_info->tenantID) < 0)
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, tenant_string))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+
+            /* Form client ID string */
+            if (snprintf(data_string, sizeof(data_string), "client_id=%s&scope=%s/.default",
+                         ad_info->clientID, ad_info->resourceID) < 0)
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data_string))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL POST data: %s", curl_err_buf);
+
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Requesting device code from \"%s\"", tenant_string);
+            auth_request.method       = "POST";
+            auth_request.url          = tenant_string;
+            auth_request.content_type = "application/x-www-form-urlencoded";
+            auth_request.body         = data_string;
+            auth_request.body_size    = strlen(data_string);
+
+            CURL_PERFORM(curl, &auth_request, H5E_VOL, H5E_CANTGET, FAIL);
+            if (RV_curl_get_response_code(curl, &http_status) >= 0)
+                RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Authentication server returned HTTP %ld", http_status);
+
+            /* Retrieve and print out authentication instructions message to user and wait for
+             * their input after authenticating */
+            if (NULL == (parse_tree = yajl_tree_parse(response_buffer.buffer, NULL, 0)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "JSON parse tree creation failed");
+
+            /* Retrieve the authentication message */
+            if (NULL == (key_obj = yajl_tree_get(parse_tree, ad_auth_message_keys, yajl_t_string)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL,
+                                "can't retrieve authentication instructions message");
+            if (NULL == (instruction_string = YAJL_GET_STRING(key_obj)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL,
+                                "can't retrieve authentication instructions message");
+
+            printf("Please follow the instructions below\n %s\n\nHit Enter when completed",
+                   instruction_string);
+            getchar();
+
+            /* Assume that the user has now properly signed in - attempt to retrieve token */
+
+            if (NULL == (key_obj = yajl_tree_get(parse_tree, device_code_keys, yajl_t_string)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve authentication device code");
+
+            if (NULL == (device_code = YAJL_GET_STRING(key_obj)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve authentication device code");
+
+            /* Form URL from tenant ID string */
+            if (snprintf(tenant_string, sizeof(tenant_string), "%s/%s/oauth2/v2.0/token", RV_ad_authority(),
+                         ad_info->tenantID) < 0)
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, tenant_string))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+
+            /* Form token string */
+            if (snprintf(data_string, sizeof(data_string),
+                         "grant_type=urn%%3Aietf%%3Aparams%%3Aoauth%%3Agrant-type%%3Adevice_code&device_code="
+                         "%s&client_id=%s",
+                         device_code, ad_info->clientID) < 0)
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data_string))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL POST data: %s", curl_err_buf);
+
+            /* Request access token from the server */
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Requesting device_code token from \"%s\"", tenant_string);
+            auth_request.method       = "POST";
+            auth_request.url          = tenant_string;
+            auth_request.content_type = "application/x-www-form-urlencoded";
+            auth_request.body         = data_string;
+            auth_request.body_size    = strlen(data_string);
+
+            CURL_PERFORM(curl, &auth_request, H5E_VOL, H5E_CANTGET, FAIL);
+            if (RV_curl_get_response_code(curl, &http_status) >= 0)
+                RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Authentication server returned HTTP %ld", http_status);
+        } /* end else */
+
+        /* Parse response JSON */
+        yajl_tree_free(parse_tree);
+        parse_tree = NULL;
+        if (NULL == (parse_tree = yajl_tree_parse(response_buffer.buffer, NULL, 0)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "JSON parse tree creation failed");
+
+        /* Get access token */
+        if (NULL == (key_obj = yajl_tree_get(parse_tree, access_token_key, yajl_t_string)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token");
+        if (NULL == (access_token = YAJL_GET_STRING(key_obj)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token string");
+
+        /* Get access token's validity period */
+        if (NULL == (key_obj = yajl_tree_get(parse_tree, expires_in_key, yajl_t_number)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve expires_in key");
+        if (!YAJL_IS_INTEGER(key_obj))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "returned expires_in value is not an integer");
+        token_expires = YAJL_GET_INTEGER(key_obj);
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Access token expires after %ld (duration: %ld seconds)",
+                     time(NULL) + token_expires, token_expires);
+        token_expires = time(NULL) + token_expires - 1;
+
+        /* Get refresh token (optional) */
+        if (NULL != (key_obj = yajl_tree_get(parse_tree, refresh_token_key, yajl_t_string))) {
+            if (NULL == (refresh_token = YAJL_GET_STRING(key_obj)))
+                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve refresh token's string value");
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Refresh token provided");
+        }
+        else {
+            RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Refresh token NOT PROVIDED");
+        }
+    } /* end else */
+
+    RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Authentication successfully completed.");
+
+    /* Cache the access token and set it with cURL for future authentication */
+    if (RV_ad_token_store(ad_info, access_token, refresh_token, token_expires) < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't cache access token");
+
+    /* A token from the token config file may have expired already */
+    if (time(NULL) >= token_expires && RV_refresh_access_token() < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "Access token expired and couldn't be refreshed");
+
+done:
+    RV_free(token_cfg_file_pathname);
+
+    /* Reset custom request on cURL pointer */
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL))
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't reset cURL custom request: %s", curl_err_buf);
+
+    if (curl_headers) {
+        curl_slist_free_all(curl_headers);
+        curl_headers = NULL;
+    } /* end if */
+
+    if (parse_tree)
+        yajl_tree_free(parse_tree);
+
+    /* Clear out memory */
+    memset(data_string, 0, sizeof(data_string));
+    memset(tenant_string, 0, sizeof(tenant_string));
+
+    return ret_value;
+} /* end H5_rest_authenticate_with_AD() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_ad_authority
+ *
+ * Purpose:     Returns the base URL of the Active Directory token
+ *              endpoints, which can be overridden with the
+ *              HSDS_AD_AUTHORITY environment variable, for example to use
+ *              a local mock token endpoint.
+ *
+ * Return:      The base URL of the Active Directory token endpoints
+ */
+static const char *
+RV_ad_authority(void)
+{
+    const char *authority = getenv(AD_AUTHORITY_ENV_VAR);
+
+    return (authority && authority[0] != '\0') ? authority : DEFAULT_AD_AUTHORITY;
+} /* end RV_ad_authority() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_ad_token_find
+ *
+ * Purpose:     Looks up the cached access token issued for the tenant,
+ *              client and resource in the given Active Directory
+ *              information.
+ *
+ * Return:      The cached token, or NULL if no token is cached
+ */
+static RV_ad_token_t *
+RV_ad_token_find(const H5_rest_ad_info_t *ad_info)
+{
+    for (size_t i = 0; i < RV_num_ad_tokens_g; i++) {
+        const H5_rest_ad_info_t *cached_info = &RV_ad_tokens_g[i]->ad_info;
+
+        if (!strcmp(cached_info->tenantID, ad_info->tenantID) &&
+            !strcmp(cached_info->clientID, ad_info->clientID) &&
+            !strcmp(cached_info->resourceID, ad_info->resourceID))
+            return RV_ad_tokens_g[i];
+    }
+
+    return NULL;
+} /* end RV_ad_token_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_ad_token_store
+ *
+ * Purpose:     Caches an access token issued for the tenant, client and
+ *              resource in the given Active Directory information,
+ *              replacing any token already cached for them, and makes it
+ *              the token used to authenticate requests.
+ *
+ *              The token is refreshed a margin of time before it expires,
+ *              set by the HSDS_AD_REFRESH_MARGIN environment variable in
+ *              seconds, but no earlier than halfway through its lifetime.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_ad_token_store(const H5_rest_ad_info_t *ad_info, const char *access_token, const char *refresh_token,
+                  time_t expires)
+{
+    RV_ad_token_t *token          = NULL;
+    const char    *margin_env     = getenv(AD_REFRESH_MARGIN_ENV_VAR);
+    time_t         refresh_margin = DEFAULT_AD_REFRESH_MARGIN;
+    time_t         now            = time(NULL);
+    char          *new_access     = NULL;
+    char          *new_refresh    = NULL;
+    herr_t         ret_value      = SUCCEED;
+
+    if (!access_token)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "access token was NULL");
+
+    if (NULL == (new_access = RV_malloc(strlen(access_token) + 1)))
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for access token");
+    strcpy(new_access, access_token);
+
+    if (refresh_token) {
+        if (NULL == (new_refresh = RV_malloc(strlen(refresh_token) + 1)))
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for refresh token");
+        strcpy(new_refresh, refresh_token);
+    }
+
+    if (NULL == (token = RV_ad_token_find(ad_info))) {
+        RV_ad_token_t **tmp_realloc = NULL;
+
+        if (NULL ==
+            (tmp_realloc = RV_realloc(RV_ad_tokens_g, (RV_num_ad_tokens_g + 1) * sizeof(*tmp_realloc))))
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow access token cache");
+        RV_ad_tokens_g = tmp_realloc;
+
+        if (NULL == (token = RV_calloc(sizeof(*token))))
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for cached token");
+
+        memcpy(&token->ad_info, ad_info, sizeof(token->ad_info));
+        RV_ad_tokens_g[RV_num_ad_tokens_g++] = token;
+    }
+    else if (&token->ad_info != ad_info) {
+        /* A newer client secret may have been given for the same tenant, client and resource */
+        memcpy(&token->ad_info, ad_info, sizeof(token->ad_info));
+    }
+
+    /* Keep the previous refresh token if the endpoint didn't issue a new one */
+    if (!new_refresh) {
+        new_refresh          = token->refresh_token;
+        token->refresh_token = NULL;
+    }
+
+    RV_free(token->access_token);
+    RV_free(token->refresh_token);
+
+    token->access_token  = new_access;
+    token->refresh_token = new_refresh;
+    token->issued        = now;
+    token->expires       = expires;
+    new_access           = NULL;
+    new_refresh          = NULL;
+
+    if (margin_env && atol(margin_env) >= 0)
+        refresh_margin = (time_t)atol(margin_env);
+    if (expires > now && refresh_margin > (expires - now) / 2)
+        refresh_margin = (expires - now) / 2;
+
+    token->next_refresh = expires - refresh_margin;
+
+    RV_ad_token_g = token;
+
+    RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Cached access token expires at %lld, refreshing at %lld",
+                 (long long)token->expires, (long long)token->next_refresh);
+
+    if (CURLE_OK != (curl_easy_setopt(curl, CURLOPT_XOAUTH2_BEARER, token->access_token)))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set OAuth access token: %s", curl_err_buf);
+
+done:
+    RV_free(new_access);
+    RV_free(new_refresh);
+
+    return ret_value;
+} /* end RV_ad_token_store() */
+
+/* Write callback for access token refresh requests, which collects the response */
+static size_t
+RV_ad_token_write_cb(char *buffer, size_t size, size_t nmemb, void *userp)
+{
+    RV_ad_token_t *token     = (RV_ad_token_t *)userp;
+    size_t         data_size = size * nmemb;
+    char          *tmp_realloc;
+
+    if (NULL ==
+        (tmp_realloc = RV_realloc(token->refresh_response, token->refresh_response_len + data_size + 1)))
+        return 0;
+
+    token->refresh_response = tmp_realloc;
+    memcpy(token->refresh_response + token->refresh_response_len, buffer, data_size);
+    token->refresh_response_len += data_size;
+    token->refresh_response[token->refresh_response_len] = '\0';
+
+    return data_size;
+} /* end RV_ad_token_write_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_ad_token_start_refresh
+ *
+ * Purpose:     Starts a request for a new access token on the token's own
+ *              multi handle, without waiting for it. A token issued with
+ *              a refresh token is refreshed with it; otherwise, a token
+ *              issued for unattended authentication is requested again
+ *              with the client secret. Tokens which can be refreshed in
+ *              neither way are left alone.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_ad_token_start_refresh(RV_ad_token_t *token)
+{
+    H5_rest_ad_info_t *ad_info      = &token->ad_info;
+    char              *escaped      = NULL;
+    char              *request_body = NULL;
+    size_t             request_len  = 0;
+    char               token_url[1024];
+    herr_t             ret_value = SUCCEED;
+
+    if (!token->refresh_token && !ad_info->unattended) {
+        /* Nothing to refresh with; the token is used until it expires */
+        token->next_refresh = token->expires;
+        FUNC_GOTO_DONE(SUCCEED);
+    }
+
+    if (snprintf(token_url, sizeof(token_url), "%s/%s/oauth2/v2.0/token", RV_ad_authority(),
+                 ad_info->tenantID) >= (int)sizeof(token_url))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "token endpoint URL exceeded maximum URL size");
+
+    if (NULL == (token->refresh_handle = curl_easy_init()))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize cURL handle for token refresh");
+
+    if (token->refresh_token) {
+        if (NULL == (escaped = curl_easy_escape(token->refresh_handle, token->refresh_token, 0)))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTENCODE, FAIL, "can't escape refresh token");
+
+        request_len = strlen(escaped) + sizeof(ad_info->clientID) + sizeof(ad_info->resourceID) +
+                      sizeof(ad_info->client_secret) + 128;
+    }
+    else
+        request_len = sizeof(ad_info->clientID) + sizeof(ad_info->resourceID) +
+                      sizeof(ad_info->client_secret) + 128;
+
+    if (NULL == (request_body = RV_malloc(request_len)))
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for token refresh request");
+
+    if (token->refresh_token) {
+        if (snprintf(request_body, request_len,
+                     "grant_type=refresh_token&refresh_token=%s&client_id=%s&scope=%s/.default%s%s", escaped,
+                     ad_info->clientID, ad_info->resourceID, ad_info->unattended ? "&client_secret=" : "",
+                     ad_info->unattended ? ad_info->client_secret : "") < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+    }
+    else if (snprintf(request_body, request_len,
+                      "grant_type=client_credentials&client_id=%s&scope=%s/.default&client_secret=%s",
+                      ad_info->clientID, ad_info->resourceID, ad_info->client_secret) < 0)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if (CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_URL, token_url) ||
+        CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_COPYPOSTFIELDS, request_body) ||
+        CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_FOLLOWLOCATION, 1L) ||
+        CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_DEFAULT_PROTOCOL, "https") ||
+        CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_WRITEFUNCTION, RV_ad_token_write_cb) ||
+        CURLE_OK != curl_easy_setopt(token->refresh_handle, CURLOPT_WRITEDATA, token))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set up cURL handle for token refresh");
+
+    if (NULL == (token->refresh_multi_handle = curl_multi_init()))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize cURL multi handle for token refresh");
+
+    if (CURLM_OK != curl_multi_add_handle(token->refresh_multi_handle, token->refresh_handle))
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't add token refresh to cURL multi handle");
+
+    RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Started access token refresh from %s", token_url);
+
+done:
+    if (escaped)
+        curl_free(escaped);
+
+    /* Don't leave secrets in freed memory */
+    if (request_body) {
+        memset(request_body, 0, request_len);
+        RV_free(request_body);
+    }
+
+    if (ret_value < 0)
+        RV_ad_token_cancel_refresh(token);
+
+    return ret_value;
+} /* end RV_ad_token_start_refresh() */
 
-            /* Form URL from tenant ID string */
-            if (snprintf(tenant_string, sizeof(tenant_string),
-                         "https://login.microsoftonline.com/%s/oauth2/v2.0/devicecode",
-                         ad_info->tenantID) < 0)
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+/*-------------------------------------------------------------------------
+ * Function:    RV_ad_token_finish_refresh
+ *
+ * Purpose:     Advances the token's refresh request, waiting for it to
+ *              complete if requested. Once the request completes, the new
+ *              access token is cached and set for future requests. A
+ *              failed refresh is retried after DEFAULT_AD_REFRESH_RETRY
+ *              seconds, or as many as set by the HSDS_AD_REFRESH_RETRY
+ *              environment variable; the current token remains in use
+ *              until then.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_ad_token_finish_refresh(RV_ad_token_t *token, hbool_t wait)
+{
+    const char *access_token_key[]  = {"access_token", (const char *)0};
+    const char *refresh_token_key[] = {"refresh_token", (const char *)0};
+    const char *expires_in_key[]    = {"expires_in", (const char *)0};
+    const char *retry_env           = getenv(AD_REFRESH_RETRY_ENV_VAR);
+    yajl_val    parse_tree = NULL, access_obj = NULL, refresh_obj = NULL, expires_obj = NULL;
+    CURLMsg    *curl_multi_msg    = NULL;
+    CURLcode    result            = CURLE_OK;
+    long        response_code     = 0;
+    int         num_still_running = 0;
+    int         num_curlm_msgs    = 0;
+    time_t      retry_interval    = DEFAULT_AD_REFRESH_RETRY;
+    hbool_t     done              = FALSE;
+    herr_t      ret_value         = SUCCEED;
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, tenant_string))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+    do {
+        if (CURLM_OK != curl_multi_perform(token->refresh_multi_handle, &num_still_running))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "cURL multi perform error during token refresh");
 
-            /* Form client ID string */
-            if (snprintf(data_string, sizeof(data_string), "client_id=%s&scope=%s/.default",
-                         ad_info->clientID, ad_info->resourceID) < 0)
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+        while ((curl_multi_msg = curl_multi_info_read(token->refresh_multi_handle, &num_curlm_msgs))) {
+            if (curl_multi_msg->msg == CURLMSG_DONE) {
+                result = curl_multi_msg->data.result;
+                done   = TRUE;
+            }
+        }
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data_string))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL POST data: %s", curl_err_buf);
+        if (!done && wait &&
+            CURLM_OK != curl_multi_wait(token->refresh_multi_handle, NULL, 0, DEFAULT_POLL_TIMEOUT_MS, NULL))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "cURL multi wait error during token refresh");
+    } while (!done && wait);
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server URL: \"%s\"\n", tenant_string);
-            printf("-> Request payload: \"%s\"\n", data_string);
-#endif
-            CURL_PERFORM(curl, H5E_VOL, H5E_CANTGET, FAIL);
+    if (!done)
+        FUNC_GOTO_DONE(SUCCEED);
 
-            /* Retrieve and print out authentication instructions message to user and wait for
-             * their input after authenticating */
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server response:\n-> \"%s\"\n", response_buffer.buffer);
-#endif
-            if (NULL == (parse_tree = yajl_tree_parse(response_buffer.buffer, NULL, 0)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "JSON parse tree creation failed");
+    if (CURLE_OK == result)
+        curl_easy_getinfo(token->refresh_handle, CURLINFO_RESPONSE_CODE, &response_code);
 
-            /* Retrieve the authentication message */
-            if (NULL == (key_obj = yajl_tree_get(parse_tree, ad_auth_message_keys, yajl_t_string)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL,
-                                "can't retrieve authentication instructions message");
-            if (NULL == (instruction_string = YAJL_GET_STRING(key_obj)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL,
-                                "can't retrieve authentication instructions message");
+    if (CURLE_OK == result && HTTP_SUCCESS(response_code) && token->refresh_response &&
+        NULL != (parse_tree = yajl_tree_parse(token->refresh_response, NULL, 0)) &&
+        NULL != (access_obj = yajl_tree_get(parse_tree, access_token_key, yajl_t_string)) &&
+        NULL != (expires_obj = yajl_tree_get(parse_tree, expires_in_key, yajl_t_number)) &&
+        YAJL_IS_INTEGER(expires_obj)) {
+        refresh_obj = yajl_tree_get(parse_tree, refresh_token_key, yajl_t_string);
 
-            printf("Please follow the instructions below\n %s\n\nHit Enter when completed",
-                   instruction_string);
-            getchar();
+        RV_LOG_DEBUG(RV_LOG_CAT_AUTH, "Refreshed access token (valid for %lld seconds)",
+                     (long long)YAJL_GET_INTEGER(expires_obj));
 
-            /* Assume that the user has now properly signed in - attempt to retrieve token */
+        if (RV_ad_token_store(&token->ad_info, YAJL_GET_STRING(access_obj),
+                              refresh_obj ? YAJL_GET_STRING(refresh_obj) : NULL,
+                              time(NULL) + (time_t)YAJL_GET_INTEGER(expires_obj) - 1) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't cache refreshed access token");
+    }
+    else {
+        RV_LOG_WARN(RV_LOG_CAT_AUTH, "Access token refresh failed (cURL result %d, HTTP %ld); retrying later",
+                    (int)result, response_code);
 
-            if (NULL == (key_obj = yajl_tree_get(parse_tree, device_code_keys, yajl_t_string)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve authentication device code");
+        if (retry_env && atol(retry_env) >= 0)
+            retry_interval = (time_t)atol(retry_env);
 
-            if (NULL == (device_code = YAJL_GET_STRING(key_obj)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve authentication device code");
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Device code: \"%s\"\n", device_code);
-#endif
+        token->next_refresh = time(NULL) + retry_interval;
+    }
 
-            /* Form URL from tenant ID string */
-            if (snprintf(tenant_string, sizeof(tenant_string),
-                         "https://login.microsoftonline.com/%s/oauth2/v2.0/token", ad_info->tenantID) < 0)
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+done:
+    if (parse_tree)
+        yajl_tree_free(parse_tree);
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, tenant_string))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+    /* The refresh request is finished with once it has completed or failed */
+    if (done || ret_value < 0)
+        RV_ad_token_cancel_refresh(token);
 
-            /* Form token string */
-            if (snprintf(data_string, sizeof(data_string),
-                         "grant_type=urn%%3Aietf%%3Aparams%%3Aoauth%%3Agrant-type%%3Adevice_code&device_code="
-                         "%s&client_id=%s",
-                         device_code, ad_info->clientID) < 0)
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_SYSERRSTR, FAIL, "snprintf error");
+    return ret_value;
+} /* end RV_ad_token_finish_refresh() */
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data_string))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set cURL POST data: %s", curl_err_buf);
+/* Stop any refresh request in progress for a token and free its resources */
+static void
+RV_ad_token_cancel_refresh(RV_ad_token_t *token)
+{
+    if (token->refresh_handle) {
+        if (token->refresh_multi_handle)
+            curl_multi_remove_handle(token->refresh_multi_handle, token->refresh_handle);
+        curl_easy_cleanup(token->refresh_handle);
+        token->refresh_handle = NULL;
+    }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server URL: \"%s\"\n", tenant_string);
-            printf("-> Request payload: \"%s\"\n", data_string);
-#endif
-            /* Request access token from the server */
-            CURL_PERFORM(curl, H5E_VOL, H5E_CANTGET, FAIL);
+    if (token->refresh_multi_handle) {
+        curl_multi_cleanup(token->refresh_multi_handle);
+        token->refresh_multi_handle = NULL;
+    }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Authentication server response:\n-> %s\n", response_buffer.buffer);
-#endif
+    if (token->refresh_response) {
+        memset(token->refresh_response, 0, token->refresh_response_len);
+        RV_free(token->refresh_response);
+        token->refresh_response = NULL;
+    }
 
-        } /* end else */
+    token->refresh_response_len = 0;
+} /* end RV_ad_token_cancel_refresh() */
 
-        /* Parse response JSON */
-        yajl_tree_free(parse_tree);
-        parse_tree = NULL;
-        if (NULL == (parse_tree = yajl_tree_parse(response_buffer.buffer, NULL, 0)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "JSON parse tree creation failed");
+/*-------------------------------------------------------------------------
+ * Function:    RV_refresh_access_token
+ *
+ * Purpose:     Keeps the Active Directory access token used to
+ *              authenticate requests current. This is called before each
+ *              request is made. Once the token is close to expiring, a
+ *              refresh request is started in the background, and each
+ *              later call advances it without blocking, until the new
+ *              token arrives. Only if the token has actually expired does
+ *              this wait for the refresh to complete.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_refresh_access_token(void)
+{
+    RV_ad_token_t *token = RV_ad_token_g;
+    time_t         now;
+    herr_t         ret_value = SUCCEED;
 
-        /* Get access token */
-        if (NULL == (key_obj = yajl_tree_get(parse_tree, access_token_key, yajl_t_string)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token");
-        if (NULL == (access_token = YAJL_GET_STRING(key_obj)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve access token string");
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Access token:\n-> \"%s\"\n", access_token);
-#endif
+    if (!token)
+        FUNC_GOTO_DONE(SUCCEED);
 
-        /* Get access token's validity period */
-        if (NULL == (key_obj = yajl_tree_get(parse_tree, expires_in_key, yajl_t_number)))
-            FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve expires_in key");
-        if (!YAJL_IS_INTEGER(key_obj))
-            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "returned expires_in value is not an integer");
-        token_expires = YAJL_GET_INTEGER(key_obj);
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Access token expires after %ld (duration: %ld seconds)\n", time(NULL) + token_expires,
-               token_expires);
-#endif
-        token_expires = time(NULL) + token_expires - 1;
+    now = time(NULL);
 
-        /* Get refresh token (optional) */
-        if (NULL != (key_obj = yajl_tree_get(parse_tree, refresh_token_key, yajl_t_string))) {
-            if (NULL == (refresh_token = YAJL_GET_STRING(key_obj)))
-                FUNC_GOTO_ERROR(H5E_VOL, H5E_PARSEERROR, FAIL, "can't retrieve refresh token's string value");
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Refresh token:\n-> \"%s\"\n", refresh_token);
-#endif
-        }
-        else {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Refresh token NOT PROVIDED\n");
-#endif
-        }
-    } /* end else */
+    if (!token->refresh_multi_handle && now >= token->next_refresh)
+        if (RV_ad_token_start_refresh(token) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start access token refresh");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Authentication successfully completed.\n");
-#endif
+    if (token->refresh_multi_handle)
+        if (RV_ad_token_finish_refresh(token, now >= token->expires) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't refresh access token");
 
-    /* Set access token with cURL for future authentication */
-    if (CURLE_OK != (curl_easy_setopt(curl, CURLOPT_XOAUTH2_BEARER, access_token)))
-        FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set OAuth access token: %s", curl_err_buf);
+    if (time(NULL) >= token->expires)
+        FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "access token expired and couldn't be refreshed");
 
 done:
-    RV_free(token_cfg_file_pathname);
+    return ret_value;
+} /* end RV_refresh_access_token() */
 
-    /* Reset custom request on cURL pointer */
-    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL))
-        FUNC_DONE_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't reset cURL custom request: %s", curl_err_buf);
+/* Cancel any access token refreshes in progress and free all cached tokens */
+static void
+RV_ad_tokens_free(void)
+{
+    for (size_t i = 0; i < RV_num_ad_tokens_g; i++) {
+        RV_ad_token_t *token = RV_ad_tokens_g[i];
 
-    if (curl_headers) {
-        curl_slist_free_all(curl_headers);
-        curl_headers = NULL;
-    } /* end if */
+        RV_ad_token_cancel_refresh(token);
 
-    if (parse_tree)
-        yajl_tree_free(parse_tree);
+        RV_free(token->access_token);
+        RV_free(token->refresh_token);
 
-    /* Clear out memory */
-    memset(data_string, 0, sizeof(data_string));
-    memset(tenant_string, 0, sizeof(tenant_string));
+        memset(token, 0, sizeof(*token));
+        RV_free(token);
+    }
 
-    return ret_value;
-} /* end H5_rest_authenticate_with_AD() */
+    RV_free(RV_ad_tokens_g);
+    RV_ad_tokens_g     = NULL;
+    RV_num_ad_tokens_g = 0;
+    RV_ad_token_g      = NULL;
+} /* end RV_ad_tokens_free() */
 
 /************************************
  *         Helper functions         *
@@ -1567,9 +5190,7 @@ H5_rest_url_encode_path(const char *_path)
         cur_pos++;
     path_prefix_len = (size_t)(cur_pos - path);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Length of path prefix: %zu\n\n", path_prefix_len);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Length of path prefix: %zu", path_prefix_len);
 
     /* Copy the given path (minus the path prefix) so that strtok() can safely modify it */
     bytes_nalloc = strlen(path) - path_prefix_len + 1;
@@ -1578,9 +5199,7 @@ H5_rest_url_encode_path(const char *_path)
 
     strncpy(path_copy, path + path_prefix_len, bytes_nalloc);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Allocated copy of path: %s\n\n", path_copy);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Allocated copy of path: %s", path_copy);
 
     /* As URLs generally tend to be short and URL-encoding in the worst case will generally
      * introduce 3x the memory usage for a given URL (since URL-encoded characters are
@@ -1627,16 +5246,12 @@ H5_rest_url_encode_path(const char *_path)
      * the resulting path buffer, dynamically growing the buffer as necessary.
      */
     for (token = strtok(NULL, "/"); token; token = strtok(NULL, "/")) {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Processing next token: %s\n\n", token);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Processing next token: %s", token);
 
         if (NULL == (url_encoded_path_component = curl_easy_escape(curl, token, 0)))
             FUNC_GOTO_ERROR(H5E_NONE_MAJOR, H5E_CANTENCODE, NULL, "can't URL-encode path component");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> URL-encoded form of token: %s\n\n", url_encoded_path_component);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "URL-encoded form of token: %s", url_encoded_path_component);
 
         path_component_len = strlen(url_encoded_path_component);
 
@@ -1667,9 +5282,7 @@ H5_rest_url_encode_path(const char *_path)
 
     *cur_pos = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Final URL-encoded string: %s\n\n", tmp_buffer);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Final URL-encoded string: %s", tmp_buffer);
 
     ret_value = tmp_buffer;
 
@@ -1695,9 +5308,7 @@ RV_parse_object_class(char *HTTP_response, const void *callback_data_in, void *c
     H5I_type_t *object_type         = (H5I_type_t *)callback_data_out;
     herr_t      ret_value           = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving object's class from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Retrieving object's class from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1819,8 +5430,13 @@ H5_rest_opt_query(void *obj, H5VL_subclass_t cls, int opt_type, uint64_t *flags)
     if (!flags)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "\"flags\" is NULL");
 
-    /* Advertise no current support for any optional operations that are queried. */
-    *flags = FALSE;
+    /* Advertise support for the direct chunk operations, and no others. The chunk routes they
+     * use are only served by the local transport, so they aren't supported against a server. */
+    if (H5VL_SUBCLS_DATASET == cls && RV_transport_serves_chunks() &&
+        (H5VL_NATIVE_DATASET_CHUNK_READ == opt_type || H5VL_NATIVE_DATASET_CHUNK_WRITE == opt_type))
+        *flags = H5VL_OPT_QUERY_SUPPORTED | H5VL_OPT_QUERY_NO_ASYNC;
+    else
+        *flags = FALSE;
 
 done:
     return ret_value;
@@ -1883,9 +5499,7 @@ RV_copy_object_URI_callback(char *HTTP_response, const void *callback_data_in, v
     const char *path_name = NULL;
     herr_t      ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving object's URI from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Retrieving object's URI from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1939,15 +5553,11 @@ RV_copy_object_URI_callback(char *HTTP_response, const void *callback_data_in, v
         if (NULL == (parsed_string = YAJL_GET_STRING(key_obj)))
             FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "URI was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Found object's URI by \"link\" -> \"id\" JSON key path\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Found object's URI by \"link\" -> \"id\" JSON key path");
     } /* end if */
     else {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Could not find object's URI by \"link\" -> \"id\" JSON key path\n");
-        printf("-> Trying \"id\" JSON key path instead\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Could not find object's URI by \"link\" -> \"id\" JSON key path");
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Trying \"id\" JSON key path instead");
 
         /* Could not find the object's URI by the sequence "link" -> "id". Try looking
          * for just the JSON key "id", which would generally correspond to trying to
@@ -1961,15 +5571,11 @@ RV_copy_object_URI_callback(char *HTTP_response, const void *callback_data_in, v
             if (NULL == (parsed_string = YAJL_GET_STRING(key_obj)))
                 FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "URI was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Found object's URI by \"id\" JSON key path\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Found object's URI by \"id\" JSON key path");
         } /* end if */
         else {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Could not find object's URI by \"id\" JSON key path\n");
-            printf("-> Trying \"root\" JSON key path instead\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Could not find object's URI by \"id\" JSON key path");
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Trying \"root\" JSON key path instead");
 
             /* Could not find the object's URI by the JSON key "id". Try looking for
              * just the JSON key "root", which would generally correspond to trying to
@@ -1985,9 +5591,7 @@ RV_copy_object_URI_callback(char *HTTP_response, const void *callback_data_in, v
             if (NULL == (parsed_string = YAJL_GET_STRING(key_obj)))
                 FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "URI was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Found object's URI by \"root\" JSON key path\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Found object's URI by \"root\" JSON key path");
         } /* end else */
     }     /* end else */
 
@@ -2078,10 +5682,8 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
         H5I_DATATYPE != parent_obj->obj_type && H5I_DATASET != parent_obj->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "parent object not a file, group, datatype or dataset");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Finding object by path '%s' from parent object of type %s with URI %s\n\n", obj_path,
-           object_type_to_string(parent_obj->obj_type), parent_obj->URI);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Finding object by path '%s' from parent object of type %s with URI %s",
+                 obj_path, object_type_to_string(parent_obj->obj_type), parent_obj->URI);
 
     version = parent_obj->domain->u.file.server_info.version;
 
@@ -2095,9 +5697,8 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
          * the information about the current object and supply it to the optional callback.
          */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Path provided was '.', short-circuiting to GET request and callback function\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                     "Path provided was '.', short-circuiting to GET request and callback function");
 
         *target_object_type = parent_obj->obj_type;
         is_relative_path    = TRUE;
@@ -2107,9 +5708,8 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
          * information about the root group and supply it to the optional callback.
          */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Path provided was '/', short-circuiting to GET request and callback function\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                     "Path provided was '/', short-circuiting to GET request and callback function");
 
         *target_object_type = H5I_GROUP;
         is_relative_path    = FALSE;
@@ -2175,9 +5775,7 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
             char   *pobj_URI = parent_obj->URI;
             char    temp_URI[URI_MAX_LENGTH];
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Unknown target object type; retrieving object type\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Unknown target object type; retrieving object type");
             /* In case the user specified a path which contains multiple groups on the way to the
              * one which the object in question should be under, extract out the path to the final
              * group in the chain */
@@ -2185,9 +5783,7 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get path dirname");
             empty_dirname = !strcmp(path_dirname, "");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Retrieving URI for final group in path chain\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Retrieving URI for final group in path chain");
             if (!empty_dirname) {
                 H5I_type_t obj_type = H5I_GROUP;
 
@@ -2281,14 +5877,15 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
 
         if ((http_response = RV_curl_post(curl, &parent_obj->domain->u.file.server_info, request_endpoint,
                                           parent_obj->domain->u.file.filepath_name, request_body,
-                                          (size_t)bytes_printed, CONTENT_TYPE_JSON)) < 0)
+                                          (size_t)bytes_printed, CONTENT_TYPE_JSON, "object lookup")) < 0)
             FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL,
                             "internal failure while making POST request to server");
     }
     else {
 
         if ((http_response = RV_curl_get(curl, &parent_obj->domain->u.file.server_info, request_endpoint,
-                                         parent_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON)) < 0)
+                                         parent_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                         "object lookup")) < 0)
             FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL,
                             "internal failure while making GET request to server");
     }
@@ -2298,9 +5895,7 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
     else
         HANDLE_RESPONSE(http_response, H5E_ATTR, H5E_CANTGET, FAIL);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Object %s\n\n", ret_value ? "found" : "not found");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object %s", ret_value ? "found" : "not found");
 
     if (SERVER_VERSION_MATCHES_OR_EXCEEDS(version, 0, 8, 0)) {
 
@@ -2318,9 +5913,7 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link type");
 
             if (H5L_TYPE_HARD == link_info.type) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link was a hard link; retrieving target object's info\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link was a hard link; retrieving target object's info");
                 if (RV_parse_response(response_buffer.buffer, NULL, target_object_type,
                                       RV_get_link_obj_type_callback) < 0)
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL,
@@ -2329,10 +5922,8 @@ RV_find_object_by_path(RV_object_t *parent_obj, const char *obj_path, H5I_type_t
             else {
                 size_t link_val_len = 0;
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link was a %s link; retrieving link's value\n\n",
-                       H5L_TYPE_SOFT == link_info.type ? "soft" : "external");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link was a %s link; retrieving link's value",
+                             H5L_TYPE_SOFT == link_info.type ? "soft" : "external");
 
                 get_link_val_out get_link_val_args;
                 get_link_val_args.in_buf_size = &link_val_len;
@@ -2504,9 +6095,7 @@ RV_copy_object_loc_info_callback(char *HTTP_response, const void *callback_data_
     RV_object_t  found_domain;
     RV_object_t *new_domain = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving object's creation properties from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Retrieving object's creation properties from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -2613,6 +6202,7 @@ RV_copy_object_loc_info_callback(char *HTTP_response, const void *callback_data_
         new_domain->u.file.fapl_id             = H5Pcopy(loc_info_out->domain->u.file.fapl_id);
         new_domain->u.file.fcpl_id             = H5Pcopy(loc_info_out->domain->u.file.fcpl_id);
         new_domain->u.file.ref_count           = 1;
+        new_domain->u.file.deferred_create     = FALSE;
         new_domain->u.file.server_info.version = found_domain.u.file.server_info.version;
 
         /* Allocate root "path" on heap for consistency with other RV_object_t types */
@@ -2862,9 +6452,7 @@ RV_parse_dataspace(char *space)
     const char *path_name      = NULL;
     hid_t       ret_value      = FAIL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Parsing dataspace from HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Parsing dataspace from HTTP response");
 
     if (!space)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace string buffer was NULL");
@@ -2901,17 +6489,13 @@ RV_parse_dataspace(char *space)
 
     /* Create the appropriate type of Dataspace */
     if (!strcmp(dataspace_type, "H5S_NULL")) {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> NULL dataspace\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "NULL dataspace");
 
         if ((dataspace = H5Screate(H5S_NULL)) < 0)
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create null dataspace");
     } /* end if */
     else if (!strcmp(dataspace_type, "H5S_SCALAR")) {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> SCALAR dataspace\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "SCALAR dataspace");
 
         if ((dataspace = H5Screate(H5S_SCALAR)) < 0)
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create scalar dataspace");
@@ -2921,9 +6505,7 @@ RV_parse_dataspace(char *space)
         hbool_t  maxdims_specified = TRUE;
         size_t   i;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> SIMPLE dataspace\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "SIMPLE dataspace");
 
         if (NULL == (dims_obj = yajl_tree_get(target_tree, dataspace_dims_keys, yajl_t_array)))
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_PARSEERROR, FAIL, "can't retrieve dataspace dims");
@@ -2959,25 +6541,16 @@ RV_parse_dataspace(char *space)
             } /* end if */
         }     /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Creating simple dataspace\n");
-        printf("-> Dims: [ ");
-        for (i = 0; i < dims_obj->u.array.len; i++) {
-            if (i > 0)
-                printf(", ");
-            printf("%" PRIuHSIZE, space_dims[i]);
-        }
-        printf(" ]\n\n");
-        if (maxdims_specified) {
-            printf("-> MaxDims: [ ");
-            for (i = 0; i < maxdims_obj->u.array.len; i++) {
-                if (i > 0)
-                    printf(", ");
-                printf("%" PRIuHSIZE, space_maxdims[i]);
-            }
-            printf(" ]\n\n");
-        }
-#endif
+        if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+            char dims_string[RV_LOG_DIMS_STRING_MAX];
+
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Creating simple dataspace with dims %s",
+                         RV_log_dims(space_dims, dims_obj->u.array.len, dims_string, sizeof(dims_string)));
+            if (maxdims_specified)
+                RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Simple dataspace maximum dims %s",
+                             RV_log_dims(space_maxdims, maxdims_obj->u.array.len, dims_string,
+                                         sizeof(dims_string)));
+        } /* end if */
 
         if ((dataspace = H5Screate_simple((int)dims_obj->u.array.len, space_dims, space_maxdims)) < 0)
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create simple dataspace");
@@ -3021,9 +6594,7 @@ RV_convert_dataspace_shape_to_JSON(hid_t space_id, char **shape_body, char **max
     char       *maxdims_out_string = NULL;
     herr_t      ret_value          = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting dataspace to JSON representation\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Converting dataspace to JSON representation");
 
     if (H5S_NO_CLASS == (space_type = H5Sget_simple_extent_type(space_id)))
         FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "invalid dataspace");
@@ -3194,12 +6765,12 @@ done:
         if (maxdims_body)
             *maxdims_body = maxdims_out_string;
 
-#ifdef RV_CONNECTOR_DEBUG
-        if (shape_out_string)
-            printf("-> Dataspace dimensions:\n%s\n\n", shape_out_string);
-        if (maxdims_out_string)
-            printf("-> Dataspace maximum dimensions:\n%s\n\n", maxdims_out_string);
-#endif
+        if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_TRACE)) {
+            if (shape_out_string)
+                RV_LOG_TRACE(RV_LOG_CAT_DATASET, "Dataspace dimensions:\n%s", shape_out_string);
+            if (maxdims_out_string)
+                RV_LOG_TRACE(RV_LOG_CAT_DATASET, "Dataspace maximum dimensions:\n%s", maxdims_out_string);
+        } /* end if */
     } /* end if */
     else {
         if (maxdims_out_string)
@@ -3462,9 +7033,7 @@ RV_parse_server_version(char *HTTP_response, const void *callback_data_in, void
     char *saveptr;
     int   numeric_version_field = 0;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving server version from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_CONNECTOR, "Retrieving server version from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -3510,6 +7079,12 @@ RV_parse_server_version(char *HTTP_response, const void *callback_data_in, void
 
     server_version->patch = (size_t)numeric_version_field;
 
+    /* Binary point writes are optional, and only used if the server advertises them */
+    if (NULL != (key_obj = yajl_tree_get(parse_tree, server_binary_point_write_keys, yajl_t_any)))
+        server_version->binary_point_write = YAJL_IS_TRUE(key_obj);
+    else
+        server_version->binary_point_write = FALSE;
+
 done:
     if (parse_tree)
         yajl_tree_free(parse_tree);
@@ -3525,9 +7100,7 @@ RV_parse_allocated_size_cb(char *HTTP_response, void *callback_data_in, void *ca
     herr_t   ret_value      = SUCCEED;
     size_t  *allocated_size = (size_t *)callback_data_out;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving allocated size from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Retrieving allocated size from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -3634,6 +7207,46 @@ done:
     return ret_value;
 }
 
+/* Writes are PUT requests; reads are POST requests for point selections and GET otherwise */
+static const char *
+RV_dataset_transfer_method(const dataset_transfer_info *transfer_info)
+{
+    if (transfer_info->transfer_type == WRITE)
+        return "PUT";
+
+    return (H5S_SEL_POINTS == transfer_info->u.read_info.sel_type) ? "POST" : "GET";
+} /* end RV_dataset_transfer_method() */
+
+/* Describes the request a dataset transfer makes, for transports which serve requests in process. The
+ * content type of the body is taken from the transfer's headers. */
+static void
+RV_dataset_transfer_request(const dataset_transfer_info *transfer_info, RV_request_t *request)
+{
+    memset(request, 0, sizeof(*request));
+
+    request->method = RV_dataset_transfer_method(transfer_info);
+    request->url    = transfer_info->request_url;
+    request->domain = transfer_info->dataset->domain->u.file.filepath_name;
+
+    for (const struct curl_slist *header = transfer_info->curl_headers; header; header = header->next)
+        if (!strncmp(header->data, "Content-Type: ", strlen("Content-Type: ")))
+            request->content_type = header->data + strlen("Content-Type: ");
+
+    if (transfer_info->transfer_type == WRITE) {
+        request->body      = transfer_info->u.write_info.uinfo.buffer;
+        request->body_size = transfer_info->u.write_info.uinfo.buffer_size;
+    }
+    else if (transfer_info->raw_chunk) {
+        /* A chunk's filter mask is returned in a response header */
+        request->header_cb   = RV_dataset_chunk_header_cb;
+        request->header_data = (void *)&transfer_info->u.read_info.filter_mask;
+    }
+    else if (H5S_SEL_POINTS == transfer_info->u.read_info.sel_type) {
+        request->body      = transfer_info->selection_body;
+        request->body_size = (size_t)transfer_info->u.read_info.post_len;
+    }
+} /* end RV_dataset_transfer_request() */
+
 herr_t
 RV_curl_multi_perform(CURL *curl_multi_handle, dataset_transfer_info *transfer_info, size_t count)
 {
@@ -3657,6 +7270,10 @@ RV_curl_multi_perform(CURL *curl_multi_handle, dataset_transfer_info *transfer_i
     struct timeval timeout;
     hid_t          vlen_buf_space = H5I_INVALID_HID;
 
+    /* Objects created before this transfer must exist on the server first */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
+
     if ((failed_handles_to_retry = calloc(count, sizeof(CURL *))) == NULL)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                         "can't allocate space for cURL headers to be retried");
@@ -3678,45 +7295,111 @@ RV_curl_multi_perform(CURL *curl_multi_handle, dataset_transfer_info *transfer_i
         timeout.tv_sec  = 0;
         timeout.tv_usec = 0;
 
-        if (CURLM_OK != curl_multi_timeout(curl_multi_handle, &timeout_ms))
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get curl timeout");
+        if (RV_serving_in_process()) {
+            /* Serve every transfer in flight in process, as if they all finished together.
+             * Transfers waiting to be retried are still running, and are served once re-added. */
+            RV_served_begin_round();
+            num_still_running = 0;
+
+            for (size_t i = 0; i < count; i++) {
+                RV_request_t request;
+
+                if (!transfer_info[i].curl_easy_handle)
+                    continue;
+
+                num_still_running++;
+
+                if (failed_handles_to_retry[i])
+                    continue;
+
+                if (RV_replay_file_g) {
+                    if (RV_replay_serve(transfer_info[i].curl_easy_handle,
+                                        RV_dataset_transfer_method(&transfer_info[i]),
+                                        transfer_info[i].request_url, &transfer_info[i].resp_buffer,
+                                        TRUE) < 0)
+                        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't replay dataset transfer");
+
+                    continue;
+                }
+
+                RV_dataset_transfer_request(&transfer_info[i], &request);
+
+                if (RV_transport_serve(transfer_info[i].curl_easy_handle, &request,
+                                       &transfer_info[i].resp_buffer, TRUE) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't serve dataset transfer");
+            }
+
+            RV_replay_end_round();
+        }
+        else {
+            if (CURLM_OK != curl_multi_timeout(curl_multi_handle, &timeout_ms))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get curl timeout");
 
-        timeout_ms = ((timeout_ms < 0) || (timeout_ms > DEFAULT_POLL_TIMEOUT_MS)) ? DEFAULT_POLL_TIMEOUT_MS
-                                                                                  : timeout_ms;
+            timeout_ms = ((timeout_ms < 0) || (timeout_ms > DEFAULT_POLL_TIMEOUT_MS))
+                             ? DEFAULT_POLL_TIMEOUT_MS
+                             : timeout_ms;
 
-        timeout.tv_sec  = timeout_ms / 1000;
-        timeout.tv_usec = (timeout_ms % 1000) * 1000;
+            timeout.tv_sec  = timeout_ms / 1000;
+            timeout.tv_usec = (timeout_ms % 1000) * 1000;
 
-        FD_ZERO(&fdread);
-        FD_ZERO(&fdwrite);
-        FD_ZERO(&fdexcep);
+            FD_ZERO(&fdread);
+            FD_ZERO(&fdwrite);
+            FD_ZERO(&fdexcep);
 
-        if (CURLM_OK != curl_multi_fdset(curl_multi_handle, &fdread, &fdwrite, &fdexcep, &maxfd))
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get curl fd set");
+            if (CURLM_OK != curl_multi_fdset(curl_multi_handle, &fdread, &fdwrite, &fdexcep, &maxfd))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get curl fd set");
 
-        if (maxfd != -1)
-            select(maxfd + 1, &fdread, &fdwrite, &fdexcep, &timeout);
+            if (maxfd != -1)
+                select(maxfd + 1, &fdread, &fdwrite, &fdexcep, &timeout);
 
-        if (CURLM_OK != curl_multi_perform(curl_multi_handle, &num_still_running))
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "cURL multi perform error");
+            if (CURLM_OK != curl_multi_perform(curl_multi_handle, &num_still_running))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "cURL multi perform error");
+        }
 
-        while ((num_prev_running != num_still_running) &&
-               (curl_multi_msg = curl_multi_info_read(curl_multi_handle, &num_curlm_msgs))) {
-            long response_code;
+        while ((RV_serving_in_process() || num_prev_running != num_still_running) &&
+               (curl_multi_msg = RV_curl_multi_info_read(curl_multi_handle, &num_curlm_msgs))) {
+            long        response_code;
+            const char *trace_method    = NULL;
+            const char *trace_operation = NULL;
 
             if (curl_multi_msg && (curl_multi_msg->msg == CURLMSG_DONE)) {
-                if (CURLE_OK !=
-                    curl_easy_getinfo(curl_multi_msg->easy_handle, CURLINFO_RESPONSE_CODE, &response_code))
+                if (RV_curl_get_response_code(curl_multi_msg->easy_handle, &response_code) < 0)
                     FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't get HTTP response code");
 
+                if (RV_get_index_of_matching_handle(transfer_info, count, curl_multi_msg->easy_handle,
+                                                    &handle_index) < 0 ||
+                    handle_index >= count)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't get handle information");
+
+                trace_method = RV_dataset_transfer_method(&transfer_info[handle_index]);
+                if (transfer_info[handle_index].raw_chunk)
+                    trace_operation = (transfer_info[handle_index].transfer_type == WRITE) ? "H5Dwrite_chunk"
+                                                                                           : "H5Dread_chunk";
+                else
+                    trace_operation =
+                        (transfer_info[handle_index].transfer_type == WRITE) ? "H5Dwrite" : "H5Dread";
+
+                if (RV_trace_request(curl_multi_msg->easy_handle, trace_method, trace_operation,
+                                     transfer_info[handle_index].dataset->domain->u.file.filepath_name,
+                                     handle_index + 1, transfer_info[handle_index].num_retries) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't trace dataset transfer");
+
+                if (RV_stats_record_request(curl_multi_msg->easy_handle,
+                                            (transfer_info[handle_index].transfer_type == WRITE)
+                                                ? H5REST_OP_DATASET_WRITE
+                                                : H5REST_OP_DATASET_READ) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL,
+                                    "can't count dataset transfer in metrics");
+
+                if (RV_capture_request(curl_multi_msg->easy_handle, trace_method,
+                                       transfer_info[handle_index].request_url, RV_CAPTURE_STREAM_MULTI,
+                                       &transfer_info[handle_index].resp_buffer) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't record dataset transfer");
+
                 /* Gracefully handle 503 Error, which can result from sending too many simultaneous
                  * requests */
                 if (response_code == 503) {
-
-                    if (RV_get_index_of_matching_handle(transfer_info, count, curl_multi_msg->easy_handle,
-                                                        &handle_index) < 0)
-                        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL,
-                                        "can't get handle information for retry");
+                    transfer_info[handle_index].num_retries++;
 
                     /* Restart request next time for writes */
                     if (transfer_info[handle_index].transfer_type == WRITE)
@@ -3749,27 +7432,33 @@ RV_curl_multi_perform(CURL *curl_multi_handle, dataset_transfer_info *transfer_i
                     if (transfer_info[handle_index].current_backoff_duration >= BACKOFF_MAX_BEFORE_FAIL)
                         FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL,
                                         "Unable to reach server for write: 503 service unavailable");
+
+                    RV_stats_record_retry((transfer_info[handle_index].transfer_type == WRITE)
+                                              ? H5REST_OP_DATASET_WRITE
+                                              : H5REST_OP_DATASET_READ,
+                                          (uint64_t)transfer_info[handle_index].current_backoff_duration);
                     fail_count++;
                 }
-                else if (response_code == 200) {
+                else if (response_code == 200 || response_code == 201) {
                     H5T_class_t dtype_class = H5T_NO_CLASS;
 
                     num_finished++;
                     succeed_count++;
 
-                    if (RV_get_index_of_matching_handle(transfer_info, count, curl_multi_msg->easy_handle,
-                                                        &handle_index) < 0)
-                        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL,
-                                        "can't get handle information for retry");
-
                     switch (transfer_info[handle_index].transfer_type) {
                         case (READ):
-                            if (RV_dataset_read_cb(transfer_info[handle_index].mem_type_id,
-                                                   transfer_info[handle_index].mem_space_id,
-                                                   transfer_info[handle_index].file_type_id,
-                                                   transfer_info[handle_index].file_space_id,
-                                                   transfer_info[handle_index].u.read_info.buf,
-                                                   transfer_info[handle_index].resp_buffer) < 0)
+                            if (transfer_info[handle_index].raw_chunk) {
+                                if (RV_dataset_read_chunk_cb(&transfer_info[handle_index].u.read_info,
+                                                             transfer_info[handle_index].resp_buffer) < 0)
+                                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL,
+                                                    "failed to copy out chunk read from dataset");
+                            }
+                            else if (RV_dataset_read_cb(transfer_info[handle_index].mem_type_id,
+                                                        transfer_info[handle_index].mem_space_id,
+                                                        transfer_info[handle_index].file_type_id,
+                                                        transfer_info[handle_index].file_space_id,
+                                                        transfer_info[handle_index].u.read_info.buf,
+                                                        transfer_info[handle_index].resp_buffer) < 0)
                                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL,
                                                 "failed to post-process data read from dataset");
                             break;
@@ -3877,6 +7566,10 @@ RV_curl_multi_perform(CURL *curl_multi_handle, dataset_transfer_info *transfer_i
         for (size_t i = 0; i < count; i++) {
             if (failed_handles_to_retry[i] && ((curr_time_us - transfer_info[i].time_of_fail) >=
                                                transfer_info[i].current_backoff_duration)) {
+                /* Send the retry to a different local server node, if there are several */
+                if (RV_set_socket_path(failed_handles_to_retry[i]) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set socket path for retry");
+
                 if (CURLM_OK != curl_multi_add_handle(curl_multi_handle, failed_handles_to_retry[i]))
                     FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to re-add denied cURL handle");
 
@@ -3993,6 +7686,45 @@ H5_rest_compare_string_keys(void *value1, void *value2)
     return !strcmp(val1, val2);
 } /* end H5_rest_compare_string_keys() */
 
+/*-------------------------------------------------------------------------
+ * Function:    RV_type_info_insert
+ *
+ * Purpose:     Records an open object in the table of open objects of its
+ *              type, keyed by the object's URI. The table, and the entry
+ *              for the type in the global type info array, are created
+ *              when the first object of that type is opened, since only a
+ *              handful of the possible ID types are ever used.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_type_info_insert(H5I_type_t obj_type, RV_object_t *object)
+{
+    RV_type_info *type_info = NULL;
+    herr_t        ret_value = SUCCEED;
+
+    if (obj_type <= H5I_BADID || obj_type >= H5I_MAX_NUM_TYPES)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid object type");
+
+    if (NULL == (type_info = RV_type_info_array_g[obj_type])) {
+        if (NULL == (type_info = RV_calloc(sizeof(RV_type_info))))
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type info");
+
+        if (NULL == (type_info->table = rv_hash_table_new(rv_hash_string, H5_rest_compare_string_keys))) {
+            RV_free(type_info);
+            FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate table of open objects");
+        }
+
+        RV_type_info_array_g[obj_type] = type_info;
+    }
+
+    if (rv_hash_table_insert(type_info->table, (char *)object->URI, (char *)object) == 0)
+        FUNC_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't add object to table of open objects");
+
+done:
+    return ret_value;
+} /* end RV_type_info_insert() */
+
 /*-------------------------------------------------------------------------
  * Function:    RV_free_visited_link_hash_table_key
  *
@@ -4096,10 +7828,11 @@ done:
 }
 
 /* Helper function to perform a DELETE request to an endpoint on a server.
- * Request endpoint must contain a leading slash. */
+ * Request endpoint must contain a leading slash. The operation names the
+ * HDF5 call which made the request in the request trace. */
 long
 RV_curl_delete(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-               const char *filename)
+               const char *filename, const char *operation)
 {
     long   ret_value       = FAIL;
     size_t host_header_len = 0;
@@ -4108,6 +7841,11 @@ RV_curl_delete(CURL *curl_handle, server_info_t *server_info, const char *reques
     char               request_url[URL_MAX_LENGTH];
     int                url_len            = 0;
     struct curl_slist *curl_headers_local = NULL;
+    RV_request_t       request            = {0};
+
+    /* Make sure that any queued objects this request may refer to have been created */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
 
     /* Setup the host header */
     host_header_len = strlen(filename) + strlen(host_string) + 1;
@@ -4141,19 +7879,25 @@ RV_curl_delete(CURL *curl_handle, server_info_t *server_info, const char *reques
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_CUSTOMREQUEST, "DELETE"))
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTSET, FAIL, "can't set up cURL to make HTTP DELETE request: %s",
                         curl_err_buf);
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Deleting object at URL: %s\n\n", request_url);
+    RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Deleting object at URL: %s", request_url);
 
-    printf("   /*************************************\\\n");
-    printf("-> | Making DELETE request to the server |\n");
-    printf("   \\*************************************/\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Making DELETE request to the server");
+
+    request.method = "DELETE";
+    request.url    = request_url;
+    request.domain = filename;
 
-    CURL_PERFORM_NO_ERR(curl_handle, FAIL);
+    CURL_PERFORM_NO_ERR(curl_handle, &request, FAIL);
 
-    if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &ret_value))
+    if (RV_curl_get_response_code(curl_handle, &ret_value) < 0)
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, ret_value, "can't get HTTP response code");
 
+    if (RV_trace_request(curl_handle, "DELETE", operation, filename, 0, 0) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't trace DELETE request");
+
+    if (RV_stats_record_request(curl_handle, H5REST_OP_DELETE) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't count DELETE request in metrics");
+
 done:
 
     /* Reset custom request */
@@ -4172,10 +7916,11 @@ done:
 }
 
 /* Helper function to perform a PUT request to an endpoint on a server.
- * Request endpoint must contain a leading slash. */
+ * Request endpoint must contain a leading slash. The operation names the
+ * HDF5 call which made the request in the request trace. */
 long
 RV_curl_put(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint, const char *filename,
-            upload_info *uinfo, content_type_t content_type)
+            upload_info *uinfo, content_type_t content_type, const char *operation)
 {
     long   ret_value       = FAIL;
     size_t host_header_len = 0;
@@ -4184,6 +7929,11 @@ RV_curl_put(CURL *curl_handle, server_info_t *server_info, const char *request_e
     char               request_url[URL_MAX_LENGTH];
     int                url_len            = 0;
     struct curl_slist *curl_headers_local = NULL;
+    RV_request_t       request            = {0};
+
+    /* Make sure that any queued objects this request may refer to have been created */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
 
     /* Setup the host header */
     host_header_len = strlen(filename) + strlen(host_string) + 1;
@@ -4243,17 +7993,27 @@ RV_curl_put(CURL *curl_handle, server_info_t *server_info, const char *request_e
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_URL, request_url))
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("   /**********************************\\\n");
-    printf("-> | Making PUT request to the server |\n");
-    printf("   \\**********************************/\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Making PUT request to the server");
 
-    CURL_PERFORM_NO_ERR(curl_handle, FAIL);
+    request.method       = "PUT";
+    request.url          = request_url;
+    request.domain       = filename;
+    request.content_type =
+        (content_type == CONTENT_TYPE_JSON) ? "application/json" : "application/octet-stream";
+    request.body         = uinfo ? uinfo->buffer : NULL;
+    request.body_size    = uinfo ? uinfo->buffer_size : 0;
 
-    if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &ret_value))
+    CURL_PERFORM_NO_ERR(curl_handle, &request, FAIL);
+
+    if (RV_curl_get_response_code(curl_handle, &ret_value) < 0)
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, ret_value, "can't get HTTP response code");
 
+    if (RV_trace_request(curl_handle, "PUT", operation, filename, 0, 0) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't trace PUT request");
+
+    if (RV_stats_record_request(curl_handle, H5REST_OP_PUT) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't count PUT request in metrics");
+
 done:
 
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_UPLOAD, 0))
@@ -4271,18 +8031,24 @@ done:
 }
 
 /* Helper function to perform a GET request to an endpoint on a server.
- * Request endpoint must contain a leading slash. */
+ * Request endpoint must contain a leading slash. The operation names the
+ * HDF5 call which made the request in the request trace. */
 long
 RV_curl_get(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint, const char *filename,
-            content_type_t content_type)
+            content_type_t content_type, const char *operation)
 {
-    herr_t ret_value       = FAIL;
+    long   ret_value       = FAIL;
     size_t host_header_len = 0;
 
     char              *host_header = NULL;
     char               request_url[URL_MAX_LENGTH];
     int                url_len            = 0;
     struct curl_slist *curl_headers_local = NULL;
+    RV_request_t       request            = {0};
+
+    /* Make sure that any queued objects this request may refer to have been created */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
 
     /* Setup the host header */
     host_header_len = strlen(filename) + strlen(host_string) + 1;
@@ -4326,17 +8092,23 @@ RV_curl_get(CURL *curl_handle, server_info_t *server_info, const char *request_e
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_URL, request_url))
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("   /**********************************\\\n");
-    printf("-> | Making GET request to the server |\n");
-    printf("   \\**********************************/\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Making GET request to the server");
 
-    CURL_PERFORM_NO_ERR(curl_handle, FAIL);
+    request.method = "GET";
+    request.url    = request_url;
+    request.domain = filename;
 
-    if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &ret_value))
+    CURL_PERFORM_NO_ERR(curl_handle, &request, FAIL);
+
+    if (RV_curl_get_response_code(curl_handle, &ret_value) < 0)
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't get HTTP response code");
 
+    if (RV_trace_request(curl_handle, "GET", operation, filename, 0, 0) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't trace GET request");
+
+    if (RV_stats_record_request(curl_handle, H5REST_OP_GET) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't count GET request in metrics");
+
 done:
 
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_HTTPGET, 0))
@@ -4355,20 +8127,27 @@ done:
 }
 
 /* Helper function to perform a POST request to an endpoint on a server.
- * Request endpoint must contain a leading slash. */
+ * Request endpoint must contain a leading slash. The operation names the
+ * HDF5 call which made the request in the request trace. */
 long
 RV_curl_post(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-             const char *filename, const char *post_data, size_t data_size, content_type_t content_type)
+             const char *filename, const char *post_data, size_t data_size, content_type_t content_type,
+             const char *operation)
 {
-    herr_t ret_value       = FAIL;
+    long   ret_value       = FAIL;
     size_t host_header_len = 0;
 
     char              *host_header = NULL;
     char               request_url[URL_MAX_LENGTH];
     int                url_len            = 0;
     struct curl_slist *curl_headers_local = NULL;
+    RV_request_t       request            = {0};
     curl_off_t         _data_size;
 
+    /* Make sure that any queued objects this request may refer to have been created */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
+
     /* Setup the host header */
     host_header_len = strlen(filename) + strlen(host_string) + 1;
     if (NULL == (host_header = (char *)RV_malloc(host_header_len)))
@@ -4424,17 +8203,27 @@ RV_curl_post(CURL *curl_handle, server_info_t *server_info, const char *request_
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_URL, request_url))
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("   /**********************************\\\n");
-    printf("-> | Making POST request to the server |\n");
-    printf("   \\**********************************/\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Making POST request to the server");
 
-    CURL_PERFORM_NO_ERR(curl_handle, FAIL);
+    /* The content type only sets what is accepted in response; the request body is always JSON */
+    request.method       = "POST";
+    request.url          = request_url;
+    request.domain       = filename;
+    request.content_type = "application/json";
+    request.body         = post_data;
+    request.body_size    = data_size;
 
-    if (CURLE_OK != curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &ret_value))
+    CURL_PERFORM_NO_ERR(curl_handle, &request, FAIL);
+
+    if (RV_curl_get_response_code(curl_handle, &ret_value) < 0)
         FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, ret_value, "can't get HTTP response code");
 
+    if (RV_trace_request(curl_handle, "POST", operation, filename, 0, 0) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't trace POST request");
+
+    if (RV_stats_record_request(curl_handle, H5REST_OP_POST) < 0)
+        FUNC_GOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't count POST request in metrics");
+
 done:
 
     if (CURLE_OK != curl_easy_setopt(curl_handle, CURLOPT_POST, 0))
@@ -4471,9 +8260,7 @@ RV_parse_domain_allocated_size_cb(char *HTTP_response, const void *callback_data
     size_t  *filesize  = (size_t *)callback_data_out;
     herr_t   ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving filesize from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Retrieving filesize from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
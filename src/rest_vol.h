@@ -38,6 +38,7 @@
 #include "rest_vol_config.h"   /* Defines for enabling debugging functionality in the REST VOL */
 #include "util/rest_vol_err.h" /* REST VOL error reporting macros */
 #include "util/rest_vol_mem.h" /* REST VOL memory management functions */
+#include "util/rest_vol_log.h" /* REST VOL logging macros */
 
 #include "rest_vol_attr.h"
 #include "rest_vol_dataset.h"
@@ -51,9 +52,7 @@
 #include "util/rest_vol_hash_string.h"
 #include "util/rest_vol_hash_table.h"
 
-#ifdef RV_CONNECTOR_DEBUG
-#include "rest_vol_debug.h" /* REST VOL debugging functions */
-#endif
+#include "rest_vol_debug.h" /* Helpers to convert HDF5 values to strings for log messages */
 
 /* Version number of the REST VOL connector's struct */
 #define HDF5_VOL_REST_VERSION 3
@@ -68,6 +67,92 @@
 
 #define UNIX_SOCKET_PREFIX "http+unix"
 
+/* Prefix of an HSDS_ENDPOINT which selects the local transport. Instead of being
+ * sent to a server, requests are then served in process from a store kept in the
+ * directory following the prefix, or in memory only if no directory is given. */
+#define LOCAL_STORE_PREFIX "local://"
+
+/* Socket paths used when HSDS_SOCKET_PATHS is not set. The pattern is tried
+ * first, so that traffic is spread across all local HSDS service nodes. */
+#define DEFAULT_SOCKET_PATH         "/tmp/hs/sn_1.sock"
+#define DEFAULT_SOCKET_PATH_PATTERN "/tmp/hs/sn_*.sock"
+
+/* Environment variables which enable request tracing. Each request made to the
+ * server is recorded to the trace file in the selected format, which is either
+ * "json" (one JSON object per line, the default) or "chrome" (Chrome trace
+ * event format, viewable in chrome://tracing or Perfetto). */
+#define TRACE_FILE_ENV_VAR   "HSDS_TRACE_FILE"
+#define TRACE_FORMAT_ENV_VAR "HSDS_TRACE_FORMAT"
+
+/* Environment variable naming a file that the request metrics are written to,
+ * as JSON, when the connector is terminated. A value of "-" writes them to
+ * stderr instead. */
+#define STATS_FILE_ENV_VAR "HSDS_STATS_FILE"
+
+/* Environment variables for recording requests and their responses to a capture
+ * file, and for replaying a capture instead of sending requests to the server.
+ * Replayed responses are served immediately unless HSDS_REPLAY_LATENCY is set to
+ * "original", in which case the recorded latency of each request is reproduced.
+ * Response bodies larger than CAPTURE_INLINE_BODY_MAX bytes are not stored in
+ * the capture file itself, but appended to a data file with the same name plus
+ * CAPTURE_DATA_FILE_SUFFIX and referred to by offset. */
+#define CAPTURE_FILE_ENV_VAR     "HSDS_CAPTURE_FILE"
+#define REPLAY_FILE_ENV_VAR      "HSDS_REPLAY_FILE"
+#define REPLAY_LATENCY_ENV_VAR   "HSDS_REPLAY_LATENCY"
+#define CAPTURE_DATA_FILE_SUFFIX ".data"
+#define CAPTURE_INLINE_BODY_MAX  65536
+
+/* Environment variables for the Active Directory token endpoint's base URL,
+ * for how many seconds before an access token expires it is refreshed, and
+ * for how many seconds to wait before retrying a failed refresh */
+#define AD_AUTHORITY_ENV_VAR      "HSDS_AD_AUTHORITY"
+#define AD_REFRESH_MARGIN_ENV_VAR "HSDS_AD_REFRESH_MARGIN"
+#define AD_REFRESH_RETRY_ENV_VAR  "HSDS_AD_REFRESH_RETRY"
+#define DEFAULT_AD_AUTHORITY      "https://login.microsoftonline.com"
+#define DEFAULT_AD_REFRESH_MARGIN 300
+
+/* Maximum number of connections a cURL multi handle makes to the server at once */
+#define NUM_MAX_HOST_CONNS 10
+
+/* Default seconds to wait before retrying a failed access token refresh */
+#define DEFAULT_AD_REFRESH_RETRY 30
+
+/* Name of the FAPL property which enables deferred object creation */
+#define DEFERRED_CREATE_PROP_NAME "rest_vol_deferred_create"
+
+/* Number of deferred object creation requests which may be queued before they
+ * are sent to the server */
+#define DEFERRED_CREATE_QUEUE_MAX 256
+
+/* Name of the DAPL property which sets the size of a dataset's write-back buffer */
+#define WRITE_BUFFER_PROP_NAME "rest_vol_write_buffer_size"
+
+/* Names of the DAPL properties which set how many blocks ahead of a sequential scan of a
+ * dataset are read, and how much memory those blocks may take up */
+#define READ_AHEAD_DEPTH_PROP_NAME "rest_vol_read_ahead_depth"
+#define READ_AHEAD_SIZE_PROP_NAME  "rest_vol_read_ahead_size"
+
+/* Number of consecutive reads of a dataset which must advance by the same distance
+ * before they are taken to be a sequential scan */
+#define READ_AHEAD_MIN_SEQUENTIAL_READS 3
+
+/* Number of bytes which cost as much to transfer as one more request to the server, when
+ * deciding whether to merge batched reads of a dataset into a read of their bounding box */
+#define READ_BATCH_ROUND_TRIP_SIZE (256 * 1024)
+
+/* Response header, and query parameter, carrying the filter mask of a chunk
+ * transferred as the bytes it is stored as */
+#define CHUNK_FILTER_MASK_HEADER "X-Filter-Mask:"
+#define CHUNK_FILTER_MASK_QUERY  "filter_mask="
+
+/* Query parameter giving the number of points in a binary point selection write,
+ * which tells the server that the body starts with their packed coordinates */
+#define POINT_COUNT_QUERY "points="
+
+/* Name of the FAPL property which sets how old, in seconds, the storage sizes
+ * of datasets returned by the server may be */
+#define STORAGE_SIZE_MAX_AGE_PROP_NAME "rest_vol_storage_size_max_age"
+
 /* Defines for the use of HTTP status codes */
 #define HTTP_INFORMATIONAL_MIN 100 /* Minimum and maximum values for the 100 class of */
 #define HTTP_INFORMATIONAL_MAX 199 /* HTTP information responses */
@@ -157,12 +242,21 @@
 
 /* Macro to perform cURL operation and handle errors. Note that
  * this macro should not generally be called directly. Use one
- * of the below macros to call this with the appropriate arguments. */
-#define CURL_PERFORM_INTERNAL(curl_ptr, handle_HTTP_response, ERR_MAJOR, ERR_MINOR, ret_value)               \
+ * of the below macros to call this with the appropriate arguments.
+ * The request describes the same request as the cURL handle, for
+ * transports which serve requests in process, and is NULL for
+ * requests which can only be sent to a server. */
+#define CURL_PERFORM_INTERNAL(curl_ptr, request, handle_HTTP_response, ERR_MAJOR, ERR_MINOR, ret_value)      \
     do {                                                                                                     \
-        CURLcode result = curl_easy_perform(curl_ptr);                                                       \
+        CURLcode result;                                                                                     \
+                                                                                                             \
+        if (RV_refresh_access_token() < 0)                                                                   \
+            FUNC_GOTO_ERROR(ERR_MAJOR, ERR_MINOR, ret_value, "can't refresh access token");                  \
+                                                                                                             \
+        result = RV_curl_easy_perform(curl_ptr, request, &response_buffer);                                  \
                                                                                                              \
         /* Reset the cURL response buffer write position pointer */                                          \
+        response_buffer.data_size    = (size_t)(response_buffer.curr_buf_ptr - response_buffer.buffer);      \
         response_buffer.curr_buf_ptr = response_buffer.buffer;                                               \
                                                                                                              \
         if (CURLE_OK != result)                                                                              \
@@ -171,7 +265,7 @@
         if (handle_HTTP_response) {                                                                          \
             long response_code;                                                                              \
                                                                                                              \
-            if (CURLE_OK != curl_easy_getinfo(curl_ptr, CURLINFO_RESPONSE_CODE, &response_code))             \
+            if (RV_curl_get_response_code(curl_ptr, &response_code) < 0)                                     \
                 FUNC_GOTO_ERROR(ERR_MAJOR, ERR_MINOR, ret_value, "can't get HTTP response code");            \
                                                                                                              \
             HANDLE_RESPONSE(response_code, ERR_MAJOR, ERR_MINOR, ret_value);                                 \
@@ -184,8 +278,8 @@
  * the default behavior for most of the server requests that
  * this VOL connector makes.
  */
-#define CURL_PERFORM(curl_ptr, ERR_MAJOR, ERR_MINOR, ret_value)                                              \
-    CURL_PERFORM_INTERNAL(curl_ptr, TRUE, ERR_MAJOR, ERR_MINOR, ret_value)
+#define CURL_PERFORM(curl_ptr, request, ERR_MAJOR, ERR_MINOR, ret_value)                                     \
+    CURL_PERFORM_INTERNAL(curl_ptr, request, TRUE, ERR_MAJOR, ERR_MINOR, ret_value)
 
 /* Calls the CURL_PERFORM_INTERNAL macro in such a way that any
  * HTTP error responses will not cause a function failure. This
@@ -193,19 +287,24 @@
  * server to test for the existence of an object, such as in the
  * behavior for H5Fcreate()'s H5F_ACC_TRUNC flag.
  */
-#define CURL_PERFORM_NO_ERR(curl_ptr, ret_value)                                                             \
-    CURL_PERFORM_INTERNAL(curl_ptr, FALSE, H5E_NONE_MAJOR, H5E_NONE_MINOR, ret_value)
+#define CURL_PERFORM_NO_ERR(curl_ptr, request, ret_value)                                                    \
+    CURL_PERFORM_INTERNAL(curl_ptr, request, FALSE, H5E_NONE_MAJOR, H5E_NONE_MINOR, ret_value)
 
 /* Counterpart of CURL_PERFORM that takes a response_buffer argument,
  * instead of using the global response buffer.
  * Currently not used. */
-#define CURL_PERFORM_NO_GLOBAL(curl_ptr, local_response_buffer, ERR_MAJOR, ERR_MINOR, ret_value)             \
-    CURL_PERFORM_INTERNAL_NO_GLOBAL(curl_ptr, response_buffer, TRUE, ERR_MAJOR, ERR_MINOR, ret_value)
+#define CURL_PERFORM_NO_GLOBAL(curl_ptr, request, local_response_buffer, ERR_MAJOR, ERR_MINOR, ret_value)    \
+    CURL_PERFORM_INTERNAL_NO_GLOBAL(curl_ptr, request, response_buffer, TRUE, ERR_MAJOR, ERR_MINOR, ret_value)
 
-#define CURL_PERFORM_INTERNAL_NO_GLOBAL(curl_ptr, local_response_buffer, handle_HTTP_response, ERR_MAJOR,    \
-                                        ERR_MINOR, ret_value)                                                \
+#define CURL_PERFORM_INTERNAL_NO_GLOBAL(curl_ptr, request, local_response_buffer, handle_HTTP_response,      \
+                                        ERR_MAJOR, ERR_MINOR, ret_value)                                     \
     do {                                                                                                     \
-        CURLcode result = curl_easy_perform(curl_ptr);                                                       \
+        CURLcode result;                                                                                     \
+                                                                                                             \
+        if (RV_refresh_access_token() < 0)                                                                   \
+            FUNC_GOTO_ERROR(ERR_MAJOR, ERR_MINOR, ret_value, "can't refresh access token");                  \
+                                                                                                             \
+        result = RV_curl_easy_perform(curl_ptr, request, &local_response_buffer);                            \
                                                                                                              \
         /* Reset the cURL response buffer write position pointer */                                          \
         local_response_buffer.curr_buf_ptr = local_response_buffer.buffer;                                   \
@@ -216,7 +315,7 @@
         if (handle_HTTP_response) {                                                                          \
             long response_code;                                                                              \
                                                                                                              \
-            if (CURLE_OK != curl_easy_getinfo(curl_ptr, CURLINFO_RESPONSE_CODE, &response_code))             \
+            if (RV_curl_get_response_code(curl_ptr, &response_code) < 0)                                     \
                 FUNC_GOTO_ERROR(ERR_MAJOR, ERR_MINOR, ret_value, "can't get HTTP response code");            \
                                                                                                              \
             HANDLE_RESPONSE(response_code, ERR_MAJOR, ERR_MINOR, ret_value);                                 \
@@ -385,6 +484,7 @@ extern const char *link_class_keys2[];
 
 /* JSON key to retrieve the version of server from a request to a file. */
 extern const char *server_version_keys[];
+extern const char *server_binary_point_write_keys[];
 
 /* JSON keys to retrieve a list of attributes */
 extern const char *attributes_keys[];
@@ -416,9 +516,25 @@ struct response_buffer {
     char  *buffer;
     char  *curr_buf_ptr;
     size_t buffer_size;
+    size_t data_size; /* Size of the last response, kept once the write position is reset */
 };
 extern struct response_buffer response_buffer;
 
+/* A request to the server, as needed by a transport which serves requests in
+ * process rather than sending them through cURL. The content type is that of
+ * the request body, and a JSON body must be NUL-terminated. If header_cb isn't
+ * NULL, it is called with each response header, as a cURL header callback is. */
+typedef struct RV_request_t {
+    const char *method;
+    const char *url;
+    const char *domain;
+    const char *content_type;
+    const void *body;
+    size_t      body_size;
+    size_t (*header_cb)(char *buffer, size_t size, size_t nitems, void *userdata);
+    void *header_data;
+} RV_request_t;
+
 /* Struct containing information about open objects of each type in the VOL*/
 typedef struct RV_type_info {
     size_t           open_count;
@@ -498,11 +614,13 @@ typedef struct {
     size_t      bytes_sent;
 } upload_info;
 
-/* Structure that keeps track of semantic version. */
+/* Structure that keeps track of semantic version, and of the optional
+ * parts of the API which the server advertises that it supports. */
 typedef struct {
-    size_t major;
-    size_t minor;
-    size_t patch;
+    size_t  major;
+    size_t  minor;
+    size_t  patch;
+    hbool_t binary_point_write;
 } server_api_version;
 
 /* Structure containing information to connect to and evaluate
@@ -529,6 +647,9 @@ typedef struct RV_file_t {
     server_info_t server_info;
     hid_t         fcpl_id;
     hid_t         fapl_id;
+    hbool_t       deferred_create;      /* Whether object creation requests are queued and sent in batches */
+    double        storage_size_max_age; /* Seconds after a rescan that storage sizes may be reused from it */
+    uint64_t      rescan_usec;          /* When the domain was last flushed and rescanned, or 0 if never */
 } RV_file_t;
 
 typedef struct RV_group_t {
@@ -536,11 +657,48 @@ typedef struct RV_group_t {
     hid_t gcpl_id;
 } RV_group_t;
 
+/* Writes held back in a dataset's write-back buffer. These always cover a
+ * single block of the dataset's dataspace, whose elements are stored in
+ * row-major order in the dataset's datatype. */
+typedef struct RV_write_buffer_t {
+    int     rank;
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t count[H5S_MAX_RANK];
+    size_t  elem_size;
+    size_t  data_size;
+    size_t  data_nalloc;
+    char   *data;
+} RV_write_buffer_t;
+
+/* Read-ahead state of a dataset handle. Reads which each move a single block of
+ * the dataset's dataspace of the same shape, each advancing along one dimension by
+ * the same stride, are taken to be a sequential scan. The blocks read ahead of the
+ * scan are held together as one block, in row-major order in the dataset's
+ * datatype. */
+typedef struct RV_read_ahead_t {
+    int      rank;
+    hsize_t  last_start[H5S_MAX_RANK]; /* Block moved by the last read */
+    hsize_t  last_count[H5S_MAX_RANK];
+    int      axis;                     /* Dimension the reads advance along, or -1 if not yet known */
+    hsize_t  stride;                   /* Distance the reads advance by */
+    unsigned num_sequential;           /* Number of consecutive reads which advanced by the stride */
+    hsize_t  start[H5S_MAX_RANK];      /* Block read ahead, if data isn't NULL */
+    hsize_t  count[H5S_MAX_RANK];
+    size_t   elem_size;
+    char    *data;
+} RV_read_ahead_t;
+
 typedef struct RV_dataset_t {
-    hid_t space_id;
-    hid_t dtype_id;
-    hid_t dcpl_id;
-    hid_t dapl_id;
+    hid_t              space_id;
+    hid_t              dtype_id;
+    hid_t              dcpl_id;
+    hid_t              dapl_id;
+    size_t             write_buffer_size; /* Size of the write-back buffer, or 0 if writes aren't buffered */
+    RV_write_buffer_t *write_buffer;      /* Writes not yet sent to the server, if any */
+    hbool_t            extent_pending;    /* Whether buffered appends extended the dataspace */
+    unsigned           read_ahead_depth;  /* Number of blocks to read ahead of a scan, or 0 */
+    size_t             read_ahead_size;   /* Most memory which blocks read ahead may take up */
+    RV_read_ahead_t   *read_ahead;        /* Read-ahead state, once the dataset has been read */
 } RV_dataset_t;
 
 typedef struct RV_attr_t {
@@ -596,6 +754,12 @@ typedef struct dataset_read_info {
     H5S_sel_type sel_type;
     curl_off_t   post_len;
     void        *buf;
+
+    /* For raw chunk reads, the size of the buffer (0 if unknown), and the
+     * size and filter mask of the chunk read into it */
+    size_t   buf_size;
+    size_t   chunk_size;
+    uint32_t filter_mask;
 } dataset_read_info;
 
 typedef enum transfer_type_t { UNINIT = 0, READ = 1, WRITE = 2 } transfer_type_t;
@@ -629,12 +793,58 @@ typedef struct dataset_transfer_info {
 
     transfer_type_t transfer_type;
 
+    /* Whether the transfer moves a chunk as the bytes it is stored as, with no type
+     * conversion or scatter */
+    hbool_t raw_chunk;
+
     union {
         dataset_write_info write_info;
         dataset_read_info  read_info;
     } u;
+
+    /* Number of times this transfer has been retried */
+    size_t num_retries;
 } dataset_transfer_info;
 
+/* Output formats for request tracing */
+typedef enum RV_trace_format_t {
+    RV_TRACE_FORMAT_JSON_LINES = 0, /* One JSON object per request, per line */
+    RV_TRACE_FORMAT_CHROME     = 1  /* Array of Chrome trace 'complete' events */
+} RV_trace_format_t;
+
+/* Magic bytes at the start of a request capture file, which are followed by the
+ * version of the capture format as a 32-bit little-endian integer */
+#define RV_CAPTURE_MAGIC   "RVCAP"
+#define RV_CAPTURE_VERSION 2
+
+/* Request streams in a capture. Requests made with the global cURL handle are
+ * replayed in the order they were recorded, while requests made concurrently
+ * with a cURL multi handle are matched to their recording by method and URL. */
+#define RV_CAPTURE_STREAM_SINGLE 0
+#define RV_CAPTURE_STREAM_MULTI  1
+
+/* Set in a capture record's flags if its response body is in the data file */
+#define RV_CAPTURE_FLAG_BODY_IN_DATA_FILE 0x1
+
+/* Header of each record in a capture file, which is followed by the request
+ * method and URL and then, unless it is stored in the data file, the response
+ * body. Records are written as requests complete, with the fields encoded in
+ * the order below in little-endian byte order, taking RV_CAPTURE_RECORD_SIZE
+ * bytes in all. */
+typedef struct RV_capture_record_t {
+    uint64_t latency_usec;
+    uint64_t bytes_sent;
+    uint64_t body_size;
+    uint64_t body_offset; /* Offset of the response body in the data file, if stored there */
+    int32_t  response_code;
+    uint32_t url_len;
+    uint16_t method_len;
+    uint8_t  stream;
+    uint8_t  flags;
+} RV_capture_record_t;
+
+#define RV_CAPTURE_RECORD_SIZE (4 * 8 + 2 * 4 + 2 + 1 + 1)
+
 /*
  * A struct which is filled out and passed to the link and attribute
  * iteration callback functions when calling
@@ -759,6 +969,9 @@ herr_t RV_base64_decode(const char *in, size_t in_size, char **out, size_t *out_
 /* Comparison function to compare two keys in an rv_hash_table_t */
 int H5_rest_compare_string_keys(void *value1, void *value2);
 
+/* Record an open object in the global type info array */
+herr_t RV_type_info_insert(H5I_type_t obj_type, RV_object_t *object);
+
 /* Helper function to initialize an object's name based on its parent's name. */
 herr_t RV_set_object_handle_path(const char *obj_path, const char *parent_path, char **buf);
 
@@ -781,16 +994,19 @@ herr_t RV_curl_multi_perform(CURL *curl_multi_ptr, dataset_transfer_info *transf
 /* Callbacks used for post-processing after a curl request succeeds */
 herr_t RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hid_t file_space_id,
                           void *buf, struct response_buffer resp_buffer);
+herr_t RV_dataset_read_chunk_cb(dataset_read_info *read_info, struct response_buffer resp_buffer);
 
 /* Helper functions for cURL requests to the server */
 long RV_curl_delete(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-                    const char *filename);
+                    const char *filename, const char *operation);
 long RV_curl_put(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-                 const char *filename, upload_info *uinfo, content_type_t content_type);
+                 const char *filename, upload_info *uinfo, content_type_t content_type,
+                 const char *operation);
 long RV_curl_get(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-                 const char *filename, content_type_t content_type);
+                 const char *filename, content_type_t content_type, const char *operation);
 long RV_curl_post(CURL *curl_handle, server_info_t *server_info, const char *request_endpoint,
-                  const char *filename, const char *post_data, size_t post_size, content_type_t content_type);
+                  const char *filename, const char *post_data, size_t post_size, content_type_t content_type,
+                  const char *operation);
 
 /* Dtermine if datatype conversion is necessary */
 htri_t RV_need_tconv(hid_t src_type_id, hid_t dst_type_id);
@@ -798,7 +1014,7 @@ htri_t RV_need_tconv(hid_t src_type_id, hid_t dst_type_id);
 /* Initialize variables and buffers used for type conversion */
 herr_t RV_tconv_init(hid_t src_type_id, size_t *src_type_size, hid_t dst_type_id, size_t *dst_type_size,
                      size_t num_elem, hbool_t clear_tconv_buf, hbool_t dst_file, void **tconv_buf,
-                     void **bkg_buf, RV_tconv_reuse_t *reuse, hbool_t *fill_bkg);
+                     void **bkg_buf, RV_tconv_reuse_t *reuse, hbool_t src_reusable, hbool_t *fill_bkg);
 
 /* REST VOL Datatype helper */
 herr_t RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_len, hbool_t nested,
@@ -813,6 +1029,61 @@ herr_t RV_get_cmpd_subset_type(hid_t src_type_id, hid_t dst_type_id, RV_subset_t
 /* Helper to get information about members in dst that are included in src compound */
 herr_t RV_get_cmpd_subset_nmembers(hid_t src_type_id, hid_t dst_type_id, size_t *num_cmpd_members);
 
+/* Point a cURL handle at the next local socket in the round-robin rotation, if using sockets */
+herr_t RV_set_socket_path(CURL *curl_handle);
+
+/* Queue a request to create an object, and send all queued requests to the server */
+herr_t RV_deferred_create(RV_object_t *domain, H5I_type_t obj_type, const char *parent_URI,
+                          const char *request_body, char *URI_out);
+herr_t RV_flush_deferred_creates(void);
+
+/* Send the writes held back in the write-back buffers of datasets in a domain, or of all datasets if NULL */
+herr_t RV_dataset_flush_write_buffers(const RV_object_t *domain);
+
+/* Grow a dataset along one dimension and write the data for the new elements */
+herr_t RV_dataset_append(RV_object_t *dset, hid_t dxpl_id, unsigned axis, size_t extension, hid_t mem_type_id,
+                         const void *buf);
+
+/* Get the storage sizes of datasets in a domain, rescanning the domain at most once */
+herr_t RV_dataset_get_storage_sizes(RV_object_t *domain, size_t count, RV_object_t *dsets[], hsize_t sizes[]);
+
+/* Read several selections of a dataset, merging nearby selections into fewer requests */
+herr_t RV_dataset_read_batch(RV_object_t *dset, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                             const hid_t file_space_ids[], hid_t dxpl_id, void *bufs[]);
+
+/* Read or write chunks of a dataset as the bytes they are stored as, concurrently */
+herr_t RV_dataset_read_chunks(RV_object_t *dset, size_t count, const hsize_t *offsets[],
+                              uint32_t filter_masks[], size_t buf_sizes[], void *bufs[]);
+herr_t RV_dataset_write_chunks(RV_object_t *dset, size_t count, const hsize_t *offsets[],
+                               const uint32_t filter_masks[], const size_t sizes[], const void *bufs[]);
+
+/* cURL header callback which takes the filter mask of a chunk read from the response's headers */
+size_t RV_dataset_chunk_header_cb(char *buffer, size_t size, size_t nitems, void *userdata);
+
+/* Read the rows of a one-dimensional compound dataset which match a query evaluated by the server */
+herr_t RV_dataset_query(RV_object_t *dset, const char *query, hsize_t start, size_t max_rows,
+                        hid_t mem_type_id, size_t *num_rows, hsize_t indices[], void *buf);
+
+/* Refresh the Active Directory access token, if one is in use and is close to expiring */
+herr_t RV_refresh_access_token(void);
+
+/* Perform a request on a cURL handle, recording it to or replaying it from a request capture if enabled,
+ * or serving it in process if the transport does so */
+CURLcode RV_curl_easy_perform(CURL *curl_handle, const RV_request_t *request,
+                              struct response_buffer *resp_buffer);
+herr_t   RV_curl_get_response_code(CURL *curl_handle, long *response_code);
+
+/* Check whether the transport serves the routes which direct chunk transfers use */
+hbool_t RV_transport_serves_chunks(void);
+
+/* Record a finished request in the trace file, if tracing is enabled */
+herr_t RV_trace_request(CURL *curl_handle, const char *method, const char *operation, const char *domain,
+                        size_t transfer_index, size_t num_retries);
+
+/* Count a finished request, and a request retried after a backoff, in the request metrics */
+herr_t RV_stats_record_request(CURL *curl_handle, H5rest_op_type_t op_type);
+void   RV_stats_record_retry(H5rest_op_type_t op_type, uint64_t backoff_usec);
+
 /* Return the current time as microseconds after the UNIX epoch. */
 uint64_t RV_now_usec(void);
 
@@ -837,6 +1108,10 @@ char *RV_strtok_r(char *str, const char *delim, char **saveptr);
 #define SERVER_VERSION_SUPPORTS_MEMBER_SELECTION(version)                                                    \
     (SERVER_VERSION_MATCHES_OR_EXCEEDS(version, 0, 8, 6))
 
+/* No released HSDS version documents binary point writes, so they are
+ * only made to a server which advertises that it accepts them */
+#define SERVER_SUPPORTS_BINARY_POINT_WRITE(version) (version.binary_point_write)
+
 #ifdef __cplusplus
 }
 #endif
@@ -74,28 +74,32 @@ RV_attr_create(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_
     void        *ret_value               = NULL;
     long         http_response           = -1;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute create call with following parameters:\n");
-
-    if (H5VL_OBJECT_BY_NAME == loc_params->type) {
-        printf("     - H5Acreate variant: H5Acreate_by_name\n");
-        printf("     - loc_id object's URI: %s\n", parent->URI);
-        printf("     - loc_id object's type: %s\n", object_type_to_string(parent->obj_type));
-        printf("     - loc_id object's domain path: %s\n", parent->domain->u.file.filepath_name);
-        printf("     - Path to object that attribute is to be attached to: %s\n",
-               loc_params->loc_data.loc_by_name.name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute create call with following parameters:");
+
+        if (H5VL_OBJECT_BY_NAME == loc_params->type) {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Acreate variant: H5Acreate_by_name");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's URI: %s", parent->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's type: %s",
+                         object_type_to_string(parent->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's domain path: %s",
+                         parent->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Path to object that attribute is to be attached to: %s",
+                         loc_params->loc_data.loc_by_name.name);
+        } /* end if */
+        else {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Acreate variant: H5Acreate2");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's parent object URI: %s", parent->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's parent object type: %s",
+                         object_type_to_string(parent->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's parent object domain path: %s",
+                         parent->domain->u.file.filepath_name);
+        } /* end else */
+
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's name: %s", attr_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Default ACPL? %s",
+                     (H5P_ATTRIBUTE_CREATE_DEFAULT == acpl_id) ? "yes" : "no");
     } /* end if */
-    else {
-        printf("     - H5Acreate variant: H5Acreate2\n");
-        printf("     - New attribute's parent object URI: %s\n", parent->URI);
-        printf("     - New attribute's parent object type: %s\n", object_type_to_string(parent->obj_type));
-        printf("     - New attribute's parent object domain path: %s\n",
-               parent->domain->u.file.filepath_name);
-    } /* end else */
-
-    printf("     - New attribute's name: %s\n", attr_name);
-    printf("     - Default ACPL? %s\n\n", (H5P_ATTRIBUTE_CREATE_DEFAULT == acpl_id) ? "yes" : "no");
-#endif
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type && H5I_DATATYPE != parent->obj_type &&
         H5I_DATASET != parent->obj_type)
@@ -155,13 +159,12 @@ RV_attr_create(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_
             FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, NULL,
                             "can't locate object that attribute is to be attached to");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> H5Acreate_by_name(): found attribute's parent object by given path\n");
-        printf("-> H5Acreate_by_name(): new attribute's parent object URI: %s\n",
-               new_attribute->u.attribute.parent_obj_URI);
-        printf("-> H5Acreate_by_name(): new attribute's parent object type: %s\n\n",
-               object_type_to_string(new_attribute->u.attribute.parent_obj_type));
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                     "H5Acreate_by_name(): found attribute's parent object by given path");
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Acreate_by_name(): new attribute's parent object URI: %s",
+                     new_attribute->u.attribute.parent_obj_URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Acreate_by_name(): new attribute's parent object type: %s",
+                     object_type_to_string(new_attribute->u.attribute.parent_obj_type));
     } /* end if */
     else {
         if (H5VL_OBJECT_BY_IDX == loc_params->type) {
@@ -241,9 +244,7 @@ RV_attr_create(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_SYSERRSTR, NULL,
                         "attribute create request body size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute create request JSON:\n%s\n\n", create_request_body);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_ATTRIBUTE, "Attribute create request JSON:\n%s", create_request_body);
 
     /* URL-encode the attribute name to ensure that the resulting URL for the creation
      * operation contains no illegal characters
@@ -267,42 +268,41 @@ RV_attr_create(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_SYSERRSTR, NULL, "attribute create URL exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> URL for attribute creation request: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "URL for attribute creation request: %s", request_endpoint);
 
     uinfo.buffer      = create_request_body;
     uinfo.buffer_size = (size_t)create_request_body_len;
     uinfo.bytes_sent  = 0;
 
     http_response = RV_curl_put(curl, &new_attribute->domain->u.file.server_info, request_endpoint,
-                                new_attribute->domain->u.file.filepath_name, &uinfo, CONTENT_TYPE_JSON);
+                                new_attribute->domain->u.file.filepath_name, &uinfo, CONTENT_TYPE_JSON,
+                                "H5Acreate");
     if (!HTTP_SUCCESS(http_response))
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTCREATE, NULL, "can't create attribute");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Created attribute\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Created attribute");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_ATTR]->table, (char *)new_attribute->URI,
-                             (char *)new_attribute) == 0)
+    if (RV_type_info_insert(H5I_ATTR, new_attribute) < 0)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, NULL, "Failed to add attribute to type info array");
 
     ret_value = (void *)new_attribute;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute create response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (new_attribute && ret_value) {
-        printf("-> New attribute's info:\n");
-        printf("     - New attribute's object type: %s\n", object_type_to_string(new_attribute->obj_type));
-        printf("     - New attribute's domain path: %s\n", new_attribute->domain->u.file.filepath_name);
-        printf("     - New attribute's name: %s\n", new_attribute->u.attribute.attr_name);
-        printf("     - New attribute's datatype class: %s\n\n",
-               datatype_class_to_string(new_attribute->u.attribute.dtype_id));
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_ATTRIBUTE, "Attribute create response buffer:\n%s", response_buffer.buffer);
+
+        if (new_attribute && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's object type: %s",
+                         object_type_to_string(new_attribute->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's domain path: %s",
+                         new_attribute->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's name: %s",
+                         new_attribute->u.attribute.attr_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "New attribute's datatype class: %s",
+                         datatype_class_to_string(new_attribute->u.attribute.dtype_id));
+        } /* end if */
     } /* end if */
-#endif
 
     if (create_request_body)
         RV_free(create_request_body);
@@ -353,31 +353,34 @@ RV_attr_open(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_na
     int          url_len                = 0;
     void        *ret_value              = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute open call with following parameters:\n");
-
-    if (H5VL_OBJECT_BY_NAME == loc_params->type) {
-        printf("     - H5Aopen variant: H5Aopen_by_name\n");
-        printf("     - loc_id object's URI: %s\n", parent->URI);
-        printf("     - loc_id object's type: %s\n", object_type_to_string(parent->obj_type));
-        printf("     - loc_id object's domain path: %s\n", parent->domain->u.file.filepath_name);
-        printf("     - Path to object that attribute is attached to: %s\n",
-               loc_params->loc_data.loc_by_name.name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute open call with following parameters:");
+
+        if (H5VL_OBJECT_BY_NAME == loc_params->type) {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aopen variant: H5Aopen_by_name");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's URI: %s", parent->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's type: %s",
+                         object_type_to_string(parent->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "loc_id object's domain path: %s",
+                         parent->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Path to object that attribute is attached to: %s",
+                         loc_params->loc_data.loc_by_name.name);
+        } /* end if */
+        else if (H5VL_OBJECT_BY_IDX == loc_params->type) {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aopen variant: H5Aopen_by_idx");
+        } /* end else if */
+        else {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aopen variant: H5Aopen");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's parent object URI: %s", parent->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's parent object type: %s",
+                         object_type_to_string(parent->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's parent object domain path: %s",
+                         parent->domain->u.file.filepath_name);
+        } /* end else */
+
+        if (attr_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's name: %s", attr_name);
     } /* end if */
-    else if (H5VL_OBJECT_BY_IDX == loc_params->type) {
-        printf("     - H5Aopen variant: H5Aopen_by_idx\n");
-    } /* end else if */
-    else {
-        printf("     - H5Aopen variant: H5Aopen\n");
-        printf("     - Attribute's parent object URI: %s\n", parent->URI);
-        printf("     - Attribute's parent object type: %s\n", object_type_to_string(parent->obj_type));
-        printf("     - Attribute's parent object domain path: %s\n", parent->domain->u.file.filepath_name);
-    } /* end else */
-
-    if (attr_name)
-        printf("     - Attribute's name: %s\n", attr_name);
-    printf("\n");
-#endif
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type && H5I_DATATYPE != parent->obj_type &&
         H5I_DATASET != parent->obj_type)
@@ -451,13 +454,12 @@ RV_attr_open(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_na
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, NULL,
                                 "can't locate object that attribute is attached to");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> H5Aopen_by_name(): found attribute's parent object by given path\n");
-            printf("-> H5Aopen_by_name(): attribute's parent object URI: %s\n",
-                   attribute->u.attribute.parent_obj_URI);
-            printf("-> H5Aopen_by_name(): attribute's parent object type: %s\n\n",
-                   object_type_to_string(attribute->u.attribute.parent_obj_type));
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                         "H5Aopen_by_name(): found attribute's parent object by given path");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aopen_by_name(): attribute's parent object URI: %s",
+                         attribute->u.attribute.parent_obj_URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aopen_by_name(): attribute's parent object type: %s",
+                         object_type_to_string(attribute->u.attribute.parent_obj_type));
 
             break;
         } /* H5VL_OBJECT_BY_NAME */
@@ -531,7 +533,7 @@ RV_attr_open(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_na
                                 "attribute open URL exceeded maximum URL size");
 
             if (RV_curl_get(curl, &attribute->domain->u.file.server_info, request_endpoint,
-                            attribute->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            attribute->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Aopen") < 0)
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get attribute");
 
             if (0 > RV_parse_response(response_buffer.buffer, (const void *)&loc_params->loc_data.loc_by_idx,
@@ -578,12 +580,10 @@ RV_attr_open(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_na
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_SYSERRSTR, NULL, "attribute open URL exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> URL for attribute open request: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "URL for attribute open request: %s", request_endpoint);
 
     if (RV_curl_get(curl, &attribute->domain->u.file.server_info, request_endpoint,
-                    attribute->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                    attribute->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Aopen") < 0)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get attribute");
 
     /* Set up a Dataspace for the opened Attribute */
@@ -617,25 +617,26 @@ RV_attr_open(void *obj, const H5VL_loc_params_t *loc_params, const char *attr_na
     if ((attribute->u.attribute.acpl_id = H5Pcreate(H5P_ATTRIBUTE_CREATE)) < 0)
         FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, NULL, "can't create ACPL for attribute");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_ATTR]->table, (char *)attribute->URI,
-                             (char *)attribute) == 0)
+    if (RV_type_info_insert(H5I_ATTR, attribute) < 0)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, NULL, "Failed to add attribute to type info array");
 
     ret_value = (void *)attribute;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute open response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (attribute && ret_value) {
-        printf("-> Attribute's info:\n");
-        printf("     - Attribute's object type: %s\n", object_type_to_string(attribute->obj_type));
-        printf("     - Attribute's domain path: %s\n", attribute->domain->u.file.filepath_name);
-        printf("     - Attribute's name: %s\n", attribute->u.attribute.attr_name);
-        printf("     - Attribute's datatype class: %s\n\n",
-               datatype_class_to_string(attribute->u.attribute.dtype_id));
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_ATTRIBUTE, "Attribute open response buffer:\n%s", response_buffer.buffer);
+
+        if (attribute && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's object type: %s",
+                         object_type_to_string(attribute->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's domain path: %s",
+                         attribute->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's name: %s", attribute->u.attribute.attr_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's datatype class: %s",
+                         datatype_class_to_string(attribute->u.attribute.dtype_id));
+        } /* end if */
     } /* end if */
-#endif
 
     if (url_encoded_attr_name)
         curl_free(url_encoded_attr_name);
@@ -678,13 +679,15 @@ RV_attr_read(void *attr, hid_t dtype_id, void *buf, hid_t dxpl_id, void **req)
     int          url_len                = 0;
     herr_t       ret_value              = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute read call with following parameters:\n");
-    printf("     - Attribute's object type: %s\n", object_type_to_string(attribute->obj_type));
-    if (H5I_ATTR == attribute->obj_type && attribute->u.attribute.attr_name)
-        printf("     - Attribute's name: %s\n", attribute->u.attribute.attr_name);
-    printf("     - Attribute's domain path: %s\n\n", attribute->domain->u.file.filepath_name);
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute read call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's object type: %s",
+                     object_type_to_string(attribute->obj_type));
+        if (H5I_ATTR == attribute->obj_type && attribute->u.attribute.attr_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's name: %s", attribute->u.attribute.attr_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's domain path: %s",
+                     attribute->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_ATTR != attribute->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not an attribute");
@@ -709,10 +712,9 @@ RV_attr_read(void *attr, hid_t dtype_id, void *buf, hid_t dxpl_id, void **req)
     if (0 == (dtype_size = H5Tget_size(dtype_id)))
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "memory datatype is invalid");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> %" PRIuHSIZE "points selected for attribute read\n", file_select_npoints);
-    printf("-> Attribute's datatype size: %zu\n\n", dtype_size);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "%" PRIuHSIZE "points selected for attribute read",
+                 file_select_npoints);
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's datatype size: %zu", dtype_size);
 
     /* Instruct cURL on which type of transfer to perform, binary or JSON */
     content_type_t content_type = is_transfer_binary ? CONTENT_TYPE_OCTET_STREAM : CONTENT_TYPE_JSON;
@@ -740,20 +742,16 @@ RV_attr_read(void *attr, hid_t dtype_id, void *buf, hid_t dxpl_id, void **req)
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_SYSERRSTR, FAIL, "attribute read URL exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> URL for attribute read request: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "URL for attribute read request: %s", request_endpoint);
 
     if (RV_curl_get(curl, &attribute->domain->u.file.server_info, request_endpoint,
-                    attribute->domain->u.file.filepath_name, content_type) < 0)
+                    attribute->domain->u.file.filepath_name, content_type, "H5Aread") < 0)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "can't read from attribute");
 
     memcpy(buf, response_buffer.buffer, (size_t)file_select_npoints * dtype_size);
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute read response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_ATTRIBUTE, "Attribute read response buffer:\n%s", response_buffer.buffer);
 
     if (url_encoded_attr_name)
         curl_free(url_encoded_attr_name);
@@ -792,13 +790,15 @@ RV_attr_write(void *attr, hid_t dtype_id, const void *buf, hid_t dxpl_id, void *
     long         http_response;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute write call with following parameters:\n");
-    printf("     - Attribute's object type: %s\n", object_type_to_string(attribute->obj_type));
-    if (H5I_ATTR == attribute->obj_type && attribute->u.attribute.attr_name)
-        printf("     - Attribute's name: %s\n", attribute->u.attribute.attr_name);
-    printf("     - Attribute's domain path: %s\n\n", attribute->domain->u.file.filepath_name);
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute write call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's object type: %s",
+                     object_type_to_string(attribute->obj_type));
+        if (H5I_ATTR == attribute->obj_type && attribute->u.attribute.attr_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's name: %s", attribute->u.attribute.attr_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's domain path: %s",
+                     attribute->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_ATTR != attribute->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not an attribute");
@@ -826,10 +826,9 @@ RV_attr_write(void *attr, hid_t dtype_id, const void *buf, hid_t dxpl_id, void *
     if (0 == (dtype_size = H5Tget_size(dtype_id)))
         FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "memory datatype is invalid");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> %" PRIuHSIZE "points selected for attribute write\n", file_select_npoints);
-    printf("-> Attribute's datatype size: %zu\n\n", dtype_size);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "%" PRIuHSIZE "points selected for attribute write",
+                 file_select_npoints);
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's datatype size: %zu", dtype_size);
 
     write_body_len = (size_t)file_select_npoints * dtype_size;
 
@@ -856,9 +855,7 @@ RV_attr_write(void *attr, hid_t dtype_id, const void *buf, hid_t dxpl_id, void *
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_SYSERRSTR, FAIL, "attribute write URL exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> URL for attribute write request: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "URL for attribute write request: %s", request_endpoint);
 
     /* Check to make sure that the size of the write body can safely be cast to a curl_off_t */
     if (sizeof(curl_off_t) < sizeof(size_t))
@@ -878,15 +875,14 @@ RV_attr_write(void *attr, hid_t dtype_id, const void *buf, hid_t dxpl_id, void *
 
     http_response = RV_curl_put(curl, &attribute->domain->u.file.server_info, request_endpoint,
                                 attribute->domain->u.file.filepath_name, &uinfo,
-                                (is_transfer_binary ? CONTENT_TYPE_OCTET_STREAM : CONTENT_TYPE_JSON));
+                                (is_transfer_binary ? CONTENT_TYPE_OCTET_STREAM : CONTENT_TYPE_JSON),
+                                "H5Awrite");
 
     if (!HTTP_SUCCESS(http_response))
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL, "can't write to attribute");
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute write response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_ATTRIBUTE, "Attribute write response buffer:\n%s", response_buffer.buffer);
 
     if (url_encoded_attr_name)
         curl_free(url_encoded_attr_name);
@@ -919,10 +915,8 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
     const char  *request_idx_type       = NULL;
     herr_t       ret_value              = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute get call with following parameters:\n");
-    printf("     - Attribute get call type: %s\n\n", attr_get_type_to_string(args->op_type));
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute get call type: %s", attr_get_type_to_string(args->op_type));
 
     if (H5I_ATTR != loc_obj->obj_type && H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type &&
         H5I_DATATYPE != loc_obj->obj_type && H5I_DATASET != loc_obj->obj_type)
@@ -951,12 +945,10 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
             switch (loc_params->type) {
                 /* H5Aget_info */
                 case H5VL_OBJECT_BY_SELF: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aget_info(): Attribute's parent object URI: %s\n",
-                           loc_obj->u.attribute.parent_obj_URI);
-                    printf("-> H5Aget_info(): Attribute's parent object type: %s\n\n",
-                           object_type_to_string(loc_obj->u.attribute.parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_info(): Attribute's parent object URI: %s",
+                                 loc_obj->u.attribute.parent_obj_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_info(): Attribute's parent object type: %s",
+                                 object_type_to_string(loc_obj->u.attribute.parent_obj_type));
 
                     /* URL-encode the attribute name to ensure that the resulting URL for the creation
                      * operation contains no illegal characters
@@ -992,13 +984,13 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
                     htri_t      search_ret;
                     char        parent_obj_URI[URI_MAX_LENGTH];
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aget_info_by_name(): loc_id object's URI: %s\n", loc_obj->URI);
-                    printf("-> H5Aget_info_by_name(): loc_id object type: %s\n",
-                           object_type_to_string(loc_obj->obj_type));
-                    printf("-> H5Aget_info_by_name(): Path to object that attribute is attached to: %s\n\n",
-                           loc_params->loc_data.loc_by_name.name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_info_by_name(): loc_id object's URI: %s",
+                                 loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_info_by_name(): loc_id object type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aget_info_by_name(): Path to object that attribute is attached to: %s",
+                                 loc_params->loc_data.loc_by_name.name);
 
                     /* Retrieve the type and URI of the object that the attribute is attached to */
                     search_ret = RV_find_object_by_path(loc_obj, loc_params->loc_data.loc_by_name.name,
@@ -1007,12 +999,13 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
                     if (!search_ret || search_ret < 0)
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, FAIL, "can't find parent object by name");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aget_info_by_name(): found attribute's parent object by given path\n");
-                    printf("-> H5Aget_info_by_name(): attribute's parent object URI: %s\n", parent_obj_URI);
-                    printf("-> H5Aget_info_by_name(): attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aget_info_by_name(): found attribute's parent object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aget_info_by_name(): attribute's parent object URI: %s", parent_obj_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aget_info_by_name(): attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     /* URL-encode the attribute name to ensure that the resulting URL for the creation
                      * operation contains no illegal characters
@@ -1098,7 +1091,8 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
                                         "attribute open URL exceeded maximum URL size");
 
                     if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                    "H5Aget_info") < 0)
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute");
 
                     if (0 > RV_parse_response(response_buffer.buffer, &loc_params->loc_data.loc_by_idx,
@@ -1128,7 +1122,7 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
 
             /* Make a GET request to the server to retrieve the attribute's info */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Aget_info") < 0)
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute");
 
             /* Retrieve the attribute's info */
@@ -1148,12 +1142,10 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
             switch (loc_params->type) {
                 /* H5Aget_name */
                 case H5VL_OBJECT_BY_SELF: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aget_name(): Attribute's parent object URI: %s\n",
-                           loc_obj->u.attribute.parent_obj_URI);
-                    printf("-> H5Aget_name(): Attribute's parent object type: %s\n\n",
-                           object_type_to_string(loc_obj->u.attribute.parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_name(): Attribute's parent object URI: %s",
+                                 loc_obj->u.attribute.parent_obj_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aget_name(): Attribute's parent object type: %s",
+                                 object_type_to_string(loc_obj->u.attribute.parent_obj_type));
 
                     *ret_size = (size_t)strlen(loc_obj->u.attribute.attr_name);
 
@@ -1229,7 +1221,8 @@ RV_attr_get(void *obj, H5VL_attr_get_args_t *args, hid_t dxpl_id, void **req)
                                         "attribute open URL exceeded maximum URL size");
 
                     if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                    "H5Aget_name") < 0)
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute");
 
                     if (0 > RV_parse_response(response_buffer.buffer, &loc_params->loc_data.loc_by_idx,
@@ -1347,10 +1340,9 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
     herr_t                    ret_value              = SUCCEED;
     long                      http_response;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute-specific call with following parameters:\n");
-    printf("     - Attribute-specific call type: %s\n\n", attr_specific_type_to_string(args->op_type));
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute-specific call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute-specific call type: %s",
+                 attr_specific_type_to_string(args->op_type));
 
     if (H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type &&
         H5I_DATATYPE != loc_obj->obj_type && H5I_DATASET != loc_obj->obj_type)
@@ -1411,7 +1403,7 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
 
             http_response =
                 RV_curl_delete(curl, &loc_obj->domain->u.file.server_info, (const char *)request_endpoint,
-                               (const char *)loc_obj->domain->u.file.filepath_name);
+                               (const char *)loc_obj->domain->u.file.filepath_name, "H5Adelete_by_idx");
 
             if (!HTTP_SUCCESS(http_response))
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL, "can't delete attribute");
@@ -1433,12 +1425,11 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                     obj_URI         = loc_obj->URI;
                     parent_obj_type = loc_obj->obj_type;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Adelete(): Attribute's name: %s\n", attr_name);
-                    printf("-> H5Adelete(): Attribute's parent object URI: %s\n", loc_obj->URI);
-                    printf("-> H5Adelete(): Attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Adelete(): Attribute's name: %s", attr_name);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Adelete(): Attribute's parent object URI: %s",
+                                 loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Adelete(): Attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     break;
                 } /* H5VL_OBJECT_BY_SELF */
@@ -1453,12 +1444,11 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
 
                     attr_name = args->args.del.name;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Adelete_by_name(): loc_id object type: %s\n",
-                           object_type_to_string(loc_obj->obj_type));
-                    printf("-> H5Adelete_by_name(): Path to object that attribute is attached to: %s\n\n",
-                           loc_params->loc_data.loc_by_name.name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Adelete_by_name(): loc_id object type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Adelete_by_name(): Path to object that attribute is attached to: %s",
+                                 loc_params->loc_data.loc_by_name.name);
 
                     search_ret =
                         RV_find_object_by_path(loc_obj, loc_params->loc_data.loc_by_name.name,
@@ -1467,12 +1457,13 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, FAIL,
                                         "can't locate object that attribute is attached to");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Adelete_by_name(): found attribute's parent object by given path\n");
-                    printf("-> H5Adelete_by_name(): attribute's parent object URI: %s\n", temp_URI);
-                    printf("-> H5Adelete_by_name(): attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Adelete_by_name(): found attribute's parent object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Adelete_by_name(): attribute's parent object URI: %s", temp_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Adelete_by_name(): attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     obj_URI = temp_URI;
 
@@ -1517,7 +1508,7 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
 
             http_response =
                 RV_curl_delete(curl, &loc_obj->domain->u.file.server_info, (const char *)request_endpoint,
-                               (const char *)loc_obj->domain->u.file.filepath_name);
+                               (const char *)loc_obj->domain->u.file.filepath_name, "H5Adelete");
 
             if (!HTTP_SUCCESS(http_response))
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL, "can't delete attribute");
@@ -1536,11 +1527,10 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                     obj_URI         = loc_obj->URI;
                     parent_obj_type = loc_obj->obj_type;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aexists(): Attribute's parent object URI: %s\n", loc_obj->URI);
-                    printf("-> H5Aexists(): Attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aexists(): Attribute's parent object URI: %s",
+                                 loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aexists(): Attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     break;
                 } /* H5VL_OBJECT_BY_SELF */
@@ -1553,12 +1543,11 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
 
                     htri_t search_ret;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aexists_by_name(): loc_id object type: %s\n",
-                           object_type_to_string(loc_obj->obj_type));
-                    printf("-> H5Aexists_by_name(): Path to object that attribute is attached to: %s\n\n",
-                           loc_params->loc_data.loc_by_name.name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aexists_by_name(): loc_id object type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aexists_by_name(): Path to object that attribute is attached to: %s",
+                                 loc_params->loc_data.loc_by_name.name);
 
                     search_ret =
                         RV_find_object_by_path(loc_obj, loc_params->loc_data.loc_by_name.name,
@@ -1567,12 +1556,13 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, FAIL,
                                         "can't locate object that attribute is attached to");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aexists_by_name(): found attribute's parent object by given path\n");
-                    printf("-> H5Aexists_by_name(): attribute's parent object URI: %s\n", temp_URI);
-                    printf("-> H5Aexists_by_name(): attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aexists_by_name(): found attribute's parent object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aexists_by_name(): attribute's parent object URI: %s", temp_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aexists_by_name(): attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     obj_URI = temp_URI;
 
@@ -1610,7 +1600,8 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                                 "H5Aexists(_by_name) request URL exceeded maximum URL size");
 
             http_response = RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                        loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON);
+                                        loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                        "H5Aexists");
 
             if (HTTP_SUCCESS(http_response))
                 *ret = TRUE;
@@ -1819,11 +1810,10 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                                             "parent object not a file, group, datatype or dataset");
                     } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aiterate2(): Attribute's parent object URI: %s\n", loc_obj->URI);
-                    printf("-> H5Aiterate2(): Attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aiterate2(): Attribute's parent object URI: %s",
+                                 loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aiterate2(): Attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
                     break;
                 } /* H5VL_OBJECT_BY_SELF */
@@ -1836,12 +1826,11 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
 
                     htri_t search_ret;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aiterate_by_name(): loc_id object type: %s\n",
-                           object_type_to_string(loc_obj->obj_type));
-                    printf("-> H5Aiterate_by_name(): Path to object that attribute is attached to: %s\n\n",
-                           loc_params->loc_data.loc_by_name.name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "H5Aiterate_by_name(): loc_id object type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aiterate_by_name(): Path to object that attribute is attached to: %s",
+                                 loc_params->loc_data.loc_by_name.name);
 
                     search_ret =
                         RV_find_object_by_path(loc_obj, loc_params->loc_data.loc_by_name.name,
@@ -1850,15 +1839,16 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_PATH, FAIL,
                                         "can't locate object that attribute is attached to");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Aiterate_by_name(): found attribute's parent object by given path\n");
-                    printf("-> H5Aiterate_by_name(): attribute's parent object URI: %s\n", temp_URI);
-                    printf("-> H5Aiterate_by_name(): attribute's parent object type: %s\n\n",
-                           object_type_to_string(parent_obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aiterate_by_name(): found attribute's parent object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aiterate_by_name(): attribute's parent object URI: %s", temp_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE,
+                                 "H5Aiterate_by_name(): attribute's parent object type: %s",
+                                 object_type_to_string(parent_obj_type));
 
-                    printf("-> Opening attribute's parent object to generate an hid_t and work around VOL "
-                           "layer\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Opening attribute's parent object to generate an "
+                                 "hid_t and work around VOL layer");
 
                     /* Since the VOL layer doesn't directly pass down the parent object's ID for the
                      * attribute, explicitly open the object here so that a valid hid_t can be passed to the
@@ -1974,7 +1964,7 @@ RV_attr_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_attr_speci
             /* Make a GET request to the server to retrieve all of the attributes attached to the given object
              */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Aiterate") < 0)
                 FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute");
 
             if (RV_parse_response(response_buffer.buffer, &attr_iter_data, NULL, RV_attr_iter_callback) < 0)
@@ -2199,15 +2189,16 @@ RV_attr_close(void *attr, hid_t dxpl_id, void **req)
     if (!_attr)
         FUNC_GOTO_DONE(SUCCEED);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received attribute close call with following parameters:\n");
-    printf("     - Attribute's object type: %s\n", object_type_to_string(_attr->obj_type));
-    if (H5I_ATTR == _attr->obj_type && _attr->u.attribute.attr_name)
-        printf("     - Attribute's name: %s\n", _attr->u.attribute.attr_name);
-    if (_attr->domain && _attr->domain->u.file.filepath_name)
-        printf("     - Attribute's domain path: %s\n", _attr->domain->u.file.filepath_name);
-    printf("\n");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_ATTRIBUTE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Received attribute close call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's object type: %s",
+                     object_type_to_string(_attr->obj_type));
+        if (H5I_ATTR == _attr->obj_type && _attr->u.attribute.attr_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's name: %s", _attr->u.attribute.attr_name);
+        if (_attr->domain && _attr->domain->u.file.filepath_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute's domain path: %s",
+                         _attr->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_ATTR != _attr->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not an attribute");
@@ -2273,9 +2264,7 @@ RV_get_attr_info_callback(char *HTTP_response, const void *callback_data_in, voi
     H5A_info_t *attr_info = (H5A_info_t *)callback_data_out;
     herr_t      ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving attribute info from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Retrieving attribute info from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -2313,9 +2302,7 @@ RV_attr_iter_callback(char *HTTP_response, const void *callback_data_in, void *c
     size_t            attr_table_num_entries;
     herr_t            ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Iterating through attributes according to server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Iterating through attributes according to server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -2333,9 +2320,7 @@ RV_attr_iter_callback(char *HTTP_response, const void *callback_data_in, void *c
                                 &attr_table_num_entries) < 0)
             FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTBUILDATTRTABLE, FAIL, "can't build attribute table");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Attribute table sorted according to creation order\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute table sorted according to creation order");
     } /* end if */
     else {
         if (RV_build_attr_table(HTTP_response, FALSE, NULL, &attr_table, &attr_table_num_entries) < 0)
@@ -2392,9 +2377,7 @@ RV_build_attr_table(char *HTTP_response, hbool_t sort, int (*sort_func)(const vo
     if (!num_entries)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "attr table num. entries pointer was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Building table of attributes\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Building table of attributes");
 
     if (NULL == (parse_tree = yajl_tree_parse(HTTP_response, NULL, 0)))
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_PARSEERROR, FAIL, "parsing JSON failed");
@@ -2474,9 +2457,7 @@ RV_build_attr_table(char *HTTP_response, hbool_t sort, int (*sort_func)(const vo
         attribute_section_start = attribute_section_end + 1;
     } /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute table built\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute table built");
 
     if (sort)
         qsort(table, num_attributes, sizeof(*table), sort_func);
@@ -2516,20 +2497,18 @@ RV_traverse_attr_table(attr_table_entry *attr_table, size_t num_entries, const i
     switch (attr_iter_data->iter_order) {
         case H5_ITER_NATIVE:
         case H5_ITER_INC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in increasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Beginning iteration in increasing order");
 
             for (last_idx = (attr_iter_data->idx_p ? *attr_iter_data->idx_p : 0); last_idx < num_entries;
                  last_idx++) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Attribute %zu name: %s\n", last_idx, attr_table[last_idx].attr_name);
-                printf("-> Attribute %zu creation time: %f\n", last_idx, attr_table[last_idx].crt_time);
-                printf("-> Attribute %zu data size: %" PRIuHSIZE "\n\n", last_idx,
-                       attr_table[last_idx].attr_info.data_size);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu name: %s", last_idx,
+                             attr_table[last_idx].attr_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu creation time: %f", last_idx,
+                             attr_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu data size: %" PRIuHSIZE, last_idx,
+                             attr_table[last_idx].attr_info.data_size);
 
-                printf("-> Calling supplied callback function\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Calling supplied callback function");
 
                 /* Call the user's callback */
                 callback_ret = attr_iter_data->iter_function.attr_iter_op(
@@ -2547,20 +2526,18 @@ RV_traverse_attr_table(attr_table_entry *attr_table, size_t num_entries, const i
         } /* H5_ITER_NATIVE H5_ITER_INC */
 
         case H5_ITER_DEC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in decreasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Beginning iteration in decreasing order");
 
             for (last_idx = (attr_iter_data->idx_p ? *attr_iter_data->idx_p : num_entries - 1); last_idx >= 0;
                  last_idx--) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Attribute %zu name: %s\n", last_idx, attr_table[last_idx].attr_name);
-                printf("-> Attribute %zu creation time: %f\n", last_idx, attr_table[last_idx].crt_time);
-                printf("-> Attribute %zu data size: %" PRIuHSIZE "\n\n", last_idx,
-                       attr_table[last_idx].attr_info.data_size);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu name: %s", last_idx,
+                             attr_table[last_idx].attr_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu creation time: %f", last_idx,
+                             attr_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute %zu data size: %" PRIuHSIZE, last_idx,
+                             attr_table[last_idx].attr_info.data_size);
 
-                printf("-> Calling supplied callback function\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Calling supplied callback function");
 
                 /* Call the user's callback */
                 callback_ret = attr_iter_data->iter_function.attr_iter_op(
@@ -2586,9 +2563,7 @@ RV_traverse_attr_table(attr_table_entry *attr_table, size_t num_entries, const i
             FUNC_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "unknown attribute iteration order");
     } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Attribute iteration finished\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_ATTRIBUTE, "Attribute iteration finished");
 
 done:
     return ret_value;
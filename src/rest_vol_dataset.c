@@ -27,7 +27,7 @@ static herr_t RV_parse_dataset_creation_properties_callback(char *HTTP_response,
                                                             void *callback_data_out);
 
 /* Convert a binary buffer of packed vlen data to a buffer of hvl_t */
-static herr_t RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out);
+static herr_t RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out, void **arena);
 
 /* Helper functions for creating a Dataset */
 static herr_t RV_setup_dataset_create_request_body(void *parent_obj, const char *name, hid_t type_id,
@@ -53,15 +53,155 @@ static herr_t   RV_convert_buffer_to_obj_refs(char *ref_buf, size_t ref_buf_len,
                                               size_t *buf_out_len);
 static hssize_t RV_convert_start_to_offset(hid_t space_id);
 
-/* Struct for H5Dscatter's callback that allows it to scatter from a non-global response buffer */
+/* Struct for H5Dscatter's callback that allows it to scatter from a non-global response buffer. If
+ * type conversion is needed, the callback converts the data one strip at a time as it is scattered. */
 struct response_read_info {
     void *buffer;
     void *read_size;
+
+    /* Type conversion state, only used if needs_tconv is TRUE */
+    hbool_t     needs_tconv;
+    hid_t       file_type_id;
+    hid_t       mem_type_id;
+    size_t      file_type_size;
+    size_t      mem_type_size;
+    size_t      strip_nelem;
+    size_t      nelem_total;
+    size_t      nelem_converted;
+    void       *tconv_buf;
+    void       *bkg_buf;
+    const void *bkg_src;
 } typedef response_read_info;
 
 /* H5Dscatter() callback for dataset reads */
 static herr_t dataset_read_scatter_op(const void **src_buf, size_t *src_buf_bytes_used, void *op_data);
 
+/* Send dataset writes to the server, bypassing the datasets' write-back buffers */
+static herr_t RV_dataset_write_unbuffered(size_t count, void *dset[], hid_t mem_type_id[],
+                                          hid_t _mem_space_id[], hid_t _file_space_id[], hid_t dxpl_id,
+                                          const void *buf[]);
+
+/* Determine whether a transfer moves a single block of a dataset's dataspace */
+static htri_t RV_dataset_get_selection_block(const RV_object_t *dset, hid_t mem_type_id, hid_t file_space_id,
+                                             int *rank_out, hsize_t *start, hsize_t *count);
+
+/* Helper functions for dataset write-back buffers */
+static htri_t       RV_write_buffer_get_block(const RV_object_t *dset, hid_t mem_type_id, hid_t file_space_id,
+                                              int *rank_out, hsize_t *start, hsize_t *count);
+static herr_t       RV_write_buffer_add(RV_object_t *dset, hid_t mem_type_id, hid_t mem_space_id,
+                                        hid_t file_space_id, const void *buf);
+static hbool_t      RV_write_buffer_merge_block(const RV_write_buffer_t *write_buffer, const hsize_t *start,
+                                                const hsize_t *count, hsize_t *merged_start,
+                                                hsize_t *merged_count);
+static void         RV_write_buffer_copy_block(char *dst, const hsize_t *dst_start, const hsize_t *dst_count,
+                                               const char *src, const hsize_t *src_start,
+                                               const hsize_t *src_count, int rank, size_t elem_size);
+static RV_object_t *RV_write_buffer_find(const RV_object_t *dset);
+static void         RV_write_buffer_discard(RV_object_t *dset);
+static herr_t       RV_write_buffers_send(size_t count, RV_object_t *dsets[]);
+static herr_t       RV_dataset_flush_write_buffer(const RV_object_t *dset, hid_t file_space_id);
+
+/* Change the extent of a dataset on the server, or update its local dataspace from the server's */
+static herr_t RV_dataset_put_extent(const RV_object_t *dset, int ndims, const hsize_t *new_extent);
+static herr_t RV_dataset_get_extent(const RV_object_t *dset);
+
+/* A read of a single block of a dataset which is widened to read ahead of a sequential scan */
+typedef struct RV_read_ahead_read_t {
+    size_t  index; /* Index of the read among the reads made together */
+    int     rank;
+    hsize_t start[H5S_MAX_RANK]; /* Block requested */
+    hsize_t count[H5S_MAX_RANK];
+    hsize_t ahead_start[H5S_MAX_RANK]; /* Block read in its place */
+    hsize_t ahead_count[H5S_MAX_RANK];
+    hid_t   mem_space_id;
+    hid_t   file_space_id;
+    char   *data;
+} RV_read_ahead_read_t;
+
+/* Read data from datasets on the server, bypassing the data their handles read ahead */
+static herr_t RV_dataset_read_unbuffered(size_t count, void *dset[], hid_t mem_type_id[],
+                                         hid_t _mem_space_id[], hid_t _file_space_id[], hid_t dxpl_id,
+                                         void *buf[]);
+
+/* Helper functions for dataset read-ahead */
+static hbool_t RV_read_ahead_track(RV_read_ahead_t *read_ahead, int rank, const hsize_t *start,
+                                   const hsize_t *count);
+static htri_t  RV_read_ahead_get_block(const RV_object_t *dset, const hsize_t *start, const hsize_t *count,
+                                       hsize_t *ahead_start, hsize_t *ahead_count);
+static herr_t  RV_read_ahead_setup_read(const RV_object_t *dset, RV_read_ahead_read_t *ahead);
+static htri_t  RV_read_ahead_serve(const RV_object_t *dset, const hsize_t *start, const hsize_t *count,
+                                   hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, void *buf);
+static void    RV_read_ahead_copy_block(char *dst, const hsize_t *dst_start, const hsize_t *dst_count,
+                                        const char *src, const hsize_t *src_start, const hsize_t *src_count,
+                                        int rank, size_t elem_size);
+static herr_t  RV_read_ahead_store(RV_object_t *dset, RV_read_ahead_read_t *ahead);
+static void    RV_read_ahead_drop(RV_object_t *dset);
+static herr_t  RV_read_ahead_invalidate(const RV_object_t *dset, hid_t file_space_id);
+
+/* The bounding box of a selection read by RV_dataset_read_batch() */
+typedef struct RV_batch_read_t {
+    size_t  index; /* Index of the selection among those batched */
+    size_t  group; /* Index of the group the read is merged into */
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t end[H5S_MAX_RANK];
+} RV_batch_read_t;
+
+/* A group of batched reads of a dataset, merged into a read of their bounding box */
+typedef struct RV_batch_group_t {
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t end[H5S_MAX_RANK];
+    size_t  num_reads;
+    hid_t   mem_space_id;
+    hid_t   file_space_id;
+    void   *data;
+} RV_batch_group_t;
+
+/* Helper functions for batched dataset reads */
+static int     RV_batch_read_cmp(const void *_read1, const void *_read2);
+static hsize_t RV_batch_box_nelems(const hsize_t *start, const hsize_t *end, int rank);
+static herr_t  RV_batch_group_scatter(const RV_batch_group_t *group, hid_t mem_type_id, size_t mem_type_size,
+                                      hid_t mem_space_id, hid_t file_space_id, void *buf);
+
+/* Parameters for dataset 'optional' operations.
+   A subset of H5VL_native_dataset_optional_args_t */
+typedef union RV_dataset_optional_args_t {
+    /* H5VL_NATIVE_DATASET_CHUNK_READ */
+    struct {
+        const hsize_t *offset;  /* Offset of the chunk in the dataset */
+        uint32_t       filters; /* Filter mask of the chunk (OUT) */
+        void          *buf;     /* Buffer to read the chunk into */
+    } chunk_read;
+
+    /* H5VL_NATIVE_DATASET_CHUNK_WRITE */
+    struct {
+        const hsize_t *offset;  /* Offset of the chunk in the dataset */
+        uint32_t       filters; /* Filter mask of the chunk */
+        uint32_t       size;    /* Size of the chunk */
+        const void    *buf;     /* Buffer holding the chunk */
+    } chunk_write;
+} RV_dataset_optional_args_t;
+
+/* Helper functions for transfers of chunks as the bytes they are stored as */
+static herr_t RV_dataset_transfer_chunks(RV_object_t *dset, transfer_type_t transfer_type, size_t count,
+                                         const hsize_t *offsets[], uint32_t filter_masks[], size_t sizes[],
+                                         void *bufs[]);
+static herr_t RV_dataset_get_chunk_id(const RV_object_t *dset, int ndims, const hsize_t *dims,
+                                      const hsize_t *chunk_dims, const hsize_t *offset, char *chunk_id,
+                                      size_t chunk_id_size);
+
+/* Handles to the datasets whose write-back buffers hold writes not yet sent to the
+ * server. Writes made through every handle to a dataset are held in the buffer of
+ * the handle which buffered the first of them, so that they are sent in order. */
+static RV_object_t **RV_write_buffered_dsets_g        = NULL;
+static size_t        RV_num_write_buffered_dsets_g    = 0;
+static size_t        RV_write_buffered_dsets_nalloc_g = 0;
+
+/* Handles to the datasets holding data read ahead, so that writes through any handle to
+ * a dataset can drop the data read ahead by the others */
+static RV_object_t **RV_read_ahead_dsets_g        = NULL;
+static size_t        RV_num_read_ahead_dsets_g    = 0;
+static size_t        RV_read_ahead_dsets_nalloc_g = 0;
+
 /* JSON keys to retrieve the various creation properties from a dataset */
 const char *creation_properties_keys[]    = {"creationProperties", (const char *)0};
 const char *alloc_time_keys[]             = {"allocTime", (const char *)0};
@@ -89,7 +229,6 @@ const char *value_keys[]                  = {"value", (const char *)0};
 #define DATASET_VLEN_JSON_BODY_DEFAULT_SIZE           512
 
 /* Defines for multi-CURL related settings */
-#define NUM_MAX_HOST_CONNS          10
 #define DELAY_BETWEEN_HANDLE_CHECKS 10000000 /* 10,000,000 ns -> 0.01 sec */
 
 /* Default sizes for strings formed when dealing with turning a
@@ -116,6 +255,12 @@ const char *value_keys[]                  = {"value", (const char *)0};
 /* Query for server to operate on a subset of members in a compound type */
 #define COMPOUND_MEMBER_QUERY "fields="
 
+/* Size of the strips in which read data is type converted before being
+ * scattered into the user's buffer. Small enough that a strip stays in
+ * cache between being converted and being scattered.
+ */
+#define DATASET_TCONV_STRIP_SIZE 262144 /* 256KB */
+
 /*-------------------------------------------------------------------------
  * Function:    RV_dataset_create
  *
@@ -144,17 +289,21 @@ RV_dataset_create(void *obj, const H5VL_loc_params_t *loc_params, const char *na
     long         http_response;
     void        *ret_value = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset create call with following parameters:\n");
-    printf("     - H5Dcreate variant: %s\n", name ? "H5Dcreate2" : "H5Dcreate_anon");
-    if (name)
-        printf("     - Dataset's name: %s\n", name);
-    printf("     - Dataset's parent object URI: %s\n", parent->URI);
-    printf("     - Dataset's parent object type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - Dataset's parent object domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Default DCPL? %s\n", (H5P_DATASET_CREATE_DEFAULT == dcpl_id) ? "yes" : "no");
-    printf("     - Default DAPL? %s\n\n", (H5P_DATASET_ACCESS_DEFAULT == dapl_id) ? "yes" : "no");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset create call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "H5Dcreate variant: %s", name ? "H5Dcreate2" : "H5Dcreate_anon");
+        if (name)
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's name: %s", name);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's parent object URI: %s", parent->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's parent object type: %s",
+                     object_type_to_string(parent->obj_type));
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's parent object domain path: %s",
+                     parent->domain->u.file.filepath_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Default DCPL? %s",
+                     (H5P_DATASET_CREATE_DEFAULT == dcpl_id) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Default DAPL? %s",
+                     (H5P_DATASET_ACCESS_DEFAULT == dapl_id) ? "yes" : "no");
+    } /* end if */
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -177,6 +326,13 @@ RV_dataset_create(void *obj, const H5VL_loc_params_t *loc_params, const char *na
     new_dataset->u.dataset.dapl_id  = FAIL;
     new_dataset->u.dataset.dcpl_id  = FAIL;
 
+    new_dataset->u.dataset.write_buffer_size = 0;
+    new_dataset->u.dataset.write_buffer      = NULL;
+    new_dataset->u.dataset.extent_pending    = FALSE;
+    new_dataset->u.dataset.read_ahead_depth  = 0;
+    new_dataset->u.dataset.read_ahead_size   = 0;
+    new_dataset->u.dataset.read_ahead        = NULL;
+
     new_dataset->domain = parent->domain;
     parent->domain->u.file.ref_count++;
 
@@ -195,6 +351,13 @@ RV_dataset_create(void *obj, const H5VL_loc_params_t *loc_params, const char *na
     else
         new_dataset->u.dataset.dapl_id = H5P_DATASET_ACCESS_DEFAULT;
 
+    if (H5Pget_dapl_rest_write_buffer(dapl_id, &new_dataset->u.dataset.write_buffer_size) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get write-back buffer size");
+
+    if (H5Pget_dapl_rest_read_ahead(dapl_id, &new_dataset->u.dataset.read_ahead_depth,
+                                    &new_dataset->u.dataset.read_ahead_size) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get read-ahead settings");
+
     /* Copy the DCPL if it wasn't H5P_DEFAULT, else set up a default one so that
      * H5Dget_create_plist() will function correctly
      */
@@ -219,48 +382,55 @@ RV_dataset_create(void *obj, const H5VL_loc_params_t *loc_params, const char *na
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, NULL,
                         "dataset create URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Dataset creation request endpoint: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset creation request endpoint: %s", request_endpoint);
 
-    http_response = RV_curl_post(curl, &new_dataset->domain->u.file.server_info, request_endpoint,
-                                 new_dataset->domain->u.file.filepath_name, (const char *)create_request_body,
-                                 create_request_body_len, CONTENT_TYPE_JSON);
+    if (new_dataset->domain->u.file.deferred_create) {
+        /* Assign the dataset's URI now and send the request along with other object creations */
+        if (RV_deferred_create(new_dataset->domain, H5I_DATASET, NULL, (const char *)create_request_body,
+                               new_dataset->URI) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't queue dataset creation");
+    } /* end if */
+    else {
+        http_response = RV_curl_post(curl, &new_dataset->domain->u.file.server_info, request_endpoint,
+                                     new_dataset->domain->u.file.filepath_name,
+                                     (const char *)create_request_body, create_request_body_len,
+                                     CONTENT_TYPE_JSON, "H5Dcreate");
 
-    if (!HTTP_SUCCESS(http_response))
-        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't create dataset, response HTTP %ld",
-                        http_response);
+        if (!HTTP_SUCCESS(http_response))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't create dataset, response HTTP %ld",
+                            http_response);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Created dataset\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Created dataset");
 
-    /* Store the newly-created dataset's URI */
-    if (RV_parse_response(response_buffer.buffer, NULL, new_dataset->URI, RV_copy_object_URI_callback) < 0)
-        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't parse new dataset's URI");
+        /* Store the newly-created dataset's URI */
+        if (RV_parse_response(response_buffer.buffer, NULL, new_dataset->URI, RV_copy_object_URI_callback) <
+            0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't parse new dataset's URI");
+    } /* end else */
 
     if ((new_dataset->u.dataset.dtype_id = H5Tcopy(type_id)) < 0)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, NULL, "failed to copy dataset's datatype");
     if ((new_dataset->u.dataset.space_id = H5Scopy(space_id)) < 0)
         FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "failed to copy dataset's dataspace");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_DATASET]->table, (char *)new_dataset->URI,
-                             (char *)new_dataset) == 0)
+    if (RV_type_info_insert(H5I_DATASET, new_dataset) < 0)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "Failed to add dataset to type info array");
 
     ret_value = (void *)new_dataset;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Dataset create response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (new_dataset && ret_value) {
-        printf("-> New dataset's info:\n");
-        printf("     - New dataset's URI: %s\n", new_dataset->URI);
-        printf("     - New dataset's object type: %s\n", object_type_to_string(new_dataset->obj_type));
-        printf("     - New dataset's domain path: %s\n\n", new_dataset->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_DATASET, "Dataset create response buffer:\n%s", response_buffer.buffer);
+
+        if (new_dataset && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "New dataset's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "New dataset's URI: %s", new_dataset->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "New dataset's object type: %s",
+                         object_type_to_string(new_dataset->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "New dataset's domain path: %s",
+                         new_dataset->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-#endif
 
     if (create_request_body)
         RV_free(create_request_body);
@@ -303,14 +473,13 @@ RV_dataset_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     RV_object_t          *other_dataset   = NULL;
     rv_hash_table_value_t table_value     = RV_HASH_TABLE_NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset open call with following parameters:\n");
-    printf("     - loc_id object's URI: %s\n", parent->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - loc_id object's domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Path to dataset: %s\n", name);
-    printf("     - Default DAPL? %s\n\n", (H5P_DATASET_ACCESS_DEFAULT == dapl_id) ? "yes" : "no");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset open call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "loc_id object's URI: %s", parent->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "loc_id object's type: %s", object_type_to_string(parent->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "loc_id object's domain path: %s", parent->domain->u.file.filepath_name);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Path to dataset: %s", name);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Default DAPL? %s",
+                 (H5P_DATASET_ACCESS_DEFAULT == dapl_id) ? "yes" : "no");
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -329,6 +498,13 @@ RV_dataset_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     dataset->u.dataset.dapl_id  = FAIL;
     dataset->u.dataset.dcpl_id  = FAIL;
 
+    dataset->u.dataset.write_buffer_size = 0;
+    dataset->u.dataset.write_buffer      = NULL;
+    dataset->u.dataset.extent_pending    = FALSE;
+    dataset->u.dataset.read_ahead_depth  = 0;
+    dataset->u.dataset.read_ahead_size   = 0;
+    dataset->u.dataset.read_ahead        = NULL;
+
     /* Copy information about file that the newly-created dataset is in */
     dataset->domain = parent->domain;
     parent->domain->u.file.ref_count++;
@@ -350,16 +526,15 @@ RV_dataset_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name
 
     dataset->domain = loc_info_out.domain;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Found dataset by given path\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Found dataset by given path");
 
     /* Set up a Dataspace for the opened Dataset */
 
     /* If this is another view of an already-opened dataset, make them share the same dataspace
      * so that changes to it (e.g. resizes) are visible to both views */
-    if ((table_value = rv_hash_table_lookup(RV_type_info_array_g[H5I_DATASET]->table, dataset->URI)) !=
-        RV_HASH_TABLE_NULL) {
+    if (RV_type_info_array_g[H5I_DATASET] &&
+        (table_value = rv_hash_table_lookup(RV_type_info_array_g[H5I_DATASET]->table, dataset->URI)) !=
+            RV_HASH_TABLE_NULL) {
         other_dataset   = (RV_object_t *)table_value;
         matching_dspace = other_dataset->u.dataset.space_id;
     }
@@ -387,6 +562,13 @@ RV_dataset_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     else
         dataset->u.dataset.dapl_id = H5P_DATASET_ACCESS_DEFAULT;
 
+    if (H5Pget_dapl_rest_write_buffer(dapl_id, &dataset->u.dataset.write_buffer_size) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get write-back buffer size");
+
+    if (H5Pget_dapl_rest_read_ahead(dapl_id, &dataset->u.dataset.read_ahead_depth,
+                                    &dataset->u.dataset.read_ahead_size) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get read-ahead settings");
+
     /* Set up a DCPL for the dataset so that H5Dget_create_plist() will function correctly */
     if ((dataset->u.dataset.dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, NULL, "can't create DCPL for dataset");
@@ -397,25 +579,26 @@ RV_dataset_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL,
                         "can't parse dataset's creation properties from JSON representation");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_DATASET]->table, (char *)dataset->URI,
-                             (char *)dataset) == 0)
+    if (RV_type_info_insert(H5I_DATASET, dataset) < 0)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "Failed to add dataset to type info array");
 
     ret_value = (void *)dataset;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Dataset open response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (dataset && ret_value) {
-        printf("-> Dataset's info:\n");
-        printf("     - Dataset's URI: %s\n", dataset->URI);
-        printf("     - Dataset's object type: %s\n", object_type_to_string(dataset->obj_type));
-        printf("     - Dataset's domain path: %s\n", dataset->domain->u.file.filepath_name);
-        printf("     - Dataset's datatype class: %s\n\n",
-               datatype_class_to_string(dataset->u.dataset.dtype_id));
-    }
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_DATASET, "Dataset open response buffer:\n%s", response_buffer.buffer);
+
+        if (dataset && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's URI: %s", dataset->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's object type: %s",
+                         object_type_to_string(dataset->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's domain path: %s",
+                         dataset->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's datatype class: %s",
+                         datatype_class_to_string(dataset->u.dataset.dtype_id));
+        }
+    } /* end if */
 
     /* Clean up allocated dataset object if there was an issue */
     if (dataset && !ret_value)
@@ -434,6 +617,12 @@ done:
  *              memory dataspace by making the appropriate REST API call to
  *              the server.
  *
+ *              If a dataset has read-ahead enabled, reads which move a
+ *              single block of it are served from the data its handle
+ *              read ahead, when they can be. Reads which can't, but
+ *              which continue a sequential scan of the dataset, are
+ *              widened to also read the blocks the scan will read next.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -442,6 +631,159 @@ done:
 herr_t
 RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_space_id[],
                 hid_t _file_space_id[], hid_t dxpl_id, void *buf[], void **req)
+{
+    RV_read_ahead_read_t *ahead_reads    = NULL;
+    void                **read_dsets     = NULL;
+    hid_t                *mem_type_ids   = NULL;
+    hid_t                *mem_space_ids  = NULL;
+    hid_t                *file_space_ids = NULL;
+    void                **bufs           = NULL;
+    size_t                num_reads      = 0;
+    size_t                num_ahead      = 0;
+    herr_t                ret_value      = SUCCEED;
+
+    if (NULL == (ahead_reads = RV_calloc(count * sizeof(*ahead_reads))) ||
+        NULL == (read_dsets = RV_malloc(count * sizeof(*read_dsets))) ||
+        NULL == (mem_type_ids = RV_malloc(count * sizeof(*mem_type_ids))) ||
+        NULL == (mem_space_ids = RV_malloc(count * sizeof(*mem_space_ids))) ||
+        NULL == (file_space_ids = RV_malloc(count * sizeof(*file_space_ids))) ||
+        NULL == (bufs = RV_malloc(count * sizeof(*bufs))))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset reads");
+
+    for (size_t i = 0; i < count; i++) {
+        RV_object_t          *_dset = (RV_object_t *)dset[i];
+        RV_read_ahead_read_t *ahead = &ahead_reads[num_ahead];
+        hbool_t               sequential;
+        htri_t                is_block;
+        htri_t                served;
+        htri_t                widened = FALSE;
+
+        if (!_dset)
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given dataset was NULL");
+        if (!buf[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given read buffer was NULL");
+        if (H5I_DATASET != _dset->obj_type)
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+        read_dsets[num_reads]     = _dset;
+        mem_type_ids[num_reads]   = mem_type_id[i];
+        mem_space_ids[num_reads]  = _mem_space_id[i];
+        file_space_ids[num_reads] = _file_space_id[i];
+        bufs[num_reads]           = buf[i];
+
+        if (!_dset->u.dataset.read_ahead_depth || !_dset->u.dataset.read_ahead_size) {
+            num_reads++;
+            continue;
+        }
+
+        if ((is_block = RV_dataset_get_selection_block(_dset, mem_type_id[i], _file_space_id[i], &ahead->rank,
+                                                       ahead->start, ahead->count)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
+                            "can't check whether selection is a single block");
+        if (!is_block) {
+            num_reads++;
+            continue;
+        }
+
+        if (!_dset->u.dataset.read_ahead) {
+            if (NULL == (_dset->u.dataset.read_ahead = RV_calloc(sizeof(RV_read_ahead_t))))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate read-ahead state");
+
+            _dset->u.dataset.read_ahead->rank = 0;
+            _dset->u.dataset.read_ahead->axis = -1;
+            _dset->u.dataset.read_ahead->data = NULL;
+        }
+
+        sequential =
+            RV_read_ahead_track(_dset->u.dataset.read_ahead, ahead->rank, ahead->start, ahead->count);
+
+        if ((served = RV_read_ahead_serve(_dset, ahead->start, ahead->count, mem_type_id[i], _mem_space_id[i],
+                                          _file_space_id[i], buf[i])) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't serve read from data read ahead");
+        if (served)
+            continue;
+
+        if (sequential && (widened = RV_read_ahead_get_block(_dset, ahead->start, ahead->count,
+                                                             ahead->ahead_start, ahead->ahead_count)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't determine block to read ahead");
+        if (!widened) {
+            num_reads++;
+            continue;
+        }
+
+        /* Read the whole block in the dataset's datatype in place of the requested block */
+        ahead->index         = i;
+        ahead->mem_space_id  = H5I_INVALID_HID;
+        ahead->file_space_id = H5I_INVALID_HID;
+        num_ahead++;
+
+        if (RV_read_ahead_setup_read(_dset, ahead) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up read ahead of dataset");
+
+        mem_type_ids[num_reads]   = _dset->u.dataset.dtype_id;
+        mem_space_ids[num_reads]  = ahead->mem_space_id;
+        file_space_ids[num_reads] = ahead->file_space_id;
+        bufs[num_reads]           = ahead->data;
+        num_reads++;
+    }
+
+    if (num_reads && RV_dataset_read_unbuffered(num_reads, read_dsets, mem_type_ids, mem_space_ids,
+                                                file_space_ids, dxpl_id, bufs) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read from dataset");
+
+    /* Keep the data read ahead and serve the widened reads from it */
+    for (size_t i = 0; i < num_ahead; i++) {
+        RV_read_ahead_read_t *ahead = &ahead_reads[i];
+        RV_object_t          *_dset = (RV_object_t *)dset[ahead->index];
+        htri_t                served;
+
+        if (RV_read_ahead_store(_dset, ahead) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't keep data read ahead");
+
+        if ((served = RV_read_ahead_serve(_dset, ahead->start, ahead->count, mem_type_id[ahead->index],
+                                          _mem_space_id[ahead->index], _file_space_id[ahead->index],
+                                          buf[ahead->index])) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't serve read from data read ahead");
+        if (!served)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "data read ahead doesn't cover read");
+    }
+
+done:
+    for (size_t i = 0; i < num_ahead; i++) {
+        if (ahead_reads[i].mem_space_id >= 0 && H5Sclose(ahead_reads[i].mem_space_id) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close memory dataspace");
+        if (ahead_reads[i].file_space_id >= 0 && H5Sclose(ahead_reads[i].file_space_id) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close file dataspace");
+
+        RV_free(ahead_reads[i].data);
+    }
+
+    RV_free(ahead_reads);
+    RV_free(read_dsets);
+    RV_free(mem_type_ids);
+    RV_free(mem_space_ids);
+    RV_free(file_space_ids);
+    RV_free(bufs);
+
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end RV_dataset_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_read_unbuffered
+ *
+ * Purpose:     Reads data from HDF5 datasets on the server, bypassing
+ *              the data their handles read ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              March, 2017
+ */
+static herr_t
+RV_dataset_read_unbuffered(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_space_id[],
+                           hid_t _file_space_id[], hid_t dxpl_id, void *buf[])
 {
     H5T_class_t            dtype_class;
     hbool_t                is_transfer_binary = FALSE;
@@ -459,6 +801,15 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
     if ((transfer_info = RV_calloc(count * sizeof(dataset_transfer_info))) == NULL)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset transfer info");
 
+    /* Send any buffered writes which the reads overlap, so that the reads see them */
+    for (size_t i = 0; i < count; i++)
+        if (dset[i] && RV_dataset_flush_write_buffer((RV_object_t *)dset[i], _file_space_id[i]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    /* Transfer handles are duplicated from the global handle, so make sure its access token is current */
+    if (RV_refresh_access_token() < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't refresh access token");
+
     /* Always perform the write using a multi handle, even if it's only to one dataset */
     curl_multi_handle = curl_multi_init();
 
@@ -469,6 +820,10 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
 
         transfer_info[i].curl_easy_handle = curl_easy_duphandle(curl);
 
+        /* Spread the transfers across local server nodes, if connecting through local sockets */
+        if (RV_set_socket_path(transfer_info[i].curl_easy_handle) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set socket path for transfer");
+
         if ((transfer_info[i].request_url = calloc(URL_MAX_LENGTH, sizeof(char))) == NULL)
             FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failed to allocate memory for request URLs");
 
@@ -503,21 +858,22 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
         transfer_info[i].bkg_buf                  = NULL;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset read call with following parameters:\n");
-    for (size_t i = 0; i < count; i++) {
-        printf("     - Dataset %zu's URI: %s\n", i, transfer_info[i].dataset->URI);
-        printf("     - Dataset %zu's object type: %s\n", i,
-               object_type_to_string(transfer_info[i].dataset->obj_type));
-        printf("     - Dataset %zu's domain path: %s\n", i,
-               transfer_info[i].dataset->domain->u.file.filepath_name);
-        printf("     - Entire memory dataspace selected? %s\n",
-               (transfer_info[i].mem_space_id == H5S_ALL) ? "yes" : "no");
-        printf("     - Entire file dataspace selected? %s\n",
-               (transfer_info[i].file_space_id == H5S_ALL) ? "yes" : "no");
-    }
-    printf("     - Default DXPL? %s\n\n", (dxpl_id == H5P_DATASET_XFER_DEFAULT) ? "yes" : "no");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_TRANSFER, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Received dataset read call with following parameters:");
+        for (size_t i = 0; i < count; i++) {
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset %zu's URI: %s", i, transfer_info[i].dataset->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset %zu's object type: %s", i,
+                         object_type_to_string(transfer_info[i].dataset->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset %zu's domain path: %s", i,
+                         transfer_info[i].dataset->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Entire memory dataspace selected? %s",
+                         (transfer_info[i].mem_space_id == H5S_ALL) ? "yes" : "no");
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Entire file dataspace selected? %s",
+                         (transfer_info[i].file_space_id == H5S_ALL) ? "yes" : "no");
+        }
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Default DXPL? %s",
+                     (dxpl_id == H5P_DATASET_XFER_DEFAULT) ? "yes" : "no");
+    } /* end if */
 
     /* Iterate over datasets to read from */
     for (size_t i = 0; i < count; i++) {
@@ -606,10 +962,10 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
                             "memory selection num points != file selection num points");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> %" PRIuHSIZE "points selected in file dataspace\n", file_select_npoints);
-        printf("-> %" PRIuHSIZE "points selected in memory dataspace\n\n", mem_select_npoints);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "%" PRIuHSIZE " points selected in file dataspace",
+                     file_select_npoints);
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "%" PRIuHSIZE " points selected in memory dataspace",
+                     mem_select_npoints);
 
         /* Setup the host header */
         host_header_len =
@@ -650,9 +1006,7 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
             FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
                             "dataset read URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Dataset read URL: %s\n\n", transfer_info[i].request_url);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset read URL: %s", transfer_info[i].request_url);
 
         /* If using a point selection, instruct cURL to perform a POST request
          * in order to post the point list. Otherwise, a simple GET request
@@ -696,9 +1050,7 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
                                                                   "Content-Type: application/octet-stream");
             }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setup cURL to POST point list for dataset read\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Setup cURL to POST point list for dataset read");
         } /* end if */
         else {
             if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_HTTPGET, 1))
@@ -721,9 +1073,7 @@ RV_dataset_read(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spac
                             transfer_info[i].curl_err_buf);
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Reading dataset\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Reading dataset");
 
     if (CURLM_OK != curl_multi_setopt(curl_multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, NUM_MAX_HOST_CONNS))
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL,
@@ -759,10 +1109,8 @@ done:
     curl_multi_cleanup(curl_multi_handle);
     RV_free(transfer_info);
 
-    PRINT_ERROR_STACK;
-
     return ret_value;
-} /* end RV_dataset_read() */
+} /* end RV_dataset_read_unbuffered() */
 
 /*-------------------------------------------------------------------------
  * Function:    RV_dataset_write
@@ -771,6 +1119,12 @@ done:
  *              memory dataspace by making the appropriate REST API call to
  *              the server.
  *
+ *              If every dataset written to has a write-back buffer and
+ *              each write can be held back in it, the writes are buffered
+ *              rather than sent. Otherwise, any writes buffered earlier
+ *              which the new writes overlap are sent first, so that the
+ *              server applies them in order.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -779,11 +1133,79 @@ done:
 herr_t
 RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_space_id[],
                  hid_t _file_space_id[], hid_t dxpl_id, const void *buf[], void **req)
+{
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t block_count[H5S_MAX_RANK];
+    htri_t  can_buffer = TRUE;
+    int     rank       = 0;
+    herr_t  ret_value  = SUCCEED;
+
+    /* Check whether every write can be held back in its dataset's write-back buffer */
+    for (size_t i = 0; i < count && can_buffer; i++) {
+        if (!buf[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "a given write buffer was NULL");
+
+        if (!dset[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given dataset was NULL");
+
+        if (!(((RV_object_t *)dset[i])->domain->u.file.intent & H5F_ACC_RDWR))
+            FUNC_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+        if (H5I_DATASET != ((RV_object_t *)dset[i])->obj_type)
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+        if (RV_read_ahead_invalidate((RV_object_t *)dset[i], _file_space_id[i]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't drop data read ahead of dataset");
+
+        if ((can_buffer = RV_write_buffer_get_block((RV_object_t *)dset[i], mem_type_id[i], _file_space_id[i],
+                                                    &rank, start, block_count)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check whether write can be buffered");
+    }
+
+    if (can_buffer) {
+        for (size_t i = 0; i < count; i++)
+            if (RV_write_buffer_add((RV_object_t *)dset[i], mem_type_id[i], _mem_space_id[i],
+                                    _file_space_id[i], buf[i]) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't buffer write to dataset");
+
+        FUNC_GOTO_DONE(SUCCEED);
+    }
+
+    /* Otherwise, send any buffered writes which these writes overlap before them */
+    for (size_t i = 0; i < count; i++)
+        if (dset[i] && RV_dataset_flush_write_buffer((RV_object_t *)dset[i], _file_space_id[i]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    if (RV_dataset_write_unbuffered(count, dset, mem_type_id, _mem_space_id, _file_space_id, dxpl_id, buf) <
+        0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write to dataset");
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end RV_dataset_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_write_unbuffered
+ *
+ * Purpose:     Sends writes to HDF5 datasets to the server, bypassing
+ *              their write-back buffers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              March, 2017
+ */
+static herr_t
+RV_dataset_write_unbuffered(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_space_id[],
+                            hid_t _file_space_id[], hid_t dxpl_id, const void *buf[])
 {
     H5S_sel_type           sel_type = H5S_SEL_ALL;
     H5T_class_t            dtype_class;
-    hbool_t                is_transfer_binary  = FALSE;
-    htri_t                 is_write_contiguous = FALSE;
+    hbool_t                is_transfer_binary    = FALSE;
+    hbool_t                is_binary_point_write = FALSE;
+    htri_t                 is_write_contiguous   = FALSE;
     htri_t                 is_variable_str;
     hssize_t               mem_select_npoints  = 0;
     hssize_t               file_select_npoints = 0;
@@ -807,12 +1229,20 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
 
     hbool_t has_selection_in_url = FALSE;
     char    cmpd_query[URL_MAX_LENGTH];
+    char    point_count[32];
     char   *member_name             = NULL;
     char   *url_encoded_member_name = NULL;
 
+    const char *selection_query_prefix = NULL;
+    const char *selection_query        = NULL;
+
     if ((transfer_info = RV_calloc(count * sizeof(dataset_transfer_info))) == NULL)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset transfer info");
 
+    /* Transfer handles are duplicated from the global handle, so make sure its access token is current */
+    if (RV_refresh_access_token() < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't refresh access token");
+
     /* Always perform the write using a multi handle, even if it's only to one dataset */
     curl_multi_handle = curl_multi_init();
 
@@ -833,6 +1263,10 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
 
         transfer_info[i].curl_easy_handle = curl_easy_duphandle(curl);
 
+        /* Spread the transfers across local server nodes, if connecting through local sockets */
+        if (RV_set_socket_path(transfer_info[i].curl_easy_handle) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set socket path for transfer");
+
         if ((transfer_info[i].request_url = calloc(URL_MAX_LENGTH, sizeof(char))) == NULL)
             FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failed to allocate memory for request URLs");
 
@@ -879,23 +1313,25 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
         transfer_info[i].u.write_info.uinfo.bytes_sent           = 0;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset %swrite call with following parameters:\n", (count > 1) ? "multi-" : "");
-
-    for (size_t i = 0; i < count; i++) {
-        printf("     - Dataset%zu's URI: %s\n", i, transfer_info[i].dataset->URI);
-        printf("     - Dataset%zu's object type: %s\n", i,
-               object_type_to_string(transfer_info[i].dataset->obj_type));
-        printf("     - Dataset%zu's domain path: %s\n", i,
-               transfer_info[i].dataset->domain->u.file.filepath_name);
-        printf("     - Entire memory dataspace selected? %s\n",
-               (transfer_info[i].mem_space_id == H5S_ALL) ? "yes" : "no");
-        printf("     - Entire file dataspace selected? %s\n",
-               (transfer_info[i].file_space_id == H5S_ALL) ? "yes" : "no");
-    }
-    printf("     - Default DXPL? %s\n", (dxpl_id == H5P_DATASET_XFER_DEFAULT) ? "yes" : "no");
-    printf("     - Multi-write? %s\n", (count > 1) ? "yes" : "no");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_TRANSFER, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Received dataset %swrite call with following parameters:",
+                     (count > 1) ? "multi-" : "");
+
+        for (size_t i = 0; i < count; i++) {
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset%zu's URI: %s", i, transfer_info[i].dataset->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset%zu's object type: %s", i,
+                         object_type_to_string(transfer_info[i].dataset->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset%zu's domain path: %s", i,
+                         transfer_info[i].dataset->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Entire memory dataspace selected? %s",
+                         (transfer_info[i].mem_space_id == H5S_ALL) ? "yes" : "no");
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Entire file dataspace selected? %s",
+                         (transfer_info[i].file_space_id == H5S_ALL) ? "yes" : "no");
+        }
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Default DXPL? %s",
+                     (dxpl_id == H5P_DATASET_XFER_DEFAULT) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Multi-write? %s", (count > 1) ? "yes" : "no");
+    } /* end if */
 
     /* Iterate over datasets to write to */
     for (size_t i = 0; i < count; i++) {
@@ -908,10 +1344,12 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "a given memory datatype is invalid");
 
         /* Only perform a binary transfer for fixed-length datatype datasets with an
-         * All or Hyperslab selection. Point selections are dealt with by POSTing the
-         * point list as JSON in the request body.
+         * All or Hyperslab selection, or with a Point selection if the server accepts
+         * binary point lists. Otherwise, point selections are dealt with by sending
+         * the point list as JSON in the request body.
          */
-        is_transfer_binary = !is_variable_str;
+        is_transfer_binary    = !is_variable_str;
+        is_binary_point_write = FALSE;
 
         /* Follow the semantics for the use of H5S_ALL */
         if (H5S_ALL == transfer_info[i].mem_space_id && H5S_ALL == transfer_info[i].file_space_id) {
@@ -963,17 +1401,29 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
                 FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace selection type");
 
             /* Only perform a binary transfer for fixed-length datatype datasets with an
-             * All or Hyperslab selection. Point selections are dealt with by POSTing the
-             * point list as JSON in the request body.
+             * All or Hyperslab selection, or with a Point selection if the server is able
+             * to accept the point list and values together as a single binary body.
              */
-            is_transfer_binary = is_transfer_binary && (H5S_SEL_POINTS != sel_type);
+            is_binary_point_write = is_transfer_binary && (H5S_SEL_POINTS == sel_type) &&
+                                    (SERVER_SUPPORTS_BINARY_POINT_WRITE(
+                                        transfer_info[i].dataset->domain->u.file.server_info.version));
+            is_transfer_binary = is_transfer_binary && ((H5S_SEL_POINTS != sel_type) || is_binary_point_write);
 
             /* Since the selection in the dataset's file dataspace is not set
-             * to "all", convert the selection into a string */
-            if (RV_convert_dataspace_selection_to_string(transfer_info[i].file_space_id, &selection_body,
-                                                         &selection_body_len, is_transfer_binary) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCONVERT, FAIL,
-                                "can't convert dataspace selection to string representation");
+             * to "all", convert the selection into a string, or into a packed
+             * list of coordinates for binary point selection writes */
+            if (is_binary_point_write) {
+                if (RV_convert_point_selection_to_binary(transfer_info[i].file_space_id,
+                                                         (void **)&selection_body, &selection_body_len) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCONVERT, FAIL,
+                                    "can't convert point selection to binary form");
+            }
+            else {
+                if (RV_convert_dataspace_selection_to_string(transfer_info[i].file_space_id, &selection_body,
+                                                             &selection_body_len, is_transfer_binary) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCONVERT, FAIL,
+                                    "can't convert dataspace selection to string representation");
+            }
         } /* end else */
 
         /* Verify that the number of selected points matches */
@@ -985,10 +1435,10 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
                             "memory selection num points != file selection num points");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> %" PRIuHSIZE "points selected in file dataspace\n", file_select_npoints);
-        printf("-> %" PRIuHSIZE "points selected in memory dataspace\n\n", mem_select_npoints);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "%" PRIuHSIZE " points selected in file dataspace",
+                     file_select_npoints);
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "%" PRIuHSIZE " points selected in memory dataspace",
+                     mem_select_npoints);
 
         if ((file_type_size = H5Tget_size(transfer_info[i].file_type_id)) == 0)
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of file datatype");
@@ -1020,9 +1470,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
         dest_dtype_size = file_type_size;
 
         if (needs_tconv) {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning type conversion for write\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Beginning type conversion for write");
             RV_subset_t subset_type = H5T_SUBSET_BADVALUE;
             hid_t       dest_dtype  = H5I_INVALID_HID;
 
@@ -1060,7 +1508,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             /* Initialize type conversion */
             RV_tconv_init(transfer_info[i].mem_type_id, &mem_type_size, dest_dtype, &dest_dtype_size,
                           (size_t)file_select_npoints, TRUE, FALSE, &transfer_info[i].tconv_buf,
-                          &transfer_info[i].bkg_buf, NULL, &fill_bkg);
+                          &transfer_info[i].bkg_buf, NULL, FALSE, &fill_bkg);
 
             /* Copy memory to avoid modifying user-provided write buffer */
             memset(transfer_info[i].tconv_buf, 0, file_type_size * (size_t)mem_select_npoints);
@@ -1146,7 +1594,24 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             transfer_info[i].curl_headers,
             is_transfer_binary ? "Content-Type: application/octet-stream" : "Content-Type: application/json");
 
-        has_selection_in_url = is_transfer_binary && selection_body && (H5S_SEL_POINTS != sel_type);
+        has_selection_in_url =
+            is_transfer_binary && selection_body && ((H5S_SEL_POINTS != sel_type) || is_binary_point_write);
+
+        /* A binary point write gives its number of points, so that the server doesn't have to infer it
+         * from the size of the body, which can be the same as that of a write of the whole dataset */
+        if (is_binary_point_write) {
+            snprintf(point_count, sizeof(point_count), "%" PRIuHSIZE, (hsize_t)file_select_npoints);
+            selection_query_prefix = "?" POINT_COUNT_QUERY;
+            selection_query        = point_count;
+        }
+        else if (has_selection_in_url) {
+            selection_query_prefix = "?select=";
+            selection_query        = selection_body;
+        }
+        else {
+            selection_query_prefix = "";
+            selection_query        = "";
+        }
 
         /* Redirect cURL from the base URL to "/datasets/<id>/value" to write the value out */
         if (is_compound_subset) {
@@ -1227,8 +1692,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
 
         if ((url_len = snprintf(transfer_info[i].request_url, URL_MAX_LENGTH, "%s/datasets/%s/value%s%s%s",
                                 transfer_info[i].dataset->domain->u.file.server_info.base_URL,
-                                transfer_info[i].dataset->URI, has_selection_in_url ? "?select=" : "",
-                                has_selection_in_url ? selection_body : "",
+                                transfer_info[i].dataset->URI, selection_query_prefix, selection_query,
                                 is_compound_subset ? cmpd_query : "") < 0))
 
             FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
@@ -1237,14 +1701,29 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
                             "dataset write URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Dataset write URL: %s\n\n", transfer_info[0].request_url);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset write URL: %s", transfer_info[0].request_url);
 
         /* If using a point selection, add the selection body
-         * into the write body sent to server.
+         * into the write body sent to server. When the server
+         * supports it, the body is the packed list of point
+         * coordinates followed directly by the packed values,
+         * and the number of points is given in the URL.
          */
-        if (H5S_SEL_POINTS == sel_type) {
+        if (is_binary_point_write) {
+            if (NULL == (transfer_info[i].u.write_info.point_sel_buf =
+                             RV_malloc(selection_body_len + write_body_len)))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for write buffer");
+
+            memcpy(transfer_info[i].u.write_info.point_sel_buf, selection_body, selection_body_len);
+            memcpy((char *)transfer_info[i].u.write_info.point_sel_buf + selection_body_len,
+                   transfer_info[i].u.write_info.uinfo.buffer, write_body_len);
+
+            transfer_info[i].u.write_info.uinfo.buffer = transfer_info[i].u.write_info.point_sel_buf;
+            write_body_len += selection_body_len;
+
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Setup cURL to send binary point list for dataset write");
+        }
+        else if (H5S_SEL_POINTS == sel_type) {
             const char *const fmt_string = "{%s,\"value_base64\": \"%s\"}";
             size_t            value_body_len;
             int               bytes_printed;
@@ -1264,10 +1743,8 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
                                  &value_body_len) < 0)
                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't base64-encode write buffer");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Base64-encoded data buffer for dataset %zu: %s\n\n", i,
-                   (char *)transfer_info[i].u.write_info.base64_encoded_values);
-#endif
+            RV_LOG_TRACE(RV_LOG_CAT_TRANSFER, "Base64-encoded data buffer for dataset %zu: %s", i,
+                         (char *)transfer_info[i].u.write_info.base64_encoded_values);
             /* Copy encoded values into format string */
             write_body_len = (strlen(fmt_string) - 4) + selection_body_len + value_body_len;
             if (NULL == (transfer_info[i].u.write_info.point_sel_buf = RV_malloc(write_body_len + 1)))
@@ -1287,9 +1764,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
             transfer_info[i].curl_headers =
                 curl_slist_append(transfer_info[i].curl_headers, "Content-Type: application/json");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setup cURL to POST point list for dataset write\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Setup cURL to POST point list for dataset write");
         }
 
         transfer_info[i].u.write_info.uinfo.buffer_size = write_body_len;
@@ -1337,9 +1812,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
 
     } /* End iteration over dsets to write to */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Writing dataset\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Writing dataset");
 
     if (CURLM_OK != curl_multi_setopt(curl_multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, NUM_MAX_HOST_CONNS))
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL,
@@ -1349,9 +1822,7 @@ RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t _mem_spa
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to perform dataset write");
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Dataset write response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_TRANSFER, "Dataset write response buffer:\n%s", response_buffer.buffer);
 
     for (size_t i = 0; i < count; i++) {
         if (transfer_info[i].curl_headers) {
@@ -1441,10 +1912,8 @@ done:
         if (H5free_memory((void *)member_name) < 0)
             FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't free datatype member name");
 
-    PRINT_ERROR_STACK;
-
     return ret_value;
-} /* end RV_dataset_write() */
+} /* end RV_dataset_write_unbuffered() */
 
 /*-------------------------------------------------------------------------
  * Function:    RV_dataset_get
@@ -1463,19 +1932,15 @@ RV_dataset_get(void *obj, H5VL_dataset_get_args_t *args, hid_t dxpl_id, void **r
     RV_object_t *dset      = (RV_object_t *)obj;
     herr_t       ret_value = SUCCEED;
 
-    H5VL_file_specific_args_t vol_flush_args;
-    size_t                    host_header_len = 0;
-    char                     *host_header     = NULL;
-    char                      request_endpoint[URL_MAX_LENGTH];
-    const char               *base_URL = NULL;
+    size_t      host_header_len = 0;
+    char       *host_header     = NULL;
+    const char *base_URL        = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset get call with following parameters:\n");
-    printf("     - Dataset get call type: %s\n", dataset_get_type_to_string(args->op_type));
-    printf("     - Dataset's URI: %s\n", dset->URI);
-    printf("     - Dataset's object type: %s\n", object_type_to_string(dset->obj_type));
-    printf("     - Dataset's domain path: %s\n\n", dset->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset get call type: %s", dataset_get_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's URI: %s", dset->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's object type: %s", object_type_to_string(dset->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's domain path: %s", dset->domain->u.file.filepath_name);
 
     if (H5I_DATASET != dset->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
@@ -1518,30 +1983,9 @@ RV_dataset_get(void *obj, H5VL_dataset_get_args_t *args, hid_t dxpl_id, void **r
 
         /* H5Dget_storage_size */
         case H5VL_DATASET_GET_STORAGE_SIZE:
-
-            if (!(SERVER_VERSION_SUPPORTS_GET_STORAGE_SIZE(dset->domain->u.file.server_info.version)))
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
-                                "H5Dget_storage_size requires HSDS 0.8.5 or higher");
-
-            /* First, flush domain to make server update allocated bytes */
-            vol_flush_args.op_type             = H5VL_FILE_FLUSH;
-            vol_flush_args.args.flush.obj_type = H5I_FILE;
-            vol_flush_args.args.flush.scope    = H5F_SCOPE_LOCAL;
-
-            if (RV_file_specific((void *)dset->domain, &vol_flush_args, H5P_DEFAULT, NULL) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't flush datase's domain");
-
-            /* Make GET request to dataset with 'verbose' parameter for HSDS. */
-            snprintf(request_endpoint, URL_MAX_LENGTH, "%s%s%s", "/datasets/", dset->URI, "?verbose=1");
-
-            if (RV_curl_get(curl, &dset->domain->u.file.server_info, request_endpoint,
-                            dset->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset");
-
-            if (RV_parse_allocated_size_cb(response_buffer.buffer, NULL,
-                                           args->args.get_storage_size.storage_size) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_PARSEERROR, FAIL,
-                                "can't get allocated size from server response");
+            if (RV_dataset_get_storage_sizes(dset->domain, 1, &dset,
+                                             args->args.get_storage_size.storage_size) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get storage size of dataset");
 
             break;
 
@@ -1580,26 +2024,18 @@ done:
 herr_t
 RV_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid_t dxpl_id, void **req)
 {
-    RV_object_t *dset               = (RV_object_t *)obj;
-    herr_t       ret_value          = SUCCEED;
-    size_t       host_header_len    = 0;
-    char        *host_header        = NULL;
-    char        *request_body       = NULL;
-    char        *request_body_shape = NULL;
-    char         request_url[URL_MAX_LENGTH];
-    int          url_len       = 0;
+    RV_object_t *dset          = (RV_object_t *)obj;
+    herr_t       ret_value     = SUCCEED;
     hid_t        new_dspace_id = H5I_INVALID_HID;
     hsize_t     *old_extent    = NULL;
     hsize_t     *maxdims       = NULL;
-    upload_info  uinfo;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset-specific call with following parameters:\n");
-    printf("     - Dataset-specific call type: %s\n", dataset_specific_type_to_string(args->op_type));
-    printf("     - Dataset's URI: %s\n", dset->URI);
-    printf("     - Dataset's object type: %s\n", object_type_to_string(dset->obj_type));
-    printf("     - Dataset's domain path: %s\n\n", dset->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset-specific call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset-specific call type: %s",
+                 dataset_specific_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's URI: %s", dset->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's object type: %s", object_type_to_string(dset->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's domain path: %s", dset->domain->u.file.filepath_name);
 
     if (H5I_DATASET != dset->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
@@ -1620,6 +2056,13 @@ RV_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid_t dxpl_id
 
             new_extent = args->args.set_extent.size;
 
+            /* Send any buffered writes while they're still within the dataset's extent */
+            if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+            if (RV_read_ahead_invalidate(dset, H5S_ALL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't drop data read ahead of dataset");
+
             /* Do some checks on the dataspace before changing extent */
             if ((ndims = H5Sget_simple_extent_ndims(dset->u.dataset.space_id)) < 0)
                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "failed to get number of dataset dimensions");
@@ -1632,230 +2075,2411 @@ RV_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid_t dxpl_id
                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                                 "failed to allocate memory for dataset max shape");
 
-            if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, old_extent, maxdims) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "failed to get dataset dimensions");
+            if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, old_extent, maxdims) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "failed to get dataset dimensions");
+
+            for (size_t i = 0; i < (size_t)ndims; i++)
+                if (new_extent[i] > maxdims[i])
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                                    "new dataset dimensions exceed maximum dimensions");
+
+            if ((layout = H5Pget_layout(dset->u.dataset.dcpl_id)) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_PLIST, FAIL, "can't get layout from DCPL");
+
+            if (layout != H5D_CHUNKED)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "non-chunked datasets cannot be resized");
+
+            if (RV_dataset_put_extent(dset, ndims, new_extent) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't change extent of dataset on server");
+
+            /* Modify local dataspace to match version on server */
+            if (H5Sset_extent_simple(dset->u.dataset.space_id, ndims, new_extent, maxdims) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_DATASPACE, FAIL,
+                                "unable to modify extent of local dataspace");
+
+            break;
+        }
+
+        /* H5Dflush */
+        case H5VL_DATASET_FLUSH:
+            if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't send buffered writes to dataset");
+            break;
+
+        /* H5Drefresh */
+        case H5VL_DATASET_REFRESH: {
+            /* Send any buffered writes first, so that appends still held back aren't lost */
+            if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+            /* The dataset may have been written to by other clients since its data was read ahead */
+            if (RV_read_ahead_invalidate(dset, H5S_ALL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't drop data read ahead of dataset");
+
+            if (RV_dataset_get_extent(dset) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset's extent from server");
+
+            break;
+        }
+
+        default:
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unknown dataset operation");
+    } /* end switch */
+
+done:
+    PRINT_ERROR_STACK;
+
+    if ((ret_value < 0) && (new_dspace_id != H5I_INVALID_HID))
+        H5Sclose(new_dspace_id);
+
+    RV_free(old_extent);
+    RV_free(maxdims);
+
+    return ret_value;
+} /* end RV_dataset_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_optional
+ *
+ * Purpose:     Performs a connector-specific operation on an HDF5
+ *              dataset, such as reading or writing a chunk directly with
+ *              H5Dread_chunk() or H5Dwrite_chunk()
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **req)
+{
+    RV_object_t                *dset      = (RV_object_t *)obj;
+    RV_dataset_optional_args_t *opt_args  = (RV_dataset_optional_args_t *)args->args;
+    herr_t                      ret_value = SUCCEED;
+
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset-optional call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset-optional call type: %s",
+                 dataset_optional_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's URI: %s", dset->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's domain path: %s", dset->domain->u.file.filepath_name);
+
+    if (H5I_DATASET != dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+    switch (args->op_type) {
+        /* H5Dread_chunk */
+        case H5VL_NATIVE_DATASET_CHUNK_READ: {
+            const hsize_t *offset = opt_args->chunk_read.offset;
+
+            if (RV_dataset_read_chunks(dset, 1, &offset, &opt_args->chunk_read.filters, NULL,
+                                       &opt_args->chunk_read.buf) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunk from dataset");
+
+            break;
+        }
+
+        /* H5Dwrite_chunk */
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE: {
+            const hsize_t *offset = opt_args->chunk_write.offset;
+            size_t         size   = (size_t)opt_args->chunk_write.size;
+
+            if (RV_dataset_write_chunks(dset, 1, &offset, &opt_args->chunk_write.filters, &size,
+                                        &opt_args->chunk_write.buf) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunk to dataset");
+
+            break;
+        }
+
+        default:
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unsupported optional dataset operation");
+    } /* end switch */
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end RV_dataset_optional() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_close
+ *
+ * Purpose:     Closes an HDF5 dataset by freeing the memory allocated for
+ *              its internal memory struct object. There is no interaction
+ *              with the server, whose state is unchanged.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              March, 2017
+ */
+herr_t
+RV_dataset_close(void *dset, hid_t dxpl_id, void **req)
+{
+    RV_object_t *_dset     = (RV_object_t *)dset;
+    herr_t       ret_value = SUCCEED;
+
+    if (!_dset)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Received dataset close call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's URI: %s", _dset->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's object type: %s", object_type_to_string(_dset->obj_type));
+        if (_dset->domain && _dset->domain->u.file.filepath_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Dataset's domain path: %s",
+                         _dset->domain->u.file.filepath_name);
+    } /* end if */
+
+    if (H5I_DATASET != _dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+    /* Send any writes still held back, while the dataset's datatype and dataspace are available */
+    if (RV_dataset_flush_write_buffer(_dset, H5S_ALL) < 0)
+        FUNC_DONE_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    RV_write_buffer_discard(_dset);
+
+    RV_read_ahead_drop(_dset);
+    RV_free(_dset->u.dataset.read_ahead);
+    _dset->u.dataset.read_ahead = NULL;
+
+    if (_dset->u.dataset.dtype_id >= 0 && H5Tclose(_dset->u.dataset.dtype_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset's datatype");
+
+    if (_dset->u.dataset.space_id >= 0 && H5Sclose(_dset->u.dataset.space_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset's dataspace");
+
+    if (_dset->u.dataset.dapl_id >= 0) {
+        if (_dset->u.dataset.dapl_id != H5P_DATASET_ACCESS_DEFAULT && H5Pclose(_dset->u.dataset.dapl_id) < 0)
+            FUNC_DONE_ERROR(H5E_PLIST, H5E_CANTCLOSEOBJ, FAIL, "can't close DAPL");
+    } /* end if */
+    if (_dset->u.dataset.dcpl_id >= 0) {
+        if (_dset->u.dataset.dcpl_id != H5P_DATASET_CREATE_DEFAULT && H5Pclose(_dset->u.dataset.dcpl_id) < 0)
+            FUNC_DONE_ERROR(H5E_PLIST, H5E_CANTCLOSEOBJ, FAIL, "can't close DCPL");
+    } /* end if */
+
+    if (RV_type_info_array_g[H5I_DATASET])
+        rv_hash_table_remove(RV_type_info_array_g[H5I_DATASET]->table, (char *)_dset->URI);
+
+    if (RV_file_close(_dset->domain, H5P_DEFAULT, NULL)) {
+        FUNC_DONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file");
+    }
+
+    RV_free(_dset->handle_path);
+    RV_free(_dset);
+    _dset = NULL;
+
+done:
+    PRINT_ERROR_STACK;
+
+    return ret_value;
+} /* end RV_dataset_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_flush_write_buffers
+ *
+ * Purpose:     Sends the writes held back in the write-back buffers of
+ *              datasets in the given domain to the server, or those of
+ *              every dataset if the domain is NULL. The writes to
+ *              different datasets are sent concurrently.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_flush_write_buffers(const RV_object_t *domain)
+{
+    RV_object_t **dsets     = NULL;
+    size_t        num_dsets = 0;
+    herr_t        ret_value = SUCCEED;
+
+    if (!RV_num_write_buffered_dsets_g)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (NULL == (dsets = RV_malloc(RV_num_write_buffered_dsets_g * sizeof(*dsets))))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate list of datasets to flush");
+
+    for (size_t i = 0; i < RV_num_write_buffered_dsets_g; i++) {
+        RV_object_t *dset = RV_write_buffered_dsets_g[i];
+
+        if (!domain || !strcmp(dset->domain->u.file.filepath_name, domain->u.file.filepath_name))
+            dsets[num_dsets++] = dset;
+    }
+
+    if (num_dsets && RV_write_buffers_send(num_dsets, dsets) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+done:
+    RV_free(dsets);
+
+    return ret_value;
+} /* end RV_dataset_flush_write_buffers() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_append
+ *
+ * Purpose:     Grows a chunked dataset by the given number of elements
+ *              along one dimension and writes the data for the new
+ *              elements, which the memory buffer holds in row-major
+ *              order.
+ *
+ *              If the new elements fit in the dataset's write-back
+ *              buffer, both the write and the change of the dataset's
+ *              extent on the server are held back, and are merged with
+ *              those of following appends. The extent is then changed on
+ *              the server just before the buffered writes are sent, so
+ *              that a series of appends takes two requests rather than
+ *              two for each append. The dataset's dataspace is extended
+ *              immediately either way.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_append(RV_object_t *dset, hid_t dxpl_id, unsigned axis, size_t extension, hid_t mem_type_id,
+                  const void *buf)
+{
+    RV_object_t *owner = NULL;
+    H5D_layout_t layout;
+    hsize_t      dims[H5S_MAX_RANK];
+    hsize_t      maxdims[H5S_MAX_RANK];
+    hsize_t      start[H5S_MAX_RANK];
+    hsize_t      count[H5S_MAX_RANK];
+    hsize_t      block_start[H5S_MAX_RANK];
+    hsize_t      block_count[H5S_MAX_RANK];
+    hsize_t      old_dim       = 0;
+    hbool_t      extended      = FALSE;
+    hid_t        mem_space_id  = H5I_INVALID_HID;
+    hid_t        file_space_id = H5I_INVALID_HID;
+    htri_t       can_buffer;
+    int          ndims;
+    int          rank;
+    herr_t       ret_value = SUCCEED;
+
+    if (H5I_DATASET != dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+    if (!buf)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data buffer was NULL");
+
+    if (!(dset->domain->u.file.intent & H5F_ACC_RDWR))
+        FUNC_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    if ((layout = H5Pget_layout(dset->u.dataset.dcpl_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_PLIST, FAIL, "can't get layout from DCPL");
+    if (layout != H5D_CHUNKED)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "non-chunked datasets cannot be resized");
+
+    if ((ndims = H5Sget_simple_extent_ndims(dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dataset dimensions");
+    if (axis >= (unsigned)ndims)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "axis %u is not a dimension of the dataset", axis);
+
+    if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, dims, maxdims) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset dimensions");
+
+    if (extension == 0)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (maxdims[axis] != H5S_UNLIMITED && dims[axis] + extension > maxdims[axis])
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "new dataset dimensions exceed maximum dimensions");
+
+    /* Writes buffered through another handle to the dataset are sent first, so that any appends buffered
+     * from here on are held in this handle's buffer along with its pending extent */
+    if ((owner = RV_write_buffer_find(dset)) && owner != dset && RV_write_buffers_send(1, &owner) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+    memset(start, 0, (size_t)ndims * sizeof(*start));
+    memcpy(count, dims, (size_t)ndims * sizeof(*count));
+    old_dim     = dims[axis];
+    start[axis] = old_dim;
+    count[axis] = (hsize_t)extension;
+    dims[axis] += (hsize_t)extension;
+
+    if (H5Sset_extent_simple(dset->u.dataset.space_id, ndims, dims, maxdims) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_DATASPACE, FAIL, "unable to modify extent of local dataspace");
+    extended = TRUE;
+
+    if ((file_space_id = H5Scopy(dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset's dataspace");
+    if (H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select appended elements");
+
+    if ((mem_space_id = H5Screate_simple(ndims, count, NULL)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create memory dataspace");
+
+    if ((can_buffer = RV_write_buffer_get_block(dset, mem_type_id, file_space_id, &rank, block_start,
+                                                block_count)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check whether write can be buffered");
+
+    /* Mark the extent as pending before the write is buffered, since buffering it may send it */
+    dset->u.dataset.extent_pending = TRUE;
+
+    if (can_buffer) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Buffering append of %zu elements along dimension %u of dataset %s",
+                     extension, axis, dset->URI);
+
+        if (RV_write_buffer_add(dset, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't buffer appended data");
+    }
+    else {
+        /* Sending the buffered writes first changes the extent on the server, if there are any */
+        if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+        if (dset->u.dataset.extent_pending) {
+            if (RV_dataset_put_extent(dset, ndims, dims) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't change extent of dataset on server");
+
+            dset->u.dataset.extent_pending = FALSE;
+        }
+
+        if (RV_dataset_write_unbuffered(1, (void **)&dset, &mem_type_id, &mem_space_id, &file_space_id,
+                                        dxpl_id, &buf) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write appended data");
+    }
+
+done:
+    /* If the append failed before anything was sent which would have changed the extent on the server,
+     * restore the local extent. The extent stays pending for earlier appends still in the buffer. */
+    if (ret_value < 0 && extended && dset->u.dataset.extent_pending) {
+        dims[axis] = old_dim;
+
+        if (H5Sset_extent_simple(dset->u.dataset.space_id, ndims, dims, maxdims) < 0)
+            FUNC_DONE_ERROR(H5E_DATASET, H5E_DATASPACE, FAIL, "unable to restore extent of local dataspace");
+
+        if (!dset->u.dataset.write_buffer)
+            dset->u.dataset.extent_pending = FALSE;
+    }
+
+    if (mem_space_id >= 0 && H5Sclose(mem_space_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close memory dataspace");
+    if (file_space_id >= 0 && H5Sclose(file_space_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close file dataspace");
+
+    return ret_value;
+} /* end RV_dataset_append() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_get_storage_sizes
+ *
+ * Purpose:     Retrieves the storage sizes of datasets in the given
+ *              domain.
+ *
+ *              The server only updates a dataset's storage size when its
+ *              domain is flushed and rescanned, which is costly for large
+ *              domains, so the domain is rescanned once for all of the
+ *              datasets. It isn't rescanned at all if it was rescanned
+ *              within the file's maximum storage size age.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_get_storage_sizes(RV_object_t *domain, size_t count, RV_object_t *dsets[], hsize_t sizes[])
+{
+    H5VL_file_specific_args_t vol_flush_args;
+    uint64_t                  rescan_age_usec;
+    char                      request_endpoint[URL_MAX_LENGTH];
+    int                       endpoint_len = 0;
+    herr_t                    ret_value    = SUCCEED;
+
+    if (!(SERVER_VERSION_SUPPORTS_GET_STORAGE_SIZE(domain->u.file.server_info.version)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                        "H5Dget_storage_size requires HSDS 0.8.5 or higher");
+
+    for (size_t i = 0; i < count; i++) {
+        if (H5I_DATASET != dsets[i]->obj_type)
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+        if (strcmp(dsets[i]->domain->u.file.filepath_name, domain->u.file.filepath_name))
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset %s is not in domain %s", dsets[i]->URI,
+                            domain->u.file.filepath_name);
+    }
+
+    rescan_age_usec = RV_now_usec() - domain->u.file.rescan_usec;
+
+    if (domain->u.file.storage_size_max_age <= 0 || !domain->u.file.rescan_usec ||
+        (double)rescan_age_usec > domain->u.file.storage_size_max_age * 1e6) {
+        /* Flush domain to make server update allocated bytes */
+        vol_flush_args.op_type             = H5VL_FILE_FLUSH;
+        vol_flush_args.args.flush.obj_type = H5I_FILE;
+        vol_flush_args.args.flush.scope    = H5F_SCOPE_LOCAL;
+
+        if (RV_file_specific((void *)domain, &vol_flush_args, H5P_DEFAULT, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't flush dataset's domain");
+    }
+    else
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Reusing storage sizes from rescan of domain %s %.3f seconds ago",
+                     domain->u.file.filepath_name, (double)rescan_age_usec / 1e6);
+
+    for (size_t i = 0; i < count; i++) {
+        /* Make GET request to dataset with 'verbose' parameter for HSDS. */
+        if ((endpoint_len = snprintf(request_endpoint, URL_MAX_LENGTH, "/datasets/%s?verbose=1",
+                                     dsets[i]->URI)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+        if (endpoint_len >= URL_MAX_LENGTH)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
+                            "H5Dget_storage_size request URL size exceeded maximum URL size");
+
+        if (RV_curl_get(curl, &domain->u.file.server_info, request_endpoint, domain->u.file.filepath_name,
+                        CONTENT_TYPE_JSON, "H5Dget_storage_size") < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset");
+
+        if (RV_parse_allocated_size_cb(response_buffer.buffer, NULL, &sizes[i]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_PARSEERROR, FAIL,
+                            "can't get allocated size from server response");
+    }
+
+done:
+    return ret_value;
+} /* end RV_dataset_get_storage_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_read_batch
+ *
+ * Purpose:     Reads several selections of a dataset, each into its own
+ *              buffer, merging nearby selections into fewer requests.
+ *
+ *              The non-empty hyperslab selections are sorted by the
+ *              start of their bounding boxes, and each is merged into
+ *              the group of selections before it if the bounding box of
+ *              both is no more than READ_BATCH_ROUND_TRIP_SIZE bytes
+ *              larger than the two boxes apart. Each group of more than
+ *              one selection is read as its bounding box, out of which
+ *              its selections are copied. All of the requests, including
+ *              those for the selections which can't be merged, are made
+ *              together through RV_dataset_read().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_read_batch(RV_object_t *dset, size_t count, hid_t mem_type_id, const hid_t mem_space_ids[],
+                      const hid_t file_space_ids[], hid_t dxpl_id, void *bufs[])
+{
+    RV_batch_read_t  *reads              = NULL;
+    RV_batch_group_t *groups             = NULL;
+    void            **req_dsets          = NULL;
+    hid_t            *req_mem_type_ids   = NULL;
+    hid_t            *req_mem_space_ids  = NULL;
+    hid_t            *req_file_space_ids = NULL;
+    void            **req_bufs           = NULL;
+    H5S_sel_type      sel_type;
+    hssize_t          npoints;
+    hbool_t           can_merge = TRUE;
+    size_t            mem_type_size;
+    size_t            num_reads    = 0;
+    size_t            num_groups   = 0;
+    size_t            num_requests = 0;
+    htri_t            type_check;
+    int               rank;
+    herr_t            ret_value = SUCCEED;
+
+    if (H5I_DATASET != dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+    if (!count)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if (!mem_space_ids || !file_space_ids || !bufs)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace ID or buffer array was NULL");
+
+    if ((rank = H5Sget_simple_extent_ndims(dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dataset dimensions");
+
+    if ((mem_type_size = H5Tget_size(mem_type_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of memory datatype");
+
+    /* Variable-length data and references read as part of a bounding box would be copied out of it, or
+     * leaked if no selection includes them, so their reads aren't merged */
+    if ((type_check = H5Tdetect_class(mem_type_id, H5T_VLEN)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "can't determine if datatype contains Vlen type");
+    can_merge = can_merge && !type_check;
+
+    if ((type_check = H5Tis_variable_str(mem_type_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "memory datatype is invalid");
+    can_merge = can_merge && !type_check;
+
+    if ((type_check = H5Tdetect_class(mem_type_id, H5T_REFERENCE)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "can't determine if datatype contains references");
+    can_merge = can_merge && !type_check && rank > 0;
+
+    if (NULL == (reads = RV_malloc(count * sizeof(*reads))) ||
+        NULL == (groups = RV_malloc(count * sizeof(*groups))) ||
+        NULL == (req_dsets = RV_malloc(count * sizeof(*req_dsets))) ||
+        NULL == (req_mem_type_ids = RV_malloc(count * sizeof(*req_mem_type_ids))) ||
+        NULL == (req_mem_space_ids = RV_malloc(count * sizeof(*req_mem_space_ids))) ||
+        NULL == (req_file_space_ids = RV_malloc(count * sizeof(*req_file_space_ids))) ||
+        NULL == (req_bufs = RV_malloc(count * sizeof(*req_bufs))))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for batched reads");
+
+    /* Find the bounding box of each selection which can be merged, and make the others as they are */
+    for (size_t i = 0; i < count; i++) {
+        RV_batch_read_t *read = &reads[num_reads];
+
+        if (!bufs[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given read buffer was NULL");
+
+        if (can_merge && H5S_ALL != file_space_ids[i]) {
+            if (H5S_SEL_ERROR == (sel_type = H5Sget_select_type(file_space_ids[i])))
+                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace selection type");
+            if ((npoints = H5Sget_select_npoints(file_space_ids[i])) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace is invalid");
+
+            /* Points are read in the order they were selected, which copying them out of a bounding box
+             * wouldn't preserve */
+            if ((H5S_SEL_ALL == sel_type || H5S_SEL_HYPERSLABS == sel_type) && npoints > 0) {
+                memset(read->start, 0, sizeof(read->start));
+                memset(read->end, 0, sizeof(read->end));
+
+                if (H5Sget_select_bounds(file_space_ids[i], read->start, read->end) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+
+                read->index = i;
+                num_reads++;
+                continue;
+            }
+        }
+
+        req_dsets[num_requests]          = dset;
+        req_mem_type_ids[num_requests]   = mem_type_id;
+        req_mem_space_ids[num_requests]  = mem_space_ids[i];
+        req_file_space_ids[num_requests] = file_space_ids[i];
+        req_bufs[num_requests]           = bufs[i];
+        num_requests++;
+    }
+
+    qsort(reads, num_reads, sizeof(*reads), RV_batch_read_cmp);
+
+    /* Merge each read into the group before it while the data this saves a request for is cheap enough */
+    for (size_t i = 0; i < num_reads; i++) {
+        RV_batch_read_t  *read  = &reads[i];
+        RV_batch_group_t *group = num_groups ? &groups[num_groups - 1] : NULL;
+
+        if (group) {
+            hsize_t merged_start[H5S_MAX_RANK];
+            hsize_t merged_end[H5S_MAX_RANK];
+            hsize_t separate_nelems;
+            hsize_t merged_nelems;
+
+            for (int j = 0; j < rank; j++) {
+                merged_start[j] = group->start[j] < read->start[j] ? group->start[j] : read->start[j];
+                merged_end[j]   = group->end[j] > read->end[j] ? group->end[j] : read->end[j];
+            }
+
+            separate_nelems = RV_batch_box_nelems(group->start, group->end, rank) +
+                              RV_batch_box_nelems(read->start, read->end, rank);
+            merged_nelems   = RV_batch_box_nelems(merged_start, merged_end, rank);
+
+            if (merged_nelems <= separate_nelems ||
+                (merged_nelems - separate_nelems) * mem_type_size <= READ_BATCH_ROUND_TRIP_SIZE) {
+                memcpy(group->start, merged_start, sizeof(merged_start));
+                memcpy(group->end, merged_end, sizeof(merged_end));
+                group->num_reads++;
+                read->group = num_groups - 1;
+                continue;
+            }
+        }
+
+        group = &groups[num_groups];
+        memcpy(group->start, read->start, sizeof(read->start));
+        memcpy(group->end, read->end, sizeof(read->end));
+        group->num_reads     = 1;
+        group->mem_space_id  = H5I_INVALID_HID;
+        group->file_space_id = H5I_INVALID_HID;
+        group->data          = NULL;
+        read->group          = num_groups++;
+    }
+
+    /* Read each group of more than one selection as its bounding box, and make the other reads as they are */
+    for (size_t i = 0; i < num_reads; i++) {
+        RV_batch_group_t *group = &groups[reads[i].group];
+        hsize_t           count_dims[H5S_MAX_RANK];
+
+        if (group->num_reads == 1) {
+            req_dsets[num_requests]          = dset;
+            req_mem_type_ids[num_requests]   = mem_type_id;
+            req_mem_space_ids[num_requests]  = mem_space_ids[reads[i].index];
+            req_file_space_ids[num_requests] = file_space_ids[reads[i].index];
+            req_bufs[num_requests]           = bufs[reads[i].index];
+            num_requests++;
+            continue;
+        }
+
+        /* Only set up the read of the group's bounding box once, for its first selection */
+        if (group->data)
+            continue;
+
+        for (int j = 0; j < rank; j++)
+            count_dims[j] = group->end[j] - group->start[j] + 1;
+
+        if (NULL == (group->data = RV_malloc((size_t)RV_batch_box_nelems(group->start, group->end, rank) *
+                                             mem_type_size)))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for merged read");
+
+        if ((group->mem_space_id = H5Screate_simple(rank, count_dims, NULL)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create memory dataspace");
+
+        if ((group->file_space_id = H5Scopy(dset->u.dataset.space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset's dataspace");
+
+        if (H5Sselect_hyperslab(group->file_space_id, H5S_SELECT_SET, group->start, NULL, count_dims, NULL) <
+            0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select bounding box of merged reads");
+
+        req_dsets[num_requests]          = dset;
+        req_mem_type_ids[num_requests]   = mem_type_id;
+        req_mem_space_ids[num_requests]  = group->mem_space_id;
+        req_file_space_ids[num_requests] = group->file_space_id;
+        req_bufs[num_requests]           = group->data;
+        num_requests++;
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Reading batch of %zu selections of dataset %s with %zu requests",
+                 count, dset->URI, num_requests);
+
+    if (RV_dataset_read(num_requests, req_dsets, req_mem_type_ids, req_mem_space_ids, req_file_space_ids,
+                        dxpl_id, req_bufs, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read from dataset");
+
+    /* Copy the merged selections out of their groups' bounding boxes */
+    for (size_t i = 0; i < num_reads; i++) {
+        const RV_batch_group_t *group = &groups[reads[i].group];
+        size_t                  index = reads[i].index;
+
+        if (group->num_reads > 1 && RV_batch_group_scatter(group, mem_type_id, mem_type_size,
+                                                           mem_space_ids[index], file_space_ids[index],
+                                                           bufs[index]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't copy selection out of merged read");
+    }
+
+done:
+    for (size_t i = 0; i < num_groups; i++) {
+        if (groups[i].mem_space_id >= 0 && H5Sclose(groups[i].mem_space_id) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close memory dataspace");
+        if (groups[i].file_space_id >= 0 && H5Sclose(groups[i].file_space_id) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close file dataspace");
+
+        RV_free(groups[i].data);
+    }
+
+    RV_free(reads);
+    RV_free(groups);
+    RV_free(req_dsets);
+    RV_free(req_mem_type_ids);
+    RV_free(req_mem_space_ids);
+    RV_free(req_file_space_ids);
+    RV_free(req_bufs);
+
+    return ret_value;
+} /* end RV_dataset_read_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_read_chunks
+ *
+ * Purpose:     Reads chunks of a dataset as the bytes they are stored
+ *              as, still filtered, with no type conversion. Each chunk is
+ *              given by the offset of its first element in the dataset,
+ *              and is read into its own buffer along with its filter
+ *              mask. The requests for the chunks are made concurrently.
+ *
+ *              If buf_sizes is not NULL, each of its entries gives the
+ *              size of a buffer, and is set to the size of the chunk
+ *              read into it. Otherwise, the buffers must be large enough
+ *              for the chunks, as with H5Dread_chunk().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_read_chunks(RV_object_t *dset, size_t count, const hsize_t *offsets[], uint32_t filter_masks[],
+                       size_t buf_sizes[], void *bufs[])
+{
+    return RV_dataset_transfer_chunks(dset, READ, count, offsets, filter_masks, buf_sizes, bufs);
+} /* end RV_dataset_read_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_write_chunks
+ *
+ * Purpose:     Writes chunks of a dataset as the bytes they are stored
+ *              as, already filtered, with no type conversion. Each chunk
+ *              is given by the offset of its first element in the
+ *              dataset, and is sent with its filter mask, which records
+ *              the filters skipped when filtering it. The requests for
+ *              the chunks are made concurrently.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_write_chunks(RV_object_t *dset, size_t count, const hsize_t *offsets[],
+                        const uint32_t filter_masks[], const size_t sizes[], const void *bufs[])
+{
+    return RV_dataset_transfer_chunks(dset, WRITE, count, offsets, (uint32_t *)filter_masks, (size_t *)sizes,
+                                      (void **)bufs);
+} /* end RV_dataset_write_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_transfer_chunks
+ *
+ * Purpose:     Reads or writes chunks of a dataset as the bytes they are
+ *              stored as, making a request to the local store's chunk
+ *              endpoint for each of them, concurrently. HSDS has no such
+ *              endpoint, so this fails with other transports. The chunk's
+ *              filter mask is sent as a query parameter of a write, and
+ *              is returned in a response header of a read.
+ *
+ *              Buffered writes to the dataset are sent first, so that the
+ *              chunks are transferred in order with them, and the data
+ *              read ahead by the dataset's handles is dropped when
+ *              chunks are written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_dataset_transfer_chunks(RV_object_t *dset, transfer_type_t transfer_type, size_t count,
+                           const hsize_t *offsets[], uint32_t filter_masks[], size_t sizes[], void *bufs[])
+{
+    dataset_transfer_info *transfer_info     = NULL;
+    CURL                  *curl_multi_handle = NULL;
+    hsize_t                dims[H5S_MAX_RANK];
+    hsize_t                chunk_dims[H5S_MAX_RANK];
+    size_t                 host_header_len = 0;
+    char                   chunk_id[URI_MAX_LENGTH];
+    int                    ndims;
+    int                    url_len   = 0;
+    herr_t                 ret_value = SUCCEED;
+
+    if (H5I_DATASET != dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+
+    if (!count)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    /* The chunk routes aren't part of the REST API which HSDS implements */
+    if (!RV_transport_serves_chunks())
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                        "direct chunk transfers are only supported by the local store");
+
+    if (H5D_CHUNKED != H5Pget_layout(dset->u.dataset.dcpl_id))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset is not chunked");
+
+    if ((ndims = H5Sget_simple_extent_dims(dset->u.dataset.space_id, dims, NULL)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset's dimensions");
+
+    if (H5Pget_chunk(dset->u.dataset.dcpl_id, ndims, chunk_dims) != ndims)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get dataset's chunk dimensions");
+
+    if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    if (WRITE == transfer_type && RV_read_ahead_invalidate(dset, H5S_ALL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't drop data read ahead from dataset");
+
+    /* Transfer handles are duplicated from the global handle, so make sure its access token is current */
+    if (RV_refresh_access_token() < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't refresh access token");
+
+    if ((transfer_info = RV_calloc(count * sizeof(dataset_transfer_info))) == NULL)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset transfer info");
+
+    memset(transfer_info, 0, count * sizeof(dataset_transfer_info));
+
+    curl_multi_handle = curl_multi_init();
+
+    for (size_t i = 0; i < count; i++) {
+        if (!offsets[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given chunk offset was NULL");
+        if (!bufs[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given chunk buffer was NULL");
+        if (WRITE == transfer_type && !sizes[i])
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "given chunk size was 0");
+
+        if (RV_dataset_get_chunk_id(dset, ndims, dims, chunk_dims, offsets[i], chunk_id, sizeof(chunk_id)) <
+            0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid chunk offset");
+
+        transfer_info[i].curl_easy_handle = curl_easy_duphandle(curl);
+
+        /* Spread the transfers across local server nodes, if connecting through local sockets */
+        if (RV_set_socket_path(transfer_info[i].curl_easy_handle) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set socket path for transfer");
+
+        if ((transfer_info[i].request_url = calloc(URL_MAX_LENGTH, sizeof(char))) == NULL)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failed to allocate memory for request URLs");
+
+        if (NULL == (transfer_info[i].resp_buffer.buffer =
+                         (char *)calloc(sizeof(char), CURL_RESPONSE_BUFFER_DEFAULT_SIZE)))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate cURL response buffers");
+
+        transfer_info[i].transfer_type            = transfer_type;
+        transfer_info[i].raw_chunk                = TRUE;
+        transfer_info[i].dataset                  = dset;
+        transfer_info[i].mem_type_id              = H5I_INVALID_HID;
+        transfer_info[i].mem_space_id             = H5I_INVALID_HID;
+        transfer_info[i].file_space_id            = H5I_INVALID_HID;
+        transfer_info[i].file_type_id             = dset->u.dataset.dtype_id;
+        transfer_info[i].resp_buffer.buffer_size  = CURL_RESPONSE_BUFFER_DEFAULT_SIZE;
+        transfer_info[i].resp_buffer.curr_buf_ptr = transfer_info[i].resp_buffer.buffer;
+
+        if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_WRITEFUNCTION,
+                                         H5_rest_curl_write_data_callback_no_global))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set up non global curl write callback: %s",
+                            transfer_info[i].curl_err_buf);
+        if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_ERRORBUFFER,
+                                         transfer_info[i].curl_err_buf))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL error buffer");
+        if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_WRITEDATA,
+                                         &transfer_info[i].resp_buffer))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set up non global curl write data: %s",
+                            transfer_info[i].curl_err_buf);
+
+        /* Setup the host header */
+        host_header_len = strlen(dset->domain->u.file.filepath_name) + strlen(host_string) + 1;
+        if (NULL == (transfer_info[i].host_headers = (char *)RV_malloc(host_header_len)))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for request Host header");
+
+        strcpy(transfer_info[i].host_headers, host_string);
+
+        transfer_info[i].curl_headers = curl_slist_append(
+            transfer_info[i].curl_headers, strncat(transfer_info[i].host_headers,
+                                                   dset->domain->u.file.filepath_name,
+                                                   host_header_len - strlen(host_string) - 1));
+
+        /* Disable use of Expect: 100 Continue HTTP response */
+        transfer_info[i].curl_headers = curl_slist_append(transfer_info[i].curl_headers, "Expect:");
+
+        if (READ == transfer_type) {
+            transfer_info[i].u.read_info.sel_type    = H5S_SEL_ALL;
+            transfer_info[i].u.read_info.buf         = bufs[i];
+            transfer_info[i].u.read_info.buf_size    = sizes ? sizes[i] : 0;
+            transfer_info[i].u.read_info.chunk_size  = 0;
+            transfer_info[i].u.read_info.filter_mask = 0;
+
+            transfer_info[i].curl_headers =
+                curl_slist_append(transfer_info[i].curl_headers, "Accept: application/octet-stream");
+
+            if ((url_len = snprintf(transfer_info[i].request_url, URL_MAX_LENGTH, "%s/chunks/%s",
+                                    dset->domain->u.file.server_info.base_URL, chunk_id)) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_HEADERFUNCTION,
+                                             RV_dataset_chunk_header_cb))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL header callback: %s",
+                                transfer_info[i].curl_err_buf);
+            if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_HEADERDATA,
+                                             &transfer_info[i].u.read_info.filter_mask))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL header data: %s",
+                                transfer_info[i].curl_err_buf);
+            if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_HTTPGET, 1))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL,
+                                "can't set up cURL to make HTTP GET request: %s",
+                                transfer_info[i].curl_err_buf);
+        }
+        else {
+            curl_off_t write_len;
+
+            transfer_info[i].u.write_info.uinfo.buffer      = bufs[i];
+            transfer_info[i].u.write_info.uinfo.buffer_size = sizes[i];
+            transfer_info[i].u.write_info.uinfo.bytes_sent  = 0;
+
+            transfer_info[i].curl_headers =
+                curl_slist_append(transfer_info[i].curl_headers, "Content-Type: application/octet-stream");
+
+            if ((url_len = snprintf(transfer_info[i].request_url, URL_MAX_LENGTH,
+                                    "%s/chunks/%s?" CHUNK_FILTER_MASK_QUERY "%" PRIu32,
+                                    dset->domain->u.file.server_info.base_URL, chunk_id,
+                                    filter_masks[i])) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+            /* Check to make sure that the size of the chunk can safely be cast to a curl_off_t */
+            if (sizeof(curl_off_t) < sizeof(size_t))
+                ASSIGN_TO_SMALLER_SIZE(write_len, curl_off_t, sizes[i], size_t)
+            else if (sizeof(curl_off_t) > sizeof(size_t))
+                write_len = (curl_off_t)sizes[i];
+            else
+                ASSIGN_TO_SAME_SIZE_UNSIGNED_TO_SIGNED(write_len, curl_off_t, sizes[i], size_t)
+
+            if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_UPLOAD, 1))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL,
+                                "can't set up cURL to make HTTP PUT request: %s",
+                                transfer_info[i].curl_err_buf);
+            if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_READDATA,
+                                             &transfer_info[i].u.write_info.uinfo))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL PUT data: %s",
+                                transfer_info[i].curl_err_buf);
+            if (CURLE_OK !=
+                curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_INFILESIZE_LARGE, write_len))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL PUT data size: %s",
+                                transfer_info[i].curl_err_buf);
+        }
+
+        if (url_len >= URL_MAX_LENGTH)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "chunk URL size exceeded maximum URL size");
+
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Dataset chunk %s URL: %s",
+                     READ == transfer_type ? "read" : "write", transfer_info[i].request_url);
+
+        if (CURLE_OK != curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_HTTPHEADER,
+                                         transfer_info[i].curl_headers))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL HTTP headers: %s",
+                            transfer_info[i].curl_err_buf);
+        if (CURLE_OK !=
+            curl_easy_setopt(transfer_info[i].curl_easy_handle, CURLOPT_URL, transfer_info[i].request_url))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set cURL request URL: %s",
+                            transfer_info[i].curl_err_buf);
+
+        if (CURLM_OK != curl_multi_add_handle(curl_multi_handle, transfer_info[i].curl_easy_handle))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't add cURL handle: %s",
+                            transfer_info[i].curl_err_buf);
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "%s %zu chunks of dataset %s",
+                 READ == transfer_type ? "Reading" : "Writing", count, dset->URI);
+
+    if (CURLM_OK != curl_multi_setopt(curl_multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, NUM_MAX_HOST_CONNS))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL,
+                        "failed to set max concurrent streams for curl multi handle");
+
+    if (RV_curl_multi_perform(curl_multi_handle, transfer_info, count) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, READ == transfer_type ? H5E_READERROR : H5E_WRITEERROR, FAIL,
+                        "failed to perform dataset chunk transfers");
+
+    if (READ == transfer_type)
+        for (size_t i = 0; i < count; i++) {
+            filter_masks[i] = transfer_info[i].u.read_info.filter_mask;
+            if (sizes)
+                sizes[i] = transfer_info[i].u.read_info.chunk_size;
+        }
+
+done:
+    for (size_t i = 0; transfer_info && i < count; i++) {
+        curl_slist_free_all(transfer_info[i].curl_headers);
+
+        /* Might have been cleaned up during execution */
+        if (transfer_info[i].curl_easy_handle) {
+            curl_multi_remove_handle(curl_multi_handle, transfer_info[i].curl_easy_handle);
+            curl_easy_cleanup(transfer_info[i].curl_easy_handle);
+        }
+
+        RV_free(transfer_info[i].resp_buffer.buffer);
+        RV_free(transfer_info[i].request_url);
+        RV_free(transfer_info[i].host_headers);
+    }
+
+    if (curl_multi_handle)
+        curl_multi_cleanup(curl_multi_handle);
+    RV_free(transfer_info);
+
+    return ret_value;
+} /* end RV_dataset_transfer_chunks() */
+
+/* Helper to form the server's ID for the chunk of a dataset at the given offset: the dataset's ID
+ * with a "c-" prefix in place of its "d-" prefix, followed by the chunk's index in each dimension */
+static herr_t
+RV_dataset_get_chunk_id(const RV_object_t *dset, int ndims, const hsize_t *dims, const hsize_t *chunk_dims,
+                        const hsize_t *offset, char *chunk_id, size_t chunk_id_size)
+{
+    size_t id_len;
+    int    len;
+    herr_t ret_value = SUCCEED;
+
+    if (strncmp(dset->URI, "d-", 2))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset ID '%s' has no chunk IDs", dset->URI);
+
+    if ((len = snprintf(chunk_id, chunk_id_size, "c-%s", dset->URI + 2)) < 0 || (size_t)len >= chunk_id_size)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "chunk ID exceeded maximum size");
+
+    id_len = (size_t)len;
+
+    for (int i = 0; i < ndims; i++) {
+        if (offset[i] >= dims[i])
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk offset exceeds dataset's dimensions");
+        if (offset[i] % chunk_dims[i])
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk offset is not on a chunk boundary");
+
+        if ((len = snprintf(chunk_id + id_len, chunk_id_size - id_len, "_%" PRIuHSIZE,
+                            offset[i] / chunk_dims[i])) < 0 ||
+            (size_t)len >= chunk_id_size - id_len)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "chunk ID exceeded maximum size");
+
+        id_len += (size_t)len;
+    }
+
+done:
+    return ret_value;
+} /* end RV_dataset_get_chunk_id() */
+
+/* cURL header callback which takes the filter mask of a chunk read from the response's headers */
+size_t
+RV_dataset_chunk_header_cb(char *buffer, size_t size, size_t nitems, void *userdata)
+{
+    uint32_t *filter_mask = (uint32_t *)userdata;
+    size_t    header_len  = size * nitems;
+    size_t    name_len    = strlen(CHUNK_FILTER_MASK_HEADER);
+    char      value[16];
+    size_t    value_len;
+    size_t    i;
+
+    if (header_len <= name_len)
+        return header_len;
+
+    for (i = 0; i < name_len; i++)
+        if (tolower((unsigned char)buffer[i]) != tolower((unsigned char)CHUNK_FILTER_MASK_HEADER[i]))
+            return header_len;
+
+    /* The header isn't NUL-terminated, so copy its value out before parsing it */
+    value_len = header_len - name_len < sizeof(value) ? header_len - name_len : sizeof(value) - 1;
+    memcpy(value, buffer + name_len, value_len);
+    value[value_len] = '\0';
+
+    *filter_mask = (uint32_t)strtoul(value, NULL, 10);
+
+    return header_len;
+} /* end RV_dataset_chunk_header_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_query
+ *
+ * Purpose:     Reads the rows of a one-dimensional compound dataset which
+ *              match a query, such as "temp > 20.0 & pressure < 1000",
+ *              having the server evaluate the query so that only the
+ *              matching rows are sent. The search starts at the given
+ *              row, and stops once max_rows rows have matched, so a
+ *              dataset can be queried a page at a time by starting each
+ *              search after the last row matched by the one before it.
+ *
+ *              The number of matching rows is returned in num_rows. If
+ *              indices is not NULL, the index of each matching row in the
+ *              dataset is returned in it, and if buf is not NULL, the
+ *              rows are returned in it, packed together and converted to
+ *              the given compound memory type. Both must have room for
+ *              max_rows entries.
+ *
+ *              The server sends each matching row as its index, as a
+ *              64-bit unsigned integer, followed by the row's values in
+ *              the dataset's datatype.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_dataset_query(RV_object_t *dset, const char *query, hsize_t start, size_t max_rows, hid_t mem_type_id,
+                 size_t *num_rows, hsize_t indices[], void *buf)
+{
+    hsize_t dims[1];
+    htri_t  needs_tconv   = FALSE;
+    htri_t  contains_vlen = FALSE;
+    htri_t  contains_ref  = FALSE;
+    hbool_t fill_bkg      = FALSE;
+    size_t  file_type_size;
+    size_t  mem_type_size = 0;
+    size_t  row_size;
+    size_t  resp_size;
+    size_t  nrows;
+    void   *tconv_buf     = NULL;
+    void   *bkg_buf       = NULL;
+    char   *escaped_query = NULL;
+    char    request_endpoint[URL_MAX_LENGTH];
+    long    http_response;
+    int     endpoint_len = 0;
+    herr_t  ret_value    = SUCCEED;
+
+    if (H5I_DATASET != dset->obj_type)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+    if (!query || !strlen(query))
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "query was NULL or empty");
+    if (!max_rows)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "maximum number of rows was 0");
+    if (!num_rows)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "num_rows pointer was NULL");
+
+    *num_rows = 0;
+
+    if (H5T_COMPOUND != H5Tget_class(dset->u.dataset.dtype_id))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "only compound datasets can be queried");
+
+    if ((contains_vlen = H5Tdetect_class(dset->u.dataset.dtype_id, H5T_VLEN)) < 0 ||
+        (contains_ref = H5Tdetect_class(dset->u.dataset.dtype_id, H5T_REFERENCE)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check classes of dataset's datatype members");
+
+    if (contains_vlen || contains_ref)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                        "datasets with variable-length or reference members can't be queried");
+
+    if (H5Sget_simple_extent_ndims(dset->u.dataset.space_id) != 1)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "only one-dimensional datasets can be queried");
+
+    if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, dims, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset's dimensions");
+
+    if ((file_type_size = H5Tget_size(dset->u.dataset.dtype_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get size of dataset's datatype");
+
+    if (buf) {
+        if (H5T_COMPOUND != H5Tget_class(mem_type_id))
+            FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory datatype is not a compound datatype");
+
+        if ((mem_type_size = H5Tget_size(mem_type_id)) == 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get size of memory datatype");
+
+        if ((needs_tconv = RV_need_tconv(dset->u.dataset.dtype_id, mem_type_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to check if datatypes need conversion");
+    }
+
+    if (start >= dims[0])
+        FUNC_GOTO_DONE(SUCCEED);
+
+    /* The query is evaluated against the data on the server, so send any buffered writes first */
+    if (RV_dataset_flush_write_buffer(dset, H5S_ALL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    if ((escaped_query = curl_easy_escape(curl, query, (int)strlen(query))) == NULL)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't URL-encode query");
+
+    if ((endpoint_len =
+             snprintf(request_endpoint, URL_MAX_LENGTH,
+                      "/datasets/%s/value?query=%s&select=[%" PRIuHSIZE ":%" PRIuHSIZE "]&Limit=%zu",
+                      dset->URI, escaped_query, start, dims[0], max_rows)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if (endpoint_len >= URL_MAX_LENGTH)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "query request URL size exceeded maximum URL size");
+
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Querying rows %" PRIuHSIZE " onward of dataset %s for '%s'", start,
+                 dset->URI, query);
+
+    if ((http_response = RV_curl_get(curl, &dset->domain->u.file.server_info, request_endpoint,
+                                     dset->domain->u.file.filepath_name, CONTENT_TYPE_OCTET_STREAM,
+                                     "H5rest_dataset_query")) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't query dataset");
+
+    if (!HTTP_SUCCESS(http_response))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL,
+                        "server failed to query dataset with HTTP status %ld", http_response);
+
+    row_size  = sizeof(uint64_t) + file_type_size;
+    resp_size = response_buffer.data_size;
+
+    if (resp_size % row_size)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                        "query response of %zu bytes isn't a whole number of %zu-byte rows", resp_size,
+                        row_size);
+
+    if ((nrows = resp_size / row_size) > max_rows)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                        "server returned %zu rows, more than the %zu requested", nrows, max_rows);
+
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Query matched %zu rows of dataset %s", nrows, dset->URI);
+
+    if (indices)
+        for (size_t i = 0; i < nrows; i++) {
+            uint64_t index;
+
+            memcpy(&index, response_buffer.buffer + i * row_size, sizeof(uint64_t));
+            indices[i] = (hsize_t)index;
+        }
+
+    if (buf && nrows) {
+        /* Without conversion, the rows are gathered straight into the user's buffer */
+        char *values = buf;
+
+        if (needs_tconv) {
+            if (RV_tconv_init(dset->u.dataset.dtype_id, &file_type_size, mem_type_id, &mem_type_size, nrows,
+                              FALSE, FALSE, &tconv_buf, &bkg_buf, NULL, FALSE, &fill_bkg) < 0)
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+            values = tconv_buf;
+        }
+
+        for (size_t i = 0; i < nrows; i++)
+            memcpy(values + i * file_type_size, response_buffer.buffer + i * row_size + sizeof(uint64_t),
+                   file_type_size);
+
+        if (needs_tconv) {
+            /* Populate background buffer from the user's buffer, so that the members of the memory
+             * type which aren't in the dataset's type keep their values */
+            if (fill_bkg)
+                memcpy(bkg_buf, buf, nrows * mem_type_size);
+
+            if (H5Tconvert(dset->u.dataset.dtype_id, mem_type_id, nrows, tconv_buf, bkg_buf, H5P_DEFAULT) < 0)
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,
+                                "failed to convert file datatype to memory datatype");
+
+            memcpy(buf, tconv_buf, nrows * mem_type_size);
+        }
+    }
+
+    *num_rows = nrows;
+
+done:
+    if (escaped_query)
+        curl_free(escaped_query);
+    if (tconv_buf)
+        RV_free(tconv_buf);
+    if (bkg_buf)
+        RV_free(bkg_buf);
+
+    return ret_value;
+} /* end RV_dataset_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_flush_write_buffer
+ *
+ * Purpose:     Sends the writes held back for a dataset, through any of
+ *              its handles, to the server if they overlap the given
+ *              selection in the dataset's dataspace, or regardless of
+ *              where they are if the selection is H5S_ALL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_dataset_flush_write_buffer(const RV_object_t *dset, hid_t file_space_id)
+{
+    RV_write_buffer_t *write_buffer = NULL;
+    RV_object_t       *owner        = NULL;
+    hsize_t            end[H5S_MAX_RANK];
+    htri_t             overlaps  = TRUE;
+    herr_t             ret_value = SUCCEED;
+
+    if (NULL == (owner = RV_write_buffer_find(dset)))
+        FUNC_GOTO_DONE(SUCCEED);
+
+    write_buffer = owner->u.dataset.write_buffer;
+
+    if (H5S_ALL != file_space_id) {
+        for (int i = 0; i < write_buffer->rank; i++)
+            end[i] = write_buffer->start[i] + write_buffer->count[i] - 1;
+
+        if ((overlaps = H5Sselect_intersect_block(file_space_id, write_buffer->start, end)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL,
+                            "can't check whether selection overlaps buffered writes");
+    }
+
+    if (overlaps && RV_write_buffers_send(1, &owner) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+done:
+    return ret_value;
+} /* end RV_dataset_flush_write_buffer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_get_selection_block
+ *
+ * Purpose:     Determines whether a transfer between a dataset and memory
+ *              moves a single block of the dataset's dataspace, whose
+ *              elements are transferred in row-major order without
+ *              datatype conversion, and if so, returns the block.
+ *
+ *              That is the case if the memory datatype needs no
+ *              conversion to the dataset's datatype and the selection in
+ *              the file is a non-empty hyperslab or "all" selection that
+ *              fills its bounds.
+ *
+ * Return:      TRUE if the transfer moves a single block, FALSE if not,
+ *              and negative on failure
+ */
+static htri_t
+RV_dataset_get_selection_block(const RV_object_t *dset, hid_t mem_type_id, hid_t file_space_id,
+                               int *rank_out, hsize_t *start, hsize_t *count)
+{
+    H5S_sel_type sel_type;
+    hssize_t     npoints = 0;
+    hsize_t      end[H5S_MAX_RANK];
+    hsize_t      nelems = 1;
+    htri_t       needs_tconv;
+    int          rank;
+    htri_t       ret_value = FALSE;
+
+    /* This also rules out variable-length data and references, which are always converted */
+    if ((needs_tconv = RV_need_tconv(dset->u.dataset.dtype_id, mem_type_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to check if datatypes need conversion");
+    if (needs_tconv)
+        FUNC_GOTO_DONE(FALSE);
+
+    if ((rank = H5Sget_simple_extent_ndims(dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dataset dimensions");
+    if (rank == 0)
+        FUNC_GOTO_DONE(FALSE);
+
+    if (H5S_ALL == file_space_id) {
+        if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, count, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset dimensions");
+
+        memset(start, 0, (size_t)rank * sizeof(*start));
+    }
+    else {
+        if (H5S_SEL_ERROR == (sel_type = H5Sget_select_type(file_space_id)))
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace selection type");
+
+        /* Points are transferred in the order they were selected, rather than in row-major order */
+        if (H5S_SEL_ALL != sel_type && H5S_SEL_HYPERSLABS != sel_type)
+            FUNC_GOTO_DONE(FALSE);
+
+        if ((npoints = H5Sget_select_npoints(file_space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace is invalid");
+        if (npoints == 0)
+            FUNC_GOTO_DONE(FALSE);
+
+        if (H5Sget_select_bounds(file_space_id, start, end) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+
+        for (int i = 0; i < rank; i++)
+            count[i] = end[i] - start[i] + 1;
+    }
+
+    for (int i = 0; i < rank; i++)
+        nelems *= count[i];
+
+    /* The selection is a single block only if it fills its bounds */
+    if (nelems == 0 || (H5S_ALL != file_space_id && nelems != (hsize_t)npoints))
+        FUNC_GOTO_DONE(FALSE);
+
+    *rank_out = rank;
+    ret_value = TRUE;
+
+done:
+    return ret_value;
+} /* end RV_dataset_get_selection_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_write_buffer_get_block
+ *
+ * Purpose:     Determines whether a write to a dataset can be held back
+ *              in its write-back buffer and, if so, returns the block of
+ *              the dataset's dataspace which it covers.
+ *
+ *              A write can be buffered if the dataset has a write-back
+ *              buffer large enough to hold it and the write moves a
+ *              single block, as determined by
+ *              RV_dataset_get_selection_block().
+ *
+ * Return:      TRUE if the write can be buffered, FALSE if not, and
+ *              negative on failure
+ */
+static htri_t
+RV_write_buffer_get_block(const RV_object_t *dset, hid_t mem_type_id, hid_t file_space_id, int *rank_out,
+                          hsize_t *start, hsize_t *count)
+{
+    hsize_t nelems = 1;
+    size_t  elem_size;
+    htri_t  is_block;
+    int     rank;
+    htri_t  ret_value = FALSE;
+
+    if (!dset->u.dataset.write_buffer_size)
+        FUNC_GOTO_DONE(FALSE);
+
+    if ((is_block = RV_dataset_get_selection_block(dset, mem_type_id, file_space_id, &rank, start, count)) <
+        0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check whether selection is a single block");
+    if (!is_block)
+        FUNC_GOTO_DONE(FALSE);
+
+    for (int i = 0; i < rank; i++)
+        nelems *= count[i];
+
+    if ((elem_size = H5Tget_size(dset->u.dataset.dtype_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of dataset's datatype");
+
+    if (nelems > dset->u.dataset.write_buffer_size / elem_size)
+        FUNC_GOTO_DONE(FALSE);
+
+    *rank_out = rank;
+    ret_value = TRUE;
+
+done:
+    return ret_value;
+} /* end RV_write_buffer_get_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_write_buffer_add
+ *
+ * Purpose:     Holds a write back in a dataset's write-back buffer,
+ *              merging it with the writes already buffered for the
+ *              dataset if the block it covers and theirs together form a
+ *              single block. If they don't, the buffered writes are sent
+ *              first and the buffer starts over with this write. The
+ *              buffered writes are also sent once they fill the buffer.
+ *
+ *              The write must be one for which
+ *              RV_write_buffer_get_block() returned TRUE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_write_buffer_add(RV_object_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                    const void *buf)
+{
+    RV_write_buffer_t *write_buffer = NULL;
+    RV_object_t       *owner        = NULL;
+    hssize_t           mem_select_npoints;
+    hsize_t            start[H5S_MAX_RANK];
+    hsize_t            count[H5S_MAX_RANK];
+    hsize_t            merged_start[H5S_MAX_RANK];
+    hsize_t            merged_count[H5S_MAX_RANK];
+    hsize_t            nelems = 1;
+    size_t             elem_size;
+    size_t             data_size;
+    char              *data = NULL;
+    int                rank = 0;
+    htri_t             can_buffer;
+    herr_t             ret_value = SUCCEED;
+
+    if ((can_buffer = RV_write_buffer_get_block(dset, mem_type_id, file_space_id, &rank, start, count)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check whether write can be buffered");
+    if (!can_buffer)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "write can't be buffered");
+
+    for (int i = 0; i < rank; i++)
+        nelems *= count[i];
+
+    if (H5S_ALL != mem_space_id) {
+        if ((mem_select_npoints = H5Sget_select_npoints(mem_space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "memory dataspace is invalid");
+        if ((hsize_t)mem_select_npoints != nelems)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                            "memory selection num points != file selection num points");
+    }
+
+    elem_size = H5Tget_size(dset->u.dataset.dtype_id);
+    data_size = (size_t)nelems * elem_size;
+
+    /* Gather the data to write into a single block, in row-major order */
+    if (NULL == (data = RV_malloc(data_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for buffered write");
+
+    if (H5S_ALL == mem_space_id && H5S_ALL == file_space_id)
+        memcpy(data, buf, data_size);
+    else if (H5Dgather(H5S_ALL == mem_space_id ? file_space_id : mem_space_id, buf, mem_type_id, data_size,
+                       data, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't gather data to write buffer");
+
+    if ((owner = RV_write_buffer_find(dset)) &&
+        !RV_write_buffer_merge_block(owner->u.dataset.write_buffer, start, count, merged_start,
+                                     merged_count)) {
+        if (RV_write_buffers_send(1, &owner) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+        owner = NULL;
+    }
+
+    if (!owner) {
+        /* Start a new buffer with this write */
+        if (RV_num_write_buffered_dsets_g == RV_write_buffered_dsets_nalloc_g) {
+            RV_object_t **tmp_realloc = NULL;
+            size_t        new_nalloc  = 8;
+
+            if (RV_write_buffered_dsets_nalloc_g)
+                new_nalloc = 2 * RV_write_buffered_dsets_nalloc_g;
+
+            if (NULL ==
+                (tmp_realloc = RV_realloc(RV_write_buffered_dsets_g, new_nalloc * sizeof(*tmp_realloc))))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow list of buffered datasets");
+
+            RV_write_buffered_dsets_g        = tmp_realloc;
+            RV_write_buffered_dsets_nalloc_g = new_nalloc;
+        }
+
+        if (NULL == (write_buffer = RV_calloc(sizeof(*write_buffer))))
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate write-back buffer");
+
+        write_buffer->rank        = rank;
+        write_buffer->elem_size   = elem_size;
+        write_buffer->data_size   = data_size;
+        write_buffer->data_nalloc = data_size;
+        write_buffer->data        = data;
+        memcpy(write_buffer->start, start, (size_t)rank * sizeof(*start));
+        memcpy(write_buffer->count, count, (size_t)rank * sizeof(*count));
+        data = NULL;
+
+        dset->u.dataset.write_buffer                               = write_buffer;
+        RV_write_buffered_dsets_g[RV_num_write_buffered_dsets_g++] = dset;
+        owner                                                      = dset;
+    }
+    else {
+        size_t merged_size = elem_size;
+
+        write_buffer = owner->u.dataset.write_buffer;
+
+        for (int i = 0; i < rank; i++)
+            merged_size *= (size_t)merged_count[i];
+
+        if (!memcmp(merged_start, start, (size_t)rank * sizeof(*start)) &&
+            !memcmp(merged_count, count, (size_t)rank * sizeof(*count))) {
+            /* This write covers all of the buffered writes, so replaces them */
+            RV_free(write_buffer->data);
+            write_buffer->data        = data;
+            write_buffer->data_nalloc = data_size;
+            data                      = NULL;
+        }
+        else {
+            if (!memcmp(merged_start, write_buffer->start, (size_t)rank * sizeof(*start)) &&
+                !memcmp(merged_count + 1, write_buffer->count + 1, (size_t)(rank - 1) * sizeof(*count))) {
+                /* The block only grows along the first dimension, which keeps the layout of the buffered
+                 * elements, so the buffer can be extended in place */
+                if (merged_size > write_buffer->data_nalloc) {
+                    size_t new_nalloc  = 2 * write_buffer->data_nalloc;
+                    char  *tmp_realloc = NULL;
+
+                    if (new_nalloc < merged_size)
+                        new_nalloc = merged_size;
+
+                    if (NULL == (tmp_realloc = RV_realloc(write_buffer->data, new_nalloc)))
+                        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow write-back buffer");
+
+                    write_buffer->data        = tmp_realloc;
+                    write_buffer->data_nalloc = new_nalloc;
+                }
+            }
+            else {
+                char *merged_data = NULL;
+
+                if (NULL == (merged_data = RV_malloc(merged_size)))
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow write-back buffer");
+
+                RV_write_buffer_copy_block(merged_data, merged_start, merged_count, write_buffer->data,
+                                           write_buffer->start, write_buffer->count, rank, elem_size);
+
+                RV_free(write_buffer->data);
+                write_buffer->data        = merged_data;
+                write_buffer->data_nalloc = merged_size;
+            }
+        }
+
+        memcpy(write_buffer->start, merged_start, (size_t)rank * sizeof(*start));
+        memcpy(write_buffer->count, merged_count, (size_t)rank * sizeof(*count));
+        write_buffer->data_size = merged_size;
+
+        /* Later writes take precedence where they overlap earlier ones */
+        if (data)
+            RV_write_buffer_copy_block(write_buffer->data, write_buffer->start, write_buffer->count, data,
+                                       start, count, rank, elem_size);
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Buffered %zu bytes written to dataset %s, %zu bytes now buffered",
+                 data_size, dset->URI, owner->u.dataset.write_buffer->data_size);
+
+    if (owner->u.dataset.write_buffer->data_size >= dset->u.dataset.write_buffer_size)
+        if (RV_write_buffers_send(1, &owner) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+done:
+    RV_free(data);
+
+    return ret_value;
+} /* end RV_write_buffer_add() */
+
+/* Helper to find the block covering both the buffered writes and a new block, if the two together form a
+ * single block. That is the case if one contains the other, or if they only differ in one dimension, in
+ * which they overlap or adjoin. */
+static hbool_t
+RV_write_buffer_merge_block(const RV_write_buffer_t *write_buffer, const hsize_t *start, const hsize_t *count,
+                            hsize_t *merged_start, hsize_t *merged_count)
+{
+    hbool_t contains      = TRUE;
+    hbool_t contained     = TRUE;
+    hbool_t disjoint      = FALSE;
+    int     num_differing = 0;
+
+    for (int i = 0; i < write_buffer->rank; i++) {
+        hsize_t buffered_end = write_buffer->start[i] + write_buffer->count[i];
+        hsize_t end          = start[i] + count[i];
+
+        merged_start[i] = write_buffer->start[i] < start[i] ? write_buffer->start[i] : start[i];
+        merged_count[i] = (buffered_end > end ? buffered_end : end) - merged_start[i];
+
+        contains  = contains && write_buffer->start[i] <= start[i] && end <= buffered_end;
+        contained = contained && start[i] <= write_buffer->start[i] && buffered_end <= end;
+
+        if (write_buffer->start[i] != start[i] || write_buffer->count[i] != count[i]) {
+            num_differing++;
+            disjoint = disjoint || start[i] > buffered_end || write_buffer->start[i] > end;
+        }
+    }
+
+    return contains || contained || (num_differing == 1 && !disjoint);
+} /* end RV_write_buffer_merge_block() */
+
+/* Helper to copy a block of elements, stored in row-major order, into its place in a larger block */
+static void
+RV_write_buffer_copy_block(char *dst, const hsize_t *dst_start, const hsize_t *dst_count, const char *src,
+                           const hsize_t *src_start, const hsize_t *src_count, int rank, size_t elem_size)
+{
+    hsize_t row_index[H5S_MAX_RANK] = {0};
+    size_t  row_size                = (size_t)src_count[rank - 1] * elem_size;
+    size_t  num_rows                = 1;
+
+    for (int i = 0; i < rank - 1; i++)
+        num_rows *= (size_t)src_count[i];
+
+    for (size_t row = 0; row < num_rows; row++) {
+        size_t dst_offset = 0;
+
+        for (int i = 0; i < rank; i++)
+            dst_offset =
+                dst_offset * (size_t)dst_count[i] + (size_t)(src_start[i] + row_index[i] - dst_start[i]);
+
+        memcpy(dst + dst_offset * elem_size, src + row * row_size, row_size);
+
+        for (int i = rank - 2; i >= 0 && ++row_index[i] == src_count[i]; i--)
+            row_index[i] = 0;
+    }
+} /* end RV_write_buffer_copy_block() */
+
+/* Helper to find the handle to a dataset whose write-back buffer holds the writes to it, if any */
+static RV_object_t *
+RV_write_buffer_find(const RV_object_t *dset)
+{
+    for (size_t i = 0; i < RV_num_write_buffered_dsets_g; i++) {
+        RV_object_t *buffered_dset = RV_write_buffered_dsets_g[i];
+
+        if (buffered_dset == dset ||
+            (!strcmp(buffered_dset->URI, dset->URI) &&
+             !strcmp(buffered_dset->domain->u.file.filepath_name, dset->domain->u.file.filepath_name)))
+            return buffered_dset;
+    }
+
+    return NULL;
+} /* end RV_write_buffer_find() */
+
+/* Helper to drop the writes held in a dataset's write-back buffer */
+static void
+RV_write_buffer_discard(RV_object_t *dset)
+{
+    if (!dset->u.dataset.write_buffer)
+        return;
+
+    RV_free(dset->u.dataset.write_buffer->data);
+    RV_free(dset->u.dataset.write_buffer);
+    dset->u.dataset.write_buffer = NULL;
+
+    for (size_t i = 0; i < RV_num_write_buffered_dsets_g; i++)
+        if (RV_write_buffered_dsets_g[i] == dset) {
+            RV_write_buffered_dsets_g[i] = RV_write_buffered_dsets_g[--RV_num_write_buffered_dsets_g];
+            break;
+        }
+
+    if (!RV_num_write_buffered_dsets_g) {
+        RV_free(RV_write_buffered_dsets_g);
+        RV_write_buffered_dsets_g        = NULL;
+        RV_write_buffered_dsets_nalloc_g = 0;
+    }
+} /* end RV_write_buffer_discard() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_write_buffers_send
+ *
+ * Purpose:     Sends the writes held in the write-back buffers of the
+ *              given datasets to the server, each as a single write of
+ *              the block they cover, and empties the buffers. The
+ *              buffers are emptied even if the writes can't be sent, so
+ *              that the failure is only reported once.
+ *
+ *              If buffered appends extended a dataset's dataspace and
+ *              the writes can't be sent, the dataspace is updated from
+ *              the server, since it isn't known whether the server's
+ *              extent was changed before the failure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_write_buffers_send(size_t count, RV_object_t *dsets[])
+{
+    const void **bufs           = NULL;
+    hid_t       *mem_type_ids   = NULL;
+    hid_t       *mem_space_ids  = NULL;
+    hid_t       *file_space_ids = NULL;
+    herr_t       ret_value      = SUCCEED;
+
+    if (NULL == (bufs = RV_malloc(count * sizeof(*bufs))) ||
+        NULL == (mem_type_ids = RV_malloc(count * sizeof(*mem_type_ids))) ||
+        NULL == (mem_space_ids = RV_malloc(count * sizeof(*mem_space_ids))) ||
+        NULL == (file_space_ids = RV_malloc(count * sizeof(*file_space_ids))))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for buffered writes");
+
+    for (size_t i = 0; i < count; i++)
+        mem_space_ids[i] = file_space_ids[i] = H5I_INVALID_HID;
+
+    for (size_t i = 0; i < count; i++) {
+        RV_write_buffer_t *write_buffer = dsets[i]->u.dataset.write_buffer;
+
+        bufs[i]         = write_buffer->data;
+        mem_type_ids[i] = dsets[i]->u.dataset.dtype_id;
+
+        if ((mem_space_ids[i] = H5Screate_simple(write_buffer->rank, write_buffer->count, NULL)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create memory dataspace");
+
+        if ((file_space_ids[i] = H5Scopy(dsets[i]->u.dataset.space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset's dataspace");
+
+        if (H5Sselect_hyperslab(file_space_ids[i], H5S_SELECT_SET, write_buffer->start, NULL,
+                                write_buffer->count, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select buffered block");
+    }
+
+    /* Change the extent on the server for any appends among the writes first */
+    for (size_t i = 0; i < count; i++) {
+        hsize_t dims[H5S_MAX_RANK];
+        int     ndims;
+
+        if (!dsets[i]->u.dataset.extent_pending)
+            continue;
+
+        if ((ndims = H5Sget_simple_extent_dims(dsets[i]->u.dataset.space_id, dims, NULL)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset dimensions");
+
+        if (RV_dataset_put_extent(dsets[i], ndims, dims) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't change extent of dataset on server");
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Sending buffered writes to %zu dataset%s", count,
+                 count > 1 ? "s" : "");
+
+    if (RV_dataset_write_unbuffered(count, (void **)dsets, mem_type_ids, mem_space_ids, file_space_ids,
+                                    H5P_DATASET_XFER_DEFAULT, bufs) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered dataset writes");
+
+done:
+    for (size_t i = 0; i < count; i++) {
+        /* The dataspace IDs are initialized once all of the arrays have been allocated */
+        if (file_space_ids) {
+            if (mem_space_ids[i] >= 0 && H5Sclose(mem_space_ids[i]) < 0)
+                FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close memory dataspace");
+            if (file_space_ids[i] >= 0 && H5Sclose(file_space_ids[i]) < 0)
+                FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close file dataspace");
+        }
+
+        RV_write_buffer_discard(dsets[i]);
+
+        if (ret_value < 0 && dsets[i]->u.dataset.extent_pending && RV_dataset_get_extent(dsets[i]) < 0)
+            FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get extent of dataset %s from server",
+                            dsets[i]->URI);
+
+        dsets[i]->u.dataset.extent_pending = FALSE;
+    }
+
+    RV_free(bufs);
+    RV_free(mem_type_ids);
+    RV_free(mem_space_ids);
+    RV_free(file_space_ids);
+
+    return ret_value;
+} /* end RV_write_buffers_send() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_put_extent
+ *
+ * Purpose:     Changes the extent of a dataset on the server. The
+ *              dataset's local dataspace is left for the caller to
+ *              update.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_dataset_put_extent(const RV_object_t *dset, int ndims, const hsize_t *new_extent)
+{
+    size_t       host_header_len = 0;
+    size_t       request_body_size;
+    size_t       request_body_len = 0;
+    char        *host_header      = NULL;
+    char        *request_body     = NULL;
+    char         request_url[URL_MAX_LENGTH];
+    int          url_len = 0;
+    upload_info  uinfo;
+    RV_request_t request   = {0};
+    herr_t       ret_value = SUCCEED;
+
+    /* The dataset may still be queued for creation */
+    if (RV_flush_deferred_creates() < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't send deferred object creation requests");
+
+    /* Construct JSON containing new dataset extent */
+    request_body_size = (size_t)ndims * (MAX_NUM_LENGTH + 2) + sizeof("{\"shape\": []}");
+
+    if ((request_body = RV_malloc(request_body_size)) == NULL)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory for request body");
+
+    request_body_len = (size_t)snprintf(request_body, request_body_size, "{\"shape\": [");
+
+    for (int i = 0; i < ndims; i++)
+        request_body_len += (size_t)snprintf(request_body + request_body_len,
+                                             request_body_size - request_body_len, "%s%" PRIuHSIZE,
+                                             i > 0 ? ", " : "", new_extent[i]);
+
+    request_body_len += (size_t)snprintf(request_body + request_body_len,
+                                         request_body_size - request_body_len, "]}");
+
+    uinfo.buffer      = request_body;
+    uinfo.buffer_size = request_body_len;
+    uinfo.bytes_sent  = 0;
+
+    /* Set up curl request */
+    host_header_len = strlen(dset->domain->u.file.filepath_name) + strlen(host_string) + 1;
+    if (NULL == (host_header = (char *)RV_malloc(host_header_len)))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for request Host header");
+
+    strcpy(host_header, host_string);
+
+    curl_headers = curl_slist_append(curl_headers, strncat(host_header, dset->domain->u.file.filepath_name,
+                                                           host_header_len - strlen(host_string) - 1));
+
+    curl_headers = curl_slist_append(curl_headers, "Expect:");
+
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_HTTPHEADER, curl_headers))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set cURL HTTP headers: %s", curl_err_buf);
+
+    /* Target dataset's shape URL */
+    if ((url_len = snprintf(request_url, URL_MAX_LENGTH, "%s/datasets/%s/shape",
+                            dset->domain->u.file.server_info.base_URL, dset->URI)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if (url_len >= URL_MAX_LENGTH)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
+                        "H5Dset_extent request URL size exceeded maximum URL size");
+
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, request_url))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+
+    /* Make PUT request to change dataset extent */
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set up cURL to make HTTP PUT request: %s",
+                        curl_err_buf);
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_READDATA, &uinfo))
+        FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set cURL PUT data: %s", curl_err_buf);
+
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)request_body_len))
+        FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set cURL PUT data size: %s", curl_err_buf);
+
+    request.method       = "PUT";
+    request.url          = request_url;
+    request.domain       = dset->domain->u.file.filepath_name;
+    request.content_type = "application/json";
+    request.body         = request_body;
+    request.body_size    = request_body_len;
+
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Changing extent of dataset %s to %s", dset->URI, request_body);
+
+    CURL_PERFORM(curl, &request, H5E_DATASET, H5E_CANTGET, FAIL);
+
+done:
+    /* Unset cURL UPLOAD option to ensure that future requests don't try to use PUT calls */
+    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_UPLOAD, 0))
+        FUNC_DONE_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't unset cURL PUT option: %s", curl_err_buf);
+
+    if (curl_headers) {
+        curl_slist_free_all(curl_headers);
+        curl_headers = NULL;
+    }
+
+    RV_free(host_header);
+    RV_free(request_body);
+
+    return ret_value;
+} /* end RV_dataset_put_extent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_dataset_get_extent
+ *
+ * Purpose:     Updates the extent of a dataset's dataspace from the
+ *              server. Only the dataset's shape can change once it has
+ *              been created, so only the shape is fetched, rather than
+ *              everything needed to open the dataset. The dataspace is
+ *              updated in place, since other handles to the dataset
+ *              share it.
+ *
+ *              The request isn't made conditional on an ETag. A header
+ *              callback like the one chunk reads use could capture one,
+ *              but the shape response is only a few dozen bytes, so a
+ *              304 response would save next to nothing over the GET.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_dataset_get_extent(const RV_object_t *dset)
+{
+    char   request_endpoint[URL_MAX_LENGTH];
+    int    endpoint_len  = 0;
+    hid_t  new_dspace_id = H5I_INVALID_HID;
+    htri_t extent_equal;
+    herr_t ret_value = SUCCEED;
+
+    if ((endpoint_len = snprintf(request_endpoint, URL_MAX_LENGTH, "/datasets/%s/shape", dset->URI)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if (endpoint_len >= URL_MAX_LENGTH)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
+                        "dataset shape request URL size exceeded maximum URL size");
+
+    if (RV_curl_get(curl, &dset->domain->u.file.server_info, request_endpoint,
+                    dset->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Drefresh") < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset's shape");
+
+    if ((new_dspace_id = RV_parse_dataspace(response_buffer.buffer)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCONVERT, FAIL,
+                        "can't convert JSON to usable dataspace for dataset");
+
+    if ((extent_equal = H5Sextent_equal(new_dspace_id, dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't compare dataset extents");
+
+    if (!extent_equal) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Extent of dataset %s changed on server", dset->URI);
+
+        if (H5Sextent_copy(dset->u.dataset.space_id, new_dspace_id) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to modify extent of local dataspace");
+    }
+
+done:
+    if (new_dspace_id >= 0 && H5Sclose(new_dspace_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataspace");
+
+    return ret_value;
+} /* end RV_dataset_get_extent() */
+
+/* Helper to record the block moved by a read of a dataset in its handle's read-ahead state, returning
+ * whether the reads up to and including it form a sequential scan */
+static hbool_t
+RV_read_ahead_track(RV_read_ahead_t *read_ahead, int rank, const hsize_t *start, const hsize_t *count)
+{
+    hbool_t advanced = read_ahead->rank == rank;
+    int     axis     = -1;
+
+    /* The read advanced if it moves a block of the same shape as the last read, further along a single
+     * dimension */
+    for (int i = 0; i < rank && advanced; i++) {
+        if (count[i] != read_ahead->last_count[i])
+            advanced = FALSE;
+        else if (start[i] != read_ahead->last_start[i]) {
+            advanced = axis < 0 && start[i] > read_ahead->last_start[i];
+            axis     = i;
+        }
+    }
+
+    if (advanced && axis >= 0 && axis == read_ahead->axis &&
+        start[axis] - read_ahead->last_start[axis] == read_ahead->stride)
+        read_ahead->num_sequential++;
+    else if (advanced && axis >= 0) {
+        read_ahead->axis           = axis;
+        read_ahead->stride         = start[axis] - read_ahead->last_start[axis];
+        read_ahead->num_sequential = 2;
+    }
+    else {
+        read_ahead->axis           = -1;
+        read_ahead->num_sequential = 1;
+    }
+
+    read_ahead->rank = rank;
+    memcpy(read_ahead->last_start, start, (size_t)rank * sizeof(*start));
+    memcpy(read_ahead->last_count, count, (size_t)rank * sizeof(*count));
+
+    return read_ahead->num_sequential >= READ_AHEAD_MIN_SEQUENTIAL_READS;
+} /* end RV_read_ahead_track() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_read_ahead_get_block
+ *
+ * Purpose:     Finds the block to read in place of a block of a dataset
+ *              whose read continues a sequential scan: the block itself,
+ *              along with as many of the blocks the scan will read next
+ *              as the dataset handle's read-ahead depth allows. The block
+ *              is cut short by the end of the dataset's extent, and to
+ *              fit within the handle's read-ahead size.
+ *
+ * Return:      TRUE if the block reaches past the block read, FALSE if
+ *              not, and negative on failure
+ */
+static htri_t
+RV_read_ahead_get_block(const RV_object_t *dset, const hsize_t *start, const hsize_t *count,
+                        hsize_t *ahead_start, hsize_t *ahead_count)
+{
+    RV_read_ahead_t *read_ahead = dset->u.dataset.read_ahead;
+    hsize_t          dims[H5S_MAX_RANK];
+    hsize_t          max_len;
+    hsize_t          num_blocks;
+    hsize_t          end;
+    size_t           slice_size;
+    int              axis      = read_ahead->axis;
+    htri_t           ret_value = FALSE;
+
+    if (H5Sget_simple_extent_dims(dset->u.dataset.space_id, dims, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataset dimensions");
+
+    if ((slice_size = H5Tget_size(dset->u.dataset.dtype_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of dataset's datatype");
+
+    for (int i = 0; i < read_ahead->rank; i++)
+        if (i != axis)
+            slice_size *= (size_t)count[i];
+
+    /* Find how many blocks past the block read fit within the read-ahead size */
+    max_len = (hsize_t)(dset->u.dataset.read_ahead_size / slice_size);
+    if (max_len < count[axis])
+        FUNC_GOTO_DONE(FALSE);
+
+    num_blocks = (max_len - count[axis]) / read_ahead->stride;
+    if (num_blocks > dset->u.dataset.read_ahead_depth)
+        num_blocks = dset->u.dataset.read_ahead_depth;
+
+    end = start[axis] + num_blocks * read_ahead->stride + count[axis];
+    if (end > dims[axis])
+        end = dims[axis];
+    if (end <= start[axis] + count[axis])
+        FUNC_GOTO_DONE(FALSE);
+
+    memcpy(ahead_start, start, (size_t)read_ahead->rank * sizeof(*start));
+    memcpy(ahead_count, count, (size_t)read_ahead->rank * sizeof(*count));
+    ahead_count[axis] = end - start[axis];
+
+    ret_value = TRUE;
+
+done:
+    return ret_value;
+} /* end RV_read_ahead_get_block() */
+
+/* Helper to allocate the buffer and set up the dataspaces for a read of a dataset widened to read ahead */
+static herr_t
+RV_read_ahead_setup_read(const RV_object_t *dset, RV_read_ahead_read_t *ahead)
+{
+    hsize_t nelems = 1;
+    size_t  elem_size;
+    herr_t  ret_value = SUCCEED;
+
+    ahead->data = NULL;
+
+    for (int i = 0; i < ahead->rank; i++)
+        nelems *= ahead->ahead_count[i];
+
+    if ((elem_size = H5Tget_size(dset->u.dataset.dtype_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of dataset's datatype");
+
+    if (NULL == (ahead->data = RV_malloc((size_t)nelems * elem_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for data read ahead");
+
+    if ((ahead->mem_space_id = H5Screate_simple(ahead->rank, ahead->ahead_count, NULL)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create memory dataspace");
+
+    if ((ahead->file_space_id = H5Scopy(dset->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset's dataspace");
+
+    if (H5Sselect_hyperslab(ahead->file_space_id, H5S_SELECT_SET, ahead->ahead_start, NULL,
+                            ahead->ahead_count, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select block to read ahead");
+
+    if (RV_LOG_ENABLED(RV_LOG_CAT_TRANSFER, RV_LOG_LEVEL_DEBUG)) {
+        char dims_string[256];
+
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Reading ahead block of %s elements of dataset %s",
+                     RV_log_dims(ahead->ahead_count, (size_t)ahead->rank, dims_string, sizeof(dims_string)),
+                     dset->URI);
+    }
+
+done:
+    return ret_value;
+} /* end RV_read_ahead_setup_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_read_ahead_serve
+ *
+ * Purpose:     Serves a read which moves a single block of a dataset, as
+ *              determined by RV_dataset_get_selection_block(), from the
+ *              data read ahead by the dataset's handle, if the data
+ *              covers the block.
+ *
+ * Return:      TRUE if the read was served, FALSE if not, and negative
+ *              on failure
+ */
+static htri_t
+RV_read_ahead_serve(const RV_object_t *dset, const hsize_t *start, const hsize_t *count, hid_t mem_type_id,
+                    hid_t mem_space_id, hid_t file_space_id, void *buf)
+{
+    RV_read_ahead_t   *read_ahead = dset->u.dataset.read_ahead;
+    response_read_info resp_info;
+    hssize_t           mem_select_npoints;
+    hsize_t            nelems = 1;
+    size_t             block_size;
+    char              *block_buf = NULL;
+    htri_t             ret_value = FALSE;
+
+    if (!read_ahead || !read_ahead->data)
+        FUNC_GOTO_DONE(FALSE);
+
+    for (int i = 0; i < read_ahead->rank; i++) {
+        if (start[i] < read_ahead->start[i] ||
+            start[i] + count[i] > read_ahead->start[i] + read_ahead->count[i])
+            FUNC_GOTO_DONE(FALSE);
+
+        nelems *= count[i];
+    }
+
+    block_size = (size_t)nelems * read_ahead->elem_size;
 
-            for (size_t i = 0; i < (size_t)ndims; i++)
-                if (new_extent[i] > maxdims[i])
-                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
-                                    "new dataset dimensions exceed maximum dimensions");
+    /* With both selections "all", the memory buffer is laid out just like the block */
+    if (H5S_ALL == mem_space_id && H5S_ALL == file_space_id) {
+        RV_read_ahead_copy_block((char *)buf, start, count, read_ahead->data, read_ahead->start,
+                                 read_ahead->count, read_ahead->rank, read_ahead->elem_size);
+        FUNC_GOTO_DONE(TRUE);
+    }
 
-            if ((layout = H5Pget_layout(dset->u.dataset.dcpl_id)) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_PLIST, FAIL, "can't get layout from DCPL");
+    /* Otherwise, scatter the block to the memory selection, which is taken from the file dataspace if
+     * it is "all" */
+    if (H5S_ALL == mem_space_id)
+        mem_space_id = file_space_id;
 
-            if (layout != H5D_CHUNKED)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "non-chunked datasets cannot be resized");
+    if ((mem_select_npoints = H5Sget_select_npoints(mem_space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "memory dataspace is invalid");
+    if ((hsize_t)mem_select_npoints != nelems)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                        "memory selection num points != file selection num points");
 
-            /* Construct JSON containing new dataset extent */
-            const char *fmt_string = "{"
-                                     "\"shape\": [%s]"
-                                     "}";
+    if (NULL == (block_buf = RV_malloc(block_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for block read ahead");
 
-            /* Compute space needed for request */
-            size_t request_body_shape_size = 0;
+    RV_read_ahead_copy_block(block_buf, start, count, read_ahead->data, read_ahead->start, read_ahead->count,
+                             read_ahead->rank, read_ahead->elem_size);
 
-            for (size_t i = 0; i < ndims; i++) {
-                /* N bytes needed to store an N digit number,
-                 *  floor(log10) + 1 of an N digit number is >= N,
-                 *  plus two bytes for space and comma characters in the list */
-                double num_digits = 0;
+    memset(&resp_info, 0, sizeof(resp_info));
+    resp_info.buffer    = block_buf;
+    resp_info.read_size = &block_size;
 
-                if (new_extent[i] == 0) {
-                    num_digits = 1;
-                }
-                else {
-                    num_digits = floor(log10((double)new_extent[i]));
-                }
+    if (H5Dscatter(dataset_read_scatter_op, &resp_info, mem_type_id, mem_space_id, buf) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't scatter data to read buffer");
 
-                request_body_shape_size += (size_t)num_digits + 1 + 2;
-            }
+    ret_value = TRUE;
 
-            if ((request_body = RV_malloc(request_body_shape_size + strlen(fmt_string) + 1)) == NULL)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory for request body");
+done:
+    if (ret_value > 0)
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Served read of dataset %s from data read ahead", dset->URI);
 
-            if ((request_body_shape = RV_malloc(request_body_shape_size)) == NULL)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                "can't allocate memory for request body shape");
+    RV_free(block_buf);
 
-            request_body_shape[0]   = '\0';
-            char *curr_internal_ptr = request_body_shape;
+    return ret_value;
+} /* end RV_read_ahead_serve() */
 
-            char dim_buffer[URL_MAX_LENGTH];
+/* Helper to copy a block of elements, stored in row-major order, out of its place in a larger block */
+static void
+RV_read_ahead_copy_block(char *dst, const hsize_t *dst_start, const hsize_t *dst_count, const char *src,
+                         const hsize_t *src_start, const hsize_t *src_count, int rank, size_t elem_size)
+{
+    hsize_t row_index[H5S_MAX_RANK] = {0};
+    size_t  row_size                = (size_t)dst_count[rank - 1] * elem_size;
+    size_t  num_rows                = 1;
 
-            for (size_t i = 0; i < ndims; i++) {
-                int dim_len = snprintf(dim_buffer, URL_MAX_LENGTH, "%zu", new_extent[i]);
+    for (int i = 0; i < rank - 1; i++)
+        num_rows *= (size_t)dst_count[i];
 
-                strcat(curr_internal_ptr, dim_buffer);
-                curr_internal_ptr += dim_len;
+    for (size_t row = 0; row < num_rows; row++) {
+        size_t src_offset = 0;
 
-                if (i != ndims - 1) {
-                    strcat(curr_internal_ptr, ", ");
-                    curr_internal_ptr += 2;
-                }
-            }
+        for (int i = 0; i < rank; i++)
+            src_offset =
+                src_offset * (size_t)src_count[i] + (size_t)(dst_start[i] + row_index[i] - src_start[i]);
 
-            snprintf(request_body, request_body_shape_size + strlen(fmt_string) + 1, fmt_string,
-                     request_body_shape);
+        memcpy(dst + row * row_size, src + src_offset * elem_size, row_size);
 
-            uinfo.buffer      = request_body;
-            uinfo.buffer_size = (size_t)strlen(request_body);
-            uinfo.bytes_sent  = 0;
+        for (int i = rank - 2; i >= 0 && ++row_index[i] == dst_count[i]; i--)
+            row_index[i] = 0;
+    }
+} /* end RV_read_ahead_copy_block() */
 
-            /* Target dataset's shape URL */
-            memset(request_url, 0, URL_MAX_LENGTH);
+/* Helper to keep the data of a widened read as the data read ahead by a dataset's handle, in place of any
+ * kept before. The handle takes ownership of the data. */
+static herr_t
+RV_read_ahead_store(RV_object_t *dset, RV_read_ahead_read_t *ahead)
+{
+    RV_read_ahead_t *read_ahead = dset->u.dataset.read_ahead;
+    size_t           elem_size;
+    herr_t           ret_value = SUCCEED;
 
-            /* Set up curl request */
-            host_header_len = strlen(dset->domain->u.file.filepath_name) + strlen(host_string) + 1;
-            if (NULL == (host_header = (char *)RV_malloc(host_header_len)))
-                FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for request Host header");
+    if ((elem_size = H5Tget_size(dset->u.dataset.dtype_id)) == 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to get size of dataset's datatype");
 
-            strcpy(host_header, host_string);
+    if (!read_ahead->data) {
+        if (RV_num_read_ahead_dsets_g == RV_read_ahead_dsets_nalloc_g) {
+            RV_object_t **tmp_realloc = NULL;
+            size_t        new_nalloc  = 8;
 
-            curl_headers =
-                curl_slist_append(curl_headers, strncat(host_header, dset->domain->u.file.filepath_name,
-                                                        host_header_len - strlen(host_string) - 1));
+            if (RV_read_ahead_dsets_nalloc_g)
+                new_nalloc = 2 * RV_read_ahead_dsets_nalloc_g;
 
-            curl_headers = curl_slist_append(curl_headers, "Expect:");
+            if (NULL == (tmp_realloc = RV_realloc(RV_read_ahead_dsets_g, new_nalloc * sizeof(*tmp_realloc))))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow list of datasets read ahead");
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_HTTPHEADER, curl_headers))
-                FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set cURL HTTP headers: %s", curl_err_buf);
+            RV_read_ahead_dsets_g        = tmp_realloc;
+            RV_read_ahead_dsets_nalloc_g = new_nalloc;
+        }
 
-            if ((url_len = snprintf(request_url, URL_MAX_LENGTH, "%s/datasets/%s/shape",
-                                    dset->domain->u.file.server_info.base_URL, dset->URI)) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+        RV_read_ahead_dsets_g[RV_num_read_ahead_dsets_g++] = dset;
+    }
 
-            if (url_len >= URL_MAX_LENGTH)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
-                                "H5Dset_extent request URL size exceeded maximum URL size");
+    RV_free(read_ahead->data);
+    read_ahead->data      = ahead->data;
+    read_ahead->elem_size = elem_size;
+    memcpy(read_ahead->start, ahead->ahead_start, (size_t)ahead->rank * sizeof(*ahead->ahead_start));
+    memcpy(read_ahead->count, ahead->ahead_count, (size_t)ahead->rank * sizeof(*ahead->ahead_count));
 
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, request_url))
-                FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
+    ahead->data = NULL;
 
-            /* Make PUT request to change dataset extent */
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L))
-                FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set up cURL to make HTTP PUT request: %s",
-                                curl_err_buf);
-            if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_READDATA, &uinfo))
-                FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set cURL PUT data: %s", curl_err_buf);
+done:
+    return ret_value;
+} /* end RV_read_ahead_store() */
 
-            if (CURLE_OK !=
-                curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)strlen(request_body)))
-                FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set cURL PUT data size: %s",
-                                curl_err_buf);
-            CURL_PERFORM(curl, H5E_DATASET, H5E_CANTGET, FAIL);
+/* Helper to drop the data read ahead by a dataset's handle */
+static void
+RV_read_ahead_drop(RV_object_t *dset)
+{
+    if (!dset->u.dataset.read_ahead || !dset->u.dataset.read_ahead->data)
+        return;
 
-            /* Modify local dataspace to match version on server */
-            if (H5Sset_extent_simple(dset->u.dataset.space_id, ndims, new_extent, maxdims) < 0)
-                FUNC_GOTO_ERROR(H5E_DATASET, H5E_DATASPACE, FAIL,
-                                "unable to modify extent of local dataspace");
+    RV_free(dset->u.dataset.read_ahead->data);
+    dset->u.dataset.read_ahead->data = NULL;
 
+    for (size_t i = 0; i < RV_num_read_ahead_dsets_g; i++)
+        if (RV_read_ahead_dsets_g[i] == dset) {
+            RV_read_ahead_dsets_g[i] = RV_read_ahead_dsets_g[--RV_num_read_ahead_dsets_g];
             break;
         }
 
-        /* H5Dflush */
-        case H5VL_DATASET_FLUSH:
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "H5Dflush is unsupported");
-            break;
+    if (!RV_num_read_ahead_dsets_g) {
+        RV_free(RV_read_ahead_dsets_g);
+        RV_read_ahead_dsets_g        = NULL;
+        RV_read_ahead_dsets_nalloc_g = 0;
+    }
+} /* end RV_read_ahead_drop() */
 
-        /* H5Drefresh */
-        case H5VL_DATASET_REFRESH:
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "H5Drefresh is unsupported");
-            break;
+/*-------------------------------------------------------------------------
+ * Function:    RV_read_ahead_invalidate
+ *
+ * Purpose:     Drops the data read ahead by every handle to a dataset
+ *              which the given selection in the dataset's dataspace,
+ *              about to be written to, overlaps. H5S_ALL drops all of
+ *              it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_read_ahead_invalidate(const RV_object_t *dset, hid_t file_space_id)
+{
+    hssize_t npoints;
+    hsize_t  start[H5S_MAX_RANK];
+    hsize_t  end[H5S_MAX_RANK];
+    herr_t   ret_value = SUCCEED;
 
-        default:
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unknown dataset operation");
-    } /* end switch */
+    if (!RV_num_read_ahead_dsets_g)
+        FUNC_GOTO_DONE(SUCCEED);
 
-done:
-    PRINT_ERROR_STACK;
+    if (H5S_ALL != file_space_id) {
+        if ((npoints = H5Sget_select_npoints(file_space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace is invalid");
+        if (npoints == 0)
+            FUNC_GOTO_DONE(SUCCEED);
 
-    /* Unset cURL UPLOAD option to ensure that future requests don't try to use PUT calls */
-    if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_UPLOAD, 0))
-        FUNC_DONE_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't unset cURL PUT option: %s", curl_err_buf);
+        if (H5Sget_select_bounds(file_space_id, start, end) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+    }
 
-    if (host_header)
-        RV_free(host_header);
+    /* Dropping a handle's data removes it from the list, so walk the list backwards */
+    for (size_t i = RV_num_read_ahead_dsets_g; i > 0; i--) {
+        RV_object_t     *ahead_dset = RV_read_ahead_dsets_g[i - 1];
+        RV_read_ahead_t *read_ahead = ahead_dset->u.dataset.read_ahead;
+        hbool_t          overlaps   = TRUE;
 
-    if (curl_headers) {
-        curl_slist_free_all(curl_headers);
-        curl_headers = NULL;
-    }
+        if (ahead_dset != dset &&
+            (strcmp(ahead_dset->URI, dset->URI) ||
+             strcmp(ahead_dset->domain->u.file.filepath_name, dset->domain->u.file.filepath_name)))
+            continue;
 
-    if ((ret_value < 0) && (new_dspace_id != H5I_INVALID_HID))
-        H5Sclose(new_dspace_id);
+        if (H5S_ALL != file_space_id)
+            for (int j = 0; j < read_ahead->rank && overlaps; j++)
+                overlaps = start[j] < read_ahead->start[j] + read_ahead->count[j] &&
+                           read_ahead->start[j] <= end[j];
 
-    RV_free(old_extent);
-    RV_free(request_body);
-    RV_free(request_body_shape);
-    RV_free(maxdims);
+        if (overlaps)
+            RV_read_ahead_drop(ahead_dset);
+    }
 
+done:
     return ret_value;
-} /* end RV_dataset_specific() */
+} /* end RV_read_ahead_invalidate() */
+
+/* Helper to sort batched reads by the start of their bounding boxes, in row-major order */
+static int
+RV_batch_read_cmp(const void *_read1, const void *_read2)
+{
+    const RV_batch_read_t *read1 = (const RV_batch_read_t *)_read1;
+    const RV_batch_read_t *read2 = (const RV_batch_read_t *)_read2;
+
+    for (int i = 0; i < H5S_MAX_RANK; i++)
+        if (read1->start[i] != read2->start[i])
+            return read1->start[i] < read2->start[i] ? -1 : 1;
+
+    return 0;
+} /* end RV_batch_read_cmp() */
+
+/* Helper to get the number of elements in a box, given the coordinates of its first and last elements */
+static hsize_t
+RV_batch_box_nelems(const hsize_t *start, const hsize_t *end, int rank)
+{
+    hsize_t nelems = 1;
+
+    for (int i = 0; i < rank; i++)
+        nelems *= end[i] - start[i] + 1;
+
+    return nelems;
+} /* end RV_batch_box_nelems() */
 
 /*-------------------------------------------------------------------------
- * Function:    RV_dataset_close
+ * Function:    RV_batch_group_scatter
  *
- * Purpose:     Closes an HDF5 dataset by freeing the memory allocated for
- *              its internal memory struct object. There is no interaction
- *              with the server, whose state is unchanged.
+ * Purpose:     Copies the elements of one of the selections of a group of
+ *              merged batched reads out of the data read for the group's
+ *              bounding box, and scatters them to the selection's memory
+ *              buffer.
  *
  * Return:      Non-negative on success/Negative on failure
- *
- * Programmer:  Jordan Henderson
- *              March, 2017
  */
-herr_t
-RV_dataset_close(void *dset, hid_t dxpl_id, void **req)
+static herr_t
+RV_batch_group_scatter(const RV_batch_group_t *group, hid_t mem_type_id, size_t mem_type_size,
+                       hid_t mem_space_id, hid_t file_space_id, void *buf)
 {
-    RV_object_t *_dset     = (RV_object_t *)dset;
-    herr_t       ret_value = SUCCEED;
-
-    if (!_dset)
-        FUNC_GOTO_DONE(SUCCEED);
-
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received dataset close call with following parameters:\n");
-    printf("     - Dataset's URI: %s\n", _dset->URI);
-    printf("     - Dataset's object type: %s\n", object_type_to_string(_dset->obj_type));
-    if (_dset->domain && _dset->domain->u.file.filepath_name)
-        printf("     - Dataset's domain path: %s\n", _dset->domain->u.file.filepath_name);
-    printf("\n");
-#endif
-
-    if (H5I_DATASET != _dset->obj_type)
-        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a dataset");
+    response_read_info resp_info;
+    hssize_t           file_select_npoints;
+    hssize_t           mem_select_npoints;
+    size_t             data_size;
+    hid_t              box_space_id = H5I_INVALID_HID;
+    void              *data         = NULL;
+    herr_t             ret_value    = SUCCEED;
+
+    /* The memory selection is taken from the file dataspace if it is "all" */
+    if (H5S_ALL == mem_space_id)
+        mem_space_id = file_space_id;
+
+    if ((mem_select_npoints = H5Sget_select_npoints(mem_space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "memory dataspace is invalid");
+    if ((file_select_npoints = H5Sget_select_npoints(file_space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace is invalid");
+    if (mem_select_npoints != file_select_npoints)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                        "memory selection num points != file selection num points");
 
-    if (_dset->u.dataset.dtype_id >= 0 && H5Tclose(_dset->u.dataset.dtype_id) < 0)
-        FUNC_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset's datatype");
+    /* Find where the selection's elements are in the data read for the bounding box */
+    if ((box_space_id =
+             H5Sselect_project_intersection(group->file_space_id, group->mem_space_id, file_space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't project selection into merged read");
 
-    if (_dset->u.dataset.space_id >= 0 && H5Sclose(_dset->u.dataset.space_id) < 0)
-        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset's dataspace");
+    data_size = (size_t)file_select_npoints * mem_type_size;
 
-    if (_dset->u.dataset.dapl_id >= 0) {
-        if (_dset->u.dataset.dapl_id != H5P_DATASET_ACCESS_DEFAULT && H5Pclose(_dset->u.dataset.dapl_id) < 0)
-            FUNC_DONE_ERROR(H5E_PLIST, H5E_CANTCLOSEOBJ, FAIL, "can't close DAPL");
-    } /* end if */
-    if (_dset->u.dataset.dcpl_id >= 0) {
-        if (_dset->u.dataset.dcpl_id != H5P_DATASET_CREATE_DEFAULT && H5Pclose(_dset->u.dataset.dcpl_id) < 0)
-            FUNC_DONE_ERROR(H5E_PLIST, H5E_CANTCLOSEOBJ, FAIL, "can't close DCPL");
-    } /* end if */
+    if (NULL == (data = RV_malloc(data_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for selection's data");
 
-    if (RV_type_info_array_g[H5I_DATASET])
-        rv_hash_table_remove(RV_type_info_array_g[H5I_DATASET]->table, (char *)_dset->URI);
+    if (H5Dgather(box_space_id, group->data, mem_type_id, data_size, data, NULL, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't gather selection out of merged read");
 
-    if (RV_file_close(_dset->domain, H5P_DEFAULT, NULL)) {
-        FUNC_DONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file");
-    }
+    memset(&resp_info, 0, sizeof(resp_info));
+    resp_info.buffer    = data;
+    resp_info.read_size = &data_size;
 
-    RV_free(_dset->handle_path);
-    RV_free(_dset);
-    _dset = NULL;
+    if (H5Dscatter(dataset_read_scatter_op, &resp_info, mem_type_id, mem_space_id, buf) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't scatter data to read buffer");
 
 done:
-    PRINT_ERROR_STACK;
+    if (box_space_id >= 0 && H5Sclose(box_space_id) < 0)
+        FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataspace");
+
+    RV_free(data);
 
     return ret_value;
-} /* end RV_dataset_close() */
+} /* end RV_batch_group_scatter() */
 
 /*-------------------------------------------------------------------------
  * Function:    RV_parse_dataset_creation_properties_callback
@@ -1902,9 +4526,7 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
     const char   *path_name          = NULL;
     herr_t        ret_value          = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving dataset's creation properties from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Retrieving dataset's creation properties from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1955,30 +4577,22 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
         if (!strcmp(alloc_time_string, "H5D_ALLOC_TIME_EARLY")) {
             alloc_time = H5D_ALLOC_TIME_EARLY;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting AllocTime H5D_ALLOC_TIME_EARLY on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting AllocTime H5D_ALLOC_TIME_EARLY on DCPL");
         } /* end if */
         else if (!strcmp(alloc_time_string, "H5D_ALLOC_TIME_INCR")) {
             alloc_time = H5D_ALLOC_TIME_INCR;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting AllocTime H5D_ALLOC_TIME_INCR on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting AllocTime H5D_ALLOC_TIME_INCR on DCPL");
         } /* end else if */
         else if (!strcmp(alloc_time_string, "H5D_ALLOC_TIME_LATE")) {
             alloc_time = H5D_ALLOC_TIME_LATE;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting AllocTime H5D_ALLOC_TIME_LATE on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting AllocTime H5D_ALLOC_TIME_LATE on DCPL");
         } /* end else if */
         else {
             alloc_time = H5D_ALLOC_TIME_DEFAULT;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting AllocTime H5D_ALLOC_TIME_DEFAULT on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting AllocTime H5D_ALLOC_TIME_DEFAULT on DCPL");
         } /* end else */
 
         if (H5Pset_alloc_time(*DCPL, alloc_time) < 0)
@@ -2003,17 +4617,14 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
         if (!strcmp(crt_order_string, "H5P_CRT_ORDER_INDEXED")) {
             crt_order_flags = H5P_CRT_ORDER_INDEXED | H5P_CRT_ORDER_TRACKED;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting attribute creation order H5P_CRT_ORDER_INDEXED + H5P_CRT_ORDER_TRACKED on "
-                   "DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting attribute creation order H5P_CRT_ORDER_INDEXED + "
+                         "H5P_CRT_ORDER_TRACKED on DCPL");
         } /* end if */
         else {
             crt_order_flags = H5P_CRT_ORDER_TRACKED;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting attribute creation order H5P_CRT_ORDER_TRACKED on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET,
+                         "Setting attribute creation order H5P_CRT_ORDER_TRACKED on DCPL");
         } /* end else */
 
         if (H5Pset_attr_creation_order(*DCPL, crt_order_flags) < 0)
@@ -2058,10 +4669,9 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
 
         if (minDense != DATASET_CREATE_MIN_DENSE_ATTRIBUTES_DEFAULT ||
             maxCompact != DATASET_CREATE_MAX_COMPACT_ATTRIBUTES_DEFAULT) {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting attribute phase change values: [ minDense: %u, maxCompact: %u ] on DCPL\n",
-                   minDense, maxCompact);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET,
+                         "Setting attribute phase change values: [ minDense: %u, maxCompact: %u ] on DCPL",
+                         minDense, maxCompact);
 
             if (H5Pset_attr_phase_change(*DCPL, maxCompact, minDense) < 0)
                 FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL,
@@ -2086,23 +4696,17 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
         if (!strcmp(fill_time_str, "H5D_FILL_TIME_ALLOC")) {
             fill_time = H5D_FILL_TIME_ALLOC;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting fill time H5D_FILL_TIME_ALLOC on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting fill time H5D_FILL_TIME_ALLOC on DCPL");
         } /* end else if */
         else if (!strcmp(fill_time_str, "H5D_FILL_TIME_NEVER")) {
             fill_time = H5D_FILL_TIME_NEVER;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting fill time H5D_FILL_TIME_NEVER on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting fill time H5D_FILL_TIME_NEVER on DCPL");
         } /* end else if */
         else {
             fill_time = H5D_FILL_TIME_IFSET;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting fill time H5D_FILL_TIME_IFSET on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting fill time H5D_FILL_TIME_IFSET on DCPL");
         } /* end else */
 
         if (H5Pset_fill_time(*DCPL, fill_time) < 0)
@@ -2178,10 +4782,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                     const char *deflate_level_keys[] = {"level", (const char *)0};
                     long long   deflate_level;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_DEFLATE in JSON response; setting deflate "
-                           "filter on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_DEFLATE in JSON "
+                                 "response; setting deflate filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2212,10 +4814,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                 }
 
                 case H5Z_FILTER_SHUFFLE: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_SHUFFLE in JSON response; setting shuffle "
-                           "filter on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_SHUFFLE in JSON "
+                                 "response; setting shuffle filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2232,10 +4832,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                 }
 
                 case H5Z_FILTER_FLETCHER32: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_FLETCHER32 in JSON response; setting "
-                           "fletcher32 filter on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_FLETCHER32 in JSON "
+                                 "response; setting fletcher32 filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2258,10 +4856,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                     char       *szip_option_mask;
                     long long   szip_ppb;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_SZIP in JSON response; setting SZIP filter "
-                           "on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_SZIP in JSON "
+                                 "response; setting SZIP filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2313,10 +4909,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                 }
 
                 case H5Z_FILTER_NBIT: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_NBIT in JSON response; setting N-Bit "
-                           "filter on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_NBIT in JSON "
+                                 "response; setting N-Bit filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2339,10 +4933,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                     long long           scale_offset;
                     char               *scale_type_str;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_SCALEOFFSET in JSON response; setting "
-                           "scale-offset filter on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_SCALEOFFSET in "
+                                 "JSON response; setting scale-offset filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2390,10 +4982,8 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                 }
 
                 case LZF_FILTER_ID: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Discovered filter class H5Z_FILTER_LZF in JSON response; setting LZF filter "
-                           "on DCPL\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Discovered filter class H5Z_FILTER_LZF in JSON "
+                                 "response; setting LZF filter on DCPL");
 
                     /* Quick sanity check; push an error to the stack on failure, but don't fail this function
                      */
@@ -2452,11 +5042,9 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                     break;
             }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Filter %zu:\n", i);
-            printf("->   Class: %s\n", filter_class);
-            printf("->   ID: %lld\n", filter_ID);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Filter %zu:", i);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Class: %s", filter_class);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "ID: %lld", filter_ID);
         } /* end for */
     }     /* end if */
 
@@ -2499,16 +5087,13 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                 chunk_dims[i] = (hsize_t)val;
             } /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting chunked layout on DCPL\n");
-            printf("-> Chunk dims: [ ");
-            for (i = 0; i < YAJL_GET_ARRAY(chunk_dims_obj)->len; i++) {
-                if (i > 0)
-                    printf(", ");
-                printf("%" PRIuHSIZE, chunk_dims[i]);
-            }
-            printf(" ]\n");
-#endif
+            if (RV_LOG_ENABLED(RV_LOG_CAT_DATASET, RV_LOG_LEVEL_DEBUG)) {
+                char dims_string[RV_LOG_DIMS_STRING_MAX];
+
+                RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting chunked layout on DCPL with chunk dims %s",
+                             RV_log_dims(chunk_dims, YAJL_GET_ARRAY(chunk_dims_obj)->len, dims_string,
+                                         sizeof(dims_string)));
+            } /* end if */
 
             if (H5Pset_chunk(*DCPL, (int)YAJL_GET_ARRAY(chunk_dims_obj)->len, chunk_dims) < 0)
                 FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunked storage layout on DCPL");
@@ -2520,17 +5105,13 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
                                 "dataset external file storage is unsupported");
             } /* end if */
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting contiguous layout on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting contiguous layout on DCPL");
 
             if (H5Pset_layout(*DCPL, H5D_CONTIGUOUS) < 0)
                 FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set contiguous storage layout on DCPL");
         } /* end if */
         else if (!strcmp(layout_class, "H5D_COMPACT")) {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Setting compact layout on DCPL\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting compact layout on DCPL");
 
             if (H5Pset_layout(*DCPL, H5D_COMPACT) < 0)
                 FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set compact storage layout on DCPL");
@@ -2553,18 +5134,13 @@ RV_parse_dataset_creation_properties_callback(char *HTTP_response, const void *c
 
         track_times = !strcmp(track_times_str, "true");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Setting track times: %s on DCPL\n", track_times ? "true" : "false");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting track times: %s on DCPL", track_times ? "true" : "false");
 
         if (H5Pset_obj_track_times(*DCPL, track_times) < 0)
             FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set track object times property on DCPL");
     } /* end if */
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("\n");
-#endif
 
     if (parse_tree)
         yajl_tree_free(parse_tree);
@@ -2620,9 +5196,7 @@ RV_convert_dataset_creation_properties_to_JSON(hid_t dcpl, char **creation_prope
     char  *ud_parameters  = NULL;
     herr_t ret_value      = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting dataset creation properties from DCPL to JSON\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Converting dataset creation properties from DCPL to JSON");
 
     if (!creation_properties_body)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
@@ -3109,11 +5683,9 @@ RV_convert_dataset_creation_properties_to_JSON(hid_t dcpl, char **creation_prope
                                 break;
 
                             default:
-#ifdef RV_CONNECTOR_DEBUG
-                                printf(
-                                    "-> Unable to add SZIP filter to DCPL - unsupported mask value specified "
-                                    "(not H5_SZIP_EC_OPTION_MASK or H5_SZIP_NN_OPTION_MASK)\n\n");
-#endif
+                                RV_LOG_WARN(RV_LOG_CAT_DATASET, "Unable to add SZIP filter to DCPL - "
+                                            "unsupported mask value specified (not H5_SZIP_EC_OPTION_MASK "
+                                            "or H5_SZIP_NN_OPTION_MASK)");
 
                                 if (flags & H5Z_FLAG_OPTIONAL)
                                     continue;
@@ -3212,11 +5784,9 @@ RV_convert_dataset_creation_properties_to_JSON(hid_t dcpl, char **creation_prope
                                 break;
 
                             default:
-#ifdef RV_CONNECTOR_DEBUG
-                                printf("-> Unable to add ScaleOffset filter to DCPL - unsupported scale type "
-                                       "specified (not H5Z_SO_FLOAT_DSCALE, H5Z_SO_FLOAT_ESCALE or "
-                                       "H5Z_SO_INT)\n\n");
-#endif
+                                RV_LOG_WARN(RV_LOG_CAT_DATASET, "Unable to add ScaleOffset filter to DCPL - "
+                                            "unsupported scale type specified (not H5Z_SO_FLOAT_DSCALE, "
+                                            "H5Z_SO_FLOAT_ESCALE or H5Z_SO_INT)");
 
                                 if (flags & H5Z_FLAG_OPTIONAL)
                                     continue;
@@ -3290,9 +5860,8 @@ RV_convert_dataset_creation_properties_to_JSON(hid_t dcpl, char **creation_prope
                     } /* LZF_FILTER_ID */
 
                     case H5Z_FILTER_ERROR: {
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Unknown filter specified for filter %zu - not adding to DCPL\n\n", i);
-#endif
+                        RV_LOG_WARN(RV_LOG_CAT_DATASET,
+                                    "Unknown filter specified for filter %zu - not adding to DCPL", i);
 
                         if (flags & H5Z_FLAG_OPTIONAL)
                             continue;
@@ -3732,9 +6301,7 @@ done:
                 *creation_properties_body_len = (size_t)buf_ptrdiff;
         } /* end if */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> DCPL JSON representation:\n%s\n\n", out_string);
-#endif
+        RV_LOG_TRACE(RV_LOG_CAT_DATASET, "DCPL JSON representation:\n%s", out_string);
     } /* end if */
     else {
         if (out_string)
@@ -3799,9 +6366,7 @@ RV_setup_dataset_create_request_body(void *parent_obj, const char *name, hid_t t
     int          link_body_len                = 0;
     herr_t       ret_value                    = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Setting up dataset creation request\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Setting up dataset creation request");
 
     if (H5I_FILE != pobj->obj_type && H5I_GROUP != pobj->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "parent object not a file or group");
@@ -3846,9 +6411,7 @@ RV_setup_dataset_create_request_body(void *parent_obj, const char *name, hid_t t
                                               "}";
         size_t            escaped_name_size = 0;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Creating JSON link for dataset\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATASET, "Creating JSON link for dataset");
 
         /* In case the user specified a path which contains multiple groups on the way to the
          * one which the dataset will ultimately be linked under, extract out the path to the
@@ -3929,18 +6492,13 @@ RV_setup_dataset_create_request_body(void *parent_obj, const char *name, hid_t t
                         "dataset create request body size exceeded allocated buffer size");
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("\n");
-#endif
 
     if (ret_value >= 0) {
         *create_request_body = out_string;
         if (create_request_body_len)
             *create_request_body_len = (size_t)create_request_len;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Dataset creation request JSON:\n%s\n\n", out_string);
-#endif
+        RV_LOG_TRACE(RV_LOG_CAT_DATASET, "Dataset creation request JSON:\n%s", out_string);
     } /* end if */
     else {
         if (out_string)
@@ -3991,9 +6549,7 @@ RV_convert_point_selection_to_binary(hid_t space_id, void **out_buf, size_t *out
     int      ndims;
     herr_t   ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting selection within dataspace to JSON\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Converting selection within dataspace to JSON");
 
     if (!out_buf)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace output buffer was NULL");
@@ -4087,9 +6643,7 @@ RV_convert_dataspace_selection_to_string(hid_t space_id, char **selection_string
     int       ndims;
     herr_t    ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting selection within dataspace to JSON\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Converting selection within dataspace to JSON");
 
     if (!selection_string)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace selection string was NULL");
@@ -4132,9 +6686,7 @@ RV_convert_dataspace_selection_to_string(hid_t space_id, char **selection_string
                                 "point selection not currently supported as a request parameter");
 
             case H5S_SEL_HYPERSLABS: {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Hyperslab selection\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Hyperslab selection");
                 /* Format the hyperslab selection according to the 'select' request/query parameter.
                  * This is composed of N triplets, one for each dimension of the dataspace, and looks like:
                  *
@@ -4222,9 +6774,7 @@ RV_convert_dataspace_selection_to_string(hid_t space_id, char **selection_string
                 hssize_t          num_points;
                 size_t            points_strlen = strlen(points_str);
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Point selection\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Point selection");
 
                 if ((num_points = H5Sget_select_npoints(space_id)) < 0)
                     FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of selected points");
@@ -4308,9 +6858,7 @@ RV_convert_dataspace_selection_to_string(hid_t space_id, char **selection_string
                                                 "\"stop\": %s,"
                                                 "\"step\": %s";
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Hyperslab selection\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Hyperslab selection");
 
                 if (NULL == (start = (hsize_t *)RV_malloc((size_t)ndims * sizeof(*start))))
                     FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL,
@@ -4422,9 +6970,7 @@ done:
                 *selection_string_len = (size_t)buf_ptrdiff;
         } /* end if */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Dataspace selection JSON representation:\n%s\n\n", out_string);
-#endif
+        RV_LOG_TRACE(RV_LOG_CAT_TRANSFER, "Dataspace selection JSON representation:\n%s", out_string);
     } /* end if */
     else {
         if (out_string)
@@ -4492,9 +7038,7 @@ RV_convert_obj_refs_to_buffer(const rv_obj_ref_t *ref_array, size_t ref_array_le
     int               ref_string_len = 0;
     herr_t            ret_value      = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting object ref. array to binary buffer\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Converting object ref. array to binary buffer");
 
     if (!ref_array)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "reference array pointer was NULL");
@@ -4566,12 +7110,12 @@ done:
         *buf_out     = out;
         *buf_out_len = out_len;
 
-#ifdef RV_CONNECTOR_DEBUG
-        for (i = 0; i < ref_array_len; i++) {
-            printf("-> Ref_array[%zu]: %s\n", i, (out + (i * OBJECT_REF_STRING_LEN)));
-        } /* end for */
-        printf("\n");
-#endif
+        if (RV_LOG_ENABLED(RV_LOG_CAT_TRANSFER, RV_LOG_LEVEL_DEBUG)) {
+            for (i = 0; i < ref_array_len; i++) {
+                RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Ref_array[%zu]: %s", i,
+                             (out + (i * OBJECT_REF_STRING_LEN)));
+            } /* end for */
+        }     /* end if */
     } /* end if */
     else {
         if (out)
@@ -4611,9 +7155,7 @@ RV_convert_buffer_to_obj_refs(char *ref_buf, size_t ref_buf_len, rv_obj_ref_t **
     size_t        out_len   = 0;
     herr_t        ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting binary buffer to ref. array\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Converting binary buffer to ref. array");
 
     if (!ref_buf)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "reference string buffer was NULL");
@@ -4674,12 +7216,11 @@ done:
         *buf_out     = out;
         *buf_out_len = out_len;
 
-#ifdef RV_CONNECTOR_DEBUG
-        for (i = 0; i < ref_buf_len; i++) {
-            printf("-> Ref_array[%zu]: %s\n", i, out[i].ref_obj_URI);
-        } /* end for */
-        printf("\n");
-#endif
+        if (RV_LOG_ENABLED(RV_LOG_CAT_TRANSFER, RV_LOG_LEVEL_DEBUG)) {
+            for (i = 0; i < ref_buf_len; i++) {
+                RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Ref_array[%zu]: %s", i, out[i].ref_obj_URI);
+            } /* end for */
+        }     /* end if */
     } /* end if */
     else {
         if (out)
@@ -4695,6 +7236,11 @@ done:
  * Purpose:     Callback for H5Dscatter() to scatter the given read buffer
  *              into the supplied destination buffer
  *
+ *              If type conversion is needed, each call converts the next
+ *              strip of elements from the read buffer and hands only that
+ *              strip to H5Dscatter(), so that a converted copy of the
+ *              entire read buffer is never created.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -4704,10 +7250,57 @@ static herr_t
 dataset_read_scatter_op(const void **src_buf, size_t *src_buf_bytes_used, void *op_data)
 {
     response_read_info *resp_info = (response_read_info *)op_data;
-    *src_buf                      = resp_info->buffer;
-    *src_buf_bytes_used           = *((size_t *)resp_info->read_size);
+    size_t              nelem;
+    char               *strip_start;
+    void               *conv_buf;
+    herr_t              ret_value = SUCCEED;
 
-    return 0;
+    if (!resp_info->needs_tconv) {
+        *src_buf            = resp_info->buffer;
+        *src_buf_bytes_used = *((size_t *)resp_info->read_size);
+
+        FUNC_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    if (resp_info->nelem_converted >= resp_info->nelem_total)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "no read data left to scatter");
+
+    nelem = resp_info->nelem_total - resp_info->nelem_converted;
+    if (nelem > resp_info->strip_nelem)
+        nelem = resp_info->strip_nelem;
+
+    strip_start = (char *)resp_info->buffer + resp_info->nelem_converted * resp_info->file_type_size;
+
+    /* If no conversion buffer was allocated, the memory type is no larger than
+     * the file type and the strip can be converted in place in the read buffer */
+    if (resp_info->tconv_buf) {
+        memcpy(resp_info->tconv_buf, strip_start, nelem * resp_info->file_type_size);
+        conv_buf = resp_info->tconv_buf;
+    } /* end if */
+    else
+        conv_buf = strip_start;
+
+    if (resp_info->bkg_buf) {
+        if (resp_info->bkg_src)
+            memcpy(resp_info->bkg_buf,
+                   (const char *)resp_info->bkg_src + resp_info->nelem_converted * resp_info->mem_type_size,
+                   nelem * resp_info->mem_type_size);
+        else
+            memset(resp_info->bkg_buf, 0, nelem * resp_info->mem_type_size);
+    } /* end if */
+
+    if (H5Tconvert(resp_info->file_type_id, resp_info->mem_type_id, nelem, conv_buf, resp_info->bkg_buf,
+                   H5P_DEFAULT) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,
+                        "failed to convert file datatype to memory datatype");
+
+    resp_info->nelem_converted += nelem;
+
+    *src_buf            = conv_buf;
+    *src_buf_bytes_used = nelem * resp_info->mem_type_size;
+
+done:
+    return ret_value;
 } /* end dataset_read_scatter_op() */
 
 /* Callback to be passed to rv_curl_multi_perform, for execution upon successful cURL request */
@@ -4725,10 +7318,12 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
 
     void *obj_ref_buf = NULL;
 
-    H5S_sel_type sel_type  = H5S_SEL_NONE;
-    void        *vlen_buf  = NULL;
-    void        *tconv_buf = NULL;
-    void        *bkg_buf   = NULL;
+    H5S_sel_type sel_type   = H5S_SEL_NONE;
+    void        *vlen_buf   = NULL;
+    void        *vlen_arena = NULL;
+    void        *tconv_buf  = NULL;
+    void        *bkg_buf    = NULL;
+    void        *bkg_gather = NULL;
 
     size_t  file_type_size = 0;
     size_t  mem_type_size  = 0;
@@ -4740,6 +7335,8 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
 
     RV_subset_t subset_type = H5T_SUBSET_BADVALUE;
 
+    memset(&resp_info, 0, sizeof(resp_info));
+
     if (H5T_NO_CLASS == (dtype_class = H5Tget_class(mem_type_id)))
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "memory datatype is invalid");
 
@@ -4751,6 +7348,10 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
     if ((file_select_npoints = H5Sget_select_npoints(mem_space_id)) < 0)
         FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "memory dataspace is invalid");
 
+    /* Nothing was read, so there's nothing to convert or scatter */
+    if (0 == file_select_npoints)
+        FUNC_GOTO_DONE(SUCCEED);
+
     if ((file_type_size = H5Tget_size(file_type_id)) == 0)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "memory datatype is invalid");
 
@@ -4764,14 +7365,19 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
     if ((sel_type = H5Sget_select_type(file_space_id)) < 0)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selection type for file space");
 
+    if ((needs_tconv = RV_need_tconv(file_type_id, mem_type_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to check if datatypes need conversion");
+
     if ((H5T_REFERENCE != dtype_class) && (H5T_VLEN != dtype_class) && !is_variable_str) {
         resp_info.buffer = resp_buffer.buffer;
     }
     else {
         if (H5T_VLEN == dtype_class) {
-            /* Variable length data returned in "packed" binary form */
-            if (RV_unpack_vlen_data(resp_buffer.buffer, mem_type_id, (size_t)file_select_npoints, &vlen_buf) <
-                0)
+            /* Variable length data returned in "packed" binary form. If the data will be
+             * converted, the unpacked sequences are only needed until then, so lay them all
+             * out in a single block instead of allocating each one separately */
+            if (RV_unpack_vlen_data(resp_buffer.buffer, mem_type_id, (size_t)file_select_npoints, &vlen_buf,
+                                    needs_tconv ? &vlen_arena : NULL) < 0)
                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_PARSEERROR, FAIL, "can't unpack vlen data from server");
 
             resp_info.buffer = vlen_buf;
@@ -4790,16 +7396,58 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
         }
     }
 
-    if ((needs_tconv = RV_need_tconv(file_type_id, mem_type_id)) < 0)
-        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "unable to check if datatypes need conversion");
-
     if (needs_tconv) {
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Beginning type conversion\n");
-#endif
-        /* Initialize type conversion */
-        RV_tconv_init(file_type_id, &file_type_size, mem_type_id, &mem_type_size, (size_t)file_select_npoints,
-                      TRUE, FALSE, &tconv_buf, &bkg_buf, NULL, &fill_bkg);
+        RV_tconv_reuse_t reuse = RV_TCONV_REUSE_NONE;
+        H5S_sel_type     mem_sel_type;
+        htri_t           contains_vlen;
+        htri_t           is_mem_contiguous = FALSE;
+        hssize_t         mem_offset        = 0;
+        hbool_t          use_user_buf = FALSE;
+        size_t           strip_nelem;
+
+        RV_LOG_DEBUG(RV_LOG_CAT_TRANSFER, "Beginning type conversion");
+        if ((contains_vlen = H5Tdetect_class(mem_type_id, H5T_VLEN)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't determine if datatype contains Vlen type");
+
+        if ((mem_sel_type = H5Sget_select_type(mem_space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection type for memory space");
+
+        /* Only "all" and hyperslab selections can be located in the user's buffer by their
+         * starting offset, even when a point selection of a single element is contiguous */
+        if (H5S_SEL_ALL == mem_sel_type || H5S_SEL_HYPERSLABS == mem_sel_type) {
+            if ((is_mem_contiguous = RV_dataspace_selection_is_contiguous(mem_space_id)) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                                "Unable to determine if the dataspace selection is contiguous");
+
+            if (is_mem_contiguous && (mem_offset = RV_convert_start_to_offset(mem_space_id)) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Unable to determine memory offset value");
+        } /* end if */
+
+        /* If the memory selection is contiguous and the memory type is at least as
+         * large as the file type, convert directly inside the user's buffer. Otherwise,
+         * convert one strip at a time while scattering into the user's buffer.
+         */
+        if (is_mem_contiguous && (mem_type_size >= file_type_size)) {
+            use_user_buf = TRUE;
+            strip_nelem  = (size_t)file_select_npoints;
+        } /* end if */
+        else {
+            strip_nelem =
+                DATASET_TCONV_STRIP_SIZE / (file_type_size > mem_type_size ? file_type_size : mem_type_size);
+
+            if (strip_nelem == 0)
+                strip_nelem = 1;
+            if (strip_nelem > (size_t)file_select_npoints)
+                strip_nelem = (size_t)file_select_npoints;
+        } /* end else */
+
+        /* Initialize type conversion. The read data is owned by this callback and may be
+         * converted in place, unless it holds vlen sequences which must be reclaimed after
+         * conversion. */
+        if (RV_tconv_init(file_type_id, &file_type_size, mem_type_id, &mem_type_size, strip_nelem, TRUE,
+                          FALSE, &tconv_buf, &bkg_buf, use_user_buf ? &reuse : NULL,
+                          !use_user_buf && !contains_vlen, &fill_bkg) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize type conversion");
 
         /* Handle compound subsetting */
         if (RV_get_cmpd_subset_type(file_type_id, mem_type_id, &subset_type) < 0)
@@ -4809,24 +7457,61 @@ RV_dataset_read_cb(hid_t mem_type_id, hid_t mem_space_id, hid_t file_type_id, hi
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL,
                             "error while checking if types are compound subsets");
 
-        if (subset_type == H5T_SUBSET_DST) {
-            /* Populate background buffer with bytes from user input buffer */
+        if (subset_type == H5T_SUBSET_DST)
             if (!bkg_buf || !fill_bkg)
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "compound subset requires bkg buffer");
 
-            memcpy(bkg_buf, buf, file_type_size * (size_t)file_select_npoints);
-        }
+        if (use_user_buf) {
+            char *user_buf = (char *)buf + (size_t)mem_offset * mem_type_size;
+
+            assert(reuse == RV_TCONV_REUSE_TCONV);
+
+            /* Populate background buffer with bytes from user input buffer
+             * before they are overwritten by the read data */
+            if (subset_type == H5T_SUBSET_DST)
+                memcpy(bkg_buf, user_buf, mem_type_size * (size_t)file_select_npoints);
+
+            /* Perform type conversion on response values within the user's buffer */
+            memcpy(user_buf, resp_info.buffer, file_type_size * (size_t)file_select_npoints);
+
+            if (H5Tconvert(file_type_id, mem_type_id, (size_t)file_select_npoints, user_buf, bkg_buf,
+                           H5P_DEFAULT) < 0)
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,
+                                "failed to convert file datatype to memory datatype");
+
+            /* Data is already in place, so there's nothing to scatter */
+            FUNC_GOTO_DONE(SUCCEED);
+        } /* end if */
 
-        /* Perform type conversion on response values */
-        /* TODO - Reuse bkg buffer/read buffer if possible */
-        memcpy(tconv_buf, resp_info.buffer, file_type_size * (size_t)file_select_npoints);
+        /* Have the scatter callback convert the response values strip by strip */
+        resp_info.needs_tconv     = TRUE;
+        resp_info.file_type_id    = file_type_id;
+        resp_info.mem_type_id     = mem_type_id;
+        resp_info.file_type_size  = file_type_size;
+        resp_info.mem_type_size   = mem_type_size;
+        resp_info.strip_nelem     = strip_nelem;
+        resp_info.nelem_total     = (size_t)file_select_npoints;
+        resp_info.nelem_converted = 0;
+        resp_info.tconv_buf       = tconv_buf;
+        resp_info.bkg_buf         = bkg_buf;
+
+        /* The background values must line up with the strips of converted elements, which
+         * are scattered in the order of the memory selection */
+        if (subset_type == H5T_SUBSET_DST) {
+            if (is_mem_contiguous)
+                resp_info.bkg_src = (const char *)buf + (size_t)mem_offset * mem_type_size;
+            else {
+                if (NULL == (bkg_gather = RV_malloc(mem_data_size)))
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                    "can't allocate buffer for compound background values");
 
-        if (H5Tconvert(file_type_id, mem_type_id, (size_t)file_select_npoints, tconv_buf, bkg_buf,
-                       H5P_DEFAULT) < 0)
-            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,
-                            "failed to convert file datatype to memory datatype");
+                if (H5Dgather(mem_space_id, buf, mem_type_id, mem_data_size, bkg_gather, NULL, NULL) < 0)
+                    FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL,
+                                    "can't gather compound background values from read buffer");
 
-        resp_info.buffer = tconv_buf;
+                resp_info.bkg_src = bkg_gather;
+            } /* end else */
+        }     /* end if */
     }
 
     /* Scatter the read data out to the supplied read buffer according to the
@@ -4840,30 +7525,28 @@ done:
     if (obj_ref_buf)
         RV_free(obj_ref_buf);
 
-    if (tconv_buf) {
-        htri_t contains_vlen = FALSE;
-
-        if ((contains_vlen = H5Tdetect_class(mem_type_id, H5T_VLEN)) < 0)
-            FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't determine if datatype contains Vlen type");
+    /* If the unpacked vlen sequences were converted, the user received
+     * newly-allocated copies of them, so the originals must be freed */
+    if (vlen_arena)
+        RV_free(vlen_arena);
+    else if (needs_tconv && vlen_buf) {
+        hid_t type_conv_space = H5I_INVALID_HID;
 
-        if (contains_vlen > 0) {
-            hid_t type_conv_space = H5I_INVALID_HID;
+        /* Vlen buffer is packed, so create a 1D dataspace to describe its layout */
+        if ((type_conv_space = H5Screate_simple(1, &file_select_npoints, NULL)) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL,
+                            "can't create simple dataspace for unpacked vlen buffer");
 
-            /* Vlen buffer is packed, so create a 1D dataspace to describe its layout */
-            if ((type_conv_space = H5Screate_simple(1, &file_select_npoints, NULL)) < 0)
-                FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL,
-                                "can't create simple dataspace for unpacked vlen buffer");
+        if ((H5Treclaim(mem_type_id, type_conv_space, H5P_DEFAULT, vlen_buf)) < 0)
+            FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't free type conversion buffer for vlen type");
 
-            if ((H5Treclaim(mem_type_id, type_conv_space, H5P_DEFAULT, vlen_buf)) < 0)
-                FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL,
-                                "can't free type conversion buffer for vlen type");
+        if (H5Sclose(type_conv_space) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                            "can't close dataspace for type conversion buffer");
+    }
 
-            if (H5Sclose(type_conv_space) < 0)
-                FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                                "can't close dataspace for type conversion buffer");
-        }
+    if (tconv_buf)
         RV_free(tconv_buf);
-    }
 
     if (vlen_buf) {
         RV_free(vlen_buf);
@@ -4872,9 +7555,32 @@ done:
     if (bkg_buf)
         RV_free(bkg_buf);
 
+    if (bkg_gather)
+        RV_free(bkg_gather);
+
     return ret_value;
 }
 
+/* Callback to be passed to rv_curl_multi_perform, for execution upon successful cURL request for a chunk
+ * read as the bytes it is stored as */
+herr_t
+RV_dataset_read_chunk_cb(dataset_read_info *read_info, struct response_buffer resp_buffer)
+{
+    size_t chunk_size = (size_t)(resp_buffer.curr_buf_ptr - resp_buffer.buffer);
+    herr_t ret_value  = SUCCEED;
+
+    if (read_info->buf_size && chunk_size > read_info->buf_size)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                        "chunk of %zu bytes doesn't fit in read buffer of %zu bytes", chunk_size,
+                        read_info->buf_size);
+
+    memcpy(read_info->buf, resp_buffer.buffer, chunk_size);
+    read_info->chunk_size = chunk_size;
+
+done:
+    return ret_value;
+} /* end RV_dataset_read_chunk_cb() */
+
 /*-------------------------------------------------------------------------
  * Function:    RV_dataspace_selection_is_contiguous
  *
@@ -5049,7 +7755,7 @@ RV_convert_start_to_offset(hid_t space_id)
 
             ret_value = (hssize_t)start[0];
             for (i = 1; i < ndims; i++) {
-                ret_value = ret_value * (hssize_t)(dims[i] + start[i]);
+                ret_value = ret_value * (hssize_t)dims[i] + (hssize_t)start[i];
             }
             break;
         } /* H5S_SEL_HYPERSLABS */
@@ -5200,6 +7906,9 @@ done:
  * Purpose:     Converts a buffer of hvl_t instances to a buffer containing
  *              the length of sequence following by each sequence's data.
  *
+ *              The exact size of the packed buffer is computed up front
+ *              so that it is allocated only once.
+ *
  *              Allocate memory under the *out pointer on success which must
  *              be freed by calling function.
  *
@@ -5216,7 +7925,6 @@ RV_pack_vlen_data(const hvl_t *in, size_t nelems, hid_t dtype_id, void **out, si
     char       *out_buf_curr_pos   = NULL;
     size_t      buf_size           = 0;
     size_t      parent_dtype_size  = 0;
-    size_t      target_size        = 0;
     hid_t       parent_dtype       = H5I_INVALID_HID;
     H5T_class_t parent_dtype_class = H5T_NO_CLASS;
 
@@ -5247,44 +7955,47 @@ RV_pack_vlen_data(const hvl_t *in, size_t nelems, hid_t dtype_id, void **out, si
     if ((parent_dtype_size = H5Tget_size(parent_dtype)) == 0)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get size of vlen parent datatype");
 
-    if ((out_buf = calloc(DATASET_VLEN_JSON_BODY_DEFAULT_SIZE, 1)) == NULL)
+    /* Compute the exact size of the packed buffer */
+    for (size_t i = 0; i < nelems; i++) {
+        size_t len_bytes = in[i].len * parent_dtype_size;
+
+        /* Sequence length must fit into 4 bytes */
+        if (len_bytes > UINT32_MAX)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sequence exceeded maximum size");
+
+        buf_size += sizeof(uint32_t) + len_bytes;
+    }
+
+    if ((out_buf = RV_malloc(buf_size)) == NULL)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for packed vlen data");
 
-    *out_size        = DATASET_VLEN_JSON_BODY_DEFAULT_SIZE;
-    buf_size         = *out_size;
     out_buf_curr_pos = out_buf;
 
     /* Pack each variable length sequence into the buffer */
     for (size_t i = 0; i < nelems; i++) {
-        /* Make sure space exists for this sequence */
-        ptrdiff_t curr_size = out_buf_curr_pos - out_buf;
-        hvl_t     vl        = in[i];
-        uint64_t  len_bytes = 0;
-
-        target_size = (size_t)curr_size + sizeof(uint32_t) + vl.len * parent_dtype_size;
-
-        CHECKED_REALLOC(out_buf, buf_size, target_size, out_buf_curr_pos, H5E_DATASET, FAIL);
+        uint32_t len_bytes = (uint32_t)(in[i].len * parent_dtype_size);
 
         /* Copy sequence length and sequence contents into output buffer */
-        len_bytes = vl.len * parent_dtype_size;
-
-        /* Sequence length must fit into 4 bytes */
-        if (len_bytes > UINT32_MAX)
-            FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sequence exceeded maximum size");
-
-        memcpy(out_buf_curr_pos, (uint64_t *)&len_bytes, sizeof(uint32_t));
+        memcpy(out_buf_curr_pos, &len_bytes, sizeof(uint32_t));
         out_buf_curr_pos += sizeof(uint32_t);
 
-        memcpy(out_buf_curr_pos, vl.p, vl.len * parent_dtype_size);
-        out_buf_curr_pos += vl.len * parent_dtype_size;
-        *out_size = (size_t)(out_buf_curr_pos - out_buf);
+        if (len_bytes > 0) {
+            memcpy(out_buf_curr_pos, in[i].p, len_bytes);
+            out_buf_curr_pos += len_bytes;
+        }
     }
 
-    *out = out_buf;
+    *out      = out_buf;
+    *out_size = buf_size;
+
 done:
     if (ret_value < 0 && out_buf)
         RV_free(out_buf);
 
+    if (parent_dtype != H5I_INVALID_HID)
+        if (H5Tclose(parent_dtype) < 0)
+            FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close vlen parent datatype");
+
     return ret_value;
 }
 
@@ -5294,9 +8005,13 @@ done:
  * Purpose:     Converts a buffer of packed hvl_t instances to a buffer of
  *              hvl_t instances.
  *
- *              Allocates memory for hvl_t instances which should be freed with
- *              H5Treclaim, and allocates under *out which should
- *              be freed directly by the calling function.
+ *              If arena is NULL, allocates memory for each sequence which
+ *              should be freed with H5Treclaim. Otherwise, the data for all
+ *              sequences is laid out in a single block returned under
+ *              *arena, which should be freed directly by the calling
+ *              function once the hvl_t instances are no longer needed. In
+ *              either case, allocates under *out which should be freed
+ *              directly by the calling function.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -5304,14 +8019,16 @@ done:
  *              March, 2024
  */
 static herr_t
-RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out)
+RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out, void **arena)
 {
     herr_t ret_value = SUCCEED;
     char  *out_buf   = NULL;
-    char  *out_buf_curr_ptr;
+    char  *arena_buf = NULL;
+    char  *arena_curr_ptr;
     char  *in_buf_ptr   = in;
     hid_t  parent_dtype = H5I_INVALID_HID;
     size_t parent_dtype_size;
+    size_t arena_size = 0;
     hvl_t *vl;
 
     if (!in)
@@ -5329,6 +8046,26 @@ RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out)
     if ((parent_dtype_size = H5Tget_size(parent_dtype)) == 0)
         FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get size of vlen parent datatype");
 
+    if (arena) {
+        /* Find the total size of all sequences, so they can be allocated at once */
+        for (size_t i = 0; i < nelems; i++) {
+            uint32_t num_seq_bytes;
+
+            memcpy(&num_seq_bytes, in_buf_ptr, sizeof(uint32_t));
+            in_buf_ptr += sizeof(uint32_t) + num_seq_bytes;
+            arena_size += num_seq_bytes;
+        }
+
+        in_buf_ptr = in;
+
+        if (arena_size > 0)
+            if ((arena_buf = RV_malloc(arena_size)) == NULL)
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                "can't allocate space for unpacking vlen data");
+    }
+
+    arena_curr_ptr = arena_buf;
+
     for (size_t i = 0; i < nelems; i++) {
         vl = ((hvl_t *)out_buf) + i;
         uint32_t num_seq_bytes;
@@ -5344,7 +8081,11 @@ RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out)
 
         /* Allocate memory for and copy sequence data */
         if (vl->len > 0) {
-            if ((vl->p = RV_calloc(num_seq_bytes)) == NULL)
+            if (arena_buf) {
+                vl->p = arena_curr_ptr;
+                arena_curr_ptr += num_seq_bytes;
+            }
+            else if ((vl->p = RV_calloc(num_seq_bytes)) == NULL)
                 FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                                 "can't allocate space for unpacking vlen data");
 
@@ -5359,22 +8100,30 @@ RV_unpack_vlen_data(char *in, hid_t vlen_dtype_id, size_t nelems, void **out)
 
     *out = out_buf;
 
+    if (arena)
+        *arena = arena_buf;
+
 done:
 
     if (ret_value < 0 && out_buf) {
         hvl_t tmp_vl;
+
         /* Free any memory allocated for individual sequences */
-        for (size_t i = 0; i < nelems; i++) {
-            memcpy(&tmp_vl, out_buf + i * sizeof(hvl_t), sizeof(hvl_t));
+        if (!arena)
+            for (size_t i = 0; i < nelems; i++) {
+                memcpy(&tmp_vl, out_buf + i * sizeof(hvl_t), sizeof(hvl_t));
 
-            if (tmp_vl.len > 0 && tmp_vl.p) {
-                RV_free(tmp_vl.p);
+                if (tmp_vl.len > 0 && tmp_vl.p) {
+                    RV_free(tmp_vl.p);
+                }
             }
-        }
 
         RV_free(out_buf);
     }
 
+    if (ret_value < 0 && arena_buf)
+        RV_free(arena_buf);
+
     if (parent_dtype != H5I_INVALID_HID)
         if (H5Tclose(parent_dtype) < 0)
             FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close vlen parent datatype");
@@ -29,6 +29,7 @@ herr_t RV_dataset_write(size_t count, void *dset[], hid_t mem_type_id[], hid_t m
                         hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void **req);
 herr_t RV_dataset_get(void *obj, H5VL_dataset_get_args_t *args, hid_t dxpl_id, void **req);
 herr_t RV_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid_t dxpl_id, void **req);
+herr_t RV_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **req);
 herr_t RV_dataset_close(void *dset, hid_t dxpl_id, void **req);
 
 #ifdef __cplusplus
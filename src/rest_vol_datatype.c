@@ -84,19 +84,24 @@ RV_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params, const char *n
     void        *ret_value          = NULL;
     long         http_response;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received datatype commit call with following parameters:\n");
-    printf("     - H5Tcommit variant: %s\n", name ? "H5Tcommit2" : "H5Tcommit_anon");
-    if (name)
-        printf("     - Datatype's name: %s\n", name);
-    printf("     - Datatype's class: %s\n", datatype_class_to_string(type_id));
-    printf("     - Datatype's parent object URI: %s\n", parent->URI);
-    printf("     - Datatype's parent object type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - Datatype's parent object domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Default LCPL? %s\n", (H5P_LINK_CREATE_DEFAULT == lcpl_id) ? "yes" : "no");
-    printf("     - Default TCPL? %s\n", (H5P_DATATYPE_CREATE_DEFAULT == tcpl_id) ? "yes" : "no");
-    printf("     - Default TAPL? %s\n\n", (H5P_DATATYPE_ACCESS_DEFAULT == tapl_id) ? "yes" : "no");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATATYPE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Received datatype commit call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "H5Tcommit variant: %s", name ? "H5Tcommit2" : "H5Tcommit_anon");
+        if (name)
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's name: %s", name);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's class: %s", datatype_class_to_string(type_id));
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's parent object URI: %s", parent->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's parent object type: %s",
+                     object_type_to_string(parent->obj_type));
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's parent object domain path: %s",
+                     parent->domain->u.file.filepath_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Default LCPL? %s",
+                     (H5P_LINK_CREATE_DEFAULT == lcpl_id) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Default TCPL? %s",
+                     (H5P_DATATYPE_CREATE_DEFAULT == tcpl_id) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Default TAPL? %s",
+                     (H5P_DATATYPE_ACCESS_DEFAULT == tapl_id) ? "yes" : "no");
+    } /* end if */
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -167,9 +172,7 @@ RV_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params, const char *n
                                              "\"name\": \"%s\""
                                              "}";
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Creating JSON link for datatype\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Creating JSON link for datatype");
 
         /* In case the user specified a path which contains multiple groups on the way to the
          * one which the datatype will ultimately be linked under, extract out the path to the
@@ -222,9 +225,7 @@ RV_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params, const char *n
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_SYSERRSTR, NULL,
                         "datatype create request body size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Datatype commit request body:\n%s\n\n", commit_request_body);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_DATATYPE, "Datatype commit request body:\n%s", commit_request_body);
 
     /* Redirect cURL from the base URL to "/datatypes" to commit the datatype */
     if ((url_len = snprintf(request_endpoint, URL_MAX_LENGTH, "/datatypes")) < 0)
@@ -234,43 +235,49 @@ RV_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params, const char *n
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_SYSERRSTR, NULL,
                         "datatype create URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Datatype commit URL: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype commit URL: %s", request_endpoint);
 
-    http_response = RV_curl_post(curl, &parent->domain->u.file.server_info, request_endpoint,
-                                 parent->domain->u.file.filepath_name, (const char *)commit_request_body,
-                                 (size_t)commit_request_len, CONTENT_TYPE_JSON);
+    if (parent->domain->u.file.deferred_create) {
+        /* Assign the datatype's URI now and send the request along with other object creations */
+        if (RV_deferred_create(parent->domain, H5I_DATATYPE, NULL, (const char *)commit_request_body,
+                               new_datatype->URI) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCREATE, NULL, "can't queue datatype commit");
+    } /* end if */
+    else {
+        http_response = RV_curl_post(curl, &parent->domain->u.file.server_info, request_endpoint,
+                                     parent->domain->u.file.filepath_name, (const char *)commit_request_body,
+                                     (size_t)commit_request_len, CONTENT_TYPE_JSON, "H5Tcommit");
 
-    if (!HTTP_SUCCESS(http_response))
-        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, NULL, "couldn't commit datatype: received HTTP %ld",
-                        http_response);
+        if (!HTTP_SUCCESS(http_response))
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, NULL,
+                            "couldn't commit datatype: received HTTP %ld", http_response);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Committed datatype\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Committed datatype");
 
-    /* Store the newly-committed Datatype's URI */
-    if (RV_parse_response(response_buffer.buffer, NULL, new_datatype->URI, RV_copy_object_URI_callback) < 0)
-        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, NULL, "can't parse committed datatype's URI");
+        /* Store the newly-committed Datatype's URI */
+        if (RV_parse_response(response_buffer.buffer, NULL, new_datatype->URI,
+                              RV_copy_object_URI_callback) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, NULL, "can't parse committed datatype's URI");
+    } /* end else */
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_DATATYPE]->table, (char *)new_datatype->URI,
-                             (char *)new_datatype) == 0)
+    if (RV_type_info_insert(H5I_DATATYPE, new_datatype) < 0)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, NULL, "Failed to add datatype to type info array");
 
     ret_value = (void *)new_datatype;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Datatype commit response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (new_datatype && ret_value) {
-        printf("-> Datatype's info:\n");
-        printf("     - Datatype's URI: %s\n", new_datatype->URI);
-        printf("     - Datatype's object type: %s\n", object_type_to_string(new_datatype->obj_type));
-        printf("     - Datatype's domain path: %s\n\n", new_datatype->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATATYPE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_DATATYPE, "Datatype commit response buffer:\n%s", response_buffer.buffer);
+
+        if (new_datatype && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's URI: %s", new_datatype->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's object type: %s",
+                         object_type_to_string(new_datatype->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's domain path: %s",
+                         new_datatype->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-#endif
 
     if (path_dirname)
         RV_free(path_dirname);
@@ -317,14 +324,13 @@ RV_datatype_open(void *obj, const H5VL_loc_params_t *loc_params, const char *nam
     size_t       path_len  = 0;
     void        *ret_value = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received datatype open call with following parameters:\n");
-    printf("     - loc_id object's URI: %s\n", parent->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - loc_id object's domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Path to datatype: %s\n", name);
-    printf("     - Default TAPL? %s\n\n", (H5P_DATATYPE_ACCESS_DEFAULT) ? "yes" : "no");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Received datatype open call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "loc_id object's URI: %s", parent->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "loc_id object's type: %s", object_type_to_string(parent->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "loc_id object's domain path: %s",
+                 parent->domain->u.file.filepath_name);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Path to datatype: %s", name);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Default TAPL? %s", (H5P_DATATYPE_ACCESS_DEFAULT) ? "yes" : "no");
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -362,9 +368,7 @@ RV_datatype_open(void *obj, const H5VL_loc_params_t *loc_params, const char *nam
 
     datatype->domain = loc_info_out.domain;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Found datatype by given path\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Found datatype by given path");
 
     /* Set up the actual datatype by converting the string representation into an hid_t */
     if ((datatype->u.datatype.dtype_id = RV_parse_datatype(response_buffer.buffer, TRUE)) < 0)
@@ -386,25 +390,26 @@ RV_datatype_open(void *obj, const H5VL_loc_params_t *loc_params, const char *nam
     if ((datatype->u.datatype.tcpl_id = H5Pcreate(H5P_DATATYPE_CREATE)) < 0)
         FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, NULL, "can't create TCPL for datatype");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_DATATYPE]->table, (char *)datatype->URI,
-                             (char *)datatype) == 0)
+    if (RV_type_info_insert(H5I_DATATYPE, datatype) < 0)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, NULL, "Failed to add datatype to type info array");
 
     ret_value = (void *)datatype;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Datatype open response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (datatype && ret_value) {
-        printf("-> Datatype's info:\n");
-        printf("     - Datatype's URI: %s\n", datatype->URI);
-        printf("     - Datatype's object type: %s\n", object_type_to_string(datatype->obj_type));
-        printf("     - Datatype's domain path: %s\n", datatype->domain->u.file.filepath_name);
-        printf("     - Datatype's datatype class: %s\n\n",
-               datatype_class_to_string(datatype->u.datatype.dtype_id));
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATATYPE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_DATATYPE, "Datatype open response buffer:\n%s", response_buffer.buffer);
+
+        if (datatype && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's URI: %s", datatype->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's object type: %s",
+                         object_type_to_string(datatype->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's domain path: %s",
+                         datatype->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's datatype class: %s",
+                         datatype_class_to_string(datatype->u.datatype.dtype_id));
+        } /* end if */
     } /* end if */
-#endif
 
     /* Clean up allocated datatype object if there was an issue */
     if (datatype && !ret_value)
@@ -433,13 +438,12 @@ RV_datatype_get(void *obj, H5VL_datatype_get_args_t *args, hid_t dxpl_id, void *
     RV_object_t *dtype     = (RV_object_t *)obj;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received datatype get call with following parameters:\n");
-    printf("     - Datatype get call type: %s\n", datatype_get_type_to_string(args->op_type));
-    printf("     - Datatype's URI: %s\n", dtype->URI);
-    printf("     - Datatype's object type: %s\n", object_type_to_string(dtype->obj_type));
-    printf("     - Datatype's domain path: %s\n\n", dtype->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Received datatype get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype get call type: %s",
+                 datatype_get_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's URI: %s", dtype->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's object type: %s", object_type_to_string(dtype->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's domain path: %s", dtype->domain->u.file.filepath_name);
 
     if (H5I_DATATYPE != dtype->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a datatype");
@@ -512,14 +516,15 @@ RV_datatype_close(void *dt, hid_t dxpl_id, void **req)
     if (!_dtype)
         FUNC_GOTO_DONE(SUCCEED);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received datatype close call with following parameters:\n");
-    printf("     - Datatype's URI: %s\n", _dtype->URI);
-    printf("     - Datatype's object type: %s\n", object_type_to_string(_dtype->obj_type));
-    if (_dtype->domain && _dtype->domain->u.file.filepath_name)
-        printf("     - Datatype's domain path: %s\n", _dtype->domain->u.file.filepath_name);
-    printf("\n");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_DATATYPE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Received datatype close call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's URI: %s", _dtype->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's object type: %s",
+                     object_type_to_string(_dtype->obj_type));
+        if (_dtype->domain && _dtype->domain->u.file.filepath_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype's domain path: %s",
+                         _dtype->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_DATATYPE != _dtype->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a datatype");
@@ -585,9 +590,7 @@ RV_parse_datatype(char *type, hbool_t need_truncate)
     char   *type_string         = type;
     hid_t   ret_value           = FAIL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Parsing datatype from HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Parsing datatype from HTTP response");
 
     if (!type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "datatype JSON buffer was NULL");
@@ -597,9 +600,8 @@ RV_parse_datatype(char *type, hbool_t need_truncate)
         char     *type_section_ptr = NULL;
         char     *type_section_start, *type_section_end;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Extraneous information included in HTTP response, extracting out datatype section\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE,
+                     "Extraneous information included in HTTP response, extracting out datatype section");
 
         /* Start by locating the beginning of the "type" subsection, as indicated by the JSON "type" key */
         if (NULL == (type_section_ptr = strstr(type, "\"type\"")))
@@ -704,9 +706,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
     int    bytes_printed = 0;
     herr_t ret_value     = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting datatype to JSON\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting datatype to JSON");
 
     if (!type_body)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL,
@@ -739,9 +739,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
     if (type_is_committed) {
         RV_object_t *vol_obj;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Datatype was a committed type\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype was a committed type");
 
         /* Retrieve the VOL object (RV_object_t *) from the datatype container */
         if (NULL == (vol_obj = H5VLobject(type_id)))
@@ -772,9 +770,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
         FUNC_GOTO_DONE(SUCCEED);
     } /* end if */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Datatype was not a committed type\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Datatype was not a committed type");
 
     if (!(type_size = H5Tget_size(type_id)))
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "invalid datatype");
@@ -966,9 +962,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
                 if ((compound_member = H5Tget_member_type(type_id, (unsigned)i)) < 0)
                     FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get compound datatype member");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Converting compound datatype member %zu to JSON\n\n", i);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting compound datatype member %zu to JSON", i);
 
                 if (RV_convert_datatype_to_JSON(compound_member, &compound_member_strings[i], NULL, FALSE,
                                                 server_version) < 0)
@@ -1138,9 +1132,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
             if ((type_base_class = H5Tget_super(type_id)) < 0)
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get base datatype for enum type");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Converting enum datatype's base datatype to JSON\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting enum datatype's base datatype to JSON");
 
             if (NULL == (base_type_name = RV_convert_predefined_datatype_to_string(type_base_class)))
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "invalid datatype");
@@ -1228,9 +1220,7 @@ RV_convert_datatype_to_JSON(hid_t type_id, char **type_body, size_t *type_body_l
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL,
                                 "can't determine if array base datatype is committed");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Converting array datatype's base datatype to JSON\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting array datatype's base datatype to JSON");
 
             if (RV_convert_datatype_to_JSON(type_base_class, &array_base_type, &array_base_type_len, TRUE,
                                             server_version) < 0)
@@ -1379,9 +1369,7 @@ done:
                 *type_body_len = (size_t)buf_ptrdiff;
         } /* end if */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Datatype JSON representation:\n%s\n\n", out_string);
-#endif
+        RV_LOG_TRACE(RV_LOG_CAT_DATATYPE, "Datatype JSON representation:\n%s", out_string);
     } /* end if */
     else {
         if (out_string)
@@ -1484,9 +1472,7 @@ RV_convert_JSON_to_datatype(const char *type)
     char       *tmp_enum_base_type_buffer  = NULL;
     char       *tmp_vlen_type_buffer       = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converting JSON buffer %s to hid_t\n", type);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting JSON buffer %s to hid_t", type);
 
     /* Retrieve the datatype class */
     if (NULL == (parse_tree = yajl_tree_parse(type, NULL, 0)))
@@ -1532,31 +1518,25 @@ RV_convert_JSON_to_datatype(const char *type)
             hid_t   predefined_type = FAIL;
             char   *type_base_ptr   = type_base + 8;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Predefined Integer type sign: %c\n", *type_base_ptr);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Predefined Integer type sign: %c", *type_base_ptr);
 
             is_unsigned = (*type_base_ptr == 'U') ? TRUE : FALSE;
 
             switch (*(type_base_ptr + 1)) {
                 /* 8-bit integer */
                 case '8':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 8-bit Integer type\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "8-bit Integer type");
 
                     if (*(type_base_ptr + 2) == 'L') {
                         /* Litle-endian */
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Little-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Little-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U8LE : H5T_STD_I8LE;
                     } /* end if */
                     else {
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Big-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Big-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U8BE : H5T_STD_I8BE;
                     } /* end else */
@@ -1565,22 +1545,18 @@ RV_convert_JSON_to_datatype(const char *type)
 
                 /* 16-bit integer */
                 case '1':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 16-bit Integer type\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "16-bit Integer type");
 
                     if (*(type_base_ptr + 3) == 'L') {
                         /* Litle-endian */
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Little-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Little-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U16LE : H5T_STD_I16LE;
                     } /* end if */
                     else {
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Big-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Big-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U16BE : H5T_STD_I16BE;
                     } /* end else */
@@ -1589,22 +1565,18 @@ RV_convert_JSON_to_datatype(const char *type)
 
                 /* 32-bit integer */
                 case '3':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 32-bit Integer type\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "32-bit Integer type");
 
                     if (*(type_base_ptr + 3) == 'L') {
                         /* Litle-endian */
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Little-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Little-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U32LE : H5T_STD_I32LE;
                     } /* end if */
                     else {
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Big-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Big-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U32BE : H5T_STD_I32BE;
                     } /* end else */
@@ -1613,22 +1585,18 @@ RV_convert_JSON_to_datatype(const char *type)
 
                 /* 64-bit integer */
                 case '6':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 64-bit Integer type\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "64-bit Integer type");
 
                     if (*(type_base_ptr + 3) == 'L') {
                         /* Litle-endian */
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Little-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Little-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U64LE : H5T_STD_I64LE;
                     } /* end if */
                     else {
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> Big-endian - %s\n", is_unsigned ? "unsigned" : "signed");
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Big-endian - %s",
+                                     is_unsigned ? "unsigned" : "signed");
 
                         predefined_type = is_unsigned ? H5T_STD_U64BE : H5T_STD_I64BE;
                     } /* end else */
@@ -1661,17 +1629,13 @@ RV_convert_JSON_to_datatype(const char *type)
         if (is_predefined) {
             char *type_base_ptr = type_base + 10;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Predefined Float type\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Predefined Float type");
 
             switch (*type_base_ptr) {
                 /* 32-bit floating point */
                 case '3':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 32-bit Floating Point - %s\n",
-                           (*(type_base_ptr + 2) == 'L') ? "Little-endian" : "Big-endian");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "32-bit Floating Point - %s",
+                                 (*(type_base_ptr + 2) == 'L') ? "Little-endian" : "Big-endian");
 
                     /* Determine whether the floating point type is big- or little-endian */
                     predefined_type = (*(type_base_ptr + 2) == 'L') ? H5T_IEEE_F32LE : H5T_IEEE_F32BE;
@@ -1680,10 +1644,8 @@ RV_convert_JSON_to_datatype(const char *type)
 
                 /* 64-bit floating point */
                 case '6':
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> 64-bit Floating Point - %s\n",
-                           (*(type_base_ptr + 2) == 'L') ? "Little-endian" : "Big-endian");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "64-bit Floating Point - %s",
+                                 (*(type_base_ptr + 2) == 'L') ? "Little-endian" : "Big-endian");
 
                     predefined_type = (*(type_base_ptr + 2) == 'L') ? H5T_IEEE_F64LE : H5T_IEEE_F64BE;
 
@@ -1709,9 +1671,7 @@ RV_convert_JSON_to_datatype(const char *type)
         char     *charSet = NULL;
         char     *strPad  = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> String datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "String datatype");
 
         /* Retrieve the string datatype's length and check if it's a variable-length string */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, str_length_keys, yajl_t_any)))
@@ -1719,9 +1679,7 @@ RV_convert_JSON_to_datatype(const char *type)
 
         is_variable_str = YAJL_IS_STRING(key_obj);
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> %s string\n", is_variable_str ? "Variable-length" : "Fixed-length");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "%s string", is_variable_str ? "Variable-length" : "Fixed-length");
 
         /* Retrieve and check the string datatype's character set */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, str_charset_keys, yajl_t_string)))
@@ -1732,9 +1690,7 @@ RV_convert_JSON_to_datatype(const char *type)
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_PARSEERROR, FAIL,
                             "can't retrieve string datatype's character set");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> String charSet: %s\n", charSet);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "String charSet: %s", charSet);
 
         /* Currently, only H5T_CSET_ASCII character set is supported */
         if (strcmp(charSet, "H5T_CSET_ASCII") && strcmp(charSet, "H5T_CSET_UTF8"))
@@ -1756,9 +1712,7 @@ RV_convert_JSON_to_datatype(const char *type)
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL,
                             "unsupported string padding type for string datatype");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> String padding: %s\n", strPad);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "String padding: %s", strPad);
 
         /* Retrieve the length if the datatype is a fixed-length string */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, str_length_keys, yajl_t_any)))
@@ -1794,9 +1748,7 @@ RV_convert_JSON_to_datatype(const char *type)
         char     *type_section_ptr = NULL;
         char     *section_start, *section_end;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Compound Datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Compound Datatype");
 
         /* Retrieve the compound member fields array */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, compound_field_keys, yajl_t_array)))
@@ -1890,10 +1842,10 @@ RV_convert_JSON_to_datatype(const char *type)
             tmp_cmpd_type_buffer[(size_t)buf_ptrdiff + 1] = '}';
             tmp_cmpd_type_buffer[(size_t)buf_ptrdiff + 2] = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Compound datatype member %zu name: %s\n", i, compound_member_names[i]);
-            printf("-> Converting compound datatype member %zu from JSON to hid_t\n", i);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Compound datatype member %zu name: %s", i,
+                         compound_member_names[i]);
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting compound datatype member %zu from JSON to hid_t",
+                         i);
 
             if ((compound_member_type_array[i] = RV_convert_JSON_to_datatype(tmp_cmpd_type_buffer)) < 0)
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,
@@ -1924,9 +1876,7 @@ RV_convert_JSON_to_datatype(const char *type)
         char     *base_type_substring_start, *base_type_substring_end;
         hid_t     base_type_id = FAIL;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Array datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Array datatype");
 
         /* Retrieve the array dimensions */
         if (NULL == (key_obj = yajl_tree_get(parse_tree, array_dims_keys, yajl_t_array)))
@@ -1943,15 +1893,13 @@ RV_convert_JSON_to_datatype(const char *type)
                 array_dims[i] = (hsize_t)YAJL_GET_INTEGER(YAJL_GET_ARRAY(key_obj)->values[i]);
         } /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Array datatype dimensions: [");
-        for (i = 0; i < YAJL_GET_ARRAY(key_obj)->len; i++) {
-            if (i > 0)
-                printf(", ");
-            printf("%" PRIuHSIZE, array_dims[i]);
-        }
-        printf("]\n");
-#endif
+        if (RV_LOG_ENABLED(RV_LOG_CAT_DATATYPE, RV_LOG_LEVEL_DEBUG)) {
+            char dims_string[RV_LOG_DIMS_STRING_MAX];
+
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Array datatype dimensions: %s",
+                         RV_log_dims(array_dims, YAJL_GET_ARRAY(key_obj)->len, dims_string,
+                                     sizeof(dims_string)));
+        } /* end if */
 
         /* Locate the beginning and end braces of the "base" section for the array datatype */
         if (NULL == (base_type_substring_start = strstr(type, "\"base\"")))
@@ -1986,9 +1934,7 @@ RV_convert_JSON_to_datatype(const char *type)
         array_base_type_substring[type_string_len + (size_t)buf_ptrdiff]     = '}';
         array_base_type_substring[type_string_len + (size_t)buf_ptrdiff + 1] = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Converting array base datatype string to hid_t\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting array base datatype string to hid_t");
 
         /* Convert the string representation of the array's base datatype to an hid_t */
         if ((base_type_id = RV_convert_JSON_to_datatype(array_base_type_substring)) < 0)
@@ -2006,9 +1952,7 @@ RV_convert_JSON_to_datatype(const char *type)
         char     *base_section_ptr = NULL;
         char     *base_section_end = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Enum Datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Enum Datatype");
 
         /* Locate the beginning and end braces of the "base" section for the enum datatype */
         if (NULL == (base_section_ptr = strstr(type, "\"base\"")))
@@ -2044,9 +1988,7 @@ RV_convert_JSON_to_datatype(const char *type)
         tmp_enum_base_type_buffer[type_string_len + (size_t)buf_ptrdiff]     = '}';
         tmp_enum_base_type_buffer[type_string_len + (size_t)buf_ptrdiff + 1] = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Converting enum base datatype string to hid_t\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converting enum base datatype string to hid_t");
 
         /* Convert the enum's base datatype substring into an hid_t for use in the following H5Tenum_create
          * call */
@@ -2083,9 +2025,7 @@ RV_convert_JSON_to_datatype(const char *type)
     else if (!strcmp(datatype_class, "H5T_REFERENCE")) {
         char *type_base;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Reference datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Reference datatype");
 
         if (NULL == (key_obj = yajl_tree_get(parse_tree, type_base_keys, yajl_t_string)))
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_PARSEERROR, FAIL, "can't retrieve datatype's base type");
@@ -2094,17 +2034,13 @@ RV_convert_JSON_to_datatype(const char *type)
             FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_PARSEERROR, FAIL, "can't retrieve datatype's base type");
 
         if (!strcmp(type_base, "H5T_STD_REF_OBJ")) {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Object reference\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Object reference");
 
             if ((datatype = H5Tcopy(H5T_STD_REF_OBJ)) < 0)
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "can't copy object reference datatype");
         } /* end if */
         else if (!strcmp(type_base, "H5T_STD_REF_DSETREG")) {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Region reference\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Region reference");
 
             if ((datatype = H5Tcopy(H5T_STD_REF_DSETREG)) < 0)
                 FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "can't copy region reference datatype");
@@ -2118,9 +2054,7 @@ RV_convert_JSON_to_datatype(const char *type)
         char     *section_start, *section_end;
         size_t    tmp_vlen_type_buffer_size = 0;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Variable-length Datatype\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Variable-length Datatype");
 
         /* Allocate temporary buffer for parent substring */
         tmp_vlen_type_buffer_size = DATATYPE_BODY_DEFAULT_SIZE;
@@ -2169,9 +2103,8 @@ RV_convert_JSON_to_datatype(const char *type)
         /* Modify top-level key from 'base' to 'type' for string-to-datatype conversion function */
         memcpy(tmp_vlen_type_buffer + 2, type_class_keys[0], strlen(type_class_keys[0]));
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Converting variable length datatype's parent type from JSON to hid_t\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE,
+                     "Converting variable length datatype's parent type from JSON to hid_t");
 
         /* Recursively parse parent datatype from JSON */
         if ((vlen_parent_type = RV_convert_JSON_to_datatype(tmp_vlen_type_buffer)) < 0)
@@ -2187,14 +2120,9 @@ RV_convert_JSON_to_datatype(const char *type)
 
     ret_value = datatype;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converted JSON buffer to hid_t ID %ld\n", datatype);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converted JSON buffer to hid_t ID %ld", datatype);
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("\n");
-#endif
 
     if (ret_value < 0 && datatype >= 0) {
         if (H5Tclose(datatype) < 0)
@@ -2279,9 +2207,7 @@ RV_convert_predefined_datatype_to_string(hid_t type_id)
         FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_SYSERRSTR, NULL,
                         "predefined datatype name string size exceeded maximum size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Converted predefined datatype to string representation %s\n\n", type_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_DATATYPE, "Converted predefined datatype to string representation %s", type_name);
 
 done:
     return ret_value;
@@ -2641,8 +2567,14 @@ done:
  * Purpose:     Initialize several variables necessary for type conversion.
  *              - Checks if background buffer must be allocated and filled
  *              - Allocates conversion buffer if reuse of dst buffer is not possible
+ *                and the conversion can't be done in place within the src buffer
  *              - Allocates background buffer if needed and reuse is not possible
  *
+ *              If src_reusable is TRUE, the caller owns the source buffer and
+ *              allows it to be overwritten. When the destination type is no
+ *              larger than the source type, *tconv_buf is then left NULL and
+ *              the caller should convert in place within the source buffer.
+ *
  * Return:      Success:        0
  *              Failure:        -1
  *
@@ -2651,7 +2583,7 @@ done:
 herr_t
 RV_tconv_init(hid_t src_type_id, size_t *src_type_size, hid_t dst_type_id, size_t *dst_type_size,
               size_t num_elem, hbool_t clear_tconv_buf, hbool_t dst_file, void **tconv_buf, void **bkg_buf,
-              RV_tconv_reuse_t *reuse, hbool_t *fill_bkg)
+              RV_tconv_reuse_t *reuse, hbool_t src_reusable, hbool_t *fill_bkg)
 {
     htri_t need_bkg;
     herr_t ret_value = SUCCEED;
@@ -2692,8 +2624,10 @@ RV_tconv_init(hid_t src_type_id, size_t *src_type_size, hid_t dst_type_id, size_
             *reuse = RV_TCONV_REUSE_BKG;
     } /* end if */
 
-    /* Allocate conversion buffer if it is not being reused */
-    if (!reuse || (*reuse != RV_TCONV_REUSE_TCONV)) {
+    /* Allocate conversion buffer if it is not being reused and the
+     * conversion can't be performed in place within the source buffer */
+    if ((!reuse || (*reuse != RV_TCONV_REUSE_TCONV)) &&
+        !(src_reusable && (*src_type_size >= *dst_type_size))) {
         if (clear_tconv_buf) {
             if (NULL == (*tconv_buf = RV_calloc(
                              num_elem * (*src_type_size > *dst_type_size ? *src_type_size : *dst_type_size))))
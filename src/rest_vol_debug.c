@@ -17,8 +17,6 @@
 
 #include "rest_vol_debug.h"
 
-#ifdef RV_CONNECTOR_DEBUG
-
 /*-------------------------------------------------------------------------
  * Function:    object_type_to_string
  *
@@ -336,6 +334,30 @@ dataset_specific_type_to_string(H5VL_dataset_specific_t specific_type)
     } /* end switch */
 } /* end dataset_specific_type_to_string() */
 
+/*-------------------------------------------------------------------------
+ * Function:    dataset_optional_type_to_string
+ *
+ * Purpose:     Helper function to convert each supported member of the
+ *              H5VL_native_dataset_optional_args_t enum into its string
+ *              representation
+ *
+ * Return:      String representation of given object or '(unknown)' if
+ *              the function can't determine the type of object it has
+ *              been given (can't fail).
+ */
+const char *
+dataset_optional_type_to_string(H5VL_dataset_optional_t optional_type)
+{
+    switch (optional_type) {
+        case H5VL_NATIVE_DATASET_CHUNK_READ:
+            return "H5VL_NATIVE_DATASET_CHUNK_READ";
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE:
+            return "H5VL_NATIVE_DATASET_CHUNK_WRITE";
+        default:
+            return "(unknown)";
+    } /* end switch */
+} /* end dataset_optional_type_to_string() */
+
 /*-------------------------------------------------------------------------
  * Function:    file_flags_to_string
  *
@@ -632,4 +654,3 @@ object_specific_type_to_string(H5VL_object_specific_t specific_type)
             return "(unknown)";
     } /* end switch */
 } /* end object_specific_type_to_string() */
-#endif /* RV_CONNECTOR_DEBUG */
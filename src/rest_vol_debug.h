@@ -13,8 +13,6 @@
 
 #include "rest_vol.h"
 
-#ifdef RV_CONNECTOR_DEBUG
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +27,7 @@ const char *attr_specific_type_to_string(H5VL_attr_specific_t specific_type);
 const char *datatype_get_type_to_string(H5VL_datatype_get_t get_type);
 const char *dataset_get_type_to_string(H5VL_dataset_get_t get_type);
 const char *dataset_specific_type_to_string(H5VL_dataset_specific_t specific_type);
+const char *dataset_optional_type_to_string(H5VL_dataset_optional_t optional_type);
 const char *file_flags_to_string(unsigned flags);
 const char *file_get_type_to_string(H5VL_file_get_t get_type);
 const char *file_specific_type_to_string(H5VL_file_specific_t specific_type);
@@ -44,6 +43,4 @@ const char *object_specific_type_to_string(H5VL_object_specific_t specific_type)
 }
 #endif
 
-#endif /* RV_CONNECTOR_DEBUG */
-
 #endif /* REST_VOL_DEBUG_H_ */
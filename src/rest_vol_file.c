@@ -72,13 +72,11 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
     const char  *request_endpoint        = NULL;
     long         http_response;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file create call with following parameters:\n");
-    printf("     - Filename: %s\n", name);
-    printf("     - Creation flags: %s\n", file_flags_to_string(flags));
-    printf("     - Default FCPL? %s\n", (H5P_FILE_CREATE_DEFAULT == fcpl_id) ? "yes" : "no");
-    printf("     - Default FAPL? %s\n\n", (H5P_FILE_ACCESS_DEFAULT == fapl_id) ? "yes" : "no");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file create call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Filename: %s", name);
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Creation flags: %s", file_flags_to_string(flags));
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Default FCPL? %s", (H5P_FILE_CREATE_DEFAULT == fcpl_id) ? "yes" : "no");
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Default FAPL? %s", (H5P_FILE_ACCESS_DEFAULT == fapl_id) ? "yes" : "no");
 
     if (fapl_id == H5I_INVALID_HID)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid FAPL");
@@ -90,13 +88,15 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
     if (H5_rest_set_connection_information(&new_file->u.file.server_info) < 0)
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't set REST VOL connector connection information");
 
-    new_file->URI[0]               = '\0';
-    new_file->obj_type             = H5I_FILE;
-    new_file->u.file.intent        = H5F_ACC_RDWR;
-    new_file->u.file.filepath_name = NULL;
-    new_file->u.file.fapl_id       = FAIL;
-    new_file->u.file.fcpl_id       = FAIL;
-    new_file->u.file.ref_count     = 1;
+    new_file->URI[0]                 = '\0';
+    new_file->obj_type               = H5I_FILE;
+    new_file->u.file.intent          = H5F_ACC_RDWR;
+    new_file->u.file.filepath_name   = NULL;
+    new_file->u.file.fapl_id         = FAIL;
+    new_file->u.file.fcpl_id         = FAIL;
+    new_file->u.file.ref_count       = 1;
+    new_file->u.file.deferred_create = FALSE;
+    new_file->u.file.rescan_usec     = 0;
 
     /* Allocate root "path" on heap for consistency with other RV_object_t types */
     if ((new_file->handle_path = RV_malloc(2)) == NULL)
@@ -117,6 +117,13 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
     else
         new_file->u.file.fapl_id = H5P_FILE_ACCESS_DEFAULT;
 
+    if (H5Pget_fapl_rest_deferred_create(new_file->u.file.fapl_id, &new_file->u.file.deferred_create) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get deferred object creation setting");
+
+    if (H5Pget_fapl_rest_storage_size_max_age(new_file->u.file.fapl_id,
+                                              &new_file->u.file.storage_size_max_age) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get storage size maximum age");
+
     /* Copy the FCPL if it wasn't H5P_DEFAULT, else set up a default one so that
      * H5Fget_create_plist() will function correctly
      */
@@ -149,12 +156,12 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
 
         /* Don't fail function if this file doesn't exist */
         http_response = RV_curl_get(curl, &new_file->u.file.server_info, "/", new_file->u.file.filepath_name,
-                                    CONTENT_TYPE_JSON);
+                                    CONTENT_TYPE_JSON, "H5Fcreate");
 
         /* If the file exists, go ahead and delete it before proceeding */
         if (HTTP_SUCCESS(http_response)) {
             http_response = RV_curl_delete(curl, &new_file->u.file.server_info, "/",
-                                           (const char *)new_file->u.file.filepath_name);
+                                           (const char *)new_file->u.file.filepath_name, "H5Fcreate");
 
             if (!HTTP_SUCCESS(http_response))
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTREMOVE, NULL, "can't delete existing file");
@@ -198,14 +205,12 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
     uinfo.bytes_sent  = 0;
 
     http_response = RV_curl_put(curl, &new_file->u.file.server_info, "/", new_file->u.file.filepath_name,
-                                &uinfo, CONTENT_TYPE_JSON);
+                                &uinfo, CONTENT_TYPE_JSON, "H5Fcreate");
 
     if (!HTTP_SUCCESS(http_response))
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, NULL, "can't create file");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Created file\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Created file");
 
     /* Store the newly-created file's URI */
     if (RV_parse_response(response_buffer.buffer, NULL, new_file->URI, RV_copy_object_URI_callback) < 0)
@@ -216,23 +221,23 @@ RV_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id, h
                           RV_parse_server_version) < 0)
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, NULL, "can't parse server  version");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_FILE]->table, (char *)new_file->URI,
-                             (char *)new_file) == 0)
+    if (RV_type_info_insert(H5I_FILE, new_file) < 0)
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "Failed to add file to type info array");
 
     ret_value = (void *)new_file;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> File create response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (new_file && ret_value) {
-        printf("-> New file's info:\n");
-        printf("     - New file's pathname: %s\n", new_file->domain->u.file.filepath_name);
-        printf("     - New file's URI: %s\n", new_file->URI);
-        printf("     - New file's object type: %s\n\n", object_type_to_string(new_file->obj_type));
+    if (RV_LOG_ENABLED(RV_LOG_CAT_FILE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_FILE, "File create response buffer:\n%s", response_buffer.buffer);
+
+        if (new_file && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "New file's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "New file's pathname: %s", new_file->domain->u.file.filepath_name);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "New file's URI: %s", new_file->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "New file's object type: %s",
+                         object_type_to_string(new_file->obj_type));
+        } /* end if */
     } /* end if */
-#endif
 
     RV_free(base64_plist_buffer);
     RV_free(binary_plist_buffer);
@@ -269,12 +274,10 @@ RV_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t dxpl_id, voi
     void        *ret_value = NULL;
     long         http_response;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file open call with following parameters:\n");
-    printf("     - Filename: %s\n", name);
-    printf("     - File access flags: %s\n", file_flags_to_string(flags));
-    printf("     - Default FAPL? %s\n\n", (H5P_FILE_ACCESS_DEFAULT == fapl_id) ? "yes" : "no");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file open call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Filename: %s", name);
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File access flags: %s", file_flags_to_string(flags));
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Default FAPL? %s", (H5P_FILE_ACCESS_DEFAULT == fapl_id) ? "yes" : "no");
 
     if (fapl_id == H5I_INVALID_HID)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid FAPL");
@@ -286,13 +289,15 @@ RV_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t dxpl_id, voi
     if (H5_rest_set_connection_information(&file->u.file.server_info) < 0)
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't set REST VOL connector connection information");
 
-    file->URI[0]               = '\0';
-    file->obj_type             = H5I_FILE;
-    file->u.file.intent        = flags;
-    file->u.file.filepath_name = NULL;
-    file->u.file.fapl_id       = FAIL;
-    file->u.file.fcpl_id       = FAIL;
-    file->u.file.ref_count     = 1;
+    file->URI[0]                 = '\0';
+    file->obj_type               = H5I_FILE;
+    file->u.file.intent          = flags;
+    file->u.file.filepath_name   = NULL;
+    file->u.file.fapl_id         = FAIL;
+    file->u.file.fcpl_id         = FAIL;
+    file->u.file.ref_count       = 1;
+    file->u.file.deferred_create = FALSE;
+    file->u.file.rescan_usec     = 0;
 
     /* Allocate root "path" on heap for consistency with other RV_object_t types */
     if ((file->handle_path = RV_malloc(2)) == NULL)
@@ -313,8 +318,8 @@ RV_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t dxpl_id, voi
     strncpy(file->u.file.filepath_name, name, name_length);
     file->u.file.filepath_name[name_length] = '\0';
 
-    http_response =
-        RV_curl_get(curl, &file->u.file.server_info, "/", file->u.file.filepath_name, CONTENT_TYPE_JSON);
+    http_response = RV_curl_get(curl, &file->u.file.server_info, "/", file->u.file.filepath_name,
+                                CONTENT_TYPE_JSON, "H5Fopen");
 
     if (!HTTP_SUCCESS(http_response))
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "can't get file");
@@ -339,26 +344,32 @@ RV_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t dxpl_id, voi
     else
         file->u.file.fapl_id = H5P_FILE_ACCESS_DEFAULT;
 
+    if (H5Pget_fapl_rest_deferred_create(file->u.file.fapl_id, &file->u.file.deferred_create) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get deferred object creation setting");
+
+    if (H5Pget_fapl_rest_storage_size_max_age(file->u.file.fapl_id, &file->u.file.storage_size_max_age) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get storage size maximum age");
+
     /* Set up a FCPL for the file so that H5Fget_create_plist() will function correctly */
     if ((file->u.file.fcpl_id = H5Pcreate(H5P_FILE_CREATE)) < 0)
         FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, NULL, "can't create FCPL for file");
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_FILE]->table, (char *)file->URI, (char *)file) == 0)
+    if (RV_type_info_insert(H5I_FILE, file) < 0)
         FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "Failed to add file to type info array");
 
     ret_value = (void *)file;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> File open response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (file && ret_value) {
-        printf("-> File's info:\n");
-        printf("     - File's URI: %s\n", file->URI);
-        printf("     - File's object type: %s\n", object_type_to_string(file->obj_type));
-        printf("     - File's pathname: %s\n\n", file->domain->u.file.filepath_name);
-    }
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_FILE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_FILE, "File open response buffer:\n%s", response_buffer.buffer);
+
+        if (file && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's URI: %s", file->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's object type: %s", object_type_to_string(file->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's pathname: %s", file->domain->u.file.filepath_name);
+        }
+    } /* end if */
 
     /* Clean up allocated file object if there was an issue */
     if (file && !ret_value)
@@ -388,12 +399,10 @@ RV_file_get(void *obj, H5VL_file_get_args_t *args, hid_t dxpl_id, void **req)
     herr_t       ret_value = SUCCEED;
     unsigned int requested_types;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file get call with following parameters:\n");
-    printf("     - File get call type: %s\n", file_get_type_to_string(args->op_type));
-    printf("     - File's URI: %s\n", _obj->URI);
-    printf("     - File's pathname: %s\n\n", _obj->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File get call type: %s", file_get_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's URI: %s", _obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's pathname: %s", _obj->domain->u.file.filepath_name);
 
     if ((args->op_type != H5VL_FILE_GET_NAME) && (H5I_FILE != _obj->obj_type))
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file");
@@ -571,15 +580,15 @@ RV_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t dxpl_id, void
     char           request_endpoint[URL_MAX_LENGTH];
     server_info_t *server_info = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file-specific call with following parameters:\n");
-    printf("     - File-specific call type: %s\n", file_specific_type_to_string(args->op_type));
-    if (file) {
-        printf("     - File's URI: %s\n", file->URI);
-        printf("     - File's pathname: %s\n", file->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_FILE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file-specific call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File-specific call type: %s",
+                     file_specific_type_to_string(args->op_type));
+        if (file) {
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's URI: %s", file->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's pathname: %s", file->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-    printf("\n");
-#endif
 
     if (file && H5I_FILE != file->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file");
@@ -593,6 +602,10 @@ RV_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t dxpl_id, void
             filename                   = target_domain->u.file.filepath_name;
             const char *flush_string   = "/?flush=1&rescan=1";
 
+            /* Send any writes held back in the write-back buffers of the domain's datasets */
+            if (RV_dataset_flush_write_buffers(target_domain) < 0)
+                FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't send buffered dataset writes");
+
             name_length = strlen(filename);
 
             snprintf(request_endpoint, URL_MAX_LENGTH, "%s", flush_string);
@@ -600,10 +613,13 @@ RV_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t dxpl_id, void
 
             if (HTTP_NO_CONTENT !=
                 (http_response = RV_curl_put(curl, &file->u.file.server_info, request_endpoint,
-                                             file->u.file.filepath_name, NULL, CONTENT_TYPE_JSON)))
+                                             file->u.file.filepath_name, NULL, CONTENT_TYPE_JSON,
+                                             "H5Fflush")))
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unexpected return from flush: HTTP %zu",
                                 http_response);
 
+            target_domain->u.file.rescan_usec = RV_now_usec();
+
             break;
         }
 
@@ -658,7 +674,7 @@ RV_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t dxpl_id, void
             if (H5_rest_set_connection_information(server_info) < 0)
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get server connection information");
 
-            http_response = RV_curl_delete(curl, server_info, "/", filename);
+            http_response = RV_curl_delete(curl, server_info, "/", filename, "H5Fdelete");
 
             if (!HTTP_SUCCESS(http_response))
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CLOSEERROR, FAIL, "can't delete file");
@@ -708,17 +724,17 @@ RV_file_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **re
     char         request_url[URL_MAX_LENGTH];
     int          url_len       = 0;
     long         http_response = 0;
-
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file-optional call with following parameters:\n");
-    printf("     - File-optional call type: %s\n",
-           file_optional_type_to_string(((H5VL_file_optional_t)args->op_type)));
-    if (file) {
-        printf("     - File's URI: %s\n", file->URI);
-        printf("     - File's pathname: %s\n", file->domain->u.file.filepath_name);
+    RV_request_t request       = {0};
+
+    if (RV_LOG_ENABLED(RV_LOG_CAT_FILE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file-optional call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File-optional call type: %s",
+                     file_optional_type_to_string(((H5VL_file_optional_t)args->op_type)));
+        if (file) {
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's URI: %s", file->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's pathname: %s", file->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-    printf("\n");
-#endif
 
     switch (args->op_type) {
         /* H5VL_FILE_GET_FILESIZE */
@@ -727,6 +743,11 @@ RV_file_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **re
             size_t                  *size_out = opt_args->get_size.size;
             /* Setup cURL to make GET request */
 
+            /* Objects still queued for creation count towards the allocated bytes */
+            if (RV_flush_deferred_creates() < 0)
+                FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL,
+                                "can't send deferred object creation requests");
+
             /* Assemble URL */
             if ((url_len = snprintf(request_url, URL_MAX_LENGTH, "%s?verbose=1",
                                     file->domain->u.file.server_info.base_URL)) < 0)
@@ -765,17 +786,17 @@ RV_file_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **re
             if (CURLE_OK != curl_easy_setopt(curl, CURLOPT_URL, request_url))
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't set cURL request URL: %s", curl_err_buf);
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Checking allocated bytes for domain using URL: %s\n\n", request_url);
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Checking allocated bytes for domain using URL: %s", request_url);
+
+            RV_LOG_DEBUG(RV_LOG_CAT_HTTP, "Making GET request to the server");
 
-            printf("   /**********************************\\\n");
-            printf("-> | Making GET request to the server |\n");
-            printf("   \\**********************************/\n\n");
-#endif
+            request.method = "GET";
+            request.url    = request_url;
+            request.domain = file->domain->u.file.filepath_name;
 
-            CURL_PERFORM_NO_ERR(curl, FAIL);
+            CURL_PERFORM_NO_ERR(curl, &request, FAIL);
 
-            if (CURLE_OK != curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_response))
+            if (RV_curl_get_response_code(curl, &http_response) < 0)
                 FUNC_GOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get HTTP response code");
 
             if (!(HTTP_SUCCESS(http_response)))
@@ -831,14 +852,13 @@ RV_file_close(void *file, hid_t dxpl_id, void **req)
     if (!_file)
         FUNC_GOTO_DONE(SUCCEED);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received file close call with following parameters:\n");
-    printf("     - File's URI: %s\n", _file->URI);
-    printf("     - File's object type: %s\n", object_type_to_string(_file->obj_type));
-    if (_file->domain && _file->domain->u.file.filepath_name)
-        printf("     - Filename: %s\n", _file->domain->u.file.filepath_name);
-    printf("\n");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_FILE, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Received file close call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's URI: %s", _file->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_FILE, "File's object type: %s", object_type_to_string(_file->obj_type));
+        if (_file->domain && _file->domain->u.file.filepath_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_FILE, "Filename: %s", _file->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_FILE != _file->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file");
@@ -846,6 +866,10 @@ RV_file_close(void *file, hid_t dxpl_id, void **req)
     _file->u.file.ref_count--;
 
     if (_file->u.file.ref_count == 0) {
+        /* Make sure objects created in this file exist on the server before it is released */
+        if (_file->u.file.deferred_create && RV_flush_deferred_creates() < 0)
+            FUNC_DONE_ERROR(H5E_FILE, H5E_CLOSEERROR, FAIL, "can't send deferred object creation requests");
+
         if (_file->u.file.fapl_id >= 0) {
             if (_file->u.file.fapl_id != H5P_FILE_ACCESS_DEFAULT && H5Pclose(_file->u.file.fapl_id) < 0)
                 FUNC_DONE_ERROR(H5E_PLIST, H5E_CANTCLOSEOBJ, FAIL, "can't close FAPL");
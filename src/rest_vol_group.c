@@ -21,6 +21,19 @@
 static herr_t RV_get_group_info_callback(char *HTTP_response, const void *callback_data_in,
                                          void *callback_data_out);
 
+/* Helper to create the missing groups along a path */
+static herr_t RV_group_create_intermediate(RV_object_t *parent, const char *path, const char *base64_gcpl,
+                                           char *URI_out);
+
+/* Format of the request body to create a group and link it into the file */
+static const char *const group_create_fmt_string = "{"
+                                                   "\"link\": {"
+                                                   "\"id\": \"%s\", "
+                                                   "\"name\": \"%s\""
+                                                   "},"
+                                                   "\"creationProperties\": \"%s\""
+                                                   "}";
+
 /* JSON keys to retrieve the number of links in a group */
 const char *group_link_count_keys[] = {"linkCount", (const char *)0};
 
@@ -51,6 +64,7 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     char        *create_request_body   = NULL;
     char        *path_dirname          = NULL;
     char        *base64_plist_buffer   = NULL;
+    const char  *link_parent_URI       = NULL;
     char         target_URI[URI_MAX_LENGTH];
     char         request_endpoint[URL_MAX_LENGTH];
     char        *escaped_group_name      = NULL;
@@ -60,17 +74,21 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     void        *ret_value               = NULL;
     long         http_response;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received group create call with following parameters:\n");
-    printf("     - H5Gcreate variant: %s\n", name ? "H5Gcreate2" : "H5Gcreate_anon");
-    if (name)
-        printf("     - Group's name: %s\n", name);
-    printf("     - Group parent object's URI: %s\n", parent->URI);
-    printf("     - Group parent object's type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - Group parent object's domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Default GCPL? %s\n", (H5P_GROUP_CREATE_DEFAULT == gcpl_id) ? "yes" : "no");
-    printf("     - Default GAPL? %s\n\n", (H5P_GROUP_ACCESS_DEFAULT == gapl_id) ? "yes" : "no");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_GROUP, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Received group create call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gcreate variant: %s", name ? "H5Gcreate2" : "H5Gcreate_anon");
+        if (name)
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's name: %s", name);
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group parent object's URI: %s", parent->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group parent object's type: %s",
+                     object_type_to_string(parent->obj_type));
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group parent object's domain path: %s",
+                     parent->domain->u.file.filepath_name);
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Default GCPL? %s",
+                     (H5P_GROUP_CREATE_DEFAULT == gcpl_id) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Default GAPL? %s",
+                     (H5P_GROUP_ACCESS_DEFAULT == gapl_id) ? "yes" : "no");
+    } /* end if */
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -130,9 +148,20 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
         hbool_t     empty_dirname;
         size_t      escaped_name_size = 0;
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Creating JSON link for group\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Creating JSON link for group");
+
+        /* Encode GCPL to send to server */
+        if (H5Pencode2(gcpl_id, binary_plist_buffer, &plist_nalloc, H5P_DEFAULT) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "can't determine size needed for encoded gcpl");
+
+        if ((binary_plist_buffer = RV_malloc(plist_nalloc)) == NULL)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTALLOC, NULL, "can't allocate space for encoded gcpl");
+
+        if (H5Pencode2(gcpl_id, binary_plist_buffer, &plist_nalloc, H5P_DEFAULT) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "can't encode gcpl");
+
+        if (RV_base64_encode(binary_plist_buffer, plist_nalloc, &base64_plist_buffer, &base64_buf_size) < 0)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "failed to base64 encode plist binary");
 
         /* In case the user specified a path which contains multiple groups on the way to the
          * one which this group will ultimately be linked under, extract out the path to the
@@ -146,41 +175,37 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
          * the supplied parent group is the one housing this group, so just use its URI.
          */
         if (!empty_dirname) {
-            H5I_type_t obj_type = H5I_GROUP;
+            H5I_type_t obj_type   = H5I_GROUP;
+            ssize_t    num_errors = H5Eget_num(H5_rest_err_stack_g);
             htri_t     search_ret;
 
             search_ret = RV_find_object_by_path(parent, path_dirname, &obj_type, RV_copy_object_URI_callback,
                                                 NULL, target_URI);
 
+            if (search_ret > 0 && obj_type != H5I_GROUP)
+                FUNC_GOTO_ERROR(H5E_SYM, H5E_BADTYPE, NULL, "target of group link '%s' is not a group",
+                                path_dirname);
+
             if (!search_ret || search_ret < 0) {
-                unsigned     crt_intmd_group;
-                hid_t        intmd_group_id = H5I_INVALID_HID;
-                RV_object_t *intmd_group;
+                unsigned crt_intmd_group;
+                long     http_response;
 
                 if (H5Pget_create_intermediate_group(lcpl_id, &crt_intmd_group))
                     FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get flag value in lcpl");
 
-                /* If group in provided path doesn't exist, create it */
-                if (crt_intmd_group) {
-                    /* Remove trailing slash to avoid infinite loop due to H5_dirname */
-                    if (path_dirname[strlen(path_dirname) - 1] == '/')
-                        path_dirname[strlen(path_dirname) - 1] = '\0';
-
-                    if (NULL == (intmd_group = RV_group_create(obj, loc_params, path_dirname, lcpl_id,
-                                                               gcpl_id, gapl_id, dxpl_id, req)))
-                        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, NULL,
-                                        "can't create intermediate group automatically");
+                if (RV_curl_get_response_code(curl, &http_response) < 0)
+                    FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTGET, NULL, "can't get HTTP response code");
 
-                    /* Get URI of final group now that it has been created */
-                    search_ret = RV_find_object_by_path(parent, path_dirname, &obj_type,
-                                                        RV_copy_object_URI_callback, NULL, target_URI);
+                /* If groups in provided path don't exist, create them */
+                if (crt_intmd_group && http_response == 404) {
+                    /* The failed lookup was expected, so drop only the errors it pushed */
+                    if (num_errors >= 0 && H5Eget_num(H5_rest_err_stack_g) > num_errors)
+                        H5Epop(H5_rest_err_stack_g, (size_t)(H5Eget_num(H5_rest_err_stack_g) - num_errors));
 
-                    if (!search_ret || search_ret < 0)
-                        FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, NULL, "couldn't get URI of intermediate group");
-
-                    if (RV_group_close(intmd_group, H5P_DEFAULT, NULL) < 0)
-                        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, NULL,
-                                        "can't close intermediate group");
+                    if (RV_group_create_intermediate(parent, path_dirname, (const char *)base64_plist_buffer,
+                                                     target_URI) < 0)
+                        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCREATE, NULL,
+                                        "can't create intermediate groups automatically");
                 }
                 else
                     FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, NULL, "can't locate target for group link");
@@ -188,29 +213,8 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
 
         } /* end if */
 
-        const char *const fmt_string = "{"
-                                       "\"link\": {"
-                                       "\"id\": \"%s\", "
-                                       "\"name\": \"%s\""
-                                       "},"
-                                       "\"creationProperties\": \"%s\""
-                                       "}";
-
         /* Form the request body to link the new group to the parent object */
 
-        /* Encode GCPL to send to server */
-        if (H5Pencode2(gcpl_id, binary_plist_buffer, &plist_nalloc, H5P_DEFAULT) < 0)
-            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "can't determine size needed for encoded gcpl");
-
-        if ((binary_plist_buffer = RV_malloc(plist_nalloc)) == NULL)
-            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTALLOC, NULL, "can't allocate space for encoded gcpl");
-
-        if (H5Pencode2(gcpl_id, binary_plist_buffer, &plist_nalloc, H5P_DEFAULT) < 0)
-            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "can't encode gcpl");
-
-        if (RV_base64_encode(binary_plist_buffer, plist_nalloc, &base64_plist_buffer, &base64_buf_size) < 0)
-            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTENCODE, NULL, "failed to base64 encode plist binary");
-
         /* Escape group name to be sent as JSON */
         if (RV_JSON_escape_string(path_basename, escaped_group_name, &escaped_name_size) < 0)
             FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTENCODE, NULL, "can't get size of JSON escaped group name");
@@ -221,14 +225,15 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
         if (RV_JSON_escape_string(path_basename, escaped_group_name, &escaped_name_size) < 0)
             FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTENCODE, NULL, "can't JSON escape group name");
 
-        create_request_nalloc = strlen(fmt_string) + strlen(escaped_group_name) +
+        create_request_nalloc = strlen(group_create_fmt_string) + strlen(escaped_group_name) +
                                 (empty_dirname ? strlen(parent->URI) : strlen(target_URI)) + base64_buf_size +
                                 1;
         if (NULL == (create_request_body = (char *)RV_malloc(create_request_nalloc)))
             FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL,
                             "can't allocate space for group create request body");
 
-        if ((create_request_body_len = snprintf(create_request_body, create_request_nalloc, fmt_string,
+        if ((create_request_body_len = snprintf(create_request_body, create_request_nalloc,
+                                                group_create_fmt_string,
                                                 empty_dirname ? parent->URI : target_URI, escaped_group_name,
                                                 (char *)base64_plist_buffer)) < 0)
             FUNC_GOTO_ERROR(H5E_SYM, H5E_SYSERRSTR, NULL, "snprintf error");
@@ -237,9 +242,9 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
             FUNC_GOTO_ERROR(H5E_SYM, H5E_SYSERRSTR, NULL,
                             "group link create request body size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Group create request body:\n%s\n\n", create_request_body);
-#endif
+        link_parent_URI = empty_dirname ? parent->URI : target_URI;
+
+        RV_LOG_TRACE(RV_LOG_CAT_GROUP, "Group create request body:\n%s", create_request_body);
     } /* end if */
 
     /* Redirect cURL from the base URL to "/groups" to create the group */
@@ -249,44 +254,50 @@ RV_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_SYM, H5E_SYSERRSTR, NULL, "group create URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Group create request URL: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group create request URL: %s", request_endpoint);
 
-    http_response = RV_curl_post(curl, &new_group->domain->u.file.server_info, request_endpoint,
-                                 parent->domain->u.file.filepath_name,
-                                 create_request_body ? (const char *)create_request_body : "",
-                                 (size_t)create_request_body_len, CONTENT_TYPE_JSON);
+    if (parent->domain->u.file.deferred_create) {
+        /* Assign the group's URI now and send the request along with other object creations */
+        if (RV_deferred_create(parent->domain, H5I_GROUP, link_parent_URI, create_request_body,
+                               new_group->URI) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't queue group creation");
+    } /* end if */
+    else {
+        http_response = RV_curl_post(curl, &new_group->domain->u.file.server_info, request_endpoint,
+                                     parent->domain->u.file.filepath_name,
+                                     create_request_body ? (const char *)create_request_body : "",
+                                     (size_t)create_request_body_len, CONTENT_TYPE_JSON, "H5Gcreate");
 
-    if (!HTTP_SUCCESS(http_response))
-        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't create group: received HTTP %ld",
-                        http_response);
+        if (!HTTP_SUCCESS(http_response))
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't create group: received HTTP %ld",
+                            http_response);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Created group\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Created group");
 
-    /* Store the newly-created group's URI */
-    if (RV_parse_response(response_buffer.buffer, NULL, new_group->URI, RV_copy_object_URI_callback) < 0)
-        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't parse new group's URI");
+        /* Store the newly-created group's URI */
+        if (RV_parse_response(response_buffer.buffer, NULL, new_group->URI, RV_copy_object_URI_callback) <
+            0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't parse new group's URI");
+    } /* end else */
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_GROUP]->table, (char *)new_group->URI,
-                             (char *)new_group) == 0)
+    if (RV_type_info_insert(H5I_GROUP, new_group) < 0)
         FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "Failed to add group to type info array");
 
     ret_value = (void *)new_group;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Group create response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (new_group && ret_value) {
-        printf("-> New group's info:\n");
-        printf("     - New group's URI: %s\n", new_group->URI);
-        printf("     - New group's object type: %s\n", object_type_to_string(new_group->obj_type));
-        printf("     - New group's domain path: %s\n\n", new_group->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_GROUP, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_GROUP, "Group create response buffer:\n%s", response_buffer.buffer);
+
+        if (new_group && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "New group's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "New group's URI: %s", new_group->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "New group's object type: %s",
+                         object_type_to_string(new_group->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "New group's domain path: %s",
+                         new_group->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-#endif
 
     if (path_dirname)
         RV_free(path_dirname);
@@ -340,14 +351,12 @@ RV_group_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name,
     size_t     path_len         = 0;
     H5I_type_t obj_type         = H5I_UNINIT;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received group open call with following parameters:\n");
-    printf("     - loc_id object's URI: %s\n", parent->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(parent->obj_type));
-    printf("     - loc_id object's domain path: %s\n", parent->domain->u.file.filepath_name);
-    printf("     - Path to group: %s\n", name ? name : "(null)");
-    printf("     - Default GAPL? %s\n\n", (H5P_GROUP_ACCESS_DEFAULT == gapl_id) ? "yes" : "no");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Received group open call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "loc_id object's URI: %s", parent->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "loc_id object's type: %s", object_type_to_string(parent->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "loc_id object's domain path: %s", parent->domain->u.file.filepath_name);
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Path to group: %s", name ? name : "(null)");
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Default GAPL? %s", (H5P_GROUP_ACCESS_DEFAULT == gapl_id) ? "yes" : "no");
 
     if (H5I_FILE != parent->obj_type && H5I_GROUP != parent->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -389,9 +398,7 @@ RV_group_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name,
 
     group->domain = loc_info_out.domain;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Found group by given path\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Found group by given path");
 
     /* Decode creation properties, if server supports them and file has them */
     if (SERVER_VERSION_MATCHES_OR_EXCEEDS(parent->domain->u.file.server_info.version, 0, 8, 0) &&
@@ -421,22 +428,22 @@ RV_group_open(void *obj, const H5VL_loc_params_t *loc_params, const char *name,
     else
         group->u.group.gapl_id = H5P_GROUP_ACCESS_DEFAULT;
 
-    if (rv_hash_table_insert(RV_type_info_array_g[H5I_GROUP]->table, (char *)group->URI, (char *)group) == 0)
+    if (RV_type_info_insert(H5I_GROUP, group) < 0)
         FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "Failed to add group to type info array");
 
     ret_value = (void *)group;
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Group open response buffer:\n%s\n\n", response_buffer.buffer);
-
-    if (group && ret_value) {
-        printf("-> Group's info:\n");
-        printf("     - Group's URI: %s\n", group->URI);
-        printf("     - Group's object type: %s\n", object_type_to_string(group->obj_type));
-        printf("     - Group's domain path: %s\n\n", group->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_GROUP, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_TRACE(RV_LOG_CAT_GROUP, "Group open response buffer:\n%s", response_buffer.buffer);
+
+        if (group && ret_value) {
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's info:");
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's URI: %s", group->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's object type: %s", object_type_to_string(group->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's domain path: %s", group->domain->u.file.filepath_name);
+        } /* end if */
     } /* end if */
-#endif
 
     /* Clean up allocated file object if there was an issue */
     if (group && !ret_value)
@@ -475,10 +482,8 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
     loc_info loc_info_out;
     memset(&loc_info_out, 0, sizeof(loc_info));
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received group get call with following parameters:\n");
-    printf("     - Group get call type: %s\n\n", group_get_type_to_string(args->op_type));
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Received group get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group get call type: %s", group_get_type_to_string(args->op_type));
 
     if (H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a group");
@@ -502,11 +507,9 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
             switch (loc_params->type) {
                 /* H5Gget_info */
                 case H5VL_OBJECT_BY_SELF: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Gget_info(): Group's URI: %s\n", loc_obj->URI);
-                    printf("-> H5Gget_info(): Group's object type: %s\n\n",
-                           object_type_to_string(loc_obj->obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info(): Group's URI: %s", loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info(): Group's object type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
 
                     /* Redirect cURL from the base URL to "/groups/<id>" to get information about the group */
                     if ((url_len = snprintf(request_endpoint, URL_MAX_LENGTH, "/groups/%s", loc_obj->URI)) <
@@ -530,13 +533,12 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
                     htri_t     search_ret;
                     char       temp_URI[URI_MAX_LENGTH];
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Gget_info_by_name(): loc_id object's URI: %s\n", loc_obj->URI);
-                    printf("-> H5Gget_info_by_name(): loc_id object's type: %s\n",
-                           object_type_to_string(loc_obj->obj_type));
-                    printf("-> H5Gget_info_by_name(): Path to group's parent object: %s\n\n",
-                           loc_params->loc_data.loc_by_name.name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info_by_name(): loc_id object's URI: %s",
+                                 loc_obj->URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info_by_name(): loc_id object's type: %s",
+                                 object_type_to_string(loc_obj->obj_type));
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info_by_name(): Path to group's parent object: %s",
+                                 loc_params->loc_data.loc_by_name.name);
 
                     loc_info_out.URI         = temp_URI;
                     loc_info_out.domain      = loc_obj->domain;
@@ -550,12 +552,12 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
 
                     loc_obj->domain = loc_info_out.domain;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Gget_info_by_name(): found group's parent object by given path\n");
-                    printf("-> H5Gget_info_by_name(): group's parent object URI: %s\n", temp_URI);
-                    printf("-> H5Gget_info_by_name(): group's parent object type: %s\n\n",
-                           object_type_to_string(obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP,
+                                 "H5Gget_info_by_name(): found group's parent object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info_by_name(): group's parent object URI: %s",
+                                 temp_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "H5Gget_info_by_name(): group's parent object type: %s",
+                                 object_type_to_string(obj_type));
 
                     /* Redirect cURL from the base URL to "/groups/<id>" to get information about the group */
                     if ((url_len = snprintf(request_endpoint, URL_MAX_LENGTH, "/groups/%s", temp_URI)) < 0)
@@ -585,7 +587,7 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
             } /* end switch */
 
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Gget_info") < 0)
                 FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get group");
 
             /* Parse response from server and retrieve the relevant group information
@@ -603,9 +605,7 @@ RV_group_get(void *obj, H5VL_group_get_args_t *args, hid_t dxpl_id, void **req)
     } /* end switch */
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Group get response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_GROUP, "Group get response buffer:\n%s", response_buffer.buffer);
 
     if (loc_info_out.GCPL_base64) {
         RV_free(loc_info_out.GCPL_base64);
@@ -638,14 +638,13 @@ RV_group_close(void *grp, hid_t dxpl_id, void **req)
     if (!_grp)
         FUNC_GOTO_DONE(SUCCEED);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received group close call with following parameters:\n");
-    printf("     - Group's URI: %s\n", _grp->URI);
-    printf("     - Group's object type: %s\n", object_type_to_string(_grp->obj_type));
-    if (_grp->domain && _grp->domain->u.file.filepath_name)
-        printf("     - Group's domain path: %s\n", _grp->domain->u.file.filepath_name);
-    printf("\n");
-#endif
+    if (RV_LOG_ENABLED(RV_LOG_CAT_GROUP, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Received group close call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's URI: %s", _grp->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's object type: %s", object_type_to_string(_grp->obj_type));
+        if (_grp->domain && _grp->domain->u.file.filepath_name)
+            RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group's domain path: %s", _grp->domain->u.file.filepath_name);
+    } /* end if */
 
     if (H5I_GROUP != _grp->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a group");
@@ -702,9 +701,7 @@ RV_get_group_info_callback(char *HTTP_response, const void *callback_data_in, vo
     yajl_val    parse_tree = NULL, key_obj;
     herr_t      ret_value  = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving group's info from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Retrieving group's info from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -728,9 +725,7 @@ RV_get_group_info_callback(char *HTTP_response, const void *callback_data_in, vo
 
     group_info->nlinks = (hsize_t)YAJL_GET_INTEGER(key_obj);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Group had %" PRIuHSIZE "links in it\n\n", group_info->nlinks);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP, "Group had %" PRIuHSIZE "links in it", group_info->nlinks);
 
 done:
     if (parse_tree)
@@ -738,3 +733,183 @@ done:
 
     return ret_value;
 } /* end RV_get_group_info_callback() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_group_create_intermediate
+ *
+ * Purpose:     Creates any groups which are missing along the given path,
+ *              as requested by H5Pset_create_intermediate_group(), and
+ *              copies the URI of the final group in the path into
+ *              URI_out, which must be URI_MAX_LENGTH bytes in size.
+ *
+ *              The deepest group along the path which already exists is
+ *              found with a binary search over the prefixes of the path,
+ *              since every prefix of an existing path also exists. The
+ *              missing groups below it are then created in order, each
+ *              one linked directly under the URI returned by the server
+ *              for the group created before it. This takes O(log(depth))
+ *              lookups plus one request per missing group, rather than
+ *              resolving the path again after creating each group.
+ *
+ *              Only a lookup which the server answers with a 404 counts
+ *              as a missing prefix, and only the errors pushed by that
+ *              lookup are discarded. Any other failure, or a prefix that
+ *              names something other than a group, fails the create.
+ *
+ *              The caller is expected to have already checked that the
+ *              full path does not exist.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_group_create_intermediate(RV_object_t *parent, const char *path, const char *base64_gcpl, char *URI_out)
+{
+    hbool_t is_absolute_path    = (*path == '/');
+    size_t  path_len            = strlen(path);
+    size_t  num_components      = 0;
+    size_t  num_existing        = 0;
+    size_t  search_high         = 0;
+    char  **components          = NULL;
+    char   *path_copy           = NULL;
+    char   *prefix              = NULL;
+    char   *token               = NULL;
+    char   *saveptr             = NULL;
+    char   *escaped_group_name  = NULL;
+    char   *create_request_body = NULL;
+    char    found_URI[URI_MAX_LENGTH];
+    herr_t  ret_value = SUCCEED;
+
+    if (NULL == (path_copy = RV_malloc(path_len + 1)))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for copy of path");
+
+    strcpy(path_copy, path);
+
+    /* A path of n characters contains at most (n + 1) / 2 components */
+    if (NULL == (components = RV_malloc(((path_len + 1) / 2 + 1) * sizeof(char *))))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for path components");
+
+    for (token = RV_strtok_r(path_copy, "/", &saveptr); token; token = RV_strtok_r(NULL, "/", &saveptr))
+        if (strcmp(token, "."))
+            components[num_components++] = token;
+
+    if (NULL == (prefix = RV_malloc(path_len + 2)))
+        FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for path prefix");
+
+    /* The group that the path starts from always exists */
+    strncpy(URI_out, is_absolute_path ? parent->domain->URI : parent->URI, URI_MAX_LENGTH);
+    URI_out[URI_MAX_LENGTH - 1] = '\0';
+
+    if (num_components == 0)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    /* Find the number of leading components of the path which already exist */
+    search_high = num_components - 1;
+
+    while (num_existing < search_high) {
+        size_t     search_mid = num_existing + (search_high - num_existing + 1) / 2;
+        H5I_type_t obj_type   = H5I_GROUP;
+        ssize_t    num_errors = H5Eget_num(H5_rest_err_stack_g);
+        htri_t     search_ret;
+        long       http_response;
+
+        strcpy(prefix, is_absolute_path ? "/" : "");
+
+        for (size_t i = 0; i < search_mid; i++) {
+            if (i > 0)
+                strcat(prefix, "/");
+            strcat(prefix, components[i]);
+        }
+
+        search_ret = RV_find_object_by_path(parent, prefix, &obj_type, RV_copy_object_URI_callback, NULL,
+                                            found_URI);
+
+        if (search_ret > 0) {
+            if (obj_type != H5I_GROUP)
+                FUNC_GOTO_ERROR(H5E_SYM, H5E_BADTYPE, FAIL, "path component '%s' is not a group", prefix);
+
+            num_existing = search_mid;
+            strcpy(URI_out, found_URI);
+            continue;
+        }
+
+        /* Only a prefix which the server reports as missing ends the search; any other failure is real */
+        if (RV_curl_get_response_code(curl, &http_response) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get HTTP response code of lookup of '%s'",
+                            prefix);
+
+        if (http_response != 404)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, FAIL, "can't look up path prefix '%s': received HTTP %ld",
+                            prefix, http_response);
+
+        /* The lookup of a group which doesn't exist yet is expected to fail, so drop only its errors */
+        if (num_errors >= 0 && H5Eget_num(H5_rest_err_stack_g) > num_errors)
+            H5Epop(H5_rest_err_stack_g, (size_t)(H5Eget_num(H5_rest_err_stack_g) - num_errors));
+
+        search_high = search_mid - 1;
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_GROUP,
+                 "Creating %zu intermediate group(s) below the first %zu existing path component(s)",
+                 num_components - num_existing, num_existing);
+
+    /* Create each missing group under the one before it */
+    for (size_t i = num_existing; i < num_components; i++) {
+        size_t escaped_name_size       = 0;
+        size_t create_request_nalloc   = 0;
+        int    create_request_body_len = 0;
+        long   http_response;
+
+        if (RV_JSON_escape_string(components[i], escaped_group_name, &escaped_name_size) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't get size of JSON escaped group name");
+
+        if ((escaped_group_name = RV_malloc(escaped_name_size)) == NULL)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate space for escaped group name");
+
+        if (RV_JSON_escape_string(components[i], escaped_group_name, &escaped_name_size) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't JSON escape group name");
+
+        create_request_nalloc = strlen(group_create_fmt_string) + strlen(URI_out) +
+                                strlen(escaped_group_name) + strlen(base64_gcpl) + 1;
+
+        if (NULL == (create_request_body = (char *)RV_malloc(create_request_nalloc)))
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL,
+                            "can't allocate space for group create request body");
+
+        if ((create_request_body_len = snprintf(create_request_body, create_request_nalloc,
+                                                group_create_fmt_string, URI_out, escaped_group_name,
+                                                base64_gcpl)) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+        if ((size_t)create_request_body_len >= create_request_nalloc)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_SYSERRSTR, FAIL,
+                            "group link create request body size exceeded allocated buffer size");
+
+        http_response = RV_curl_post(curl, &parent->domain->u.file.server_info, "/groups",
+                                     parent->domain->u.file.filepath_name, create_request_body,
+                                     (size_t)create_request_body_len, CONTENT_TYPE_JSON, "H5Gcreate");
+
+        if (!HTTP_SUCCESS(http_response))
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL,
+                            "can't create intermediate group '%s': received HTTP %ld", components[i],
+                            http_response);
+
+        /* The new group is the parent of the next one */
+        if (RV_parse_response(response_buffer.buffer, NULL, URI_out, RV_copy_object_URI_callback) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't parse intermediate group's URI");
+
+        RV_free(escaped_group_name);
+        escaped_group_name = NULL;
+
+        RV_free(create_request_body);
+        create_request_body = NULL;
+    }
+
+done:
+    RV_free(create_request_body);
+    RV_free(escaped_group_name);
+    RV_free(prefix);
+    RV_free(components);
+    RV_free(path_copy);
+
+    return ret_value;
+} /* end RV_group_create_intermediate() */
@@ -38,6 +38,14 @@ static void   RV_free_link_table(link_table_entry *link_table, size_t num_entrie
 static herr_t RV_traverse_link_table(link_table_entry *link_table, size_t num_entries,
                                      const iter_data *iter_data, const char *cur_link_rel_path);
 
+/* Helper to create a link which is the same as another, for H5Lcopy and H5Lmove */
+static herr_t RV_link_duplicate(RV_object_t *src_obj, const H5VL_loc_params_t *src_loc_params,
+                                RV_object_t *dst_obj, const H5VL_loc_params_t *dst_loc_params, hid_t lcpl_id,
+                                hid_t lapl_id, hid_t dxpl_id);
+
+/* Helper to find the URI of the group holding the link at a path, for H5Lmove */
+static herr_t RV_link_parent_URI(RV_object_t *loc_obj, const char *path, char *parent_URI);
+
 /* Qsort callbacks to sort links by name or creation order */
 static int H5_rest_cmp_links_by_creation_order_inc(const void *link1, const void *link2);
 static int H5_rest_cmp_links_by_creation_order_dec(const void *link1, const void *link2);
@@ -85,18 +93,22 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
     long               http_response;
     herr_t             ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received link create call with following parameters:\n");
-    printf("     - Link Name: %s\n", loc_params->loc_data.loc_by_name.name);
-    printf("     - Link Type: %s\n", link_create_type_to_string(args->op_type));
-    if (new_link_loc_obj) {
-        printf("     - Link loc_obj's URI: %s\n", new_link_loc_obj->URI);
-        printf("     - Link loc_obj's type: %s\n", object_type_to_string(new_link_loc_obj->obj_type));
-        printf("     - Link loc_obj's domain path: %s\n", new_link_loc_obj->domain->u.file.filepath_name);
+    if (RV_LOG_ENABLED(RV_LOG_CAT_LINK, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Received link create call with following parameters:");
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link Name: %s", loc_params->loc_data.loc_by_name.name);
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link Type: %s", link_create_type_to_string(args->op_type));
+        if (new_link_loc_obj) {
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's URI: %s", new_link_loc_obj->URI);
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's type: %s",
+                         object_type_to_string(new_link_loc_obj->obj_type));
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's domain path: %s",
+                         new_link_loc_obj->domain->u.file.filepath_name);
+        } /* end if */
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Default LCPL? %s",
+                     (H5P_LINK_CREATE_DEFAULT == lcpl_id) ? "yes" : "no");
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Default LAPL? %s",
+                     (H5P_LINK_ACCESS_DEFAULT == lapl_id) ? "yes" : "no");
     } /* end if */
-    printf("     - Default LCPL? %s\n", (H5P_LINK_CREATE_DEFAULT == lcpl_id) ? "yes" : "no");
-    printf("     - Default LAPL? %s\n\n", (H5P_LINK_ACCESS_DEFAULT == lapl_id) ? "yes" : "no");
-#endif
     if (lcpl_id == H5I_INVALID_HID)
         FUNC_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "invalid LCPL");
 
@@ -179,9 +191,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
 
                     H5I_type_t obj_type = H5I_UNINIT;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Locating hard link's target object\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Locating hard link's target object");
 
                     search_ret =
                         RV_find_object_by_path((RV_object_t *)hard_link_target_obj,
@@ -190,9 +200,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
                     if (!search_ret || search_ret < 0)
                         FUNC_GOTO_ERROR(H5E_LINK, H5E_PATH, FAIL, "can't locate link target object");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Found hard link's target object by given path\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Found hard link's target object by given path");
 
                     target_URI = temp_URI;
 
@@ -205,9 +213,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "invalid loc_params type");
             } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Hard link target object's URI: %s\n\n", target_URI);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Hard link target object's URI: %s", target_URI);
 
             {
                 const char *const fmt_string_no_title = "{\"id\": \"%s\"}";
@@ -252,9 +258,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
                 }
             }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Hard link create request JSON:\n%s\n\n", create_request_body);
-#endif
+            RV_LOG_TRACE(RV_LOG_CAT_LINK, "Hard link create request JSON:\n%s", create_request_body);
 
             break;
         } /* H5VL_LINK_CREATE_HARD */
@@ -264,9 +268,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
 
             const char *link_target = args->args.soft.target;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Soft link target: %s\n\n", link_target);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Soft link target: %s", link_target);
 
             {
                 const char *const fmt_string_no_title = "{\"h5path\": \"%s\"}";
@@ -311,9 +313,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
                 }
             }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Soft link create request JSON:\n%s\n\n", create_request_body);
-#endif
+            RV_LOG_TRACE(RV_LOG_CAT_LINK, "Soft link create request JSON:\n%s", create_request_body);
 
             break;
         } /* H5VL_LINK_CREATE_SOFT */
@@ -332,10 +332,8 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
             if (H5Lunpack_elink_val(udata_buf, udata_buf_size, &elink_flags, &file_path, &link_target) < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't unpack contents of external link buffer");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> External link's domain path: %s\n", file_path);
-            printf("-> External link's link target: %s\n\n", link_target);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "External link's domain path: %s", file_path);
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "External link's link target: %s", link_target);
 
             {
                 const char *const fmt_string_no_title = "{\"h5domain\": \"%s\", \"h5path\": \"%s\"}";
@@ -381,9 +379,7 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
                 }
             }
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> External link create request JSON:\n%s\n\n", create_request_body);
-#endif
+            RV_LOG_TRACE(RV_LOG_CAT_LINK, "External link create request JSON:\n%s", create_request_body);
 
             break;
         } /* H5VL_LINK_CREATE_UD */
@@ -416,28 +412,23 @@ RV_link_create(H5VL_link_create_args_t *args, void *obj, const H5VL_loc_params_t
     if (url_len >= URL_MAX_LENGTH)
         FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL, "link create URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Link create request URL: %s\n\n", request_endpoint);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link create request URL: %s", request_endpoint);
 
     uinfo.buffer      = create_request_body;
     uinfo.buffer_size = (size_t)create_request_body_len;
     uinfo.bytes_sent  = 0;
 
     http_response = RV_curl_put(curl, &new_link_loc_obj->domain->u.file.server_info, request_endpoint,
-                                new_link_loc_obj->domain->u.file.filepath_name, &uinfo, CONTENT_TYPE_JSON);
+                                new_link_loc_obj->domain->u.file.filepath_name, &uinfo, CONTENT_TYPE_JSON,
+                                "H5Lcreate");
 
     if (!HTTP_SUCCESS(http_response))
         FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCREATE, FAIL, "can't create link");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Created link\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Created link");
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Link create response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_LINK, "Link create response buffer:\n%s", response_buffer.buffer);
 
     if (create_request_body)
         RV_free(create_request_body);
@@ -459,6 +450,11 @@ done:
  *              dst_obj by making the appropriate REST API call/s to the
  *              server.
  *
+ *              The link itself is copied, rather than the object it
+ *              points to: a hard link to the same object, or a soft or
+ *              external link with the same value, is created at the
+ *              destination, all on the server.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -470,7 +466,15 @@ RV_link_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, void *dst_obj,
 {
     herr_t ret_value = SUCCEED;
 
-    FUNC_GOTO_ERROR(H5E_LINK, H5E_UNSUPPORTED, FAIL, "H5Lcopy is unsupported");
+    /* If either location was given as H5L_SAME_LOC, the link is copied within the other */
+    if (!src_obj)
+        src_obj = dst_obj;
+    if (!dst_obj)
+        dst_obj = src_obj;
+
+    if (RV_link_duplicate((RV_object_t *)src_obj, loc_params1, (RV_object_t *)dst_obj, loc_params2, lcpl_id,
+                          lapl_id, dxpl_id) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCOPY, FAIL, "can't copy link");
 
 done:
     PRINT_ERROR_STACK;
@@ -487,6 +491,10 @@ done:
  *              server. The original link will be removed as part of the
  *              operation.
  *
+ *              The server has no operation to rename a link, so the link
+ *              is copied to its new location and then deleted from the
+ *              old one. The object the link points to is never touched.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -496,9 +504,46 @@ herr_t
 RV_link_move(void *src_obj, const H5VL_loc_params_t *loc_params1, void *dst_obj,
              const H5VL_loc_params_t *loc_params2, hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id, void **req)
 {
-    herr_t ret_value = SUCCEED;
+    H5VL_link_specific_args_t delete_args;
+    char                      src_parent_URI[URI_MAX_LENGTH];
+    char                      dst_parent_URI[URI_MAX_LENGTH];
+    herr_t                    ret_value = SUCCEED;
+
+    /* If either location was given as H5L_SAME_LOC, the link is moved within the other */
+    if (!src_obj)
+        src_obj = dst_obj;
+    if (!dst_obj)
+        dst_obj = src_obj;
+
+    if (!src_obj)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link location object is NULL");
 
-    FUNC_GOTO_ERROR(H5E_LINK, H5E_UNSUPPORTED, FAIL, "H5Lmove is unsupported");
+    if (H5VL_OBJECT_BY_NAME != loc_params1->type || H5VL_OBJECT_BY_NAME != loc_params2->type)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "invalid loc_params type");
+
+    /* Moving a link onto itself leaves it where it is, even if the two paths to it differ, such
+     * as a name relative to its group and an absolute path from the root group */
+    if (!strcmp(H5_rest_basename(loc_params1->loc_data.loc_by_name.name),
+                H5_rest_basename(loc_params2->loc_data.loc_by_name.name))) {
+        if (RV_link_parent_URI((RV_object_t *)src_obj, loc_params1->loc_data.loc_by_name.name,
+                               src_parent_URI) < 0)
+            FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't locate group holding link");
+        if (RV_link_parent_URI((RV_object_t *)dst_obj, loc_params2->loc_data.loc_by_name.name,
+                               dst_parent_URI) < 0)
+            FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't locate destination group");
+
+        if (!strcmp(src_parent_URI, dst_parent_URI))
+            FUNC_GOTO_DONE(SUCCEED);
+    }
+
+    if (RV_link_duplicate((RV_object_t *)src_obj, loc_params1, (RV_object_t *)dst_obj, loc_params2, lcpl_id,
+                          lapl_id, dxpl_id) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTMOVE, FAIL, "can't create link at new location");
+
+    delete_args.op_type = H5VL_LINK_DELETE;
+
+    if (RV_link_specific(src_obj, loc_params1, &delete_args, dxpl_id, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTREMOVE, FAIL, "can't remove link from old location");
 
 done:
     PRINT_ERROR_STACK;
@@ -530,13 +575,11 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
     int          url_len   = 0;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received link get call with following parameters:\n");
-    printf("     - Link get call type: %s\n", link_get_type_to_string(args->op_type));
-    printf("     - Link loc_obj's URI: %s\n", loc_obj->URI);
-    printf("     - Link loc_obj's object type: %s\n", object_type_to_string(loc_obj->obj_type));
-    printf("     - Link loc_obj's domain path: %s\n\n", loc_obj->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Received link get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link get call type: %s", link_get_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's URI: %s", loc_obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's object type: %s", object_type_to_string(loc_obj->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's domain path: %s", loc_obj->domain->u.file.filepath_name);
 
     switch (args->op_type) {
         /* H5Lget_info */
@@ -570,12 +613,12 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
                         if (!search_ret || search_ret < 0)
                             FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, FAIL, "can't locate parent group");
 
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> H5Lget_info(): Found link's parent object by given path\n");
-                        printf("-> H5Lget_info(): link's parent object URI: %s\n", temp_URI);
-                        printf("-> H5Lget_info(): link's parent object type: %s\n\n",
-                               object_type_to_string(obj_type));
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK,
+                                     "H5Lget_info(): Found link's parent object by given path");
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "H5Lget_info(): link's parent object URI: %s",
+                                     temp_URI);
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "H5Lget_info(): link's parent object type: %s",
+                                     object_type_to_string(obj_type));
                     } /* end if */
 
                     /* URL-encode the name of the link to ensure that the resulting URL for the get
@@ -611,7 +654,7 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
 
             /* Make a GET request to the server to retrieve the number of attributes attached to the object */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Lget_info") < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
             /* Retrieve the link info */
@@ -675,7 +718,8 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
 
             /* Make a GET request to the server to retrieve all of the links in the given group */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                            "H5Lget_name_by_idx") < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
             if (RV_parse_response(response_buffer.buffer, &by_idx_data, &link_name_data,
@@ -719,12 +763,11 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
                         if (!search_ret || search_ret < 0)
                             FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, FAIL, "can't locate parent group");
 
-#ifdef RV_CONNECTOR_DEBUG
-                        printf("-> H5Lget_val(): Found link's parent object by given path\n");
-                        printf("-> H5Lget_val(): link's parent object URI: %s\n", temp_URI);
-                        printf("-> H5Lget_val(): link's parent object type: %s\n\n",
-                               object_type_to_string(obj_type));
-#endif
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK,
+                                     "H5Lget_val(): Found link's parent object by given path");
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "H5Lget_val(): link's parent object URI: %s", temp_URI);
+                        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "H5Lget_val(): link's parent object type: %s",
+                                     object_type_to_string(obj_type));
                     } /* end if */
 
                     /* URL-encode the name of the link to ensure that the resulting URL for the get
@@ -760,7 +803,7 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
 
             /* Make a GET request to the server to retrieve the number of attributes attached to the object */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Lget_val") < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
             /* Retrieve the link value */
@@ -780,9 +823,7 @@ RV_link_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_get_args_t
     } /* end switch */
 
 done:
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Link get response buffer:\n%s\n\n", response_buffer.buffer);
-#endif
+    RV_LOG_TRACE(RV_LOG_CAT_LINK, "Link get response buffer:\n%s", response_buffer.buffer);
 
     if (url_encoded_link_name)
         curl_free(url_encoded_link_name);
@@ -825,13 +866,11 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
     long         http_response;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received link-specific call with following parameters:\n");
-    printf("     - Link-specific call type: %s\n", link_specific_type_to_string(args->op_type));
-    printf("     - Link loc_obj's URI: %s\n", loc_obj->URI);
-    printf("     - Link loc_obj's object type: %s\n", object_type_to_string(loc_obj->obj_type));
-    printf("     - Link loc_obj's domain path: %s\n\n", loc_obj->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Received link-specific call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link-specific call type: %s", link_specific_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's URI: %s", loc_obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's object type: %s", object_type_to_string(loc_obj->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link loc_obj's domain path: %s", loc_obj->domain->u.file.filepath_name);
 
     if (H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "parent object not a file or group");
@@ -899,7 +938,7 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
             } /* end switch */
 
             http_response = RV_curl_delete(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                           (const char *)loc_obj->domain->u.file.filepath_name);
+                                           (const char *)loc_obj->domain->u.file.filepath_name, "H5Ldelete");
 
             if (!HTTP_SUCCESS(http_response))
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTREMOVE, FAIL, "can't delete link");
@@ -968,14 +1007,13 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
                                         empty_dirname ? loc_obj->URI : temp_URI)) < 0)
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL, "snprintf error");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Checking for existence of link using endpoint: %s\n\n", request_endpoint);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Checking for existence of link using endpoint: %s",
+                             request_endpoint);
 
                 if ((http_response = RV_curl_post(curl, &loc_obj->domain->u.file.server_info,
                                                   request_endpoint, loc_obj->domain->u.file.filepath_name,
-                                                  request_body, (size_t)bytes_printed, CONTENT_TYPE_JSON)) <
-                    0)
+                                                  request_body, (size_t)bytes_printed, CONTENT_TYPE_JSON,
+                                                  "H5Lexists")) < 0)
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL,
                                     "internal failure while making POST request to server");
             }
@@ -991,12 +1029,11 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
                                         empty_dirname ? loc_obj->URI : temp_URI, url_encoded_link_name)) < 0)
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL, "snprintf error");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Checking for existence of link using endpoint: %s\n\n", request_endpoint);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Checking for existence of link using endpoint: %s",
+                             request_endpoint);
                 if ((http_response = RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                                 loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON)) <
-                    0)
+                                                 loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                                 "H5Lexists")) < 0)
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL,
                                     "internal failure while making GET request to server");
             }
@@ -1036,10 +1073,8 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
             switch (loc_params->type) {
                 /* H5Literate/H5Lvisit */
                 case H5VL_OBJECT_BY_SELF: {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Opening group for link iteration to generate an hid_t and work around VOL "
-                           "layer\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Opening group for link iteration to generate an hid_t "
+                                 "and work around VOL layer");
 
                     /* Since the VOL doesn't directly pass down the group's hid_t, explicitly open the group
                      * here so that a valid hid_t can be passed to the user's link iteration callback.
@@ -1065,10 +1100,8 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
                     if (H5I_INVALID_HID == loc_params->loc_data.loc_by_name.lapl_id)
                         FUNC_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "invalid LAPL");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Opening group for link iteration to generate an hid_t and work around VOL "
-                           "layer\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Opening group for link iteration to generate an hid_t "
+                                 "and work around VOL layer");
 
                     /* Since the VOL doesn't directly pass down the group's hid_t, explicitly open the group
                      * here so that a valid hid_t can be passed to the user's link iteration callback.
@@ -1096,9 +1129,7 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "invalid loc_params type");
             } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Registering hid_t for opened group\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Registering hid_t for opened group");
 
             /* Note: The case of handling the group ID is awkward as it is, but is made even more
              * awkward by the fact that this might be the first call to register an ID for an object
@@ -1123,7 +1154,7 @@ RV_link_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_link_speci
 
             /* Make a GET request to the server to retrieve all of the links in the given group */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Literate") < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
             if (RV_parse_response(response_buffer.buffer, &link_iter_data, NULL, RV_link_iter_callback) < 0)
@@ -1159,6 +1190,131 @@ done:
     return ret_value;
 } /* end RV_link_specific() */
 
+/*-------------------------------------------------------------------------
+ * Function:    RV_link_duplicate
+ *
+ * Purpose:     Creates a link at the destination location which is the
+ *              same as the link at the source location. A hard link is
+ *              duplicated as a hard link to the same object, and a soft
+ *              or external link as a link with the same value.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_link_duplicate(RV_object_t *src_obj, const H5VL_loc_params_t *src_loc_params, RV_object_t *dst_obj,
+                  const H5VL_loc_params_t *dst_loc_params, hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id)
+{
+    H5VL_link_create_args_t create_args;
+    H5VL_link_get_args_t    get_args;
+    H5L_info2_t             link_info;
+    char                   *link_val  = NULL;
+    herr_t                  ret_value = SUCCEED;
+
+    if (!src_obj || !dst_obj)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link location object is NULL");
+
+    if (H5VL_OBJECT_BY_NAME != src_loc_params->type || H5VL_OBJECT_BY_NAME != dst_loc_params->type)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "invalid loc_params type");
+
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Duplicating link '%s' in object %s as '%s' in object %s",
+                 src_loc_params->loc_data.loc_by_name.name, src_obj->URI,
+                 dst_loc_params->loc_data.loc_by_name.name, dst_obj->URI);
+
+    get_args.op_type             = H5VL_LINK_GET_INFO;
+    get_args.args.get_info.linfo = &link_info;
+
+    if (RV_link_get(src_obj, src_loc_params, &get_args, dxpl_id, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get info of link");
+
+    switch (link_info.type) {
+        case H5L_TYPE_HARD:
+            /* Resolving the source path leads to the object the link points to */
+            create_args.op_type                   = H5VL_LINK_CREATE_HARD;
+            create_args.args.hard.curr_obj        = src_obj;
+            create_args.args.hard.curr_loc_params = *src_loc_params;
+            break;
+
+        case H5L_TYPE_SOFT:
+        case H5L_TYPE_EXTERNAL:
+            if (NULL == (link_val = RV_malloc(link_info.u.val_size)))
+                FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "can't allocate space for link value");
+
+            get_args.op_type               = H5VL_LINK_GET_VAL;
+            get_args.args.get_val.buf      = link_val;
+            get_args.args.get_val.buf_size = link_info.u.val_size;
+
+            if (RV_link_get(src_obj, src_loc_params, &get_args, dxpl_id, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get value of link");
+
+            /* An external link's value is already packed as H5Lcreate_external() would pack it */
+            if (H5L_TYPE_SOFT == link_info.type) {
+                create_args.op_type          = H5VL_LINK_CREATE_SOFT;
+                create_args.args.soft.target = link_val;
+            }
+            else {
+                create_args.op_type          = H5VL_LINK_CREATE_UD;
+                create_args.args.ud.type     = H5L_TYPE_EXTERNAL;
+                create_args.args.ud.buf      = link_val;
+                create_args.args.ud.buf_size = link_info.u.val_size;
+            }
+
+            break;
+
+        case H5L_TYPE_ERROR:
+        case H5L_TYPE_MAX:
+        default:
+            FUNC_GOTO_ERROR(H5E_LINK, H5E_UNSUPPORTED, FAIL, "unsupported link type");
+    } /* end switch */
+
+    if (RV_link_create(&create_args, dst_obj, dst_loc_params, lcpl_id, lapl_id, dxpl_id, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCREATE, FAIL, "can't create link");
+
+done:
+    if (link_val)
+        RV_free(link_val);
+
+    return ret_value;
+} /* end RV_link_duplicate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_link_parent_URI
+ *
+ * Purpose:     Finds the URI of the group which holds the link at the
+ *              given path, relative to the given object, so that two
+ *              paths can be compared by the group they lead to rather
+ *              than by how they are spelled.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_link_parent_URI(RV_object_t *loc_obj, const char *path, char *parent_URI)
+{
+    H5I_type_t obj_type = H5I_GROUP;
+    htri_t     search_ret;
+    char      *dir_name  = NULL;
+    herr_t     ret_value = SUCCEED;
+
+    if (NULL == (dir_name = H5_rest_dirname(path)))
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get path dirname");
+
+    /* A name with no groups on the way to it is a link in the given group itself */
+    if (!strcmp(dir_name, "")) {
+        strncpy(parent_URI, loc_obj->URI, URI_MAX_LENGTH - 1);
+        parent_URI[URI_MAX_LENGTH - 1] = '\0';
+    }
+    else {
+        search_ret = RV_find_object_by_path(loc_obj, dir_name, &obj_type, RV_copy_object_URI_callback, NULL,
+                                            parent_URI);
+        if (!search_ret || search_ret < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_PATH, FAIL, "can't locate group '%s'", dir_name);
+    }
+
+done:
+    RV_free(dir_name);
+
+    return ret_value;
+} /* end RV_link_parent_URI() */
+
 /*-------------------------------------------------------------------------
  * Function:    RV_get_link_info_callback
  *
@@ -1185,9 +1341,7 @@ RV_get_link_info_callback(char *HTTP_response, const void *callback_data_in, voi
     char        *parsed_string;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving link's info from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieving link's info from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1220,9 +1374,7 @@ RV_get_link_info_callback(char *HTTP_response, const void *callback_data_in, voi
     else
         FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "invalid link class");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieved link's class: %s\n\n", link_class_to_string(link_info->type));
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieved link's class: %s", link_class_to_string(link_info->type));
 
     /* If this is not a hard link, determine the value for the 'val_size' field corresponding
      * to the size of a soft, external or user-defined link's value, including the NULL terminator
@@ -1235,9 +1387,7 @@ RV_get_link_info_callback(char *HTTP_response, const void *callback_data_in, voi
         if (RV_parse_response(HTTP_response, NULL, &get_link_val_args, RV_get_link_val_callback) < 0)
             FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link value size");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Retrieved link's value size: %zu\n\n", link_info->u.val_size);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieved link's value size: %zu", link_info->u.val_size);
     } /* end if */
     else {
         /* TODO */
@@ -1290,9 +1440,7 @@ RV_get_link_val_callback(char *HTTP_response, const void *callback_data_in, void
     char             *out_buf   = get_link_val_args->buf;
     herr_t            ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving link's value from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieving link's value from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1337,9 +1485,7 @@ RV_get_link_val_callback(char *HTTP_response, const void *callback_data_in, void
              */
             *in_buf_size = strlen(link_path) + 1;
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Returning size of soft link's value\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Returning size of soft link's value");
         } /* end if */
         else {
             if (out_buf)
@@ -1348,9 +1494,7 @@ RV_get_link_val_callback(char *HTTP_response, const void *callback_data_in, void
             /* Ensure that the buffer is NULL-terminated */
             out_buf[*in_buf_size - 1] = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Returning soft link's value\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Returning soft link's value");
         } /* end else */
     }     /* end if */
     else {
@@ -1376,9 +1520,7 @@ RV_get_link_val_callback(char *HTTP_response, const void *callback_data_in, void
              */
             *in_buf_size = 1 + (strlen(link_domain) + 1) + (strlen(link_path) + 1);
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Returning size of external link's value\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Returning size of external link's value");
         } /* end if */
         else {
             uint8_t *p = (uint8_t *)out_buf;
@@ -1400,9 +1542,7 @@ RV_get_link_val_callback(char *HTTP_response, const void *callback_data_in, void
                 /* Finally comes the external link's target path */
                 strncpy((char *)p, link_path, (*in_buf_size - 1) - (strlen(link_domain) + 1));
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Returning external link's value\n\n");
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Returning external link's value");
             } /* end if */
         }     /* end else */
     }         /* end else */
@@ -1437,9 +1577,7 @@ RV_get_link_obj_type_callback(char *HTTP_response, const void *callback_data_in,
     char       *parsed_string;
     herr_t      ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving object's type from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieving object's type from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1482,9 +1620,7 @@ RV_get_link_obj_type_callback(char *HTTP_response, const void *callback_data_in,
     else
         FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "invalid object type");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieved object's type: %s\n\n", object_type_to_string(*obj_type));
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieved object's type: %s", object_type_to_string(*obj_type));
 
 done:
     if (parse_tree)
@@ -1557,13 +1693,11 @@ RV_get_link_name_by_idx_callback(char *HTTP_response, const void *callback_data_
             link_table_sort_func = H5_rest_cmp_links_by_creation_order_dec;
     } /* end else */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Building link table and sorting by %s in %s order\n\n",
-           (H5_INDEX_NAME == by_idx_data->index_type) ? "link name" : "link creation order",
-           (H5_ITER_INC == by_idx_data->iter_order || H5_ITER_NATIVE == by_idx_data->iter_order)
-               ? "increasing"
-               : "decreasing");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Building link table and sorting by %s in %s order",
+                 (H5_INDEX_NAME == by_idx_data->index_type) ? "link name" : "link creation order",
+                 (H5_ITER_INC == by_idx_data->iter_order || H5_ITER_NATIVE == by_idx_data->iter_order)
+                     ? "increasing"
+                     : "decreasing");
 
     if (RV_build_link_table(HTTP_response, by_idx_data->is_recursive, link_table_sort_func, &link_table,
                             &link_table_num_entries, NULL, by_idx_data->iter_obj_parent) < 0)
@@ -1573,9 +1707,7 @@ RV_get_link_name_by_idx_callback(char *HTTP_response, const void *callback_data_
     if (*by_idx_data->idx_p >= link_table_num_entries)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link index number larger than number of links");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving link name of link at index %" PRIuHSIZE "\n\n", *by_idx_data->idx_p);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Retrieving link name of link at index %" PRIuHSIZE, *by_idx_data->idx_p);
 
     /* Retrieve the nth link name */
     {
@@ -1587,17 +1719,14 @@ RV_get_link_name_by_idx_callback(char *HTTP_response, const void *callback_data_
                     link_name_data->link_name_len);
             link_name_data->link_name[link_name_data->link_name_len - 1] = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Link name was '%s'\n\n", link_name_data->link_name);
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link name was '%s'", link_name_data->link_name);
         } /* end if */
 
         /* Set the link name length in case the function call is trying to find this out */
         link_name_data->link_name_len = strlen(selected_link_entry.link_name);
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Returning link name length of %" PRIuHSIZE "\n\n", link_name_data->link_name_len);
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Returning link name length of %" PRIuHSIZE,
+                     link_name_data->link_name_len);
     }
 
 done:
@@ -1632,10 +1761,8 @@ RV_link_iter_callback(char *HTTP_response, const void *callback_data_in, void *c
     size_t            link_table_num_entries;
     herr_t            ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Iterating %s through links according to server's HTTP response\n\n",
-           link_iter_data->is_recursive ? "recursively" : "non-recursively");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Iterating %s through links according to server's HTTP response",
+                 link_iter_data->is_recursive ? "recursively" : "non-recursively");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1668,9 +1795,7 @@ RV_link_iter_callback(char *HTTP_response, const void *callback_data_in, void *c
                                 visited_link_table, link_iter_data->iter_obj_parent) < 0)
             FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTBUILDLINKTABLE, FAIL, "can't build link table");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Link table sorted according to link creation order\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link table sorted according to link creation order");
     } /* end if */
     else {
         if (RV_build_link_table(HTTP_response, link_iter_data->is_recursive, NULL, &link_table,
@@ -1751,9 +1876,8 @@ RV_build_link_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func)(
     if (is_recursive && !visited_link_table)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "visited link hash table was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Building table of links %s\n\n", is_recursive ? "recursively" : "non-recursively");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Building table of links %s",
+                 is_recursive ? "recursively" : "non-recursively");
 
     /* If this is a call to H5Lvisit, make a copy of the HTTP response since the
      * buffer that cURL writes to is currently global and will be changed when the
@@ -1911,7 +2035,8 @@ RV_build_link_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func)(
                                         "link GET request URL size exceeded maximum URL size");
 
                     if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                    "H5Literate") < 0)
                         FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
                     if (RV_build_link_table(response_buffer.buffer, is_recursive, sort_func,
@@ -1923,11 +2048,9 @@ RV_build_link_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func)(
                     curl_free(url_encoded_link_name);
                     url_encoded_link_name = NULL;
                 } /* end if */
-#ifdef RV_CONNECTOR_DEBUG
                 else {
-                    printf("-> Cyclic link detected; not following into subgroup\n\n");
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Cyclic link detected; not following into subgroup");
                 } /* end else */
-#endif
             } /* end if */
         }     /* end if */
 
@@ -1935,9 +2058,7 @@ RV_build_link_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func)(
         link_section_start = link_section_end + 1;
     } /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Link table built\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link table built");
 
     if (sort_func)
         qsort(table, num_links, sizeof(*table), sort_func);
@@ -2015,18 +2136,15 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
     switch (link_iter_data->iter_order) {
         case H5_ITER_NATIVE:
         case H5_ITER_INC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in increasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Beginning iteration in increasing order");
 
             for (last_idx = (link_iter_data->idx_p ? *link_iter_data->idx_p : 0); last_idx < num_entries;
                  last_idx++) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link %zu name: %s\n", last_idx, link_table[last_idx].link_name);
-                printf("-> Link %zu creation time: %f\n", last_idx, link_table[last_idx].crt_time);
-                printf("-> Link %zu type: %s\n\n", last_idx,
-                       link_class_to_string(link_table[last_idx].link_info.type));
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu name: %s", last_idx, link_table[last_idx].link_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu creation time: %f", last_idx,
+                             link_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu type: %s", last_idx,
+                             link_class_to_string(link_table[last_idx].link_info.type));
 
                 /* Form the link's relative path from the parent group by combining the current relative path
                  * with the link's name */
@@ -2040,9 +2158,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL,
                                     "link's relative path string size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Calling supplied callback function with relative link path %s\n\n", link_rel_path);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Calling supplied callback function with relative link path %s",
+                             link_rel_path);
 
                 /* Call the user's callback */
                 callback_ret = link_iter_data->iter_function.link_iter_op(
@@ -2057,9 +2174,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
 
                 /* If this is a group and H5Lvisit has been called, descend into the group */
                 if (link_table[last_idx].subgroup.subgroup_link_table) {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Descending into subgroup '%s'\n\n", link_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Descending into subgroup '%s'",
+                                 link_table[last_idx].link_name);
 
                     depth++;
                     if (RV_traverse_link_table(link_table[last_idx].subgroup.subgroup_link_table,
@@ -2070,9 +2186,7 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                                         link_table[last_idx].link_name);
                     depth--;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Exiting subgroup '%s'\n\n", link_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Exiting subgroup '%s'", link_table[last_idx].link_name);
                 } /* end if */
                 else {
                     char *last_slash = strrchr(link_rel_path, '/');
@@ -2082,10 +2196,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                     if (last_slash)
                         *last_slash = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Relative link path after truncating trailing link name: %s\n\n",
-                           link_rel_path);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK,
+                                 "Relative link path after truncating trailing link name: %s", link_rel_path);
                 } /* end else */
             }     /* end for */
 
@@ -2093,18 +2205,15 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
         } /* H5_ITER_NATIVE H5_ITER_INC */
 
         case H5_ITER_DEC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in decreasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Beginning iteration in decreasing order");
 
             for (last_idx = (link_iter_data->idx_p ? *link_iter_data->idx_p : num_entries - 1); last_idx >= 0;
                  last_idx--) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link %zu name: %s\n", last_idx, link_table[last_idx].link_name);
-                printf("-> Link %zu creation time: %f\n", last_idx, link_table[last_idx].crt_time);
-                printf("-> Link %zu type: %s\n\n", last_idx,
-                       link_class_to_string(link_table[last_idx].link_info.type));
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu name: %s", last_idx, link_table[last_idx].link_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu creation time: %f", last_idx,
+                             link_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link %zu type: %s", last_idx,
+                             link_class_to_string(link_table[last_idx].link_info.type));
 
                 /* Form the link's relative path from the parent group by combining the current relative path
                  * with the link's name */
@@ -2118,9 +2227,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL,
                                     "link's relative path string size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Calling supplied callback function with relative link path %s\n\n", link_rel_path);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Calling supplied callback function with relative link path %s",
+                             link_rel_path);
 
                 /* Call the user's callback */
                 callback_ret = link_iter_data->iter_function.link_iter_op(
@@ -2135,9 +2243,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
 
                 /* If this is a group and H5Lvisit has been called, descend into the group */
                 if (link_table[last_idx].subgroup.subgroup_link_table) {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Descending into subgroup '%s'\n\n", link_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Descending into subgroup '%s'",
+                                 link_table[last_idx].link_name);
 
                     depth++;
                     if (RV_traverse_link_table(link_table[last_idx].subgroup.subgroup_link_table,
@@ -2148,9 +2255,7 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                                         link_table[last_idx].link_name);
                     depth--;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Exiting subgroup '%s'\n\n", link_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Exiting subgroup '%s'", link_table[last_idx].link_name);
                 } /* end if */
                 else {
                     char *last_slash = strrchr(link_rel_path, '/');
@@ -2160,10 +2265,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
                     if (last_slash)
                         *last_slash = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Relative link path after truncating trailing link name: %s\n\n",
-                           link_rel_path);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_LINK,
+                                 "Relative link path after truncating trailing link name: %s", link_rel_path);
                 } /* end else */
 
                 if (last_idx == 0)
@@ -2179,10 +2282,8 @@ RV_traverse_link_table(link_table_entry *link_table, size_t num_entries, const i
             FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "unknown link iteration order");
     } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
     if (depth == 0)
-        printf("-> Link iteration finished\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_LINK, "Link iteration finished");
 
 done:
     /* Keep track of the last index where we left off */
@@ -17,6 +17,29 @@
 
 #include "rest_vol_object.h"
 
+/* Size in bytes of the blocks which H5Ocopy streams a dataset's data through the client in, when the
+ * server can't copy the dataset itself, and the number of blocks transferred in parallel at a time */
+#define OBJECT_COPY_BLOCK_SIZE  (4 * 1024 * 1024)
+#define OBJECT_COPY_BATCH_COUNT 8
+
+/* State of an H5Ocopy call. Each object copied is kept open in a table from the URI of the
+ * original object, so that an object reached through more than one hard link is copied once
+ * and linked to again. */
+typedef struct object_copy_info_t {
+    unsigned         flags;
+    hid_t            lcpl_id;
+    hid_t            dxpl_id;
+    rv_hash_table_t *copied_objects;
+} object_copy_info_t;
+
+/* Names of the links or attributes of an object being copied, and the types of the links */
+typedef struct object_copy_names_t {
+    char      **names;
+    H5L_type_t *link_types;
+    size_t      count;
+    size_t      nalloc;
+} object_copy_names_t;
+
 /* Set of callbacks for RV_parse_response() */
 static herr_t RV_get_object_info_callback(char *HTTP_response, const void *callback_data_in,
                                           void *callback_data_out);
@@ -38,6 +61,28 @@ static herr_t RV_traverse_object_table(object_table_entry *object_table,
 
 static void RV_free_object_table(object_table_entry *object_table, size_t num_entries);
 
+/* Helper functions for H5Ocopy */
+static herr_t       RV_object_copy_object(RV_object_t *src, RV_object_t *dst_parent, const char *dst_name,
+                                          unsigned depth, object_copy_info_t *copy_info);
+static RV_object_t *RV_object_copy_dataset(RV_object_t *src, RV_object_t *dst_parent, const char *dst_name,
+                                           const object_copy_info_t *copy_info, hbool_t *attrs_copied);
+static htri_t       RV_object_copy_dataset_on_server(RV_object_t *src, RV_object_t *dst_parent,
+                                                     const char               *dst_name,
+                                                     const object_copy_info_t *copy_info, RV_object_t **copy);
+static herr_t       RV_object_copy_dataset_data(RV_object_t *src, RV_object_t *dst, hid_t dxpl_id);
+static herr_t       RV_object_copy_attributes(RV_object_t *src, RV_object_t *dst, hid_t dxpl_id);
+static herr_t       RV_object_copy_links(RV_object_t *src, RV_object_t *dst, unsigned depth,
+                                         object_copy_info_t *copy_info);
+static herr_t       RV_object_copy_link_name_cb(hid_t group, const char *name, const H5L_info2_t *info,
+                                                void *op_data);
+static herr_t       RV_object_copy_attr_name_cb(hid_t location_id, const char *attr_name,
+                                                const H5A_info_t *ainfo, void *op_data);
+static herr_t       RV_object_copy_add_name(object_copy_names_t *names, const char *name,
+                                            H5L_type_t link_type);
+static void         RV_object_copy_free_names(object_copy_names_t *names);
+static herr_t       RV_object_copy_close(RV_object_t *obj);
+static htri_t       RV_object_copy_needs_reclaim(hid_t type_id);
+
 /* JSON keys to retrieve relevant information for H5Oget_info */
 const char *attribute_count_keys[] = {"attributeCount", (const char *)0};
 
@@ -64,21 +109,22 @@ RV_object_open(void *obj, const H5VL_loc_params_t *loc_params, H5I_type_t *opene
     hid_t        lapl_id;
     void        *ret_value = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received object open call with following parameters:\n");
-    if (H5VL_OBJECT_BY_NAME == loc_params->type) {
-        printf("     - H5Oopen variant: H5Oopen\n");
+    if (RV_LOG_ENABLED(RV_LOG_CAT_OBJECT, RV_LOG_LEVEL_DEBUG)) {
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Received object open call with following parameters:");
+        if (H5VL_OBJECT_BY_NAME == loc_params->type) {
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oopen variant: H5Oopen");
+        } /* end if */
+        else if (H5VL_OBJECT_BY_IDX == loc_params->type) {
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oopen variant: H5Oopen_by_idx");
+        } /* end else if */
+
+        if (loc_params->loc_data.loc_by_name.name)
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Path to object: %s", loc_params->loc_data.loc_by_name.name);
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's URI: %s", loc_obj->URI);
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's type: %s", object_type_to_string(loc_obj->obj_type));
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's domain path: %s",
+                     loc_obj->domain->u.file.filepath_name);
     } /* end if */
-    else if (H5VL_OBJECT_BY_IDX == loc_params->type) {
-        printf("     - H5Oopen variant: H5Oopen_by_idx\n");
-    } /* end else if */
-
-    if (loc_params->loc_data.loc_by_name.name)
-        printf("     - Path to object: %s\n", loc_params->loc_data.loc_by_name.name);
-    printf("     - loc_id object's URI: %s\n", loc_obj->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(loc_obj->obj_type));
-    printf("     - loc_id object's domain path: %s\n\n", loc_obj->domain->u.file.filepath_name);
-#endif
 
     if (H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "parent object not a file or group");
@@ -98,9 +144,7 @@ RV_object_open(void *obj, const H5VL_loc_params_t *loc_params, H5I_type_t *opene
             if (!search_ret || search_ret < 0)
                 FUNC_GOTO_ERROR(H5E_OBJECT, H5E_PATH, NULL, "can't find object by name");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Found object by given path\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Found object by given path");
 
             break;
         } /* H5VL_OBJECT_BY_NAME */
@@ -120,9 +164,7 @@ RV_object_open(void *obj, const H5VL_loc_params_t *loc_params, H5I_type_t *opene
     /* Call the appropriate RV_*_open call based upon the object type */
     switch (obj_type) {
         case H5I_DATATYPE:
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Opening datatype\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Opening datatype");
 
             /* Setup the correct lapl_id. Note that if H5P_DEFAULT was specified for the LAPL in the
              * H5Oopen(_by_name) call, HDF5 will actually pass H5P_LINK_ACCESS_DEFAULT down to this layer */
@@ -146,9 +188,7 @@ RV_object_open(void *obj, const H5VL_loc_params_t *loc_params, H5I_type_t *opene
             break;
 
         case H5I_DATASET:
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Opening dataset\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Opening dataset");
 
             /* Setup the correct lapl_id. Note that if H5P_DEFAULT was specified for the LAPL in the
              * H5Oopen(_by_name) call, HDF5 will actually pass H5P_LINK_ACCESS_DEFAULT down to this layer */
@@ -172,9 +212,7 @@ RV_object_open(void *obj, const H5VL_loc_params_t *loc_params, H5I_type_t *opene
             break;
 
         case H5I_GROUP:
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Opening group\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Opening group");
 
             /* Setup the correct lapl_id. Note that if H5P_DEFAULT was specified for the LAPL in the
              * H5Oopen(_by_name) call, HDF5 will actually pass H5P_LINK_ACCESS_DEFAULT down to this layer */
@@ -230,6 +268,12 @@ done:
  *              file or group specified by dst_obj by making the
  *              appropriate REST API call/s to the server.
  *
+ *              Datasets are copied by the server when it supports doing
+ *              so. Otherwise, their data is streamed through the client
+ *              block by block, so that a whole dataset is never held in
+ *              memory. Groups are copied along with everything linked
+ *              under them, unless H5O_COPY_SHALLOW_HIERARCHY_FLAG is set.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -240,11 +284,70 @@ RV_object_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, const char *
                const H5VL_loc_params_t *loc_params2, const char *dst_name, hid_t ocpypl_id, hid_t lcpl_id,
                hid_t dxpl_id, void **req)
 {
-    herr_t ret_value = SUCCEED;
+    RV_object_t         *src_loc_obj = (RV_object_t *)src_obj;
+    RV_object_t         *dst_loc_obj = (RV_object_t *)dst_obj;
+    RV_object_t         *src         = NULL;
+    H5VL_loc_params_t    src_loc_params;
+    object_copy_info_t   copy_info;
+    rv_hash_table_iter_t iter;
+    herr_t               ret_value = SUCCEED;
+
+    copy_info.copied_objects = NULL;
+
+    if (!src_loc_obj || !dst_loc_obj)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object location is NULL");
+    if (!src_name || !dst_name)
+        FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object name is NULL");
+
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Received object copy call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Source object: %s in %s", src_name, src_loc_obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Destination: %s in %s", dst_name, dst_loc_obj->URI);
+
+    if (!(dst_loc_obj->domain->u.file.intent & H5F_ACC_RDWR))
+        FUNC_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    if (H5Pget_copy_object(ocpypl_id, &copy_info.flags) < 0)
+        FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object copy flags");
+
+    if (copy_info.flags & (H5O_COPY_EXPAND_SOFT_LINK_FLAG | H5O_COPY_EXPAND_EXT_LINK_FLAG |
+                           H5O_COPY_EXPAND_REFERENCE_FLAG | H5O_COPY_MERGE_COMMITTED_DTYPE_FLAG))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_UNSUPPORTED, FAIL,
+                        "H5Ocopy can't expand links or references or merge committed datatypes");
+
+    copy_info.lcpl_id = lcpl_id;
+    copy_info.dxpl_id = dxpl_id;
+
+    if (NULL == (copy_info.copied_objects = rv_hash_table_new(rv_hash_string, H5_rest_compare_string_keys)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate table of copied objects");
+
+    rv_hash_table_register_free_functions(copy_info.copied_objects, RV_free_visited_link_hash_table_key,
+                                          NULL);
+
+    src_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    src_loc_params.obj_type                     = src_loc_obj->obj_type;
+    src_loc_params.loc_data.loc_by_name.name    = src_name;
+    src_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+
+    if (NULL == (src = RV_object_open(src_loc_obj, &src_loc_params, NULL, dxpl_id, NULL)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTOPENOBJ, FAIL, "can't open object to copy");
 
-    FUNC_GOTO_ERROR(H5E_OBJECT, H5E_UNSUPPORTED, FAIL, "H5Ocopy is unsupported");
+    if (RV_object_copy_object(src, dst_loc_obj, dst_name, 0, &copy_info) < 0)
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, FAIL, "can't copy object");
 
 done:
+    if (src && RV_object_copy_close(src) < 0)
+        FUNC_DONE_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close object to copy");
+
+    if (copy_info.copied_objects) {
+        rv_hash_table_iterate(copy_info.copied_objects, &iter);
+
+        while (rv_hash_table_iter_has_more(&iter))
+            if (RV_object_copy_close((RV_object_t *)rv_hash_table_iter_next(&iter)) < 0)
+                FUNC_DONE_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close copied object");
+
+        rv_hash_table_free(copy_info.copied_objects);
+    }
+
     PRINT_ERROR_STACK;
 
     return ret_value;
@@ -277,13 +380,11 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
     loc_info_out.domain      = loc_obj->domain;
     loc_obj->domain->u.file.ref_count++;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received object get call with following parameters:\n");
-    printf("     - Object get call type: %s\n", object_get_type_to_string(args->op_type));
-    printf("     - loc_id object's URI: %s\n", loc_obj->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(loc_obj->obj_type));
-    printf("     - loc_id object's domain path: %s\n\n", loc_obj->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Received object get call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object get call type: %s", object_get_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's URI: %s", loc_obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's type: %s", object_type_to_string(loc_obj->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's domain path: %s", loc_obj->domain->u.file.filepath_name);
 
     if (H5I_FILE != loc_obj->obj_type && H5I_GROUP != loc_obj->obj_type &&
         H5I_DATATYPE != loc_obj->obj_type && H5I_DATASET != loc_obj->obj_type)
@@ -351,9 +452,8 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
                         FUNC_GOTO_ERROR(H5E_OBJECT, H5E_SYSERRSTR, FAIL,
                                         "H5Oget_info request URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Oget_info(): Object type: %s\n\n", object_type_to_string(obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info(): Object type: %s",
+                                 object_type_to_string(obj_type));
 
                     break;
                 } /* H5VL_OBJECT_BY_SELF */
@@ -369,9 +469,7 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
 
                     obj_type = H5I_UNINIT;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Oget_info_by_name(): locating object by given path\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info_by_name(): locating object by given path");
 
                     loc_info_out.URI = temp_URI;
                     /* loc_info_out.domain was copied at function start */
@@ -383,12 +481,10 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
                     if (!search_ret || search_ret < 0)
                         FUNC_GOTO_ERROR(H5E_OBJECT, H5E_PATH, FAIL, "can't locate object by path");
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Oget_info_by_name(): found object by given path\n");
-                    printf("-> H5Oget_info_by_name(): object's URI: %s\n", temp_URI);
-                    printf("-> H5Oget_info_by_name(): object's type: %s\n\n",
-                           object_type_to_string(obj_type));
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info_by_name(): found object by given path");
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info_by_name(): object's URI: %s", temp_URI);
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info_by_name(): object's type: %s",
+                                 object_type_to_string(obj_type));
 
                     /* Redirect cURL from the base URL to
                      * "/groups/<id>", "/datasets/<id>" or "/datatypes/<id>",
@@ -422,9 +518,7 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
 
                     obj_type = H5I_UNINIT;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> H5Oget_info_by_idx(): locating object by given path\n\n");
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "H5Oget_info_by_idx(): locating object by given path");
 
                     loc_info_out.URI = temp_URI;
                     /* loc_info_out.domain was copied at function start */
@@ -479,7 +573,8 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
                                         "attribute open URL exceeded maximum URL size");
 
                     if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON,
+                                    "H5Oget_info") < 0)
                         FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link");
 
                     if (0 > RV_parse_response(response_buffer.buffer,
@@ -522,7 +617,7 @@ RV_object_get(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_get_ar
 
             /* Make a GET request to the server to retrieve the number of attributes attached to the object */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Oget_info") < 0)
                 FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get object");
 
             /* Retrieve the attribute count for the object */
@@ -588,13 +683,12 @@ RV_object_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_s
     char               visit_by_name_URI[URI_MAX_LENGTH];
     char               request_endpoint[URL_MAX_LENGTH];
     int                url_len = 0;
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Received object-specific call with following parameters:\n");
-    printf("     - Object-specific call type: %s\n", object_specific_type_to_string(args->op_type));
-    printf("     - loc_id object's URI: %s\n", loc_obj->URI);
-    printf("     - loc_id object's type: %s\n", object_type_to_string(loc_obj->obj_type));
-    printf("     - loc_id object's domain path: %s\n\n", loc_obj->domain->u.file.filepath_name);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Received object-specific call with following parameters:");
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object-specific call type: %s",
+                 object_specific_type_to_string(args->op_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's URI: %s", loc_obj->URI);
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's type: %s", object_type_to_string(loc_obj->obj_type));
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "loc_id object's domain path: %s", loc_obj->domain->u.file.filepath_name);
 
     switch (args->op_type) {
         /* H5Oincr/decr_refcount */
@@ -868,9 +962,7 @@ RV_object_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_s
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL,
                                 "H5Oiterate/visit request URL size exceeded maximum URL size");
 
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Registering hid_t for opened object iteration \n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Registering hid_t for opened object iteration ");
 
             /* Note: Because this might be the first call to register an ID for an object of iter_object_type,
              * it is possible that the H5X interface will be uninitialized at this point, which would lead
@@ -912,7 +1004,7 @@ RV_object_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_s
 
             /* Make GET request to server */
             if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                            loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Ovisit") < 0)
                 FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link to object");
 
             if (RV_parse_response(response_buffer.buffer, NULL, &oinfo, RV_get_object_info_callback) < 0)
@@ -944,7 +1036,7 @@ RV_object_specific(void *obj, const H5VL_loc_params_t *loc_params, H5VL_object_s
                                         "H5Oiterate/visit request URL size exceeded maximum URL size");
 
                     if (RV_curl_get(curl, &loc_obj->domain->u.file.server_info, request_endpoint,
-                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON) < 0)
+                                    loc_obj->domain->u.file.filepath_name, CONTENT_TYPE_JSON, "H5Ovisit") < 0)
                         FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link to object");
 
                     if (RV_parse_response(response_buffer.buffer, &object_iter_data, NULL,
@@ -1048,9 +1140,7 @@ RV_get_object_info_callback(char *HTTP_response, const void *callback_data_in, v
     const char  *path_name = NULL;
     herr_t       ret_value = SUCCEED;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Retrieving object's info from server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Retrieving object's info from server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1097,9 +1187,7 @@ RV_get_object_info_callback(char *HTTP_response, const void *callback_data_in, v
 
     obj_info->fileno = (unsigned long)rv_hash_string(domain_path);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Object's file number: %lu\n", (unsigned long)obj_info->fileno);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object's file number: %lu", (unsigned long)obj_info->fileno);
 
     if (NULL == (key_obj = yajl_tree_get(target_tree, object_id_keys, yajl_t_string)))
         FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "retrieval of object ID failed");
@@ -1110,9 +1198,7 @@ RV_get_object_info_callback(char *HTTP_response, const void *callback_data_in, v
     /* TODO */
     obj_info->token = H5O_TOKEN_UNDEF;
 
-#ifdef RV_CONNECTOR_DEBUG
-    /* TODO: representation of object token */
-#endif
+    /* TODO: log a representation of the object token */
 
     /* Retrieve the object's attribute count */
     if (NULL == (key_obj = yajl_tree_get(target_tree, attribute_count_keys, yajl_t_number)))
@@ -1126,9 +1212,8 @@ RV_get_object_info_callback(char *HTTP_response, const void *callback_data_in, v
 
     obj_info->num_attrs = (hsize_t)YAJL_GET_INTEGER(key_obj);
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Object had %" PRIuHSIZE "attributes attached to it\n\n", obj_info->num_attrs);
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object had %" PRIuHSIZE "attributes attached to it",
+                 obj_info->num_attrs);
 
     /* Retrieve the object's class */
     switch (object_id[0]) {
@@ -1209,9 +1294,8 @@ RV_object_iter_callback(char *HTTP_response, const void *callback_data_in, void
     char                URL[URL_MAX_LENGTH];
     const char         *path_name = NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Iterating recursively through objects according to server's HTTP response\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                 "Iterating recursively through objects according to server's HTTP response");
 
     if (!HTTP_response)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "HTTP response buffer was NULL");
@@ -1251,9 +1335,7 @@ RV_object_iter_callback(char *HTTP_response, const void *callback_data_in, void
                                   visited_link_table) < 0)
             FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTBUILDLINKTABLE, FAIL, "can't build link table");
 
-#ifdef RV_CONNECTOR_DEBUG
-        printf("-> Object table sorted according to creation order\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Object table sorted according to creation order");
 
     } /* end if */
     else {
@@ -1346,9 +1428,8 @@ RV_build_object_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func
     if (is_recursive && !visited_link_table)
         FUNC_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "visited link hash table was NULL");
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Building table of objects %s\n\n", is_recursive ? "recursively" : "non-recursively");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Building table of objects %s",
+                 is_recursive ? "recursively" : "non-recursively");
 
     /* If this is a call to H5Ovisit, make a copy of the HTTP response since the
      * buffer that cURL writes to is currently global and will be changed when the
@@ -1564,7 +1645,7 @@ RV_build_object_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func
                     response_code = RV_curl_get(
                         curl, &object_iter_data->iter_obj_parent->domain->u.file.server_info,
                         request_endpoint, object_iter_data->iter_obj_parent->domain->u.file.filepath_name,
-                        CONTENT_TYPE_JSON);
+                        CONTENT_TYPE_JSON, "H5Ovisit");
 
                     if (!(HTTP_SUCCESS(response_code)))
                         FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get object: HTTP %ld",
@@ -1609,11 +1690,9 @@ RV_build_object_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func
                     }
 
                 } /* end if */
-#ifdef RV_CONNECTOR_DEBUG
                 else {
-                    printf("-> Cyclic link detected; not following into subgroup\n\n");
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Cyclic link detected; not following into subgroup");
                 } /* end else */
-#endif
             } /* end if */
         }     /* end if */
 
@@ -1621,9 +1700,7 @@ RV_build_object_table(char *HTTP_response, hbool_t is_recursive, int (*sort_func
         link_section_start = link_section_end + 1;
     } /* end for */
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("-> Link table built\n\n");
-#endif
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link table built");
 
     if (sort_func)
         qsort(table, num_links, sizeof(*table), sort_func);
@@ -1706,18 +1783,16 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
     switch (object_iter_data->iter_order) {
         case H5_ITER_NATIVE:
         case H5_ITER_INC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in increasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Beginning iteration in increasing order");
 
             for (last_idx = (object_iter_data->idx_p ? *object_iter_data->idx_p : 0); last_idx < num_entries;
                  last_idx++) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link %zu name: %s\n", last_idx, object_table[last_idx].link_name);
-                printf("-> Link %zu creation time: %f\n", last_idx, object_table[last_idx].crt_time);
-                printf("-> Link %zu type: %s\n\n", last_idx,
-                       link_class_to_string(object_table[last_idx].link_info.type));
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu name: %s", last_idx,
+                             object_table[last_idx].link_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu creation time: %f", last_idx,
+                             object_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu type: %s", last_idx,
+                             link_class_to_string(object_table[last_idx].link_info.type));
 
                 /* Form the link's relative path from the parent group by combining the current relative path
                  * with the link's name */
@@ -1731,10 +1806,9 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL,
                                     "link's relative path string size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Calling supplied callback function with relative link path %s\n\n",
-                       object_rel_path);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                             "Calling supplied callback function with relative link path %s",
+                             object_rel_path);
 
                 /* If object is an unvisited hard link, execute callback and add to visited table. */
                 if ((object_table[last_idx].link_info.type == H5L_TYPE_HARD) &&
@@ -1770,9 +1844,8 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
 
                 /* If this is a group and H5Ovisit has been called, descend into the group */
                 if (object_table[last_idx].subgroup.subgroup_object_table) {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Descending into subgroup '%s'\n\n", object_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Descending into subgroup '%s'",
+                                 object_table[last_idx].link_name);
 
                     depth++;
                     if (RV_traverse_object_table(object_table[last_idx].subgroup.subgroup_object_table,
@@ -1784,9 +1857,8 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                                         object_table[last_idx].link_name);
                     depth--;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Exiting subgroup '%s'\n\n", object_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Exiting subgroup '%s'",
+                                 object_table[last_idx].link_name);
                 } /* end if */
                 else {
                     char *last_slash = strrchr(object_rel_path, '/');
@@ -1796,10 +1868,9 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                     if (last_slash)
                         *last_slash = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Relative link path after truncating trailing link name: %s\n\n",
-                           object_rel_path);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                                 "Relative link path after truncating trailing link name: %s",
+                                 object_rel_path);
                 } /* end else */
             }     /* end for */
 
@@ -1807,18 +1878,16 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
         } /* H5_ITER_NATIVE H5_ITER_INC */
 
         case H5_ITER_DEC: {
-#ifdef RV_CONNECTOR_DEBUG
-            printf("-> Beginning iteration in decreasing order\n\n");
-#endif
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Beginning iteration in decreasing order");
 
             for (last_idx = (object_iter_data->idx_p ? *object_iter_data->idx_p : num_entries - 1);
                  last_idx >= 0; last_idx--) {
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Link %zu name: %s\n", last_idx, object_table[last_idx].link_name);
-                printf("-> Link %zu creation time: %f\n", last_idx, object_table[last_idx].crt_time);
-                printf("-> Link %zu type: %s\n\n", last_idx,
-                       link_class_to_string(object_table[last_idx].link_info.type));
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu name: %s", last_idx,
+                             object_table[last_idx].link_name);
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu creation time: %f", last_idx,
+                             object_table[last_idx].crt_time);
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link %zu type: %s", last_idx,
+                             link_class_to_string(object_table[last_idx].link_info.type));
 
                 /* Form the link's relative path from the parent group by combining the current relative path
                  * with the link's name */
@@ -1832,10 +1901,9 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                     FUNC_GOTO_ERROR(H5E_LINK, H5E_SYSERRSTR, FAIL,
                                     "link's relative path string size exceeded allocated buffer size");
 
-#ifdef RV_CONNECTOR_DEBUG
-                printf("-> Calling supplied callback function with relative link path %s\n\n",
-                       object_rel_path);
-#endif
+                RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                             "Calling supplied callback function with relative link path %s",
+                             object_rel_path);
 
                 /* If object is an unvisited hard link, execute callback and add to visited table. */
                 if ((object_table[last_idx].link_info.type == H5L_TYPE_HARD) &&
@@ -1871,9 +1939,8 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
 
                 /* If this is a group and H5Ovisit has been called, descend into the group */
                 if (object_table[last_idx].subgroup.subgroup_object_table) {
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Descending into subgroup '%s'\n\n", object_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Descending into subgroup '%s'",
+                                 object_table[last_idx].link_name);
 
                     depth++;
                     if (RV_traverse_object_table(object_table[last_idx].subgroup.subgroup_object_table,
@@ -1885,9 +1952,8 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                                         object_table[last_idx].link_name);
                     depth--;
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Exiting subgroup '%s'\n\n", object_table[last_idx].link_name);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Exiting subgroup '%s'",
+                                 object_table[last_idx].link_name);
                 } /* end if */
                 else {
                     char *last_slash = strrchr(object_rel_path, '/');
@@ -1897,10 +1963,9 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
                     if (last_slash)
                         *last_slash = '\0';
 
-#ifdef RV_CONNECTOR_DEBUG
-                    printf("-> Relative link path after truncating trailing link name: %s\n\n",
-                           object_rel_path);
-#endif
+                    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT,
+                                 "Relative link path after truncating trailing link name: %s",
+                                 object_rel_path);
                 } /* end else */
 
                 if (last_idx == 0)
@@ -1916,10 +1981,8 @@ RV_traverse_object_table(object_table_entry *object_table, rv_hash_table_t *visi
             FUNC_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "unknown link iteration order");
     } /* end switch */
 
-#ifdef RV_CONNECTOR_DEBUG
     if (depth == 0)
-        printf("-> Link iteration finished\n\n");
-#endif
+        RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Link iteration finished");
 
 done:
     /* Keep track of the last index where we left off */
@@ -1931,3 +1994,747 @@ done:
 
     return ret_value;
 } /* end RV_traverse_object_table */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_object
+ *
+ * Purpose:     Copies an opened group, dataset or committed datatype
+ *              into dst_parent under the given name, for H5Ocopy. An
+ *              object which has already been copied is linked to again
+ *              instead. The copy is added to the table of copied
+ *              objects, which closes it once the whole copy is done.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_object_copy_object(RV_object_t *src, RV_object_t *dst_parent, const char *dst_name, unsigned depth,
+                      object_copy_info_t *copy_info)
+{
+    H5VL_link_create_args_t link_args;
+    H5VL_loc_params_t       dst_loc_params;
+    rv_hash_table_value_t   copied;
+    RV_object_t            *copy         = NULL;
+    hbool_t                 attrs_copied = FALSE;
+    hbool_t                 recorded     = FALSE;
+    char                   *src_URI      = NULL;
+    herr_t                  ret_value    = SUCCEED;
+
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Copying object %s to '%s' in %s", src->URI, dst_name, dst_parent->URI);
+
+    dst_loc_params.type     = H5VL_OBJECT_BY_SELF;
+    dst_loc_params.obj_type = dst_parent->obj_type;
+
+    if (RV_HASH_TABLE_NULL != (copied = rv_hash_table_lookup(copy_info->copied_objects, src->URI))) {
+        dst_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+        dst_loc_params.loc_data.loc_by_name.name    = dst_name;
+        dst_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+
+        link_args.op_type                            = H5VL_LINK_CREATE_HARD;
+        link_args.args.hard.curr_obj                 = copied;
+        link_args.args.hard.curr_loc_params.type     = H5VL_OBJECT_BY_SELF;
+        link_args.args.hard.curr_loc_params.obj_type = ((RV_object_t *)copied)->obj_type;
+
+        if (RV_link_create(&link_args, dst_parent, &dst_loc_params, copy_info->lcpl_id,
+                           H5P_LINK_ACCESS_DEFAULT, copy_info->dxpl_id, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCREATE, FAIL, "can't link to object which was already copied");
+
+        FUNC_GOTO_DONE(SUCCEED);
+    }
+
+    switch (src->obj_type) {
+        case H5I_DATASET:
+            if (NULL == (copy = RV_object_copy_dataset(src, dst_parent, dst_name, copy_info, &attrs_copied)))
+                FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataset");
+            break;
+
+        case H5I_FILE:
+        case H5I_GROUP:
+            if (NULL == (copy = RV_group_create(dst_parent, &dst_loc_params, dst_name, copy_info->lcpl_id,
+                                                src->u.group.gcpl_id, H5P_GROUP_ACCESS_DEFAULT,
+                                                copy_info->dxpl_id, NULL)))
+                FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create copy of group");
+            break;
+
+        case H5I_DATATYPE:
+            if (NULL == (copy = RV_datatype_commit(dst_parent, &dst_loc_params, dst_name,
+                                                   src->u.datatype.dtype_id, copy_info->lcpl_id,
+                                                   src->u.datatype.tcpl_id, H5P_DATATYPE_ACCESS_DEFAULT,
+                                                   copy_info->dxpl_id, NULL)))
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCREATE, FAIL, "can't commit copy of datatype");
+            break;
+
+        default:
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_BADTYPE, FAIL,
+                            "object to copy is not a group, dataset or datatype");
+    } /* end switch */
+
+    /* Record the copy before copying anything under it, so that links back up to it are linked again */
+    if (NULL == (src_URI = RV_malloc(strlen(src->URI) + 1)))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTALLOC, FAIL, "can't allocate space for copied object's URI");
+
+    strcpy(src_URI, src->URI);
+
+    if (!rv_hash_table_insert(copy_info->copied_objects, src_URI, copy))
+        FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTINSERT, FAIL, "can't add object to table of copied objects");
+
+    src_URI  = NULL;
+    recorded = TRUE;
+
+    if (!(copy_info->flags & H5O_COPY_WITHOUT_ATTR_FLAG) && !attrs_copied)
+        if (RV_object_copy_attributes(src, copy, copy_info->dxpl_id) < 0)
+            FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, FAIL, "can't copy attributes of object");
+
+    /* A shallow copy only copies the members of the group which was copied, not their members */
+    if (H5I_DATASET != src->obj_type && H5I_DATATYPE != src->obj_type &&
+        (depth == 0 || !(copy_info->flags & H5O_COPY_SHALLOW_HIERARCHY_FLAG)))
+        if (RV_object_copy_links(src, copy, depth, copy_info) < 0)
+            FUNC_GOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy members of group");
+
+done:
+    if (src_URI)
+        RV_free(src_URI);
+
+    /* Close a copy which couldn't be added to the table */
+    if (copy && !recorded && RV_object_copy_close(copy) < 0)
+        FUNC_DONE_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close copied object");
+
+    return ret_value;
+} /* end RV_object_copy_object() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_dataset
+ *
+ * Purpose:     Copies a dataset into dst_parent under the given name,
+ *              having the server copy it if it can. Otherwise, a dataset
+ *              with the same datatype, dataspace and creation properties
+ *              is created and the data is copied through the client.
+ *
+ *              attrs_copied is set when the server copied the dataset's
+ *              attributes along with it.
+ *
+ * Return:      The copy of the dataset on success/NULL on failure
+ */
+static RV_object_t *
+RV_object_copy_dataset(RV_object_t *src, RV_object_t *dst_parent, const char *dst_name,
+                       const object_copy_info_t *copy_info, hbool_t *attrs_copied)
+{
+    H5VL_loc_params_t dst_loc_params;
+    RV_object_t      *copy = NULL;
+    htri_t            copied;
+    RV_object_t      *ret_value = NULL;
+
+    *attrs_copied = FALSE;
+
+    /* The server copies attributes along with the dataset, so it can't be used to leave them behind */
+    if (!(copy_info->flags & H5O_COPY_WITHOUT_ATTR_FLAG) &&
+        !strcmp(src->domain->u.file.filepath_name, dst_parent->domain->u.file.filepath_name)) {
+        if ((copied = RV_object_copy_dataset_on_server(src, dst_parent, dst_name, copy_info, &copy)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy dataset on server");
+
+        if (copied) {
+            RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Server copied dataset %s to %s", src->URI, copy->URI);
+
+            *attrs_copied = TRUE;
+            FUNC_GOTO_DONE(copy);
+        }
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Copying data of dataset %s through the client", src->URI);
+
+    dst_loc_params.type     = H5VL_OBJECT_BY_SELF;
+    dst_loc_params.obj_type = dst_parent->obj_type;
+
+    if (NULL == (copy = RV_dataset_create(dst_parent, &dst_loc_params, dst_name, copy_info->lcpl_id,
+                                          src->u.dataset.dtype_id, src->u.dataset.space_id,
+                                          src->u.dataset.dcpl_id, H5P_DATASET_ACCESS_DEFAULT,
+                                          copy_info->dxpl_id, NULL)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "can't create copy of dataset");
+
+    if (RV_object_copy_dataset_data(src, copy, copy_info->dxpl_id) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy data of dataset");
+
+    ret_value = copy;
+
+done:
+    if (copy && !ret_value)
+        if (RV_dataset_close(copy, H5P_DEFAULT, NULL) < 0)
+            FUNC_DONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, NULL, "can't close copy of dataset");
+
+    return ret_value;
+} /* end RV_object_copy_dataset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_dataset_on_server
+ *
+ * Purpose:     Asks the server to create a dataset in dst_parent under
+ *              the given name as a copy of another dataset in the same
+ *              domain, by naming the dataset to copy in place of the
+ *              new dataset's datatype and shape. A server which can't
+ *              copy datasets rejects the request.
+ *
+ * Return:      TRUE if the server copied the dataset, FALSE if it
+ *              can't/Negative on failure
+ */
+static htri_t
+RV_object_copy_dataset_on_server(RV_object_t *src, RV_object_t *dst_parent, const char *dst_name,
+                                 const object_copy_info_t *copy_info, RV_object_t **copy)
+{
+    const char *const request_body_format = "{\"copy\": \"%s\", "
+                                            "\"link\": {\"id\": \"%s\", \"name\": \"%s\"}}";
+    H5VL_loc_params_t dst_loc_params;
+    size_t            escaped_name_size   = 0;
+    size_t            request_body_nalloc = 0;
+    char             *path_dirname        = NULL;
+    char             *escaped_name        = NULL;
+    char             *request_body        = NULL;
+    char              parent_URI[URI_MAX_LENGTH];
+    int               request_body_len = 0;
+    long              http_response;
+    htri_t            ret_value = TRUE;
+
+    /* The server copies the data it has, so send any writes held back in write-back buffers first */
+    if (RV_dataset_flush_write_buffers(src->domain) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't send buffered writes to dataset");
+
+    if (NULL == (path_dirname = H5_rest_dirname(dst_name)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid pathname for dataset link");
+
+    if (!strcmp(path_dirname, ""))
+        strncpy(parent_URI, dst_parent->URI, URI_MAX_LENGTH);
+    else {
+        H5I_type_t obj_type = H5I_GROUP;
+        htri_t     search_ret;
+
+        search_ret = RV_find_object_by_path(dst_parent, path_dirname, &obj_type, RV_copy_object_URI_callback,
+                                            NULL, parent_URI);
+        if (!search_ret || search_ret < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_PATH, FAIL, "can't locate target for dataset link");
+    }
+
+    if (RV_JSON_escape_string(H5_rest_basename(dst_name), escaped_name, &escaped_name_size) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't get length of JSON escaped link name");
+
+    if (NULL == (escaped_name = RV_malloc(escaped_name_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for escaped link name");
+
+    if (RV_JSON_escape_string(H5_rest_basename(dst_name), escaped_name, &escaped_name_size) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't JSON escape link name");
+
+    request_body_nalloc =
+        strlen(request_body_format) + strlen(src->URI) + strlen(parent_URI) + strlen(escaped_name) + 1;
+
+    if (NULL == (request_body = RV_malloc(request_body_nalloc)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                        "can't allocate space for dataset copy request body");
+
+    if ((request_body_len = snprintf(request_body, request_body_nalloc, request_body_format, src->URI,
+                                     parent_URI, escaped_name)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL, "snprintf error");
+
+    if ((size_t)request_body_len >= request_body_nalloc)
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_SYSERRSTR, FAIL,
+                        "dataset copy request body size exceeded allocated buffer size");
+
+    http_response = RV_curl_post(curl, &dst_parent->domain->u.file.server_info, "/datasets",
+                                 dst_parent->domain->u.file.filepath_name, request_body,
+                                 (size_t)request_body_len, CONTENT_TYPE_JSON, "H5Ocopy");
+
+    /* A server which can't copy datasets rejects the request for its missing datatype and shape */
+    if (400 == http_response || 501 == http_response)
+        FUNC_GOTO_DONE(FALSE);
+
+    if (!HTTP_SUCCESS(http_response))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataset, response HTTP %ld",
+                        http_response);
+
+    dst_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    dst_loc_params.obj_type                     = dst_parent->obj_type;
+    dst_loc_params.loc_data.loc_by_name.name    = dst_name;
+    dst_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+
+    if (NULL == (*copy = RV_dataset_open(dst_parent, &dst_loc_params, dst_name, H5P_DATASET_ACCESS_DEFAULT,
+                                         copy_info->dxpl_id, NULL)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't open copy of dataset");
+
+done:
+    if (path_dirname)
+        RV_free(path_dirname);
+    if (escaped_name)
+        RV_free(escaped_name);
+    if (request_body)
+        RV_free(request_body);
+
+    return ret_value;
+} /* end RV_object_copy_dataset_on_server() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_dataset_data
+ *
+ * Purpose:     Copies the data of one dataset into another with the same
+ *              datatype and dataspace, one block at a time. Each block
+ *              is a whole number of chunks of a chunked dataset, or rows
+ *              of a contiguous one, and holds about
+ *              OBJECT_COPY_BLOCK_SIZE bytes. Blocks are read and then
+ *              written OBJECT_COPY_BATCH_COUNT at a time, through the
+ *              parallel transfers of RV_dataset_read/write.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_object_copy_dataset_data(RV_object_t *src, RV_object_t *dst, hid_t dxpl_id)
+{
+    void    *src_dsets[OBJECT_COPY_BATCH_COUNT];
+    void    *dst_dsets[OBJECT_COPY_BATCH_COUNT];
+    void    *bufs[OBJECT_COPY_BATCH_COUNT];
+    hid_t    mem_type_ids[OBJECT_COPY_BATCH_COUNT];
+    hid_t    mem_space_ids[OBJECT_COPY_BATCH_COUNT];
+    hid_t    file_space_ids[OBJECT_COPY_BATCH_COUNT];
+    hid_t    mem_type_id = src->u.dataset.dtype_id;
+    hsize_t  dims[H5S_MAX_RANK];
+    hsize_t  block[H5S_MAX_RANK];
+    hsize_t  num_blocks_per_dim[H5S_MAX_RANK];
+    hsize_t  block_idx[H5S_MAX_RANK];
+    hsize_t  start[H5S_MAX_RANK];
+    hsize_t  count[H5S_MAX_RANK];
+    hsize_t  block_nelems = 1;
+    hsize_t  num_blocks   = 1;
+    hsize_t  max_nelems;
+    hssize_t npoints;
+    htri_t   needs_reclaim;
+    hbool_t  batch_read  = FALSE;
+    size_t   batch_count = 0;
+    size_t   batch_nblocks;
+    size_t   type_size;
+    char    *data = NULL;
+    int      ndims;
+    herr_t   ret_value = SUCCEED;
+
+    if ((npoints = H5Sget_simple_extent_npoints(src->u.dataset.space_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of elements in dataspace");
+    if (npoints == 0)
+        FUNC_GOTO_DONE(SUCCEED);
+
+    if ((ndims = H5Sget_simple_extent_dims(src->u.dataset.space_id, dims, NULL)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+
+    /* Object references are read into and written from arrays of rv_obj_ref_t */
+    if (H5T_REFERENCE == H5Tget_class(src->u.dataset.dtype_id)) {
+        mem_type_id = H5T_STD_REF_OBJ;
+        type_size   = sizeof(rv_obj_ref_t);
+    }
+    else if (0 == (type_size = H5Tget_size(src->u.dataset.dtype_id)))
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get size of datatype");
+
+    if ((needs_reclaim = RV_object_copy_needs_reclaim(mem_type_id)) < 0)
+        FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for variable-length data");
+
+    if (0 == (max_nelems = OBJECT_COPY_BLOCK_SIZE / type_size))
+        max_nelems = 1;
+
+    for (int i = 0; i < ndims; i++)
+        block[i] = 1;
+
+    if (ndims > 0 && H5D_CHUNKED == H5Pget_layout(src->u.dataset.dcpl_id)) {
+        if (H5Pget_chunk(src->u.dataset.dcpl_id, ndims, block) != ndims)
+            FUNC_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get dataset's chunk dimensions");
+
+        for (int i = 0; i < ndims; i++) {
+            if (block[i] > dims[i])
+                block[i] = dims[i];
+            block_nelems *= block[i];
+        }
+
+        /* Cover as many chunks along the first dimension as fit */
+        if (block_nelems < max_nelems) {
+            block[0] *= max_nelems / block_nelems;
+            if (block[0] > dims[0])
+                block[0] = dims[0];
+        }
+    }
+    else {
+        /* Take whole extents of the fastest-changing dimensions first, so that each block is contiguous */
+        for (int i = ndims - 1; i >= 0; i--) {
+            if (block_nelems * dims[i] > max_nelems) {
+                block[i] = max_nelems / block_nelems ? max_nelems / block_nelems : 1;
+                break;
+            }
+
+            block[i] = dims[i];
+            block_nelems *= dims[i];
+        }
+    }
+
+    block_nelems = 1;
+    for (int i = 0; i < ndims; i++) {
+        num_blocks_per_dim[i] = (dims[i] + block[i] - 1) / block[i];
+        block_idx[i]          = 0;
+        block_nelems *= block[i];
+        num_blocks *= num_blocks_per_dim[i];
+    }
+
+    RV_LOG_DEBUG(RV_LOG_CAT_OBJECT, "Copying dataset in %" PRIuHSIZE " blocks of %" PRIuHSIZE " elements",
+                 num_blocks, block_nelems);
+
+    batch_nblocks = (num_blocks < OBJECT_COPY_BATCH_COUNT) ? (size_t)num_blocks : OBJECT_COPY_BATCH_COUNT;
+
+    if (NULL == (data = RV_calloc(batch_nblocks * (size_t)block_nelems * type_size)))
+        FUNC_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset copy buffer");
+
+    for (hsize_t block_num = 0; block_num < num_blocks; block_num++) {
+        size_t j = batch_count;
+
+        file_space_ids[j] = H5I_INVALID_HID;
+        mem_space_ids[j]  = H5I_INVALID_HID;
+        batch_count++;
+
+        for (int i = 0; i < ndims; i++) {
+            start[i] = block_idx[i] * block[i];
+            count[i] = (dims[i] - start[i] < block[i]) ? dims[i] - start[i] : block[i];
+        }
+
+        if ((file_space_ids[j] = H5Scopy(src->u.dataset.space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataset's dataspace");
+
+        if (ndims > 0) {
+            if (H5Sselect_hyperslab(file_space_ids[j], H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select block of dataset");
+
+            mem_space_ids[j] = H5Screate_simple(ndims, count, NULL);
+        }
+        else if (H5Sselect_all(file_space_ids[j]) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select dataset's element");
+        else
+            mem_space_ids[j] = H5Screate(H5S_SCALAR);
+
+        if (mem_space_ids[j] < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create memory dataspace");
+
+        src_dsets[j]    = src;
+        dst_dsets[j]    = dst;
+        mem_type_ids[j] = mem_type_id;
+        bufs[j]         = data + j * (size_t)block_nelems * type_size;
+
+        /* Move on to the next block in row-major order */
+        for (int i = ndims - 1; i >= 0; i--) {
+            if (++block_idx[i] < num_blocks_per_dim[i])
+                break;
+            block_idx[i] = 0;
+        }
+
+        if (batch_count < OBJECT_COPY_BATCH_COUNT && block_num + 1 < num_blocks)
+            continue;
+
+        if (RV_dataset_read(batch_count, src_dsets, mem_type_ids, mem_space_ids, file_space_ids, dxpl_id,
+                            bufs, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read from dataset");
+
+        batch_read = TRUE;
+
+        if (RV_dataset_write(batch_count, dst_dsets, mem_type_ids, mem_space_ids, file_space_ids, dxpl_id,
+                             (const void **)bufs, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write to copy of dataset");
+
+        for (j = 0; j < batch_count; j++) {
+            if (needs_reclaim && H5Treclaim(mem_type_id, mem_space_ids[j], H5P_DEFAULT, bufs[j]) < 0)
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "can't free variable-length data");
+            if (H5Sclose(mem_space_ids[j]) < 0 || H5Sclose(file_space_ids[j]) < 0)
+                FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close dataspace");
+
+            mem_space_ids[j]  = H5I_INVALID_HID;
+            file_space_ids[j] = H5I_INVALID_HID;
+        }
+
+        batch_read  = FALSE;
+        batch_count = 0;
+    }
+
+done:
+    for (size_t j = 0; j < batch_count; j++) {
+        if (batch_read && needs_reclaim > 0 && mem_space_ids[j] >= 0 &&
+            H5Treclaim(mem_type_id, mem_space_ids[j], H5P_DEFAULT, bufs[j]) < 0)
+            FUNC_DONE_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "can't free variable-length data");
+        if (mem_space_ids[j] >= 0 && H5Sclose(mem_space_ids[j]) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close memory dataspace");
+        if (file_space_ids[j] >= 0 && H5Sclose(file_space_ids[j]) < 0)
+            FUNC_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close file dataspace");
+    }
+
+    if (data)
+        RV_free(data);
+
+    return ret_value;
+} /* end RV_object_copy_dataset_data() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_attributes
+ *
+ * Purpose:     Copies each attribute of one object to another, in the
+ *              same way as H5Arename copies an attribute to its new
+ *              name.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_object_copy_attributes(RV_object_t *src, RV_object_t *dst, hid_t dxpl_id)
+{
+    H5VL_attr_specific_args_t iter_args;
+    H5VL_loc_params_t         src_loc_params;
+    H5VL_loc_params_t         dst_loc_params;
+    object_copy_names_t       names    = {NULL, NULL, 0, 0};
+    RV_object_t              *attr     = NULL;
+    RV_object_t              *new_attr = NULL;
+    hssize_t                  num_elems;
+    hsize_t                   idx = 0;
+    htri_t                    needs_reclaim;
+    hbool_t                   attr_read = FALSE;
+    size_t                    elem_size;
+    void                     *buf       = NULL;
+    herr_t                    ret_value = SUCCEED;
+
+    src_loc_params.type     = H5VL_OBJECT_BY_SELF;
+    src_loc_params.obj_type = src->obj_type;
+    dst_loc_params.type     = H5VL_OBJECT_BY_SELF;
+    dst_loc_params.obj_type = dst->obj_type;
+
+    iter_args.op_type               = H5VL_ATTR_ITER;
+    iter_args.args.iterate.idx_type = H5_INDEX_NAME;
+    iter_args.args.iterate.order    = H5_ITER_INC;
+    iter_args.args.iterate.idx      = &idx;
+    iter_args.args.iterate.op       = RV_object_copy_attr_name_cb;
+    iter_args.args.iterate.op_data  = &names;
+
+    if (RV_attr_specific(src, &src_loc_params, &iter_args, dxpl_id, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_ATTR, H5E_ATTRITERERROR, FAIL, "can't get names of object's attributes");
+
+    for (size_t i = 0; i < names.count; i++) {
+        if (NULL == (attr = RV_attr_open(src, &src_loc_params, names.names[i], H5P_ATTRIBUTE_ACCESS_DEFAULT,
+                                         dxpl_id, NULL)))
+            FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "can't open attribute '%s'", names.names[i]);
+
+        if (NULL == (new_attr = RV_attr_create(dst, &dst_loc_params, names.names[i],
+                                               attr->u.attribute.dtype_id, attr->u.attribute.space_id,
+                                               attr->u.attribute.acpl_id, attr->u.attribute.aapl_id, dxpl_id,
+                                               NULL)))
+            FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTCREATE, FAIL, "can't create copy of attribute '%s'",
+                            names.names[i]);
+
+        if ((num_elems = H5Sget_simple_extent_npoints(attr->u.attribute.space_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of elements in dataspace");
+
+        if (0 == (elem_size = H5Tget_size(attr->u.attribute.dtype_id)))
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get size of datatype");
+
+        if ((needs_reclaim = RV_object_copy_needs_reclaim(attr->u.attribute.dtype_id)) < 0)
+            FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for variable-length data");
+
+        if (num_elems > 0) {
+            if (NULL == (buf = RV_calloc((size_t)num_elems * elem_size)))
+                FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate space for attribute read");
+
+            if (RV_attr_read(attr, attr->u.attribute.dtype_id, buf, dxpl_id, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "can't read attribute '%s'", names.names[i]);
+
+            attr_read = needs_reclaim;
+
+            if (RV_attr_write(new_attr, attr->u.attribute.dtype_id, buf, dxpl_id, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL, "can't write to copy of attribute '%s'",
+                                names.names[i]);
+
+            if (attr_read && H5Treclaim(attr->u.attribute.dtype_id, attr->u.attribute.space_id, H5P_DEFAULT,
+                                        buf) < 0)
+                FUNC_GOTO_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "can't free variable-length data");
+
+            attr_read = FALSE;
+
+            RV_free(buf);
+            buf = NULL;
+        }
+
+        if (RV_attr_close(attr, H5P_DEFAULT, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close attribute");
+        attr = NULL;
+
+        if (RV_attr_close(new_attr, H5P_DEFAULT, NULL) < 0)
+            FUNC_GOTO_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close copy of attribute");
+        new_attr = NULL;
+    }
+
+done:
+    if (attr_read && H5Treclaim(attr->u.attribute.dtype_id, attr->u.attribute.space_id, H5P_DEFAULT, buf) < 0)
+        FUNC_DONE_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "can't free variable-length data");
+    if (buf)
+        RV_free(buf);
+
+    if (attr && RV_attr_close(attr, H5P_DEFAULT, NULL) < 0)
+        FUNC_DONE_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close attribute");
+    if (new_attr && RV_attr_close(new_attr, H5P_DEFAULT, NULL) < 0)
+        FUNC_DONE_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close copy of attribute");
+
+    RV_object_copy_free_names(&names);
+
+    return ret_value;
+} /* end RV_object_copy_attributes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_object_copy_links
+ *
+ * Purpose:     Copies each link in a group to its copy. The objects hard
+ *              links point to are copied in turn, while soft and external
+ *              links are copied as they are.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_object_copy_links(RV_object_t *src, RV_object_t *dst, unsigned depth, object_copy_info_t *copy_info)
+{
+    H5VL_link_specific_args_t iter_args;
+    H5VL_loc_params_t         src_loc_params;
+    H5VL_loc_params_t         dst_loc_params;
+    object_copy_names_t       names     = {NULL, NULL, 0, 0};
+    RV_object_t              *member    = NULL;
+    hsize_t                   idx       = 0;
+    herr_t                    ret_value = SUCCEED;
+
+    src_loc_params.type     = H5VL_OBJECT_BY_SELF;
+    src_loc_params.obj_type = src->obj_type;
+
+    iter_args.op_type                = H5VL_LINK_ITER;
+    iter_args.args.iterate.recursive = FALSE;
+    iter_args.args.iterate.idx_type  = H5_INDEX_NAME;
+    iter_args.args.iterate.order     = H5_ITER_INC;
+    iter_args.args.iterate.idx_p     = &idx;
+    iter_args.args.iterate.op        = RV_object_copy_link_name_cb;
+    iter_args.args.iterate.op_data   = &names;
+
+    if (RV_link_specific(src, &src_loc_params, &iter_args, copy_info->dxpl_id, NULL) < 0)
+        FUNC_GOTO_ERROR(H5E_LINK, H5E_LINKITERERROR, FAIL, "can't get links in group");
+
+    src_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    src_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+    dst_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    dst_loc_params.obj_type                     = dst->obj_type;
+    dst_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+
+    for (size_t i = 0; i < names.count; i++) {
+        src_loc_params.loc_data.loc_by_name.name = names.names[i];
+        dst_loc_params.loc_data.loc_by_name.name = names.names[i];
+
+        if (H5L_TYPE_HARD != names.link_types[i]) {
+            if (RV_link_copy(src, &src_loc_params, dst, &dst_loc_params, copy_info->lcpl_id,
+                             H5P_LINK_ACCESS_DEFAULT, copy_info->dxpl_id, NULL) < 0)
+                FUNC_GOTO_ERROR(H5E_LINK, H5E_CANTCOPY, FAIL, "can't copy link '%s'", names.names[i]);
+
+            continue;
+        }
+
+        if (NULL == (member = RV_object_open(src, &src_loc_params, NULL, copy_info->dxpl_id, NULL)))
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTOPENOBJ, FAIL, "can't open group member '%s'",
+                            names.names[i]);
+
+        if (RV_object_copy_object(member, dst, names.names[i], depth + 1, copy_info) < 0)
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, FAIL, "can't copy group member '%s'", names.names[i]);
+
+        if (RV_object_copy_close(member) < 0)
+            FUNC_GOTO_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close group member");
+        member = NULL;
+    }
+
+done:
+    if (member && RV_object_copy_close(member) < 0)
+        FUNC_DONE_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close group member");
+
+    RV_object_copy_free_names(&names);
+
+    return ret_value;
+} /* end RV_object_copy_links() */
+
+/* Helper to collect the name and type of each link in a group being copied */
+static herr_t
+RV_object_copy_link_name_cb(hid_t group, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    return RV_object_copy_add_name((object_copy_names_t *)op_data, name, info->type) < 0 ? H5_ITER_ERROR
+                                                                                         : H5_ITER_CONT;
+} /* end RV_object_copy_link_name_cb() */
+
+/* Helper to collect the name of each attribute of an object being copied */
+static herr_t
+RV_object_copy_attr_name_cb(hid_t location_id, const char *attr_name, const H5A_info_t *ainfo, void *op_data)
+{
+    return RV_object_copy_add_name((object_copy_names_t *)op_data, attr_name, H5L_TYPE_ERROR) < 0
+               ? H5_ITER_ERROR
+               : H5_ITER_CONT;
+} /* end RV_object_copy_attr_name_cb() */
+
+/* Helper to add a name, and the type of link it names, to a list of names */
+static herr_t
+RV_object_copy_add_name(object_copy_names_t *names, const char *name, H5L_type_t link_type)
+{
+    if (names->count == names->nalloc) {
+        size_t      nalloc    = names->nalloc ? 2 * names->nalloc : 16;
+        char      **new_names = NULL;
+        H5L_type_t *new_types = NULL;
+
+        if (NULL == (new_names = RV_realloc(names->names, nalloc * sizeof(*new_names))))
+            return FAIL;
+        names->names = new_names;
+
+        if (NULL == (new_types = RV_realloc(names->link_types, nalloc * sizeof(*new_types))))
+            return FAIL;
+        names->link_types = new_types;
+
+        names->nalloc = nalloc;
+    }
+
+    if (NULL == (names->names[names->count] = RV_malloc(strlen(name) + 1)))
+        return FAIL;
+
+    strcpy(names->names[names->count], name);
+    names->link_types[names->count++] = link_type;
+
+    return SUCCEED;
+} /* end RV_object_copy_add_name() */
+
+/* Helper to free a list of names */
+static void
+RV_object_copy_free_names(object_copy_names_t *names)
+{
+    for (size_t i = 0; i < names->count; i++)
+        RV_free(names->names[i]);
+
+    RV_free(names->names);
+    RV_free(names->link_types);
+} /* end RV_object_copy_free_names() */
+
+/* Helper to close a group, dataset or committed datatype opened or created by H5Ocopy */
+static herr_t
+RV_object_copy_close(RV_object_t *obj)
+{
+    switch (obj->obj_type) {
+        case H5I_DATASET:
+            return RV_dataset_close(obj, H5P_DEFAULT, NULL);
+        case H5I_DATATYPE:
+            return RV_datatype_close(obj, H5P_DEFAULT, NULL);
+        case H5I_FILE:
+        case H5I_GROUP:
+            return RV_group_close(obj, H5P_DEFAULT, NULL);
+        default:
+            return FAIL;
+    } /* end switch */
+} /* end RV_object_copy_close() */
+
+/* Helper to check whether data of a datatype must be freed with H5Treclaim() once it has been copied */
+static htri_t
+RV_object_copy_needs_reclaim(hid_t type_id)
+{
+    htri_t has_vlen;
+    htri_t has_string;
+
+    if ((has_vlen = H5Tdetect_class(type_id, H5T_VLEN)) != FALSE)
+        return has_vlen;
+
+    /* Variable-length strings are found with the fixed-length ones, which H5Treclaim() leaves alone */
+    if ((has_string = H5Tdetect_class(type_id, H5T_STRING)) != FALSE)
+        return has_string;
+
+    return FALSE;
+} /* end RV_object_copy_needs_reclaim() */
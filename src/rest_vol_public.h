@@ -75,6 +75,45 @@ typedef struct rv_obj_ref_t {
     char       ref_obj_URI[URI_MAX_LENGTH];
 } rv_obj_ref_t;
 
+/* Types of request counted in the connector's request metrics. Requests
+ * which transfer dataset data are counted separately from the other
+ * requests made with the same HTTP method. */
+typedef enum H5rest_op_type_t {
+    H5REST_OP_GET = 0,
+    H5REST_OP_PUT,
+    H5REST_OP_POST,
+    H5REST_OP_DELETE,
+    H5REST_OP_DATASET_READ,
+    H5REST_OP_DATASET_WRITE,
+    H5REST_NUM_OP_TYPES
+} H5rest_op_type_t;
+
+/* Request latencies are counted in a log-linear histogram: each power of two
+ * microseconds is split into H5REST_LATENCY_SUB_BUCKETS buckets, so that a
+ * latency is known to within 12.5% of its value. Latencies of 2^36
+ * microseconds or more are counted in the last bucket. */
+#define H5REST_LATENCY_SUB_BUCKETS 8
+#define H5REST_LATENCY_NUM_BUCKETS 272
+
+/* Request metrics for one type of request */
+typedef struct H5rest_op_stats_t {
+    uint64_t requests;       /* Requests completed, including those which were retried */
+    uint64_t bytes_sent;     /* Bytes sent in request bodies */
+    uint64_t bytes_received; /* Bytes received in response bodies */
+    uint64_t responses_2xx;
+    uint64_t responses_4xx;
+    uint64_t responses_5xx;
+    uint64_t retries;      /* Requests retried after a 503 response */
+    uint64_t backoff_usec; /* Time spent backing off before retrying */
+    uint64_t latency_total_usec;
+    uint64_t latency_max_usec;
+    uint64_t latency_histogram[H5REST_LATENCY_NUM_BUCKETS];
+} H5rest_op_stats_t;
+
+typedef struct H5rest_stats_t {
+    H5rest_op_stats_t op[H5REST_NUM_OP_TYPES];
+} H5rest_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -82,7 +121,42 @@ extern "C" {
 H5PLUGIN_DLL herr_t      H5rest_init(void);
 H5PLUGIN_DLL herr_t      H5rest_term(void);
 H5PLUGIN_DLL herr_t      H5Pset_fapl_rest_vol(hid_t fapl_id);
+H5PLUGIN_DLL herr_t      H5Pset_fapl_rest_deferred_create(hid_t fapl_id, hbool_t deferred_create);
+H5PLUGIN_DLL herr_t      H5Pget_fapl_rest_deferred_create(hid_t fapl_id, hbool_t *deferred_create);
+H5PLUGIN_DLL herr_t      H5Pset_fapl_rest_storage_size_max_age(hid_t fapl_id, double max_age);
+H5PLUGIN_DLL herr_t      H5Pget_fapl_rest_storage_size_max_age(hid_t fapl_id, double *max_age);
+H5PLUGIN_DLL herr_t      H5Pset_dapl_rest_write_buffer(hid_t dapl_id, size_t buffer_size);
+H5PLUGIN_DLL herr_t      H5Pget_dapl_rest_write_buffer(hid_t dapl_id, size_t *buffer_size);
+H5PLUGIN_DLL herr_t      H5Pset_dapl_rest_read_ahead(hid_t dapl_id, unsigned depth, size_t max_size);
+H5PLUGIN_DLL herr_t      H5Pget_dapl_rest_read_ahead(hid_t dapl_id, unsigned *depth, size_t *max_size);
+H5PLUGIN_DLL herr_t      H5rest_dataset_append(hid_t dset_id, hid_t dxpl_id, unsigned axis, size_t extension,
+                                               hid_t mem_type_id, const void *buf);
+H5PLUGIN_DLL herr_t      H5rest_dataset_read_batch(hid_t dset_id, size_t count, hid_t mem_type_id,
+                                                   const hid_t mem_space_ids[], const hid_t file_space_ids[],
+                                                   hid_t dxpl_id, void *bufs[]);
+H5PLUGIN_DLL herr_t      H5rest_dataset_read_selections(hid_t dset_id, size_t count, hid_t mem_type_id,
+                                                        const hid_t mem_space_ids[],
+                                                        const hid_t file_space_ids[], hid_t dxpl_id,
+                                                        void *bufs[]);
+H5PLUGIN_DLL herr_t      H5rest_dataset_write_selections(hid_t dset_id, size_t count, hid_t mem_type_id,
+                                                         const hid_t mem_space_ids[],
+                                                         const hid_t file_space_ids[], hid_t dxpl_id,
+                                                         const void *bufs[]);
+H5PLUGIN_DLL herr_t      H5rest_dataset_read_chunks(hid_t dset_id, size_t count, const hsize_t *offsets[],
+                                                    uint32_t filter_masks[], size_t buf_sizes[],
+                                                    void *bufs[]);
+H5PLUGIN_DLL herr_t      H5rest_dataset_write_chunks(hid_t dset_id, size_t count, const hsize_t *offsets[],
+                                                     const uint32_t filter_masks[], const size_t sizes[],
+                                                     const void *bufs[]);
+H5PLUGIN_DLL herr_t      H5rest_dataset_query(hid_t dset_id, const char *query, hsize_t start,
+                                              size_t max_rows, hid_t mem_type_id, size_t *num_rows,
+                                              hsize_t indices[], void *buf);
+H5PLUGIN_DLL herr_t      H5rest_get_storage_sizes(hid_t file_id, size_t count, const hid_t dset_ids[],
+                                                  hsize_t sizes[]);
 H5PLUGIN_DLL const char *H5rest_get_object_uri(hid_t);
+H5PLUGIN_DLL herr_t      H5rest_get_stats(H5rest_stats_t *stats);
+H5PLUGIN_DLL herr_t      H5rest_reset_stats(void);
+H5PLUGIN_DLL uint64_t    H5rest_get_latency_percentile(const H5rest_op_stats_t *op_stats, double percentile);
 
 #ifdef __cplusplus
 }
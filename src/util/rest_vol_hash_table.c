@@ -18,74 +18,317 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
  */
 
-/* Hash table implementation */
-
+/* Hash table implementation
+ *
+ * This is an open-addressing table in the style of SwissTable. Entries are
+ * stored inline in a single array of slots, with no per-entry allocation.
+ * Alongside the slots is an array of one-byte control words, one per slot,
+ * which record whether the slot is empty, deleted, or full and, for full
+ * slots, 7 bits of the entry's hash.
+ *
+ * The slots are divided into groups of RV_HASH_TABLE_GROUP_WIDTH. A key's
+ * hash selects the group where probing starts, and each step of the probe
+ * compares the key's 7 hash bits against the control words of a whole group
+ * at once, with SSE2 where available or with 64-bit word operations
+ * otherwise. Only slots whose control word matches are compared in full,
+ * using the hash stored in the slot before calling the table's equality
+ * function. Probing stops at the first group containing an empty slot.
+ *
+ * The full hash of each key is kept in its slot, so growing the table never
+ * calls the table's hash function again. */
+
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RV_HASH_TABLE_USE_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #include "util/rest_vol_hash_table.h"
 
+#ifdef RV_HASH_TABLE_USE_SSE2
+#define RV_HASH_TABLE_GROUP_WIDTH 16
+typedef uint32_t rv_hash_table_mask_t;
+#else
+#define RV_HASH_TABLE_GROUP_WIDTH 8
+typedef uint64_t rv_hash_table_mask_t;
+#endif
+
+/* Control word values. Full slots hold the low 7 bits of the
+ * entry's hash, so have the high bit clear. */
+
+#define CTRL_EMPTY   ((unsigned char)0x80)
+#define CTRL_DELETED ((unsigned char)0xFE)
+
+#define CTRL_IS_FULL(ctrl) (((ctrl)&0x80) == 0)
+
+/* Number of slots in a newly created table */
+
+#define HASH_TABLE_INITIAL_CAPACITY 32
+
+/* The table is enlarged once more than 7/8 of its slots are in use */
+
+#define HASH_TABLE_MAX_LOAD(capacity) ((capacity) - (capacity) / 8)
+
 struct rv_hash_table_entry {
-    rv_hash_table_key_t    key;
-    rv_hash_table_value_t  value;
-    rv_hash_table_entry_t *next;
+    rv_hash_table_key_t   key;
+    rv_hash_table_value_t value;
+    unsigned int          hash;
 };
 
 struct rv_hash_table {
-    rv_hash_table_entry_t         **table;
-    unsigned int                    table_size;
+    unsigned char                  *ctrl;
+    rv_hash_table_entry_t          *slots;
+    size_t                          capacity;
+    size_t                          growth_left;
     rv_hash_table_hash_func_t       hash_func;
     rv_hash_table_equal_func_t      equal_func;
     rv_hash_table_key_free_func_t   key_free_func;
     rv_hash_table_value_free_func_t value_free_func;
     unsigned int                    entries;
-    unsigned int                    prime_index;
 };
 
-/* This is a set of good hash table prime numbers, from:
- *   http://planetmath.org/goodhashtableprimes
- * Each prime is roughly double the previous value, and as far as
- * possible from the nearest powers of two. */
+/* Mix the hash returned by the table's hash function, so that the
+ * bits used to select a group and the 7 bits kept in the control
+ * word are both well distributed, even for weak hash functions */
 
-static const unsigned int hash_table_primes[] = {
-    193,      389,      769,      1543,      3079,      6151,      12289,     24593,
-    49157,    98317,    196613,   393241,    786433,    1572869,   3145739,   6291469,
-    12582917, 25165843, 50331653, 100663319, 201326611, 402653189, 805306457, 1610612741,
-};
+static uint64_t
+hash_table_mix(unsigned int hash)
+{
+    uint64_t mixed = (uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15);
+
+    return mixed ^ (mixed >> 32);
+}
+
+#define HASH_H1(mixed) ((size_t)((mixed) >> 7))
+#define HASH_H2(mixed) ((unsigned char)((mixed)&0x7F))
+
+/* Group matching functions. Each returns a mask with one bit set for
+ * each slot in the group matching the condition; the slot index for
+ * each set bit is found with hash_table_mask_next. */
+
+#ifdef RV_HASH_TABLE_USE_SSE2
+
+static rv_hash_table_mask_t
+hash_table_group_match(const unsigned char *group, unsigned char h2)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+    return (rv_hash_table_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+}
+
+static rv_hash_table_mask_t
+hash_table_group_match_empty(const unsigned char *group)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+    return (rv_hash_table_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)CTRL_EMPTY)));
+}
+
+static rv_hash_table_mask_t
+hash_table_group_match_empty_or_deleted(const unsigned char *group)
+{
+    /* Empty and deleted slots are the only ones with the high bit set */
+
+    return (rv_hash_table_mask_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+}
+
+#define MASK_BIT_SHIFT 0
+
+#else
+
+#define GROUP_LSBS UINT64_C(0x0101010101010101)
+#define GROUP_MSBS UINT64_C(0x8080808080808080)
+
+/* Load a group's control words so that slot i is byte i, counting
+ * from the least significant byte */
+
+static uint64_t
+hash_table_group_load(const unsigned char *group)
+{
+    uint64_t word;
+
+    memcpy(&word, group, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+
+    return word;
+}
+
+static rv_hash_table_mask_t
+hash_table_group_match(const unsigned char *group, unsigned char h2)
+{
+    uint64_t word = hash_table_group_load(group) ^ (GROUP_LSBS * h2);
+
+    /* This can report a false match in the byte after a true match,
+     * so callers always check the control word of a matched slot */
+
+    return (word - GROUP_LSBS) & ~word & GROUP_MSBS;
+}
 
-static const unsigned int hash_table_num_primes = sizeof(hash_table_primes) / sizeof(int);
+static rv_hash_table_mask_t
+hash_table_group_match_empty(const unsigned char *group)
+{
+    uint64_t word = hash_table_group_load(group);
+
+    /* Empty is the only control word with the high bit set and bit 1 clear */
+
+    return word & ~(word << 6) & GROUP_MSBS;
+}
+
+static rv_hash_table_mask_t
+hash_table_group_match_empty_or_deleted(const unsigned char *group)
+{
+    uint64_t word = hash_table_group_load(group);
+
+    /* Empty and deleted are the only control words with the high bit set and bit 0 clear */
+
+    return word & ~(word << 7) & GROUP_MSBS;
+}
+
+#define MASK_BIT_SHIFT 3
+
+#endif
+
+/* Return the index within a group of the lowest slot set in a
+ * non-zero mask, and clear it from the mask */
+
+static size_t
+hash_table_mask_next(rv_hash_table_mask_t *mask)
+{
+    size_t bit;
+
+#if defined(__GNUC__) || defined(__clang__)
+    bit = (size_t)__builtin_ctzll((unsigned long long)*mask);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+
+    _BitScanForward64(&index, (unsigned __int64)*mask);
+    bit = (size_t)index;
+#else
+    rv_hash_table_mask_t tmp = *mask;
+
+    bit = 0;
+    while ((tmp & 1) == 0) {
+        tmp >>= 1;
+        ++bit;
+    }
+#endif
+
+    *mask &= *mask - 1;
+
+    return bit >> MASK_BIT_SHIFT;
+}
+
+/* Find the slot holding an entry with the given key, returning the
+ * slot's index, or the table's capacity if there is no such entry */
+
+static size_t
+hash_table_find(rv_hash_table_t *hash_table, rv_hash_table_key_t key, unsigned int hash, uint64_t mixed)
+{
+    size_t        group_mask = hash_table->capacity / RV_HASH_TABLE_GROUP_WIDTH - 1;
+    size_t        group      = HASH_H1(mixed) & group_mask;
+    size_t        probe      = 0;
+    unsigned char h2         = HASH_H2(mixed);
+
+    /* Visit groups in triangular order, which reaches every group
+     * since the number of groups is a power of two */
+
+    for (;;) {
+        const unsigned char  *group_ctrl = hash_table->ctrl + group * RV_HASH_TABLE_GROUP_WIDTH;
+        rv_hash_table_mask_t  match      = hash_table_group_match(group_ctrl, h2);
+
+        while (match != 0) {
+            size_t slot_index = group * RV_HASH_TABLE_GROUP_WIDTH + hash_table_mask_next(&match);
+            rv_hash_table_entry_t *slot = &hash_table->slots[slot_index];
+
+            if (hash_table->ctrl[slot_index] == h2 && slot->hash == hash &&
+                hash_table->equal_func(key, slot->key) != 0) {
+                return slot_index;
+            }
+        }
+
+        /* An empty slot ends the probe sequence: the key would have
+         * been inserted there */
+
+        if (hash_table_group_match_empty(group_ctrl) != 0) {
+            return hash_table->capacity;
+        }
+
+        ++probe;
+        group = (group + probe) & group_mask;
+
+        if (probe > group_mask) {
+            return hash_table->capacity;
+        }
+    }
+}
+
+/* Find the first empty or deleted slot in the probe sequence for a
+ * hash. The table always has at least one empty slot, so this
+ * always succeeds. */
+
+static size_t
+hash_table_find_free(rv_hash_table_t *hash_table, uint64_t mixed)
+{
+    size_t group_mask = hash_table->capacity / RV_HASH_TABLE_GROUP_WIDTH - 1;
+    size_t group      = HASH_H1(mixed) & group_mask;
+    size_t probe      = 0;
+
+    for (;;) {
+        rv_hash_table_mask_t free_slots =
+            hash_table_group_match_empty_or_deleted(hash_table->ctrl + group * RV_HASH_TABLE_GROUP_WIDTH);
+
+        if (free_slots != 0) {
+            return group * RV_HASH_TABLE_GROUP_WIDTH + hash_table_mask_next(&free_slots);
+        }
+
+        ++probe;
+        group = (group + probe) & group_mask;
+    }
+}
 
 /* Internal function used to allocate the table on hash table creation
- * and when enlarging the table */
+ * and when resizing the table */
 
 static int
-hash_table_allocate_table(rv_hash_table_t *hash_table)
+hash_table_allocate_table(rv_hash_table_t *hash_table, size_t capacity)
 {
-    unsigned int new_table_size;
+    unsigned char         *ctrl;
+    rv_hash_table_entry_t *slots;
 
-    /* Determine the table size based on the current prime index.
-     * An attempt is made here to ensure sensible behavior if the
-     * maximum prime is exceeded, but in practice other things are
-     * likely to break long before that happens. */
+    ctrl  = (unsigned char *)malloc(capacity);
+    slots = (rv_hash_table_entry_t *)malloc(capacity * sizeof(rv_hash_table_entry_t));
 
-    if (hash_table->prime_index < hash_table_num_primes) {
-        new_table_size = hash_table_primes[hash_table->prime_index];
-    }
-    else {
-        new_table_size = hash_table->entries * 10;
+    if (ctrl == NULL || slots == NULL) {
+        free(ctrl);
+        free(slots);
+
+        return 0;
     }
 
-    hash_table->table_size = new_table_size;
+    /* Every slot starts out empty */
 
-    /* Allocate the table and initialise to NULL for all entries */
+    memset(ctrl, CTRL_EMPTY, capacity);
 
-    hash_table->table =
-        (rv_hash_table_entry_t **)calloc(hash_table->table_size, sizeof(rv_hash_table_entry_t *));
+    hash_table->ctrl        = ctrl;
+    hash_table->slots       = slots;
+    hash_table->capacity    = capacity;
+    hash_table->growth_left = HASH_TABLE_MAX_LOAD(capacity);
 
-    return hash_table->table != NULL;
+    return 1;
 }
 
-/* Free an entry, calling the free functions if there are any registered */
+/* Free an entry's key and value, calling the free functions if there
+ * are any registered */
 
 static void
 hash_table_free_entry(rv_hash_table_t *hash_table, rv_hash_table_entry_t *entry)
@@ -102,10 +345,6 @@ hash_table_free_entry(rv_hash_table_t *hash_table, rv_hash_table_entry_t *entry)
     if (hash_table->value_free_func != NULL) {
         hash_table->value_free_func(entry->value);
     }
-
-    /* Free the data structure */
-
-    free(entry);
 }
 
 rv_hash_table_t *
@@ -126,11 +365,10 @@ rv_hash_table_new(rv_hash_table_hash_func_t hash_func, rv_hash_table_equal_func_
     hash_table->key_free_func   = NULL;
     hash_table->value_free_func = NULL;
     hash_table->entries         = 0;
-    hash_table->prime_index     = 0;
 
     /* Allocate the table */
 
-    if (!hash_table_allocate_table(hash_table)) {
+    if (!hash_table_allocate_table(hash_table, HASH_TABLE_INITIAL_CAPACITY)) {
         free(hash_table);
 
         return NULL;
@@ -142,24 +380,22 @@ rv_hash_table_new(rv_hash_table_hash_func_t hash_func, rv_hash_table_equal_func_
 void
 rv_hash_table_free(rv_hash_table_t *hash_table)
 {
-    rv_hash_table_entry_t *rover;
-    rv_hash_table_entry_t *next;
-    unsigned int           i;
-
-    /* Free all entries in all chains */
-
-    for (i = 0; i < hash_table->table_size; ++i) {
-        rover = hash_table->table[i];
-        while (rover != NULL) {
-            next = rover->next;
-            hash_table_free_entry(hash_table, rover);
-            rover = next;
+    size_t i;
+
+    /* Free all entries */
+
+    if (hash_table->key_free_func != NULL || hash_table->value_free_func != NULL) {
+        for (i = 0; i < hash_table->capacity; ++i) {
+            if (CTRL_IS_FULL(hash_table->ctrl[i])) {
+                hash_table_free_entry(hash_table, &hash_table->slots[i]);
+            }
         }
     }
 
     /* Free the table */
 
-    free(hash_table->table);
+    free(hash_table->ctrl);
+    free(hash_table->slots);
 
     /* Free the hash table structure */
 
@@ -175,64 +411,57 @@ rv_hash_table_register_free_functions(rv_hash_table_t                *hash_table
     hash_table->value_free_func = value_free_func;
 }
 
+/* Move all entries into a newly allocated table of the given
+ * capacity, which also discards any deleted slots */
+
 static int
-hash_table_enlarge(rv_hash_table_t *hash_table)
+hash_table_resize(rv_hash_table_t *hash_table, size_t new_capacity)
 {
-    rv_hash_table_entry_t **old_table;
-    unsigned int            old_table_size;
-    unsigned int            old_prime_index;
-    rv_hash_table_entry_t  *rover;
-    rv_hash_table_entry_t  *next;
-    unsigned int            entry_index;
-    unsigned int            i;
+    unsigned char         *old_ctrl;
+    rv_hash_table_entry_t *old_slots;
+    size_t                 old_capacity;
+    size_t                 old_growth_left;
+    size_t                 slot_index;
+    size_t                 i;
 
     /* Store a copy of the old table */
 
-    old_table       = hash_table->table;
-    old_table_size  = hash_table->table_size;
-    old_prime_index = hash_table->prime_index;
-
-    /* Allocate a new, larger table */
+    old_ctrl        = hash_table->ctrl;
+    old_slots       = hash_table->slots;
+    old_capacity    = hash_table->capacity;
+    old_growth_left = hash_table->growth_left;
 
-    ++hash_table->prime_index;
-
-    if (!hash_table_allocate_table(hash_table)) {
+    if (!hash_table_allocate_table(hash_table, new_capacity)) {
 
         /* Failed to allocate the new table */
 
-        hash_table->table       = old_table;
-        hash_table->table_size  = old_table_size;
-        hash_table->prime_index = old_prime_index;
+        hash_table->ctrl        = old_ctrl;
+        hash_table->slots       = old_slots;
+        hash_table->capacity    = old_capacity;
+        hash_table->growth_left = old_growth_left;
 
         return 0;
     }
 
-    /* Link all entries from all chains into the new table */
-
-    for (i = 0; i < old_table_size; ++i) {
-        rover = old_table[i];
-
-        while (rover != NULL) {
-            next = rover->next;
-
-            /* Find the index into the new table */
-
-            entry_index = hash_table->hash_func(rover->key) % hash_table->table_size;
-
-            /* Link this entry into the chain */
+    /* Move all entries into the new table, using the stored hashes */
 
-            rover->next                    = hash_table->table[entry_index];
-            hash_table->table[entry_index] = rover;
+    for (i = 0; i < old_capacity; ++i) {
+        if (CTRL_IS_FULL(old_ctrl[i])) {
+            uint64_t mixed = hash_table_mix(old_slots[i].hash);
 
-            /* Advance to next in the chain */
+            slot_index = hash_table_find_free(hash_table, mixed);
 
-            rover = next;
+            hash_table->ctrl[slot_index]  = HASH_H2(mixed);
+            hash_table->slots[slot_index] = old_slots[i];
         }
     }
 
+    hash_table->growth_left -= hash_table->entries;
+
     /* Free the old table */
 
-    free(old_table);
+    free(old_ctrl);
+    free(old_slots);
 
     return 1;
 }
@@ -240,79 +469,82 @@ hash_table_enlarge(rv_hash_table_t *hash_table)
 int
 rv_hash_table_insert(rv_hash_table_t *hash_table, rv_hash_table_key_t key, rv_hash_table_value_t value)
 {
-    rv_hash_table_entry_t *rover;
-    rv_hash_table_entry_t *newentry;
-    unsigned int           entry_index;
+    rv_hash_table_entry_t *slot;
+    unsigned int           hash;
+    uint64_t               mixed;
+    size_t                 slot_index;
 
-    /* If there are too many items in the table with respect to the table
-     * size, the number of hash collisions increases and performance
-     * decreases. Enlarge the table size to prevent this happening */
+    hash  = hash_table->hash_func(key);
+    mixed = hash_table_mix(hash);
 
-    if ((hash_table->entries * 3) / hash_table->table_size > 0) {
+    /* Look for an existing entry with the same key */
 
-        /* Table is more than 1/3 full */
+    slot_index = hash_table_find(hash_table, key, hash, mixed);
 
-        if (!hash_table_enlarge(hash_table)) {
+    if (slot_index != hash_table->capacity) {
 
-            /* Failed to enlarge the table */
+        /* Same key: overwrite this entry with new data */
 
-            return 0;
-        }
-    }
+        slot = &hash_table->slots[slot_index];
 
-    /* Generate the hash of the key and hence the index into the table */
+        /* If there is a value free function, free the old data
+         * before adding in the new data */
 
-    entry_index = hash_table->hash_func(key) % hash_table->table_size;
+        if (hash_table->value_free_func != NULL) {
+            hash_table->value_free_func(slot->value);
+        }
 
-    /* Traverse the chain at this location and look for an existing
-     * entry with the same key */
+        /* Same with the key: use the new key value and free
+         * the old one */
 
-    rover = hash_table->table[entry_index];
+        if (hash_table->key_free_func != NULL) {
+            hash_table->key_free_func(slot->key);
+        }
 
-    while (rover != NULL) {
-        if (hash_table->equal_func(rover->key, key) != 0) {
+        slot->key   = key;
+        slot->value = value;
 
-            /* Same key: overwrite this entry with new data */
+        /* Finished */
 
-            /* If there is a value free function, free the old data
-             * before adding in the new data */
+        return 1;
+    }
 
-            if (hash_table->value_free_func != NULL) {
-                hash_table->value_free_func(rover->value);
-            }
+    /* Not in the hash table yet. If the table has run out of empty
+     * slots, make room first: if many slots only hold deleted
+     * entries, rebuild the table at the same size to reclaim them,
+     * otherwise double its size. */
 
-            /* Same with the key: use the new key value and free
-             * the old one */
+    slot_index = hash_table_find_free(hash_table, mixed);
 
-            if (hash_table->key_free_func != NULL) {
-                hash_table->key_free_func(rover->key);
-            }
+    if (hash_table->growth_left == 0 && hash_table->ctrl[slot_index] == CTRL_EMPTY) {
+        size_t new_capacity = hash_table->capacity;
 
-            rover->key   = key;
-            rover->value = value;
+        if (hash_table->entries >= HASH_TABLE_MAX_LOAD(hash_table->capacity) / 2) {
+            new_capacity *= 2;
+        }
 
-            /* Finished */
+        if (!hash_table_resize(hash_table, new_capacity)) {
 
-            return 1;
+            /* Failed to enlarge the table */
+
+            return 0;
         }
-        rover = rover->next;
-    }
 
-    /* Not in the hash table yet.  Create a new entry */
+        slot_index = hash_table_find_free(hash_table, mixed);
+    }
 
-    newentry = (rv_hash_table_entry_t *)malloc(sizeof(rv_hash_table_entry_t));
+    /* Reusing a deleted slot doesn't use up an empty one */
 
-    if (newentry == NULL) {
-        return 0;
+    if (hash_table->ctrl[slot_index] == CTRL_EMPTY) {
+        --hash_table->growth_left;
     }
 
-    newentry->key   = key;
-    newentry->value = value;
-
-    /* Link into the list */
+    hash_table->ctrl[slot_index] = HASH_H2(mixed);
 
-    newentry->next                 = hash_table->table[entry_index];
-    hash_table->table[entry_index] = newentry;
+    slot        = &hash_table->slots[slot_index];
+    slot->key   = key;
+    slot->value = value;
+    slot->hash  = hash;
 
     /* Maintain the count of the number of entries */
 
@@ -326,84 +558,60 @@ rv_hash_table_insert(rv_hash_table_t *hash_table, rv_hash_table_key_t key, rv_ha
 rv_hash_table_value_t
 rv_hash_table_lookup(rv_hash_table_t *hash_table, rv_hash_table_key_t key)
 {
-    rv_hash_table_entry_t *rover;
-    unsigned int           entry_index;
-
-    /* Generate the hash of the key and hence the index into the table */
+    unsigned int hash;
+    size_t       slot_index;
 
-    entry_index = hash_table->hash_func(key) % hash_table->table_size;
+    hash       = hash_table->hash_func(key);
+    slot_index = hash_table_find(hash_table, key, hash, hash_table_mix(hash));
 
-    /* Walk the chain at this index until the corresponding entry is
-     * found */
+    if (slot_index == hash_table->capacity) {
 
-    rover = hash_table->table[entry_index];
+        /* Not found */
 
-    while (rover != NULL) {
-        if (hash_table->equal_func(key, rover->key) != 0) {
-
-            /* Found the entry.  Return the data. */
-
-            return rover->value;
-        }
-        rover = rover->next;
+        return RV_HASH_TABLE_NULL;
     }
 
-    /* Not found */
-
-    return RV_HASH_TABLE_NULL;
+    return hash_table->slots[slot_index].value;
 }
 
 int
 rv_hash_table_remove(rv_hash_table_t *hash_table, rv_hash_table_key_t key)
 {
-    rv_hash_table_entry_t **rover;
-    rv_hash_table_entry_t  *entry;
-    unsigned int            entry_index;
-    int                     result;
-
-    /* Generate the hash of the key and hence the index into the table */
-
-    entry_index = hash_table->hash_func(key) % hash_table->table_size;
-
-    /* Rover points at the pointer which points at the current entry
-     * in the chain being inspected.  ie. the entry in the table, or
-     * the "next" pointer of the previous entry in the chain.  This
-     * allows us to unlink the entry when we find it. */
+    const unsigned char *group_ctrl;
+    unsigned int         hash;
+    size_t               slot_index;
 
-    result = 0;
-    rover  = &hash_table->table[entry_index];
+    hash       = hash_table->hash_func(key);
+    slot_index = hash_table_find(hash_table, key, hash, hash_table_mix(hash));
 
-    while (*rover != NULL) {
-
-        if (hash_table->equal_func(key, (*rover)->key) != 0) {
-
-            /* This is the entry to remove */
-
-            entry = *rover;
-
-            /* Unlink from the list */
-
-            *rover = entry->next;
-
-            /* Destroy the entry structure */
+    if (slot_index == hash_table->capacity) {
+        return 0;
+    }
 
-            hash_table_free_entry(hash_table, entry);
+    /* Destroy the entry */
 
-            /* Track count of entries */
+    hash_table_free_entry(hash_table, &hash_table->slots[slot_index]);
 
-            --hash_table->entries;
+    /* If the slot's group still has an empty slot, no probe sequence
+     * can have passed through this group, so the slot can be marked
+     * empty again. Otherwise, it must be marked deleted so that
+     * lookups continue past it. */
 
-            result = 1;
+    group_ctrl = hash_table->ctrl + (slot_index - slot_index % RV_HASH_TABLE_GROUP_WIDTH);
 
-            break;
-        }
+    if (hash_table_group_match_empty(group_ctrl) != 0) {
+        hash_table->ctrl[slot_index] = CTRL_EMPTY;
+        ++hash_table->growth_left;
+    }
+    else {
+        hash_table->ctrl[slot_index] = CTRL_DELETED;
+    }
 
-        /* Advance to the next entry */
+    /* Track count of entries */
 
-        rover = &((*rover)->next);
-    }
+    --hash_table->entries;
 
-    return result;
+    return 1;
 }
 
 unsigned int
@@ -412,90 +620,56 @@ rv_hash_table_num_entries(rv_hash_table_t *hash_table)
     return hash_table->entries;
 }
 
+/* Find the index of the first full slot at or after the given index,
+ * or the table's capacity if there are none */
+
+static size_t
+hash_table_next_full(rv_hash_table_t *hash_table, size_t slot_index)
+{
+    while (slot_index < hash_table->capacity && !CTRL_IS_FULL(hash_table->ctrl[slot_index])) {
+        ++slot_index;
+    }
+
+    return slot_index;
+}
+
 void
 rv_hash_table_iterate(rv_hash_table_t *hash_table, rv_hash_table_iter_t *iterator)
 {
-    unsigned int chain;
-
     iterator->hash_table = hash_table;
 
-    /* Default value of next if no entries are found. */
-
-    iterator->next_entry = NULL;
-
     /* Find the first entry */
 
-    for (chain = 0; chain < hash_table->table_size; ++chain) {
-
-        if (hash_table->table[chain] != NULL) {
-            iterator->next_entry = hash_table->table[chain];
-            iterator->next_chain = chain;
-            break;
-        }
-    }
+    iterator->next_slot = hash_table_next_full(hash_table, 0);
 }
 
 int
 rv_hash_table_iter_has_more(rv_hash_table_iter_t *iterator)
 {
-    return iterator->next_entry != NULL;
+    return iterator->next_slot < iterator->hash_table->capacity;
 }
 
 rv_hash_table_value_t
 rv_hash_table_iter_next(rv_hash_table_iter_t *iterator)
 {
-    rv_hash_table_entry_t *current_entry;
-    rv_hash_table_t       *hash_table;
-    rv_hash_table_value_t  result;
-    unsigned int           chain;
+    rv_hash_table_t      *hash_table;
+    rv_hash_table_value_t result;
 
     hash_table = iterator->hash_table;
 
     /* No more entries? */
 
-    if (iterator->next_entry == NULL) {
+    if (iterator->next_slot >= hash_table->capacity) {
         return RV_HASH_TABLE_NULL;
     }
 
     /* Result is immediately available */
 
-    current_entry = iterator->next_entry;
-    result        = current_entry->value;
+    result = hash_table->slots[iterator->next_slot].value;
 
     /* Find the next entry */
 
-    if (current_entry->next != NULL) {
-
-        /* Next entry in current chain */
-
-        iterator->next_entry = current_entry->next;
-    }
-    else {
-
-        /* None left in this chain, so advance to the next chain */
-
-        chain = iterator->next_chain + 1;
-
-        /* Default value if no next chain found */
-
-        iterator->next_entry = NULL;
-
-        while (chain < hash_table->table_size) {
-
-            /* Is there anything in this chain? */
-
-            if (hash_table->table[chain] != NULL) {
-                iterator->next_entry = hash_table->table[chain];
-                break;
-            }
-
-            /* Try the next chain */
-
-            ++chain;
-        }
-
-        iterator->next_chain = chain;
-    }
+    iterator->next_slot = hash_table_next_full(hash_table, iterator->next_slot + 1);
 
     return result;
 }
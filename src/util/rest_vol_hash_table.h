@@ -45,6 +45,8 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #ifndef RV_HASH_TABLE_H
 #define RV_HASH_TABLE_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,9 +86,8 @@ typedef void *rv_hash_table_value_t;
  */
 
 struct rv_hash_table_iter {
-    rv_hash_table_t       *hash_table;
-    rv_hash_table_entry_t *next_entry;
-    unsigned int           next_chain;
+    rv_hash_table_t *hash_table;
+    size_t           next_slot;
 };
 
 /**
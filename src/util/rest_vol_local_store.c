@@ -0,0 +1,2845 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: An in-process implementation of the subset of the HSDS REST API
+ *          which the connector uses against a version 0.9.0 server: domains,
+ *          groups, committed datatypes, datasets, links, attributes and
+ *          binary transfers of dataset and attribute values. It does not
+ *          implement authentication, JSON (non-binary) value transfers,
+ *          compound member selection or filters.
+ *
+ *          It also serves direct transfers of dataset chunks, through a
+ *          /chunks route which is particular to this store and which HSDS
+ *          doesn't have. Chunks are kept as part of their dataset's values,
+ *          except for chunks of a filtered dataset written with filters
+ *          applied, which are kept apart as the bytes written and can only
+ *          be read back as chunks.
+ *
+ *          Everything is kept in memory. If the store has a directory, each
+ *          domain is saved there in its own file when it is flushed and when
+ *          the store is closed, and loaded again when the store is opened.
+ *          Only one process should use a directory at a time.
+ */
+
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sys/stat.h>
+
+#include <yajl/yajl_tree.h>
+
+#include "util/rest_vol_local_store.h"
+
+#define SERVER_VERSION      "0.9.0"
+#define MAX_RANK            32
+#define MAX_LINK_DEPTH      16
+#define ID_MAX_LENGTH       64
+#define OBJECT_TABLE_SIZE   4096
+#define CONTENT_TYPE_JSON   "application/json"
+#define CONTENT_TYPE_BINARY "application/octet-stream"
+
+/* Magic bytes at the start of a saved domain file, and the suffix of its name. Files
+ * saved before filtered chunks were kept have the first version of the magic bytes. */
+#define DOMAIN_FILE_MAGIC    "RVLOCAL2"
+#define DOMAIN_FILE_MAGIC_V1 "RVLOCAL1"
+#define DOMAIN_FILE_SUFFIX   ".domain"
+
+/* Response header giving the filter mask of a chunk which is read */
+#define FILTER_MASK_HEADER "X-Filter-Mask"
+
+typedef enum { SPACE_SCALAR, SPACE_SIMPLE, SPACE_NULL } space_class_t;
+
+typedef struct space_t {
+    space_class_t cls;
+    int           rank;
+    uint64_t      dims[MAX_RANK];
+    uint64_t      maxdims[MAX_RANK];
+    int           has_maxdims;
+} space_t;
+
+typedef enum { OBJ_GROUP, OBJ_DATASET, OBJ_DATATYPE } obj_class_t;
+
+typedef enum { LINK_HARD, LINK_SOFT, LINK_EXTERNAL } link_class_t;
+
+typedef struct link_t {
+    char        *name;
+    link_class_t cls;
+    char        *target_id;
+    char        *h5path;
+    char        *h5domain;
+    double       created;
+} link_t;
+
+typedef struct attr_t {
+    char             *name;
+    char             *type_json;
+    size_t            elem_size;
+    space_t           space;
+    RV_local_buffer_t value;
+    double            created;
+} attr_t;
+
+/* A chunk of a filtered dataset which was written with filters applied */
+typedef struct chunk_t {
+    uint64_t          index[MAX_RANK];
+    uint32_t          filter_mask;
+    RV_local_buffer_t data;
+} chunk_t;
+
+struct domain_t;
+
+typedef struct object_t {
+    char             id[ID_MAX_LENGTH];
+    obj_class_t      cls;
+    struct domain_t *domain;
+    char            *cpl_json;
+    double           created;
+
+    /* Datasets and committed datatypes */
+    char   *type_json;
+    size_t  elem_size;
+    space_t space;
+    char   *data;
+
+    /* Groups */
+    link_t *links;
+    size_t  nlinks;
+    size_t  links_nalloc;
+
+    attr_t *attrs;
+    size_t  nattrs;
+    size_t  attrs_nalloc;
+
+    /* Datasets' chunks which are kept apart from their values */
+    chunk_t *chunks;
+    size_t   nchunks;
+    size_t   chunks_nalloc;
+
+    struct object_t *next;
+} object_t;
+
+typedef struct domain_t {
+    char            *path;
+    object_t        *root;
+    struct domain_t *next;
+} domain_t;
+
+static domain_t   *domains_g = NULL;
+static object_t   *objects_g[OBJECT_TABLE_SIZE];
+static uint64_t    next_id_g       = 1;
+static char       *store_dir_g     = NULL;
+static const char *collections_g[] = {"groups", "datasets", "datatypes"};
+static const char *classes_g[]     = {"group", "dataset", "datatype"};
+static const char  id_prefixes_g[] = {'g', 'd', 't'};
+
+/* Where to unwind to when memory runs out, set while a request is handled and while the store is opened
+ * or closed */
+static jmp_buf *oom_jmp_g = NULL;
+
+/* Allocation failures unwind to the request being handled, which fails with a 500 error, or to the
+ * store being opened or closed, which fails. Whatever had been allocated or opened for it until then is
+ * leaked, and a request may have been partly carried out, but containers are only grown once their
+ * allocation succeeds, so the store stays usable. Failures outside of those are fatal. */
+static void
+out_of_memory(void)
+{
+    if (oom_jmp_g)
+        longjmp(*oom_jmp_g, 1);
+
+    fprintf(stderr, "local store: out of memory\n");
+    abort();
+}
+
+/*
+ * Growable buffers
+ */
+
+void
+RV_local_buffer_reserve(RV_local_buffer_t *buf, size_t extra)
+{
+    if (buf->size + extra + 1 > buf->nalloc) {
+        size_t new_nalloc = buf->nalloc ? buf->nalloc : 256;
+        char  *new_data;
+
+        while (buf->size + extra + 1 > new_nalloc)
+            new_nalloc *= 2;
+
+        if (NULL == (new_data = realloc(buf->data, new_nalloc)))
+            out_of_memory();
+
+        buf->data   = new_data;
+        buf->nalloc = new_nalloc;
+    }
+}
+
+void
+RV_local_buffer_append(RV_local_buffer_t *buf, const void *data, size_t size)
+{
+    RV_local_buffer_reserve(buf, size);
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+    buf->data[buf->size] = '\0';
+}
+
+static void
+buffer_printf(RV_local_buffer_t *buf, const char *fmt, ...)
+{
+    va_list ap;
+    int     len;
+
+    va_start(ap, fmt);
+    len = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+
+    RV_local_buffer_reserve(buf, (size_t)len);
+
+    va_start(ap, fmt);
+    vsnprintf(buf->data + buf->size, (size_t)len + 1, fmt, ap);
+    va_end(ap);
+
+    buf->size += (size_t)len;
+}
+
+static void
+buffer_append_json_string(RV_local_buffer_t *buf, const char *str)
+{
+    RV_local_buffer_append(buf, "\"", 1);
+
+    for (const unsigned char *p = (const unsigned char *)str; *p; p++) {
+        if (*p == '"' || *p == '\\')
+            buffer_printf(buf, "\\%c", *p);
+        else if (*p < 0x20)
+            buffer_printf(buf, "\\u%04x", *p);
+        else
+            RV_local_buffer_append(buf, p, 1);
+    }
+
+    RV_local_buffer_append(buf, "\"", 1);
+}
+
+void
+RV_local_buffer_free(RV_local_buffer_t *buf)
+{
+    free(buf->data);
+    memset(buf, 0, sizeof(*buf));
+}
+
+static char *
+copy_string(const char *str)
+{
+    char *copy;
+
+    if (!str)
+        return NULL;
+
+    if (NULL == (copy = strdup(str)))
+        out_of_memory();
+
+    return copy;
+}
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/*
+ * JSON helpers
+ */
+
+/* Re-serializes a parsed JSON value, so that parts of a request body, such
+ * as a datatype, can be stored and returned verbatim in later responses */
+static void
+json_serialize(RV_local_buffer_t *buf, yajl_val val)
+{
+    size_t i;
+
+    if (!val) {
+        RV_local_buffer_append(buf, "null", 4);
+        return;
+    }
+
+    switch (val->type) {
+        case yajl_t_string:
+            buffer_append_json_string(buf, val->u.string);
+            break;
+        case yajl_t_number:
+            buffer_printf(buf, "%s", val->u.number.r);
+            break;
+        case yajl_t_object:
+            RV_local_buffer_append(buf, "{", 1);
+            for (i = 0; i < val->u.object.len; i++) {
+                if (i > 0)
+                    RV_local_buffer_append(buf, ", ", 2);
+                buffer_append_json_string(buf, val->u.object.keys[i]);
+                RV_local_buffer_append(buf, ": ", 2);
+                json_serialize(buf, val->u.object.values[i]);
+            }
+            RV_local_buffer_append(buf, "}", 1);
+            break;
+        case yajl_t_array:
+            RV_local_buffer_append(buf, "[", 1);
+            for (i = 0; i < val->u.array.len; i++) {
+                if (i > 0)
+                    RV_local_buffer_append(buf, ", ", 2);
+                json_serialize(buf, val->u.array.values[i]);
+            }
+            RV_local_buffer_append(buf, "]", 1);
+            break;
+        case yajl_t_true:
+            RV_local_buffer_append(buf, "true", 4);
+            break;
+        case yajl_t_false:
+            RV_local_buffer_append(buf, "false", 5);
+            break;
+        case yajl_t_null:
+        case yajl_t_any:
+        default:
+            RV_local_buffer_append(buf, "null", 4);
+            break;
+    }
+}
+
+static char *
+json_to_string(yajl_val val)
+{
+    RV_local_buffer_t buf = {0};
+
+    json_serialize(&buf, val);
+
+    return buf.data;
+}
+
+static yajl_val
+json_get(yajl_val parent, const char *key, yajl_type type)
+{
+    const char *path[] = {key, (const char *)0};
+
+    return parent ? yajl_tree_get(parent, path, type) : NULL;
+}
+
+static const char *
+json_get_string(yajl_val parent, const char *key)
+{
+    yajl_val val = json_get(parent, key, yajl_t_string);
+
+    return val ? YAJL_GET_STRING(val) : NULL;
+}
+
+/*
+ * Object store
+ */
+
+static size_t
+id_hash(const char *id)
+{
+    size_t hash = 5381;
+
+    while (*id)
+        hash = (hash * 33) ^ (unsigned char)*id++;
+
+    return hash % OBJECT_TABLE_SIZE;
+}
+
+static object_t *
+object_find(const char *id)
+{
+    object_t *obj;
+
+    if (!id)
+        return NULL;
+
+    for (obj = objects_g[id_hash(id)]; obj; obj = obj->next)
+        if (!strcmp(obj->id, id))
+            return obj;
+
+    return NULL;
+}
+
+static object_t *
+object_create(domain_t *domain, obj_class_t cls, const char *id)
+{
+    object_t *obj;
+    size_t    bucket;
+
+    if (NULL == (obj = calloc(1, sizeof(*obj))))
+        out_of_memory();
+
+    if (id)
+        snprintf(obj->id, sizeof(obj->id), "%s", id);
+    else
+        snprintf(obj->id, sizeof(obj->id), "%c-00000000-0000-0000-0000-%012" PRIx64, id_prefixes_g[cls],
+                 next_id_g++);
+
+    obj->cls     = cls;
+    obj->domain  = domain;
+    obj->created = now_seconds();
+
+    bucket             = id_hash(obj->id);
+    obj->next          = objects_g[bucket];
+    objects_g[bucket]  = obj;
+
+    return obj;
+}
+
+static void
+attr_free(attr_t *attr)
+{
+    free(attr->name);
+    free(attr->type_json);
+    RV_local_buffer_free(&attr->value);
+}
+
+static void
+link_free(link_t *link)
+{
+    free(link->name);
+    free(link->target_id);
+    free(link->h5path);
+    free(link->h5domain);
+}
+
+static void
+object_free(object_t *obj)
+{
+    size_t i;
+
+    for (i = 0; i < obj->nlinks; i++)
+        link_free(&obj->links[i]);
+    for (i = 0; i < obj->nattrs; i++)
+        attr_free(&obj->attrs[i]);
+    for (i = 0; i < obj->nchunks; i++)
+        RV_local_buffer_free(&obj->chunks[i].data);
+
+    free(obj->links);
+    free(obj->attrs);
+    free(obj->chunks);
+    free(obj->cpl_json);
+    free(obj->type_json);
+    free(obj->data);
+    free(obj);
+}
+
+static void
+object_delete(object_t *obj)
+{
+    object_t **pp;
+
+    for (pp = &objects_g[id_hash(obj->id)]; *pp; pp = &(*pp)->next)
+        if (*pp == obj) {
+            *pp = obj->next;
+            break;
+        }
+
+    object_free(obj);
+}
+
+static domain_t *
+domain_find(const char *path)
+{
+    domain_t *domain;
+
+    if (!path)
+        return NULL;
+
+    for (domain = domains_g; domain; domain = domain->next)
+        if (!strcmp(domain->path, path))
+            return domain;
+
+    return NULL;
+}
+
+static void
+domain_delete(domain_t *domain)
+{
+    domain_t **pp;
+
+    for (size_t bucket = 0; bucket < OBJECT_TABLE_SIZE; bucket++) {
+        object_t **op = &objects_g[bucket];
+
+        while (*op) {
+            object_t *obj = *op;
+
+            if (obj->domain == domain) {
+                *op = obj->next;
+                object_free(obj);
+            }
+            else
+                op = &obj->next;
+        }
+    }
+
+    for (pp = &domains_g; *pp; pp = &(*pp)->next)
+        if (*pp == domain) {
+            *pp = domain->next;
+            break;
+        }
+
+    free(domain->path);
+    free(domain);
+}
+
+static link_t *
+link_find(object_t *group, const char *name)
+{
+    for (size_t i = 0; i < group->nlinks; i++)
+        if (!strcmp(group->links[i].name, name))
+            return &group->links[i];
+
+    return NULL;
+}
+
+static link_t *
+link_add(object_t *group, const char *name)
+{
+    link_t *link;
+
+    if (group->nlinks == group->links_nalloc) {
+        size_t  new_nalloc = group->links_nalloc ? 2 * group->links_nalloc : 8;
+        link_t *new_links;
+
+        if (NULL == (new_links = realloc(group->links, new_nalloc * sizeof(*group->links))))
+            out_of_memory();
+
+        group->links        = new_links;
+        group->links_nalloc = new_nalloc;
+    }
+
+    link = &group->links[group->nlinks++];
+    memset(link, 0, sizeof(*link));
+    link->name    = copy_string(name);
+    link->created = now_seconds();
+
+    return link;
+}
+
+static attr_t *
+attr_find(object_t *obj, const char *name)
+{
+    for (size_t i = 0; i < obj->nattrs; i++)
+        if (!strcmp(obj->attrs[i].name, name))
+            return &obj->attrs[i];
+
+    return NULL;
+}
+
+static chunk_t *
+chunk_find(object_t *dset, const uint64_t *index)
+{
+    for (size_t i = 0; i < dset->nchunks; i++)
+        if (!memcmp(dset->chunks[i].index, index, (size_t)dset->space.rank * sizeof(uint64_t)))
+            return &dset->chunks[i];
+
+    return NULL;
+}
+
+static chunk_t *
+chunk_add(object_t *dset, const uint64_t *index)
+{
+    chunk_t *chunk;
+
+    if (dset->nchunks == dset->chunks_nalloc) {
+        size_t   new_nalloc = dset->chunks_nalloc ? 2 * dset->chunks_nalloc : 8;
+        chunk_t *new_chunks;
+
+        if (NULL == (new_chunks = realloc(dset->chunks, new_nalloc * sizeof(*dset->chunks))))
+            out_of_memory();
+
+        dset->chunks        = new_chunks;
+        dset->chunks_nalloc = new_nalloc;
+    }
+
+    chunk = &dset->chunks[dset->nchunks++];
+    memset(chunk, 0, sizeof(*chunk));
+    memcpy(chunk->index, index, (size_t)dset->space.rank * sizeof(uint64_t));
+
+    return chunk;
+}
+
+static void
+chunk_remove(object_t *dset, chunk_t *chunk)
+{
+    RV_local_buffer_free(&chunk->data);
+    *chunk = dset->chunks[--dset->nchunks];
+}
+
+static attr_t *
+attr_add(object_t *obj, const char *name)
+{
+    attr_t *attr;
+
+    if (obj->nattrs == obj->attrs_nalloc) {
+        size_t  new_nalloc = obj->attrs_nalloc ? 2 * obj->attrs_nalloc : 8;
+        attr_t *new_attrs;
+
+        if (NULL == (new_attrs = realloc(obj->attrs, new_nalloc * sizeof(*obj->attrs))))
+            out_of_memory();
+
+        obj->attrs        = new_attrs;
+        obj->attrs_nalloc = new_nalloc;
+    }
+
+    attr = &obj->attrs[obj->nattrs++];
+    memset(attr, 0, sizeof(*attr));
+    attr->name    = copy_string(name);
+    attr->created = now_seconds();
+
+    return attr;
+}
+
+/*
+ * Datatypes and dataspaces
+ */
+
+/* Returns the size in bytes of a predefined type such as H5T_STD_I32LE or
+ * H5T_IEEE_F64BE, taken from the number of bits in its name */
+static size_t
+base_type_size(const char *name)
+{
+    const char *digits = NULL;
+
+    for (const char *p = name; *p; p++)
+        if (isdigit((unsigned char)*p) && (p == name || !isdigit((unsigned char)p[-1])))
+            digits = p;
+
+    return digits ? (size_t)strtoul(digits, NULL, 10) / 8 : 0;
+}
+
+/* Returns the size in bytes of an element of the given type, or 0 if the
+ * type's size can't be determined from its description, in which case
+ * it is inferred from the first write of the whole dataset instead */
+static size_t
+type_size(yajl_val type)
+{
+    const char *cls;
+    yajl_val    val;
+    size_t      size = 0;
+
+    if (YAJL_IS_STRING(type)) {
+        object_t *committed;
+
+        if (!strncmp(type->u.string, "H5T_", 4))
+            return base_type_size(type->u.string);
+
+        committed = object_find(type->u.string);
+        return committed ? committed->elem_size : 0;
+    }
+
+    if (NULL == (cls = json_get_string(type, "class")))
+        return 0;
+
+    if (!strcmp(cls, "H5T_INTEGER") || !strcmp(cls, "H5T_FLOAT") || !strcmp(cls, "H5T_BITFIELD")) {
+        const char *base = json_get_string(type, "base");
+
+        size = base ? base_type_size(base) : 0;
+    }
+    else if (!strcmp(cls, "H5T_STRING")) {
+        if (NULL != (val = json_get(type, "length", yajl_t_number)) && YAJL_IS_INTEGER(val))
+            size = (size_t)YAJL_GET_INTEGER(val);
+    }
+    else if (!strcmp(cls, "H5T_OPAQUE")) {
+        if (NULL != (val = json_get(type, "size", yajl_t_number)) && YAJL_IS_INTEGER(val))
+            size = (size_t)YAJL_GET_INTEGER(val);
+    }
+    else if (!strcmp(cls, "H5T_ENUM")) {
+        size = type_size(json_get(type, "base", yajl_t_any));
+    }
+    else if (!strcmp(cls, "H5T_ARRAY")) {
+        if (NULL != (val = json_get(type, "dims", yajl_t_array))) {
+            size = type_size(json_get(type, "base", yajl_t_any));
+            for (size_t i = 0; i < val->u.array.len; i++)
+                size *= (size_t)YAJL_GET_INTEGER(val->u.array.values[i]);
+        }
+    }
+    else if (!strcmp(cls, "H5T_COMPOUND")) {
+        if (NULL != (val = json_get(type, "fields", yajl_t_array)))
+            for (size_t i = 0; i < val->u.array.len; i++) {
+                size_t field_size = type_size(json_get(val->u.array.values[i], "type", yajl_t_any));
+
+                if (field_size == 0)
+                    return 0;
+                size += field_size;
+            }
+    }
+
+    return size;
+}
+
+/* Parses the "shape" and "maxdims" keys of a create request. A missing
+ * shape means a scalar dataspace. Unlimited dimensions are stored as 0,
+ * which is also how they are returned to the connector. */
+static int
+space_parse(yajl_val body, space_t *space)
+{
+    yajl_val shape   = json_get(body, "shape", yajl_t_any);
+    yajl_val maxdims = json_get(body, "maxdims", yajl_t_array);
+
+    memset(space, 0, sizeof(*space));
+
+    if (!shape) {
+        space->cls = SPACE_SCALAR;
+        return 0;
+    }
+
+    if (YAJL_IS_STRING(shape)) {
+        if (!strcmp(shape->u.string, "H5S_NULL"))
+            space->cls = SPACE_NULL;
+        else if (!strcmp(shape->u.string, "H5S_SCALAR"))
+            space->cls = SPACE_SCALAR;
+        else
+            return -1;
+        return 0;
+    }
+
+    space->cls = SPACE_SIMPLE;
+
+    if (YAJL_IS_INTEGER(shape)) {
+        space->rank    = 1;
+        space->dims[0] = (uint64_t)YAJL_GET_INTEGER(shape);
+    }
+    else if (YAJL_IS_ARRAY(shape) && shape->u.array.len <= MAX_RANK) {
+        space->rank = (int)shape->u.array.len;
+        for (int i = 0; i < space->rank; i++) {
+            if (!YAJL_IS_INTEGER(shape->u.array.values[i]))
+                return -1;
+            space->dims[i] = (uint64_t)YAJL_GET_INTEGER(shape->u.array.values[i]);
+        }
+    }
+    else
+        return -1;
+
+    if (maxdims) {
+        if ((int)maxdims->u.array.len != space->rank)
+            return -1;
+
+        space->has_maxdims = 1;
+        for (int i = 0; i < space->rank; i++)
+            space->maxdims[i] = YAJL_IS_INTEGER(maxdims->u.array.values[i])
+                                    ? (uint64_t)YAJL_GET_INTEGER(maxdims->u.array.values[i])
+                                    : 0;
+    }
+
+    return 0;
+}
+
+static uint64_t
+space_nelems(const space_t *space)
+{
+    uint64_t nelems = 1;
+
+    if (space->cls == SPACE_NULL)
+        return 0;
+
+    for (int i = 0; i < space->rank; i++)
+        nelems *= space->dims[i];
+
+    return nelems;
+}
+
+static void
+space_serialize(RV_local_buffer_t *buf, const space_t *space)
+{
+    static const char *space_classes[] = {"H5S_SCALAR", "H5S_SIMPLE", "H5S_NULL"};
+
+    buffer_printf(buf, "{\"class\": \"%s\"", space_classes[space->cls]);
+
+    if (space->cls == SPACE_SIMPLE) {
+        RV_local_buffer_append(buf, ", \"dims\": [", 11);
+        for (int i = 0; i < space->rank; i++)
+            buffer_printf(buf, "%s%" PRIu64, i > 0 ? ", " : "", space->dims[i]);
+        RV_local_buffer_append(buf, "], \"maxdims\": [", 15);
+        for (int i = 0; i < space->rank; i++)
+            buffer_printf(buf, "%s%" PRIu64, i > 0 ? ", " : "",
+                          space->has_maxdims ? space->maxdims[i] : space->dims[i]);
+        RV_local_buffer_append(buf, "]", 1);
+    }
+
+    RV_local_buffer_append(buf, "}", 1);
+}
+
+/*
+ * Dataset selections
+ */
+
+typedef struct selection_t {
+    int      rank;
+    uint64_t start[MAX_RANK];
+    uint64_t count[MAX_RANK];
+    uint64_t step[MAX_RANK];
+} selection_t;
+
+/* Parses a 'select' query parameter of the form [start:stop:step, ...],
+ * where stop is exclusive and the step may be omitted. A single index
+ * selects just that index in its dimension. */
+static int
+selection_parse(const char *str, const space_t *space, selection_t *sel)
+{
+    const char *p = str;
+
+    sel->rank = space->rank;
+
+    if (*p++ != '[')
+        return -1;
+
+    for (int i = 0; i < space->rank; i++) {
+        uint64_t start, stop, step = 1;
+        char    *end;
+
+        start = strtoull(p, &end, 10);
+        if (end == p)
+            return -1;
+        p = end;
+
+        stop = start + 1;
+        if (*p == ':') {
+            p++;
+            stop = strtoull(p, &end, 10);
+            p    = end;
+
+            if (*p == ':') {
+                p++;
+                step = strtoull(p, &end, 10);
+                p    = end;
+            }
+        }
+
+        if (step == 0 || stop < start || stop > space->dims[i])
+            return -1;
+
+        sel->start[i] = start;
+        sel->count[i] = (stop - start + step - 1) / step;
+        sel->step[i]  = step;
+
+        if (*p == ',' || *p == ' ')
+            while (*p == ',' || *p == ' ')
+                p++;
+        else if (i < space->rank - 1)
+            return -1;
+    }
+
+    return *p == ']' ? 0 : -1;
+}
+
+static void
+selection_all(const space_t *space, selection_t *sel)
+{
+    sel->rank = space->rank;
+
+    for (int i = 0; i < space->rank; i++) {
+        sel->start[i] = 0;
+        sel->count[i] = space->dims[i];
+        sel->step[i]  = 1;
+    }
+}
+
+static uint64_t
+selection_nelems(const selection_t *sel)
+{
+    uint64_t nelems = 1;
+
+    for (int i = 0; i < sel->rank; i++)
+        nelems *= sel->count[i];
+
+    return nelems;
+}
+
+/* Copies the selected elements of a dataset to or from a packed buffer,
+ * moving whole rows at a time when the fastest-changing dimension of the
+ * selection is contiguous */
+static void
+selection_copy(object_t *dset, const selection_t *sel, char *packed, int to_packed)
+{
+    uint64_t idx[MAX_RANK] = {0};
+    int      rank          = sel->rank;
+    size_t   elem_size     = dset->elem_size;
+
+    if (rank == 0) {
+        if (to_packed)
+            memcpy(packed, dset->data, elem_size);
+        else
+            memcpy(dset->data, packed, elem_size);
+        return;
+    }
+
+    if (selection_nelems(sel) == 0)
+        return;
+
+    for (;;) {
+        uint64_t offset = 0;
+
+        for (int i = 0; i < rank; i++)
+            offset = offset * dset->space.dims[i] + sel->start[i] + idx[i] * sel->step[i];
+
+        if (sel->step[rank - 1] == 1) {
+            size_t row_size = (size_t)sel->count[rank - 1] * elem_size;
+
+            if (to_packed)
+                memcpy(packed, dset->data + offset * elem_size, row_size);
+            else
+                memcpy(dset->data + offset * elem_size, packed, row_size);
+            packed += row_size;
+            idx[rank - 1] = sel->count[rank - 1] - 1;
+        }
+        else {
+            if (to_packed)
+                memcpy(packed, dset->data + offset * elem_size, elem_size);
+            else
+                memcpy(dset->data + offset * elem_size, packed, elem_size);
+            packed += elem_size;
+        }
+
+        for (int i = rank - 1; i >= 0; i--) {
+            if (++idx[i] < sel->count[i])
+                break;
+            if (i == 0)
+                return;
+            idx[i] = 0;
+        }
+    }
+}
+
+static int
+dataset_allocate(object_t *dset)
+{
+    uint64_t nelems = space_nelems(&dset->space);
+
+    if (dset->data || dset->elem_size == 0)
+        return 0;
+
+    if (NULL == (dset->data = calloc(nelems ? (size_t)nelems : 1, dset->elem_size)))
+        return -1;
+
+    return 0;
+}
+
+/* Creates a new dataset or committed datatype with the same type, shape, data and attributes as another */
+static object_t *
+object_copy(domain_t *domain, const object_t *src, const char *id)
+{
+    object_t *obj = object_create(domain, src->cls, id);
+
+    obj->cpl_json  = copy_string(src->cpl_json);
+    obj->type_json = copy_string(src->type_json);
+    obj->elem_size = src->elem_size;
+    obj->space     = src->space;
+
+    if (src->data) {
+        size_t data_size = (size_t)space_nelems(&src->space) * src->elem_size;
+
+        if (NULL == (obj->data = malloc(data_size ? data_size : 1)))
+            out_of_memory();
+        memcpy(obj->data, src->data, data_size);
+    }
+
+    for (size_t i = 0; i < src->nattrs; i++) {
+        attr_t *attr = attr_add(obj, src->attrs[i].name);
+
+        attr->type_json = copy_string(src->attrs[i].type_json);
+        attr->elem_size = src->attrs[i].elem_size;
+        attr->space     = src->attrs[i].space;
+        if (src->attrs[i].value.size)
+            RV_local_buffer_append(&attr->value, src->attrs[i].value.data, src->attrs[i].value.size);
+    }
+
+    for (size_t i = 0; i < src->nchunks; i++) {
+        chunk_t *chunk = chunk_add(obj, src->chunks[i].index);
+
+        chunk->filter_mask = src->chunks[i].filter_mask;
+        RV_local_buffer_append(&chunk->data, src->chunks[i].data.data, src->chunks[i].data.size);
+    }
+
+    return obj;
+}
+
+/*
+ * JSON responses
+ */
+
+static void
+link_serialize(RV_local_buffer_t *buf, const link_t *link)
+{
+    static const char *link_classes[] = {"H5L_TYPE_HARD", "H5L_TYPE_SOFT", "H5L_TYPE_EXTERNAL"};
+
+    buffer_printf(buf, "{\"class\": \"%s\", \"title\": ", link_classes[link->cls]);
+    buffer_append_json_string(buf, link->name);
+    buffer_printf(buf, ", \"created\": %.6f", link->created);
+
+    if (link->cls == LINK_HARD) {
+        object_t *target = object_find(link->target_id);
+
+        buffer_printf(buf, ", \"collection\": \"%s\", \"id\": ", collections_g[target ? target->cls : 0]);
+        buffer_append_json_string(buf, link->target_id);
+    }
+    else {
+        RV_local_buffer_append(buf, ", \"h5path\": ", 12);
+        buffer_append_json_string(buf, link->h5path);
+
+        if (link->cls == LINK_EXTERNAL) {
+            RV_local_buffer_append(buf, ", \"h5domain\": ", 14);
+            buffer_append_json_string(buf, link->h5domain);
+        }
+    }
+
+    RV_local_buffer_append(buf, "}", 1);
+}
+
+static void
+attr_serialize(RV_local_buffer_t *buf, const attr_t *attr)
+{
+    RV_local_buffer_append(buf, "{\"name\": ", 9);
+    buffer_append_json_string(buf, attr->name);
+    buffer_printf(buf, ", \"type\": %s, \"shape\": ", attr->type_json);
+    space_serialize(buf, &attr->space);
+    buffer_printf(buf, ", \"created\": %.6f}", attr->created);
+}
+
+/* Writes the description of an object. The datatype comes before anything
+ * else which might contain a "type" key, since the connector locates it
+ * by searching the response text. */
+static void
+object_serialize(RV_local_buffer_t *buf, const object_t *obj, int include_attrs)
+{
+    RV_local_buffer_append(buf, "{\"id\": ", 7);
+    buffer_append_json_string(buf, obj->id);
+    buffer_printf(buf, ", \"class\": \"%s\"", classes_g[obj->cls]);
+
+    if (obj->cls != OBJ_GROUP)
+        buffer_printf(buf, ", \"type\": %s", obj->type_json);
+
+    RV_local_buffer_append(buf, ", \"root\": ", 10);
+    buffer_append_json_string(buf, obj->domain->root->id);
+    RV_local_buffer_append(buf, ", \"domain\": ", 12);
+    buffer_append_json_string(buf, obj->domain->path);
+
+    if (obj->cls == OBJ_DATASET) {
+        RV_local_buffer_append(buf, ", \"shape\": ", 11);
+        space_serialize(buf, &obj->space);
+        buffer_printf(buf, ", \"creationProperties\": %s", obj->cpl_json ? obj->cpl_json : "{}");
+        buffer_printf(buf, ", \"allocated_size\": %" PRIu64,
+                      obj->data ? space_nelems(&obj->space) * obj->elem_size : 0);
+    }
+    else if (obj->cpl_json)
+        buffer_printf(buf, ", \"creationProperties\": %s", obj->cpl_json);
+
+    if (obj->cls == OBJ_GROUP)
+        buffer_printf(buf, ", \"linkCount\": %zu", obj->nlinks);
+
+    buffer_printf(buf, ", \"attributeCount\": %zu, \"created\": %.6f, \"lastModified\": %.6f", obj->nattrs,
+                  obj->created, obj->created);
+
+    if (include_attrs) {
+        RV_local_buffer_append(buf, ", \"attributes\": {", 17);
+        for (size_t i = 0; i < obj->nattrs; i++) {
+            if (i > 0)
+                RV_local_buffer_append(buf, ", ", 2);
+            buffer_append_json_string(buf, obj->attrs[i].name);
+            RV_local_buffer_append(buf, ": ", 2);
+            attr_serialize(buf, &obj->attrs[i]);
+        }
+        RV_local_buffer_append(buf, "}", 1);
+    }
+
+    RV_local_buffer_append(buf, "}", 1);
+}
+
+static void
+domain_serialize(RV_local_buffer_t *buf, const domain_t *domain, int verbose)
+{
+    RV_local_buffer_append(buf, "{\"root\": ", 9);
+    buffer_append_json_string(buf, domain->root->id);
+    RV_local_buffer_append(buf, ", \"domain\": ", 12);
+    buffer_append_json_string(buf, domain->path);
+    buffer_printf(buf, ", \"class\": \"domain\", \"version\": \"%s\"", SERVER_VERSION);
+    buffer_printf(buf, ", \"binaryPointWrite\": true");
+
+    /* Verbose requests also get the bytes allocated for the domain's datasets */
+    if (verbose) {
+        uint64_t allocated_bytes = 0;
+
+        for (size_t i = 0; i < OBJECT_TABLE_SIZE; i++)
+            for (const object_t *obj = objects_g[i]; obj; obj = obj->next)
+                if (obj->domain == domain && obj->cls == OBJ_DATASET && obj->data)
+                    allocated_bytes += space_nelems(&obj->space) * obj->elem_size;
+
+        buffer_printf(buf, ", \"scan_info\": {\"allocated_bytes\": %" PRIu64 "}", allocated_bytes);
+    }
+
+    RV_local_buffer_append(buf, "}", 1);
+}
+
+static int
+set_error(RV_local_response_t *resp, int status, const char *message)
+{
+    resp->status       = status;
+    resp->content_type = CONTENT_TYPE_JSON;
+    resp->headers.size = 0;
+    resp->body.size    = 0;
+    RV_local_buffer_append(&resp->body, "{\"message\": ", 12);
+    buffer_append_json_string(&resp->body, message);
+    RV_local_buffer_append(&resp->body, "}", 1);
+
+    return -1;
+}
+
+/*
+ * Path traversal
+ */
+
+/* Follows a path from the given group, or from the root group if the path
+ * is absolute, through hard, soft and external links */
+static object_t *
+resolve_path(domain_t *domain, object_t *start, const char *path, int depth)
+{
+    object_t *cur = (*path == '/' || !start) ? domain->root : start;
+    char     *copy, *saveptr = NULL, *name;
+
+    if (depth > MAX_LINK_DEPTH)
+        return NULL;
+
+    copy = copy_string(path);
+
+    for (name = strtok_r(copy, "/", &saveptr); cur && name; name = strtok_r(NULL, "/", &saveptr)) {
+        link_t *link;
+
+        if (!strcmp(name, "."))
+            continue;
+
+        if (cur->cls != OBJ_GROUP || NULL == (link = link_find(cur, name))) {
+            cur = NULL;
+            break;
+        }
+
+        if (link->cls == LINK_HARD)
+            cur = object_find(link->target_id);
+        else if (link->cls == LINK_SOFT)
+            cur = resolve_path(domain, cur, link->h5path, depth + 1);
+        else {
+            domain_t *ext_domain = domain_find(link->h5domain);
+
+            cur    = ext_domain ? resolve_path(ext_domain, NULL, link->h5path, depth + 1) : NULL;
+            domain = ext_domain;
+        }
+    }
+
+    free(copy);
+
+    return cur;
+}
+
+/*
+ * Persistence
+ */
+
+/* Returns the name of the file that a domain is saved to. Characters of the
+ * domain path other than letters, digits, '-', '_' and '.' are
+ * percent-encoded, so that every domain is saved to a single file directly
+ * inside the store's directory. */
+static char *
+domain_file_name(const char *path)
+{
+    RV_local_buffer_t name = {0};
+
+    RV_local_buffer_append(&name, store_dir_g, strlen(store_dir_g));
+    RV_local_buffer_append(&name, "/", 1);
+
+    for (const unsigned char *p = (const unsigned char *)path; *p; p++) {
+        if (isalnum(*p) || *p == '-' || *p == '_' || *p == '.')
+            RV_local_buffer_append(&name, p, 1);
+        else
+            buffer_printf(&name, "%%%02X", *p);
+    }
+
+    RV_local_buffer_append(&name, DOMAIN_FILE_SUFFIX, strlen(DOMAIN_FILE_SUFFIX));
+
+    return name.data;
+}
+
+static int
+write_bytes(FILE *file, const void *data, size_t size)
+{
+    return (size == 0 || fwrite(data, 1, size, file) == size) ? 0 : -1;
+}
+
+static int
+write_u64(FILE *file, uint64_t val)
+{
+    return write_bytes(file, &val, sizeof(val));
+}
+
+/* Strings are written as their length plus one, so that a length of 0 can
+ * stand for a NULL string */
+static int
+write_string(FILE *file, const char *str)
+{
+    if (!str)
+        return write_u64(file, 0);
+
+    if (write_u64(file, (uint64_t)strlen(str) + 1) < 0)
+        return -1;
+
+    return write_bytes(file, str, strlen(str));
+}
+
+static int
+write_space(FILE *file, const space_t *space)
+{
+    if (write_u64(file, (uint64_t)space->cls) < 0 || write_u64(file, (uint64_t)space->rank) < 0 ||
+        write_u64(file, (uint64_t)space->has_maxdims) < 0 ||
+        write_bytes(file, space->dims, (size_t)space->rank * sizeof(uint64_t)) < 0 ||
+        write_bytes(file, space->maxdims, (size_t)space->rank * sizeof(uint64_t)) < 0)
+        return -1;
+
+    return 0;
+}
+
+static int
+object_write(FILE *file, const object_t *obj)
+{
+    if (write_string(file, obj->id) < 0 || write_u64(file, (uint64_t)obj->cls) < 0 ||
+        write_string(file, obj->cpl_json) < 0 || write_bytes(file, &obj->created, sizeof(double)) < 0 ||
+        write_string(file, obj->type_json) < 0 || write_u64(file, (uint64_t)obj->elem_size) < 0 ||
+        write_space(file, &obj->space) < 0 || write_u64(file, obj->data ? 1 : 0) < 0)
+        return -1;
+
+    if (obj->data &&
+        write_bytes(file, obj->data, (size_t)space_nelems(&obj->space) * obj->elem_size) < 0)
+        return -1;
+
+    if (write_u64(file, (uint64_t)obj->nlinks) < 0)
+        return -1;
+
+    for (size_t i = 0; i < obj->nlinks; i++) {
+        const link_t *link = &obj->links[i];
+
+        if (write_string(file, link->name) < 0 || write_u64(file, (uint64_t)link->cls) < 0 ||
+            write_string(file, link->target_id) < 0 || write_string(file, link->h5path) < 0 ||
+            write_string(file, link->h5domain) < 0 || write_bytes(file, &link->created, sizeof(double)) < 0)
+            return -1;
+    }
+
+    if (write_u64(file, (uint64_t)obj->nattrs) < 0)
+        return -1;
+
+    for (size_t i = 0; i < obj->nattrs; i++) {
+        const attr_t *attr = &obj->attrs[i];
+
+        if (write_string(file, attr->name) < 0 || write_string(file, attr->type_json) < 0 ||
+            write_u64(file, (uint64_t)attr->elem_size) < 0 || write_space(file, &attr->space) < 0 ||
+            write_u64(file, (uint64_t)attr->value.size) < 0 ||
+            write_bytes(file, attr->value.data, attr->value.size) < 0 ||
+            write_bytes(file, &attr->created, sizeof(double)) < 0)
+            return -1;
+    }
+
+    if (write_u64(file, (uint64_t)obj->nchunks) < 0)
+        return -1;
+
+    for (size_t i = 0; i < obj->nchunks; i++) {
+        const chunk_t *chunk = &obj->chunks[i];
+
+        if (write_bytes(file, chunk->index, (size_t)obj->space.rank * sizeof(uint64_t)) < 0 ||
+            write_u64(file, (uint64_t)chunk->filter_mask) < 0 ||
+            write_u64(file, (uint64_t)chunk->data.size) < 0 ||
+            write_bytes(file, chunk->data.data, chunk->data.size) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+/* Saves a domain to its file in the store's directory, if the store has one.
+ * The domain is written to a temporary file first, which then replaces the
+ * previously saved domain, so that a failed save leaves that intact. */
+static int
+domain_save(const domain_t *domain)
+{
+    RV_local_buffer_t tmp_name  = {0};
+    char             *file_name = NULL;
+    FILE             *file      = NULL;
+    uint64_t          nobjects  = 0;
+    int               ret       = -1;
+
+    if (!store_dir_g)
+        return 0;
+
+    file_name = domain_file_name(domain->path);
+    RV_local_buffer_append(&tmp_name, file_name, strlen(file_name));
+    RV_local_buffer_append(&tmp_name, ".tmp", 4);
+
+    if (NULL == (file = fopen(tmp_name.data, "wb")))
+        goto done;
+
+    for (size_t bucket = 0; bucket < OBJECT_TABLE_SIZE; bucket++)
+        for (object_t *obj = objects_g[bucket]; obj; obj = obj->next)
+            if (obj->domain == domain)
+                nobjects++;
+
+    if (write_bytes(file, DOMAIN_FILE_MAGIC, strlen(DOMAIN_FILE_MAGIC)) < 0 ||
+        write_string(file, domain->path) < 0 || write_string(file, domain->root->id) < 0 ||
+        write_u64(file, nobjects) < 0)
+        goto done;
+
+    for (size_t bucket = 0; bucket < OBJECT_TABLE_SIZE; bucket++)
+        for (object_t *obj = objects_g[bucket]; obj; obj = obj->next)
+            if (obj->domain == domain && object_write(file, obj) < 0)
+                goto done;
+
+    ret = 0;
+
+done:
+    if (file && fclose(file) != 0)
+        ret = -1;
+
+    if (ret == 0 && rename(tmp_name.data, file_name) != 0)
+        ret = -1;
+
+    if (ret < 0 && file)
+        remove(tmp_name.data);
+
+    RV_local_buffer_free(&tmp_name);
+    free(file_name);
+
+    return ret;
+}
+
+/* Removes the saved copy of a domain which is being deleted */
+static void
+domain_remove_file(const domain_t *domain)
+{
+    char *file_name;
+
+    if (!store_dir_g)
+        return;
+
+    file_name = domain_file_name(domain->path);
+    remove(file_name);
+    free(file_name);
+}
+
+static int
+read_bytes(FILE *file, void *data, size_t size)
+{
+    return (size == 0 || fread(data, 1, size, file) == size) ? 0 : -1;
+}
+
+static int
+read_u64(FILE *file, uint64_t *val)
+{
+    return read_bytes(file, val, sizeof(*val));
+}
+
+static int
+read_string(FILE *file, char **str)
+{
+    uint64_t len;
+
+    *str = NULL;
+
+    if (read_u64(file, &len) < 0)
+        return -1;
+    if (len == 0)
+        return 0;
+
+    if (NULL == (*str = malloc((size_t)len)))
+        out_of_memory();
+
+    if (read_bytes(file, *str, (size_t)len - 1) < 0) {
+        free(*str);
+        *str = NULL;
+        return -1;
+    }
+
+    (*str)[len - 1] = '\0';
+
+    return 0;
+}
+
+static int
+read_space(FILE *file, space_t *space)
+{
+    uint64_t cls, rank, has_maxdims;
+
+    memset(space, 0, sizeof(*space));
+
+    if (read_u64(file, &cls) < 0 || read_u64(file, &rank) < 0 || read_u64(file, &has_maxdims) < 0 ||
+        cls > SPACE_NULL || rank > MAX_RANK)
+        return -1;
+
+    space->cls         = (space_class_t)cls;
+    space->rank        = (int)rank;
+    space->has_maxdims = (int)has_maxdims;
+
+    if (read_bytes(file, space->dims, (size_t)rank * sizeof(uint64_t)) < 0 ||
+        read_bytes(file, space->maxdims, (size_t)rank * sizeof(uint64_t)) < 0)
+        return -1;
+
+    return 0;
+}
+
+/* Reads an object into the given domain. Anything allocated for a partially
+ * read object is freed along with the domain. Objects saved in the first
+ * version of the file format have no chunks kept apart from their values. */
+static int
+object_read(FILE *file, domain_t *domain, int version)
+{
+    object_t *obj;
+    char     *id = NULL, *name = NULL;
+    uint64_t  cls, elem_size, has_data, count;
+    int       ret = -1;
+
+    if (read_string(file, &id) < 0 || !id || strlen(id) >= ID_MAX_LENGTH || object_find(id) ||
+        read_u64(file, &cls) < 0 || cls > OBJ_DATATYPE)
+        goto done;
+
+    obj = object_create(domain, (obj_class_t)cls, id);
+
+    /* Keep IDs generated from now on from colliding with this one */
+    if (!strncmp(id + 1, "-00000000-0000-0000-0000-", 25)) {
+        uint64_t id_num = strtoull(id + 26, NULL, 16);
+
+        if (id_num >= next_id_g)
+            next_id_g = id_num + 1;
+    }
+
+    if (read_string(file, &obj->cpl_json) < 0 || read_bytes(file, &obj->created, sizeof(double)) < 0 ||
+        read_string(file, &obj->type_json) < 0 || read_u64(file, &elem_size) < 0 ||
+        read_space(file, &obj->space) < 0 || read_u64(file, &has_data) < 0)
+        goto done;
+
+    obj->elem_size = (size_t)elem_size;
+
+    if (has_data) {
+        if (dataset_allocate(obj) < 0)
+            out_of_memory();
+        if (read_bytes(file, obj->data, (size_t)space_nelems(&obj->space) * obj->elem_size) < 0)
+            goto done;
+    }
+
+    if (read_u64(file, &count) < 0)
+        goto done;
+
+    for (uint64_t i = 0; i < count; i++) {
+        link_t  *link;
+        uint64_t link_cls;
+
+        if (read_string(file, &name) < 0 || !name)
+            goto done;
+
+        link = link_add(obj, name);
+        free(name);
+        name = NULL;
+
+        if (read_u64(file, &link_cls) < 0 || link_cls > LINK_EXTERNAL)
+            goto done;
+
+        link->cls = (link_class_t)link_cls;
+
+        if (read_string(file, &link->target_id) < 0 || read_string(file, &link->h5path) < 0 ||
+            read_string(file, &link->h5domain) < 0 || read_bytes(file, &link->created, sizeof(double)) < 0)
+            goto done;
+    }
+
+    if (read_u64(file, &count) < 0)
+        goto done;
+
+    for (uint64_t i = 0; i < count; i++) {
+        attr_t  *attr;
+        uint64_t value_size;
+
+        if (read_string(file, &name) < 0 || !name)
+            goto done;
+
+        attr = attr_add(obj, name);
+        free(name);
+        name = NULL;
+
+        if (read_string(file, &attr->type_json) < 0 || read_u64(file, &elem_size) < 0 ||
+            read_space(file, &attr->space) < 0 || read_u64(file, &value_size) < 0)
+            goto done;
+
+        attr->elem_size = (size_t)elem_size;
+
+        RV_local_buffer_reserve(&attr->value, (size_t)value_size);
+        if (read_bytes(file, attr->value.data, (size_t)value_size) < 0 ||
+            read_bytes(file, &attr->created, sizeof(double)) < 0)
+            goto done;
+
+        attr->value.size                   = (size_t)value_size;
+        attr->value.data[attr->value.size] = '\0';
+    }
+
+    if (version > 1 && read_u64(file, &count) < 0)
+        goto done;
+
+    for (uint64_t i = 0; version > 1 && i < count; i++) {
+        uint64_t index[MAX_RANK];
+        uint64_t filter_mask, data_size;
+        chunk_t *chunk;
+
+        if (read_bytes(file, index, (size_t)obj->space.rank * sizeof(uint64_t)) < 0 ||
+            read_u64(file, &filter_mask) < 0 || read_u64(file, &data_size) < 0)
+            goto done;
+
+        chunk              = chunk_add(obj, index);
+        chunk->filter_mask = (uint32_t)filter_mask;
+
+        RV_local_buffer_reserve(&chunk->data, (size_t)data_size);
+        if (read_bytes(file, chunk->data.data, (size_t)data_size) < 0)
+            goto done;
+
+        chunk->data.size = (size_t)data_size;
+    }
+
+    ret = 0;
+
+done:
+    free(id);
+    free(name);
+
+    return ret;
+}
+
+/* Loads a saved domain. A domain which can't be loaded is left out of the store entirely. */
+static int
+domain_load(const char *file_name)
+{
+    domain_t *domain  = NULL;
+    FILE     *file    = NULL;
+    char     *root_id = NULL;
+    char      magic[sizeof(DOMAIN_FILE_MAGIC) - 1];
+    uint64_t  nobjects;
+    int       version;
+    int       ret = -1;
+
+    if (NULL == (file = fopen(file_name, "rb")))
+        return -1;
+
+    if (read_bytes(file, magic, sizeof(magic)) < 0)
+        goto done;
+
+    if (!memcmp(magic, DOMAIN_FILE_MAGIC, sizeof(magic)))
+        version = 2;
+    else if (!memcmp(magic, DOMAIN_FILE_MAGIC_V1, sizeof(magic)))
+        version = 1;
+    else
+        goto done;
+
+    if (NULL == (domain = calloc(1, sizeof(*domain))))
+        out_of_memory();
+
+    domain->next = domains_g;
+    domains_g    = domain;
+
+    if (read_string(file, &domain->path) < 0 || !domain->path || read_string(file, &root_id) < 0 ||
+        !root_id || read_u64(file, &nobjects) < 0)
+        goto done;
+
+    for (uint64_t i = 0; i < nobjects; i++)
+        if (object_read(file, domain, version) < 0)
+            goto done;
+
+    if (NULL == (domain->root = object_find(root_id)) || domain->root->domain != domain ||
+        domain->root->cls != OBJ_GROUP)
+        goto done;
+
+    ret = 0;
+
+done:
+    if (ret < 0 && domain)
+        domain_delete(domain);
+
+    free(root_id);
+    fclose(file);
+
+    return ret;
+}
+
+/* Frees everything in the store, without saving it */
+static void
+store_free(void)
+{
+    while (domains_g)
+        domain_delete(domains_g);
+
+    free(store_dir_g);
+    store_dir_g = NULL;
+    next_id_g   = 1;
+}
+
+/* Loads every domain saved in an open store directory */
+static int
+store_load(const char *dir, DIR *dirp)
+{
+    struct dirent *entry;
+    int            ret = 0;
+
+    while (NULL != (entry = readdir(dirp))) {
+        size_t            name_len   = strlen(entry->d_name);
+        size_t            suffix_len = strlen(DOMAIN_FILE_SUFFIX);
+        RV_local_buffer_t file_name  = {0};
+
+        if (name_len <= suffix_len || strcmp(entry->d_name + name_len - suffix_len, DOMAIN_FILE_SUFFIX))
+            continue;
+
+        RV_local_buffer_append(&file_name, dir, strlen(dir));
+        RV_local_buffer_append(&file_name, "/", 1);
+        RV_local_buffer_append(&file_name, entry->d_name, name_len);
+
+        if (domain_load(file_name.data) < 0)
+            ret = -1;
+
+        RV_local_buffer_free(&file_name);
+    }
+
+    return ret;
+}
+
+int
+RV_local_store_open(const char *dir)
+{
+    jmp_buf      oom_jmp;
+    DIR         *dirp;
+    volatile int ret = -1;
+
+    if (!dir)
+        return 0;
+
+    if (NULL == (store_dir_g = strdup(dir)))
+        return -1;
+
+    if (NULL == (dirp = opendir(dir))) {
+        /* Start a new store in an empty directory */
+        if (errno == ENOENT && mkdir(dir, 0755) == 0)
+            return 0;
+
+        store_free();
+        return -1;
+    }
+
+    if (!setjmp(oom_jmp)) {
+        oom_jmp_g = &oom_jmp;
+        ret       = store_load(dir, dirp);
+    }
+
+    oom_jmp_g = NULL;
+
+    closedir(dirp);
+
+    if (ret < 0)
+        store_free();
+
+    return ret;
+}
+
+/* Saves every domain to the store's directory, if it has one */
+static int
+store_save(void)
+{
+    int ret = 0;
+
+    for (domain_t *domain = domains_g; domain; domain = domain->next)
+        if (domain_save(domain) < 0)
+            ret = -1;
+
+    return ret;
+}
+
+int
+RV_local_store_close(void)
+{
+    jmp_buf      oom_jmp;
+    volatile int ret = -1;
+
+    if (!setjmp(oom_jmp)) {
+        oom_jmp_g = &oom_jmp;
+        ret       = store_save();
+    }
+
+    oom_jmp_g = NULL;
+
+    store_free();
+
+    return ret;
+}
+
+/*
+ * Request handlers
+ */
+
+static int
+handle_domain(RV_local_request_t *req, RV_local_response_t *resp, domain_t *domain, yajl_val body)
+{
+    if (!strcmp(req->method, "GET")) {
+        if (!domain)
+            return set_error(resp, 404, "domain not found");
+        domain_serialize(&resp->body, domain, req->query && strstr(req->query, "verbose=1") ? 1 : 0);
+    }
+    else if (!strcmp(req->method, "PUT")) {
+        object_t *root;
+        yajl_val  cpl;
+
+        /* Flushing a domain saves it, if the store has a directory */
+        if (req->query && strstr(req->query, "flush=1")) {
+            if (!domain)
+                return set_error(resp, 404, "domain not found");
+            if (domain_save(domain) < 0)
+                return set_error(resp, 500, "can't save domain");
+            resp->status = 204;
+            return 0;
+        }
+
+        if (domain)
+            return set_error(resp, 409, "domain already exists");
+
+        if (NULL == (domain = calloc(1, sizeof(*domain))))
+            out_of_memory();
+
+        domain->path = copy_string(req->domain);
+        domain->next = domains_g;
+        domains_g    = domain;
+
+        root         = object_create(domain, OBJ_GROUP, NULL);
+        domain->root = root;
+
+        cpl = json_get(json_get(body, "group", yajl_t_object), "creationProperties", yajl_t_any);
+        if (cpl)
+            root->cpl_json = json_to_string(cpl);
+
+        resp->status = 201;
+        domain_serialize(&resp->body, domain, 0);
+    }
+    else if (!strcmp(req->method, "DELETE")) {
+        if (!domain)
+            return set_error(resp, 404, "domain not found");
+        domain_remove_file(domain);
+        domain_delete(domain);
+        resp->status = 200;
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else if (!strcmp(req->method, "POST")) {
+        /* Path lookup, with the paths in the request body */
+        yajl_val  paths = json_get(body, "h5paths", yajl_t_array);
+        object_t *parent;
+        char     *parent_id;
+
+        if (!domain)
+            return set_error(resp, 404, "domain not found");
+        if (!paths || paths->u.array.len == 0)
+            return set_error(resp, 400, "missing h5paths");
+
+        parent_id = req->query ? strstr(req->query, "parent_id=") : NULL;
+        if (parent_id) {
+            char id[ID_MAX_LENGTH];
+
+            snprintf(id, sizeof(id), "%.*s", (int)strcspn(parent_id + 10, "&"), parent_id + 10);
+            parent = object_find(id);
+        }
+        else
+            parent = domain->root;
+
+        RV_local_buffer_append(&resp->body, "{\"h5paths\": {", 13);
+        for (size_t i = 0; i < paths->u.array.len; i++) {
+            const char *path = YAJL_GET_STRING(paths->u.array.values[i]);
+            object_t   *obj  = path ? resolve_path(domain, parent, path, 0) : NULL;
+
+            if (!obj)
+                return set_error(resp, 404, "path not found");
+
+            if (i > 0)
+                RV_local_buffer_append(&resp->body, ", ", 2);
+            buffer_append_json_string(&resp->body, path);
+            RV_local_buffer_append(&resp->body, ": ", 2);
+            object_serialize(&resp->body, obj, 0);
+        }
+        RV_local_buffer_append(&resp->body, "}}", 2);
+    }
+    else
+        set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+static int
+handle_create(RV_local_response_t *resp, domain_t *domain, obj_class_t cls, yajl_val body)
+{
+    yajl_val    link = json_get(body, "link", yajl_t_object);
+    yajl_val    val;
+    const char *id   = json_get_string(body, "id");
+    object_t   *parent = NULL, *obj;
+    space_t     space;
+
+    if (!domain)
+        return set_error(resp, 404, "domain not found");
+
+    if (id && object_find(id))
+        return set_error(resp, 409, "object already exists");
+
+    if (link) {
+        const char *name = json_get_string(link, "name");
+
+        if (NULL == (parent = object_find(json_get_string(link, "id"))) || parent->cls != OBJ_GROUP || !name)
+            return set_error(resp, 404, "parent group not found");
+        if (link_find(parent, name))
+            return set_error(resp, 409, "link already exists");
+    }
+
+    /* A dataset can be created as a copy of another, with its data and attributes */
+    if (cls == OBJ_DATASET && json_get_string(body, "copy")) {
+        object_t *src = object_find(json_get_string(body, "copy"));
+
+        if (!src || src->cls != OBJ_DATASET)
+            return set_error(resp, 404, "source dataset not found");
+
+        obj = object_copy(domain, src, id);
+
+        if (parent) {
+            link_t *new_link = link_add(parent, json_get_string(link, "name"));
+
+            new_link->cls       = LINK_HARD;
+            new_link->target_id = copy_string(obj->id);
+        }
+
+        resp->status = 201;
+        object_serialize(&resp->body, obj, 0);
+
+        return 0;
+    }
+
+    if (cls != OBJ_GROUP && NULL == json_get(body, "type", yajl_t_any))
+        return set_error(resp, 400, "missing datatype");
+
+    if (cls == OBJ_DATASET && space_parse(body, &space) < 0)
+        return set_error(resp, 400, "invalid shape");
+
+    obj = object_create(domain, cls, id);
+
+    if (NULL != (val = json_get(body, "creationProperties", yajl_t_any)))
+        obj->cpl_json = json_to_string(val);
+
+    if (cls != OBJ_GROUP) {
+        val = json_get(body, "type", yajl_t_any);
+
+        /* Datasets using a committed datatype return the full datatype */
+        if (YAJL_IS_STRING(val) && object_find(YAJL_GET_STRING(val)))
+            obj->type_json = copy_string(object_find(YAJL_GET_STRING(val))->type_json);
+        else
+            obj->type_json = json_to_string(val);
+        obj->elem_size = type_size(val);
+    }
+
+    if (cls == OBJ_DATASET)
+        obj->space = space;
+
+    if (parent) {
+        link_t *new_link = link_add(parent, json_get_string(link, "name"));
+
+        new_link->cls       = LINK_HARD;
+        new_link->target_id = copy_string(obj->id);
+    }
+
+    resp->status = 201;
+    object_serialize(&resp->body, obj, 0);
+
+    return 0;
+}
+
+static int
+link_set_target(link_t *link, yajl_val target)
+{
+    const char *id       = json_get_string(target, "id");
+    const char *h5path   = json_get_string(target, "h5path");
+    const char *h5domain = json_get_string(target, "h5domain");
+
+    if (id) {
+        if (!object_find(id))
+            return -1;
+        link->cls       = LINK_HARD;
+        link->target_id = copy_string(id);
+    }
+    else if (h5path) {
+        link->cls      = h5domain ? LINK_EXTERNAL : LINK_SOFT;
+        link->h5path   = copy_string(h5path);
+        link->h5domain = copy_string(h5domain);
+    }
+    else
+        return -1;
+
+    return 0;
+}
+
+static int
+compare_links(const void *a, const void *b)
+{
+    return strcmp(((const link_t *)a)->name, ((const link_t *)b)->name);
+}
+
+static int
+compare_attrs(const void *a, const void *b)
+{
+    return strcmp(((const attr_t *)a)->name, ((const attr_t *)b)->name);
+}
+
+static int
+handle_links(RV_local_request_t *req, RV_local_response_t *resp, object_t *group, const char *name,
+             yajl_val body)
+{
+    link_t *link;
+
+    if (group->cls != OBJ_GROUP)
+        return set_error(resp, 400, "object is not a group");
+
+    if (!name) {
+        if (!strcmp(req->method, "GET")) {
+            qsort(group->links, group->nlinks, sizeof(*group->links), compare_links);
+
+            RV_local_buffer_append(&resp->body, "{\"links\": [", 11);
+            for (size_t i = 0; i < group->nlinks; i++) {
+                if (i > 0)
+                    RV_local_buffer_append(&resp->body, ", ", 2);
+                link_serialize(&resp->body, &group->links[i]);
+            }
+            RV_local_buffer_append(&resp->body, "]}", 2);
+        }
+        else if (!strcmp(req->method, "PUT")) {
+            yajl_val links = json_get(body, "links", yajl_t_object);
+
+            if (!links)
+                return set_error(resp, 400, "missing links");
+
+            for (size_t i = 0; i < links->u.object.len; i++)
+                if (link_find(group, links->u.object.keys[i]))
+                    return set_error(resp, 409, "link already exists");
+
+            for (size_t i = 0; i < links->u.object.len; i++) {
+                link_t *new_link = link_add(group, links->u.object.keys[i]);
+
+                if (link_set_target(new_link, links->u.object.values[i]) < 0) {
+                    link_free(&group->links[--group->nlinks]);
+                    return set_error(resp, 400, "invalid link target");
+                }
+            }
+
+            resp->status = 201;
+            RV_local_buffer_append(&resp->body, "{}", 2);
+        }
+        else
+            set_error(resp, 405, "method not allowed");
+
+        return 0;
+    }
+
+    link = link_find(group, name);
+
+    if (!strcmp(req->method, "GET")) {
+        if (!link)
+            return set_error(resp, 404, "link not found");
+
+        RV_local_buffer_append(&resp->body, "{\"link\": ", 9);
+        link_serialize(&resp->body, link);
+        buffer_printf(&resp->body, ", \"created\": %.6f, \"lastModified\": %.6f}", link->created,
+                      link->created);
+    }
+    else if (!strcmp(req->method, "PUT")) {
+        if (link)
+            return set_error(resp, 409, "link already exists");
+
+        if (link_set_target(link_add(group, name), body) < 0) {
+            link_free(&group->links[--group->nlinks]);
+            return set_error(resp, 400, "invalid link target");
+        }
+
+        resp->status = 201;
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else if (!strcmp(req->method, "DELETE")) {
+        if (!link)
+            return set_error(resp, 404, "link not found");
+
+        link_free(link);
+        *link = group->links[--group->nlinks];
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else
+        set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+static int
+handle_attributes(RV_local_request_t *req, RV_local_response_t *resp, object_t *obj, const char *name,
+                  int value, yajl_val body)
+{
+    attr_t *attr;
+
+    if (!name) {
+        if (strcmp(req->method, "GET"))
+            return set_error(resp, 405, "method not allowed");
+
+        qsort(obj->attrs, obj->nattrs, sizeof(*obj->attrs), compare_attrs);
+
+        RV_local_buffer_append(&resp->body, "{\"attributes\": [", 16);
+        for (size_t i = 0; i < obj->nattrs; i++) {
+            if (i > 0)
+                RV_local_buffer_append(&resp->body, ", ", 2);
+            attr_serialize(&resp->body, &obj->attrs[i]);
+        }
+        RV_local_buffer_append(&resp->body, "]}", 2);
+
+        return 0;
+    }
+
+    attr = attr_find(obj, name);
+
+    if (value) {
+        if (!attr)
+            return set_error(resp, 404, "attribute not found");
+
+        /* Attribute values are small, so they are kept in whatever form
+         * they were written and returned unchanged. An attribute which
+         * hasn't been written reads as zeros. */
+        if (!strcmp(req->method, "GET")) {
+            resp->content_type = CONTENT_TYPE_BINARY;
+
+            if (attr->value.size == 0 && attr->elem_size > 0) {
+                size_t size = (size_t)space_nelems(&attr->space) * attr->elem_size;
+
+                RV_local_buffer_reserve(&attr->value, size);
+                memset(attr->value.data, 0, size);
+                attr->value.size = size;
+            }
+
+            RV_local_buffer_append(&resp->body, attr->value.data ? attr->value.data : "", attr->value.size);
+        }
+        else if (!strcmp(req->method, "PUT")) {
+            attr->value.size = 0;
+            RV_local_buffer_append(&attr->value, req->body, req->body_len);
+            RV_local_buffer_append(&resp->body, "{}", 2);
+        }
+        else
+            set_error(resp, 405, "method not allowed");
+
+        return 0;
+    }
+
+    if (!strcmp(req->method, "GET")) {
+        if (!attr)
+            return set_error(resp, 404, "attribute not found");
+        attr_serialize(&resp->body, attr);
+    }
+    else if (!strcmp(req->method, "PUT")) {
+        yajl_val type = json_get(body, "type", yajl_t_any);
+        space_t  space;
+
+        if (attr)
+            return set_error(resp, 409, "attribute already exists");
+        if (!type || space_parse(body, &space) < 0)
+            return set_error(resp, 400, "invalid attribute description");
+
+        attr            = attr_add(obj, name);
+        attr->type_json = json_to_string(type);
+        attr->elem_size = type_size(type);
+        attr->space     = space;
+
+        resp->status = 201;
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else if (!strcmp(req->method, "DELETE")) {
+        if (!attr)
+            return set_error(resp, 404, "attribute not found");
+
+        attr_free(attr);
+        *attr = obj->attrs[--obj->nattrs];
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else
+        set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+/*
+ * Queries
+ */
+
+/* State of the evaluation of a query against one row of a compound dataset.
+ * The query is parsed again for each row, which is slow but keeps the store
+ * free of a separate representation of queries. */
+typedef struct query_t {
+    const char *p;
+    yajl_val    fields;
+    const char *row;
+    int         error;
+} query_t;
+
+static int query_or(query_t *query);
+
+/* Reads the value of the named integer or floating-point member of a row.
+ * Only little-endian members are supported. */
+static int
+query_member_value(const query_t *query, const char *name, size_t name_len, double *value)
+{
+    size_t offset = 0;
+
+    for (size_t i = 0; i < query->fields->u.array.len; i++) {
+        yajl_val    field      = query->fields->u.array.values[i];
+        const char *field_name = json_get_string(field, "name");
+        yajl_val    type       = json_get(field, "type", yajl_t_any);
+        size_t      size       = type_size(type);
+        const char *base;
+        uint64_t    bits = 0;
+
+        if (size == 0)
+            return -1;
+
+        if (!field_name || strlen(field_name) != name_len || strncmp(field_name, name, name_len)) {
+            offset += size;
+            continue;
+        }
+
+        base = YAJL_IS_STRING(type) ? YAJL_GET_STRING(type) : json_get_string(type, "base");
+        if (!base || strlen(base) < 2 || strcmp(base + strlen(base) - 2, "LE") || size > sizeof(bits))
+            return -1;
+
+        for (size_t j = size; j > 0; j--)
+            bits = bits << 8 | (uint8_t)query->row[offset + j - 1];
+
+        if (!strncmp(base, "H5T_IEEE_F", 10) && size == sizeof(float)) {
+            uint32_t bits32 = (uint32_t)bits;
+            float    f;
+
+            memcpy(&f, &bits32, sizeof(f));
+            *value = (double)f;
+        }
+        else if (!strncmp(base, "H5T_IEEE_F", 10) && size == sizeof(double))
+            memcpy(value, &bits, sizeof(*value));
+        else if (!strncmp(base, "H5T_STD_I", 9)) {
+            /* Sign-extend the member to 64 bits */
+            if (size < sizeof(bits) && (bits >> (size * 8 - 1)) & 1)
+                bits |= ~(uint64_t)0 << (size * 8);
+            *value = (double)(int64_t)bits;
+        }
+        else if (!strncmp(base, "H5T_STD_U", 9))
+            *value = (double)bits;
+        else
+            return -1;
+
+        return 0;
+    }
+
+    return -1;
+}
+
+static void
+query_skip_space(query_t *query)
+{
+    while (isspace((unsigned char)*query->p))
+        query->p++;
+}
+
+/* Evaluates a comparison of a member with a number, such as 'temp >= 20.5',
+ * or a parenthesized query */
+static int
+query_comparison(query_t *query)
+{
+    const char *name;
+    size_t      name_len;
+    char        op[3] = {0};
+    char       *end;
+    double      number, value;
+
+    query_skip_space(query);
+
+    if (*query->p == '(') {
+        int result;
+
+        query->p++;
+        result = query_or(query);
+        query_skip_space(query);
+
+        if (*query->p != ')')
+            query->error = 1;
+        else
+            query->p++;
+
+        return result;
+    }
+
+    name = query->p;
+    while (isalnum((unsigned char)*query->p) || *query->p == '_')
+        query->p++;
+    name_len = (size_t)(query->p - name);
+
+    query_skip_space(query);
+
+    for (size_t i = 0; i < 2 && strchr("<>=!", *query->p) && *query->p; i++)
+        op[i] = *query->p++;
+
+    number = strtod(query->p, &end);
+
+    if (name_len == 0 || end == query->p || query_member_value(query, name, name_len, &value) < 0) {
+        query->error = 1;
+        return 0;
+    }
+
+    query->p = end;
+
+    if (!strcmp(op, "<"))
+        return value < number;
+    if (!strcmp(op, "<="))
+        return value <= number;
+    if (!strcmp(op, ">"))
+        return value > number;
+    if (!strcmp(op, ">="))
+        return value >= number;
+    if (!strcmp(op, "=="))
+        return value == number;
+    if (!strcmp(op, "!="))
+        return value != number;
+
+    query->error = 1;
+    return 0;
+}
+
+/* Evaluates comparisons joined by '&', which binds more tightly than '|' */
+static int
+query_and(query_t *query)
+{
+    int result = query_comparison(query);
+
+    for (query_skip_space(query); *query->p == '&'; query_skip_space(query)) {
+        int next;
+
+        query->p += query->p[1] == '&' ? 2 : 1;
+        next   = query_comparison(query);
+        result = result && next;
+    }
+
+    return result;
+}
+
+static int
+query_or(query_t *query)
+{
+    int result = query_and(query);
+
+    for (query_skip_space(query); *query->p == '|'; query_skip_space(query)) {
+        int next;
+
+        query->p += query->p[1] == '|' ? 2 : 1;
+        next   = query_and(query);
+        result = result || next;
+    }
+
+    return result;
+}
+
+/* Reads the rows of a selection of a one-dimensional compound dataset which
+ * match a query, up to the number given by the 'Limit' parameter. Each row
+ * is returned as its index, as a 64-bit integer, followed by its value. */
+static int
+handle_query(RV_local_request_t *req, RV_local_response_t *resp, object_t *dset, const selection_t *sel)
+{
+    const char *text   = strstr(req->query, "query=") + 6;
+    const char *limit  = strstr(req->query, "Limit=");
+    yajl_val    type   = NULL;
+    uint64_t    nmatch = 0;
+    uint64_t    max_rows;
+    size_t      text_len;
+    char       *query_text;
+
+    if (dset->space.rank != 1 || NULL == (type = yajl_tree_parse(dset->type_json, NULL, 0)) ||
+        !json_get_string(type, "class") || strcmp(json_get_string(type, "class"), "H5T_COMPOUND") ||
+        !json_get(type, "fields", yajl_t_array)) {
+        if (type)
+            yajl_tree_free(type);
+        return set_error(resp, 400, "only one-dimensional compound datasets can be queried");
+    }
+
+    /* The query string is decoded as a whole, so the query itself may contain
+     * '&'. It runs up to the next parameter which queries are sent with. */
+    text_len = strlen(text);
+    for (const char *p = text; *p; p++)
+        if (!strncmp(p, "&select=", 8) || !strncmp(p, "&Limit=", 7)) {
+            text_len = (size_t)(p - text);
+            break;
+        }
+
+    if (NULL == (query_text = malloc(text_len + 1)))
+        out_of_memory();
+
+    memcpy(query_text, text, text_len);
+    query_text[text_len] = '\0';
+
+    max_rows = limit ? strtoull(limit + 6, NULL, 10) : sel->count[0];
+
+    resp->content_type = CONTENT_TYPE_BINARY;
+
+    for (uint64_t i = 0; i < sel->count[0] && nmatch < max_rows; i++) {
+        uint64_t index = sel->start[0] + i * sel->step[0];
+        query_t  query = {query_text, json_get(type, "fields", yajl_t_array),
+                         dset->data + index * dset->elem_size, 0};
+        int      match = query_or(&query);
+
+        query_skip_space(&query);
+        if (query.error || *query.p) {
+            set_error(resp, 400, "invalid query");
+            break;
+        }
+
+        if (match) {
+            RV_local_buffer_append(&resp->body, &index, sizeof(index));
+            RV_local_buffer_append(&resp->body, dset->data + index * dset->elem_size, dset->elem_size);
+            nmatch++;
+        }
+    }
+
+    free(query_text);
+    yajl_tree_free(type);
+
+    return resp->status < 300 ? 0 : -1;
+}
+
+/* Gets the dimensions of a dataset's chunks from the layout in its creation properties */
+static int
+dataset_chunk_dims(const object_t *dset, uint64_t *chunk_dims)
+{
+    yajl_val    cpl    = dset->cpl_json ? yajl_tree_parse(dset->cpl_json, NULL, 0) : NULL;
+    yajl_val    layout = json_get(cpl, "layout", yajl_t_object);
+    yajl_val    dims   = json_get(layout, "dims", yajl_t_array);
+    const char *cls    = json_get_string(layout, "class");
+    int         ret    = -1;
+
+    if (cls && !strcmp(cls, "H5D_CHUNKED") && dims && (int)dims->u.array.len == dset->space.rank) {
+        ret = 0;
+
+        for (int i = 0; i < dset->space.rank; i++)
+            if (0 == (chunk_dims[i] = (uint64_t)YAJL_GET_INTEGER(dims->u.array.values[i])))
+                ret = -1;
+    }
+
+    if (cpl)
+        yajl_tree_free(cpl);
+
+    return ret;
+}
+
+/* Gets the number of filters in a dataset's filter pipeline, from its creation properties */
+static int
+dataset_nfilters(const object_t *dset)
+{
+    yajl_val cpl     = dset->cpl_json ? yajl_tree_parse(dset->cpl_json, NULL, 0) : NULL;
+    yajl_val filters = json_get(cpl, "filters", yajl_t_array);
+    int      ret     = filters ? (int)filters->u.array.len : 0;
+
+    if (cpl)
+        yajl_tree_free(cpl);
+
+    return ret;
+}
+
+static int
+handle_value(RV_local_request_t *req, RV_local_response_t *resp, object_t *dset)
+{
+    const char *select = req->query ? strstr(req->query, "select=") : NULL;
+    const char *points = req->query ? strstr(req->query, "points=") : NULL;
+    selection_t sel;
+    uint64_t    nelems;
+
+    if (req->query && strstr(req->query, "fields="))
+        return set_error(resp, 501, "compound member selection is not supported");
+
+    if (points && (select || strcmp(req->method, "PUT")))
+        return set_error(resp, 400, "a point count can only be given for a write of a point selection");
+
+    /* Filters aren't implemented, so a dataset with chunks written with filters applied
+     * can't be read or written as values */
+    if (dset->nchunks)
+        return set_error(resp, 501, "dataset has chunks with filters applied");
+
+    if (select) {
+        if (selection_parse(select + 7, &dset->space, &sel) < 0)
+            return set_error(resp, 400, "invalid selection");
+    }
+    else
+        selection_all(&dset->space, &sel);
+
+    nelems = selection_nelems(&sel);
+
+    if (!strcmp(req->method, "PUT")) {
+        size_t point_size = (size_t)dset->space.rank * sizeof(uint64_t) + dset->elem_size;
+
+        if (req->content_type && strcmp(req->content_type, CONTENT_TYPE_BINARY))
+            return set_error(resp, 501, "only binary transfers are supported");
+
+        /* The element size of a type which can't be sized from its JSON
+         * description is taken from the first write of the whole dataset */
+        if (dset->elem_size == 0 && !select && !points && nelems > 0 && req->body_len % nelems == 0) {
+            dset->elem_size = req->body_len / (size_t)nelems;
+            point_size      = (size_t)dset->space.rank * sizeof(uint64_t) + dset->elem_size;
+        }
+
+        if (dset->elem_size == 0 || dataset_allocate(dset) < 0)
+            return set_error(resp, 500, "can't allocate dataset storage");
+
+        if (points) {
+            /* A point selection: the packed coordinates of each point,
+             * followed by the packed values */
+            char           *end;
+            size_t          npoints = (size_t)strtoull(points + 7, &end, 10);
+            const uint64_t *coords  = (const uint64_t *)req->body;
+            const char     *values;
+
+            if (end == points + 7 || (*end && *end != '&') || dset->space.rank == 0 ||
+                req->body_len != npoints * point_size)
+                return set_error(resp, 400, "request body size doesn't match point selection");
+
+            values = req->body + npoints * (size_t)dset->space.rank * sizeof(uint64_t);
+
+            for (size_t i = 0; i < npoints; i++) {
+                uint64_t offset = 0;
+
+                for (int j = 0; j < dset->space.rank; j++) {
+                    uint64_t coord = coords[i * (size_t)dset->space.rank + (size_t)j];
+
+                    if (coord >= dset->space.dims[j])
+                        return set_error(resp, 400, "point out of range");
+                    offset = offset * dset->space.dims[j] + coord;
+                }
+
+                memcpy(dset->data + offset * dset->elem_size, values + i * dset->elem_size, dset->elem_size);
+            }
+        }
+        else if (req->body_len == nelems * dset->elem_size)
+            selection_copy(dset, &sel, (char *)req->body, 0);
+        else
+            return set_error(resp, 400, "request body size doesn't match selection");
+
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else if (!strcmp(req->method, "GET") || !strcmp(req->method, "POST")) {
+        if (dset->elem_size == 0)
+            return set_error(resp, 501, "can't determine datatype size");
+        if (dataset_allocate(dset) < 0)
+            return set_error(resp, 500, "can't allocate dataset storage");
+
+        if (!strcmp(req->method, "GET") && req->query && strstr(req->query, "query="))
+            return handle_query(req, resp, dset, &sel);
+
+        resp->content_type = CONTENT_TYPE_BINARY;
+
+        if (!strcmp(req->method, "POST")) {
+            /* A point selection, sent as packed coordinates */
+            size_t          coord_size = (size_t)dset->space.rank * sizeof(uint64_t);
+            size_t          npoints    = coord_size ? req->body_len / coord_size : 0;
+            const uint64_t *coords     = (const uint64_t *)req->body;
+
+            if (coord_size == 0 || req->body_len % coord_size)
+                return set_error(resp, 400, "invalid point selection");
+
+            RV_local_buffer_reserve(&resp->body, npoints * dset->elem_size);
+            for (size_t i = 0; i < npoints; i++) {
+                uint64_t offset = 0;
+
+                for (int j = 0; j < dset->space.rank; j++) {
+                    uint64_t coord = coords[i * (size_t)dset->space.rank + (size_t)j];
+
+                    if (coord >= dset->space.dims[j])
+                        return set_error(resp, 400, "point out of range");
+                    offset = offset * dset->space.dims[j] + coord;
+                }
+
+                RV_local_buffer_append(&resp->body, dset->data + offset * dset->elem_size, dset->elem_size);
+            }
+        }
+        else {
+            size_t size = (size_t)nelems * dset->elem_size;
+
+            RV_local_buffer_reserve(&resp->body, size);
+            selection_copy(dset, &sel, resp->body.data, 1);
+            resp->body.size = size;
+        }
+    }
+    else
+        set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+static int
+handle_shape(RV_local_request_t *req, RV_local_response_t *resp, object_t *dset, yajl_val body)
+{
+    if (!strcmp(req->method, "GET")) {
+        RV_local_buffer_append(&resp->body, "{\"shape\": ", 10);
+        space_serialize(&resp->body, &dset->space);
+        RV_local_buffer_append(&resp->body, "}", 1);
+    }
+    else if (!strcmp(req->method, "PUT")) {
+        yajl_val shape = json_get(body, "shape", yajl_t_array);
+        space_t  new_space;
+        char    *new_data = NULL;
+
+        if (dset->space.cls != SPACE_SIMPLE || !shape || (int)shape->u.array.len != dset->space.rank)
+            return set_error(resp, 400, "invalid shape");
+
+        new_space = dset->space;
+        for (int i = 0; i < new_space.rank; i++) {
+            new_space.dims[i] = (uint64_t)YAJL_GET_INTEGER(shape->u.array.values[i]);
+
+            if (new_space.has_maxdims && new_space.maxdims[i] && new_space.dims[i] > new_space.maxdims[i])
+                return set_error(resp, 400, "shape exceeds maximum dimensions");
+        }
+
+        /* Drop the chunks kept apart which lie outside the new extent */
+        if (dset->nchunks) {
+            uint64_t chunk_dims[MAX_RANK];
+
+            if (dataset_chunk_dims(dset, chunk_dims) < 0)
+                return set_error(resp, 500, "dataset with chunks is not chunked");
+
+            for (size_t i = dset->nchunks; i-- > 0;)
+                for (int j = 0; j < new_space.rank; j++)
+                    if (dset->chunks[i].index[j] * chunk_dims[j] >= new_space.dims[j]) {
+                        chunk_remove(dset, &dset->chunks[i]);
+                        break;
+                    }
+        }
+
+        /* Move the existing values into their positions in the new extent */
+        if (dset->data) {
+            object_t    new_dset = *dset;
+            selection_t sel;
+            char       *packed;
+
+            selection_all(&dset->space, &sel);
+            for (int i = 0; i < sel.rank; i++)
+                if (new_space.dims[i] < sel.count[i])
+                    sel.count[i] = new_space.dims[i];
+
+            new_dset.space = new_space;
+            new_dset.data  = NULL;
+
+            if (dataset_allocate(&new_dset) < 0 ||
+                NULL == (packed = malloc((size_t)selection_nelems(&sel) * dset->elem_size + 1))) {
+                free(new_dset.data);
+                return set_error(resp, 500, "can't allocate dataset storage");
+            }
+
+            selection_copy(dset, &sel, packed, 1);
+            selection_copy(&new_dset, &sel, packed, 0);
+            free(packed);
+
+            new_data = new_dset.data;
+        }
+
+        free(dset->data);
+        dset->data  = new_data;
+        dset->space = new_space;
+
+        resp->status = 201;
+        RV_local_buffer_append(&resp->body, "{}", 2);
+    }
+    else
+        set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+/* Transfers a chunk as the bytes it is stored as. A chunk's ID is its dataset's
+ * ID with a 'c' prefix, followed by the index of the chunk in each dimension.
+ * Chunks are stored unfiltered, as part of their dataset's values, unless the
+ * dataset has filters and a chunk is written with any of them applied, in
+ * which case the chunk is kept apart as the bytes written, along with its
+ * filter mask. Chunks kept as part of the values are read with every filter
+ * skipped, and are padded with zeros at the edge of the dataset. */
+static int
+handle_chunk(RV_local_request_t *req, RV_local_response_t *resp, domain_t *domain, const char *chunk_id)
+{
+    const char *filter_mask = req->query ? strstr(req->query, "filter_mask=") : NULL;
+    const char *p;
+    char        dset_id[ID_MAX_LENGTH];
+    uint64_t    chunk_dims[MAX_RANK];
+    uint64_t    index[MAX_RANK];
+    uint32_t    unfiltered_mask;
+    object_t   *dset;
+    object_t    chunk;
+    chunk_t    *kept;
+    selection_t dset_sel, chunk_sel;
+    char       *packed;
+    size_t      chunk_size;
+
+    if (strncmp(chunk_id, "c-", 2) || NULL == (p = strchr(chunk_id, '_')) ||
+        (size_t)(p - chunk_id) >= sizeof(dset_id))
+        return set_error(resp, 400, "invalid chunk ID");
+
+    snprintf(dset_id, sizeof(dset_id), "d-%.*s", (int)(p - chunk_id - 2), chunk_id + 2);
+
+    if (NULL == (dset = object_find(dset_id)) || dset->cls != OBJ_DATASET ||
+        (domain && dset->domain != domain))
+        return set_error(resp, 404, "dataset not found");
+
+    if (dataset_chunk_dims(dset, chunk_dims) < 0)
+        return set_error(resp, 400, "dataset is not chunked");
+
+    if (dset->elem_size == 0)
+        return set_error(resp, 501, "can't determine datatype size");
+
+    /* The mask of a chunk with every filter in the dataset's pipeline skipped */
+    unfiltered_mask = (uint32_t)((UINT64_C(1) << dataset_nfilters(dset)) - 1);
+
+    /* The chunk, as a dataset of its own to copy its part of the dataset's values into or out of */
+    memset(&chunk, 0, sizeof(chunk));
+    chunk.elem_size = dset->elem_size;
+    chunk.space     = dset->space;
+
+    dset_sel.rank  = dset->space.rank;
+    chunk_sel.rank = dset->space.rank;
+
+    for (int i = 0; i < dset->space.rank; i++) {
+        char *end;
+
+        if (*p++ != '_')
+            return set_error(resp, 400, "invalid chunk ID");
+
+        index[i] = strtoull(p, &end, 10);
+        if (end == p || index[i] * chunk_dims[i] >= dset->space.dims[i])
+            return set_error(resp, 404, "chunk not found");
+        p = end;
+
+        chunk.space.dims[i] = chunk_dims[i];
+
+        dset_sel.start[i] = index[i] * chunk_dims[i];
+        dset_sel.count[i] = dset->space.dims[i] - dset_sel.start[i] < chunk_dims[i]
+                                ? dset->space.dims[i] - dset_sel.start[i]
+                                : chunk_dims[i];
+        dset_sel.step[i]  = 1;
+
+        chunk_sel.start[i] = 0;
+        chunk_sel.count[i] = dset_sel.count[i];
+        chunk_sel.step[i]  = 1;
+    }
+
+    if (*p)
+        return set_error(resp, 400, "invalid chunk ID");
+
+    kept       = chunk_find(dset, index);
+    chunk_size = (size_t)space_nelems(&chunk.space) * dset->elem_size;
+
+    if (!strcmp(req->method, "GET")) {
+        resp->content_type = CONTENT_TYPE_BINARY;
+
+        if (kept) {
+            buffer_printf(&resp->headers, FILTER_MASK_HEADER ": %" PRIu32 "\r\n", kept->filter_mask);
+            RV_local_buffer_append(&resp->body, kept->data.data, kept->data.size);
+
+            return 0;
+        }
+
+        if (dataset_allocate(dset) < 0 ||
+            NULL == (packed = malloc((size_t)selection_nelems(&dset_sel) * dset->elem_size + 1)))
+            return set_error(resp, 500, "can't allocate dataset storage");
+
+        buffer_printf(&resp->headers, FILTER_MASK_HEADER ": %" PRIu32 "\r\n", unfiltered_mask);
+
+        RV_local_buffer_reserve(&resp->body, chunk_size);
+        memset(resp->body.data, 0, chunk_size);
+        chunk.data = resp->body.data;
+
+        selection_copy(dset, &dset_sel, packed, 1);
+        selection_copy(&chunk, &chunk_sel, packed, 0);
+        resp->body.size = chunk_size;
+
+        free(packed);
+    }
+    else if (!strcmp(req->method, "PUT")) {
+        uint32_t mask = filter_mask ? (uint32_t)strtoul(filter_mask + strlen("filter_mask="), NULL, 10) : 0;
+
+        /* A chunk with any of the dataset's filters applied is kept as it was written */
+        if ((mask & unfiltered_mask) != unfiltered_mask) {
+            if (!kept)
+                kept = chunk_add(dset, index);
+
+            kept->filter_mask = mask;
+            kept->data.size   = 0;
+            RV_local_buffer_append(&kept->data, req->body, req->body_len);
+            RV_local_buffer_append(&resp->body, "{}", 2);
+
+            return 0;
+        }
+
+        if (req->body_len != chunk_size)
+            return set_error(resp, 400, "request body size doesn't match chunk size");
+
+        if (dataset_allocate(dset) < 0 ||
+            NULL == (packed = malloc((size_t)selection_nelems(&dset_sel) * dset->elem_size + 1)))
+            return set_error(resp, 500, "can't allocate dataset storage");
+
+        if (kept)
+            chunk_remove(dset, kept);
+
+        chunk.data = (char *)req->body;
+
+        selection_copy(&chunk, &chunk_sel, packed, 1);
+        selection_copy(dset, &dset_sel, packed, 0);
+        RV_local_buffer_append(&resp->body, "{}", 2);
+
+        free(packed);
+    }
+    else
+        return set_error(resp, 405, "method not allowed");
+
+    return 0;
+}
+
+static void
+url_decode(char *str)
+{
+    char *out = str;
+
+    for (char *p = str; *p; p++) {
+        if (*p == '%' && isxdigit((unsigned char)p[1]) && isxdigit((unsigned char)p[2])) {
+            char hex[3] = {p[1], p[2], '\0'};
+
+            *out++ = (char)strtol(hex, NULL, 16);
+            p += 2;
+        }
+        else
+            *out++ = *p;
+    }
+
+    *out = '\0';
+}
+
+/*
+ * Requests
+ */
+
+static void
+handle_request(RV_local_request_t *req, RV_local_response_t *resp)
+{
+    domain_t *domain = domain_find(req->domain);
+    yajl_val  body   = NULL;
+    char     *segments[6];
+    int       nsegments = 0;
+    char     *saveptr   = NULL, *segment;
+
+    resp->status       = 200;
+    resp->content_type = CONTENT_TYPE_JSON;
+
+    if (NULL != (req->query = strchr(req->target, '?'))) {
+        *req->query++ = '\0';
+        url_decode(req->query);
+    }
+
+    if (req->body_len > 0 && (!req->content_type || !strcmp(req->content_type, CONTENT_TYPE_JSON)))
+        body = yajl_tree_parse(req->body, NULL, 0);
+
+    for (segment = strtok_r(req->target, "/", &saveptr); segment && nsegments < 6;
+         segment = strtok_r(NULL, "/", &saveptr)) {
+        url_decode(segment);
+        segments[nsegments++] = segment;
+    }
+
+    if (nsegments == 0)
+        handle_domain(req, resp, domain, body);
+    else {
+        obj_class_t cls;
+        object_t   *obj;
+
+        for (cls = OBJ_GROUP; cls <= OBJ_DATATYPE; cls++)
+            if (!strcmp(segments[0], collections_g[cls]))
+                break;
+
+        if (cls > OBJ_DATATYPE && !strcmp(segments[0], "chunks") && nsegments == 2)
+            handle_chunk(req, resp, domain, segments[1]);
+        else if (cls > OBJ_DATATYPE)
+            set_error(resp, 404, "unknown resource");
+        else if (nsegments == 1) {
+            if (strcmp(req->method, "POST"))
+                set_error(resp, 405, "method not allowed");
+            else
+                handle_create(resp, domain, cls, body);
+        }
+        else if (NULL == (obj = object_find(segments[1])) || obj->cls != cls ||
+                 (domain && obj->domain != domain))
+            set_error(resp, 404, "object not found");
+        else if (nsegments == 2) {
+            if (!strcmp(req->method, "GET"))
+                object_serialize(&resp->body, obj,
+                                 req->query && strstr(req->query, "include_attrs=1") ? 1 : 0);
+            else if (!strcmp(req->method, "DELETE")) {
+                if (obj == obj->domain->root)
+                    set_error(resp, 403, "can't delete the root group");
+                else {
+                    object_delete(obj);
+                    RV_local_buffer_append(&resp->body, "{}", 2);
+                }
+            }
+            else
+                set_error(resp, 405, "method not allowed");
+        }
+        else if (!strcmp(segments[2], "links") && nsegments <= 4)
+            handle_links(req, resp, obj, nsegments == 4 ? segments[3] : NULL, body);
+        else if (!strcmp(segments[2], "attributes") &&
+                 (nsegments <= 4 || (nsegments == 5 && !strcmp(segments[4], "value"))))
+            handle_attributes(req, resp, obj, nsegments >= 4 ? segments[3] : NULL, nsegments == 5, body);
+        else if (cls == OBJ_DATASET && nsegments == 3 && !strcmp(segments[2], "value"))
+            handle_value(req, resp, obj);
+        else if (cls == OBJ_DATASET && nsegments == 3 && !strcmp(segments[2], "shape"))
+            handle_shape(req, resp, obj, body);
+        else if (cls == OBJ_DATASET && nsegments == 3 && !strcmp(segments[2], "type") &&
+                 !strcmp(req->method, "GET"))
+            buffer_printf(&resp->body, "{\"type\": %s}", obj->type_json);
+        else
+            set_error(resp, 404, "unknown resource");
+    }
+
+    if (body)
+        yajl_tree_free(body);
+}
+
+int
+RV_local_store_handle_request(RV_local_request_t *req, RV_local_response_t *resp)
+{
+    jmp_buf      oom_jmp;
+    volatile int ret = -1;
+
+    if (!setjmp(oom_jmp)) {
+        oom_jmp_g = &oom_jmp;
+        handle_request(req, resp);
+        ret = 0;
+    }
+
+    oom_jmp_g = NULL;
+
+    /* Whatever part of the response was made is dropped, since there may be no memory for a message */
+    if (ret < 0) {
+        RV_local_buffer_free(&resp->headers);
+        RV_local_buffer_free(&resp->body);
+        resp->status       = 500;
+        resp->content_type = CONTENT_TYPE_JSON;
+    }
+
+    return ret;
+}
@@ -0,0 +1,77 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: An in-process implementation of the subset of the HSDS REST API
+ *          which the connector uses. It serves the connector's local
+ *          transport, and the mock HSDS server used by the benchmarks.
+ */
+
+#ifndef REST_VOL_LOCAL_STORE_H_
+#define REST_VOL_LOCAL_STORE_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A growable buffer, which is always kept NUL-terminated */
+typedef struct RV_local_buffer_t {
+    char  *data;
+    size_t size;
+    size_t nalloc;
+} RV_local_buffer_t;
+
+/* A request to the store, in the form it would take over HTTP. The target is
+ * the path of the request followed by its query string, if any, and is split
+ * and decoded in place while the request is handled, setting the query. A
+ * JSON body must be NUL-terminated. */
+typedef struct RV_local_request_t {
+    const char *method;
+    char       *target;
+    char       *query;
+    const char *domain;
+    const char *content_type;
+    const char *body;
+    size_t      body_len;
+} RV_local_request_t;
+
+/* The response to a request. Headers other than the content type are kept as
+ * "Name: value\r\n" lines. The headers and body must be freed with
+ * RV_local_buffer_free(). */
+typedef struct RV_local_response_t {
+    int               status;
+    const char       *content_type;
+    RV_local_buffer_t headers;
+    RV_local_buffer_t body;
+} RV_local_response_t;
+
+/* Opens the store, loading every domain saved in the given directory. With a
+ * NULL directory, the store is kept in memory only. Domains are saved back to
+ * the directory when they are flushed and when the store is closed. */
+int RV_local_store_open(const char *dir);
+
+/* Saves every domain to the store's directory, if it has one, and frees the store */
+int RV_local_store_close(void);
+
+/* Handles a request. If memory runs out while handling it, the response is a 500
+ * error with no body, and -1 is returned. */
+int RV_local_store_handle_request(RV_local_request_t *req, RV_local_response_t *resp);
+
+void RV_local_buffer_reserve(RV_local_buffer_t *buf, size_t extra);
+void RV_local_buffer_append(RV_local_buffer_t *buf, const void *data, size_t size);
+void RV_local_buffer_free(RV_local_buffer_t *buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REST_VOL_LOCAL_STORE_H_ */
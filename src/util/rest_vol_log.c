@@ -0,0 +1,311 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Leveled, per-category logging for the REST VOL connector, configured at
+ * runtime through the HSDS_LOG environment variables.
+ */
+
+#include <stdarg.h>
+
+#include "rest_vol_log.h"
+
+/* Size of the stack buffer that log messages are formatted into; longer
+ * messages are formatted into a temporary allocation instead */
+#define LOG_MESSAGE_BUFFER_SIZE 1024
+
+/* Enabled level for each category. Builds with connector debugging enabled
+ * log at the debug level unless HSDS_LOG says otherwise; the trace level,
+ * which dumps whole request and response bodies, must be asked for. */
+unsigned char RV_log_levels_g[RV_LOG_NUM_CATEGORIES];
+
+static FILE    *RV_log_file_g       = NULL;
+static hbool_t  RV_log_file_owned_g = FALSE;
+static hbool_t  RV_log_json_g       = FALSE;
+static uint64_t RV_log_start_usec_g = 0;
+
+static const char *const RV_log_category_names_g[RV_LOG_NUM_CATEGORIES] = {
+    "connector", "auth",      "http",     "file", "group", "dataset",
+    "transfer",  "attribute", "datatype", "link", "object"};
+
+static const char *const RV_log_level_names_g[] = {"off", "error", "warn", "info", "debug", "trace"};
+
+static herr_t RV_log_parse_level(const char *name, size_t name_len, unsigned char *level_out);
+static herr_t RV_log_parse_spec(const char *spec);
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_log_init
+ *
+ * Purpose:     Sets the enabled level of each log category from the
+ *              HSDS_LOG environment variable and opens the log file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_log_init(void)
+{
+    const char *spec          = NULL;
+    const char *log_file_name = NULL;
+    const char *log_format    = NULL;
+    herr_t      ret_value     = SUCCEED;
+
+#ifdef RV_CONNECTOR_DEBUG
+    memset(RV_log_levels_g, RV_LOG_LEVEL_DEBUG, sizeof(RV_log_levels_g));
+#else
+    memset(RV_log_levels_g, RV_LOG_LEVEL_OFF, sizeof(RV_log_levels_g));
+#endif
+
+    RV_log_file_g       = stderr;
+    RV_log_file_owned_g = FALSE;
+    RV_log_json_g       = FALSE;
+    RV_log_start_usec_g = RV_now_usec();
+
+    if ((spec = getenv(LOG_ENV_VAR)) && strlen(spec))
+        if (RV_log_parse_spec(spec) < 0)
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid log specification '%s'", spec);
+
+    if ((log_format = getenv(LOG_FORMAT_ENV_VAR)) && strlen(log_format)) {
+        if (!strcmp(log_format, "json"))
+            RV_log_json_g = TRUE;
+        else if (strcmp(log_format, "text"))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "unknown log format '%s'", log_format);
+    }
+
+    if ((log_file_name = getenv(LOG_FILE_ENV_VAR)) && strlen(log_file_name) && strcmp(log_file_name, "-")) {
+        if (NULL == (RV_log_file_g = fopen(log_file_name, "w")))
+            FUNC_GOTO_ERROR(H5E_VOL, H5E_CANTOPENFILE, FAIL, "can't open log file '%s'", log_file_name);
+
+        RV_log_file_owned_g = TRUE;
+    }
+
+done:
+    if (ret_value < 0) {
+        memset(RV_log_levels_g, RV_LOG_LEVEL_OFF, sizeof(RV_log_levels_g));
+        RV_log_file_g = NULL;
+    }
+
+    return ret_value;
+} /* end RV_log_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_log_term
+ *
+ * Purpose:     Disables logging and closes the log file, if one was
+ *              opened.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+herr_t
+RV_log_term(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    memset(RV_log_levels_g, RV_LOG_LEVEL_OFF, sizeof(RV_log_levels_g));
+
+    if (RV_log_file_g && RV_log_file_owned_g && fclose(RV_log_file_g))
+        FUNC_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close log file");
+
+    RV_log_file_g       = NULL;
+    RV_log_file_owned_g = FALSE;
+
+    return ret_value;
+} /* end RV_log_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_log_write
+ *
+ * Purpose:     Formats a message and writes it to the log as a single
+ *              line. This should only be called through the RV_LOG
+ *              macros, which check whether the message's level is
+ *              enabled first.
+ *
+ *              Any trailing newlines in the message are dropped.
+ *
+ * Return:      Nothing
+ */
+void
+RV_log_write(RV_log_category_t cat, RV_log_level_t level, const char *file, int line, const char *fmt, ...)
+{
+    const char *base_name;
+    uint64_t    elapsed_usec;
+    va_list     args;
+    char        stack_buf[LOG_MESSAGE_BUFFER_SIZE];
+    char       *msg = stack_buf;
+    int         msg_len;
+
+    if (!RV_log_file_g)
+        return;
+
+    va_start(args, fmt);
+    msg_len = vsnprintf(stack_buf, sizeof(stack_buf), fmt, args);
+    va_end(args);
+
+    if (msg_len < 0)
+        return;
+
+    if ((size_t)msg_len >= sizeof(stack_buf)) {
+        if (NULL == (msg = (char *)RV_malloc((size_t)msg_len + 1)))
+            msg = stack_buf;
+        else {
+            va_start(args, fmt);
+            vsnprintf(msg, (size_t)msg_len + 1, fmt, args);
+            va_end(args);
+        }
+    }
+
+    msg_len = (int)strlen(msg);
+    while (msg_len > 0 && msg[msg_len - 1] == '\n')
+        msg[--msg_len] = '\0';
+
+    base_name    = (base_name = strrchr(file, '/')) ? base_name + 1 : file;
+    elapsed_usec = RV_now_usec() - RV_log_start_usec_g;
+
+    if (RV_log_json_g) {
+        fprintf(RV_log_file_g, "{\"ts_usec\": %llu, \"level\": \"%s\", \"category\": \"%s\", ",
+                (unsigned long long)elapsed_usec, RV_log_level_names_g[level], RV_log_category_names_g[cat]);
+        fprintf(RV_log_file_g, "\"file\": \"%s\", \"line\": %d, \"message\": ", base_name, line);
+        RV_log_write_json_string(RV_log_file_g, msg);
+        fputs("}\n", RV_log_file_g);
+    }
+    else
+        fprintf(RV_log_file_g, "[%llu.%06llu] %-5s %-9s %s:%d: %s\n",
+                (unsigned long long)(elapsed_usec / 1000000), (unsigned long long)(elapsed_usec % 1000000),
+                RV_log_level_names_g[level], RV_log_category_names_g[cat], base_name, line, msg);
+
+    fflush(RV_log_file_g);
+
+    if (msg != stack_buf)
+        RV_free(msg);
+} /* end RV_log_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_log_dims
+ *
+ * Purpose:     Formats an array of dimension sizes as "[ d1, d2, ... ]"
+ *              into the given buffer, truncating the list with "..." if
+ *              it doesn't fit.
+ *
+ * Return:      The given buffer (can't fail)
+ */
+const char *
+RV_log_dims(const hsize_t *dims, size_t ndims, char *buf, size_t buf_size)
+{
+    size_t buf_len = 0;
+
+    if (!buf || buf_size < sizeof("[ ... ]"))
+        return "";
+
+    buf_len = (size_t)snprintf(buf, buf_size, "[ ");
+
+    for (size_t i = 0; i < ndims; i++) {
+        int len = snprintf(buf + buf_len, buf_size - buf_len, "%s%" PRIuHSIZE, i > 0 ? ", " : "", dims[i]);
+
+        /* Leave room for the closing ", ... ]" */
+        if (len < 0 || buf_len + (size_t)len + sizeof(", ... ]") > buf_size) {
+            snprintf(buf + buf_len, buf_size - buf_len, "%s... ]", i > 0 ? ", " : "");
+            return buf;
+        }
+
+        buf_len += (size_t)len;
+    }
+
+    snprintf(buf + buf_len, buf_size - buf_len, " ]");
+
+    return buf;
+} /* end RV_log_dims() */
+
+/*-------------------------------------------------------------------------
+ * Function:    RV_log_parse_spec
+ *
+ * Purpose:     Parses a log specification of the form
+ *              "level,category=level,..." and sets the enabled level of
+ *              each category accordingly.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ */
+static herr_t
+RV_log_parse_spec(const char *spec)
+{
+    const char *entry = spec;
+
+    while (*entry) {
+        const char   *entry_end = entry + strcspn(entry, ",");
+        const char   *equals    = memchr(entry, '=', (size_t)(entry_end - entry));
+        unsigned char level;
+
+        if (entry_end == entry) {
+            entry++;
+            continue;
+        }
+
+        if (!equals) {
+            if (RV_log_parse_level(entry, (size_t)(entry_end - entry), &level) < 0)
+                return FAIL;
+
+            memset(RV_log_levels_g, level, sizeof(RV_log_levels_g));
+        }
+        else {
+            size_t cat_len = (size_t)(equals - entry);
+            size_t cat;
+
+            if (RV_log_parse_level(equals + 1, (size_t)(entry_end - equals - 1), &level) < 0)
+                return FAIL;
+
+            for (cat = 0; cat < RV_LOG_NUM_CATEGORIES; cat++)
+                if (strlen(RV_log_category_names_g[cat]) == cat_len &&
+                    !strncmp(RV_log_category_names_g[cat], entry, cat_len))
+                    break;
+
+            if (cat == RV_LOG_NUM_CATEGORIES)
+                return FAIL;
+
+            RV_log_levels_g[cat] = level;
+        }
+
+        entry = *entry_end ? entry_end + 1 : entry_end;
+    }
+
+    return SUCCEED;
+} /* end RV_log_parse_spec() */
+
+/* Helper to convert the name of a log level into its value */
+static herr_t
+RV_log_parse_level(const char *name, size_t name_len, unsigned char *level_out)
+{
+    for (size_t i = 0; i < sizeof(RV_log_level_names_g) / sizeof(RV_log_level_names_g[0]); i++)
+        if (strlen(RV_log_level_names_g[i]) == name_len &&
+            !strncmp(RV_log_level_names_g[i], name, name_len)) {
+            *level_out = (unsigned char)i;
+            return SUCCEED;
+        }
+
+    return FAIL;
+} /* end RV_log_parse_level() */
+
+/* Helper to write a string to a file as a quoted, escaped JSON string, which
+ * is shared with the request trace */
+void
+RV_log_write_json_string(FILE *file, const char *str)
+{
+    fputc('"', file);
+
+    for (const unsigned char *c = (const unsigned char *)(str ? str : ""); *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fprintf(file, "\\%c", *c);
+        else if (*c == '\n')
+            fputs("\\n", file);
+        else if (*c < 0x20)
+            fprintf(file, "\\u%04x", *c);
+        else
+            fputc(*c, file);
+    }
+
+    fputc('"', file);
+} /* end RV_log_write_json_string() */
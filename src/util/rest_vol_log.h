@@ -0,0 +1,111 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Contains macros for leveled, per-category logging within the REST VOL connector.
+ */
+
+#ifndef REST_VOL_LOG_H_
+#define REST_VOL_LOG_H_
+
+#include "rest_vol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Environment variables which configure logging. HSDS_LOG is a comma-separated
+ * list of entries, each either a level which applies to every category, or
+ * "category=level" for a single category, e.g. "warn,transfer=debug". Later
+ * entries override earlier ones. Messages are written to stderr unless
+ * HSDS_LOG_FILE names a file, either as plain text or, if HSDS_LOG_FORMAT is
+ * "json", one JSON object per line. */
+#define LOG_ENV_VAR        "HSDS_LOG"
+#define LOG_FILE_ENV_VAR   "HSDS_LOG_FILE"
+#define LOG_FORMAT_ENV_VAR "HSDS_LOG_FORMAT"
+
+/* Severity of a log message. A message is written when its level is at or
+ * below the level enabled for its category. */
+typedef enum {
+    RV_LOG_LEVEL_OFF = 0,
+    RV_LOG_LEVEL_ERROR,
+    RV_LOG_LEVEL_WARN,
+    RV_LOG_LEVEL_INFO,
+    RV_LOG_LEVEL_DEBUG,
+    RV_LOG_LEVEL_TRACE
+} RV_log_level_t;
+
+/* Part of the connector that a log message comes from */
+typedef enum {
+    RV_LOG_CAT_CONNECTOR = 0,
+    RV_LOG_CAT_AUTH,
+    RV_LOG_CAT_HTTP,
+    RV_LOG_CAT_FILE,
+    RV_LOG_CAT_GROUP,
+    RV_LOG_CAT_DATASET,
+    RV_LOG_CAT_TRANSFER,
+    RV_LOG_CAT_ATTRIBUTE,
+    RV_LOG_CAT_DATATYPE,
+    RV_LOG_CAT_LINK,
+    RV_LOG_CAT_OBJECT,
+    RV_LOG_NUM_CATEGORIES
+} RV_log_category_t;
+
+/* Enabled level for each category, indexed by RV_log_category_t */
+extern unsigned char RV_log_levels_g[RV_LOG_NUM_CATEGORIES];
+
+/* Size of a buffer large enough to hold the string produced by RV_log_dims() */
+#define RV_LOG_DIMS_STRING_MAX 256
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RV_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
+#else
+#define RV_UNLIKELY(expr) (expr)
+#endif
+
+/* Check whether messages of the given level are enabled for a category. This
+ * is a single load and compare, so that disabled logging costs next to nothing
+ * and enabling one category does not slow down the others. */
+#define RV_LOG_ENABLED(cat, level) RV_UNLIKELY(RV_log_levels_g[cat] >= (level))
+
+/* Write a printf-style message to the log. The message is only formatted, and
+ * its arguments only evaluated, when the level is enabled for the category. */
+#define RV_LOG(cat, level, ...)                                                                              \
+    do {                                                                                                     \
+        if (RV_LOG_ENABLED(cat, level))                                                                      \
+            RV_log_write(cat, level, __FILE__, __LINE__, __VA_ARGS__);                                       \
+    } while (0)
+
+#define RV_LOG_ERROR(cat, ...) RV_LOG(cat, RV_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define RV_LOG_WARN(cat, ...)  RV_LOG(cat, RV_LOG_LEVEL_WARN, __VA_ARGS__)
+#define RV_LOG_INFO(cat, ...)  RV_LOG(cat, RV_LOG_LEVEL_INFO, __VA_ARGS__)
+#define RV_LOG_DEBUG(cat, ...) RV_LOG(cat, RV_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define RV_LOG_TRACE(cat, ...) RV_LOG(cat, RV_LOG_LEVEL_TRACE, __VA_ARGS__)
+
+herr_t RV_log_init(void);
+herr_t RV_log_term(void);
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((format(printf, 5, 6)))
+#endif
+void RV_log_write(RV_log_category_t cat, RV_log_level_t level, const char *file, int line, const char *fmt,
+                  ...);
+
+/* Helper to format an array of dimension sizes as "[ d1, d2, ... ]" for a log message */
+const char *RV_log_dims(const hsize_t *dims, size_t ndims, char *buf, size_t buf_size);
+
+/* Write a string to a file as a quoted, escaped JSON string; NULL is written as "" */
+void RV_log_write_json_string(FILE *file, const char *str);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REST_VOL_LOG_H_ */
@@ -0,0 +1,151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The list of local sockets which requests are spread across, kept
+ *          apart from the rest of the connector so that it can be tested
+ *          without a server.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rest_vol_config.h"
+
+#ifdef RV_HAVE_GLOB
+#include <glob.h>
+#endif
+
+#include "util/rest_vol_socket_paths.h"
+
+static int RV_socket_paths_add(RV_socket_paths_t *socket_paths, const char *path, size_t path_len);
+
+int
+RV_socket_paths_add_list(RV_socket_paths_t *socket_paths, const char *list, size_t *num_skipped)
+{
+    const char *entry     = list;
+    char       *pattern   = NULL;
+    int         ret_value = 0;
+
+#ifdef RV_HAVE_GLOB
+    (void)num_skipped;
+#endif
+
+    while (*entry) {
+        const char *entry_end  = strchr(entry, SOCKET_PATH_SEPARATOR);
+        size_t      entry_len  = entry_end ? (size_t)(entry_end - entry) : strlen(entry);
+        int         is_pattern = 0;
+
+        for (size_t i = 0; i < entry_len && !is_pattern; i++)
+            is_pattern = (NULL != strchr("*?[", entry[i]));
+
+        if (entry_len > 0 && !is_pattern) {
+            if (RV_socket_paths_add(socket_paths, entry, entry_len) < 0) {
+                ret_value = -1;
+                goto done;
+            }
+        }
+        else if (entry_len > 0) {
+#ifdef RV_HAVE_GLOB
+            glob_t glob_result;
+            int    glob_ret;
+
+            if (NULL == (pattern = malloc(entry_len + 1))) {
+                ret_value = -1;
+                goto done;
+            }
+
+            memcpy(pattern, entry, entry_len);
+            pattern[entry_len] = '\0';
+
+            /* A pattern which matches nothing is skipped */
+            if (0 == (glob_ret = glob(pattern, 0, NULL, &glob_result))) {
+                for (size_t i = 0; i < glob_result.gl_pathc && ret_value == 0; i++)
+                    if (RV_socket_paths_add(socket_paths, glob_result.gl_pathv[i],
+                                            strlen(glob_result.gl_pathv[i])) < 0)
+                        ret_value = -1;
+
+                globfree(&glob_result);
+            }
+            else if (GLOB_NOMATCH != glob_ret)
+                ret_value = -1;
+
+            free(pattern);
+            pattern = NULL;
+
+            if (ret_value < 0)
+                goto done;
+#else
+            /* Patterns can't be expanded, and are never a usable socket path themselves */
+            if (num_skipped)
+                (*num_skipped)++;
+#endif
+        }
+
+        entry = entry_end ? entry_end + 1 : entry + entry_len;
+    }
+
+done:
+    free(pattern);
+
+    return ret_value;
+} /* end RV_socket_paths_add_list() */
+
+const char *
+RV_socket_paths_next(RV_socket_paths_t *socket_paths)
+{
+    const char *path;
+
+    if (socket_paths->num_paths == 0)
+        return NULL;
+
+    path               = socket_paths->paths[socket_paths->next];
+    socket_paths->next = (socket_paths->next + 1) % socket_paths->num_paths;
+
+    return path;
+} /* end RV_socket_paths_next() */
+
+void
+RV_socket_paths_free(RV_socket_paths_t *socket_paths)
+{
+    for (size_t i = 0; i < socket_paths->num_paths; i++)
+        free(socket_paths->paths[i]);
+
+    free(socket_paths->paths);
+
+    socket_paths->paths     = NULL;
+    socket_paths->num_paths = 0;
+    socket_paths->next      = 0;
+} /* end RV_socket_paths_free() */
+
+/* Helper to append a copy of the first path_len bytes of a path to the socket paths */
+static int
+RV_socket_paths_add(RV_socket_paths_t *socket_paths, const char *path, size_t path_len)
+{
+    char **tmp_realloc;
+    char  *path_copy;
+
+    if (NULL == (path_copy = malloc(path_len + 1)))
+        return -1;
+
+    memcpy(path_copy, path, path_len);
+    path_copy[path_len] = '\0';
+
+    if (NULL ==
+        (tmp_realloc = realloc(socket_paths->paths, (socket_paths->num_paths + 1) * sizeof(char *)))) {
+        free(path_copy);
+        return -1;
+    }
+
+    socket_paths->paths                            = tmp_realloc;
+    socket_paths->paths[socket_paths->num_paths++] = path_copy;
+
+    return 0;
+} /* end RV_socket_paths_add() */
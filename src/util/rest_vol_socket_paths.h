@@ -0,0 +1,55 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The list of local sockets which requests are spread across when
+ *          the connector talks to HSDS service nodes through local sockets,
+ *          and the round-robin rotation over it.
+ */
+
+#ifndef REST_VOL_SOCKET_PATHS_H_
+#define REST_VOL_SOCKET_PATHS_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Separator between entries in a list of socket paths */
+#define SOCKET_PATH_SEPARATOR ':'
+
+/* Socket paths in the order they are handed out, and the index of the next one */
+typedef struct RV_socket_paths_t {
+    char **paths;
+    size_t num_paths;
+    size_t next;
+} RV_socket_paths_t;
+
+/* Appends the entries of a SOCKET_PATH_SEPARATOR-separated list to the socket
+ * paths. Where glob() is available, an entry containing any of "*?[" is
+ * expanded to the paths matching it, in sorted order, and a pattern which
+ * matches nothing adds nothing. Elsewhere, patterns are skipped and counted
+ * in *num_skipped, if it isn't NULL. Returns -1 if memory runs out or a
+ * pattern can't be expanded. */
+int RV_socket_paths_add_list(RV_socket_paths_t *socket_paths, const char *list, size_t *num_skipped);
+
+/* Returns the next socket path in a round-robin rotation over the socket
+ * paths, or NULL if there are none */
+const char *RV_socket_paths_next(RV_socket_paths_t *socket_paths);
+
+/* Frees the socket paths, leaving the list empty */
+void RV_socket_paths_free(RV_socket_paths_t *socket_paths);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REST_VOL_SOCKET_PATHS_H_ */
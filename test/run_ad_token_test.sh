@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of the HDF5 REST VOL connector. The full copyright
+# notice, including terms governing use, modification, and redistribution,
+# is contained in the COPYING file, which can be found at the root of the
+# source code distribution tree.
+#
+# A script used to run the Active Directory access token tests against the
+# mock_hsds stand-in server, which serves both the HSDS requests and the
+# token endpoint. It starts the server on a local port, points the connector
+# at it for both, runs test_ad_token and then stops the server.
+#
+# The programs are taken from the MOCK_HSDS and TEST_AD_TOKEN environment
+# variables, or from the current directory by default. The server listens
+# on the port given by MOCK_HSDS_PORT, 5103 by default.
+
+MOCK_HSDS="${MOCK_HSDS:-./mock_hsds}"
+TEST_AD_TOKEN="${TEST_AD_TOKEN:-./test_ad_token}"
+MOCK_HSDS_PORT="${MOCK_HSDS_PORT:-5103}"
+
+# These must match the timings in test_ad_token.c
+MOCK_HSDS_TOKEN_LIFETIME=20 "$MOCK_HSDS" "$MOCK_HSDS_PORT" > /dev/null &
+MOCK_HSDS_PID=$!
+
+# Don't pick up a token config file from the user's home directory
+AD_TOKEN_TEST_HOME=$(mktemp -d)
+
+trap 'kill $MOCK_HSDS_PID 2> /dev/null; rm -rf "$AD_TOKEN_TEST_HOME"' EXIT INT TERM
+
+# Give the server a moment to start listening, and make sure it did
+sleep 1
+if ! kill -0 $MOCK_HSDS_PID 2> /dev/null; then
+    echo "mock_hsds failed to start on port $MOCK_HSDS_PORT" >&2
+    exit 1
+fi
+
+# Authenticate with the mock token endpoint instead of a username and password
+unset HSDS_USERNAME HSDS_PASSWORD
+HOME="$AD_TOKEN_TEST_HOME"
+HSDS_ENDPOINT="http://127.0.0.1:$MOCK_HSDS_PORT"
+HSDS_AD_AUTHORITY="$HSDS_ENDPOINT"
+HSDS_AD_CLIENT_ID=test_client
+HSDS_AD_RESOURCE_ID=test_resource
+HSDS_AD_CLIENT_SECRET=test_secret
+HSDS_AD_REFRESH_MARGIN=15
+HSDS_AD_REFRESH_RETRY=3
+export HOME HSDS_ENDPOINT HSDS_AD_AUTHORITY HSDS_AD_CLIENT_ID HSDS_AD_RESOURCE_ID HSDS_AD_CLIENT_SECRET
+export HSDS_AD_REFRESH_MARGIN HSDS_AD_REFRESH_RETRY
+
+"$TEST_AD_TOKEN"
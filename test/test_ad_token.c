@@ -0,0 +1,422 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests the REST VOL connector's handling of Active Directory access
+ *          tokens against the mock HSDS server, which also stands in for the
+ *          token endpoint: that a token is cached rather than requested again
+ *          for each file, that it is refreshed before it expires, and that a
+ *          failed refresh is only retried after the retry interval.
+ *
+ *          Run by run_ad_token_test.sh, which starts the server with a token
+ *          lifetime of AD_TOKEN_LIFETIME seconds and sets the refresh margin
+ *          and retry interval below.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <curl/curl.h>
+
+#include "hdf5.h"
+
+#include "../src/util/rest_vol_err.h"
+#include "rest_vol_public.h"
+
+/* Must match MOCK_HSDS_TOKEN_LIFETIME, HSDS_AD_REFRESH_MARGIN and
+ * HSDS_AD_REFRESH_RETRY in run_ad_token_test.sh. A token issued at time t
+ * expires at t + AD_TOKEN_LIFETIME - 1 and, since the margin is capped at
+ * half of that, is refreshed from t + AD_TOKEN_REFRESH_AFTER. */
+#define AD_TOKEN_LIFETIME      20
+#define AD_TOKEN_REFRESH_AFTER 10
+#define AD_TOKEN_RETRY         3
+
+#define AD_TOKEN_TEST_FILE_NAME  "/home/ad_token_test/test_file"
+#define AD_TOKEN_TEST_NUM_OPENS  5
+#define AD_TOKEN_TEST_MAX_POLLS  50
+#define AD_TOKEN_TEST_POLL_USECS 100000
+
+/* Token requests the mock token endpoint has counted for a tenant */
+typedef struct token_counts_t {
+    int issued;
+    int refreshed;
+    int failed;
+} token_counts_t;
+
+static int test_ad_token_caching(void);
+static int test_ad_token_refresh_before_expiry(void);
+static int test_ad_token_refresh_retry(void);
+
+static int (*tests[])(void) = {
+    test_ad_token_caching,
+    test_ad_token_refresh_before_expiry,
+    test_ad_token_refresh_retry,
+};
+
+static size_t
+counts_write_cb(char *buffer, size_t size, size_t nmemb, void *userp)
+{
+    char  *response = (char *)userp;
+    size_t len      = strlen(response);
+    size_t data_len = size * nmemb;
+
+    if (len + data_len >= 256)
+        return 0;
+
+    memcpy(response + len, buffer, data_len);
+    response[len + data_len] = '\0';
+
+    return data_len;
+}
+
+/* Asks the mock token endpoint how many token requests it has counted for the tenant */
+static int
+get_token_counts(const char *tenant, token_counts_t *counts)
+{
+    CURL *handle = NULL;
+    char  url[1024];
+    char  response[256] = "";
+    long  status        = 0;
+    int   ret_value     = -1;
+
+    snprintf(url, sizeof(url), "%s/%s/oauth2/v2.0/token", getenv("HSDS_AD_AUTHORITY"), tenant);
+
+    if (NULL == (handle = curl_easy_init()))
+        goto done;
+
+    if (CURLE_OK != curl_easy_setopt(handle, CURLOPT_URL, url) ||
+        CURLE_OK != curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, counts_write_cb) ||
+        CURLE_OK != curl_easy_setopt(handle, CURLOPT_WRITEDATA, response) ||
+        CURLE_OK != curl_easy_perform(handle) ||
+        CURLE_OK != curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status) || status != 200)
+        goto done;
+
+    if (sscanf(response, "{\"issued\": %d, \"refreshed\": %d, \"failed\": %d}", &counts->issued,
+               &counts->refreshed, &counts->failed) == 3)
+        ret_value = 0;
+
+done:
+    if (handle)
+        curl_easy_cleanup(handle);
+
+    return ret_value;
+}
+
+/* Initializes the connector to authenticate as the given tenant and returns a
+ * FAPL which uses it. The tenant is read when the first file is opened. */
+static hid_t
+setup_tenant(const char *tenant)
+{
+    hid_t fapl_id;
+
+    setenv("HSDS_AD_TENANT_ID", tenant, 1);
+
+    if (H5rest_init() < 0)
+        return H5I_INVALID_HID;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0 || H5Pset_fapl_rest_vol(fapl_id) < 0) {
+        H5rest_term();
+        return H5I_INVALID_HID;
+    }
+
+    return fapl_id;
+}
+
+/* Opens and closes the test file, which makes requests of the server */
+static int
+touch_file(hid_t fapl_id)
+{
+    hid_t file_id;
+
+    if ((file_id = H5Fopen(AD_TOKEN_TEST_FILE_NAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        return -1;
+
+    return H5Fclose(file_id) < 0 ? -1 : 0;
+}
+
+/* Keeps making requests until the tenant's counts change, or gives up */
+static int
+poll_token_counts(hid_t fapl_id, const char *tenant, const token_counts_t *before, token_counts_t *after)
+{
+    for (int i = 0; i < AD_TOKEN_TEST_MAX_POLLS; i++) {
+        if (touch_file(fapl_id) < 0 || get_token_counts(tenant, after) < 0)
+            return -1;
+
+        if (memcmp(before, after, sizeof(*after)))
+            return 0;
+
+        usleep(AD_TOKEN_TEST_POLL_USECS);
+    }
+
+    return 0;
+}
+
+/* Sleeps until the given number of seconds have passed since the given time */
+static void
+sleep_until(time_t start, time_t seconds)
+{
+    while (time(NULL) < start + seconds)
+        sleep(1);
+}
+
+/*
+ * A test to check that the access token is requested once and then reused
+ * for each file that is opened.
+ */
+static int
+test_ad_token_caching(void)
+{
+    token_counts_t counts;
+    hid_t          file_id = H5I_INVALID_HID;
+    hid_t          fapl_id = H5I_INVALID_HID;
+
+    TESTING("access token is cached across file opens")
+
+    if ((fapl_id = setup_tenant("cached")) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fcreate(AD_TOKEN_TEST_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create file\n");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+
+    for (int i = 0; i < AD_TOKEN_TEST_NUM_OPENS; i++)
+        if (touch_file(fapl_id) < 0) {
+            H5_FAILED();
+            printf("    couldn't open file\n");
+            goto error;
+        }
+
+    if (get_token_counts("cached", &counts) < 0)
+        TEST_ERROR
+
+    if (counts.issued != 1 || counts.refreshed != 0) {
+        H5_FAILED();
+        printf("    %d tokens were issued and %d refreshed instead of 1 and 0\n", counts.issued,
+               counts.refreshed);
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that the access token is refreshed once its refresh margin
+ * is reached, before it expires, while requests keep being made.
+ */
+static int
+test_ad_token_refresh_before_expiry(void)
+{
+    token_counts_t before, after;
+    time_t         start;
+    hid_t          fapl_id = H5I_INVALID_HID;
+
+    TESTING("access token is refreshed before it expires")
+
+    if ((fapl_id = setup_tenant("refresh")) < 0)
+        TEST_ERROR
+
+    start = time(NULL);
+
+    if (touch_file(fapl_id) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if (get_token_counts("refresh", &before) < 0)
+        TEST_ERROR
+
+    if (before.issued != 1 || before.refreshed != 0) {
+        H5_FAILED();
+        printf("    %d tokens were issued and %d refreshed instead of 1 and 0\n", before.issued,
+               before.refreshed);
+        goto error;
+    }
+
+    /* Nothing is refreshed before the refresh margin is reached */
+    if (touch_file(fapl_id) < 0 || get_token_counts("refresh", &after) < 0)
+        TEST_ERROR
+
+    if (after.refreshed != 0) {
+        H5_FAILED();
+        printf("    token was refreshed too early\n");
+        goto error;
+    }
+
+    sleep_until(start, AD_TOKEN_REFRESH_AFTER + 1);
+
+    if (poll_token_counts(fapl_id, "refresh", &before, &after) < 0)
+        TEST_ERROR
+
+    if (after.refreshed != 1 || after.issued != 1) {
+        H5_FAILED();
+        printf("    %d tokens were issued and %d refreshed instead of 1 and 1\n", after.issued,
+               after.refreshed);
+        goto error;
+    }
+
+    if (time(NULL) >= start + AD_TOKEN_LIFETIME - 1) {
+        H5_FAILED();
+        printf("    token wasn't refreshed until it had expired\n");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that a failed refresh leaves the current token in use and
+ * isn't retried until the retry interval has passed.
+ */
+static int
+test_ad_token_refresh_retry(void)
+{
+    token_counts_t before, after;
+    time_t         start, failed_at;
+    hid_t          fapl_id = H5I_INVALID_HID;
+
+    TESTING("failed access token refresh is retried after a delay")
+
+    if ((fapl_id = setup_tenant("failing")) < 0)
+        TEST_ERROR
+
+    start = time(NULL);
+
+    if (touch_file(fapl_id) < 0 || get_token_counts("failing", &before) < 0)
+        TEST_ERROR
+
+    sleep_until(start, AD_TOKEN_REFRESH_AFTER + 1);
+
+    if (poll_token_counts(fapl_id, "failing", &before, &after) < 0)
+        TEST_ERROR
+
+    failed_at = time(NULL);
+
+    if (after.failed != 1 || after.refreshed != 0) {
+        H5_FAILED();
+        printf("    %d refreshes failed and %d succeeded instead of 1 and 0\n", after.failed,
+               after.refreshed);
+        goto error;
+    }
+
+    /* Requests keep succeeding with the current token, without retrying the refresh yet */
+    before = after;
+    for (int i = 0; i < AD_TOKEN_TEST_NUM_OPENS; i++)
+        if (touch_file(fapl_id) < 0) {
+            H5_FAILED();
+            printf("    couldn't open file after failed refresh\n");
+            goto error;
+        }
+
+    if (get_token_counts("failing", &after) < 0)
+        TEST_ERROR
+
+    if (time(NULL) < failed_at + AD_TOKEN_RETRY - 1 && after.failed != 1) {
+        H5_FAILED();
+        printf("    refresh was retried %d times before the retry interval passed\n", after.failed - 1);
+        goto error;
+    }
+
+    sleep_until(failed_at, AD_TOKEN_RETRY + 1);
+
+    if (poll_token_counts(fapl_id, "failing", &before, &after) < 0)
+        TEST_ERROR
+
+    if (after.failed != 2) {
+        H5_FAILED();
+        printf("    refresh failed %d times instead of 2 after the retry interval\n", after.failed);
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+int
+main(void)
+{
+    int nerrors = 0;
+
+    if (!getenv("HSDS_ENDPOINT") || !getenv("HSDS_AD_AUTHORITY")) {
+        printf("HSDS_ENDPOINT and HSDS_AD_AUTHORITY must be set to the mock HSDS server\n\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+        nerrors += tests[i]();
+
+    if (nerrors) {
+        printf("*** %d TEST%s FAILED ***\n", nerrors, nerrors > 1 ? "S" : "");
+        return 1;
+    }
+
+    puts("All access token tests passed");
+
+    return 0;
+}
@@ -120,6 +120,24 @@ char filename[FILENAME_MAX_LENGTH];
 #define GROUP_PROPERTY_LIST_TEST_GROUP_NAME2 "property_list_test_group2"
 #define GROUP_PROPERTY_LIST_TEST_DUMMY_VAL   100
 
+#define DEFERRED_CREATE_TEST_PARENT_GROUP_NAME "deferred_create_parent_group"
+#define DEFERRED_CREATE_TEST_CHILD_GROUP_NAME  "deferred_create_child_group"
+#define DEFERRED_CREATE_TEST_DSET_NAME         "deferred_create_dset"
+#define DEFERRED_CREATE_TEST_DSET_SPACE_RANK   1
+#define DEFERRED_CREATE_TEST_DSET_DIM_SIZE     16
+
+#define DEFERRED_CREATE_FAILURE_TEST_DUP_GROUP_NAME    "deferred_create_dup_group"
+#define DEFERRED_CREATE_FAILURE_TEST_PARENT_GROUP_NAME "deferred_create_retry_parent_group"
+#define DEFERRED_CREATE_FAILURE_TEST_CHILD_GROUP_NAME  "deferred_create_retry_child_group"
+
+#define CREATE_INTERMEDIATE_TEST_EXISTING_PATH1 "create_intermediate_a"
+#define CREATE_INTERMEDIATE_TEST_EXISTING_PATH2 "create_intermediate_a/b"
+#define CREATE_INTERMEDIATE_TEST_NEW_PATH1      "create_intermediate_a/b/c"
+#define CREATE_INTERMEDIATE_TEST_NEW_PATH2      "create_intermediate_a/b/c/d"
+#define CREATE_INTERMEDIATE_TEST_NEW_PATH3      "create_intermediate_a/b/c/d/e"
+#define CREATE_INTERMEDIATE_TEST_DSET_PATH      "create_intermediate_a/dset"
+#define CREATE_INTERMEDIATE_TEST_THROUGH_DSET   "create_intermediate_a/dset/f/g"
+
 /*****************************************************
  *                                                   *
  *           Plugin Attribute test defines           *
@@ -367,6 +385,90 @@ char filename[FILENAME_MAX_LENGTH];
 #define DATASET_VLEN_IO_TEST_NUM_POINTS 4
 #define DATASET_VLEN_IO_TEST_DSET_NAME  "vlen_io_test_dset"
 
+#define DATASET_WRITE_BUFFER_TEST_DSET_NAME   "write_buffer_test_dset"
+#define DATASET_WRITE_BUFFER_TEST_NUM_ROWS    8
+#define DATASET_WRITE_BUFFER_TEST_ROW_LEN     16
+#define DATASET_WRITE_BUFFER_TEST_BUFFER_SIZE 65536
+
+#define DATASET_APPEND_TEST_DSET_NAME       "append_test_dset"
+#define DATASET_APPEND_TEST_INITIAL_ROWS    2
+#define DATASET_APPEND_TEST_ROWS_PER_APPEND 2
+#define DATASET_APPEND_TEST_NUM_APPENDS     3
+#define DATASET_APPEND_TEST_TOTAL_ROWS                                                                       \
+    (DATASET_APPEND_TEST_INITIAL_ROWS + DATASET_APPEND_TEST_NUM_APPENDS * DATASET_APPEND_TEST_ROWS_PER_APPEND)
+#define DATASET_APPEND_TEST_ROW_LEN     16
+#define DATASET_APPEND_TEST_CHUNK_ROWS  4
+#define DATASET_APPEND_TEST_BUFFER_SIZE 65536
+
+#define DATASET_STORAGE_SIZES_TEST_DSET_NAME  "storage_sizes_test_dset"
+#define DATASET_STORAGE_SIZES_TEST_DSET_NAME2 "storage_sizes_test_dset2"
+#define DATASET_STORAGE_SIZES_TEST_DIM0       8
+#define DATASET_STORAGE_SIZES_TEST_DIM1       16
+#define DATASET_STORAGE_SIZES_TEST_MAX_AGE    600.0
+
+#define DATASET_READ_AHEAD_TEST_DSET_NAME  "read_ahead_test_dset"
+#define DATASET_READ_AHEAD_TEST_NUM_ROWS   32
+#define DATASET_READ_AHEAD_TEST_ROW_LEN    8
+#define DATASET_READ_AHEAD_TEST_BLOCK_ROWS 2
+#define DATASET_READ_AHEAD_TEST_DEPTH      4
+#define DATASET_READ_AHEAD_TEST_SIZE       65536
+
+#define DATASET_READ_BATCH_TEST_DSET_NAME  "read_batch_test_dset"
+#define DATASET_READ_BATCH_TEST_DIM        200000
+#define DATASET_READ_BATCH_TEST_BLOCK_SIZE 100
+#define DATASET_READ_BATCH_TEST_FAR_START  (DATASET_READ_BATCH_TEST_DIM / 2)
+#define DATASET_READ_BATCH_TEST_NEAR_START (3 * DATASET_READ_BATCH_TEST_BLOCK_SIZE)
+#define DATASET_READ_BATCH_TEST_NUM_POINTS 2
+#define DATASET_READ_BATCH_TEST_NUM_SELS   4
+
+#define DATASET_SELECTIONS_TEST_DSET_NAME "selections_test_dset"
+#define DATASET_SELECTIONS_TEST_DIM       16
+#define DATASET_SELECTIONS_TEST_NUM_SELS  4
+
+#define DATASET_CHUNKS_TEST_DSET_NAME    "chunks_test_dset"
+#define DATASET_CHUNKS_TEST_DIM0         8
+#define DATASET_CHUNKS_TEST_DIM1         6
+#define DATASET_CHUNKS_TEST_CHUNK_DIM    4
+#define DATASET_CHUNKS_TEST_NUM_CHUNKS   4
+#define DATASET_CHUNKS_TEST_LOCAL_PREFIX "local://"
+
+#define DATASET_QUERY_TEST_DSET_NAME "query_test_dset"
+#define DATASET_QUERY_TEST_NUM_ROWS  20
+#define DATASET_QUERY_TEST_PAGE_SIZE 4
+#define DATASET_QUERY_TEST_QUERY     "temp > 6.0 & id < 15"
+#define DATASET_QUERY_TEST_QUERY2    "(id == 3) | (id == 17)"
+
+#define DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DIM   10
+#define DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_NUM_POINTS 5
+#define DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DTYPE H5T_NATIVE_INT64
+#define DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_NAME  "dataset_write_point_sel_size_collision"
+
+#define DATASET_FILTERED_CHUNKS_TEST_DSET_NAME   "filtered_chunks_test_dset"
+#define DATASET_FILTERED_CHUNKS_TEST_DIM         8
+#define DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM   4
+#define DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS  2
+#define DATASET_FILTERED_CHUNKS_TEST_FILTER_SIZE 7
+
+#define DATASET_REFRESH_TEST_DSET_NAME    "refresh_test_dset"
+#define DATASET_REFRESH_TEST_INITIAL_ROWS 2
+#define DATASET_REFRESH_TEST_APPEND_ROWS  2
+#define DATASET_REFRESH_TEST_NUM_APPENDS  3
+#define DATASET_REFRESH_TEST_TOTAL_ROWS                                                                      \
+    (DATASET_REFRESH_TEST_INITIAL_ROWS + DATASET_REFRESH_TEST_NUM_APPENDS * DATASET_REFRESH_TEST_APPEND_ROWS)
+#define DATASET_REFRESH_TEST_ROW_LEN     16
+#define DATASET_REFRESH_TEST_CHUNK_ROWS  4
+#define DATASET_REFRESH_TEST_BUFFER_SIZE 65536
+
+#define DATASET_READ_TCONV_TEST_DSET_NAME  "read_tconv_test_dset"
+#define DATASET_READ_TCONV_TEST_DIM        100003
+#define DATASET_READ_TCONV_TEST_MEM_OFFSET 5
+#define DATASET_READ_TCONV_TEST_SENTINEL   -999999
+#define DATASET_READ_TCONV_TEST_VALUE(i)   ((int)((i) % 30000) - 15000)
+
+#define DATASET_VLEN_TCONV_TEST_EXTENT    40
+#define DATASET_VLEN_TCONV_TEST_MAX_LEN   5
+#define DATASET_VLEN_TCONV_TEST_DSET_NAME "vlen_tconv_test_dset"
+
 /*****************************************************
  *                                                   *
  *           Plugin Datatype test defines            *
@@ -458,6 +560,8 @@ char filename[FILENAME_MAX_LENGTH];
 
 #define MOVE_LINK_TEST_SOFT_LINK_TARGET_PATH                                                                 \
     "/" LINK_TEST_GROUP_NAME "/" MOVE_LINK_TEST_GROUP_NAME "/" MOVE_LINK_TEST_DSET_NAME
+#define MOVE_LINK_TEST_HARD_LINK_ABS_PATH                                                                    \
+    "/" LINK_TEST_GROUP_NAME "/" MOVE_LINK_TEST_GROUP_NAME "/" MOVE_LINK_TEST_HARD_LINK_NAME
 #define MOVE_LINK_TEST_HARD_LINK_NAME  "hard_link_to_dset"
 #define MOVE_LINK_TEST_SOFT_LINK_NAME  "soft_link_to_dset"
 #define MOVE_LINK_TEST_GROUP_NAME      "link_move_test_group"
@@ -539,9 +643,48 @@ char filename[FILENAME_MAX_LENGTH];
 
 #define OBJECT_COPY_TEST_SUBGROUP_NAME "object_copy_test"
 #define OBJECT_COPY_TEST_SPACE_RANK    2
+#define OBJECT_COPY_TEST_DIM0          4
+#define OBJECT_COPY_TEST_DIM1          42
+#define OBJECT_COPY_TEST_CHUNK_DIM     4
 #define OBJECT_COPY_TEST_DSET_DTYPE    H5T_NATIVE_INT
 #define OBJECT_COPY_TEST_DSET_NAME     "dset"
 #define OBJECT_COPY_TEST_DSET_NAME2    "dset_copy"
+#define OBJECT_COPY_TEST_DSET_NAME3    "dset_copy_without_attr"
+#define OBJECT_COPY_TEST_ATTR_NAME     "attr"
+#define OBJECT_COPY_TEST_ATTR_VALUE    42
+
+#define OBJECT_COPY_GROUP_TEST_SUBGROUP_NAME   "object_copy_group_test"
+#define OBJECT_COPY_GROUP_TEST_SRC_NAME        "src"
+#define OBJECT_COPY_GROUP_TEST_COPY_NAME       "copy"
+#define OBJECT_COPY_GROUP_TEST_SHALLOW_NAME    "shallow_copy"
+#define OBJECT_COPY_GROUP_TEST_DSET_NAME       "dset"
+#define OBJECT_COPY_GROUP_TEST_LINK_NAME       "dset_link"
+#define OBJECT_COPY_GROUP_TEST_SUB_NAME        "sub"
+#define OBJECT_COPY_GROUP_TEST_INNER_NAME      "inner"
+#define OBJECT_COPY_GROUP_TEST_PARENT_NAME     "parent"
+#define OBJECT_COPY_GROUP_TEST_DSET_DTYPE      H5T_NATIVE_INT
+#define OBJECT_COPY_GROUP_TEST_DSET_DIM        8
+#define OBJECT_COPY_GROUP_TEST_DSET_SPACE_RANK 1
+#define OBJECT_COPY_GROUP_TEST_SRC_DSET_PATH                                                                 \
+    OBJECT_COPY_GROUP_TEST_SRC_NAME "/" OBJECT_COPY_GROUP_TEST_DSET_NAME
+#define OBJECT_COPY_GROUP_TEST_SRC_SUB_PATH                                                                  \
+    OBJECT_COPY_GROUP_TEST_SRC_NAME "/" OBJECT_COPY_GROUP_TEST_SUB_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_DSET_PATH                                                                \
+    OBJECT_COPY_GROUP_TEST_COPY_NAME "/" OBJECT_COPY_GROUP_TEST_DSET_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_LINK_PATH                                                                \
+    OBJECT_COPY_GROUP_TEST_COPY_NAME "/" OBJECT_COPY_GROUP_TEST_LINK_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_SUB_PATH                                                                 \
+    OBJECT_COPY_GROUP_TEST_COPY_NAME "/" OBJECT_COPY_GROUP_TEST_SUB_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_INNER_PATH                                                               \
+    OBJECT_COPY_GROUP_TEST_COPY_SUB_PATH "/" OBJECT_COPY_GROUP_TEST_INNER_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_PARENT_PATH                                                              \
+    OBJECT_COPY_GROUP_TEST_COPY_SUB_PATH "/" OBJECT_COPY_GROUP_TEST_PARENT_NAME
+#define OBJECT_COPY_GROUP_TEST_COPY_CYCLE_PATH                                                               \
+    OBJECT_COPY_GROUP_TEST_COPY_PARENT_PATH "/" OBJECT_COPY_GROUP_TEST_DSET_NAME
+#define OBJECT_COPY_GROUP_TEST_SHALLOW_SUB_PATH                                                              \
+    OBJECT_COPY_GROUP_TEST_SHALLOW_NAME "/" OBJECT_COPY_GROUP_TEST_SUB_NAME
+#define OBJECT_COPY_GROUP_TEST_SHALLOW_INNER_PATH                                                            \
+    OBJECT_COPY_GROUP_TEST_SHALLOW_SUB_PATH "/" OBJECT_COPY_GROUP_TEST_INNER_NAME
 
 #define H5O_CLOSE_TEST_SPACE_RANK 2
 #define H5O_CLOSE_TEST_DSET_NAME  "h5o_close_test_dset"
@@ -603,6 +746,45 @@ char filename[FILENAME_MAX_LENGTH];
 #define COMPOUND_WITH_SYMBOLS_IN_MEMBER_NAMES_TEST_DSET_RANK    2
 #define COMPOUND_WITH_SYMBOLS_IN_MEMBER_NAMES_TEST_DSET_NAME    "dset"
 
+#define REQUEST_REPLAY_TEST_CAPTURE_FILE_NAME "test_rest_vol_replay.cap"
+#define REQUEST_REPLAY_TEST_ENDPOINT          "http://replay.invalid"
+#define REQUEST_REPLAY_TEST_ROOT_RESPONSE                                                                   \
+    "{\"root\": \"g-01234567-89ab-cdef-0123-456789abcdef\", \"version\": \"0.8.0\"}"
+
+#define REQUEST_TRACE_TEST_FILE_NAME  "test_rest_vol_trace.json"
+#define REQUEST_TRACE_TEST_GROUP_NAME "request_trace_test"
+#define REQUEST_TRACE_TEST_ATTR_NAME  "attr"
+#define REQUEST_TRACE_TEST_ATTR_DIM   4
+#define REQUEST_TRACE_TEST_NUM_OPS    5
+#define REQUEST_TRACE_TEST_LINE_MAX   4096
+
+#define LOG_FORMAT_TEST_FILE_NAME       "test_rest_vol_log.json"
+#define LOG_FORMAT_TEST_SPEC            "warn,,file=debug,transfer=off"
+#define LOG_FORMAT_TEST_NUM_BAD_CONFIGS 4
+#define LOG_FORMAT_TEST_LINE_MAX        4096
+
+#define CONNECTION_INFO_CACHE_TEST_HOME      "/nonexistent/rest_vol_test_home"
+#define CONNECTION_INFO_CACHE_TEST_NUM_OPENS 3
+
+#define OBJECT_TABLES_TEST_GROUP_NAME "object_tables_test"
+#define OBJECT_TABLES_TEST_DSET_NAME  "dset"
+#define OBJECT_TABLES_TEST_ATTR_NAME  "attr"
+#define OBJECT_TABLES_TEST_DTYPE_NAME "dtype"
+#define OBJECT_TABLES_TEST_ROWS       4
+#define OBJECT_TABLES_TEST_ROW_LEN    8
+#define OBJECT_TABLES_TEST_NUM_ROUNDS 2
+#define OBJECT_TABLES_TEST_GROUP_PATH "/" MISCELLANEOUS_TEST_GROUP_NAME "/" OBJECT_TABLES_TEST_GROUP_NAME
+
+#define LOCAL_STORE_PERSISTENCE_TEST_PREFIX     "local://"
+#define LOCAL_STORE_PERSISTENCE_TEST_GROUP_NAME "local_store_persistence_test"
+#define LOCAL_STORE_PERSISTENCE_TEST_DSET_NAME  "dset"
+#define LOCAL_STORE_PERSISTENCE_TEST_LINK_NAME  "soft_link_to_dset"
+#define LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM   16
+#define LOCAL_STORE_PERSISTENCE_TEST_GROUP_PATH                                                              \
+    "/" MISCELLANEOUS_TEST_GROUP_NAME "/" LOCAL_STORE_PERSISTENCE_TEST_GROUP_NAME
+#define LOCAL_STORE_PERSISTENCE_TEST_DSET_PATH                                                               \
+    LOCAL_STORE_PERSISTENCE_TEST_GROUP_PATH "/" LOCAL_STORE_PERSISTENCE_TEST_DSET_NAME
+
 /* Connector initialization/termination test */
 static int test_setup_connector(void);
 
@@ -613,6 +795,7 @@ static int test_nonexistent_file(void);
 static int test_get_file_intent(void);
 static int test_get_file_name(void);
 static int test_file_reopen(void);
+static int test_request_metrics(void);
 static int test_unused_file_API_calls(void);
 static int test_file_property_lists(void);
 
@@ -625,6 +808,9 @@ static int test_get_group_info(void);
 static int test_nonexistent_group(void);
 static int test_unused_group_API_calls(void);
 static int test_group_property_lists(void);
+static int test_deferred_group_create(void);
+static int test_deferred_create_failure(void);
+static int test_create_intermediate_groups(void);
 
 /* Attribute interface tests */
 static int test_create_attribute_on_root(void);
@@ -661,6 +847,7 @@ static int test_create_dataset_creation_properties(void);
 static int test_write_dataset_small_all(void);
 static int test_write_dataset_small_hyperslab(void);
 static int test_write_dataset_small_point_selection(void);
+static int test_write_dataset_point_selection_size_collision(void);
 #ifndef NO_LARGE_TESTS
 static int test_write_dataset_large_all(void);
 static int test_write_dataset_large_hyperslab(void);
@@ -673,12 +860,24 @@ static int test_read_dataset_small_point_selection(void);
 static int test_read_dataset_large_all(void);
 static int test_read_dataset_large_hyperslab(void);
 static int test_read_dataset_large_point_selection(void);
+static int test_read_dataset_with_type_conversion(void);
 #endif
 static int test_write_dataset_data_verification(void);
 static int test_dataset_set_extent(void);
 static int test_unused_dataset_API_calls(void);
 static int test_dataset_property_lists(void);
 static int test_dataset_vlen_io(void);
+static int test_dataset_vlen_read_tconv(void);
+static int test_dataset_write_buffer(void);
+static int test_dataset_append(void);
+static int test_dataset_refresh(void);
+static int test_get_storage_sizes(void);
+static int test_dataset_read_ahead(void);
+static int test_dataset_read_batch(void);
+static int test_dataset_selections(void);
+static int test_dataset_chunks(void);
+static int test_dataset_filtered_chunks(void);
+static int test_dataset_query(void);
 
 /* Committed Datatype interface tests */
 static int test_create_committed_datatype(void);
@@ -719,6 +918,7 @@ static int test_open_datatype_generically(void);
 static int test_object_exists(void);
 static int test_incr_decr_refcount(void);
 static int test_h5o_copy(void);
+static int test_h5o_copy_group(void);
 static int test_h5o_close(void);
 static int test_object_visit(void);
 static int test_create_obj_ref(void);
@@ -738,6 +938,12 @@ static int test_absolute_vs_relative_path(void);
 static int test_url_encoding(void);
 static int test_symbols_in_compound_field_name(void);
 static int test_double_init_free(void);
+static int test_request_replay(void);
+static int test_request_trace(void);
+static int test_log_settings(void);
+static int test_connection_info_caching(void);
+static int test_object_tables_first_use(void);
+static int test_local_store_persistence(void);
 
 static herr_t attr_iter_callback1(hid_t location_id, const char *attr_name, const H5A_info_t *ainfo,
                                   void *op_data);
@@ -755,19 +961,30 @@ static herr_t link_visit_callback3(hid_t group_id, const char *name, const H5L_i
 static herr_t object_visit_callback(hid_t o_id, const char *name, const H5O_info2_t *object_info,
                                     void *op_data);
 
+static int write_replay_capture(const char *url, uint32_t version);
+
 static hid_t generate_random_datatype(H5T_class_t parent_class);
 
 static int (*setup_tests[])(void) = {test_setup_connector, NULL};
 
 static int (*file_tests[])(void) = {
-    test_create_file,           test_get_file_info,       test_nonexistent_file,
-    test_get_file_intent,       test_get_file_name,       test_file_reopen,
-    test_unused_file_API_calls, test_file_property_lists, NULL};
-
-static int (*group_tests[])(void) = {
-    test_create_group_invalid_loc_id, test_create_group_under_root, test_create_group_under_existing_group,
-    test_create_anonymous_group,      test_get_group_info,          test_nonexistent_group,
-    test_unused_group_API_calls,      test_group_property_lists,    NULL};
+    test_create_file,     test_get_file_info,         test_nonexistent_file,
+    test_get_file_intent, test_get_file_name,         test_file_reopen,
+    test_request_metrics, test_unused_file_API_calls, test_file_property_lists,
+    NULL};
+
+static int (*group_tests[])(void) = {test_create_group_invalid_loc_id,
+                                     test_create_group_under_root,
+                                     test_create_group_under_existing_group,
+                                     test_create_anonymous_group,
+                                     test_get_group_info,
+                                     test_nonexistent_group,
+                                     test_unused_group_API_calls,
+                                     test_group_property_lists,
+                                     test_deferred_group_create,
+                                     test_deferred_create_failure,
+                                     test_create_intermediate_groups,
+                                     NULL};
 
 static int (*attribute_tests[])(void) = {test_create_attribute_on_root,
                                          test_create_attribute_on_dataset,
@@ -803,6 +1020,7 @@ static int (*dataset_tests[])(void) = {test_create_dataset_under_root,
                                        test_write_dataset_small_all,
                                        test_write_dataset_small_hyperslab,
                                        test_write_dataset_small_point_selection,
+                                       test_write_dataset_point_selection_size_collision,
 #ifndef NO_LARGE_TESTS
                                        test_write_dataset_large_all,
                                        test_write_dataset_large_hyperslab,
@@ -815,12 +1033,24 @@ static int (*dataset_tests[])(void) = {test_create_dataset_under_root,
                                        test_read_dataset_large_all,
                                        test_read_dataset_large_hyperslab,
                                        test_read_dataset_large_point_selection,
+                                       test_read_dataset_with_type_conversion,
 #endif
                                        test_write_dataset_data_verification,
                                        test_dataset_set_extent,
                                        test_unused_dataset_API_calls,
                                        test_dataset_property_lists,
                                        test_dataset_vlen_io,
+                                       test_dataset_vlen_read_tconv,
+                                       test_dataset_write_buffer,
+                                       test_dataset_append,
+                                       test_dataset_refresh,
+                                       test_get_storage_sizes,
+                                       test_dataset_read_ahead,
+                                       test_dataset_read_batch,
+                                       test_dataset_selections,
+                                       test_dataset_chunks,
+                                       test_dataset_filtered_chunks,
+                                       test_dataset_query,
                                        NULL};
 
 static int (*type_tests[])(void) = {test_create_committed_datatype,
@@ -861,6 +1091,7 @@ static int (*object_tests[])(void) = {test_open_dataset_generically,
                                       test_object_exists,
                                       test_incr_decr_refcount,
                                       test_h5o_copy,
+                                      test_h5o_copy_group,
                                       test_h5o_close,
                                       test_object_visit,
                                       test_create_obj_ref,
@@ -880,6 +1111,12 @@ static int (*misc_tests[])(void) = {test_open_link_without_leading_slash,
                                     test_url_encoding,
                                     test_symbols_in_compound_field_name,
                                     test_double_init_free,
+                                    test_request_replay,
+                                    test_request_trace,
+                                    test_log_settings,
+                                    test_connection_info_caching,
+                                    test_object_tables_first_use,
+                                    test_local_store_persistence,
                                     NULL};
 
 static int (**tests[])(void) = {
@@ -1438,6 +1675,98 @@ error:
     return 1;
 }
 
+static int
+test_request_metrics(void)
+{
+    H5rest_stats_t stats;
+    hid_t          file_id = -1, fapl_id = -1;
+
+    TESTING("request metrics")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Checking that the requests made to open the file were counted\n");
+#endif
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_GET].requests == 0 || stats.op[H5REST_OP_GET].responses_2xx == 0) {
+        H5_FAILED();
+        printf("    GET requests made to open the file weren't counted\n");
+        goto error;
+    }
+
+    if (stats.op[H5REST_OP_GET].bytes_received == 0) {
+        H5_FAILED();
+        printf("    bytes received by GET requests weren't counted\n");
+        goto error;
+    }
+
+    if (H5rest_get_latency_percentile(&stats.op[H5REST_OP_GET], 50.0) >
+            H5rest_get_latency_percentile(&stats.op[H5REST_OP_GET], 99.0) ||
+        H5rest_get_latency_percentile(&stats.op[H5REST_OP_GET], 99.0) >
+            stats.op[H5REST_OP_GET].latency_max_usec) {
+        H5_FAILED();
+        printf("    request latency percentiles were inconsistent\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Checking that the metrics can be reset\n");
+#endif
+
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_GET].requests != 0 ||
+        H5rest_get_latency_percentile(&stats.op[H5REST_OP_GET], 50.0) != 0) {
+        H5_FAILED();
+        printf("    request metrics weren't reset\n");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
 static int
 test_unused_file_API_calls(void)
 {
@@ -2306,24 +2635,18 @@ error:
     return 1;
 }
 
-/*****************************************************
- *                                                   *
- *              Plugin Attribute tests               *
- *                                                   *
- *****************************************************/
-
 static int
-test_create_attribute_on_root(void)
+test_deferred_group_create(void)
 {
-    hsize_t dims[ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK];
+    hsize_t dims[DEFERRED_CREATE_TEST_DSET_SPACE_RANK] = {DEFERRED_CREATE_TEST_DSET_DIM_SIZE};
+    int     write_buf[DEFERRED_CREATE_TEST_DSET_DIM_SIZE];
+    int     read_buf[DEFERRED_CREATE_TEST_DSET_DIM_SIZE];
     size_t  i;
-    htri_t  attr_exists;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   attr_id = -1, attr_id2 = -1;
-    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
-    hid_t   space_id = -1;
+    hid_t   container_group = -1, parent_group = -1, child_group = -1;
+    hid_t   dset_id = -1, space_id = -1;
 
-    TESTING("create, open and close attribute on root group")
+    TESTING("deferred creation of groups and datasets")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -2332,6 +2655,8 @@ test_create_attribute_on_root(void)
         TEST_ERROR
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
+    if (H5Pset_fapl_rest_deferred_create(fapl_id, TRUE) < 0)
+        TEST_ERROR
 
     if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -2339,175 +2664,108 @@ test_create_attribute_on_root(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on root group with H5Acreate2\n");
-#endif
-
-    if ((attr_id = H5Acreate2(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, attr_dtype1, space_id, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on root group with H5Acreate_by_name\n");
-#endif
-
-    if ((attr_id2 = H5Acreate_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, attr_dtype2,
-                                      space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, GROUP_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute on object by name\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the attributes exist\n");
+    puts("Queueing creation of a group, a subgroup of it and a dataset in the subgroup\n");
 #endif
 
-    /* Verify the attributes have been created */
-    if ((attr_exists = H5Aexists(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
-
-    if (!attr_exists) {
+    if ((parent_group = H5Gcreate2(container_group, DEFERRED_CREATE_TEST_PARENT_GROUP_NAME, H5P_DEFAULT,
+                                   H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2)) < 0) {
+    if ((child_group = H5Gcreate2(parent_group, DEFERRED_CREATE_TEST_CHILD_GROUP_NAME, H5P_DEFAULT,
+                                  H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't create subgroup\n");
         goto error;
     }
 
-    if (!attr_exists) {
-        H5_FAILED();
-        printf("    attribute did not exist\n");
-        goto error;
-    }
+    if ((space_id = H5Screate_simple(DEFERRED_CREATE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
 
-    if ((attr_exists = H5Aexists_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT)) <
-        0) {
+    if ((dset_id = H5Dcreate2(child_group, DEFERRED_CREATE_TEST_DSET_NAME, H5T_NATIVE_INT, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists by H5Aexists_by_name\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (!attr_exists) {
-        H5_FAILED();
-        printf("    attribute did not exist\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to the dataset, which sends the queued creation requests first\n");
+#endif
 
-    if ((attr_exists = H5Aexists_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT)) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists by H5Aexists_by_name\n");
-        goto error;
-    }
+    for (i = 0; i < DEFERRED_CREATE_TEST_DSET_DIM_SIZE; i++)
+        write_buf[i] = (int)i;
 
-    if (!attr_exists) {
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    /* Now close the attributes and verify we can open them */
-    if (H5Aclose(attr_id) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
+    if (H5Gclose(child_group) < 0)
         TEST_ERROR
+    if (H5Gclose(parent_group) < 0)
+        TEST_ERROR
+
+    dset_id = child_group = parent_group = -1;
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open the attributes with H5Aopen\n");
+    puts("Re-opening the objects by path\n");
 #endif
 
-    if ((attr_id = H5Aopen(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT)) < 0) {
+    if ((parent_group = H5Gopen2(container_group, DEFERRED_CREATE_TEST_PARENT_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    couldn't open group after it was created\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Aopen(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT)) < 0) {
+    if ((child_group = H5Gopen2(parent_group, DEFERRED_CREATE_TEST_CHILD_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    couldn't open subgroup after it was created\n");
         goto error;
     }
 
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open the attributes with H5Aopen_by_name\n");
-#endif
-
-    if ((attr_id = H5Aopen_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT,
-                                   H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dopen2(child_group, DEFERRED_CREATE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute by name\n");
+        printf("    couldn't open dataset after it was created\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Aopen_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT,
-                                    H5P_DEFAULT)) < 0) {
+    memset(read_buf, 0, sizeof(read_buf));
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute by name\n");
+        printf("    couldn't read from dataset\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Aclose(attr_id) < 0)
-            TEST_ERROR
-        if (H5Aclose(attr_id2) < 0)
-            TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Attempting to open the attributes with H5Aopen_by_idx\n");
-#endif
-
-        if ((attr_id =
-                 H5Aopen_by_idx(file_id, "/", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    failed to open attribute by index!\n");
-            goto error;
-        }
-
-        if ((attr_id2 =
-                 H5Aopen_by_idx(file_id, "/", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    for (i = 0; i < DEFERRED_CREATE_TEST_DSET_DIM_SIZE; i++)
+        if (read_buf[i] != write_buf[i]) {
             H5_FAILED();
-            printf("    failed to open attribute by index!\n");
+            printf("    data read from dataset didn't match data written at index %zu\n", i);
             goto error;
         }
-    }
-    H5E_END_TRY;
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype1) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype2) < 0)
+    if (H5Gclose(child_group) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id) < 0)
+    if (H5Gclose(parent_group) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
+    if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
@@ -2524,10 +2782,10 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(space_id);
-        H5Tclose(attr_dtype1);
-        H5Tclose(attr_dtype2);
-        H5Aclose(attr_id);
-        H5Aclose(attr_id2);
+        H5Dclose(dset_id);
+        H5Gclose(child_group);
+        H5Gclose(parent_group);
+        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -2538,22 +2796,14 @@ error:
 }
 
 static int
-test_create_attribute_on_dataset(void)
+test_deferred_create_failure(void)
 {
-    hsize_t dset_dims[ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK];
-    hsize_t attr_dims[ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK];
-    size_t  i;
-    htri_t  attr_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   attr_id = -1, attr_id2 = -1;
-    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
-    hid_t   dset_dtype    = -1;
-    hid_t   dset_space_id = -1;
-    hid_t   attr_space_id = -1;
+    htri_t link_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, dup_group = -1, dup_group2 = -1;
+    hid_t  parent_group = -1, child_group = -1;
 
-    TESTING("create attribute on dataset")
+    TESTING("failure to send deferred creation requests")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -2562,6 +2812,8 @@ test_create_attribute_on_dataset(void)
         TEST_ERROR
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
+    if (H5Pset_fapl_rest_deferred_create(fapl_id, TRUE) < 0)
+        TEST_ERROR
 
     if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -2569,180 +2821,108 @@ test_create_attribute_on_dataset(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, GROUP_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK; i++)
-        dset_dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
-    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK; i++)
-        attr_dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
+    if ((dup_group = H5Gcreate2(container_group, DEFERRED_CREATE_FAILURE_TEST_DUP_GROUP_NAME, H5P_DEFAULT,
+                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create group\n");
+        goto error;
+    }
 
-    if ((dset_space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
-        TEST_ERROR
-    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK, attr_dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dcreate2(container_group, ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME, dset_dtype,
-                              dset_space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(container_group, DEFERRED_CREATE_FAILURE_TEST_DUP_GROUP_NAME, H5P_DEFAULT)) <
+        0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on dataset with H5Acreate2\n");
-#endif
-
-    if ((attr_id = H5Acreate2(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, attr_dtype1, attr_space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    deferred group wasn't created\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on dataset with H5Acreate_by_name\n");
+    puts("Queueing a group whose name is taken along with a group and a subgroup of it\n");
 #endif
 
-    if ((attr_id2 = H5Acreate_by_name(file_id,
-                                      "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
-                                      ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, attr_dtype2, attr_space_id,
-                                      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* The server rejects this group only once the queued requests are sent */
+    if ((dup_group2 = H5Gcreate2(container_group, DEFERRED_CREATE_FAILURE_TEST_DUP_GROUP_NAME, H5P_DEFAULT,
+                                 H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute on object by name\n");
+        printf("    couldn't queue creation of group with duplicate name\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the attributes exist\n");
-#endif
-
-    /* Verify the attributes have been created */
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME)) < 0) {
+    if ((parent_group = H5Gcreate2(container_group, DEFERRED_CREATE_FAILURE_TEST_PARENT_GROUP_NAME,
+                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-    if (!attr_exists) {
+    if ((child_group = H5Gcreate2(parent_group, DEFERRED_CREATE_FAILURE_TEST_CHILD_GROUP_NAME, H5P_DEFAULT,
+                                  H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't create subgroup\n");
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        link_exists =
+            H5Lexists(container_group, DEFERRED_CREATE_FAILURE_TEST_PARENT_GROUP_NAME, H5P_DEFAULT);
     }
+    H5E_END_TRY;
 
-    if (!attr_exists) {
+    if (link_exists >= 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    sending a rejected deferred creation request succeeded\n");
         goto error;
     }
 
-    /* Now close the attributes and verify we can open them */
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open the attributes with H5Aopen\n");
+    puts("Checking that the other queued groups are still created\n");
 #endif
 
-    if ((attr_id = H5Aopen(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, H5P_DEFAULT)) < 0) {
+    if ((link_exists =
+             H5Lexists(container_group, DEFERRED_CREATE_FAILURE_TEST_PARENT_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    couldn't determine if link exists after failed flush\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Aopen(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    deferred group wasn't created after failed flush\n");
         goto error;
     }
 
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open the attributes with H5Aopen_by_name\n");
-#endif
-
-    if ((attr_id =
-             H5Aopen_by_name(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
-                             ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(parent_group, DEFERRED_CREATE_FAILURE_TEST_CHILD_GROUP_NAME, H5P_DEFAULT)) <
+        0) {
         H5_FAILED();
-        printf("    couldn't open attribute by name\n");
+        printf("    couldn't determine if link exists after failed flush\n");
         goto error;
     }
 
-    if ((attr_id2 =
-             H5Aopen_by_name(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
-                             ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open attribute by name\n");
+        printf("    deferred subgroup wasn't created after failed flush\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Aclose(attr_id) < 0)
-            TEST_ERROR
-        if (H5Aclose(attr_id2) < 0)
-            TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Attempting to open the attributes with H5Aopen_by_idx\n");
-#endif
-
-        if ((attr_id = H5Aopen_by_idx(file_id,
-                                      "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
-                                      H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    failed to open attribute by index!\n");
-            goto error;
-        }
-
-        if ((attr_id2 = H5Aopen_by_idx(
-                 file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
-                 H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    failed to open attribute by index!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
-    if (H5Sclose(dset_space_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(attr_space_id) < 0)
+    if (H5Gclose(child_group) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Tclose(attr_dtype1) < 0)
-        TEST_ERROR
-    if (H5Tclose(attr_dtype2) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Gclose(parent_group) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id) < 0)
+    if (H5Gclose(dup_group2) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
+    if (H5Gclose(dup_group) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -2760,14 +2940,10 @@ test_create_attribute_on_dataset(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(dset_space_id);
-        H5Sclose(attr_space_id);
-        H5Tclose(dset_dtype);
-        H5Tclose(attr_dtype1);
-        H5Tclose(attr_dtype2);
-        H5Dclose(dset_id);
-        H5Aclose(attr_id);
-        H5Aclose(attr_id2);
+        H5Gclose(child_group);
+        H5Gclose(parent_group);
+        H5Gclose(dup_group2);
+        H5Gclose(dup_group);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -2779,19 +2955,15 @@ error:
 }
 
 static int
-test_create_attribute_on_datatype(void)
+test_create_intermediate_groups(void)
 {
-    hsize_t dims[ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK];
-    size_t  i;
-    htri_t  attr_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   type_id         = -1;
-    hid_t   attr_id = -1, attr_id2 = -1;
-    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
-    hid_t   space_id = -1;
+    const char *new_paths[] = {CREATE_INTERMEDIATE_TEST_NEW_PATH1, CREATE_INTERMEDIATE_TEST_NEW_PATH2,
+                               CREATE_INTERMEDIATE_TEST_NEW_PATH3};
+    hid_t       file_id = -1, fapl_id = -1, lcpl_id = -1;
+    hid_t       container_group = -1, group_id = -1, new_group = -1, bad_group = -1;
+    hid_t       dset_id = -1, dspace_id = -1;
 
-    TESTING("create attribute on committed datatype")
+    TESTING("create intermediate groups along a partially existing path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -2807,144 +2979,287 @@ test_create_attribute_on_datatype(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, GROUP_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, CREATE_INTERMEDIATE_TEST_EXISTING_PATH1, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-    if (H5Tcommit2(container_group, ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME, type_id, H5P_DEFAULT,
-                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+
+    if ((group_id = H5Gcreate2(container_group, CREATE_INTERMEDIATE_TEST_EXISTING_PATH2, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-    {
-        /* Temporary workaround for now since H5Tcommit2 doesn't return something publicly usable
-         * for a VOL object */
-        if (H5Tclose(type_id) < 0)
-            TEST_ERROR
-
-        if ((type_id = H5Topen2(container_group, ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't open committed datatype\n");
-            goto error;
-        }
-    }
-
-    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK; i++)
-        dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
-
-    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK, dims, NULL)) < 0)
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
 
-    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((lcpl_id = H5Pcreate(H5P_LINK_CREATE)) < 0)
         TEST_ERROR
-    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Pset_create_intermediate_group(lcpl_id, 1) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on datatype with H5Acreate2\n");
+    puts("Creating a group below two existing and two missing groups\n");
 #endif
 
-    if ((attr_id = H5Acreate2(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, attr_dtype1, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((new_group = H5Gcreate2(container_group, CREATE_INTERMEDIATE_TEST_NEW_PATH3, lcpl_id, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    couldn't create group along partially existing path\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute on datatype with H5Acreate_by_name\n");
-#endif
+    for (size_t i = 0; i < sizeof(new_paths) / sizeof(new_paths[0]); i++) {
+        if ((group_id = H5Gopen2(container_group, new_paths[i], H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open group '%s'\n", new_paths[i]);
+            goto error;
+        }
 
-    if ((attr_id2 = H5Acreate_by_name(
-             file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
-             ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, attr_dtype2, space_id, H5P_DEFAULT, H5P_DEFAULT,
-             H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute on datatype by name\n");
-        goto error;
+        if (H5Gclose(group_id) < 0)
+            TEST_ERROR
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the attributes exist\n");
+    puts("Attempting to create intermediate groups below a dataset\n");
 #endif
 
-    /* Verify the attributes have been created */
-    if ((attr_exists = H5Aexists(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
+    if ((dspace_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
 
-    if (!attr_exists) {
+    if ((dset_id = H5Dcreate2(container_group, CREATE_INTERMEDIATE_TEST_DSET_PATH, H5T_NATIVE_INT, dspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        bad_group = H5Gcreate2(container_group, CREATE_INTERMEDIATE_TEST_THROUGH_DSET, lcpl_id, H5P_DEFAULT,
+                               H5P_DEFAULT);
     }
+    H5E_END_TRY;
 
-    if (!attr_exists) {
+    if (bad_group >= 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    created intermediate groups below a dataset\n");
         goto error;
     }
 
-    /* Now close the attributes and verify we can open them */
-    if (H5Aclose(attr_id) < 0)
+    if (H5Sclose(dspace_id) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(new_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(lcpl_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open the attributes with H5Aopen\n");
-#endif
+    PASSED();
 
-    if ((attr_id = H5Aopen(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open attribute\n");
-        goto error;
-    }
+    return 0;
 
-    if ((attr_id2 = H5Aopen(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open attribute\n");
-        goto error;
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(dspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(bad_group);
+        H5Gclose(new_group);
+        H5Gclose(group_id);
+        H5Pclose(lcpl_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
+    return 1;
+}
+
+/*****************************************************
+ *                                                   *
+ *              Plugin Attribute tests               *
+ *                                                   *
+ *****************************************************/
+
+static int
+test_create_attribute_on_root(void)
+{
+    hsize_t dims[ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   attr_id = -1, attr_id2 = -1;
+    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
+    hid_t   space_id = -1;
+
+    TESTING("create, open and close attribute on root group")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    for (i = 0; i < ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_ROOT_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating attribute on root group with H5Acreate2\n");
+#endif
+
+    if ((attr_id = H5Acreate2(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, attr_dtype1, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating attribute on root group with H5Acreate_by_name\n");
+#endif
+
+    if ((attr_id2 = H5Acreate_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, attr_dtype2,
+                                      space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute on object by name\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the attributes exist\n");
+#endif
+
+    /* Verify the attributes have been created */
+    if ((attr_exists = H5Aexists(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
+
+    if ((attr_exists = H5Aexists(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
+
+    if ((attr_exists = H5Aexists_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT)) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists by H5Aexists_by_name\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
+
+    if ((attr_exists = H5Aexists_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT)) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists by H5Aexists_by_name\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
+
+    /* Now close the attributes and verify we can open them */
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to open the attributes with H5Aopen\n");
+#endif
+
+    if ((attr_id = H5Aopen(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute\n");
+        goto error;
+    }
+
+    if ((attr_id2 = H5Aopen(file_id, ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute\n");
+        goto error;
+    }
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
     puts("Attempting to open the attributes with H5Aopen_by_name\n");
 #endif
 
-    if ((attr_id = H5Aopen_by_name(file_id,
-                                   "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
-                                   ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Aopen_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME, H5P_DEFAULT,
+                                   H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open attribute by name\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Aopen_by_name(file_id,
-                                    "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
-                                    ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id2 = H5Aopen_by_name(file_id, "/", ATTRIBUTE_CREATE_ON_ROOT_ATTR_NAME2, H5P_DEFAULT,
+                                    H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open attribute by name\n");
         goto error;
@@ -2962,14 +3277,14 @@ test_create_attribute_on_datatype(void)
 #endif
 
         if ((attr_id =
-                 H5Aopen_by_idx(type_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+                 H5Aopen_by_idx(file_id, "/", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
             H5_FAILED();
             printf("    failed to open attribute by index!\n");
             goto error;
         }
 
         if ((attr_id2 =
-                 H5Aopen_by_idx(type_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+                 H5Aopen_by_idx(file_id, "/", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
             H5_FAILED();
             printf("    failed to open attribute by index!\n");
             goto error;
@@ -2987,10 +3302,6 @@ test_create_attribute_on_datatype(void)
         TEST_ERROR
     if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
-    if (H5Tclose(type_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
@@ -3010,8 +3321,6 @@ error:
         H5Tclose(attr_dtype2);
         H5Aclose(attr_id);
         H5Aclose(attr_id2);
-        H5Tclose(type_id);
-        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -3022,16 +3331,22 @@ error:
 }
 
 static int
-test_create_attribute_with_null_space(void)
+test_create_attribute_on_dataset(void)
 {
-    htri_t attr_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1;
-    hid_t  attr_id    = -1;
-    hid_t  attr_dtype = -1;
-    hid_t  space_id   = -1;
+    hsize_t dset_dims[ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK];
+    hsize_t attr_dims[ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   attr_id = -1, attr_id2 = -1;
+    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
+    hid_t   dset_dtype    = -1;
+    hid_t   dset_space_id = -1;
+    hid_t   attr_space_id = -1;
 
-    TESTING("create attribute with NULL dataspace")
+    TESTING("create attribute on dataset")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3053,32 +3368,60 @@ test_create_attribute_with_null_space(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_SUBGROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
+    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK; i++)
+        dset_dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
+    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK; i++)
+        attr_dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
 
-    if ((space_id = H5Screate(H5S_NULL)) < 0)
+    if ((dset_space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATASET_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
+        TEST_ERROR
+    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATASET_ATTR_SPACE_RANK, attr_dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
+    if ((dset_id = H5Dcreate2(container_group, ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME, dset_dtype,
+                              dset_space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Creating attribute with NULL dataspace\n");
+    puts("Creating attribute on dataset with H5Acreate2\n");
 #endif
 
-    if ((attr_id = H5Acreate2(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME, attr_dtype, space_id,
+    if ((attr_id = H5Acreate2(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, attr_dtype1, attr_space_id,
                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
-    /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating attribute on dataset with H5Acreate_by_name\n");
+#endif
+
+    if ((attr_id2 = H5Acreate_by_name(file_id,
+                                      "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
+                                      ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, attr_dtype2, attr_space_id,
+                                      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute on object by name\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the attributes exist\n");
+#endif
+
+    /* Verify the attributes have been created */
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3090,138 +3433,109 @@ test_create_attribute_with_null_space(void)
         goto error;
     }
 
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
 
-    if ((attr_id = H5Aopen(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(attr_dtype) < 0)
-        TEST_ERROR
+    /* Now close the attributes and verify we can open them */
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(space_id);
-        H5Tclose(attr_dtype);
-        H5Aclose(attr_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
-    }
-    H5E_END_TRY;
-
-    return 1;
-}
-
-static int
-test_create_attribute_with_scalar_space(void)
-{
-    htri_t attr_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1;
-    hid_t  attr_id    = -1;
-    hid_t  attr_dtype = -1;
-    hid_t  space_id   = -1;
-
-    TESTING("create attribute with SCALAR dataspace")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
-
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open file\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to open the attributes with H5Aopen\n");
+#endif
 
-    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Aopen(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_SUBGROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id2 = H5Aopen(dset_id, ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
-
-    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Creating attribute with SCALAR dataspace\n");
+    puts("Attempting to open the attributes with H5Aopen_by_name\n");
 #endif
 
-    if ((attr_id = H5Acreate2(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME, attr_dtype,
-                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id =
+             H5Aopen_by_name(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
+                             ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    couldn't open attribute by name\n");
         goto error;
     }
 
-    /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME)) < 0) {
+    if ((attr_id2 =
+             H5Aopen_by_name(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
+                             ATTRIBUTE_CREATE_ON_DATASET_ATTR_NAME2, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't open attribute by name\n");
         goto error;
     }
 
-    if (!attr_exists) {
-        H5_FAILED();
-        printf("    attribute did not exist\n");
-        goto error;
-    }
+    H5E_BEGIN_TRY
+    {
+        if (H5Aclose(attr_id) < 0)
+            TEST_ERROR
+        if (H5Aclose(attr_id2) < 0)
+            TEST_ERROR
 
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Attempting to open the attributes with H5Aopen_by_idx\n");
+#endif
 
-    if ((attr_id = H5Aopen(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open attribute\n");
-        goto error;
+        if ((attr_id = H5Aopen_by_idx(file_id,
+                                      "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
+                                      H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    failed to open attribute by index!\n");
+            goto error;
+        }
+
+        if ((attr_id2 = H5Aopen_by_idx(
+                 file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATASET_DSET_NAME,
+                 H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    failed to open attribute by index!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
-    if (H5Sclose(space_id) < 0)
+    if (H5Sclose(dset_space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype) < 0)
+    if (H5Sclose(attr_space_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Tclose(attr_dtype1) < 0)
+        TEST_ERROR
+    if (H5Tclose(attr_dtype2) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
-    if (H5Gclose(group_id) < 0)
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -3239,10 +3553,14 @@ test_create_attribute_with_scalar_space(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space_id);
-        H5Tclose(attr_dtype);
+        H5Sclose(dset_space_id);
+        H5Sclose(attr_space_id);
+        H5Tclose(dset_dtype);
+        H5Tclose(attr_dtype1);
+        H5Tclose(attr_dtype2);
+        H5Dclose(dset_id);
         H5Aclose(attr_id);
-        H5Gclose(group_id);
+        H5Aclose(attr_id2);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -3254,19 +3572,19 @@ error:
 }
 
 static int
-test_get_attribute_info(void)
+test_create_attribute_on_datatype(void)
 {
-    H5A_info_t attr_info;
-    hsize_t    dims[ATTRIBUTE_GET_INFO_TEST_SPACE_RANK];
-    size_t     i;
-    htri_t     attr_exists;
-    hid_t      file_id = -1, fapl_id = -1;
-    hid_t      container_group = -1;
-    hid_t      attr_id         = -1;
-    hid_t      attr_dtype      = -1;
-    hid_t      space_id        = -1;
+    hsize_t dims[ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   type_id         = -1;
+    hid_t   attr_id = -1, attr_id2 = -1;
+    hid_t   attr_dtype1 = -1, attr_dtype2 = -1;
+    hid_t   space_id = -1;
 
-    TESTING("retrieve attribute info")
+    TESTING("create attribute on committed datatype")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3288,24 +3606,73 @@ test_get_attribute_info(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_GET_INFO_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype\n");
+        goto error;
+    }
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_INFO_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if (H5Tcommit2(container_group, ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME, type_id, H5P_DEFAULT,
+                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't commit datatype\n");
+        goto error;
+    }
+
+    {
+        /* Temporary workaround for now since H5Tcommit2 doesn't return something publicly usable
+         * for a VOL object */
+        if (H5Tclose(type_id) < 0)
+            TEST_ERROR
+
+        if ((type_id = H5Topen2(container_group, ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open committed datatype\n");
+            goto error;
+        }
+    }
+
+    for (i = 0; i < ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK; i++)
+        dims[i] = (hsize_t)rand() % MAX_DIM_SIZE + 1;
+
+    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_ON_DATATYPE_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_INFO_TEST_ATTR_NAME, attr_dtype, space_id,
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating attribute on datatype with H5Acreate2\n");
+#endif
+
+    if ((attr_id = H5Acreate2(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, attr_dtype1, space_id,
                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
-    /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_INFO_TEST_ATTR_NAME)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating attribute on datatype with H5Acreate_by_name\n");
+#endif
+
+    if ((attr_id2 = H5Acreate_by_name(
+             file_id, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
+             ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, attr_dtype2, space_id, H5P_DEFAULT, H5P_DEFAULT,
+             H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute on datatype by name\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the attributes exist\n");
+#endif
+
+    /* Verify the attributes have been created */
+    if ((attr_exists = H5Aexists(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3317,35 +3684,85 @@ test_get_attribute_info(void)
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving attribute's info with H5Aget_info\n");
-#endif
-
-    if (H5Aget_info(attr_id, &attr_info) < 0) {
+    if ((attr_exists = H5Aexists(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2)) < 0) {
         H5_FAILED();
-        printf("    couldn't get attribute info\n");
+        printf("    couldn't determine if attribute exists\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving attribute's info with H5Aget_info_by_name\n");
-#endif
-
-    if (H5Aget_info_by_name(container_group, ".", ATTRIBUTE_GET_INFO_TEST_ATTR_NAME, &attr_info,
-                            H5P_DEFAULT) < 0) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    couldn't get attribute info by name\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
+    /* Now close the attributes and verify we can open them */
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving attribute's info with H5Aget_info_by_idx\n");
+    puts("Attempting to open the attributes with H5Aopen\n");
 #endif
 
-        if (H5Aget_info_by_idx(container_group, "/", H5_INDEX_NAME, H5_ITER_INC, 0, &attr_info, H5P_DEFAULT) <
-            0) {
+    if ((attr_id = H5Aopen(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute\n");
+        goto error;
+    }
+
+    if ((attr_id2 = H5Aopen(type_id, ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute\n");
+        goto error;
+    }
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to open the attributes with H5Aopen_by_name\n");
+#endif
+
+    if ((attr_id = H5Aopen_by_name(file_id,
+                                   "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
+                                   ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute by name\n");
+        goto error;
+    }
+
+    if ((attr_id2 = H5Aopen_by_name(file_id,
+                                    "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_CREATE_ON_DATATYPE_DTYPE_NAME,
+                                    ATTRIBUTE_CREATE_ON_DATATYPE_ATTR_NAME2, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute by name\n");
+        goto error;
+    }
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Aclose(attr_id) < 0)
+            TEST_ERROR
+        if (H5Aclose(attr_id2) < 0)
+            TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Attempting to open the attributes with H5Aopen_by_idx\n");
+#endif
+
+        if ((attr_id =
+                 H5Aopen_by_idx(type_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    failed to open attribute by index!\n");
+            goto error;
+        }
+
+        if ((attr_id2 =
+                 H5Aopen_by_idx(type_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
             H5_FAILED();
             printf("    failed to open attribute by index!\n");
             goto error;
@@ -3355,10 +3772,16 @@ test_get_attribute_info(void)
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype) < 0)
+    if (H5Tclose(attr_dtype1) < 0)
+        TEST_ERROR
+    if (H5Tclose(attr_dtype2) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
+        TEST_ERROR
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -3376,8 +3799,11 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(space_id);
-        H5Tclose(attr_dtype);
+        H5Tclose(attr_dtype1);
+        H5Tclose(attr_dtype2);
         H5Aclose(attr_id);
+        H5Aclose(attr_id2);
+        H5Tclose(type_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -3389,20 +3815,16 @@ error:
 }
 
 static int
-test_get_attribute_space_and_type(void)
+test_create_attribute_with_null_space(void)
 {
-    hsize_t attr_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
-    size_t  i;
-    htri_t  attr_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   attr_id         = -1;
-    hid_t   attr_dtype      = -1;
-    hid_t   attr_space_id   = -1;
-    hid_t   tmp_type_id     = -1;
-    hid_t   tmp_space_id    = -1;
+    htri_t attr_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, group_id = -1;
+    hid_t  attr_id    = -1;
+    hid_t  attr_dtype = -1;
+    hid_t  space_id   = -1;
 
-    TESTING("retrieve attribute dataspace and datatype")
+    TESTING("create attribute with NULL dataspace")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3424,24 +3846,32 @@ test_get_attribute_space_and_type(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
-        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_SUBGROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container subgroup\n");
+        goto error;
+    }
 
-    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK, attr_dims, NULL)) < 0)
+    if ((space_id = H5Screate(H5S_NULL)) < 0)
         TEST_ERROR
 
     if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME, attr_dtype,
-                              attr_space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Creating attribute with NULL dataspace\n");
+#endif
+
+    if ((attr_id = H5Acreate2(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3453,134 +3883,23 @@ test_get_attribute_space_and_type(void)
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving attribute's datatype\n");
-#endif
-
-    /* Retrieve the attribute's datatype and dataspace and verify them */
-    if ((tmp_type_id = H5Aget_type(attr_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute's datatype\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving attribute's dataspace\n");
-#endif
-
-    if ((tmp_space_id = H5Aget_space(attr_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute's dataspace\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Checking to make sure the attribute's datatype and dataspace match what was provided at creation "
-         "time\n");
-#endif
-
-    {
-        hsize_t space_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
-        htri_t  types_equal = H5Tequal(tmp_type_id, attr_dtype);
-
-        if (types_equal < 0) {
-            H5_FAILED();
-            printf("    datatype was invalid\n");
-            goto error;
-        }
-
-        if (!types_equal) {
-            H5_FAILED();
-            printf("    attribute's datatype did not match\n");
-            goto error;
-        }
-
-        if (H5Sget_simple_extent_dims(tmp_space_id, space_dims, NULL) < 0)
-            TEST_ERROR
-
-        for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
-            if (space_dims[i] != attr_dims[i]) {
-                H5_FAILED();
-                printf("    dataspace dims didn't match\n");
-                goto error;
-            }
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the previous checks hold true after closing and re-opening the attribute\n");
-#endif
-
-    /* Now close the attribute and verify that this still works after opening an
-     * attribute instead of creating it
-     */
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
-    if (H5Tclose(tmp_type_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(tmp_space_id) < 0)
-        TEST_ERROR
 
-    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Aopen(group_id, ATTRIBUTE_CREATE_NULL_DATASPACE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if ((tmp_type_id = H5Aget_type(attr_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute's datatype\n");
-        goto error;
-    }
-
-    if ((tmp_space_id = H5Aget_space(attr_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute's dataspace\n");
-        goto error;
-    }
-
-    {
-        hsize_t space_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
-        htri_t  types_equal = H5Tequal(tmp_type_id, attr_dtype);
-
-        if (types_equal < 0) {
-            H5_FAILED();
-            printf("    datatype was invalid\n");
-            goto error;
-        }
-
-        /*
-         * Disabled for now, as there seem to be issues with HDF5 comparing
-         * certain datatypes
-         */
-#if 0
-        if (!types_equal) {
-            H5_FAILED();
-            printf("    attribute's datatype did not match\n");
-            goto error;
-        }
-#endif
-
-        if (H5Sget_simple_extent_dims(tmp_space_id, space_dims, NULL) < 0)
-            TEST_ERROR
-
-        for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
-            if (space_dims[i] != attr_dims[i]) {
-                H5_FAILED();
-                printf("    dataspace dims didn't match\n");
-                goto error;
-            }
-    }
-
-    if (H5Sclose(tmp_space_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(attr_space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(tmp_type_id) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -3597,11 +3916,10 @@ test_get_attribute_space_and_type(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(tmp_space_id);
-        H5Sclose(attr_space_id);
-        H5Tclose(tmp_type_id);
+        H5Sclose(space_id);
         H5Tclose(attr_dtype);
         H5Aclose(attr_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -3613,20 +3931,16 @@ error:
 }
 
 static int
-test_get_attribute_name(void)
+test_create_attribute_with_scalar_space(void)
 {
-    hsize_t dims[ATTRIBUTE_GET_NAME_TEST_SPACE_RANK];
-    ssize_t name_buf_size;
-    size_t  i;
-    htri_t  attr_exists;
-    char   *name_buf = NULL;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   attr_id         = -1;
-    hid_t   attr_dtype      = -1;
-    hid_t   space_id        = -1;
+    htri_t attr_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, group_id = -1;
+    hid_t  attr_id    = -1;
+    hid_t  attr_dtype = -1;
+    hid_t  space_id   = -1;
 
-    TESTING("retrieve attribute name")
+    TESTING("create attribute with SCALAR dataspace")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3648,24 +3962,32 @@ test_get_attribute_name(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_GET_NAME_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_SUBGROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container subgroup\n");
+        goto error;
+    }
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_NAME_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
         TEST_ERROR
 
     if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME, attr_dtype, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Creating attribute with SCALAR dataspace\n");
+#endif
+
+    if ((attr_id = H5Acreate2(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME, attr_dtype,
+                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3677,85 +3999,23 @@ test_get_attribute_name(void)
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving size of attribute's name\n");
-#endif
-
-    /* Retrieve the name buffer size */
-    if ((name_buf_size = H5Aget_name(attr_id, 0, NULL)) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve name buf size\n");
-        goto error;
-    }
-
-    if (NULL == (name_buf = (char *)malloc((size_t)name_buf_size + 1)))
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving attribute's name\n");
-#endif
-
-    if (H5Aget_name(attr_id, (size_t)name_buf_size + 1, name_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute name\n");
-    }
-
-    if (strcmp(name_buf, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) {
-        H5_FAILED();
-        printf("    retrieved attribute name didn't match\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that this still works after closing and re-opening the attribute\n");
-#endif
-
-    /* Now close the attribute and verify that we can still retrieve the attribute's name after
-     * opening (instead of creating) it
-     */
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Aopen(group_id, ATTRIBUTE_CREATE_SCALAR_DATASPACE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if (H5Aget_name(attr_id, (size_t)name_buf_size + 1, name_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't retrieve attribute name\n");
-        goto error;
-    }
-
-    if (strcmp(name_buf, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) {
-        H5_FAILED();
-        printf("    attribute name didn't match\n");
-        goto error;
-    }
-
-    H5E_BEGIN_TRY
-    {
-        if (H5Aget_name_by_idx(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0, name_buf,
-                               (size_t)name_buf_size + 1, H5P_DEFAULT) < 0) {
-            H5_FAILED();
-            printf("    failed to open attribute by index!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
-    if (name_buf) {
-        free(name_buf);
-        name_buf = NULL;
-    }
-
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -3772,11 +4032,10 @@ test_get_attribute_name(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (name_buf)
-            free(name_buf);
         H5Sclose(space_id);
         H5Tclose(attr_dtype);
         H5Aclose(attr_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -3788,18 +4047,19 @@ error:
 }
 
 static int
-test_create_attribute_with_space_in_name(void)
+test_get_attribute_info(void)
 {
-    hsize_t dims[ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK];
-    size_t  i;
-    htri_t  attr_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   attr_id         = -1;
-    hid_t   attr_dtype      = -1;
-    hid_t   space_id        = -1;
+    H5A_info_t attr_info;
+    hsize_t    dims[ATTRIBUTE_GET_INFO_TEST_SPACE_RANK];
+    size_t     i;
+    htri_t     attr_exists;
+    hid_t      file_id = -1, fapl_id = -1;
+    hid_t      container_group = -1;
+    hid_t      attr_id         = -1;
+    hid_t      attr_dtype      = -1;
+    hid_t      space_id        = -1;
 
-    TESTING("create attribute with a space in its name")
+    TESTING("retrieve attribute info")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3821,28 +4081,24 @@ test_create_attribute_with_space_in_name(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK; i++)
+    for (i = 0; i < ATTRIBUTE_GET_INFO_TEST_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_INFO_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
     if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to create an attribute with a space in its name\n");
-#endif
-
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_ATTR_NAME, attr_dtype,
-                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_INFO_TEST_ATTR_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_ATTR_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_INFO_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3854,6 +4110,42 @@ test_create_attribute_with_space_in_name(void)
         goto error;
     }
 
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving attribute's info with H5Aget_info\n");
+#endif
+
+    if (H5Aget_info(attr_id, &attr_info) < 0) {
+        H5_FAILED();
+        printf("    couldn't get attribute info\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving attribute's info with H5Aget_info_by_name\n");
+#endif
+
+    if (H5Aget_info_by_name(container_group, ".", ATTRIBUTE_GET_INFO_TEST_ATTR_NAME, &attr_info,
+                            H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't get attribute info by name\n");
+        goto error;
+    }
+
+    H5E_BEGIN_TRY
+    {
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Retrieving attribute's info with H5Aget_info_by_idx\n");
+#endif
+
+        if (H5Aget_info_by_idx(container_group, "/", H5_INDEX_NAME, H5_ITER_INC, 0, &attr_info, H5P_DEFAULT) <
+            0) {
+            H5_FAILED();
+            printf("    failed to open attribute by index!\n");
+            goto error;
+        }
+    }
+    H5E_END_TRY;
+
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Tclose(attr_dtype) < 0)
@@ -3890,18 +4182,20 @@ error:
 }
 
 static int
-test_delete_attribute(void)
+test_get_attribute_space_and_type(void)
 {
-    hsize_t dims[ATTRIBUTE_DELETION_TEST_SPACE_RANK];
+    hsize_t attr_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
     size_t  i;
     htri_t  attr_exists;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
     hid_t   attr_id         = -1;
     hid_t   attr_dtype      = -1;
-    hid_t   space_id        = -1;
+    hid_t   attr_space_id   = -1;
+    hid_t   tmp_type_id     = -1;
+    hid_t   tmp_space_id    = -1;
 
-    TESTING("delete an attribute")
+    TESTING("retrieve attribute dataspace and datatype")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -3923,25 +4217,24 @@ test_delete_attribute(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_DELETION_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
+        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_DELETION_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK, attr_dims, NULL)) < 0)
         TEST_ERROR
 
     if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    /* Test H5Adelete */
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME, attr_dtype,
+                              attr_space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -3949,115 +4242,133 @@ test_delete_attribute(void)
 
     if (!attr_exists) {
         H5_FAILED();
-        printf("    attribute didn't exists\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to delete attribute with H5Adelete\n");
+    puts("Retrieving attribute's datatype\n");
 #endif
 
-    /* Delete the attribute */
-    if (H5Adelete(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME) < 0) {
-        H5_FAILED();
-        printf("    failed to delete attribute\n");
-        goto error;
-    }
-
-    /* Verify the attribute has been deleted */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
-
-    if (attr_exists) {
-        H5_FAILED();
-        printf("    attribute exists!\n");
-        goto error;
-    }
-
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-
-    /* Test H5Adelete_by_name */
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Retrieve the attribute's datatype and dataspace and verify them */
+    if ((tmp_type_id = H5Aget_type(attr_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    couldn't retrieve attribute's datatype\n");
         goto error;
     }
 
-    /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving attribute's dataspace\n");
+#endif
 
-    if (!attr_exists) {
+    if ((tmp_space_id = H5Aget_space(attr_id)) < 0) {
         H5_FAILED();
-        printf("    attribute didn't exists\n");
+        printf("    couldn't retrieve attribute's dataspace\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to delete attribute with H5Adelete_by_name\n");
+    puts("Checking to make sure the attribute's datatype and dataspace match what was provided at creation "
+         "time\n");
 #endif
 
-    /* Delete the attribute */
-    if (H5Adelete_by_name(file_id, ATTRIBUTE_TEST_GROUP_NAME, ATTRIBUTE_DELETION_TEST_ATTR_NAME,
-                          H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    failed to delete attribute\n");
-        goto error;
-    }
+    {
+        hsize_t space_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
+        htri_t  types_equal = H5Tequal(tmp_type_id, attr_dtype);
 
-    /* Verify the attribute has been deleted */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
+        if (types_equal < 0) {
+            H5_FAILED();
+            printf("    datatype was invalid\n");
+            goto error;
+        }
 
-    if (attr_exists) {
-        H5_FAILED();
-        printf("    attribute exists!\n");
-        goto error;
+        if (!types_equal) {
+            H5_FAILED();
+            printf("    attribute's datatype did not match\n");
+            goto error;
+        }
+
+        if (H5Sget_simple_extent_dims(tmp_space_id, space_dims, NULL) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
+            if (space_dims[i] != attr_dims[i]) {
+                H5_FAILED();
+                printf("    dataspace dims didn't match\n");
+                goto error;
+            }
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to delete attribute with H5Adelete_by_idx\n");
+    puts("Verifying that the previous checks hold true after closing and re-opening the attribute\n");
 #endif
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Now close the attribute and verify that this still works after opening an
+     * attribute instead of creating it
+     */
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(tmp_type_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(tmp_space_id) < 0)
+        TEST_ERROR
+
+    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_GET_SPACE_TYPE_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if (H5Adelete_by_idx(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_CRT_ORDER, H5_ITER_DEC, 0,
-                         H5P_DEFAULT) < 0) {
+    if ((tmp_type_id = H5Aget_type(attr_id)) < 0) {
         H5_FAILED();
-        printf("    H5Adelete_by_idx failed!\n");
+        printf("    couldn't retrieve attribute's datatype\n");
         goto error;
     }
 
-    /* Verify the attribute has been deleted */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
+    if ((tmp_space_id = H5Aget_space(attr_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't retrieve attribute's dataspace\n");
         goto error;
     }
 
-    if (attr_exists) {
-        H5_FAILED();
-        printf("    attribute exists!\n");
-        goto error;
+    {
+        hsize_t space_dims[ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK];
+        htri_t  types_equal = H5Tequal(tmp_type_id, attr_dtype);
+
+        if (types_equal < 0) {
+            H5_FAILED();
+            printf("    datatype was invalid\n");
+            goto error;
+        }
+
+        /*
+         * Disabled for now, as there seem to be issues with HDF5 comparing
+         * certain datatypes
+         */
+#if 0
+        if (!types_equal) {
+            H5_FAILED();
+            printf("    attribute's datatype did not match\n");
+            goto error;
+        }
+#endif
+
+        if (H5Sget_simple_extent_dims(tmp_space_id, space_dims, NULL) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ATTRIBUTE_GET_SPACE_TYPE_TEST_SPACE_RANK; i++)
+            if (space_dims[i] != attr_dims[i]) {
+                H5_FAILED();
+                printf("    dataspace dims didn't match\n");
+                goto error;
+            }
     }
 
-    if (H5Sclose(space_id) < 0)
+    if (H5Sclose(tmp_space_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(attr_space_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(tmp_type_id) < 0)
         TEST_ERROR
     if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
@@ -4079,7 +4390,9 @@ test_delete_attribute(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space_id);
+        H5Sclose(tmp_space_id);
+        H5Sclose(attr_space_id);
+        H5Tclose(tmp_type_id);
         H5Tclose(attr_dtype);
         H5Aclose(attr_id);
         H5Gclose(container_group);
@@ -4093,18 +4406,20 @@ error:
 }
 
 static int
-test_write_attribute(void)
+test_get_attribute_name(void)
 {
-    hsize_t dims[ATTRIBUTE_WRITE_TEST_SPACE_RANK];
-    size_t  i, data_size;
+    hsize_t dims[ATTRIBUTE_GET_NAME_TEST_SPACE_RANK];
+    ssize_t name_buf_size;
+    size_t  i;
     htri_t  attr_exists;
+    char   *name_buf = NULL;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
     hid_t   attr_id         = -1;
+    hid_t   attr_dtype      = -1;
     hid_t   space_id        = -1;
-    void   *data            = NULL;
 
-    TESTING("write data to an attribute")
+    TESTING("retrieve attribute name")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -4126,21 +4441,24 @@ test_write_attribute(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_WRITE_TEST_SPACE_RANK; i++)
+    for (i = 0; i < ATTRIBUTE_GET_NAME_TEST_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_NAME_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_WRITE_TEST_ATTR_NAME,
-                              ATTRIBUTE_WRITE_TEST_ATTR_DTYPE, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_WRITE_TEST_ATTR_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -4152,33 +4470,83 @@ test_write_attribute(void)
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < ATTRIBUTE_WRITE_TEST_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= ATTRIBUTE_WRITE_TEST_ATTR_DTYPE_SIZE;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving size of attribute's name\n");
+#endif
 
-    if (NULL == (data = malloc(data_size)))
+    /* Retrieve the name buffer size */
+    if ((name_buf_size = H5Aget_name(attr_id, 0, NULL)) < 0) {
+        H5_FAILED();
+        printf("    couldn't retrieve name buf size\n");
+        goto error;
+    }
+
+    if (NULL == (name_buf = (char *)malloc((size_t)name_buf_size + 1)))
         TEST_ERROR
 
-    for (i = 0; i < data_size / ATTRIBUTE_WRITE_TEST_ATTR_DTYPE_SIZE; i++)
-        ((int *)data)[i] = (int)i;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving attribute's name\n");
+#endif
+
+    if (H5Aget_name(attr_id, (size_t)name_buf_size + 1, name_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't retrieve attribute name\n");
+    }
+
+    if (strcmp(name_buf, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) {
+        H5_FAILED();
+        printf("    retrieved attribute name didn't match\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to the attribute\n");
+    puts("Verifying that this still works after closing and re-opening the attribute\n");
 #endif
 
-    if (H5Awrite(attr_id, ATTRIBUTE_WRITE_TEST_ATTR_DTYPE, data) < 0) {
+    /* Now close the attribute and verify that we can still retrieve the attribute's name after
+     * opening (instead of creating) it
+     */
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+
+    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to attribute\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    if (H5Aget_name(attr_id, (size_t)name_buf_size + 1, name_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't retrieve attribute name\n");
+        goto error;
+    }
+
+    if (strcmp(name_buf, ATTRIBUTE_GET_NAME_TEST_ATTRIBUTE_NAME)) {
+        H5_FAILED();
+        printf("    attribute name didn't match\n");
+        goto error;
+    }
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Aget_name_by_idx(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0, name_buf,
+                               (size_t)name_buf_size + 1, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to open attribute by index!\n");
+            goto error;
+        }
+    }
+    H5E_END_TRY;
+
+    if (name_buf) {
+        free(name_buf);
+        name_buf = NULL;
     }
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
+    if (H5Tclose(attr_dtype) < 0)
+        TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -4197,7 +4565,10 @@ test_write_attribute(void)
 error:
     H5E_BEGIN_TRY
     {
+        if (name_buf)
+            free(name_buf);
         H5Sclose(space_id);
+        H5Tclose(attr_dtype);
         H5Aclose(attr_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -4210,19 +4581,18 @@ error:
 }
 
 static int
-test_read_attribute(void)
+test_create_attribute_with_space_in_name(void)
 {
-    hsize_t dims[ATTRIBUTE_READ_TEST_SPACE_RANK];
-    size_t  i, data_size;
+    hsize_t dims[ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK];
+    size_t  i;
     htri_t  attr_exists;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
     hid_t   attr_id         = -1;
+    hid_t   attr_dtype      = -1;
     hid_t   space_id        = -1;
-    void   *data            = NULL;
-    void   *read_buf        = NULL;
 
-    TESTING("read data from an attribute")
+    TESTING("create attribute with a space in its name")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -4244,13 +4614,20 @@ test_read_attribute(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_READ_TEST_SPACE_RANK; i++)
+    for (i = 0; i < ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_READ_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME, ATTRIBUTE_READ_TEST_ATTR_DTYPE,
+    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to create an attribute with a space in its name\n");
+#endif
+
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_ATTR_NAME, attr_dtype,
                               space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
@@ -4258,7 +4635,7 @@ test_read_attribute(void)
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_CREATE_WITH_SPACE_IN_NAME_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -4270,89 +4647,30 @@ test_read_attribute(void)
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < ATTRIBUTE_READ_TEST_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE;
-
-    if (NULL == (data = malloc(data_size)))
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (NULL == (read_buf = calloc(1, data_size)))
+    if (H5Tclose(attr_dtype) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    for (i = 0; i < data_size / ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE; i++)
-        ((int *)data)[i] = (int)i;
+    PASSED();
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to the attribute\n");
-#endif
-
-    if (H5Awrite(attr_id, ATTRIBUTE_READ_TEST_ATTR_DTYPE, data) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to attribute\n");
-        goto error;
-    }
-
-    if (data) {
-        free(data);
-        data = NULL;
-    }
-
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-
-    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open attribute\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Reading from the attribute\n");
-#endif
-
-    if (H5Aread(attr_id, ATTRIBUTE_READ_TEST_ATTR_DTYPE, read_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't read from attribute\n");
-        goto error;
-    }
-
-    for (i = 0; i < data_size / ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE; i++)
-        if (((int *)read_buf)[i] != (int)i) {
-            H5_FAILED();
-            printf("    data verification failed\n");
-            goto error;
-        }
-
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
-    }
-
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
+    return 0;
 
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
-        if (read_buf)
-            free(read_buf);
         H5Sclose(space_id);
+        H5Tclose(attr_dtype);
         H5Aclose(attr_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -4365,19 +4683,18 @@ error:
 }
 
 static int
-test_get_number_attributes(void)
+test_delete_attribute(void)
 {
-    H5O_info2_t obj_info;
-    hsize_t     dims[ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK];
-    size_t      i;
-    htri_t      attr_exists;
-    hid_t       file_id = -1, fapl_id = -1;
-    hid_t       container_group = -1;
-    hid_t       attr_id         = -1;
-    hid_t       attr_dtype      = -1;
-    hid_t       space_id        = -1;
+    hsize_t dims[ATTRIBUTE_DELETION_TEST_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   attr_id         = -1;
+    hid_t   attr_dtype      = -1;
+    hid_t   space_id        = -1;
 
-    TESTING("retrieve the number of attributes on an object")
+    TESTING("delete an attribute")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -4399,24 +4716,25 @@ test_get_number_attributes(void)
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK; i++)
+    for (i = 0; i < ATTRIBUTE_DELETION_TEST_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_DELETION_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
     if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_NUM_ATTRS_TEST_ATTRIBUTE_NAME, attr_dtype,
-                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Test H5Adelete */
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
     /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_NUM_ATTRS_TEST_ATTRIBUTE_NAME)) < 0) {
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -4424,66 +4742,113 @@ test_get_number_attributes(void)
 
     if (!attr_exists) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    attribute didn't exists\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info\n");
+    puts("Attempting to delete attribute with H5Adelete\n");
 #endif
 
-    /* Now get the number of attributes from the group */
-    if (H5Oget_info3(container_group, &obj_info, H5O_INFO_ALL) < 0) {
+    /* Delete the attribute */
+    if (H5Adelete(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME) < 0) {
         H5_FAILED();
-        printf("    couldn't retrieve root group info\n");
+        printf("    failed to delete attribute\n");
         goto error;
     }
 
-    if (obj_info.num_attrs < 1) {
+    /* Verify the attribute has been deleted */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
-        printf("    invalid number of attributes received\n");
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (attr_exists) {
+        H5_FAILED();
+        printf("    attribute exists!\n");
+        goto error;
+    }
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+
+    /* Test H5Adelete_by_name */
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
+
+    /* Verify the attribute has been created */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute didn't exists\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info_by_name\n");
+    puts("Attempting to delete attribute with H5Adelete_by_name\n");
 #endif
 
-    if (H5Oget_info_by_name3(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME, &obj_info, H5O_INFO_ALL, H5P_DEFAULT) <
-        0) {
+    /* Delete the attribute */
+    if (H5Adelete_by_name(file_id, ATTRIBUTE_TEST_GROUP_NAME, ATTRIBUTE_DELETION_TEST_ATTR_NAME,
+                          H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't retrieve root group info\n");
+        printf("    failed to delete attribute\n");
         goto error;
     }
 
-    if (obj_info.num_attrs < 1) {
+    /* Verify the attribute has been deleted */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
-        printf("    invalid number of attributes received\n");
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (attr_exists) {
+        H5_FAILED();
+        printf("    attribute exists!\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info_by_idx\n");
+    puts("Attempting to delete attribute with H5Adelete_by_idx\n");
 #endif
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Oget_info_by_idx3(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
-                                &obj_info, H5O_INFO_ALL, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME, attr_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
 
-#if 0
-        if (obj_info.num_attrs < 1) {
-            H5_FAILED();
-            printf("    invalid number of attributes received\n");
-            goto error;
-        }
-#endif
+    if (H5Adelete_by_idx(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_CRT_ORDER, H5_ITER_DEC, 0,
+                         H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Adelete_by_idx failed!\n");
+        goto error;
+    }
+
+    /* Verify the attribute has been deleted */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_DELETION_TEST_ATTR_NAME)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (attr_exists) {
+        H5_FAILED();
+        printf("    attribute exists!\n");
+        goto error;
     }
-    H5E_END_TRY;
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
@@ -4521,22 +4886,18 @@ error:
 }
 
 static int
-test_attribute_iterate(void)
+test_write_attribute(void)
 {
-    hsize_t dset_dims[ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK];
-    hsize_t attr_dims[ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK];
-    size_t  i;
+    hsize_t dims[ATTRIBUTE_WRITE_TEST_SPACE_RANK];
+    size_t  i, data_size;
     htri_t  attr_exists;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id = -1;
-    hid_t   attr_id = -1, attr_id2 = -1, attr_id3 = -1, attr_id4 = -1;
-    hid_t   dset_dtype    = -1;
-    hid_t   attr_dtype    = -1;
-    hid_t   dset_space_id = -1;
-    hid_t   attr_space_id = -1;
+    hid_t   container_group = -1;
+    hid_t   attr_id         = -1;
+    hid_t   space_id        = -1;
+    void   *data            = NULL;
 
-    TESTING("attribute iteration")
+    TESTING("write data to an attribute")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -4558,109 +4919,139 @@ test_attribute_iterate(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
+    for (i = 0; i < ATTRIBUTE_WRITE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK; i++)
-        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK; i++)
-        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_WRITE_TEST_ATTR_NAME,
+                              ATTRIBUTE_WRITE_TEST_ATTR_DTYPE, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
 
-    if ((dset_space_id = H5Screate_simple(ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
-        TEST_ERROR
-    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK, attr_dims, NULL)) < 0)
-        TEST_ERROR
+    /* Verify the attribute has been created */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_WRITE_TEST_ATTR_NAME)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dcreate2(group_id, ATTRIBUTE_ITERATE_TEST_DSET_NAME, dset_dtype, dset_space_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
+    for (i = 0, data_size = 1; i < ATTRIBUTE_WRITE_TEST_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= ATTRIBUTE_WRITE_TEST_ATTR_DTYPE_SIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / ATTRIBUTE_WRITE_TEST_ATTR_DTYPE_SIZE; i++)
+        ((int *)data)[i] = (int)i;
+
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Creating attributes on dataset\n");
+    puts("Writing to the attribute\n");
 #endif
 
-    if ((attr_id = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME, attr_dtype, attr_space_id,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5Awrite(attr_id, ATTRIBUTE_WRITE_TEST_ATTR_DTYPE, data) < 0) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    couldn't write to attribute\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME2, attr_dtype, attr_space_id,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute\n");
-        goto error;
+    if (data) {
+        free(data);
+        data = NULL;
     }
 
-    if ((attr_id3 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME3, attr_dtype, attr_space_id,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute\n");
-        goto error;
-    }
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-    if ((attr_id4 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME4, attr_dtype, attr_space_id,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute\n");
-        goto error;
-    }
+    PASSED();
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Verifying that the attributes exist\n");
-#endif
+    return 0;
 
-    /* Verify the attributes have been created */
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(space_id);
+        H5Aclose(attr_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    if (!attr_exists) {
-        H5_FAILED();
-        printf("    attribute did not exist\n");
-        goto error;
-    }
+    return 1;
+}
 
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME2)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
-        goto error;
-    }
+static int
+test_read_attribute(void)
+{
+    hsize_t dims[ATTRIBUTE_READ_TEST_SPACE_RANK];
+    size_t  i, data_size;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   attr_id         = -1;
+    hid_t   space_id        = -1;
+    void   *data            = NULL;
+    void   *read_buf        = NULL;
 
-    if (!attr_exists) {
+    TESTING("read data from an attribute")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME3)) < 0) {
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if (!attr_exists) {
+    for (i = 0; i < ATTRIBUTE_READ_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((space_id = H5Screate_simple(ATTRIBUTE_READ_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME, ATTRIBUTE_READ_TEST_ATTR_DTYPE,
+                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME4)) < 0) {
+    /* Verify the attribute has been created */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -4672,123 +5063,68 @@ test_attribute_iterate(void)
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by attribute name in increasing order with H5Aiterate2\n");
-#endif
-
-    /* Test basic attribute iteration capability using both index types and both index orders */
-    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback1, NULL) < 0) {
-        H5_FAILED();
-        printf("    H5Aiterate2 by index type name in increasing order failed\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by attribute name in decreasing order with H5Aiterate2\n");
-#endif
-
-    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, attr_iter_callback1, NULL) < 0) {
-        H5_FAILED();
-        printf("    H5Aiterate2 by index type name in decreasing order failed\n");
-        goto error;
-    }
+    for (i = 0, data_size = 1; i < ATTRIBUTE_READ_TEST_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE;
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by creation order in increasing order with H5Aiterate2\n");
-#endif
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+    if (NULL == (read_buf = calloc(1, data_size)))
+        TEST_ERROR
 
-    if (H5Aiterate2(dset_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, attr_iter_callback1, NULL) < 0) {
-        H5_FAILED();
-        printf("    H5Aiterate2 by index type creation order in increasing order failed\n");
-        goto error;
-    }
+    for (i = 0; i < data_size / ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE; i++)
+        ((int *)data)[i] = (int)i;
 
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by creation order in decreasing order with H5Aiterate2\n");
+    puts("Writing to the attribute\n");
 #endif
 
-    if (H5Aiterate2(dset_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, attr_iter_callback1, NULL) < 0) {
+    if (H5Awrite(attr_id, ATTRIBUTE_READ_TEST_ATTR_DTYPE, data) < 0) {
         H5_FAILED();
-        printf("    H5Aiterate2 by index type creation order in decreasing order failed\n");
+        printf("    couldn't write to attribute\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by attribute name in increasing order with H5Aiterate_by_name\n");
-#endif
-
-    if (H5Aiterate_by_name(file_id,
-                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
-                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
-                           H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback1, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Aiterate_by_name by index type name in increasing order failed\n");
-        goto error;
+    if (data) {
+        free(data);
+        data = NULL;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by attribute name in decreasing order with H5Aiterate_by_name\n");
-#endif
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
 
-    if (H5Aiterate_by_name(file_id,
-                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
-                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
-                           H5_INDEX_NAME, H5_ITER_DEC, NULL, attr_iter_callback1, NULL, H5P_DEFAULT) < 0) {
+    if ((attr_id = H5Aopen(container_group, ATTRIBUTE_READ_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Aiterate_by_name by index type name in decreasing order failed\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by creation order in increasing order with H5Aiterate_by_name\n");
+    puts("Reading from the attribute\n");
 #endif
 
-    if (H5Aiterate_by_name(file_id,
-                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
-                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, attr_iter_callback1, NULL,
-                           H5P_DEFAULT) < 0) {
+    if (H5Aread(attr_id, ATTRIBUTE_READ_TEST_ATTR_DTYPE, read_buf) < 0) {
         H5_FAILED();
-        printf("    H5Aiterate_by_name by index type creation order in increasing order failed\n");
+        printf("    couldn't read from attribute\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Iterating over attributes by creation order in decreasing order with H5Aiterate_by_name\n");
-#endif
+    for (i = 0; i < data_size / ATTRIBUTE_READ_TEST_ATTR_DTYPE_SIZE; i++)
+        if (((int *)read_buf)[i] != (int)i) {
+            H5_FAILED();
+            printf("    data verification failed\n");
+            goto error;
+        }
 
-    if (H5Aiterate_by_name(file_id,
-                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
-                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, attr_iter_callback1, NULL,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Aiterate_by_name by index type creation order in decreasing order failed\n");
-        goto error;
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
     }
 
-    /* XXX: Test the H5Aiterate index-saving capabilities */
-
-    if (H5Sclose(dset_space_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(attr_space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Tclose(attr_dtype) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id3) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id4) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -4805,19 +5141,16 @@ test_attribute_iterate(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(dset_space_id);
-        H5Sclose(attr_space_id);
-        H5Tclose(dset_dtype);
-        H5Tclose(attr_dtype);
+        if (data)
+            free(data);
+        if (read_buf)
+            free(read_buf);
+        H5Sclose(space_id);
         H5Aclose(attr_id);
-        H5Aclose(attr_id2);
-        H5Aclose(attr_id3);
-        H5Aclose(attr_id4);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5rest_term();
     }
     H5E_END_TRY;
 
@@ -4825,17 +5158,19 @@ error:
 }
 
 static int
-test_attribute_iterate_0_attributes(void)
+test_get_number_attributes(void)
 {
-    hsize_t dset_dims[ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id       = -1;
-    hid_t   dset_dtype    = -1;
-    hid_t   dset_space_id = -1;
+    H5O_info2_t obj_info;
+    hsize_t     dims[ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK];
+    size_t      i;
+    htri_t      attr_exists;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1;
+    hid_t       attr_id         = -1;
+    hid_t       attr_dtype      = -1;
+    hid_t       space_id        = -1;
 
-    TESTING("attribute iteration on object with 0 attributes")
+    TESTING("retrieve the number of attributes on an object")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -4857,135 +5192,93 @@ test_attribute_iterate_0_attributes(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_SUBGROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
+    for (i = 0; i < ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_GET_NUM_ATTRS_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK; i++)
-        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((dset_space_id =
-             H5Screate_simple(ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
+    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_NAME, dset_dtype,
-                              dset_space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_GET_NUM_ATTRS_TEST_ATTRIBUTE_NAME, attr_dtype,
+                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback2, NULL) < 0) {
+    /* Verify the attribute has been created */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_GET_NUM_ATTRS_TEST_ATTRIBUTE_NAME)) < 0) {
         H5_FAILED();
-        printf("    H5Aiterate2 by index type name in increasing order failed\n");
+        printf("    couldn't determine if attribute exists\n");
         goto error;
     }
 
-    if (H5Sclose(dset_space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(dset_space_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
     }
-    H5E_END_TRY;
-
-    return 1;
-}
-
-static int
-test_unused_attribute_API_calls(void)
-{
-    hsize_t attr_dims[ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   attr_id         = -1;
-    hid_t   attr_dtype      = -1;
-    hid_t   attr_space_id   = -1;
-
-    TESTING("unused attribute API calls")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info\n");
+#endif
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Now get the number of attributes from the group */
+    if (H5Oget_info3(container_group, &obj_info, H5O_INFO_ALL) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't retrieve root group info\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if (obj_info.num_attrs < 1) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    invalid number of attributes received\n");
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK; i++)
-        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK, attr_dims, NULL)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info_by_name\n");
+#endif
 
-    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
+    if (H5Oget_info_by_name3(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME, &obj_info, H5O_INFO_ALL, H5P_DEFAULT) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't retrieve root group info\n");
+        goto error;
+    }
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_UNUSED_APIS_TEST_ATTR_NAME, attr_dtype,
-                              attr_space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (obj_info.num_attrs < 1) {
         H5_FAILED();
-        printf("    couldn't create attribute\n");
+        printf("    invalid number of attributes received\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Testing that all of the unused attribute API calls don't cause application issues\n");
+    puts("Attempting to retrieve the number of attributes on a group with H5Oget_info_by_idx\n");
 #endif
 
     H5E_BEGIN_TRY
     {
-        if (H5Aget_storage_size(attr_id) > 0)
-            TEST_ERROR
+        if (H5Oget_info_by_idx3(file_id, "/" ATTRIBUTE_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
+                                &obj_info, H5O_INFO_ALL, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+#if 0
+        if (obj_info.num_attrs < 1) {
+            H5_FAILED();
+            printf("    invalid number of attributes received\n");
+            goto error;
+        }
+#endif
     }
     H5E_END_TRY;
 
-    if (H5Sclose(attr_space_id) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
@@ -5007,7 +5300,7 @@ test_unused_attribute_API_calls(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(attr_space_id);
+        H5Sclose(space_id);
         H5Tclose(attr_dtype);
         H5Aclose(attr_id);
         H5Gclose(container_group);
@@ -5021,20 +5314,22 @@ error:
 }
 
 static int
-test_attribute_property_lists(void)
+test_attribute_iterate(void)
 {
-    H5T_cset_t encoding = H5T_CSET_UTF8;
-    hsize_t    dims[ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK];
-    size_t     i;
-    htri_t     attr_exists;
-    hid_t      file_id = -1, fapl_id = -1;
-    hid_t      container_group = -1, group_id = -1;
-    hid_t      attr_id1 = -1, attr_id2 = -1;
-    hid_t      attr_dtype1 = -1, attr_dtype2 = -1;
-    hid_t      acpl_id1 = -1, acpl_id2 = -1;
-    hid_t      space_id = -1;
+    hsize_t dset_dims[ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK];
+    hsize_t attr_dims[ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id = -1;
+    hid_t   attr_id = -1, attr_id2 = -1, attr_id3 = -1, attr_id4 = -1;
+    hid_t   dset_dtype    = -1;
+    hid_t   attr_dtype    = -1;
+    hid_t   dset_space_id = -1;
+    hid_t   attr_space_id = -1;
 
-    TESTING("attribute property list operations")
+    TESTING("attribute iteration")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5056,59 +5351,73 @@ test_attribute_property_lists(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((space_id = H5Screate_simple(ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK; i++)
+        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK; i++)
+        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_space_id = H5Screate_simple(ATTRIBUTE_ITERATE_TEST_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
         TEST_ERROR
-    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_ITERATE_TEST_ATTR_SPACE_RANK, attr_dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((acpl_id1 = H5Pcreate(H5P_ATTRIBUTE_CREATE)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, ATTRIBUTE_ITERATE_TEST_DSET_NAME, dset_dtype, dset_space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create ACPL\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Setting property on ACPL\n");
+    printf("Creating attributes on dataset\n");
 #endif
 
-    if (H5Pset_char_encoding(acpl_id1, encoding) < 0) {
+    if ((attr_id = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME, attr_dtype, attr_space_id,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't set ACPL property value\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if ((attr_id1 = H5Acreate2(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1, attr_dtype1, space_id,
-                               acpl_id1, H5P_DEFAULT)) < 0) {
+    if ((attr_id2 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME2, attr_dtype, attr_space_id,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Acreate2(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2, attr_dtype2, space_id,
+    if ((attr_id3 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME3, attr_dtype, attr_space_id,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if (H5Pclose(acpl_id1) < 0)
-        TEST_ERROR
+    if ((attr_id4 = H5Acreate2(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME4, attr_dtype, attr_space_id,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Verifying that the attributes exist\n");
+#endif
 
     /* Verify the attributes have been created */
-    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1)) < 0) {
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -5120,7 +5429,7 @@ test_attribute_property_lists(void)
         goto error;
     }
 
-    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2)) < 0) {
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME2)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if attribute exists\n");
         goto error;
@@ -5132,103 +5441,145 @@ test_attribute_property_lists(void)
         goto error;
     }
 
-    /* Try to retrieve copies of the two property lists, one which ahs the property set and one which does not
-     */
-    if ((acpl_id1 = H5Aget_create_plist(attr_id1)) < 0) {
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME3)) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't determine if attribute exists\n");
         goto error;
     }
 
-    if ((acpl_id2 = H5Aget_create_plist(attr_id2)) < 0) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
-    /* Ensure that property list 1 has the property list set and property list 2 does not */
-    encoding = H5T_CSET_ERROR;
+    if ((attr_exists = H5Aexists(dset_id, ATTRIBUTE_ITERATE_TEST_ATTR_NAME4)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
 
-    if (H5Pget_char_encoding(acpl_id1, &encoding) < 0) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    couldn't retrieve ACPL property value\n");
+        printf("    attribute did not exist\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Checking that property set on ACPL was retrieved correctly\n");
+    printf("Iterating over attributes by attribute name in increasing order with H5Aiterate2\n");
 #endif
 
-    if (H5T_CSET_UTF8 != encoding) {
+    /* Test basic attribute iteration capability using both index types and both index orders */
+    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("   ACPL property value was incorrect\n");
+        printf("    H5Aiterate2 by index type name in increasing order failed\n");
         goto error;
     }
 
-    encoding = H5T_CSET_ERROR;
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by attribute name in decreasing order with H5Aiterate2\n");
+#endif
 
-    if (H5Pget_char_encoding(acpl_id2, &encoding) < 0) {
+    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, attr_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't retrieve ACPL property value\n");
+        printf("    H5Aiterate2 by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if (H5T_CSET_UTF8 == encoding) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by creation order in increasing order with H5Aiterate2\n");
+#endif
+
+    if (H5Aiterate2(dset_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, attr_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    ACPL property value was set!\n");
+        printf("    H5Aiterate2 by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    /* Now close the property lists and attribute and see if we can still retrieve copies of
-     * the property lists upon opening (instead of creating) an attribute
-     */
-    if (H5Pclose(acpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(acpl_id2) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id1) < 0)
-        TEST_ERROR
-    if (H5Aclose(attr_id2) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by creation order in decreasing order with H5Aiterate2\n");
+#endif
 
-    if ((attr_id1 = H5Aopen(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1, H5P_DEFAULT)) < 0) {
+    if (H5Aiterate2(dset_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, attr_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    H5Aiterate2 by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-    if ((attr_id2 = H5Aopen(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by attribute name in increasing order with H5Aiterate_by_name\n");
+#endif
+
+    if (H5Aiterate_by_name(file_id,
+                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
+                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
+                           H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't open attribute\n");
+        printf("    H5Aiterate_by_name by index type name in increasing order failed\n");
         goto error;
     }
 
-    if ((acpl_id1 = H5Aget_create_plist(attr_id1)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by attribute name in decreasing order with H5Aiterate_by_name\n");
+#endif
+
+    if (H5Aiterate_by_name(file_id,
+                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
+                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
+                           H5_INDEX_NAME, H5_ITER_DEC, NULL, attr_iter_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    H5Aiterate_by_name by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if ((acpl_id2 = H5Aget_create_plist(attr_id2)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by creation order in increasing order with H5Aiterate_by_name\n");
+#endif
+
+    if (H5Aiterate_by_name(file_id,
+                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
+                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, attr_iter_callback1, NULL,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    H5Aiterate_by_name by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    if (H5Pclose(acpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(acpl_id2) < 0)
+#ifdef RV_CONNECTOR_DEBUG
+    printf("Iterating over attributes by creation order in decreasing order with H5Aiterate_by_name\n");
+#endif
+
+    if (H5Aiterate_by_name(file_id,
+                           "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_ITERATE_TEST_SUBGROUP_NAME
+                           "/" ATTRIBUTE_ITERATE_TEST_DSET_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, attr_iter_callback1, NULL,
+                           H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Aiterate_by_name by index type creation order in decreasing order failed\n");
+        goto error;
+    }
+
+    /* XXX: Test the H5Aiterate index-saving capabilities */
+
+    if (H5Sclose(dset_space_id) < 0)
         TEST_ERROR
-    if (H5Sclose(space_id) < 0)
+    if (H5Sclose(attr_space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype1) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Tclose(attr_dtype2) < 0)
+    if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id1) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
+    if (H5Aclose(attr_id3) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id4) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -5247,41 +5598,37 @@ test_attribute_property_lists(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(acpl_id1);
-        H5Pclose(acpl_id2);
-        H5Sclose(space_id);
-        H5Tclose(attr_dtype1);
-        H5Tclose(attr_dtype2);
-        H5Aclose(attr_id1);
+        H5Sclose(dset_space_id);
+        H5Sclose(attr_space_id);
+        H5Tclose(dset_dtype);
+        H5Tclose(attr_dtype);
+        H5Aclose(attr_id);
         H5Aclose(attr_id2);
+        H5Aclose(attr_id3);
+        H5Aclose(attr_id4);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
-        H5rest_term();
     }
     H5E_END_TRY;
 
     return 1;
 }
 
-/*****************************************************
- *                                                   *
- *               Plugin Dataset tests                *
- *                                                   *
- *****************************************************/
-
 static int
-test_create_dataset_under_root(void)
+test_attribute_iterate_0_attributes(void)
 {
-    hsize_t dims[DATASET_CREATE_UNDER_ROOT_SPACE_RANK];
+    hsize_t dset_dims[ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK];
     size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   fspace_id  = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id       = -1;
+    hid_t   dset_dtype    = -1;
+    hid_t   dset_space_id = -1;
 
-    TESTING("create dataset under root group")
+    TESTING("attribute iteration on object with 0 attributes")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5297,33 +5644,52 @@ test_create_dataset_under_root(void)
         goto error;
     }
 
-    for (i = 0; i < DATASET_CREATE_UNDER_ROOT_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
 
-    if ((fspace_id = H5Screate_simple(DATASET_CREATE_UNDER_ROOT_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_SUBGROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container subgroup\n");
+        goto error;
+    }
 
     if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a dataset under the root group\n");
-#endif
+    for (i = 0; i < ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK; i++)
+        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    /* Create the Dataset under the root group of the file */
-    if ((dset_id = H5Dcreate2(file_id, DATASET_CREATE_UNDER_ROOT_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_space_id =
+             H5Screate_simple(ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_SPACE_RANK, dset_dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, ATTRIBUTE_ITERATE_TEST_0_ATTRIBUTES_DSET_NAME, dset_dtype,
+                              dset_space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Aiterate2(dset_id, H5_INDEX_NAME, H5_ITER_INC, NULL, attr_iter_callback2, NULL) < 0) {
+        H5_FAILED();
+        printf("    H5Aiterate2 by index type name in increasing order failed\n");
+        goto error;
+    }
+
+    if (H5Sclose(dset_space_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
@@ -5338,9 +5704,11 @@ test_create_dataset_under_root(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
+        H5Sclose(dset_space_id);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -5351,17 +5719,17 @@ error:
 }
 
 static int
-test_create_anonymous_dataset(void)
+test_unused_attribute_API_calls(void)
 {
-    hsize_t dims[DATASET_CREATE_ANONYMOUS_SPACE_RANK];
+    hsize_t attr_dims[ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK];
     size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   dset_dtype      = -1;
-    hid_t   fspace_id       = -1;
+    hid_t   attr_id         = -1;
+    hid_t   attr_dtype      = -1;
+    hid_t   attr_space_id   = -1;
 
-    TESTING("create anonymous dataset")
+    TESTING("unused attribute API calls")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5377,47 +5745,44 @@ test_create_anonymous_dataset(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_CREATE_ANONYMOUS_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK; i++)
+        attr_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(DATASET_CREATE_ANONYMOUS_SPACE_RANK, dims, NULL)) < 0)
+    if ((attr_space_id = H5Screate_simple(ATTRIBUTE_UNUSED_APIS_TEST_SPACE_RANK, attr_dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((attr_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating an anonymous dataset\n");
-#endif
-
-    if ((dset_id = H5Dcreate_anon(container_group, dset_dtype, fspace_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_UNUSED_APIS_TEST_ATTR_NAME, attr_dtype,
+                              attr_space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Linking the anonymous dataset into the file structure\n");
+    puts("Testing that all of the unused attribute API calls don't cause application issues\n");
 #endif
 
-    if (H5Olink(dset_id, container_group, DATASET_CREATE_ANONYMOUS_DATASET_NAME, H5P_DEFAULT, H5P_DEFAULT) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't link anonymous dataset into file structure\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        if (H5Aget_storage_size(attr_id) > 0)
+            TEST_ERROR
     }
+    H5E_END_TRY;
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Sclose(attr_space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Tclose(attr_dtype) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -5435,9 +5800,9 @@ test_create_anonymous_dataset(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
+        H5Sclose(attr_space_id);
+        H5Tclose(attr_dtype);
+        H5Aclose(attr_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -5449,17 +5814,20 @@ error:
 }
 
 static int
-test_create_dataset_under_existing_group(void)
+test_attribute_property_lists(void)
 {
-    hsize_t dims[DATASET_CREATE_UNDER_EXISTING_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   group_id   = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   fspace_id  = -1;
+    H5T_cset_t encoding = H5T_CSET_UTF8;
+    hsize_t    dims[ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK];
+    size_t     i;
+    htri_t     attr_exists;
+    hid_t      file_id = -1, fapl_id = -1;
+    hid_t      container_group = -1, group_id = -1;
+    hid_t      attr_id1 = -1, attr_id2 = -1;
+    hid_t      attr_dtype1 = -1, attr_dtype2 = -1;
+    hid_t      acpl_id1 = -1, acpl_id2 = -1;
+    hid_t      space_id = -1;
 
-    TESTING("create dataset under existing group")
+    TESTING("attribute property list operations")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5475,136 +5843,184 @@ test_create_dataset_under_existing_group(void)
         goto error;
     }
 
-    if ((group_id = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open group\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_CREATE_UNDER_EXISTING_SPACE_RANK; i++)
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
+
+    for (i = 0; i < ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(DATASET_CREATE_UNDER_EXISTING_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(ATTRIBUTE_PROPERTY_LIST_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((attr_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((attr_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
+    if ((acpl_id1 = H5Pcreate(H5P_ATTRIBUTE_CREATE)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create ACPL\n");
+        goto error;
+    }
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset under non-root group\n");
+    puts("Setting property on ACPL\n");
 #endif
 
-    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_UNDER_EXISTING_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5Pset_char_encoding(acpl_id1, encoding) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't set ACPL property value\n");
         goto error;
     }
 
-    if (H5Sclose(fspace_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
+    if ((attr_id1 = H5Acreate2(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1, attr_dtype1, space_id,
+                               acpl_id1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
+
+    if ((attr_id2 = H5Acreate2(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2, attr_dtype2, space_id,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
+    }
+
+    if (H5Pclose(acpl_id1) < 0)
         TEST_ERROR
 
-    PASSED();
+    /* Verify the attributes have been created */
+    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
 
-    return 0;
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
 
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
+    if ((attr_exists = H5Aexists(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    return 1;
-}
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
 
-static int
-test_create_dataset_null_space(void)
-{
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1, group_id = -1;
-    hid_t dset_id    = -1;
-    hid_t dset_dtype = -1;
-    hid_t fspace_id  = -1;
+    /* Try to retrieve copies of the two property lists, one which ahs the property set and one which does not
+     */
+    if ((acpl_id1 = H5Aget_create_plist(attr_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-    TESTING("create dataset with a NULL dataspace")
+    if ((acpl_id2 = H5Aget_create_plist(attr_id2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-    if (H5rest_init() < 0)
-        TEST_ERROR
+    /* Ensure that property list 1 has the property list set and property list 2 does not */
+    encoding = H5T_CSET_ERROR;
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+    if (H5Pget_char_encoding(acpl_id1, &encoding) < 0) {
+        H5_FAILED();
+        printf("    couldn't retrieve ACPL property value\n");
+        goto error;
+    }
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Checking that property set on ACPL was retrieved correctly\n");
+#endif
+
+    if (H5T_CSET_UTF8 != encoding) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("   ACPL property value was incorrect\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    encoding = H5T_CSET_ERROR;
+
+    if (H5Pget_char_encoding(acpl_id2, &encoding) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't retrieve ACPL property value\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_CREATE_NULL_DATASPACE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5T_CSET_UTF8 == encoding) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    ACPL property value was set!\n");
         goto error;
     }
 
-    if ((fspace_id = H5Screate(H5S_NULL)) < 0)
+    /* Now close the property lists and attribute and see if we can still retrieve copies of
+     * the property lists upon opening (instead of creating) an attribute
+     */
+    if (H5Pclose(acpl_id1) < 0)
         TEST_ERROR
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Pclose(acpl_id2) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id1) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    printf("Creating dataset with NULL dataspace\n");
-#endif
+    if ((attr_id1 = H5Aopen(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open attribute\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_NULL_DATASPACE_TEST_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((attr_id2 = H5Aopen(group_id, ATTRIBUTE_PROPERTY_LIST_TEST_ATTRIBUTE_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't open attribute\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+    if ((acpl_id1 = H5Aget_create_plist(attr_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dopen2(group_id, DATASET_CREATE_NULL_DATASPACE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+    if ((acpl_id2 = H5Aget_create_plist(attr_id2)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't get property list\n");
         goto error;
     }
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Pclose(acpl_id1) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Pclose(acpl_id2) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(attr_dtype1) < 0)
+        TEST_ERROR
+    if (H5Tclose(attr_dtype2) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id1) < 0)
+        TEST_ERROR
+    if (H5Aclose(attr_id2) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -5624,9 +6040,13 @@ test_create_dataset_null_space(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
+        H5Pclose(acpl_id1);
+        H5Pclose(acpl_id2);
+        H5Sclose(space_id);
+        H5Tclose(attr_dtype1);
+        H5Tclose(attr_dtype2);
+        H5Aclose(attr_id1);
+        H5Aclose(attr_id2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -5638,16 +6058,23 @@ error:
     return 1;
 }
 
+/*****************************************************
+ *                                                   *
+ *               Plugin Dataset tests                *
+ *                                                   *
+ *****************************************************/
+
 static int
-test_create_dataset_scalar_space(void)
+test_create_dataset_under_root(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1, group_id = -1;
-    hid_t dset_id    = -1;
-    hid_t dset_dtype = -1;
-    hid_t fspace_id  = -1;
+    hsize_t dims[DATASET_CREATE_UNDER_ROOT_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   fspace_id  = -1;
 
-    TESTING("create dataset with a SCALAR dataspace")
+    TESTING("create dataset under root group")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5663,55 +6090,33 @@ test_create_dataset_scalar_space(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
+    for (i = 0; i < DATASET_CREATE_UNDER_ROOT_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_CREATE_SCALAR_DATASPACE_TEST_SUBGROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
-
-    if ((fspace_id = H5Screate(H5S_SCALAR)) < 0)
+    if ((fspace_id = H5Screate_simple(DATASET_CREATE_UNDER_ROOT_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
     if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    printf("Creating dataset with SCALAR dataspace\n");
+    puts("Creating a dataset under the root group\n");
 #endif
 
-    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_SCALAR_DATASPACE_TEST_DSET_NAME, dset_dtype, fspace_id,
+    /* Create the Dataset under the root group of the file */
+    if ((dset_id = H5Dcreate2(file_id, DATASET_CREATE_UNDER_ROOT_DSET_NAME, dset_dtype, fspace_id,
                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dopen2(group_id, DATASET_CREATE_SCALAR_DATASPACE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open dataset\n");
-        goto error;
-    }
-
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
@@ -5729,8 +6134,6 @@ error:
         H5Sclose(fspace_id);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -5741,20 +6144,17 @@ error:
 }
 
 static int
-test_create_dataset_predefined_types(void)
+test_create_anonymous_dataset(void)
 {
-    size_t i;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1;
-    hid_t  fspace_id                    = -1;
-    hid_t  dset_id                      = -1;
-    hid_t  predefined_type_test_table[] = {H5T_STD_U8LE,   H5T_STD_U8BE,   H5T_STD_I8LE,   H5T_STD_I8BE,
-                                          H5T_STD_U16LE,  H5T_STD_U16BE,  H5T_STD_I16LE,  H5T_STD_I16BE,
-                                          H5T_STD_U32LE,  H5T_STD_U32BE,  H5T_STD_I32LE,  H5T_STD_I32BE,
-                                          H5T_STD_U64LE,  H5T_STD_U64BE,  H5T_STD_I64LE,  H5T_STD_I64BE,
-                                          H5T_IEEE_F32LE, H5T_IEEE_F32BE, H5T_IEEE_F64LE, H5T_IEEE_F64BE};
+    hsize_t dims[DATASET_CREATE_ANONYMOUS_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   dset_dtype      = -1;
+    hid_t   fspace_id       = -1;
 
-    TESTING("dataset creation w/ predefined datatypes")
+    TESTING("create anonymous dataset")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5776,53 +6176,41 @@ test_create_dataset_predefined_types(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_PREDEFINED_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    for (i = 0; i < DATASET_CREATE_ANONYMOUS_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_CREATE_ANONYMOUS_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating an anonymous dataset\n");
+#endif
+
+    if ((dset_id = H5Dcreate_anon(container_group, dset_dtype, fspace_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create sub-container group\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating datasets with the different predefined integer/floating-point datatypes\n");
+    puts("Linking the anonymous dataset into the file structure\n");
 #endif
 
-    for (i = 0; i < ARRAY_LENGTH(predefined_type_test_table); i++) {
-        hsize_t dims[DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK];
-        size_t  j;
-        char    name[100];
-
-        for (j = 0; j < DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK; j++)
-            dims[j] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-        if ((fspace_id = H5Screate_simple(DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
-            TEST_ERROR
-
-        sprintf(name, "%s%zu", DATASET_PREDEFINED_TYPE_TEST_BASE_NAME, i);
-
-        if ((dset_id = H5Dcreate2(group_id, name, predefined_type_test_table[i], fspace_id, H5P_DEFAULT,
-                                  H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
-
-        if (H5Sclose(fspace_id) < 0)
-            TEST_ERROR
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-
-        if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    failed to open dataset\n");
-            goto error;
-        }
-
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    if (H5Olink(dset_id, container_group, DATASET_CREATE_ANONYMOUS_DATASET_NAME, H5P_DEFAULT, H5P_DEFAULT) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't link anonymous dataset into file structure\n");
+        goto error;
     }
 
-    if (H5Gclose(group_id) < 0)
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -5841,8 +6229,8 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
-        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -5854,17 +6242,17 @@ error:
 }
 
 static int
-test_create_dataset_string_types(void)
+test_create_dataset_under_existing_group(void)
 {
-    hsize_t dims[DATASET_STRING_TYPE_TEST_SPACE_RANK];
+    hsize_t dims[DATASET_CREATE_UNDER_EXISTING_SPACE_RANK];
     size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id_fixed = -1, dset_id_variable = -1;
-    hid_t   type_id_fixed = -1, type_id_variable = -1;
-    hid_t   fspace_id = -1;
+    hid_t   group_id   = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   fspace_id  = -1;
 
-    TESTING("dataset creation w/ string types")
+    TESTING("create dataset under existing group")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -5880,94 +6268,40 @@ test_create_dataset_string_types(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
-
-    if ((group_id = H5Gcreate2(container_group, DATASET_STRING_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container sub-group\n");
-        goto error;
-    }
-
-    if ((type_id_fixed = H5Tcreate(H5T_STRING, DATASET_STRING_TYPE_TEST_STRING_LENGTH)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create fixed-length string type\n");
-        goto error;
-    }
-
-    if ((type_id_variable = H5Tcreate(H5T_STRING, H5T_VARIABLE)) < 0) {
+    if ((group_id = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create variable-length string type\n");
+        printf("    couldn't open group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_STRING_TYPE_TEST_SPACE_RANK; i++)
+    for (i = 0; i < DATASET_CREATE_UNDER_EXISTING_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(DATASET_STRING_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(DATASET_CREATE_UNDER_EXISTING_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset with fixed-length string datatype\n");
-#endif
-
-    if ((dset_id_fixed = H5Dcreate2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME1, type_id_fixed, fspace_id,
-                                    H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create fixed-length string dataset\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset with variable-length string datatype\n");
-#endif
-
-    if ((dset_id_variable = H5Dcreate2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME2, type_id_variable,
-                                       fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create variable-length string dataset\n");
-        goto error;
-    }
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to re-open the datasets\n");
+    puts("Creating dataset under non-root group\n");
 #endif
 
-    if (H5Dclose(dset_id_fixed) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id_variable) < 0)
-        TEST_ERROR
-
-    if ((dset_id_fixed = H5Dopen2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    failed to open dataset\n");
-        goto error;
-    }
-
-    if ((dset_id_variable = H5Dopen2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_UNDER_EXISTING_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    failed to opend dataset\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (H5Tclose(type_id_fixed) < 0)
-        TEST_ERROR
-    if (H5Tclose(type_id_variable) < 0)
-        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id_fixed) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id_variable) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
@@ -5982,13 +6316,10 @@ test_create_dataset_string_types(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id_fixed);
-        H5Tclose(type_id_variable);
         H5Sclose(fspace_id);
-        H5Dclose(dset_id_fixed);
-        H5Dclose(dset_id_variable);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
-        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -5999,19 +6330,15 @@ error:
 }
 
 static int
-test_create_dataset_compound_types(void)
+test_create_dataset_null_space(void)
 {
-    hsize_t dims[DATASET_COMPOUND_TYPE_TEST_DSET_RANK];
-    size_t  i, j;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   compound_type = -1;
-    hid_t   dset_id       = -1;
-    hid_t   fspace_id     = -1;
-    hid_t   type_pool[DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES];
-    int     num_passes;
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1, group_id = -1;
+    hid_t dset_id    = -1;
+    hid_t dset_dtype = -1;
+    hid_t fspace_id  = -1;
 
-    TESTING("dataset creation w/ compound datatypes")
+    TESTING("create dataset with a NULL dataspace")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -6033,104 +6360,45 @@ test_create_dataset_compound_types(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_COMPOUND_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, DATASET_CREATE_NULL_DATASPACE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_COMPOUND_TYPE_TEST_DSET_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((fspace_id = H5Screate_simple(DATASET_COMPOUND_TYPE_TEST_DSET_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate(H5S_NULL)) < 0)
         TEST_ERROR
 
-    num_passes = (rand() % DATASET_COMPOUND_TYPE_TEST_MAX_PASSES) + 1;
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating datasets with a variety of randomly-generated compound datatypes\n");
+    printf("Creating dataset with NULL dataspace\n");
 #endif
 
-    for (i = 0; i < (size_t)num_passes; i++) {
-        size_t num_subtypes;
-        size_t compound_size = 0;
-        size_t next_offset   = 0;
-        char   dset_name[256];
+    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_NULL_DATASPACE_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
 
-        num_subtypes = (size_t)(rand() % DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES) + 1;
-
-        for (j = 0; j < num_subtypes; j++)
-            type_pool[j] = -1;
-
-        if ((compound_type = H5Tcreate(H5T_COMPOUND, 1)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create compound datatype\n");
-            goto error;
-        }
-
-        /* Start adding subtypes to the compound type */
-        for (j = 0; j < num_subtypes; j++) {
-            size_t member_size;
-            char   member_name[256];
-
-            snprintf(member_name, 256, "member%zu", j);
-
-            if ((type_pool[j] = generate_random_datatype(H5T_NO_CLASS)) < 0) {
-                H5_FAILED();
-                printf("    couldn't create compound datatype member %zu\n", j);
-                goto error;
-            }
-
-            if ((member_size = H5Tget_size(type_pool[j])) < 0) {
-                H5_FAILED();
-                printf("    couldn't get compound member %zu size\n", j);
-                goto error;
-            }
-
-            compound_size += member_size;
-
-            if (H5Tset_size(compound_type, compound_size) < 0)
-                TEST_ERROR
-
-            if (H5Tinsert(compound_type, member_name, next_offset, type_pool[j]) < 0)
-                TEST_ERROR
-
-            next_offset += member_size;
-        }
-
-        if (H5Tpack(compound_type) < 0)
-            TEST_ERROR
-
-        snprintf(dset_name, sizeof(dset_name), "%s%zu", DATASET_COMPOUND_TYPE_TEST_DSET_NAME, i);
-
-        if ((dset_id = H5Dcreate2(group_id, dset_name, compound_type, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                                  H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
-
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-
-        if ((dset_id = H5Dopen2(group_id, dset_name, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    failed to open dataset\n");
-            goto error;
-        }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
-        for (j = 0; j < num_subtypes; j++)
-            if (type_pool[j] >= 0 && H5Tclose(type_pool[j]) < 0)
-                TEST_ERROR
-        if (H5Tclose(compound_type) < 0)
-            TEST_ERROR
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    if ((dset_id = H5Dopen2(group_id, DATASET_CREATE_NULL_DATASPACE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
     }
 
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -6149,10 +6417,8 @@ test_create_dataset_compound_types(void)
 error:
     H5E_BEGIN_TRY
     {
-        for (i = 0; i < DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES; i++)
-            H5Tclose(type_pool[i]);
-        H5Tclose(compound_type);
         H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
@@ -6166,19 +6432,15 @@ error:
 }
 
 static int
-test_create_dataset_enum_types(void)
+test_create_dataset_scalar_space(void)
 {
-    hsize_t     dims[DATASET_ENUM_TYPE_TEST_SPACE_RANK];
-    size_t      i;
-    hid_t       file_id = -1, fapl_id = -1;
-    hid_t       container_group = -1, group_id = -1;
-    hid_t       dset_id_native = -1, dset_id_non_native = -1;
-    hid_t       fspace_id   = -1;
-    hid_t       enum_native = -1, enum_non_native = -1;
-    const char *enum_type_test_table[] = {"RED",    "GREEN",  "BLUE",   "BLACK", "WHITE",
-                                          "PURPLE", "ORANGE", "YELLOW", "BROWN"};
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1, group_id = -1;
+    hid_t dset_id    = -1;
+    hid_t dset_dtype = -1;
+    hid_t fspace_id  = -1;
 
-    TESTING("dataset creation w/ enum types")
+    TESTING("create dataset with a SCALAR dataspace")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -6200,96 +6462,44 @@ test_create_dataset_enum_types(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_ENUM_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container sub-group\n");
-        goto error;
-    }
-
-    if ((enum_native = H5Tcreate(H5T_ENUM, sizeof(int))) < 0) {
-        H5_FAILED();
-        printf("    couldn't create native enum type\n");
-        goto error;
-    }
-
-    for (i = 0; i < ARRAY_LENGTH(enum_type_test_table); i++)
-        if (H5Tenum_insert(enum_native, enum_type_test_table[i], &i) < 0)
-            TEST_ERROR
-
-    if ((enum_non_native = H5Tenum_create(H5T_STD_U32LE)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, DATASET_CREATE_SCALAR_DATASPACE_TEST_SUBGROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create non-native enum type\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_ENUM_TYPE_TEST_NUM_MEMBERS; i++) {
-        char val_name[15];
-
-        sprintf(val_name, "%s%zu", DATASET_ENUM_TYPE_TEST_VAL_BASE_NAME, i);
-
-        if (H5Tenum_insert(enum_non_native, val_name, &i) < 0)
-            TEST_ERROR
-    }
-
-    for (i = 0; i < DATASET_ENUM_TYPE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((fspace_id = H5Screate_simple(DATASET_ENUM_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate(H5S_SCALAR)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset with native enum datatype\n");
-#endif
-
-    if ((dset_id_native = H5Dcreate2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME1, enum_native, fspace_id,
-                                     H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create native enum dataset\n");
-        goto error;
-    }
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset with non-native enum datatype\n");
+    printf("Creating dataset with SCALAR dataspace\n");
 #endif
 
-    if ((dset_id_non_native = H5Dcreate2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME2, enum_non_native,
-                                         fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, DATASET_CREATE_SCALAR_DATASPACE_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create non-native enum dataset\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to re-open the datasets\n");
-#endif
-
-    if (H5Dclose(dset_id_native) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id_non_native) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
 
-    if ((dset_id_native = H5Dopen2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    failed to open dataset\n");
-        goto error;
-    }
-
-    if ((dset_id_non_native = H5Dopen2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dopen2(group_id, DATASET_CREATE_SCALAR_DATASPACE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    failed to open dataset\n");
+        printf("    couldn't open dataset\n");
         goto error;
     }
 
-    if (H5Tclose(enum_native) < 0)
-        TEST_ERROR
-    if (H5Tclose(enum_non_native) < 0)
-        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id_native) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id_non_native) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -6309,11 +6519,9 @@ test_create_dataset_enum_types(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(enum_native);
-        H5Tclose(enum_non_native);
         H5Sclose(fspace_id);
-        H5Dclose(dset_id_native);
-        H5Dclose(dset_id_non_native);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -6326,30 +6534,20 @@ error:
 }
 
 static int
-test_create_dataset_array_types(void)
+test_create_dataset_predefined_types(void)
 {
-    hsize_t dset_dims[DATASET_ARRAY_TYPE_TEST_SPACE_RANK];
-    hsize_t array_dims1[DATASET_ARRAY_TYPE_TEST_RANK1];
-    hsize_t array_dims2[DATASET_ARRAY_TYPE_TEST_RANK2];
-#if 0
-    hsize_t array_dims3[DATASET_ARRAY_TYPE_TEST_RANK3];
-#endif
     size_t i;
     hid_t  file_id = -1, fapl_id = -1;
     hid_t  container_group = -1, group_id = -1;
-    hid_t  dset_id1 = -1, dset_id2 = -1;
-    hid_t  fspace_id      = -1;
-    hid_t  array_type_id1 = -1, array_type_id2 = -1;
-    hid_t  array_base_type_id1 = -1, array_base_type_id2 = -1;
-#if 0
-    hid_t   array_base_type_id3 = -1;
-    hid_t   array_type_id3 = -1;
-    hid_t   nested_type_id = -1;
-    hid_t   dset_id3 = -1;
-#endif
-    hid_t non_predefined_type_id = -1;
+    hid_t  fspace_id                    = -1;
+    hid_t  dset_id                      = -1;
+    hid_t  predefined_type_test_table[] = {H5T_STD_U8LE,   H5T_STD_U8BE,   H5T_STD_I8LE,   H5T_STD_I8BE,
+                                          H5T_STD_U16LE,  H5T_STD_U16BE,  H5T_STD_I16LE,  H5T_STD_I16BE,
+                                          H5T_STD_U32LE,  H5T_STD_U32BE,  H5T_STD_I32LE,  H5T_STD_I32BE,
+                                          H5T_STD_U64LE,  H5T_STD_U64BE,  H5T_STD_I64LE,  H5T_STD_I64BE,
+                                          H5T_IEEE_F32LE, H5T_IEEE_F32BE, H5T_IEEE_F64LE, H5T_IEEE_F64BE};
 
-    TESTING("dataset creation w/ array types")
+    TESTING("dataset creation w/ predefined datatypes")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -6371,147 +6569,194 @@ test_create_dataset_array_types(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_ARRAY_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, DATASET_PREDEFINED_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't create sub-container group\n");
         goto error;
     }
 
-    /* Test creation of array with some different types */
-    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK1; i++)
-        array_dims1[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((array_base_type_id1 = generate_random_datatype(H5T_ARRAY)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating datasets with the different predefined integer/floating-point datatypes\n");
+#endif
 
-    if ((array_type_id1 = H5Tarray_create(array_base_type_id1, DATASET_ARRAY_TYPE_TEST_RANK1, array_dims1)) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't create predefined integer array type\n");
-        goto error;
-    }
+    for (i = 0; i < ARRAY_LENGTH(predefined_type_test_table); i++) {
+        hsize_t dims[DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK];
+        size_t  j;
+        char    name[100];
 
-    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK2; i++)
-        array_dims2[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+        for (j = 0; j < DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK; j++)
+            dims[j] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((array_base_type_id2 = generate_random_datatype(H5T_ARRAY)) < 0)
-        TEST_ERROR
+        if ((fspace_id = H5Screate_simple(DATASET_PREDEFINED_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+            TEST_ERROR
 
-    if ((array_type_id2 = H5Tarray_create(array_base_type_id2, DATASET_ARRAY_TYPE_TEST_RANK2, array_dims2)) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't create predefined floating-point array type\n");
-        goto error;
-    }
+        sprintf(name, "%s%zu", DATASET_PREDEFINED_TYPE_TEST_BASE_NAME, i);
 
-#if 0
-    /* Test nested arrays */
-    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK4; i++)
-        array_dims3[i] = (hsize_t) (rand() % MAX_DIM_SIZE + 1);
+        if ((dset_id = H5Dcreate2(group_id, name, predefined_type_test_table[i], fspace_id, H5P_DEFAULT,
+                                  H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
 
-    if ((array_base_type_id3 = generate_random_datatype(H5T_ARRAY)) < 0)
+        if (H5Sclose(fspace_id) < 0)
+            TEST_ERROR
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    failed to open dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+    }
+
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    if ((nested_type_id = H5Tarray_create(array_base_type_id3, DATASET_ARRAY_TYPE_TEST_RANK3, array_dims3)) < 0) {
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_create_dataset_string_types(void)
+{
+    hsize_t dims[DATASET_STRING_TYPE_TEST_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id_fixed = -1, dset_id_variable = -1;
+    hid_t   type_id_fixed = -1, type_id_variable = -1;
+    hid_t   fspace_id = -1;
+
+    TESTING("dataset creation w/ string types")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't create nested array base type\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((array_type_id3 = H5Tarray_create(nested_type_id, DATASET_ARRAY_TYPE_TEST_RANK3, array_dims3)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create nested array type\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
-#endif
 
-    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_SPACE_RANK; i++)
-        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((group_id = H5Gcreate2(container_group, DATASET_STRING_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
 
-    if ((fspace_id = H5Screate_simple(DATASET_ARRAY_TYPE_TEST_SPACE_RANK, dset_dims, NULL)) < 0)
+    if ((type_id_fixed = H5Tcreate(H5T_STRING, DATASET_STRING_TYPE_TEST_STRING_LENGTH)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create fixed-length string type\n");
+        goto error;
+    }
+
+    if ((type_id_variable = H5Tcreate(H5T_STRING, H5T_VARIABLE)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create variable-length string type\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_STRING_TYPE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_STRING_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating datasets with variet of randomly-generated array datatypes\n");
+    puts("Creating dataset with fixed-length string datatype\n");
 #endif
 
-    if ((dset_id1 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME1, array_type_id1, fspace_id,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id_fixed = H5Dcreate2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME1, type_id_fixed, fspace_id,
+                                    H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create array type dataset\n");
+        printf("    couldn't create fixed-length string dataset\n");
         goto error;
     }
 
-    if ((dset_id2 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME2, array_type_id2, fspace_id,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create array type dataset\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating dataset with variable-length string datatype\n");
+#endif
 
-#if 0
-    if ((dset_id3 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME3, array_type_id3, fspace_id,
-            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id_variable = H5Dcreate2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME2, type_id_variable,
+                                       fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create nested array type dataset\n");
+        printf("    couldn't create variable-length string dataset\n");
         goto error;
     }
-#endif
 
 #ifdef RV_CONNECTOR_DEBUG
     puts("Attempting to re-open the datasets\n");
 #endif
 
-    if (H5Dclose(dset_id1) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
+    if (H5Dclose(dset_id_fixed) < 0)
         TEST_ERROR
-#if 0
-    if (H5Dclose(dset_id3) < 0)
+    if (H5Dclose(dset_id_variable) < 0)
         TEST_ERROR
-#endif
-
-    if ((dset_id1 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    failed to open dataset\n");
-        goto error;
-    }
 
-    if ((dset_id2 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+    if ((dset_id_fixed = H5Dopen2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    failed to open dataset\n");
         goto error;
     }
 
-#if 0
-    if ((dset_id3 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME3, H5P_DEFAULT)) < 0) {
+    if ((dset_id_variable = H5Dopen2(group_id, DATASET_STRING_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    failed to open dataset\n");
+        printf("    failed to opend dataset\n");
         goto error;
     }
-#endif
 
-    if (H5Tclose(array_type_id1) < 0)
-        TEST_ERROR
-    if (H5Tclose(array_type_id2) < 0)
-        TEST_ERROR
-#if 0
-    if (H5Tclose(array_type_id3) < 0)
+    if (H5Tclose(type_id_fixed) < 0)
         TEST_ERROR
-    if (H5Tclose(nested_type_id) < 0)
+    if (H5Tclose(type_id_variable) < 0)
         TEST_ERROR
-#endif
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id1) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
+    if (H5Dclose(dset_id_fixed) < 0)
         TEST_ERROR
-#if 0
-    if (H5Dclose(dset_id3) < 0)
+    if (H5Dclose(dset_id_variable) < 0)
         TEST_ERROR
-#endif
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -6530,19 +6775,11 @@ test_create_dataset_array_types(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(array_type_id1);
-        H5Tclose(array_type_id2);
-#if 0
-        H5Tclose(array_type_id3);
-        H5Tclose(nested_type_id);
-#endif
-        H5Tclose(non_predefined_type_id);
+        H5Tclose(type_id_fixed);
+        H5Tclose(type_id_variable);
         H5Sclose(fspace_id);
-        H5Dclose(dset_id1);
-        H5Dclose(dset_id2);
-#if 0
-        H5Dclose(dset_id3);
-#endif
+        H5Dclose(dset_id_fixed);
+        H5Dclose(dset_id_variable);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -6555,16 +6792,19 @@ error:
 }
 
 static int
-test_create_dataset_shapes(void)
+test_create_dataset_compound_types(void)
 {
-    hsize_t *dims = NULL;
-    size_t   i;
-    hid_t    file_id = -1, fapl_id = -1;
-    hid_t    container_group = -1, group_id = -1;
-    hid_t    dset_id = -1, space_id = -1;
-    hid_t    dset_dtype = -1;
+    hsize_t dims[DATASET_COMPOUND_TYPE_TEST_DSET_RANK];
+    size_t  i, j;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   compound_type = -1;
+    hid_t   dset_id       = -1;
+    hid_t   fspace_id     = -1;
+    hid_t   type_pool[DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES];
+    int     num_passes;
 
-    TESTING("dataset creation w/ random dimension sizes")
+    TESTING("dataset creation w/ compound datatypes")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -6586,61 +6826,103 @@ test_create_dataset_shapes(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_SHAPE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, DATASET_COMPOUND_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container sub-group\n");
         goto error;
     }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    for (i = 0; i < DATASET_COMPOUND_TYPE_TEST_DSET_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_COMPOUND_TYPE_TEST_DSET_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
+    num_passes = (rand() % DATASET_COMPOUND_TYPE_TEST_MAX_PASSES) + 1;
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating datasets with a variety of randomly-generated dataspace shapes\n");
+    puts("Creating datasets with a variety of randomly-generated compound datatypes\n");
 #endif
 
-    for (i = 0; i < DATASET_SHAPE_TEST_NUM_ITERATIONS; i++) {
-        size_t j;
-        char   name[100];
-        int    ndims = rand() % DATASET_SHAPE_TEST_MAX_DIMS + 1;
+    for (i = 0; i < (size_t)num_passes; i++) {
+        size_t num_subtypes;
+        size_t compound_size = 0;
+        size_t next_offset   = 0;
+        char   dset_name[256];
 
-        if (NULL == (dims = (hsize_t *)malloc((size_t)ndims * sizeof(*dims)))) {
-            H5_FAILED();
-            printf("    couldn't allocate space for dataspace dimensions\n");
-            goto error;
-        }
+        num_subtypes = (size_t)(rand() % DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES) + 1;
 
-        for (j = 0; j < (size_t)ndims; j++)
-            dims[j] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+        for (j = 0; j < num_subtypes; j++)
+            type_pool[j] = -1;
 
-        if ((space_id = H5Screate_simple(ndims, dims, NULL)) < 0) {
+        if ((compound_type = H5Tcreate(H5T_COMPOUND, 1)) < 0) {
             H5_FAILED();
-            printf("    couldn't create dataspace\n");
+            printf("    couldn't create compound datatype\n");
             goto error;
         }
 
-        sprintf(name, "%s%zu", DATASET_SHAPE_TEST_DSET_BASE_NAME, i + 1);
+        /* Start adding subtypes to the compound type */
+        for (j = 0; j < num_subtypes; j++) {
+            size_t member_size;
+            char   member_name[256];
 
-        if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, space_id, H5P_DEFAULT, H5P_DEFAULT,
-                                  H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
+            snprintf(member_name, 256, "member%zu", j);
 
-        if (dims) {
-            free(dims);
-            dims = NULL;
+            if ((type_pool[j] = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+                H5_FAILED();
+                printf("    couldn't create compound datatype member %zu\n", j);
+                goto error;
+            }
+
+            if ((member_size = H5Tget_size(type_pool[j])) < 0) {
+                H5_FAILED();
+                printf("    couldn't get compound member %zu size\n", j);
+                goto error;
+            }
+
+            compound_size += member_size;
+
+            if (H5Tset_size(compound_type, compound_size) < 0)
+                TEST_ERROR
+
+            if (H5Tinsert(compound_type, member_name, next_offset, type_pool[j]) < 0)
+                TEST_ERROR
+
+            next_offset += member_size;
         }
 
-        if (H5Sclose(space_id) < 0)
+        if (H5Tpack(compound_type) < 0)
+            TEST_ERROR
+
+        snprintf(dset_name, sizeof(dset_name), "%s%zu", DATASET_COMPOUND_TYPE_TEST_DSET_NAME, i);
+
+        if ((dset_id = H5Dcreate2(group_id, dset_name, compound_type, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, dset_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    failed to open dataset\n");
+            goto error;
+        }
+
+        for (j = 0; j < num_subtypes; j++)
+            if (type_pool[j] >= 0 && H5Tclose(type_pool[j]) < 0)
+                TEST_ERROR
+        if (H5Tclose(compound_type) < 0)
             TEST_ERROR
         if (H5Dclose(dset_id) < 0)
             TEST_ERROR
     }
 
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -6660,10 +6942,10 @@ test_create_dataset_shapes(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (dims)
-            free(dims);
-        H5Sclose(space_id);
-        H5Tclose(dset_dtype);
+        for (i = 0; i < DATASET_COMPOUND_TYPE_TEST_MAX_SUBTYPES; i++)
+            H5Tclose(type_pool[i]);
+        H5Tclose(compound_type);
+        H5Sclose(fspace_id);
         H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
@@ -6677,19 +6959,19 @@ error:
 }
 
 static int
-test_create_dataset_creation_properties(void)
+test_create_dataset_enum_types(void)
 {
-    hsize_t dims[DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id = -1, dcpl_id = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   fspace_id  = -1;
+    hsize_t     dims[DATASET_ENUM_TYPE_TEST_SPACE_RANK];
+    size_t      i;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    hid_t       dset_id_native = -1, dset_id_non_native = -1;
+    hid_t       fspace_id   = -1;
+    hid_t       enum_native = -1, enum_non_native = -1;
+    const char *enum_type_test_table[] = {"RED",    "GREEN",  "BLUE",   "BLACK", "WHITE",
+                                          "PURPLE", "ORANGE", "YELLOW", "BROWN"};
 
-    TESTING("dataset creation properties")
-    SKIPPED()
-    return 0;
+    TESTING("dataset creation w/ enum types")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -6711,355 +6993,3439 @@ test_create_dataset_creation_properties(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_CREATION_PROPERTIES_TEST_GROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, DATASET_ENUM_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create group\n");
+        printf("    couldn't create container sub-group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((enum_native = H5Tcreate(H5T_ENUM, sizeof(int))) < 0) {
+        H5_FAILED();
+        printf("    couldn't create native enum type\n");
+        goto error;
+    }
 
-    if ((fspace_id = H5Screate_simple(DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    for (i = 0; i < ARRAY_LENGTH(enum_type_test_table); i++)
+        if (H5Tenum_insert(enum_native, enum_type_test_table[i], &i) < 0)
+            TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((enum_non_native = H5Tenum_create(H5T_STD_U32LE)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create non-native enum type\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_ENUM_TYPE_TEST_NUM_MEMBERS; i++) {
+        char val_name[15];
+
+        sprintf(val_name, "%s%zu", DATASET_ENUM_TYPE_TEST_VAL_BASE_NAME, i);
+
+        if (H5Tenum_insert(enum_non_native, val_name, &i) < 0)
+            TEST_ERROR
+    }
+
+    for (i = 0; i < DATASET_ENUM_TYPE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_ENUM_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a variety of datasets with different creation properties\n");
+    puts("Creating dataset with native enum datatype\n");
 #endif
 
-    /* Test the alloc time property */
-    {
-        H5D_alloc_time_t alloc_times[] = {H5D_ALLOC_TIME_DEFAULT, H5D_ALLOC_TIME_EARLY, H5D_ALLOC_TIME_INCR,
-                                          H5D_ALLOC_TIME_LATE};
+    if ((dset_id_native = H5Dcreate2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME1, enum_native, fspace_id,
+                                     H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create native enum dataset\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the alloc time property\n");
+    puts("Creating dataset with non-native enum datatype\n");
 #endif
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
+    if ((dset_id_non_native = H5Dcreate2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME2, enum_non_native,
+                                         fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create non-native enum dataset\n");
+        goto error;
+    }
 
-        for (i = 0; i < ARRAY_LENGTH(alloc_times); i++) {
-            char name[100];
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to re-open the datasets\n");
+#endif
 
-            if (H5Pset_alloc_time(dcpl_id, alloc_times[i]) < 0)
-                TEST_ERROR
+    if (H5Dclose(dset_id_native) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id_non_native) < 0)
+        TEST_ERROR
 
-            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_ALLOC_TIMES_BASE_NAME, i);
+    if ((dset_id_native = H5Dopen2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
+    }
 
-            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
-                                      H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't create dataset\n");
-                goto error;
-            }
+    if ((dset_id_non_native = H5Dopen2(group_id, DATASET_ENUM_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
+    }
 
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
+    if (H5Tclose(enum_native) < 0)
+        TEST_ERROR
+    if (H5Tclose(enum_non_native) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id_native) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id_non_native) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't open dataset\n");
-                goto error;
-            }
+    PASSED();
 
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
-        }
+    return 0;
 
-        if (H5Pclose(dcpl_id) < 0)
-            TEST_ERROR
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(enum_native);
+        H5Tclose(enum_non_native);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id_native);
+        H5Dclose(dset_id_non_native);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    /* Test the attribute creation order property */
-    {
-        unsigned creation_orders[] = {H5P_CRT_ORDER_TRACKED, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED};
+    return 1;
+}
 
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the attribute creation order property\n");
+static int
+test_create_dataset_array_types(void)
+{
+    hsize_t dset_dims[DATASET_ARRAY_TYPE_TEST_SPACE_RANK];
+    hsize_t array_dims1[DATASET_ARRAY_TYPE_TEST_RANK1];
+    hsize_t array_dims2[DATASET_ARRAY_TYPE_TEST_RANK2];
+#if 0
+    hsize_t array_dims3[DATASET_ARRAY_TYPE_TEST_RANK3];
 #endif
+    size_t i;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, group_id = -1;
+    hid_t  dset_id1 = -1, dset_id2 = -1;
+    hid_t  fspace_id      = -1;
+    hid_t  array_type_id1 = -1, array_type_id2 = -1;
+    hid_t  array_base_type_id1 = -1, array_base_type_id2 = -1;
+#if 0
+    hid_t   array_base_type_id3 = -1;
+    hid_t   array_type_id3 = -1;
+    hid_t   nested_type_id = -1;
+    hid_t   dset_id3 = -1;
+#endif
+    hid_t non_predefined_type_id = -1;
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
-
-        for (i = 0; i < ARRAY_LENGTH(creation_orders); i++) {
-            char name[100];
+    TESTING("dataset creation w/ array types")
 
-            if (H5Pset_attr_creation_order(dcpl_id, creation_orders[i]) < 0)
-                TEST_ERROR
+    if (H5rest_init() < 0)
+        TEST_ERROR
 
-            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_CRT_ORDER_BASE_NAME, i);
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_ARRAY_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
+
+    /* Test creation of array with some different types */
+    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK1; i++)
+        array_dims1[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((array_base_type_id1 = generate_random_datatype(H5T_ARRAY)) < 0)
+        TEST_ERROR
+
+    if ((array_type_id1 = H5Tarray_create(array_base_type_id1, DATASET_ARRAY_TYPE_TEST_RANK1, array_dims1)) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't create predefined integer array type\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK2; i++)
+        array_dims2[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((array_base_type_id2 = generate_random_datatype(H5T_ARRAY)) < 0)
+        TEST_ERROR
+
+    if ((array_type_id2 = H5Tarray_create(array_base_type_id2, DATASET_ARRAY_TYPE_TEST_RANK2, array_dims2)) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't create predefined floating-point array type\n");
+        goto error;
+    }
+
+#if 0
+    /* Test nested arrays */
+    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_RANK4; i++)
+        array_dims3[i] = (hsize_t) (rand() % MAX_DIM_SIZE + 1);
+
+    if ((array_base_type_id3 = generate_random_datatype(H5T_ARRAY)) < 0)
+        TEST_ERROR
+
+    if ((nested_type_id = H5Tarray_create(array_base_type_id3, DATASET_ARRAY_TYPE_TEST_RANK3, array_dims3)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create nested array base type\n");
+        goto error;
+    }
+
+    if ((array_type_id3 = H5Tarray_create(nested_type_id, DATASET_ARRAY_TYPE_TEST_RANK3, array_dims3)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create nested array type\n");
+        goto error;
+    }
+#endif
+
+    for (i = 0; i < DATASET_ARRAY_TYPE_TEST_SPACE_RANK; i++)
+        dset_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_ARRAY_TYPE_TEST_SPACE_RANK, dset_dims, NULL)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating datasets with variet of randomly-generated array datatypes\n");
+#endif
+
+    if ((dset_id1 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME1, array_type_id1, fspace_id,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create array type dataset\n");
+        goto error;
+    }
+
+    if ((dset_id2 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME2, array_type_id2, fspace_id,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create array type dataset\n");
+        goto error;
+    }
+
+#if 0
+    if ((dset_id3 = H5Dcreate2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME3, array_type_id3, fspace_id,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create nested array type dataset\n");
+        goto error;
+    }
+#endif
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to re-open the datasets\n");
+#endif
+
+    if (H5Dclose(dset_id1) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+#if 0
+    if (H5Dclose(dset_id3) < 0)
+        TEST_ERROR
+#endif
+
+    if ((dset_id1 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
+    }
+
+    if ((dset_id2 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
+    }
+
+#if 0
+    if ((dset_id3 = H5Dopen2(group_id, DATASET_ARRAY_TYPE_TEST_DSET_NAME3, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
+    }
+#endif
+
+    if (H5Tclose(array_type_id1) < 0)
+        TEST_ERROR
+    if (H5Tclose(array_type_id2) < 0)
+        TEST_ERROR
+#if 0
+    if (H5Tclose(array_type_id3) < 0)
+        TEST_ERROR
+    if (H5Tclose(nested_type_id) < 0)
+        TEST_ERROR
+#endif
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id1) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+#if 0
+    if (H5Dclose(dset_id3) < 0)
+        TEST_ERROR
+#endif
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(array_type_id1);
+        H5Tclose(array_type_id2);
+#if 0
+        H5Tclose(array_type_id3);
+        H5Tclose(nested_type_id);
+#endif
+        H5Tclose(non_predefined_type_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id1);
+        H5Dclose(dset_id2);
+#if 0
+        H5Dclose(dset_id3);
+#endif
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_create_dataset_shapes(void)
+{
+    hsize_t *dims = NULL;
+    size_t   i;
+    hid_t    file_id = -1, fapl_id = -1;
+    hid_t    container_group = -1, group_id = -1;
+    hid_t    dset_id = -1, space_id = -1;
+    hid_t    dset_dtype = -1;
+
+    TESTING("dataset creation w/ random dimension sizes")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_SHAPE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating datasets with a variety of randomly-generated dataspace shapes\n");
+#endif
+
+    for (i = 0; i < DATASET_SHAPE_TEST_NUM_ITERATIONS; i++) {
+        size_t j;
+        char   name[100];
+        int    ndims = rand() % DATASET_SHAPE_TEST_MAX_DIMS + 1;
+
+        if (NULL == (dims = (hsize_t *)malloc((size_t)ndims * sizeof(*dims)))) {
+            H5_FAILED();
+            printf("    couldn't allocate space for dataspace dimensions\n");
+            goto error;
+        }
+
+        for (j = 0; j < (size_t)ndims; j++)
+            dims[j] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+        if ((space_id = H5Screate_simple(ndims, dims, NULL)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataspace\n");
+            goto error;
+        }
+
+        sprintf(name, "%s%zu", DATASET_SHAPE_TEST_DSET_BASE_NAME, i + 1);
+
+        if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (dims) {
+            free(dims);
+            dims = NULL;
+        }
+
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+    }
+
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (dims)
+            free(dims);
+        H5Sclose(space_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_create_dataset_creation_properties(void)
+{
+    hsize_t dims[DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id = -1, dcpl_id = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   fspace_id  = -1;
+
+    TESTING("dataset creation properties")
+    SKIPPED()
+    return 0;
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_CREATION_PROPERTIES_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create group\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_CREATION_PROPERTIES_TEST_SHAPE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a variety of datasets with different creation properties\n");
+#endif
+
+    /* Test the alloc time property */
+    {
+        H5D_alloc_time_t alloc_times[] = {H5D_ALLOC_TIME_DEFAULT, H5D_ALLOC_TIME_EARLY, H5D_ALLOC_TIME_INCR,
+                                          H5D_ALLOC_TIME_LATE};
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the alloc time property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ARRAY_LENGTH(alloc_times); i++) {
+            char name[100];
+
+            if (H5Pset_alloc_time(dcpl_id, alloc_times[i]) < 0)
+                TEST_ERROR
+
+            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_ALLOC_TIMES_BASE_NAME, i);
+
+            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
+                                      H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't create dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+
+            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't open dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+        }
+
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* Test the attribute creation order property */
+    {
+        unsigned creation_orders[] = {H5P_CRT_ORDER_TRACKED, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED};
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the attribute creation order property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ARRAY_LENGTH(creation_orders); i++) {
+            char name[100];
+
+            if (H5Pset_attr_creation_order(dcpl_id, creation_orders[i]) < 0)
+                TEST_ERROR
+
+            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_CRT_ORDER_BASE_NAME, i);
+
+            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
+                                      H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't create dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+
+            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't open dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+        }
+
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* Test the attribute phase change property */
+    {
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the attribute phase change property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        if (H5Pset_attr_phase_change(dcpl_id, DATASET_CREATION_PROPERTIES_TEST_MAX_COMPACT,
+                                     DATASET_CREATION_PROPERTIES_TEST_MIN_DENSE) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_PHASE_CHANGE_DSET_NAME,
+                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_PHASE_CHANGE_DSET_NAME,
+                                H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* Test the fill time property */
+    {
+        H5D_fill_time_t fill_times[] = {H5D_FILL_TIME_IFSET, H5D_FILL_TIME_ALLOC, H5D_FILL_TIME_NEVER};
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the fill time property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ARRAY_LENGTH(fill_times); i++) {
+            char name[100];
+
+            if (H5Pset_fill_time(dcpl_id, fill_times[i]) < 0)
+                TEST_ERROR
+
+            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_FILL_TIMES_BASE_NAME, i);
+
+            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
+                                      H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't create dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+
+            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't open dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+        }
+
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* TODO: Test the fill value property */
+    {
+
+    }
+
+    {
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing dataset filters\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        /* Set all of the available filters on the DCPL */
+        if (H5Pset_deflate(dcpl_id, 7) < 0)
+            TEST_ERROR
+        if (H5Pset_shuffle(dcpl_id) < 0)
+            TEST_ERROR
+        if (H5Pset_fletcher32(dcpl_id) < 0)
+            TEST_ERROR
+        if (H5Pset_nbit(dcpl_id) < 0)
+            TEST_ERROR
+        if (H5Pset_scaleoffset(dcpl_id, H5Z_SO_FLOAT_ESCALE, 2) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_FILTERS_DSET_NAME, dset_dtype,
+                                  fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_FILTERS_DSET_NAME, H5P_DEFAULT)) <
+            0) {
+            H5_FAILED();
+            printf("    couldn't open dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* Test the storage layout property */
+    {
+        H5D_layout_t layouts[] = {H5D_COMPACT, H5D_CONTIGUOUS, H5D_CHUNKED};
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the storage layout property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        for (i = 0; i < ARRAY_LENGTH(layouts); i++) {
+            char name[100];
+
+            if (H5Pset_layout(dcpl_id, layouts[i]) < 0)
+                TEST_ERROR
+
+            if (H5D_CHUNKED == layouts[i]) {
+                hsize_t chunk_dims[DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK];
+                size_t  j;
+
+                for (j = 0; j < DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK; j++)
+                    chunk_dims[j] = (hsize_t)(rand() % (int)dims[j] + 1);
+
+                if (H5Pset_chunk(dcpl_id, DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK, chunk_dims) < 0)
+                    TEST_ERROR
+            }
+
+            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_LAYOUTS_BASE_NAME, i);
+
+            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
+                                      H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't create dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+
+            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                printf("    couldn't open dataset\n");
+                goto error;
+            }
+
+            if (H5Dclose(dset_id) < 0)
+                TEST_ERROR
+        }
+
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    /* Test the "track object times" property */
+    {
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Testing the object time tracking property\n");
+#endif
+
+        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+
+        if (H5Pset_obj_track_times(dcpl_id, true) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_YES_DSET_NAME,
+                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_YES_DSET_NAME,
+                                H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if (H5Pset_obj_track_times(dcpl_id, false) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_NO_DSET_NAME,
+                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't create dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+
+        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_NO_DSET_NAME,
+                                H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open dataset\n");
+            goto error;
+        }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+        if (H5Pclose(dcpl_id) < 0)
+            TEST_ERROR
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_write_dataset_small_all(void)
+{
+    hssize_t space_npoints;
+    hsize_t  dims[DATASET_SMALL_WRITE_TEST_ALL_DSET_SPACE_RANK] = {10, 5, 3};
+    size_t   i;
+    hid_t    file_id = -1, fapl_id = -1;
+    hid_t    container_group = -1;
+    hid_t    dset_id         = -1;
+    hid_t    fspace_id       = -1;
+    void    *data            = NULL;
+
+    TESTING("small write to dataset w/ H5S_ALL")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_ALL_DSET_NAME,
+                              DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    /* Close the dataset and dataspace to ensure that retrieval of file space ID is working */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_SMALL_WRITE_TEST_ALL_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+    for (i = 0; i < (hsize_t)space_npoints; i++)
+        ((int *)data)[i] = (int)i;
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to entire dataset with a small amount of data\n");
+#endif
+
+    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_write_dataset_small_hyperslab(void)
+{
+    hsize_t start[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t stride[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t count[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t block[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK] = {10, 5, 3};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   mspace_id = -1, fspace_id = -1;
+    void   *data = NULL;
+
+    TESTING("small write to dataset w/ hyperslab")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK - 1, dims, NULL)) <
+        0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_NAME,
+                              DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0, data_size = 1; i < DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK - 1; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE; i++)
+        ((int *)data)[i] = (int)i;
+
+    for (i = 0; i < DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
+        start[i]  = 0;
+        stride[i] = 1;
+        count[i]  = dims[i];
+        block[i]  = 1;
+    }
+
+    count[2] = 1;
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing small amount of data to dataset using a hyperslab selection\n");
+#endif
+
+    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_write_dataset_small_point_selection(void)
+{
+    hsize_t points[DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS *
+                   DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {10, 10, 10};
+    hsize_t mdims[1];
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   fspace_id       = -1;
+    hid_t   mspace_id       = -1;
+    void   *data            = NULL;
+
+    TESTING("small write to dataset w/ point selection")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
+        0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_NAME,
+                              DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    data_size = DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS *
+                DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    mdims[0] = DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS;
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    for (i = 0; i < data_size / DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPESIZE; i++)
+        ((int *)data)[i] = (int)i;
+
+    for (i = 0; i < DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS; i++) {
+        size_t j;
+
+        for (j = 0; j < DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK; j++)
+            points[(i * DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK) + j] = i;
+    }
+
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS,
+                           points) < 0) {
+        H5_FAILED();
+        printf("    couldn't select points\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing a small amount of data to dataset using a point selection\n");
+#endif
+
+    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPE, mspace_id, fspace_id,
+                 H5P_DEFAULT, data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+#ifndef NO_LARGE_TESTS
+static int
+test_write_dataset_large_all(void)
+{
+    hssize_t space_npoints;
+    hsize_t  dims[DATASET_LARGE_WRITE_TEST_ALL_DSET_SPACE_RANK] = {600, 600, 600};
+    size_t   i, data_size;
+    hid_t    file_id = -1, fapl_id = -1;
+    hid_t    container_group = -1;
+    hid_t    dset_id         = -1;
+    hid_t    fspace_id       = -1;
+    void    *data            = NULL;
+
+    TESTING("write to large dataset w/ H5S_ALL")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_WRITE_TEST_ALL_DSET_NAME,
+                              DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    /* Close the dataset and dataspace to ensure that retrieval of file space ID is working */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_LARGE_WRITE_TEST_ALL_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+    for (i = 0; i < (hsize_t)space_npoints; i++)
+        ((int *)data)[i] = (int)i;
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to entire dataset with a large amount of data\n");
+#endif
+
+    if (H5Dwrite(dset_id, DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_write_dataset_large_hyperslab(void)
+{
+    hsize_t start[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t stride[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t count[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t block[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK] = {600, 600, 600};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   mspace_id = -1, fspace_id = -1;
+    void   *data = NULL;
+
+    TESTING("write to large dataset w/ hyperslab selection")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_NAME,
+                              DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0, data_size = 1; i < DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE; i++)
+        ((int *)data)[i] = (int)i;
+
+    for (i = 0; i < DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
+        start[i]  = 0;
+        stride[i] = 1;
+        count[i]  = dims[i];
+        block[i]  = 1;
+    }
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing large amount of data to dataset using a hyperslab selection\n");
+#endif
+
+    if (H5Dwrite(dset_id, DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_write_dataset_large_point_selection(void)
+{
+    TESTING("write to large dataset w/ point selection")
+
+    SKIPPED();
+
+    return 0;
+
+error:
+    return 1;
+}
+#endif
+
+static int
+test_read_dataset_small_all(void)
+{
+    hsize_t dims[DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK] = {10, 5, 3};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   fspace_id       = -1;
+    void   *read_buf        = NULL;
+
+    TESTING("small read from dataset w/ H5S_ALL")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_ALL_DSET_NAME,
+                              DATASET_SMALL_READ_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0, data_size = 1; i < DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_SMALL_READ_TEST_ALL_DSET_DTYPESIZE;
+
+    if (NULL == (read_buf = malloc(data_size)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading entirety of small dataset\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (read_buf)
+            free(read_buf);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_read_dataset_small_hyperslab(void)
+{
+    hsize_t start[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t stride[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t count[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t block[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK] = {10, 5, 3};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   mspace_id = -1, fspace_id = -1;
+    void   *read_buf = NULL;
+
+    TESTING("small read from dataset w/ hyperslab")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK - 1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_NAME,
+                              DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
+        start[i]  = 0;
+        stride[i] = 1;
+        count[i]  = dims[i];
+        block[i]  = 1;
+    }
+
+    count[2] = 1;
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    for (i = 0, data_size = 1; i < DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK - 1; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPESIZE;
+
+    if (NULL == (read_buf = malloc(data_size)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading portion of small dataset using hyperslab selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                read_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (read_buf)
+            free(read_buf);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_read_dataset_small_point_selection(void)
+{
+    hsize_t points[DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS *
+                   DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {10, 10, 10};
+    hsize_t mspace_dims[] = {DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   fspace_id       = -1;
+    hid_t   mspace_id       = -1;
+    void   *data            = NULL;
+
+    TESTING("small read from dataset w/ point selection")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
+        0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(1, mspace_dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_NAME,
+                              DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    data_size = DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS *
+                DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS; i++) {
+        size_t j;
+
+        for (j = 0; j < DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK; j++)
+            points[(i * DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + j] = i;
+    }
+
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS,
+                           points) < 0) {
+        H5_FAILED();
+        printf("    couldn't select points\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading portion of small dataset using a point selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPE, mspace_id, fspace_id,
+                H5P_DEFAULT, data) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+#ifndef NO_LARGE_TESTS
+static int
+test_read_dataset_large_all(void)
+{
+    hsize_t dims[DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK] = {600, 600, 600};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   fspace_id       = -1;
+    void   *read_buf        = NULL;
+
+    TESTING("read from large dataset w/ H5S_ALL")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_ALL_DSET_NAME,
+                              DATASET_LARGE_READ_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0, data_size = 1; i < DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_LARGE_READ_TEST_ALL_DSET_DTYPESIZE;
+
+    if (NULL == (read_buf = malloc(data_size)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading entirety of large dataset\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (read_buf)
+            free(read_buf);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_read_dataset_large_hyperslab(void)
+{
+    hsize_t start[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t stride[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t count[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t block[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
+    hsize_t dims[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK] = {600, 600, 600};
+    size_t  i, data_size;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   mspace_id = -1, fspace_id = -1;
+    void   *read_buf = NULL;
+
+    TESTING("read from large dataset w/ hyperslab selection")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_NAME,
+                              DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
+        start[i]  = 0;
+        stride[i] = 1;
+        count[i]  = dims[i];
+        block[i]  = 1;
+    }
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    for (i = 0, data_size = 1; i < DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPESIZE;
+
+    if (NULL == (read_buf = malloc(data_size)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading portion of large dataset using hyperslab selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                read_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_read_dataset_large_point_selection(void)
+{
+    hsize_t *points                                                        = NULL;
+    hsize_t  dims[DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {600, 600, 600};
+    hid_t    file_id = -1, fapl_id = -1;
+    hid_t    container_group = -1;
+    hid_t    dset_id         = -1;
+    hid_t    fspace_id       = -1;
+    void    *data            = NULL;
+
+    TESTING("read from large dataset w/ point selection")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
+        0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_NAME,
+                              DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    size_t num_elems = 1;
+
+    for (size_t i = 0; i < DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK; i++)
+        num_elems *= dims[i];
+
+    if (NULL == (data = calloc(num_elems, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPESIZE)))
+        TEST_ERROR
+    if (NULL == (points = calloc(3 * num_elems, sizeof(hsize_t))))
+        TEST_ERROR
+
+    /* Select the entire dataspace */
+    for (size_t i = 0; i < num_elems; i += 3) {
+        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK)] =
+            (i % (dims[0] * dims[1])) % dims[1];
+        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + 1] =
+            (i % (dims[0] * dims[1])) / dims[0];
+        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + 2] = (i / (dims[0] * dims[1]));
+    }
+
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, num_elems, points) < 0) {
+        H5_FAILED();
+        printf("    couldn't select points\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading portion of large dataset using a point selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPE, H5S_ALL, fspace_id, H5P_DEFAULT,
+                data) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (points) {
+        free(points);
+        points = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        if (points)
+            free(points);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+#endif
+
+static int
+test_write_dataset_data_verification(void)
+{
+    hssize_t space_npoints;
+    hsize_t  dims[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK] = {10, 10, 10};
+    hsize_t  mdims[2];
+    hsize_t  start[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
+    hsize_t  stride[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
+    hsize_t  count[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
+    hsize_t  block[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
+    hsize_t
+           points[DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS * DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
+    size_t i, data_size;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1;
+    hid_t  dset_id         = -1;
+    hid_t  fspace_id       = -1;
+    hid_t  mspace_id       = -1;
+    void  *data            = NULL;
+    void  *write_buf       = NULL;
+    void  *read_buf        = NULL;
+
+    TESTING("verification of dataset data after write then read")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Screate_simple(DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                              DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset using H5S_ALL\n");
+#endif
+
+    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
+        ((int *)data)[i] = (int)i;
+
+    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the data that comes back is correct after writing to entire dataset\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < (hsize_t)space_npoints; i++)
+        if (((int *)data)[i] != (int)i) {
+            H5_FAILED();
+            printf("    ALL selection data verification failed\n");
+            goto error;
+        }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset using hyperslab selection - contiguous\n");
+#endif
+
+    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (write_buf = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
+        ((int *)write_buf)[i] = 56;
+
+    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < 2; i++) {
+        size_t j;
+
+        for (j = 0; j < dims[1]; j++)
+            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 56;
+    }
+
+    /* Write to first two rows of dataset */
+    mdims[0]  = dims[1] * 2;
+    start[0]  = 0;
+    stride[0] = 1;
+    count[0]  = dims[1] * 2;
+    block[0]  = 1;
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    start[0] = start[1] = start[2] = 0;
+    stride[0] = stride[1] = stride[2] = 1;
+    count[0]                          = 2;
+    count[1]                          = dims[1];
+    count[2]                          = 1;
+    block[0] = block[1] = block[2] = 1;
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
+         "selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(data, read_buf, data_size)) {
+        H5_FAILED();
+        printf("    hyperslab selection data (contiguous) verification failed\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (write_buf) {
+        free(write_buf);
+        write_buf = NULL;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset using hyperslab selection - contiguous - non-zero offset\n");
+#endif
+
+    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (write_buf = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < dims[1]; i++)
+        ((int *)write_buf)[i] = 68;
+    for (i = dims[1]; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
+        ((int *)write_buf)[i] = 67;
+
+    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 2; i < 3; i++) {
+        size_t j;
+
+        for (j = 0; j < dims[1]; j++)
+            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 67;
+    }
+
+    /* Write to third row of dataset */
+    mdims[0]  = dims[1] * 2;
+    start[0]  = dims[1];
+    stride[0] = 1;
+    count[0]  = dims[1];
+    block[0]  = 1;
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    start[0] = 2;
+    start[1] = start[2] = 0;
+    stride[0] = stride[1] = stride[2] = 1;
+    count[0]                          = 1;
+    count[1]                          = dims[1];
+    count[2]                          = 1;
+    block[0] = block[1] = block[2] = 1;
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
+         "selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(data, read_buf, data_size)) {
+        H5_FAILED();
+        printf("    hyperslab selection data (contiguous) verification failed\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (write_buf) {
+        free(write_buf);
+        write_buf = NULL;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset using hyperslab selection - non-contiguous\n");
+#endif
+
+    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (write_buf = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i = i + 2)
+        ((int *)write_buf)[i] = 78;
+    for (i = 1; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i = i + 2)
+        ((int *)write_buf)[i] = 79;
+
+    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 3; i < 4; i++) {
+        size_t j;
+
+        for (j = 0; j < dims[1]; j++)
+            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 78;
+    }
+
+    /* Write to fourth row of dataset */
+    mdims[0] = dims[1];
+    mdims[1] = 2;
+    start[0] = start[1] = 0;
+    stride[0] = stride[1] = 1;
+    count[0]              = dims[1];
+    count[1]              = 1;
+    block[0] = block[1] = 1;
+    if ((mspace_id = H5Screate_simple(2, mdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    start[0] = 3;
+    start[1] = start[2] = 0;
+    stride[0] = stride[1] = stride[2] = 1;
+    count[0]                          = 1;
+    count[1]                          = dims[1];
+    count[2]                          = 1;
+    block[0] = block[1] = block[2] = 1;
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
+         "selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(data, read_buf, data_size)) {
+        H5_FAILED();
+        printf("    hyperslab selection data (non-contiguous) verification failed\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (write_buf) {
+        free(write_buf);
+        write_buf = NULL;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset using point selection\n");
+#endif
+
+    data_size = DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (write_buf = malloc(data_size)))
+        TEST_ERROR
+
+    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
+        ((int *)write_buf)[i] = 13;
+
+    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (data = malloc(data_size)))
+        TEST_ERROR
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < dims[0]; i++) {
+        size_t j;
+
+        for (j = 0; j < dims[1]; j++) {
+            size_t k;
+
+            for (k = 0; k < dims[2]; k++) {
+                if (i == j && j == k)
+                    ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2]) + k] = 13;
+            }
+        }
+    }
+
+    /* Select a series of 10 points in the dataset */
+    mdims[0] = DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS;
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+        TEST_ERROR
+    for (i = 0; i < DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS; i++) {
+        points[i] = i;
+    }
+    if (H5Sselect_elements(mspace_id, H5S_SELECT_SET, DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS, points) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS; i++) {
+        size_t j;
+
+        for (j = 0; j < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; j++)
+            points[(i * DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK) + j] = i;
+    }
+
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS, points) < 0)
+        TEST_ERROR
+
+    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
+                 write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the data that comes back is correct after writing to dataset using point "
+         "selection\n");
+#endif
+
+    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(data, read_buf, data_size)) {
+        H5_FAILED();
+        printf("    point selection data verification failed\n");
+        goto error;
+    }
+
+    if (data) {
+        free(data);
+        data = NULL;
+    }
+
+    if (write_buf) {
+        free(write_buf);
+        write_buf = NULL;
+    }
+
+    if (read_buf) {
+        free(read_buf);
+        read_buf = NULL;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (data)
+            free(data);
+        if (write_buf)
+            free(write_buf);
+        if (read_buf)
+            free(read_buf);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_dataset_set_extent(void)
+{
+    hsize_t dims[DATASET_SET_EXTENT_TEST_SPACE_RANK];
+    hsize_t new_dims[DATASET_SET_EXTENT_TEST_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   dset_dtype      = -1;
+    hid_t   fspace_id       = -1;
+
+    TESTING("set dataset extent")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_SET_EXTENT_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < DATASET_SET_EXTENT_TEST_SPACE_RANK; i++)
+        new_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_SET_EXTENT_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SET_EXTENT_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Testing use of H5Dset_extent to change dataset's extent\n");
+#endif
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Dset_extent(dset_id, new_dims) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+    }
+    H5E_END_TRY;
+
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
-                                      H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't create dataset\n");
-                goto error;
-            }
+    PASSED();
 
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
+    return 0;
 
-            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't open dataset\n");
-                goto error;
-            }
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
 
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
-        }
+    return 1;
+}
 
-        if (H5Pclose(dcpl_id) < 0)
+static int
+test_unused_dataset_API_calls(void)
+{
+    H5D_space_status_t allocation;
+    hsize_t            dims[DATASET_UNUSED_APIS_TEST_SPACE_RANK];
+    size_t             i;
+    hid_t              file_id = -1, fapl_id = -1;
+    hid_t              container_group = -1;
+    hid_t              dset_id         = -1;
+    hid_t              dset_dtype      = -1;
+    hid_t              fspace_id       = -1;
+
+    TESTING("unused dataset API calls")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_UNUSED_APIS_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(DATASET_UNUSED_APIS_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_UNUSED_APIS_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Testing that all of the unused dataset API calls don't cause application issues\n");
+#endif
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Dget_storage_size(dset_id) > 0)
+            TEST_ERROR
+        if (H5Dget_space_status(dset_id, &allocation) > 0)
+            TEST_ERROR
+        if (H5Dget_offset(dset_id) != HADDR_UNDEF)
             TEST_ERROR
     }
+    H5E_END_TRY;
 
-    /* Test the attribute phase change property */
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
     {
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_dataset_property_lists(void)
+{
+    const char *path_prefix = "/test_prefix";
+    hsize_t     dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
+    hsize_t     chunk_dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
+    size_t      i;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    hid_t       dset_id1 = -1, dset_id2 = -1, dset_id3 = -1, dset_id4 = -1;
+    hid_t       dcpl_id1 = -1, dcpl_id2 = -1;
+    hid_t       dapl_id1 = -1, dapl_id2 = -1;
+    hid_t       dset_dtype1 = -1, dset_dtype2 = -1, dset_dtype3 = -1, dset_dtype4 = -1;
+    hid_t       space_id   = -1;
+    char       *tmp_prefix = NULL;
+
+    TESTING("dataset property list operations")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
+        chunk_dims[i] = (hsize_t)(rand() % (int)dims[i] + 1);
+
+    if ((space_id = H5Screate_simple(DATASET_PROPERTY_LIST_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype3 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype4 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((dcpl_id1 = H5Pcreate(H5P_DATASET_CREATE)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create DCPL\n");
+        goto error;
+    }
+
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the attribute phase change property\n");
+    puts("Setting property on DCPL\n");
 #endif
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
+    if (H5Pset_chunk(dcpl_id1, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, chunk_dims) < 0) {
+        H5_FAILED();
+        printf("    couldn't set DCPL property\n");
+        goto error;
+    }
 
-        if (H5Pset_attr_phase_change(dcpl_id, DATASET_CREATION_PROPERTIES_TEST_MAX_COMPACT,
-                                     DATASET_CREATION_PROPERTIES_TEST_MIN_DENSE) < 0)
-            TEST_ERROR
+    if ((dset_id1 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME1, dset_dtype1, space_id,
+                               H5P_DEFAULT, dcpl_id1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
 
-        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_PHASE_CHANGE_DSET_NAME,
-                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
+    if ((dset_id2 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME2, dset_dtype2, space_id,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    if (H5Pclose(dcpl_id1) < 0)
+        TEST_ERROR
+
+    /* Try to receive copies of the two property lists, one which has the property set and one which does not
+     */
+    if ((dcpl_id1 = H5Dget_create_plist(dset_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
+
+    if ((dcpl_id2 = H5Dget_create_plist(dset_id2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    /* Ensure that property list 1 has the property set and property list 2 does not */
+    {
+        hsize_t tmp_chunk_dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
 
-        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_PHASE_CHANGE_DSET_NAME,
-                                H5P_DEFAULT)) < 0) {
+        memset(tmp_chunk_dims, 0, sizeof(tmp_chunk_dims));
+
+        if (H5Pget_chunk(dcpl_id1, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, tmp_chunk_dims) < 0) {
             H5_FAILED();
-            printf("    couldn't open dataset\n");
+            printf("    couldn't get DCPL property value\n");
             goto error;
         }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-        if (H5Pclose(dcpl_id) < 0)
-            TEST_ERROR
-    }
-
-    /* Test the fill time property */
-    {
-        H5D_fill_time_t fill_times[] = {H5D_FILL_TIME_IFSET, H5D_FILL_TIME_ALLOC, H5D_FILL_TIME_NEVER};
-
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the fill time property\n");
+        puts("Ensuring that the property on the DCPL was received back correctly\n");
 #endif
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
-
-        for (i = 0; i < ARRAY_LENGTH(fill_times); i++) {
-            char name[100];
-
-            if (H5Pset_fill_time(dcpl_id, fill_times[i]) < 0)
-                TEST_ERROR
-
-            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_FILL_TIMES_BASE_NAME, i);
-
-            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
-                                      H5P_DEFAULT)) < 0) {
+        for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
+            if (tmp_chunk_dims[i] != chunk_dims[i]) {
                 H5_FAILED();
-                printf("    couldn't create dataset\n");
+                printf("    DCPL property values were incorrect\n");
                 goto error;
             }
 
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
-
-            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
+        H5E_BEGIN_TRY
+        {
+            if (H5Pget_chunk(dcpl_id2, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, tmp_chunk_dims) >= 0) {
                 H5_FAILED();
-                printf("    couldn't open dataset\n");
+                printf("    property list 2 shouldn't have had chunk dimensionality set (not a chunked "
+                       "layout)\n");
                 goto error;
             }
-
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
         }
-
-        if (H5Pclose(dcpl_id) < 0)
-            TEST_ERROR
+        H5E_END_TRY;
     }
 
-    /* TODO: Test the fill value property */
-    {
-
+    if ((dapl_id1 = H5Pcreate(H5P_DATASET_ACCESS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create DAPL\n");
+        goto error;
     }
 
-    {
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Testing dataset filters\n");
+    puts("Setting property on DAPL\n");
 #endif
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
+    if (H5Pset_efile_prefix(dapl_id1, path_prefix) < 0) {
+        H5_FAILED();
+        printf("    couldn't set DAPL property\n");
+        goto error;
+    }
 
-        /* Set all of the available filters on the DCPL */
-        if (H5Pset_deflate(dcpl_id, 7) < 0)
-            TEST_ERROR
-        if (H5Pset_shuffle(dcpl_id) < 0)
-            TEST_ERROR
-        if (H5Pset_fletcher32(dcpl_id) < 0)
-            TEST_ERROR
-        if (H5Pset_nbit(dcpl_id) < 0)
-            TEST_ERROR
-        if (H5Pset_scaleoffset(dcpl_id, H5Z_SO_FLOAT_ESCALE, 2) < 0)
-            TEST_ERROR
+    if ((dset_id3 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME3, dset_dtype3, space_id,
+                               H5P_DEFAULT, H5P_DEFAULT, dapl_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
 
-        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_FILTERS_DSET_NAME, dset_dtype,
-                                  fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
+    if ((dset_id4 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME4, dset_dtype4, space_id,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    if (H5Pclose(dapl_id1) < 0)
+        TEST_ERROR
 
-        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_FILTERS_DSET_NAME, H5P_DEFAULT)) <
-            0) {
-            H5_FAILED();
-            printf("    couldn't open dataset\n");
-            goto error;
-        }
+    /* Try to receive copies of the two property lists, one which has the property set and one which does not
+     */
+    if ((dapl_id1 = H5Dget_access_plist(dset_id3)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-        if (H5Pclose(dcpl_id) < 0)
-            TEST_ERROR
+    if ((dapl_id2 = H5Dget_access_plist(dset_id4)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
     }
 
-    /* Test the storage layout property */
+    /* Ensure that property list 1 has the property set and property list 2 does not */
     {
-        H5D_layout_t layouts[] = {H5D_COMPACT, H5D_CONTIGUOUS, H5D_CHUNKED};
+        ssize_t buf_size = 0;
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the storage layout property\n");
+        puts("Ensuring that the property on the DAPL was received back correctly\n");
 #endif
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
-
-        for (i = 0; i < ARRAY_LENGTH(layouts); i++) {
-            char name[100];
-
-            if (H5Pset_layout(dcpl_id, layouts[i]) < 0)
-                TEST_ERROR
-
-            if (H5D_CHUNKED == layouts[i]) {
-                hsize_t chunk_dims[DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK];
-                size_t  j;
-
-                for (j = 0; j < DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK; j++)
-                    chunk_dims[j] = (hsize_t)(rand() % (int)dims[j] + 1);
-
-                if (H5Pset_chunk(dcpl_id, DATASET_CREATION_PROPERTIES_TEST_CHUNK_DIM_RANK, chunk_dims) < 0)
-                    TEST_ERROR
-            }
-
-            sprintf(name, "%s%zu", DATASET_CREATION_PROPERTIES_TEST_LAYOUTS_BASE_NAME, i);
-
-            if ((dset_id = H5Dcreate2(group_id, name, dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id,
-                                      H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't create dataset\n");
-                goto error;
-            }
-
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
-
-            if ((dset_id = H5Dopen2(group_id, name, H5P_DEFAULT)) < 0) {
-                H5_FAILED();
-                printf("    couldn't open dataset\n");
-                goto error;
-            }
-
-            if (H5Dclose(dset_id) < 0)
-                TEST_ERROR
+        if ((buf_size = H5Pget_efile_prefix(dapl_id1, NULL, 0)) < 0) {
+            H5_FAILED();
+            printf("    couldn't retrieve size for property value buffer\n");
+            goto error;
         }
 
-        if (H5Pclose(dcpl_id) < 0)
+        if (NULL == (tmp_prefix = (char *)calloc(1, (size_t)buf_size + 1)))
             TEST_ERROR
-    }
 
-    /* Test the "track object times" property */
-    {
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Testing the object time tracking property\n");
-#endif
+        if (H5Pget_efile_prefix(dapl_id1, tmp_prefix, (size_t)buf_size + 1) < 0) {
+            H5_FAILED();
+            printf("    couldn't retrieve property list value\n");
+            goto error;
+        }
 
-        if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-            TEST_ERROR
+        if (strcmp(tmp_prefix, path_prefix)) {
+            H5_FAILED();
+            printf("    DAPL values were incorrect!\n");
+            goto error;
+        }
 
-        if (H5Pset_obj_track_times(dcpl_id, true) < 0)
-            TEST_ERROR
+        memset(tmp_prefix, 0, (size_t)buf_size + 1);
 
-        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_YES_DSET_NAME,
-                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+        if (H5Pget_efile_prefix(dapl_id2, tmp_prefix, (size_t)buf_size) < 0) {
             H5_FAILED();
-            printf("    couldn't create dataset\n");
+            printf("    couldn't retrieve property list value\n");
             goto error;
         }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-
-        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_YES_DSET_NAME,
-                                H5P_DEFAULT)) < 0) {
+        if (!strcmp(tmp_prefix, path_prefix)) {
             H5_FAILED();
-            printf("    couldn't open dataset\n");
+            printf("    DAPL property value was set!\n");
             goto error;
         }
+    }
+
+    /* Now close the property lists and datasets and see if we can still retrieve copies of
+     * the property lists upon opening (instead of creating) a dataset
+     */
+    if (H5Pclose(dcpl_id1) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id1) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id2) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id1) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id3) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id4) < 0)
+        TEST_ERROR
+
+    if ((dset_id1 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((dset_id2 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if ((dset_id3 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME3, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    if ((dset_id4 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME4, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
 
-        if (H5Pset_obj_track_times(dcpl_id, false) < 0)
-            TEST_ERROR
+    if ((dcpl_id1 = H5Dget_create_plist(dset_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if ((dset_id = H5Dcreate2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_NO_DSET_NAME,
-                                  dset_dtype, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't create dataset\n");
-            goto error;
-        }
+    if ((dcpl_id2 = H5Dget_create_plist(dset_id2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
+    if ((dapl_id1 = H5Dget_access_plist(dset_id3)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if ((dset_id = H5Dopen2(group_id, DATASET_CREATION_PROPERTIES_TEST_TRACK_TIMES_NO_DSET_NAME,
-                                H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't open dataset\n");
-            goto error;
-        }
+    if ((dapl_id2 = H5Dget_create_plist(dset_id4)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
 
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-        if (H5Pclose(dcpl_id) < 0)
-            TEST_ERROR
+    if (tmp_prefix) {
+        free(tmp_prefix);
+        tmp_prefix = NULL;
     }
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Pclose(dcpl_id1) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Pclose(dcpl_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id1) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id2) < 0)
+        TEST_ERROR
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype1) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype2) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype3) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype4) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id1) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id3) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id4) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -7079,10 +10445,20 @@ test_create_dataset_creation_properties(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Pclose(dcpl_id);
+        free(tmp_prefix);
+        H5Pclose(dcpl_id1);
+        H5Pclose(dcpl_id2);
+        H5Pclose(dapl_id1);
+        H5Pclose(dapl_id2);
+        H5Sclose(space_id);
+        H5Tclose(dset_dtype1);
+        H5Tclose(dset_dtype2);
+        H5Tclose(dset_dtype3);
+        H5Tclose(dset_dtype4);
+        H5Dclose(dset_id1);
+        H5Dclose(dset_id2);
+        H5Dclose(dset_id3);
+        H5Dclose(dset_id4);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -7095,104 +10471,377 @@ error:
 }
 
 static int
-test_write_dataset_small_all(void)
+test_dataset_vlen_io(void)
 {
-    hssize_t space_npoints;
-    hsize_t  dims[DATASET_SMALL_WRITE_TEST_ALL_DSET_SPACE_RANK] = {10, 5, 3};
-    size_t   i;
-    hid_t    file_id = -1, fapl_id = -1;
-    hid_t    container_group = -1;
-    hid_t    dset_id         = -1;
-    hid_t    fspace_id       = -1;
-    void    *data            = NULL;
+    hid_t file_id   = H5I_INVALID_HID;
+    hid_t dset_id   = H5I_INVALID_HID;
+    hid_t fapl_id   = H5I_INVALID_HID;
+    hid_t fspace_id = H5I_INVALID_HID;
+    hid_t dtype_id  = H5I_INVALID_HID;
 
-    TESTING("small write to dataset w/ H5S_ALL")
+    hvl_t init[DATASET_VLEN_IO_TEST_EXTENT];
+    hvl_t wbuf[DATASET_VLEN_IO_TEST_EXTENT];
+    hvl_t rbuf[DATASET_VLEN_IO_TEST_EXTENT];
+
+    const hsize_t dims[]   = {DATASET_VLEN_IO_TEST_EXTENT};
+    const hsize_t points[] = {2, 3, 4, 5};
+
+    /* Hyperslab specification for elements at indices 2-5 */
+    hssize_t start[1]  = {2};
+    hssize_t stride[1] = {2};
+    hssize_t block[1]  = {2};
+    hssize_t count[1]  = {2};
+
+    TESTING("Reading and writing variable-length data to a dataset");
 
     if (H5rest_init() < 0)
         TEST_ERROR
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dtype_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create vlen datatype\n");
+        goto error;
+    }
+
+    if ((dset_id = H5Dcreate2(file_id, DATASET_VLEN_IO_TEST_DSET_NAME, dtype_id, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create vlen dataset\n");
+        goto error;
+    }
+
+    memset(wbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+    memset(init, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+
+    /* Test read and write to entire dataset with vlen data */
+
+    /* Generate data and allocate memory */
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        init[i].len = 0;
+        init[i].p   = NULL;
+
+        wbuf[i].len = i + 1;
+        wbuf[i].p   = calloc(i + 1, sizeof(int));
+
+        for (size_t j = 0; j < i + 1; j++) {
+            ((int *)wbuf[i].p)[j] = (int)((i)*1000 + j * 10);
+        }
+    }
+
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to entire vlen dataset\n");
+        goto error;
+    }
+
+    /* Read back entire dataset */
+    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from entire vlen dataset\n");
+        goto error;
+    }
+
+    /* Verify data */
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        if (rbuf[i].len != wbuf[i].len) {
+            H5_FAILED();
+            printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len, rbuf[i].len);
+            goto error;
+        }
+
+        for (size_t j = 0; j < rbuf[i].len; j++) {
+            int actual   = ((int *)rbuf[i].p)[j];
+            int expected = ((int *)wbuf[i].p)[j];
+
+            if (actual != expected) {
+                H5_FAILED();
+                printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected, actual);
+                goto error;
+            }
+        }
+    }
+
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+
+    /* Test read and write to hyperslab selections with vlen data */
+
+    /* Write to hyperslab, then read all */
+    /* Reset dataset */
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)init) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to entire vlen dataset\n");
+        goto error;
+    }
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, (const void *)wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to hyperslab selection in vlen dataset\n");
+        goto error;
+    }
+
+    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from entire vlen dataset\n");
+        goto error;
+    }
+
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        if (i >= 2 && i <= 5) {
+            if (rbuf[i].len != wbuf[i].len) {
+                H5_FAILED();
+                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
+                       rbuf[i].len);
+                goto error;
+            }
+
+            for (size_t j = 0; j < rbuf[i].len; j++) {
+                int actual   = ((int *)rbuf[i].p)[j];
+                int expected = ((int *)wbuf[i].p)[j];
+
+                if (actual != expected) {
+                    H5_FAILED();
+                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
+                           actual);
+                    goto error;
+                }
+            }
+        }
+        else {
+            if (rbuf[i].len != init[i].len) {
+                H5_FAILED();
+                printf("    Wrong length for unread slab element!");
+                goto error;
+            }
+            if (rbuf[i].p != init[i].p) {
+                H5_FAILED();
+                printf("    Wrong pointer (non-NULL) for unread slab element!");
+                goto error;
+            }
+        }
+    }
+
+    if (H5Sselect_all(fspace_id) < 0)
         TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
         TEST_ERROR
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Write to all, then read from hyperslab */
+
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't write to entire vlen dataset\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    if (H5Dread(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't read from hyperslab selection in vlen dataset\n");
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        if (i >= 2 && i <= 5) {
+            if (rbuf[i].len != wbuf[i].len) {
+                H5_FAILED();
+                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
+                       rbuf[i].len);
+                goto error;
+            }
+
+            for (size_t j = 0; j < rbuf[i].len; j++) {
+                int actual   = ((int *)rbuf[i].p)[j];
+                int expected = ((int *)wbuf[i].p)[j];
+
+                if (actual != expected) {
+                    H5_FAILED();
+                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
+                           actual);
+                    goto error;
+                }
+            }
+        }
+        else {
+            if (rbuf[i].len != init[i].len) {
+                H5_FAILED();
+                printf("    Wrong length for unread slab element!");
+                goto error;
+            }
+            if (rbuf[i].p != init[i].p) {
+                H5_FAILED();
+                printf("    Wrong pointer (non-NULL) for unread slab element!");
+                goto error;
+            }
+        }
+    }
+
+    if (H5Sselect_all(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
         TEST_ERROR
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_ALL_DSET_NAME,
-                              DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
+    /* Test read and write to point selections with vlen data */
+
+    /* Reset dataset */
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)init) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't write to entire vlen dataset\n");
         goto error;
     }
 
-    /* Close the dataset and dataspace to ensure that retrieval of file space ID is working */
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR;
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_VLEN_IO_TEST_NUM_POINTS, points) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_SMALL_WRITE_TEST_ALL_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, (const void *)wbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't write to point selection in vlen dataset\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    /* Read back entire dataset */
+    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    couldn't read from entire vlen dataset\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
-        goto error;
+    /* Verify data */
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        if (i >= 2 && i <= 5) {
+            if (rbuf[i].len != wbuf[i].len) {
+                H5_FAILED();
+                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
+                       rbuf[i].len);
+                goto error;
+            }
+
+            for (size_t j = 0; j < rbuf[i].len; j++) {
+                int actual   = ((int *)rbuf[i].p)[j];
+                int expected = ((int *)wbuf[i].p)[j];
+
+                if (actual != expected) {
+                    H5_FAILED();
+                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
+                           actual);
+                    goto error;
+                }
+            }
+        }
+        else {
+            if (rbuf[i].len != init[i].len) {
+                H5_FAILED();
+                printf("    Wrong length for unread slab element!");
+                goto error;
+            }
+            if (rbuf[i].p != init[i].p) {
+                H5_FAILED();
+                printf("    Wrong pointer (non-NULL) for unread slab element!");
+                goto error;
+            }
+        }
     }
 
-    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPESIZE)))
+    if (H5Sselect_all(fspace_id) < 0)
         TEST_ERROR
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
 
-    for (i = 0; i < (hsize_t)space_npoints; i++)
-        ((int *)data)[i] = (int)i;
+    /* Test point read */
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to entire dataset with a small amount of data\n");
-#endif
+    /* Write to entire dataset */
+    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to entire vlen dataset\n");
+        goto error;
+    }
 
-    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0) {
+    /* Read back selected points */
+    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_VLEN_IO_TEST_NUM_POINTS, points) < 0)
+        TEST_ERROR
+
+    if (H5Dread(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't read from point selection in vlen dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    /* Verify data */
+    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
+        if (i >= 2 && i <= 5) {
+            if (rbuf[i].len != wbuf[i].len) {
+                H5_FAILED();
+                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
+                       rbuf[i].len);
+                goto error;
+            }
+
+            for (size_t j = 0; j < rbuf[i].len; j++) {
+                int actual   = ((int *)rbuf[i].p)[j];
+                int expected = ((int *)wbuf[i].p)[j];
+
+                if (actual != expected) {
+                    H5_FAILED();
+                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
+                           actual);
+                    goto error;
+                }
+            }
+        }
+        else {
+            if (rbuf[i].len != init[i].len) {
+                H5_FAILED();
+                printf("    Wrong length for unread slab element!");
+                goto error;
+            }
+            if (rbuf[i].p != init[i].p) {
+                H5_FAILED();
+                printf("    Wrong pointer (non-NULL) for unread slab element!");
+                goto error;
+            }
+        }
     }
 
+    if (H5Sselect_all(fspace_id) < 0)
+        TEST_ERROR
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+
+    memset(wbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
+
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
+    if (H5Tclose(dtype_id) < 0)
+        TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
     if (H5rest_term() < 0)
@@ -7205,12 +10854,13 @@ test_write_dataset_small_all(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
+        H5Sselect_all(fspace_id);
+        H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf);
+        H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, wbuf);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
-        H5Gclose(container_group);
         H5Pclose(fapl_id);
+        H5Tclose(dtype_id);
         H5Fclose(file_id);
         H5rest_term();
     }
@@ -7219,22 +10869,24 @@ error:
     return 1;
 }
 
+/* Test that writes of single rows through a dataset's write-back buffer are merged into
+ * one write, which is sent before a read through another handle which overlaps them */
 static int
-test_write_dataset_small_hyperslab(void)
+test_dataset_write_buffer(void)
 {
-    hsize_t start[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t stride[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t count[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t block[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK] = {10, 5, 3};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   mspace_id = -1, fspace_id = -1;
-    void   *data = NULL;
-
-    TESTING("small write to dataset w/ hyperslab")
+    H5rest_stats_t stats;
+    hsize_t        dims[] = {DATASET_WRITE_BUFFER_TEST_NUM_ROWS, DATASET_WRITE_BUFFER_TEST_ROW_LEN};
+    hsize_t        start[2];
+    hsize_t        count[2];
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1, dapl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id = -1, dset_id2 = -1;
+    hid_t          fspace_id = -1, mspace_id = -1;
+    int            wbuf[DATASET_WRITE_BUFFER_TEST_NUM_ROWS][DATASET_WRITE_BUFFER_TEST_ROW_LEN];
+    int            rbuf[DATASET_WRITE_BUFFER_TEST_NUM_ROWS][DATASET_WRITE_BUFFER_TEST_ROW_LEN];
+
+    TESTING("dataset write-back buffer")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7256,56 +10908,94 @@ test_write_dataset_small_hyperslab(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
         TEST_ERROR
-    if ((mspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK - 1, dims, NULL)) <
-        0)
+    if (H5Pset_dapl_rest_write_buffer(dapl_id, DATASET_WRITE_BUFFER_TEST_BUFFER_SIZE) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_NAME,
-                              DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_WRITE_BUFFER_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, dapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK - 1; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE;
+    for (i = 0; i < DATASET_WRITE_BUFFER_TEST_NUM_ROWS; i++)
+        for (j = 0; j < DATASET_WRITE_BUFFER_TEST_ROW_LEN; j++)
+            wbuf[i][j] = (int)(i * DATASET_WRITE_BUFFER_TEST_ROW_LEN + j);
 
-    if (NULL == (data = malloc(data_size)))
+    count[0] = 1;
+    count[1] = DATASET_WRITE_BUFFER_TEST_ROW_LEN;
+
+    if ((mspace_id = H5Screate_simple(2, count, NULL)) < 0)
         TEST_ERROR
 
-    for (i = 0; i < data_size / DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE; i++)
-        ((int *)data)[i] = (int)i;
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
 
-    for (i = 0; i < DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
-        start[i]  = 0;
-        stride[i] = 1;
-        count[i]  = dims[i];
-        block[i]  = 1;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing the dataset one row at a time\n");
+#endif
+
+    for (i = 0; i < DATASET_WRITE_BUFFER_TEST_NUM_ROWS; i++) {
+        start[0] = i;
+        start[1] = 0;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf[i]) < 0) {
+            H5_FAILED();
+            printf("    couldn't write row %zu of dataset\n", i);
+            goto error;
+        }
     }
 
-    count[2] = 1;
-
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 0) {
+        H5_FAILED();
+        printf("    %" PRIu64 " writes were sent instead of being buffered\n",
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
+        goto error;
+    }
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing small amount of data to dataset using a hyperslab selection\n");
+    puts("Reading the dataset through another handle\n");
 #endif
 
-    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 data) < 0) {
+    if ((dset_id2 = H5Dopen2(container_group, DATASET_WRITE_BUFFER_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't open dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    memset(rbuf, 0, sizeof(rbuf));
+
+    if (H5Dread(dset_id2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(wbuf, rbuf, sizeof(wbuf))) {
+        H5_FAILED();
+        printf("    data read didn't match buffered writes\n");
+        goto error;
+    }
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 1) {
+        H5_FAILED();
+        printf("    buffered rows were sent in %" PRIu64 " writes instead of one\n",
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
+        goto error;
     }
 
     if (H5Sclose(mspace_id) < 0)
@@ -7314,6 +11004,10 @@ test_write_dataset_small_hyperslab(void)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -7330,11 +11024,11 @@ test_write_dataset_small_hyperslab(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
         H5Sclose(mspace_id);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
+        H5Dclose(dset_id2);
+        H5Pclose(dapl_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -7345,22 +11039,25 @@ error:
     return 1;
 }
 
+/* Test that appends to a dataset with a write-back buffer extend the dataset right
+ * away, but are sent to the server as one change of extent and one write */
 static int
-test_write_dataset_small_point_selection(void)
+test_dataset_append(void)
 {
-    hsize_t points[DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS *
-                   DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {10, 10, 10};
-    hsize_t mdims[1];
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   fspace_id       = -1;
-    hid_t   mspace_id       = -1;
-    void   *data            = NULL;
-
-    TESTING("small write to dataset w/ point selection")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_APPEND_TEST_INITIAL_ROWS, DATASET_APPEND_TEST_ROW_LEN};
+    hsize_t        max_dims[]   = {H5S_UNLIMITED, DATASET_APPEND_TEST_ROW_LEN};
+    hsize_t        chunk_dims[] = {DATASET_APPEND_TEST_CHUNK_ROWS, DATASET_APPEND_TEST_ROW_LEN};
+    hsize_t        space_dims[2];
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1, dapl_id = -1, dcpl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id = -1, dset_id2 = -1;
+    hid_t          fspace_id = -1;
+    int            wbuf[DATASET_APPEND_TEST_TOTAL_ROWS][DATASET_APPEND_TEST_ROW_LEN];
+    int            rbuf[DATASET_APPEND_TEST_TOTAL_ROWS][DATASET_APPEND_TEST_ROW_LEN];
+
+    TESTING("dataset appends")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7382,66 +11079,140 @@ test_write_dataset_small_point_selection(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
-        0)
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_NAME,
-                              DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_dapl_rest_write_buffer(dapl_id, DATASET_APPEND_TEST_BUFFER_SIZE) < 0)
+        TEST_ERROR
+
+    if ((fspace_id = H5Screate_simple(2, dims, max_dims)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_APPEND_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, dcpl_id, dapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    data_size = DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS *
-                DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPESIZE;
+    for (i = 0; i < DATASET_APPEND_TEST_TOTAL_ROWS; i++)
+        for (j = 0; j < DATASET_APPEND_TEST_ROW_LEN; j++)
+            wbuf[i][j] = (int)(i * DATASET_APPEND_TEST_ROW_LEN + j);
 
-    if (NULL == (data = malloc(data_size)))
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Dflush(dset_id) < 0)
         TEST_ERROR
 
-    mdims[0] = DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS;
-    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+    if (H5rest_reset_stats() < 0)
         TEST_ERROR
-    for (i = 0; i < data_size / DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPESIZE; i++)
-        ((int *)data)[i] = (int)i;
 
-    for (i = 0; i < DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS; i++) {
-        size_t j;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Appending rows to the dataset\n");
+#endif
 
-        for (j = 0; j < DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK; j++)
-            points[(i * DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_SPACE_RANK) + j] = i;
+    for (i = 0; i < DATASET_APPEND_TEST_NUM_APPENDS; i++) {
+        size_t row = DATASET_APPEND_TEST_INITIAL_ROWS + i * DATASET_APPEND_TEST_ROWS_PER_APPEND;
+
+        if (H5rest_dataset_append(dset_id, H5P_DEFAULT, 0, DATASET_APPEND_TEST_ROWS_PER_APPEND,
+                                  H5T_NATIVE_INT, wbuf[row]) < 0) {
+            H5_FAILED();
+            printf("    couldn't append rows %zu to dataset\n", row);
+            goto error;
+        }
     }
 
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_NUM_POINTS,
-                           points) < 0) {
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if ((fspace_id = H5Dget_space(dset_id)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(fspace_id, space_dims, NULL) < 0)
+        TEST_ERROR
+
+    if (space_dims[0] != DATASET_APPEND_TEST_TOTAL_ROWS) {
         H5_FAILED();
-        printf("    couldn't select points\n");
+        printf("    dataset has %" PRIuHSIZE " rows after appends instead of %d\n", space_dims[0],
+               DATASET_APPEND_TEST_TOTAL_ROWS);
+        goto error;
+    }
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 0) {
+        H5_FAILED();
+        printf("    appends were sent instead of being buffered\n");
+        goto error;
+    }
+
+    if (H5Dflush(dset_id) < 0)
+        TEST_ERROR
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 1) {
+        H5_FAILED();
+        printf("    buffered appends were sent in %" PRIu64 " writes instead of one\n",
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing a small amount of data to dataset using a point selection\n");
+    puts("Checking the dataset's extent and data on the server\n");
 #endif
 
-    if (H5Dwrite(dset_id, DATASET_SMALL_WRITE_TEST_POINT_SELECTION_DSET_DTYPE, mspace_id, fspace_id,
-                 H5P_DEFAULT, data) < 0) {
+    if ((dset_id2 = H5Dopen2(container_group, DATASET_APPEND_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't open dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if ((fspace_id = H5Dget_space(dset_id2)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(fspace_id, space_dims, NULL) < 0)
+        TEST_ERROR
+
+    if (space_dims[0] != DATASET_APPEND_TEST_TOTAL_ROWS) {
+        H5_FAILED();
+        printf("    extent of dataset wasn't changed on the server\n");
+        goto error;
+    }
+
+    memset(rbuf, 0, sizeof(rbuf));
+
+    if (H5Dread(dset_id2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    if (memcmp(wbuf, rbuf, sizeof(wbuf))) {
+        H5_FAILED();
+        printf("    data read didn't match appended data\n");
+        goto error;
     }
 
-    if (H5Sclose(mspace_id) < 0)
-        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -7458,10 +11229,11 @@ test_write_dataset_small_point_selection(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
+        H5Dclose(dset_id2);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -7472,20 +11244,22 @@ error:
     return 1;
 }
 
-#ifndef NO_LARGE_TESTS
+/* Test that the storage sizes of several datasets can be retrieved at once, with
+ * the file's domain rescanned at most once while the rescan is recent enough */
 static int
-test_write_dataset_large_all(void)
+test_get_storage_sizes(void)
 {
-    hssize_t space_npoints;
-    hsize_t  dims[DATASET_LARGE_WRITE_TEST_ALL_DSET_SPACE_RANK] = {600, 600, 600};
-    size_t   i, data_size;
-    hid_t    file_id = -1, fapl_id = -1;
-    hid_t    container_group = -1;
-    hid_t    dset_id         = -1;
-    hid_t    fspace_id       = -1;
-    void    *data            = NULL;
-
-    TESTING("write to large dataset w/ H5S_ALL")
+    H5rest_stats_t stats;
+    hsize_t        dims[] = {DATASET_STORAGE_SIZES_TEST_DIM0, DATASET_STORAGE_SIZES_TEST_DIM1};
+    hsize_t        sizes[2];
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_ids[2]     = {-1, -1};
+    hid_t          fspace_id       = -1;
+    int            wbuf[DATASET_STORAGE_SIZES_TEST_DIM0][DATASET_STORAGE_SIZES_TEST_DIM1];
+
+    TESTING("retrieval of storage sizes of several datasets")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7494,6 +11268,8 @@ test_write_dataset_large_all(void)
         TEST_ERROR
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
+    if (H5Pset_fapl_rest_storage_size_max_age(fapl_id, DATASET_STORAGE_SIZES_TEST_MAX_AGE) < 0)
+        TEST_ERROR
 
     if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -7507,66 +11283,95 @@ test_write_dataset_large_all(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_WRITE_TEST_ALL_DSET_NAME,
-                              DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
+    if ((dset_ids[0] = H5Dcreate2(container_group, DATASET_STORAGE_SIZES_TEST_DSET_NAME, H5T_NATIVE_INT,
+                                  fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    /* Close the dataset and dataspace to ensure that retrieval of file space ID is working */
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+    if ((dset_ids[1] = H5Dcreate2(container_group, DATASET_STORAGE_SIZES_TEST_DSET_NAME2, H5T_NATIVE_INT,
+                                  fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_STORAGE_SIZES_TEST_DIM0; i++)
+        for (j = 0; j < DATASET_STORAGE_SIZES_TEST_DIM1; j++)
+            wbuf[i][j] = (int)(i * DATASET_STORAGE_SIZES_TEST_DIM1 + j);
+
+    /* Only write to the first dataset, so that the second has no storage allocated */
+    if (H5Dwrite(dset_ids[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5rest_reset_stats() < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_LARGE_WRITE_TEST_ALL_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving storage sizes of both datasets\n");
+#endif
+
+    if (H5rest_get_storage_sizes(file_id, 2, dset_ids, sizes) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't get storage sizes of datasets\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if (sizes[0] < sizeof(wbuf)) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    storage size of written dataset was %" PRIuHSIZE " instead of at least %zu\n", sizes[0],
+               sizeof(wbuf));
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if (sizes[1] != 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    storage size of unwritten dataset was %" PRIuHSIZE " instead of 0\n", sizes[1]);
         goto error;
     }
 
-    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPESIZE)))
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
-    for (i = 0; i < (hsize_t)space_npoints; i++)
-        ((int *)data)[i] = (int)i;
+    if (stats.op[H5REST_OP_PUT].requests != 1) {
+        H5_FAILED();
+        printf("    domain was rescanned %" PRIu64 " times instead of once\n",
+               stats.op[H5REST_OP_PUT].requests);
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to entire dataset with a large amount of data\n");
+    puts("Checking that storage sizes are consistent with H5Dget_storage_size\n");
 #endif
 
-    if (H5Dwrite(dset_id, DATASET_LARGE_WRITE_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0) {
+    for (i = 0; i < 2; i++)
+        if (H5Dget_storage_size(dset_ids[i]) != sizes[i]) {
+            H5_FAILED();
+            printf("    storage size of dataset %zu didn't match H5Dget_storage_size\n", i);
+            goto error;
+        }
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_PUT].requests != 1) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    domain was rescanned again within the storage size max age\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
-
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Dclose(dset_ids[0]) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_ids[1]) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -7585,7 +11390,8 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(fspace_id);
-        H5Dclose(dset_id);
+        H5Dclose(dset_ids[0]);
+        H5Dclose(dset_ids[1]);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -7596,22 +11402,25 @@ error:
     return 1;
 }
 
+/* Test that a sequential scan of a dataset is served from data read ahead, and that
+ * data read ahead is dropped when another handle to the dataset writes over it */
 static int
-test_write_dataset_large_hyperslab(void)
+test_dataset_read_ahead(void)
 {
-    hsize_t start[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t stride[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t count[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t block[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK] = {600, 600, 600};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   mspace_id = -1, fspace_id = -1;
-    void   *data = NULL;
-
-    TESTING("write to large dataset w/ hyperslab selection")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_READ_AHEAD_TEST_NUM_ROWS, DATASET_READ_AHEAD_TEST_ROW_LEN};
+    hsize_t        block_dims[] = {DATASET_READ_AHEAD_TEST_BLOCK_ROWS, DATASET_READ_AHEAD_TEST_ROW_LEN};
+    hsize_t        start[]      = {0, 0};
+    uint64_t       num_reads;
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1, dapl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id = -1, dset_id2 = -1;
+    hid_t          fspace_id = -1, mspace_id = -1;
+    int            wbuf[DATASET_READ_AHEAD_TEST_NUM_ROWS][DATASET_READ_AHEAD_TEST_ROW_LEN];
+    int            rbuf[DATASET_READ_AHEAD_TEST_BLOCK_ROWS][DATASET_READ_AHEAD_TEST_ROW_LEN];
+
+    TESTING("dataset read-ahead")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7633,53 +11442,116 @@ test_write_dataset_large_hyperslab(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-    if ((mspace_id = H5Screate_simple(DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(2, block_dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_READ_AHEAD_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_READ_AHEAD_TEST_NUM_ROWS; i++)
+        for (j = 0; j < DATASET_READ_AHEAD_TEST_ROW_LEN; j++)
+            wbuf[i][j] = (int)(i * DATASET_READ_AHEAD_TEST_ROW_LEN + j);
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_dapl_rest_read_ahead(dapl_id, DATASET_READ_AHEAD_TEST_DEPTH, DATASET_READ_AHEAD_TEST_SIZE) < 0)
+        TEST_ERROR
+
+    if ((dset_id2 = H5Dopen2(container_group, DATASET_READ_AHEAD_TEST_DSET_NAME, dapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset\n");
+        goto error;
+    }
+
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Scanning the dataset a block of rows at a time\n");
+#endif
+
+    /* The third read of the scan is widened to read ahead of the scan, so the
+     * reads after it should be served without requests */
+    for (i = 0; i < 5; i++) {
+        start[0] = i * DATASET_READ_AHEAD_TEST_BLOCK_ROWS;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, block_dims, NULL) < 0)
+            TEST_ERROR
+
+        if (H5Dread(dset_id2, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, rbuf) < 0) {
+            H5_FAILED();
+            printf("    couldn't read rows %" PRIuHSIZE " of dataset\n", start[0]);
+            goto error;
+        }
+
+        if (memcmp(rbuf, wbuf[start[0]], sizeof(rbuf))) {
+            H5_FAILED();
+            printf("    data read from rows %" PRIuHSIZE " didn't match data written\n", start[0]);
+            goto error;
+        }
+    }
+
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_NAME,
-                              DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((num_reads = stats.op[H5REST_OP_DATASET_READ].requests) != 3) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    scan of five blocks made %" PRIu64 " read requests instead of 3\n", num_reads);
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Overwriting the next block of rows through another handle\n");
+#endif
 
-    if (NULL == (data = malloc(data_size)))
+    start[0] = 5 * DATASET_READ_AHEAD_TEST_BLOCK_ROWS;
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, block_dims, NULL) < 0)
         TEST_ERROR
 
-    for (i = 0; i < data_size / DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPESIZE; i++)
-        ((int *)data)[i] = (int)i;
+    for (i = 0; i < DATASET_READ_AHEAD_TEST_BLOCK_ROWS; i++)
+        for (j = 0; j < DATASET_READ_AHEAD_TEST_ROW_LEN; j++)
+            wbuf[start[0] + i][j] = -wbuf[start[0] + i][j] - 1;
 
-    for (i = 0; i < DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
-        start[i]  = 0;
-        stride[i] = 1;
-        count[i]  = dims[i];
-        block[i]  = 1;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf[start[0]]) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
     }
 
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
-        TEST_ERROR
+    memset(rbuf, 0, sizeof(rbuf));
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing large amount of data to dataset using a hyperslab selection\n");
-#endif
+    if (H5Dread(dset_id2, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read rows %" PRIuHSIZE " of dataset\n", start[0]);
+        goto error;
+    }
 
-    if (H5Dwrite(dset_id, DATASET_LARGE_WRITE_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 data) < 0) {
+    if (memcmp(rbuf, wbuf[start[0]], sizeof(rbuf))) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    stale data was read after the dataset was written to\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_READ].requests != num_reads + 1) {
+        H5_FAILED();
+        printf("    read of overwritten rows was served from data read ahead\n");
+        goto error;
     }
 
     if (H5Sclose(mspace_id) < 0)
@@ -7688,6 +11560,10 @@ test_write_dataset_large_hyperslab(void)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -7704,11 +11580,11 @@ test_write_dataset_large_hyperslab(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
         H5Sclose(mspace_id);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
+        H5Dclose(dset_id2);
+        H5Pclose(dapl_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -7719,32 +11595,35 @@ error:
     return 1;
 }
 
+/* Test that a batch of reads of a dataset merges nearby hyperslab selections into one
+ * request, while selections far apart and point selections are read on their own */
 static int
-test_write_dataset_large_point_selection(void)
-{
-    TESTING("write to large dataset w/ point selection")
-
-    SKIPPED();
-
-    return 0;
-
-error:
-    return 1;
-}
-#endif
-
-static int
-test_read_dataset_small_all(void)
+test_dataset_read_batch(void)
 {
-    hsize_t dims[DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK] = {10, 5, 3};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   fspace_id       = -1;
-    void   *read_buf        = NULL;
-
-    TESTING("small read from dataset w/ H5S_ALL")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_READ_BATCH_TEST_DIM};
+    hsize_t        block_dims[] = {DATASET_READ_BATCH_TEST_BLOCK_SIZE};
+    hsize_t        point_dims[] = {DATASET_READ_BATCH_TEST_NUM_POINTS};
+    hsize_t        starts[]     = {DATASET_READ_BATCH_TEST_FAR_START, 0, DATASET_READ_BATCH_TEST_NEAR_START};
+    hsize_t        points[]     = {5, DATASET_READ_BATCH_TEST_DIM - 1};
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id         = -1;
+    hid_t          fspace_id       = -1;
+    hid_t          mem_space_ids[DATASET_READ_BATCH_TEST_NUM_SELS];
+    hid_t          file_space_ids[DATASET_READ_BATCH_TEST_NUM_SELS];
+    void          *bufs[DATASET_READ_BATCH_TEST_NUM_SELS];
+    int           *wbuf = NULL;
+    int            rbufs[DATASET_READ_BATCH_TEST_NUM_SELS][DATASET_READ_BATCH_TEST_BLOCK_SIZE];
+
+    TESTING("batched dataset reads")
+
+    for (i = 0; i < DATASET_READ_BATCH_TEST_NUM_SELS; i++) {
+        mem_space_ids[i]  = -1;
+        file_space_ids[i] = -1;
+        bufs[i]           = rbufs[i];
+    }
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7766,40 +11645,94 @@ test_read_dataset_small_all(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_ALL_DSET_NAME,
-                              DATASET_SMALL_READ_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(container_group, DATASET_READ_BATCH_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < DATASET_SMALL_READ_TEST_ALL_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_SMALL_READ_TEST_ALL_DSET_DTYPESIZE;
+    if (NULL == (wbuf = (int *)malloc(DATASET_READ_BATCH_TEST_DIM * sizeof(*wbuf))))
+        TEST_ERROR
 
-    if (NULL == (read_buf = malloc(data_size)))
+    for (i = 0; i < DATASET_READ_BATCH_TEST_DIM; i++)
+        wbuf[i] = (int)i;
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    /* The first selection is far from the others, which are near enough each other to be merged */
+    for (i = 0; i < DATASET_READ_BATCH_TEST_NUM_SELS - 1; i++) {
+        if ((mem_space_ids[i] = H5Screate_simple(1, block_dims, NULL)) < 0)
+            TEST_ERROR
+        if ((file_space_ids[i] = H5Scopy(fspace_id)) < 0)
+            TEST_ERROR
+        if (H5Sselect_hyperslab(file_space_ids[i], H5S_SELECT_SET, &starts[i], NULL, block_dims, NULL) < 0)
+            TEST_ERROR
+    }
+
+    if ((mem_space_ids[i] = H5Screate_simple(1, point_dims, NULL)) < 0)
+        TEST_ERROR
+    if ((file_space_ids[i] = H5Scopy(fspace_id)) < 0)
+        TEST_ERROR
+    if (H5Sselect_elements(file_space_ids[i], H5S_SELECT_SET, DATASET_READ_BATCH_TEST_NUM_POINTS, points) < 0)
+        TEST_ERROR
+
+    if (H5rest_reset_stats() < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Reading entirety of small dataset\n");
+    puts("Reading a batch of selections from the dataset\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
+    if (H5rest_dataset_read_batch(dset_id, DATASET_READ_BATCH_TEST_NUM_SELS, H5T_NATIVE_INT, mem_space_ids,
+                                  file_space_ids, H5P_DEFAULT, bufs) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't read batch of selections from dataset\n");
         goto error;
     }
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+    for (i = 0; i < DATASET_READ_BATCH_TEST_NUM_SELS - 1; i++)
+        for (j = 0; j < DATASET_READ_BATCH_TEST_BLOCK_SIZE; j++)
+            if (rbufs[i][j] != wbuf[starts[i] + j]) {
+                H5_FAILED();
+                printf("    data read for selection %zu didn't match data written\n", i);
+                goto error;
+            }
+
+    for (j = 0; j < DATASET_READ_BATCH_TEST_NUM_POINTS; j++)
+        if (rbufs[i][j] != wbuf[points[j]]) {
+            H5_FAILED();
+            printf("    data read for point selection didn't match data written\n");
+            goto error;
+        }
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_READ].requests != 3) {
+        H5_FAILED();
+        printf("    batch of %d selections was read with %" PRIu64 " requests instead of 3\n",
+               DATASET_READ_BATCH_TEST_NUM_SELS, stats.op[H5REST_OP_DATASET_READ].requests);
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_READ_BATCH_TEST_NUM_SELS; i++) {
+        if (H5Sclose(mem_space_ids[i]) < 0)
+            TEST_ERROR
+        if (H5Sclose(file_space_ids[i]) < 0)
+            TEST_ERROR
     }
 
+    free(wbuf);
+    wbuf = NULL;
+
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
@@ -7820,8 +11753,11 @@ test_read_dataset_small_all(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (read_buf)
-            free(read_buf);
+        for (i = 0; i < DATASET_READ_BATCH_TEST_NUM_SELS; i++) {
+            H5Sclose(mem_space_ids[i]);
+            H5Sclose(file_space_ids[i]);
+        }
+        free(wbuf);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
         H5Gclose(container_group);
@@ -7834,22 +11770,38 @@ error:
     return 1;
 }
 
+/* Test that several selections of a dataset can be written and read back, each
+ * with a request of its own, made concurrently */
 static int
-test_read_dataset_small_hyperslab(void)
+test_dataset_selections(void)
 {
-    hsize_t start[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t stride[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t count[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t block[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK] = {10, 5, 3};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   mspace_id = -1, fspace_id = -1;
-    void   *read_buf = NULL;
-
-    TESTING("small read from dataset w/ hyperslab")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_SELECTIONS_TEST_DIM, DATASET_SELECTIONS_TEST_DIM};
+    hsize_t        block_dims[] = {DATASET_SELECTIONS_TEST_DIM / 2, DATASET_SELECTIONS_TEST_DIM / 2};
+    hsize_t        start[2];
+    size_t         i, j, k;
+    hid_t          file_id = -1, fapl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id         = -1;
+    hid_t          fspace_id       = -1;
+    hid_t          mem_space_ids[DATASET_SELECTIONS_TEST_NUM_SELS];
+    hid_t          file_space_ids[DATASET_SELECTIONS_TEST_NUM_SELS];
+    const void    *wbufs[DATASET_SELECTIONS_TEST_NUM_SELS];
+    void          *rbufs[DATASET_SELECTIONS_TEST_NUM_SELS];
+    int            wdata[DATASET_SELECTIONS_TEST_NUM_SELS][DATASET_SELECTIONS_TEST_DIM / 2]
+                        [DATASET_SELECTIONS_TEST_DIM / 2];
+    int            rdata[DATASET_SELECTIONS_TEST_NUM_SELS][DATASET_SELECTIONS_TEST_DIM / 2]
+                        [DATASET_SELECTIONS_TEST_DIM / 2];
+    int            full[DATASET_SELECTIONS_TEST_DIM][DATASET_SELECTIONS_TEST_DIM];
+
+    TESTING("concurrent writes and reads of dataset selections")
+
+    for (i = 0; i < DATASET_SELECTIONS_TEST_NUM_SELS; i++) {
+        mem_space_ids[i]  = -1;
+        file_space_ids[i] = -1;
+        wbufs[i]          = wdata[i];
+        rbufs[i]          = rdata[i];
+    }
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7871,56 +11823,110 @@ test_read_dataset_small_hyperslab(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-    if ((mspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK - 1, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_NAME,
-                              DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(container_group, DATASET_SELECTIONS_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
-        start[i]  = 0;
-        stride[i] = 1;
-        count[i]  = dims[i];
-        block[i]  = 1;
-    }
+    /* Select each quadrant of the dataset */
+    for (i = 0; i < DATASET_SELECTIONS_TEST_NUM_SELS; i++) {
+        start[0] = (i / 2) * block_dims[0];
+        start[1] = (i % 2) * block_dims[1];
 
-    count[2] = 1;
+        if ((mem_space_ids[i] = H5Screate_simple(2, block_dims, NULL)) < 0)
+            TEST_ERROR
+        if ((file_space_ids[i] = H5Scopy(fspace_id)) < 0)
+            TEST_ERROR
+        if (H5Sselect_hyperslab(file_space_ids[i], H5S_SELECT_SET, start, NULL, block_dims, NULL) < 0)
+            TEST_ERROR
 
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        for (j = 0; j < block_dims[0]; j++)
+            for (k = 0; k < block_dims[1]; k++)
+                wdata[i][j][k] = (int)((start[0] + j) * DATASET_SELECTIONS_TEST_DIM + start[1] + k);
+    }
+
+    if (H5rest_reset_stats() < 0)
         TEST_ERROR
 
-    for (i = 0, data_size = 1; i < DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_SPACE_RANK - 1; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPESIZE;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing selections of the dataset\n");
+#endif
 
-    if (NULL == (read_buf = malloc(data_size)))
+    if (H5rest_dataset_write_selections(dset_id, DATASET_SELECTIONS_TEST_NUM_SELS, H5T_NATIVE_INT,
+                                        mem_space_ids, file_space_ids, H5P_DEFAULT, wbufs) < 0) {
+        H5_FAILED();
+        printf("    couldn't write selections of dataset\n");
+        goto error;
+    }
+
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != DATASET_SELECTIONS_TEST_NUM_SELS) {
+        H5_FAILED();
+        printf("    %d selections were written with %" PRIu64 " requests\n", DATASET_SELECTIONS_TEST_NUM_SELS,
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
+        goto error;
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, full) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_SELECTIONS_TEST_DIM; i++)
+        for (j = 0; j < DATASET_SELECTIONS_TEST_DIM; j++)
+            if (full[i][j] != (int)(i * DATASET_SELECTIONS_TEST_DIM + j)) {
+                H5_FAILED();
+                printf("    selections weren't written to the right parts of the dataset\n");
+                goto error;
+            }
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Reading portion of small dataset using hyperslab selection\n");
+    puts("Reading selections of the dataset\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+
+    memset(rdata, 0, sizeof(rdata));
+
+    if (H5rest_dataset_read_selections(dset_id, DATASET_SELECTIONS_TEST_NUM_SELS, H5T_NATIVE_INT,
+                                       mem_space_ids, file_space_ids, H5P_DEFAULT, rbufs) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't read selections of dataset\n");
         goto error;
     }
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+    if (memcmp(wdata, rdata, sizeof(wdata))) {
+        H5_FAILED();
+        printf("    data read from selections didn't match data written\n");
+        goto error;
     }
 
-    if (H5Sclose(mspace_id) < 0)
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_READ].requests != DATASET_SELECTIONS_TEST_NUM_SELS) {
+        H5_FAILED();
+        printf("    %d selections were read with %" PRIu64 " requests\n", DATASET_SELECTIONS_TEST_NUM_SELS,
+               stats.op[H5REST_OP_DATASET_READ].requests);
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_SELECTIONS_TEST_NUM_SELS; i++) {
+        if (H5Sclose(mem_space_ids[i]) < 0)
+            TEST_ERROR
+        if (H5Sclose(file_space_ids[i]) < 0)
+            TEST_ERROR
+    }
+
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
@@ -7941,9 +11947,10 @@ test_read_dataset_small_hyperslab(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (read_buf)
-            free(read_buf);
-        H5Sclose(mspace_id);
+        for (i = 0; i < DATASET_SELECTIONS_TEST_NUM_SELS; i++) {
+            H5Sclose(mem_space_ids[i]);
+            H5Sclose(file_space_ids[i]);
+        }
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
         H5Gclose(container_group);
@@ -7956,22 +11963,41 @@ error:
     return 1;
 }
 
+/* Test that the chunks of a dataset, including those at the edge of its extent,
+ * can be written and read back as the bytes they are stored as */
 static int
-test_read_dataset_small_point_selection(void)
+test_dataset_chunks(void)
 {
-    hsize_t points[DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS *
-                   DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {10, 10, 10};
-    hsize_t mspace_dims[] = {DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   fspace_id       = -1;
-    hid_t   mspace_id       = -1;
-    void   *data            = NULL;
-
-    TESTING("small read from dataset w/ point selection")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_CHUNKS_TEST_DIM0, DATASET_CHUNKS_TEST_DIM1};
+    hsize_t        chunk_dims[] = {DATASET_CHUNKS_TEST_CHUNK_DIM, DATASET_CHUNKS_TEST_CHUNK_DIM};
+    hsize_t        offsets[DATASET_CHUNKS_TEST_NUM_CHUNKS][2];
+    const hsize_t *offset_ptrs[DATASET_CHUNKS_TEST_NUM_CHUNKS];
+    uint32_t       filter_masks[DATASET_CHUNKS_TEST_NUM_CHUNKS];
+    size_t         sizes[DATASET_CHUNKS_TEST_NUM_CHUNKS];
+    const void    *wbufs[DATASET_CHUNKS_TEST_NUM_CHUNKS];
+    void          *rbufs[DATASET_CHUNKS_TEST_NUM_CHUNKS];
+    size_t         i, j, k;
+    hid_t          file_id = -1, fapl_id = -1, dcpl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id         = -1;
+    hid_t          fspace_id       = -1;
+    int            wchunks[DATASET_CHUNKS_TEST_NUM_CHUNKS][DATASET_CHUNKS_TEST_CHUNK_DIM]
+                          [DATASET_CHUNKS_TEST_CHUNK_DIM];
+    int            rchunks[DATASET_CHUNKS_TEST_NUM_CHUNKS][DATASET_CHUNKS_TEST_CHUNK_DIM]
+                          [DATASET_CHUNKS_TEST_CHUNK_DIM];
+    int            rbuf[DATASET_CHUNKS_TEST_DIM0][DATASET_CHUNKS_TEST_DIM1];
+    const char    *endpoint = getenv("HSDS_ENDPOINT");
+    uint64_t       flags    = 0;
+
+    TESTING("dataset chunk transfers")
+
+    /* Chunks can only be transferred directly through the local store */
+    if (!endpoint ||
+        strncmp(endpoint, DATASET_CHUNKS_TEST_LOCAL_PREFIX, strlen(DATASET_CHUNKS_TEST_LOCAL_PREFIX))) {
+        SKIPPED();
+        return 0;
+    }
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -7993,62 +12019,131 @@ test_read_dataset_small_point_selection(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
-        0)
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         TEST_ERROR
-    if ((mspace_id = H5Screate_simple(1, mspace_dims, NULL)) < 0)
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_NAME,
-                              DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_CHUNKS_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    if (H5VLquery_optional(dset_id, H5VL_SUBCLS_DATASET, H5VL_NATIVE_DATASET_CHUNK_WRITE, &flags) < 0)
+        TEST_ERROR
+
+    if (!(flags & H5VL_OPT_QUERY_SUPPORTED)) {
+        H5_FAILED();
+        printf("    direct chunk writes weren't reported as supported by the local store\n");
+        goto error;
+    }
+
+    /* The chunks in the second column of chunks are only partly within the dataset */
+    for (i = 0; i < DATASET_CHUNKS_TEST_NUM_CHUNKS; i++) {
+        offsets[i][0]   = (i / 2) * DATASET_CHUNKS_TEST_CHUNK_DIM;
+        offsets[i][1]   = (i % 2) * DATASET_CHUNKS_TEST_CHUNK_DIM;
+        offset_ptrs[i]  = offsets[i];
+        filter_masks[i] = 0;
+        sizes[i]        = sizeof(wchunks[i]);
+        wbufs[i]        = wchunks[i];
+        rbufs[i]        = rchunks[i];
+
+        /* The part of a chunk outside the dataset is left as zeros, as it is read back */
+        memset(wchunks[i], 0, sizeof(wchunks[i]));
+
+        for (j = 0; j < DATASET_CHUNKS_TEST_CHUNK_DIM; j++)
+            for (k = 0; k < DATASET_CHUNKS_TEST_CHUNK_DIM && offsets[i][1] + k < DATASET_CHUNKS_TEST_DIM1;
+                 k++)
+                wchunks[i][j][k] = (int)((offsets[i][0] + j) * DATASET_CHUNKS_TEST_DIM1 + offsets[i][1] + k);
+    }
+
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing the dataset's chunks\n");
+#endif
+
+    if (H5rest_dataset_write_chunks(dset_id, DATASET_CHUNKS_TEST_NUM_CHUNKS, offset_ptrs, filter_masks, sizes,
+                                    wbufs) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't write chunks of dataset\n");
         goto error;
     }
 
-    data_size = DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS *
-                DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPESIZE;
-
-    if (NULL == (data = malloc(data_size)))
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
-    for (i = 0; i < DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS; i++) {
-        size_t j;
-
-        for (j = 0; j < DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK; j++)
-            points[(i * DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + j] = i;
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != DATASET_CHUNKS_TEST_NUM_CHUNKS) {
+        H5_FAILED();
+        printf("    %d chunks were written with %" PRIu64 " requests\n", DATASET_CHUNKS_TEST_NUM_CHUNKS,
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
+        goto error;
     }
 
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_SMALL_READ_TEST_POINT_SELECTION_NUM_POINTS,
-                           points) < 0) {
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't select points\n");
+        printf("    couldn't read from dataset\n");
         goto error;
     }
 
+    for (i = 0; i < DATASET_CHUNKS_TEST_DIM0; i++)
+        for (j = 0; j < DATASET_CHUNKS_TEST_DIM1; j++)
+            if (rbuf[i][j] != (int)(i * DATASET_CHUNKS_TEST_DIM1 + j)) {
+                H5_FAILED();
+                printf("    chunks weren't written to the right parts of the dataset\n");
+                goto error;
+            }
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Reading portion of small dataset using a point selection\n");
+    puts("Reading the dataset's chunks\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_SMALL_READ_TEST_POINT_SELECTION_DSET_DTYPE, mspace_id, fspace_id,
-                H5P_DEFAULT, data) < 0) {
+    memset(rchunks, 0xff, sizeof(rchunks));
+
+    for (i = 0; i < DATASET_CHUNKS_TEST_NUM_CHUNKS; i++) {
+        filter_masks[i] = UINT32_MAX;
+        sizes[i]        = sizeof(rchunks[i]);
+    }
+
+    if (H5rest_dataset_read_chunks(dset_id, DATASET_CHUNKS_TEST_NUM_CHUNKS, offset_ptrs, filter_masks, sizes,
+                                   rbufs) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't read chunks of dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    for (i = 0; i < DATASET_CHUNKS_TEST_NUM_CHUNKS; i++) {
+        if (sizes[i] != sizeof(rchunks[i])) {
+            H5_FAILED();
+            printf("    chunk %zu was %zu bytes instead of %zu\n", i, sizes[i], sizeof(rchunks[i]));
+            goto error;
+        }
+
+        if (filter_masks[i] != 0) {
+            H5_FAILED();
+            printf("    filter mask of chunk %zu was %" PRIu32 " instead of 0\n", i, filter_masks[i]);
+            goto error;
+        }
+    }
+
+    if (memcmp(wchunks, rchunks, sizeof(wchunks))) {
+        H5_FAILED();
+        printf("    chunks read didn't match chunks written\n");
+        goto error;
     }
 
-    if (H5Sclose(mspace_id) < 0)
-        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -8065,11 +12160,9 @@ test_read_dataset_small_point_selection(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
-        H5Sclose(mspace_id);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -8080,19 +12173,33 @@ error:
     return 1;
 }
 
-#ifndef NO_LARGE_TESTS
+/* Test that the rows of a compound dataset which match a query can be read a page
+ * at a time, converted to a memory type which may only have some of the members */
 static int
-test_read_dataset_large_all(void)
+test_dataset_query(void)
 {
-    hsize_t dims[DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK] = {600, 600, 600};
-    size_t  i, data_size;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   fspace_id       = -1;
-    void   *read_buf        = NULL;
+    typedef struct {
+        int    id;
+        double temp;
+    } query_row_t;
+
+    query_row_t wbuf[DATASET_QUERY_TEST_NUM_ROWS];
+    query_row_t rbuf[DATASET_QUERY_TEST_PAGE_SIZE];
+    hsize_t     dims[] = {DATASET_QUERY_TEST_NUM_ROWS};
+    hsize_t     indices[DATASET_QUERY_TEST_PAGE_SIZE];
+    hsize_t     start      = 0;
+    hsize_t     next_index = 5;
+    size_t      num_rows   = 0;
+    size_t      total_rows = 0;
+    size_t      i;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1;
+    hid_t       dset_id         = -1;
+    hid_t       fspace_id       = -1;
+    hid_t       file_type_id = -1, mem_type_id = -1, id_type_id = -1;
+    int         ids[DATASET_QUERY_TEST_PAGE_SIZE];
 
-    TESTING("read from large dataset w/ H5S_ALL")
+    TESTING("dataset queries")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -8114,40 +12221,111 @@ test_read_dataset_large_all(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK, dims, NULL)) < 0)
+    /* The dataset's type is packed, as the server stores it */
+    if ((file_type_id = H5Tcreate(H5T_COMPOUND, 4 + 8)) < 0)
+        TEST_ERROR
+    if (H5Tinsert(file_type_id, "id", 0, H5T_STD_I32LE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(file_type_id, "temp", 4, H5T_IEEE_F64LE) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_ALL_DSET_NAME,
-                              DATASET_LARGE_READ_TEST_ALL_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
+    if ((mem_type_id = H5Tcreate(H5T_COMPOUND, sizeof(query_row_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(mem_type_id, "id", HOFFSET(query_row_t, id), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(mem_type_id, "temp", HOFFSET(query_row_t, temp), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+
+    if ((id_type_id = H5Tcreate(H5T_COMPOUND, sizeof(int))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(id_type_id, "id", 0, H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_QUERY_TEST_DSET_NAME, file_type_id, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    for (i = 0, data_size = 1; i < DATASET_LARGE_READ_TEST_ALL_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_LARGE_READ_TEST_ALL_DSET_DTYPESIZE;
+    for (i = 0; i < DATASET_QUERY_TEST_NUM_ROWS; i++) {
+        wbuf[i].id   = (int)i;
+        wbuf[i].temp = (double)i * 1.5;
+    }
 
-    if (NULL == (read_buf = malloc(data_size)))
-        TEST_ERROR
+    if (H5Dwrite(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Reading entirety of large dataset\n");
+    puts("Querying the dataset a page at a time\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_ALL_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
+    /* Rows 5 through 14 match the query */
+    do {
+        if (H5rest_dataset_query(dset_id, DATASET_QUERY_TEST_QUERY, start, DATASET_QUERY_TEST_PAGE_SIZE,
+                                 mem_type_id, &num_rows, indices, rbuf) < 0) {
+            H5_FAILED();
+            printf("    couldn't query dataset from row %" PRIuHSIZE "\n", start);
+            goto error;
+        }
+
+        for (i = 0; i < num_rows; i++, next_index++) {
+            if (indices[i] != next_index) {
+                H5_FAILED();
+                printf("    query matched row %" PRIuHSIZE " instead of row %" PRIuHSIZE "\n", indices[i],
+                       next_index);
+                goto error;
+            }
+
+            if (rbuf[i].id != wbuf[indices[i]].id || rbuf[i].temp != wbuf[indices[i]].temp) {
+                H5_FAILED();
+                printf("    row %" PRIuHSIZE " returned by query didn't match data written\n", indices[i]);
+                goto error;
+            }
+        }
+
+        total_rows += num_rows;
+        if (num_rows)
+            start = indices[num_rows - 1] + 1;
+    } while (num_rows == DATASET_QUERY_TEST_PAGE_SIZE);
+
+    if (total_rows != 10) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    query matched %zu rows instead of 10\n", total_rows);
         goto error;
     }
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Querying the dataset into a subset of its members\n");
+#endif
+
+    memset(ids, 0, sizeof(ids));
+
+    if (H5rest_dataset_query(dset_id, DATASET_QUERY_TEST_QUERY2, 0, DATASET_QUERY_TEST_PAGE_SIZE, id_type_id,
+                             &num_rows, NULL, ids) < 0) {
+        H5_FAILED();
+        printf("    couldn't query dataset\n");
+        goto error;
+    }
+
+    if (num_rows != 2 || ids[0] != 3 || ids[1] != 17) {
+        H5_FAILED();
+        printf("    query into subset of members returned the wrong rows\n");
+        goto error;
     }
 
+    if (H5Tclose(id_type_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(mem_type_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(file_type_id) < 0)
+        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
@@ -8168,8 +12346,9 @@ test_read_dataset_large_all(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (read_buf)
-            free(read_buf);
+        H5Tclose(id_type_id);
+        H5Tclose(mem_type_id);
+        H5Tclose(file_type_id);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
         H5Gclose(container_group);
@@ -8182,22 +12361,27 @@ error:
     return 1;
 }
 
+/*
+ * A test to check that a write to a dataset with a point selection, whose
+ * packed coordinates and values are the same size as the whole dataset,
+ * only writes the selected points.
+ */
 static int
-test_read_dataset_large_hyperslab(void)
+test_write_dataset_point_selection_size_collision(void)
 {
-    hsize_t start[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t stride[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t count[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t block[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK];
-    hsize_t dims[DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK] = {600, 600, 600};
-    size_t  i, data_size;
+    hsize_t dims[1]   = {DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DIM};
+    hsize_t mdims[1]  = {DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_NUM_POINTS};
+    hsize_t points[1] = {0};
+    int64_t data[DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DIM];
+    int64_t point_data[DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_NUM_POINTS];
+    size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
     hid_t   dset_id         = -1;
-    hid_t   mspace_id = -1, fspace_id = -1;
-    void   *read_buf = NULL;
+    hid_t   fspace_id       = -1;
+    hid_t   mspace_id       = -1;
 
-    TESTING("read from large dataset w/ hyperslab selection")
+    TESTING("write to dataset w/ point selection the same size as the dataset")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -8219,50 +12403,73 @@ test_read_dataset_large_hyperslab(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-    if ((mspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_NAME,
-                              DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPE, fspace_id, H5P_DEFAULT,
+    if ((dset_id = H5Dcreate2(container_group, DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_NAME,
+                              DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DTYPE, fspace_id, H5P_DEFAULT,
                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++) {
-        start[i]  = 0;
-        stride[i] = 1;
-        count[i]  = dims[i];
-        block[i]  = 1;
+    for (i = 0; i < DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DIM; i++)
+        data[i] = (int64_t)i;
+
+    if (H5Dwrite(dset_id, DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                 H5P_DEFAULT, data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
     }
 
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    /* Select every other element, so that the coordinates and values of the
+     * points take up as many bytes as the values of the whole dataset */
+    if (H5Sselect_none(fspace_id) < 0)
         TEST_ERROR
+    for (i = 0; i < DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_NUM_POINTS; i++) {
+        points[0]     = 2 * i + 1;
+        point_data[i] = -(int64_t)points[0];
 
-    for (i = 0, data_size = 1; i < DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPESIZE;
+        if (H5Sselect_elements(fspace_id, H5S_SELECT_APPEND, 1, points) < 0) {
+            H5_FAILED();
+            printf("    couldn't select points\n");
+            goto error;
+        }
+    }
 
-    if (NULL == (read_buf = malloc(data_size)))
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
         TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Reading portion of large dataset using hyperslab selection\n");
+    puts("Writing to dataset using a point selection the same size as the dataset\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_HYPERSLAB_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dwrite(dset_id, DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                 H5P_DEFAULT, point_data) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    memset(data, 0, sizeof(data));
+
+    if (H5Dread(dset_id, DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                H5P_DEFAULT, data) < 0) {
         H5_FAILED();
         printf("    couldn't read from dataset\n");
         goto error;
     }
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+    for (i = 0; i < DATASET_WRITE_POINT_SEL_SIZE_COLLISION_TEST_DSET_DIM; i++) {
+        int64_t expected = (i % 2) ? -(int64_t)i : (int64_t)i;
+
+        if (data[i] != expected) {
+            H5_FAILED();
+            printf("    element %zu was %lld instead of %lld\n", i, (long long)data[i], (long long)expected);
+            goto error;
+        }
     }
 
     if (H5Sclose(mspace_id) < 0)
@@ -8300,18 +12507,39 @@ error:
     return 1;
 }
 
+/* Test that a chunk of a filtered dataset written with its filters applied is
+ * read back as the bytes written, with its filter mask, and that writing a
+ * chunk with every filter skipped stores it as part of the dataset's values */
 static int
-test_read_dataset_large_point_selection(void)
+test_dataset_filtered_chunks(void)
 {
-    hsize_t *points                                                        = NULL;
-    hsize_t  dims[DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK] = {600, 600, 600};
-    hid_t    file_id = -1, fapl_id = -1;
-    hid_t    container_group = -1;
-    hid_t    dset_id         = -1;
-    hid_t    fspace_id       = -1;
-    void    *data            = NULL;
-
-    TESTING("read from large dataset w/ point selection")
+    hsize_t        dims[]       = {DATASET_FILTERED_CHUNKS_TEST_DIM};
+    hsize_t        chunk_dims[] = {DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM};
+    hsize_t        offsets[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS][1];
+    const hsize_t *offset_ptrs[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS];
+    uint32_t       filter_masks[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS];
+    size_t         sizes[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS];
+    void          *rbufs[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS];
+    const char    *endpoint = getenv("HSDS_ENDPOINT");
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1, dcpl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id         = -1;
+    hid_t          fspace_id       = -1;
+    unsigned char  filtered[DATASET_FILTERED_CHUNKS_TEST_FILTER_SIZE] = {0x78, 0x9c, 0x63, 0x60,
+                                                                         0x00, 0x02, 0x00};
+    int            wchunk[DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM];
+    int            rchunks[DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS][DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM];
+    int            rbuf[DATASET_FILTERED_CHUNKS_TEST_DIM];
+
+    TESTING("filtered dataset chunk transfers")
+
+    /* Chunks can only be transferred directly through the local store */
+    if (!endpoint ||
+        strncmp(endpoint, DATASET_CHUNKS_TEST_LOCAL_PREFIX, strlen(DATASET_CHUNKS_TEST_LOCAL_PREFIX))) {
+        SKIPPED();
+        return 0;
+    }
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -8333,68 +12561,107 @@ test_read_dataset_large_point_selection(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK, dims, NULL)) <
-        0)
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+    if (H5Pset_deflate(dcpl_id, 6) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_NAME,
-                              DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPE, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_FILTERED_CHUNKS_TEST_DSET_NAME, H5T_NATIVE_INT,
+                              fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    size_t num_elems = 1;
+    for (i = 0; i < DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS; i++) {
+        offsets[i][0]  = i * DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM;
+        offset_ptrs[i] = offsets[i];
+        rbufs[i]       = rchunks[i];
+    }
 
-    for (size_t i = 0; i < DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK; i++)
-        num_elems *= dims[i];
+    for (j = 0; j < DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM; j++)
+        wchunk[j] = (int)(DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM + j);
 
-    if (NULL == (data = calloc(num_elems, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPESIZE)))
-        TEST_ERROR
-    if (NULL == (points = calloc(3 * num_elems, sizeof(hsize_t))))
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing a chunk with the deflate filter applied and a chunk with it skipped\n");
+#endif
 
-    /* Select the entire dataspace */
-    for (size_t i = 0; i < num_elems; i += 3) {
-        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK)] =
-            (i % (dims[0] * dims[1])) % dims[1];
-        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + 1] =
-            (i % (dims[0] * dims[1])) / dims[0];
-        points[(i * DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_SPACE_RANK) + 2] = (i / (dims[0] * dims[1]));
+    /* The first chunk's bytes are only meaningful to the filter, and are smaller than the chunk */
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offsets[0], sizeof(filtered), filtered) < 0) {
+        H5_FAILED();
+        printf("    couldn't write filtered chunk\n");
+        goto error;
     }
 
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, num_elems, points) < 0) {
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 1, offsets[1], sizeof(wchunk), wchunk) < 0) {
         H5_FAILED();
-        printf("    couldn't select points\n");
+        printf("    couldn't write unfiltered chunk\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Reading portion of large dataset using a point selection\n");
-#endif
+    memset(rchunks, 0, sizeof(rchunks));
 
-    if (H5Dread(dset_id, DATASET_LARGE_READ_TEST_POINT_SELECTION_DSET_DTYPE, H5S_ALL, fspace_id, H5P_DEFAULT,
-                data) < 0) {
+    for (i = 0; i < DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS; i++) {
+        filter_masks[i] = UINT32_MAX;
+        sizes[i]        = sizeof(rchunks[i]);
+    }
+
+    if (H5rest_dataset_read_chunks(dset_id, DATASET_FILTERED_CHUNKS_TEST_NUM_CHUNKS, offset_ptrs,
+                                   filter_masks, sizes, rbufs) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't read chunks of dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
+    if (sizes[0] != sizeof(filtered) || filter_masks[0] != 0 ||
+        memcmp(rchunks[0], filtered, sizeof(filtered))) {
+        H5_FAILED();
+        printf("    filtered chunk was read back as %zu bytes with filter mask %" PRIu32 "\n", sizes[0],
+               filter_masks[0]);
+        goto error;
     }
 
-    if (points) {
-        free(points);
-        points = NULL;
+    if (sizes[1] != sizeof(wchunk) || filter_masks[1] != 1 || memcmp(rchunks[1], wchunk, sizeof(wchunk))) {
+        H5_FAILED();
+        printf("    unfiltered chunk was read back as %zu bytes with filter mask %" PRIu32 "\n", sizes[1],
+               filter_masks[1]);
+        goto error;
+    }
+
+    /* Replacing the filtered chunk with an unfiltered one makes the dataset readable as values */
+    for (j = 0; j < DATASET_FILTERED_CHUNKS_TEST_CHUNK_DIM; j++)
+        wchunk[j] = (int)j;
+
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 1, offsets[0], sizeof(wchunk), wchunk) < 0) {
+        H5_FAILED();
+        printf("    couldn't overwrite filtered chunk\n");
+        goto error;
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
     }
 
+    for (i = 0; i < DATASET_FILTERED_CHUNKS_TEST_DIM; i++)
+        if (rbuf[i] != (int)i) {
+            H5_FAILED();
+            printf("    element %zu was %d instead of %d\n", i, rbuf[i], (int)i);
+            goto error;
+        }
+
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -8411,12 +12678,9 @@ test_read_dataset_large_point_selection(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
-        if (points)
-            free(points);
         H5Sclose(fspace_id);
         H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -8426,31 +12690,27 @@ error:
 
     return 1;
 }
-#endif
 
+/* Test that H5Drefresh sends appends still held in a dataset's write-back buffer, and
+ * that another handle to the dataset, which shares its extent, still sees the extent
+ * they grew it to once it is refreshed from the server */
 static int
-test_write_dataset_data_verification(void)
+test_dataset_refresh(void)
 {
-    hssize_t space_npoints;
-    hsize_t  dims[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK] = {10, 10, 10};
-    hsize_t  mdims[2];
-    hsize_t  start[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
-    hsize_t  stride[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
-    hsize_t  count[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
-    hsize_t  block[DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
-    hsize_t
-           points[DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS * DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK];
-    size_t i, data_size;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1;
-    hid_t  dset_id         = -1;
-    hid_t  fspace_id       = -1;
-    hid_t  mspace_id       = -1;
-    void  *data            = NULL;
-    void  *write_buf       = NULL;
-    void  *read_buf        = NULL;
-
-    TESTING("verification of dataset data after write then read")
+    H5rest_stats_t stats;
+    hsize_t        dims[]       = {DATASET_REFRESH_TEST_INITIAL_ROWS, DATASET_REFRESH_TEST_ROW_LEN};
+    hsize_t        max_dims[]   = {H5S_UNLIMITED, DATASET_REFRESH_TEST_ROW_LEN};
+    hsize_t        chunk_dims[] = {DATASET_REFRESH_TEST_CHUNK_ROWS, DATASET_REFRESH_TEST_ROW_LEN};
+    hsize_t        space_dims[2];
+    size_t         i, j;
+    hid_t          file_id = -1, fapl_id = -1, dapl_id = -1, dcpl_id = -1;
+    hid_t          container_group = -1;
+    hid_t          dset_id = -1, dset_id2 = -1;
+    hid_t          fspace_id = -1;
+    int            wbuf[DATASET_REFRESH_TEST_TOTAL_ROWS][DATASET_REFRESH_TEST_ROW_LEN];
+    int            rbuf[DATASET_REFRESH_TEST_TOTAL_ROWS][DATASET_REFRESH_TEST_ROW_LEN];
+
+    TESTING("dataset refresh")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -8472,598 +12732,728 @@ test_write_dataset_data_verification(void)
         goto error;
     }
 
-    if ((fspace_id = H5Screate_simple(DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                              DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, fspace_id, H5P_DEFAULT, H5P_DEFAULT,
-                              H5P_DEFAULT)) < 0) {
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_dapl_rest_write_buffer(dapl_id, DATASET_REFRESH_TEST_BUFFER_SIZE) < 0)
+        TEST_ERROR
+
+    if ((fspace_id = H5Screate_simple(2, dims, max_dims)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_REFRESH_TEST_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, dcpl_id, dapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset using H5S_ALL\n");
-#endif
-
-    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (data = malloc(data_size)))
-        TEST_ERROR
-
-    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
-        ((int *)data)[i] = (int)i;
+    for (i = 0; i < DATASET_REFRESH_TEST_TOTAL_ROWS; i++)
+        for (j = 0; j < DATASET_REFRESH_TEST_ROW_LEN; j++)
+            wbuf[i][j] = (int)(i * DATASET_REFRESH_TEST_ROW_LEN + j);
 
-    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
         H5_FAILED();
         printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
-
-    if (H5Sclose(fspace_id) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Dflush(dset_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    /* A second handle opened in this process shares the first handle's extent */
+    if ((dset_id2 = H5Dopen2(container_group, DATASET_REFRESH_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open dataset\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if (H5rest_reset_stats() < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Appending rows to the dataset and refreshing it\n");
+#endif
+
+    for (i = 0; i < DATASET_REFRESH_TEST_NUM_APPENDS; i++) {
+        size_t row = DATASET_REFRESH_TEST_INITIAL_ROWS + i * DATASET_REFRESH_TEST_APPEND_ROWS;
+
+        if (H5rest_dataset_append(dset_id, H5P_DEFAULT, 0, DATASET_REFRESH_TEST_APPEND_ROWS, H5T_NATIVE_INT,
+                                  wbuf[row]) < 0) {
+            H5_FAILED();
+            printf("    couldn't append rows %zu to dataset\n", row);
+            goto error;
+        }
+    }
+
+    if (H5rest_get_stats(&stats) < 0)
+        TEST_ERROR
+
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    appends were sent instead of being buffered\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if (H5Drefresh(dset_id) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    couldn't refresh dataset\n");
         goto error;
     }
 
-    if (NULL == (data = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+    if (H5rest_get_stats(&stats) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the data that comes back is correct after writing to entire dataset\n");
-#endif
-
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
+    if (stats.op[H5REST_OP_DATASET_WRITE].requests != 1) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    refresh sent buffered appends in %" PRIu64 " writes instead of one\n",
+               stats.op[H5REST_OP_DATASET_WRITE].requests);
         goto error;
     }
 
-    for (i = 0; i < (hsize_t)space_npoints; i++)
-        if (((int *)data)[i] != (int)i) {
-            H5_FAILED();
-            printf("    ALL selection data verification failed\n");
-            goto error;
-        }
+    /* Refreshing the appending handle must keep the extent its appends grew the dataset to */
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if ((fspace_id = H5Dget_space(dset_id)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(fspace_id, space_dims, NULL) < 0)
+        TEST_ERROR
 
-    if (data) {
-        free(data);
-        data = NULL;
+    if (space_dims[0] != DATASET_REFRESH_TEST_TOTAL_ROWS) {
+        H5_FAILED();
+        printf("    dataset has %" PRIuHSIZE " rows after refresh instead of %d\n", space_dims[0],
+               DATASET_REFRESH_TEST_TOTAL_ROWS);
+        goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset using hyperslab selection - contiguous\n");
+    puts("Checking that the other handle sees the new extent before and after a refresh\n");
 #endif
 
-    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (write_buf = malloc(data_size)))
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if ((fspace_id = H5Dget_space(dset_id2)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(fspace_id, space_dims, NULL) < 0)
         TEST_ERROR
 
-    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
-        ((int *)write_buf)[i] = 56;
+    if (space_dims[0] != DATASET_REFRESH_TEST_TOTAL_ROWS) {
+        H5_FAILED();
+        printf("    other handle has %" PRIuHSIZE " rows before refresh instead of %d\n", space_dims[0],
+               DATASET_REFRESH_TEST_TOTAL_ROWS);
+        goto error;
+    }
 
-    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+    if (H5Drefresh(dset_id2) < 0) {
+        H5_FAILED();
+        printf("    couldn't refresh other handle to dataset\n");
+        goto error;
+    }
 
-    if (NULL == (data = malloc(data_size)))
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR
+    if ((fspace_id = H5Dget_space(dset_id2)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(fspace_id, space_dims, NULL) < 0)
         TEST_ERROR
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
+    if (space_dims[0] != DATASET_REFRESH_TEST_TOTAL_ROWS) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    other handle has %" PRIuHSIZE " rows after refresh instead of %d\n", space_dims[0],
+               DATASET_REFRESH_TEST_TOTAL_ROWS);
         goto error;
     }
 
-    for (i = 0; i < 2; i++) {
-        size_t j;
+    memset(rbuf, 0, sizeof(rbuf));
 
-        for (j = 0; j < dims[1]; j++)
-            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 56;
+    if (H5Dread(dset_id2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
     }
 
-    /* Write to first two rows of dataset */
-    mdims[0]  = dims[1] * 2;
-    start[0]  = 0;
-    stride[0] = 1;
-    count[0]  = dims[1] * 2;
-    block[0]  = 1;
-    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+    if (memcmp(wbuf, rbuf, sizeof(wbuf))) {
+        H5_FAILED();
+        printf("    data read through other handle didn't match appended data\n");
+        goto error;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-
-    start[0] = start[1] = start[2] = 0;
-    stride[0] = stride[1] = stride[2] = 1;
-    count[0]                          = 2;
-    count[1]                          = dims[1];
-    count[2]                          = 1;
-    block[0] = block[1] = block[2] = 1;
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 write_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to dataset\n");
-        goto error;
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Dclose(dset_id2);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    if (H5Sclose(mspace_id) < 0)
+    return 1;
+}
+
+/* Test reads which convert the data's type, both converting in place in the user's buffer
+ * and converting in strips while scattering, with reads larger than a single strip */
+static int
+test_read_dataset_with_type_conversion(void)
+{
+    hsize_t    dims[]     = {DATASET_READ_TCONV_TEST_DIM};
+    hsize_t    mem_dims[] = {2 * DATASET_READ_TCONV_TEST_DIM};
+    hsize_t    start[1], stride[1], count[1];
+    size_t     i;
+    hid_t      file_id = -1, fapl_id = -1;
+    hid_t      container_group = -1;
+    hid_t      dset_id = -1;
+    hid_t      fspace_id = -1, mspace_id = -1;
+    int       *wbuf      = NULL;
+    short     *short_buf = NULL;
+    long long *llong_buf = NULL;
+
+    TESTING("read from dataset with type conversion")
+
+    if (H5rest_init() < 0)
         TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_READ_TCONV_TEST_DSET_NAME, H5T_STD_I32LE, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
+    if (NULL == (wbuf = (int *)malloc(DATASET_READ_TCONV_TEST_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (short_buf = (short *)malloc(DATASET_READ_TCONV_TEST_DIM * sizeof(short))))
+        TEST_ERROR
+    if (NULL == (llong_buf = (long long *)malloc(2 * DATASET_READ_TCONV_TEST_DIM * sizeof(long long))))
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
-         "selection\n");
-#endif
+    for (i = 0; i < DATASET_READ_TCONV_TEST_DIM; i++)
+        wbuf[i] = DATASET_READ_TCONV_TEST_VALUE(i);
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    if (memcmp(data, read_buf, data_size)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading into a larger memory type at an offset in the buffer\n");
+#endif
+
+    /* A contiguous memory selection of a larger type is converted in place in the user's buffer */
+    if ((mspace_id = H5Screate_simple(1, mem_dims, NULL)) < 0)
+        TEST_ERROR
+
+    start[0] = DATASET_READ_TCONV_TEST_MEM_OFFSET;
+    count[0] = DATASET_READ_TCONV_TEST_DIM;
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < 2 * DATASET_READ_TCONV_TEST_DIM; i++)
+        llong_buf[i] = DATASET_READ_TCONV_TEST_SENTINEL;
+
+    if (H5Dread(dset_id, H5T_NATIVE_LLONG, mspace_id, H5S_ALL, H5P_DEFAULT, llong_buf) < 0) {
         H5_FAILED();
-        printf("    hyperslab selection data (contiguous) verification failed\n");
+        printf("    couldn't read from dataset into larger memory type\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
+    for (i = 0; i < 2 * DATASET_READ_TCONV_TEST_DIM; i++) {
+        size_t    offset   = DATASET_READ_TCONV_TEST_MEM_OFFSET;
+        long long expected = DATASET_READ_TCONV_TEST_SENTINEL;
 
-    if (write_buf) {
-        free(write_buf);
-        write_buf = NULL;
-    }
+        if (i >= offset && i < offset + DATASET_READ_TCONV_TEST_DIM)
+            expected = DATASET_READ_TCONV_TEST_VALUE(i - offset);
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+        if (llong_buf[i] != expected) {
+            H5_FAILED();
+            printf("    element %zu converted in place was %lld instead of %lld\n", i, llong_buf[i],
+                   expected);
+            goto error;
+        }
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset using hyperslab selection - contiguous - non-zero offset\n");
+    puts("Reading into a smaller memory type\n");
 #endif
 
-    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+    /* A smaller memory type can't be converted in place, so it's converted in strips */
+    memset(short_buf, 0, DATASET_READ_TCONV_TEST_DIM * sizeof(short));
 
-    if (NULL == (write_buf = malloc(data_size)))
-        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL, H5P_DEFAULT, short_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset into smaller memory type\n");
+        goto error;
+    }
 
-    for (i = 0; i < dims[1]; i++)
-        ((int *)write_buf)[i] = 68;
-    for (i = dims[1]; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
-        ((int *)write_buf)[i] = 67;
+    for (i = 0; i < DATASET_READ_TCONV_TEST_DIM; i++)
+        if (short_buf[i] != (short)DATASET_READ_TCONV_TEST_VALUE(i)) {
+            H5_FAILED();
+            printf("    element %zu converted in strips was %d instead of %d\n", i, (int)short_buf[i],
+                   DATASET_READ_TCONV_TEST_VALUE(i));
+            goto error;
+        }
 
-    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading into a larger memory type through a strided memory selection\n");
+#endif
 
-    if (NULL == (data = malloc(data_size)))
+    /* A non-contiguous memory selection is also converted in strips, as it's scattered */
+    start[0]  = 0;
+    stride[0] = 2;
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, NULL) < 0)
         TEST_ERROR
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
+    for (i = 0; i < 2 * DATASET_READ_TCONV_TEST_DIM; i++)
+        llong_buf[i] = DATASET_READ_TCONV_TEST_SENTINEL;
+
+    if (H5Dread(dset_id, H5T_NATIVE_LLONG, mspace_id, H5S_ALL, H5P_DEFAULT, llong_buf) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't read from dataset into strided memory selection\n");
         goto error;
     }
 
-    for (i = 2; i < 3; i++) {
-        size_t j;
+    for (i = 0; i < 2 * DATASET_READ_TCONV_TEST_DIM; i++) {
+        long long expected =
+            (i % 2) ? DATASET_READ_TCONV_TEST_SENTINEL : DATASET_READ_TCONV_TEST_VALUE(i / 2);
 
-        for (j = 0; j < dims[1]; j++)
-            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 67;
+        if (llong_buf[i] != expected) {
+            H5_FAILED();
+            printf("    element %zu scattered in strips was %lld instead of %lld\n", i, llong_buf[i],
+                   expected);
+            goto error;
+        }
     }
 
-    /* Write to third row of dataset */
-    mdims[0]  = dims[1] * 2;
-    start[0]  = dims[1];
-    stride[0] = 1;
-    count[0]  = dims[1];
-    block[0]  = 1;
-    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
+    free(llong_buf);
+    llong_buf = NULL;
+    free(short_buf);
+    short_buf = NULL;
+    free(wbuf);
+    wbuf = NULL;
+
+    if (H5Sclose(mspace_id) < 0)
         TEST_ERROR
-    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-
-    start[0] = 2;
-    start[1] = start[2] = 0;
-    stride[0] = stride[1] = stride[2] = 1;
-    count[0]                          = 1;
-    count[1]                          = dims[1];
-    count[2]                          = 1;
-    block[0] = block[1] = block[2] = 1;
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 write_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to dataset\n");
-        goto error;
+    PASSED();
+
+    return 0;
+
+error:
+    free(llong_buf);
+    free(short_buf);
+    free(wbuf);
+
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    if (H5Sclose(mspace_id) < 0)
+    return 1;
+}
+
+/* Test that vlen data read into a larger base type, whose sequences are unpacked into a
+ * single block before conversion, comes back in sequences the user can reclaim one by one */
+static int
+test_dataset_vlen_read_tconv(void)
+{
+    hsize_t dims[]     = {DATASET_VLEN_TCONV_TEST_EXTENT};
+    hsize_t mem_dims[] = {2 * DATASET_VLEN_TCONV_TEST_EXTENT};
+    hsize_t start[]    = {0};
+    hsize_t stride[]   = {2};
+    hsize_t count[]    = {DATASET_VLEN_TCONV_TEST_EXTENT};
+    size_t  i, j;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id = -1;
+    hid_t   file_dtype_id = -1, mem_dtype_id = -1;
+    hid_t   fspace_id = -1, mspace_id = -1;
+    hvl_t   wbuf[DATASET_VLEN_TCONV_TEST_EXTENT];
+    hvl_t   rbuf[2 * DATASET_VLEN_TCONV_TEST_EXTENT];
+    int     wdata[DATASET_VLEN_TCONV_TEST_EXTENT][DATASET_VLEN_TCONV_TEST_MAX_LEN];
+
+    TESTING("reading variable-length data with type conversion")
+
+    memset(rbuf, 0, sizeof(rbuf));
+
+    if (H5rest_init() < 0)
         TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if ((file_dtype_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR
+    if ((mem_dtype_id = H5Tvlen_create(H5T_NATIVE_LLONG)) < 0)
+        TEST_ERROR
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mspace_id = H5Screate_simple(1, mem_dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, DATASET_VLEN_TCONV_TEST_DSET_NAME, file_dtype_id, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    couldn't create vlen dataset\n");
         goto error;
     }
 
-    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
-        TEST_ERROR
+    /* Include empty sequences, which take no space in the unpacked block */
+    for (i = 0; i < DATASET_VLEN_TCONV_TEST_EXTENT; i++) {
+        wbuf[i].len = i % DATASET_VLEN_TCONV_TEST_MAX_LEN;
+        wbuf[i].p   = wbuf[i].len ? wdata[i] : NULL;
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
-         "selection\n");
-#endif
+        for (j = 0; j < DATASET_VLEN_TCONV_TEST_MAX_LEN; j++)
+            wdata[i][j] = (int)(i * 1000 + j * 10);
+    }
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
+    if (H5Dwrite(dset_id, file_dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't write to vlen dataset\n");
         goto error;
     }
 
-    if (memcmp(data, read_buf, data_size)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reading the whole dataset into a larger base type\n");
+#endif
+
+    if (H5Dread(dset_id, mem_dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    hyperslab selection data (contiguous) verification failed\n");
+        printf("    couldn't read from vlen dataset with conversion\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
+    for (i = 0; i < DATASET_VLEN_TCONV_TEST_EXTENT; i++) {
+        if (rbuf[i].len != wbuf[i].len) {
+            H5_FAILED();
+            printf("    sequence %zu has length %zu instead of %zu\n", i, rbuf[i].len, wbuf[i].len);
+            goto error;
+        }
 
-    if (write_buf) {
-        free(write_buf);
-        write_buf = NULL;
+        for (j = 0; j < rbuf[i].len; j++)
+            if (((long long *)rbuf[i].p)[j] != wdata[i][j]) {
+                H5_FAILED();
+                printf("    sequence %zu element %zu was %lld instead of %d\n", i, j,
+                       ((long long *)rbuf[i].p)[j], wdata[i][j]);
+                goto error;
+            }
     }
 
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
+    /* Each sequence must be its own allocation, not a pointer into the unpacked block */
+    if (H5Treclaim(mem_dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't reclaim sequences read with conversion\n");
+        goto error;
     }
 
+    memset(rbuf, 0, sizeof(rbuf));
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset using hyperslab selection - non-contiguous\n");
+    puts("Reading the whole dataset into a strided memory selection\n");
 #endif
 
-    data_size = dims[1] * 2 * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (write_buf = malloc(data_size)))
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, NULL) < 0)
         TEST_ERROR
 
-    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i = i + 2)
-        ((int *)write_buf)[i] = 78;
-    for (i = 1; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i = i + 2)
-        ((int *)write_buf)[i] = 79;
+    if (H5Dread(dset_id, mem_dtype_id, mspace_id, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from vlen dataset into strided memory selection\n");
+        goto error;
+    }
 
-    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
+    for (i = 0; i < 2 * DATASET_VLEN_TCONV_TEST_EXTENT; i++) {
+        size_t expected_len = (i % 2) ? 0 : wbuf[i / 2].len;
 
-    if (NULL == (data = malloc(data_size)))
-        TEST_ERROR
+        if (rbuf[i].len != expected_len || ((i % 2) && rbuf[i].p)) {
+            H5_FAILED();
+            printf("    memory element %zu has length %zu instead of %zu\n", i, rbuf[i].len, expected_len);
+            goto error;
+        }
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
+        for (j = 0; j < rbuf[i].len; j++)
+            if (((long long *)rbuf[i].p)[j] != wdata[i / 2][j]) {
+                H5_FAILED();
+                printf("    memory element %zu element %zu was %lld instead of %d\n", i, j,
+                       ((long long *)rbuf[i].p)[j], wdata[i / 2][j]);
+                goto error;
+            }
+    }
+
+    if (H5Treclaim(mem_dtype_id, mspace_id, H5P_DEFAULT, rbuf) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't reclaim sequences read into strided memory selection\n");
         goto error;
     }
 
-    for (i = 3; i < 4; i++) {
-        size_t j;
-
-        for (j = 0; j < dims[1]; j++)
-            ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2])] = 78;
-    }
+    memset(rbuf, 0, sizeof(rbuf));
 
-    /* Write to fourth row of dataset */
-    mdims[0] = dims[1];
-    mdims[1] = 2;
-    start[0] = start[1] = 0;
-    stride[0] = stride[1] = 1;
-    count[0]              = dims[1];
-    count[1]              = 1;
-    block[0] = block[1] = 1;
-    if ((mspace_id = H5Screate_simple(2, mdims, NULL)) < 0)
+    if (H5Sclose(mspace_id) < 0)
         TEST_ERROR
-    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-
-    start[0] = 3;
-    start[1] = start[2] = 0;
-    stride[0] = stride[1] = stride[2] = 1;
-    count[0]                          = 1;
-    count[1]                          = dims[1];
-    count[2]                          = 1;
-    block[0] = block[1] = block[2] = 1;
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+    if (H5Tclose(mem_dtype_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(file_dtype_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 write_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to dataset\n");
-        goto error;
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sselect_all(mspace_id);
+        H5Treclaim(mem_dtype_id, mspace_id, H5P_DEFAULT, rbuf);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Tclose(mem_dtype_id);
+        H5Tclose(file_dtype_id);
+        H5Dclose(dset_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*****************************************************
+ *                                                   *
+ *          Plugin Committed Datatype tests          *
+ *                                                   *
+ *****************************************************/
+
+static int
+test_create_committed_datatype(void)
+{
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1;
+    hid_t type_id         = -1;
 
-    if (H5Sclose(mspace_id) < 0)
+    TESTING("creation of committed datatype")
+
+    if (H5rest_init() < 0)
         TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the data that comes back is correct after writing to the dataset using a hyperslab "
-         "selection\n");
+    puts("Committing datatype\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't read from dataset\n");
-        goto error;
-    }
-
-    if (memcmp(data, read_buf, data_size)) {
+    if (H5Tcommit2(container_group, DATATYPE_CREATE_TEST_TYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    hyperslab selection data (non-contiguous) verification failed\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
-
-    if (write_buf) {
-        free(write_buf);
-        write_buf = NULL;
-    }
-
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset using point selection\n");
-#endif
-
-    data_size = DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (write_buf = malloc(data_size)))
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
-
-    for (i = 0; i < data_size / DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE; i++)
-        ((int *)write_buf)[i] = 13;
-
-    for (i = 0, data_size = 1; i < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (data = malloc(data_size)))
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't read from dataset\n");
-        goto error;
-    }
-
-    for (i = 0; i < dims[0]; i++) {
-        size_t j;
+    PASSED();
 
-        for (j = 0; j < dims[1]; j++) {
-            size_t k;
+    return 0;
 
-            for (k = 0; k < dims[2]; k++) {
-                if (i == j && j == k)
-                    ((int *)data)[(i * dims[1] * dims[2]) + (j * dims[2]) + k] = 13;
-            }
-        }
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(type_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    /* Select a series of 10 points in the dataset */
-    mdims[0] = DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS;
-    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0)
-        TEST_ERROR
-    for (i = 0; i < DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS; i++) {
-        points[i] = i;
-    }
-    if (H5Sselect_elements(mspace_id, H5S_SELECT_SET, DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS, points) < 0)
-        TEST_ERROR
+    return 1;
+}
 
-    for (i = 0; i < DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS; i++) {
-        size_t j;
+static int
+test_create_anonymous_committed_datatype(void)
+{
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1;
+    hid_t type_id         = -1;
 
-        for (j = 0; j < DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK; j++)
-            points[(i * DATASET_DATA_VERIFY_WRITE_TEST_DSET_SPACE_RANK) + j] = i;
-    }
+    TESTING("creation of anonymous committed datatype")
 
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_DATA_VERIFY_WRITE_TEST_NUM_POINTS, points) < 0)
+    if (H5rest_init() < 0)
         TEST_ERROR
 
-    if (H5Dwrite(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                 write_buf) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to dataset\n");
-        goto error;
-    }
-
-    if (H5Sclose(mspace_id) < 0)
-        TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_DATA_VERIFY_WRITE_TEST_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataset dataspace\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't get dataspace num points\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if (NULL == (read_buf = malloc((hsize_t)space_npoints * DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPESIZE)))
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the data that comes back is correct after writing to dataset using point "
-         "selection\n");
+    puts("Committing anonymous datatype\n");
 #endif
 
-    if (H5Dread(dset_id, DATASET_DATA_VERIFY_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) <
-        0) {
+    if (H5Tcommit_anon(container_group, type_id, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    couldn't commit anonymous datatype\n");
         goto error;
     }
 
-    if (memcmp(data, read_buf, data_size)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Linking anonymous datatype into file structure\n");
+#endif
+
+    if (H5Olink(type_id, container_group, DATATYPE_CREATE_ANONYMOUS_TYPE_NAME, H5P_DEFAULT, H5P_DEFAULT) <
+        0) {
         H5_FAILED();
-        printf("    point selection data verification failed\n");
+        printf("    couldn't link anonymous datatype into file structure\n");
         goto error;
     }
 
-    if (data) {
-        free(data);
-        data = NULL;
-    }
-
-    if (write_buf) {
-        free(write_buf);
-        write_buf = NULL;
-    }
-
-    if (read_buf) {
-        free(read_buf);
-        read_buf = NULL;
-    }
-
-    if (H5Sclose(fspace_id) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -9081,14 +13471,7 @@ test_write_dataset_data_verification(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (data)
-            free(data);
-        if (write_buf)
-            free(write_buf);
-        if (read_buf)
-            free(read_buf);
-        H5Sclose(fspace_id);
-        H5Dclose(dset_id);
+        H5Tclose(type_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -9100,18 +13483,17 @@ error:
 }
 
 static int
-test_dataset_set_extent(void)
+test_create_dataset_with_committed_type(void)
 {
-    hsize_t dims[DATASET_SET_EXTENT_TEST_SPACE_RANK];
-    hsize_t new_dims[DATASET_SET_EXTENT_TEST_SPACE_RANK];
+    hsize_t dims[DATASET_CREATE_WITH_DATATYPE_TEST_DATASET_DIMS];
     size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1;
     hid_t   dset_id         = -1;
-    hid_t   dset_dtype      = -1;
+    hid_t   type_id         = -1;
     hid_t   fspace_id       = -1;
 
-    TESTING("set dataset extent")
+    TESTING("dataset creation w/ committed datatype")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -9127,47 +13509,79 @@ test_dataset_set_extent(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype\n");
+        goto error;
+    }
+
+    if (H5Tcommit2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_TYPE_NAME, type_id, H5P_DEFAULT,
+                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't commit datatype\n");
+        goto error;
+    }
+
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_SET_EXTENT_TEST_SPACE_RANK; i++)
+    if ((type_id = H5Topen2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_TYPE_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open committed datatype\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATATYPE_CREATE_TEST_DATASET_DIMS; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-    for (i = 0; i < DATASET_SET_EXTENT_TEST_SPACE_RANK; i++)
-        new_dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(DATASET_SET_EXTENT_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(DATATYPE_CREATE_TEST_DATASET_DIMS, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating dataset with a committed type\n");
+#endif
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_SET_EXTENT_TEST_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_DSET_NAME, type_id,
+                              fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create dataset using variable-length string committed datatype\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Testing use of H5Dset_extent to change dataset's extent\n");
-#endif
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Dset_extent(dset_id, new_dims) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+    if ((dset_id = H5Dopen2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    failed to open dataset\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
@@ -9187,8 +13601,8 @@ test_dataset_set_extent(void)
 error:
     H5E_BEGIN_TRY
     {
+        H5Tclose(type_id);
         H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -9201,18 +13615,18 @@ error:
 }
 
 static int
-test_unused_dataset_API_calls(void)
+test_create_attribute_with_committed_type(void)
 {
-    H5D_space_status_t allocation;
-    hsize_t            dims[DATASET_UNUSED_APIS_TEST_SPACE_RANK];
-    size_t             i;
-    hid_t              file_id = -1, fapl_id = -1;
-    hid_t              container_group = -1;
-    hid_t              dset_id         = -1;
-    hid_t              dset_dtype      = -1;
-    hid_t              fspace_id       = -1;
+    hsize_t dims[ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   attr_id         = -1;
+    hid_t   type_id         = -1;
+    hid_t   space_id        = -1;
 
-    TESTING("unused dataset API calls")
+    TESTING("attribute creation w/ committed datatype")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -9228,48 +13642,70 @@ test_unused_dataset_API_calls(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_UNUSED_APIS_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype\n");
+        goto error;
+    }
 
-    if ((fspace_id = H5Screate_simple(DATASET_UNUSED_APIS_TEST_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    if (H5Tcommit2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_DTYPE_NAME, type_id, H5P_DEFAULT,
+                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't commit datatype\n");
+        goto error;
+    }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, DATASET_UNUSED_APIS_TEST_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((type_id = H5Topen2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_DTYPE_NAME, H5P_DEFAULT)) <
+        0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't open committed datatype\n");
         goto error;
     }
 
+    for (i = 0; i < ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Testing that all of the unused dataset API calls don't cause application issues\n");
+    puts("Creating attribute with a committed type\n");
 #endif
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Dget_storage_size(dset_id) > 0)
-            TEST_ERROR
-        if (H5Dget_space_status(dset_id, &allocation) > 0)
-            TEST_ERROR
-        if (H5Dget_offset(dset_id) != HADDR_UNDEF)
-            TEST_ERROR
+    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_ATTR_NAME, type_id,
+                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create attribute\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if (H5Sclose(fspace_id) < 0)
+    /* Verify the attribute has been created */
+    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_ATTR_NAME)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if attribute exists\n");
+        goto error;
+    }
+
+    if (!attr_exists) {
+        H5_FAILED();
+        printf("    attribute did not exist\n");
+        goto error;
+    }
+
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -9287,9 +13723,9 @@ test_unused_dataset_API_calls(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
+        H5Tclose(type_id);
+        H5Sclose(space_id);
+        H5Aclose(attr_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -9301,22 +13737,14 @@ error:
 }
 
 static int
-test_dataset_property_lists(void)
+test_delete_committed_type(void)
 {
-    const char *path_prefix = "/test_prefix";
-    hsize_t     dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
-    hsize_t     chunk_dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
-    size_t      i;
-    hid_t       file_id = -1, fapl_id = -1;
-    hid_t       container_group = -1, group_id = -1;
-    hid_t       dset_id1 = -1, dset_id2 = -1, dset_id3 = -1, dset_id4 = -1;
-    hid_t       dcpl_id1 = -1, dcpl_id2 = -1;
-    hid_t       dapl_id1 = -1, dapl_id2 = -1;
-    hid_t       dset_dtype1 = -1, dset_dtype2 = -1, dset_dtype3 = -1, dset_dtype4 = -1;
-    hid_t       space_id   = -1;
-    char       *tmp_prefix = NULL;
+    htri_t type_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1;
+    hid_t  type_id         = -1;
 
-    TESTING("dataset property list operations")
+    TESTING("delete committed datatype")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -9332,307 +13760,233 @@ test_dataset_property_lists(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container sub-group\n");
-        goto error;
-    }
-
-    for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-    for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
-        chunk_dims[i] = (hsize_t)(rand() % (int)dims[i] + 1);
-
-    if ((space_id = H5Screate_simple(DATASET_PROPERTY_LIST_TEST_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dset_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype3 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype4 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    if ((dcpl_id1 = H5Pcreate(H5P_DATASET_CREATE)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create DCPL\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Setting property on DCPL\n");
-#endif
-
-    if (H5Pset_chunk(dcpl_id1, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, chunk_dims) < 0) {
-        H5_FAILED();
-        printf("    couldn't set DCPL property\n");
-        goto error;
-    }
-
-    if ((dset_id1 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME1, dset_dtype1, space_id,
-                               H5P_DEFAULT, dcpl_id1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create dataset\n");
-        goto error;
-    }
-
-    if ((dset_id2 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME2, dset_dtype2, space_id,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create dataset\n");
-        goto error;
-    }
-
-    if (H5Pclose(dcpl_id1) < 0)
-        TEST_ERROR
-
-    /* Try to receive copies of the two property lists, one which has the property set and one which does not
-     */
-    if ((dcpl_id1 = H5Dget_create_plist(dset_id1)) < 0) {
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if ((dcpl_id2 = H5Dget_create_plist(dset_id2)) < 0) {
+    if (H5Tcommit2(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
-
-    /* Ensure that property list 1 has the property set and property list 2 does not */
-    {
-        hsize_t tmp_chunk_dims[DATASET_PROPERTY_LIST_TEST_SPACE_RANK];
-
-        memset(tmp_chunk_dims, 0, sizeof(tmp_chunk_dims));
-
-        if (H5Pget_chunk(dcpl_id1, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, tmp_chunk_dims) < 0) {
-            H5_FAILED();
-            printf("    couldn't get DCPL property value\n");
-            goto error;
-        }
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Ensuring that the property on the DCPL was received back correctly\n");
-#endif
-
-        for (i = 0; i < DATASET_PROPERTY_LIST_TEST_SPACE_RANK; i++)
-            if (tmp_chunk_dims[i] != chunk_dims[i]) {
-                H5_FAILED();
-                printf("    DCPL property values were incorrect\n");
-                goto error;
-            }
-
-        H5E_BEGIN_TRY
-        {
-            if (H5Pget_chunk(dcpl_id2, DATASET_PROPERTY_LIST_TEST_SPACE_RANK, tmp_chunk_dims) >= 0) {
-                H5_FAILED();
-                printf("    property list 2 shouldn't have had chunk dimensionality set (not a chunked "
-                       "layout)\n");
-                goto error;
-            }
-        }
-        H5E_END_TRY;
+
+    if ((type_exists = H5Lexists(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if datatype exists\n");
+        goto error;
     }
 
-    if ((dapl_id1 = H5Pcreate(H5P_DATASET_ACCESS)) < 0) {
+    if (!type_exists) {
         H5_FAILED();
-        printf("    couldn't create DAPL\n");
+        printf("    datatype didn't exist\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Setting property on DAPL\n");
+    puts("Deleting committed type with H5Ldelete\n");
 #endif
 
-    if (H5Pset_efile_prefix(dapl_id1, path_prefix) < 0) {
+    if (H5Ldelete(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't set DAPL property\n");
+        printf("    couldn't delete datatype\n");
         goto error;
     }
 
-    if ((dset_id3 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME3, dset_dtype3, space_id,
-                               H5P_DEFAULT, H5P_DEFAULT, dapl_id1)) < 0) {
+    if ((type_exists = H5Lexists(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't determine if datatype exists\n");
         goto error;
     }
 
-    if ((dset_id4 = H5Dcreate2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME4, dset_dtype4, space_id,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (type_exists) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    datatype exists\n");
         goto error;
     }
 
-    if (H5Pclose(dapl_id1) < 0)
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
 
-    /* Try to receive copies of the two property lists, one which has the property set and one which does not
-     */
-    if ((dapl_id1 = H5Dget_access_plist(dset_id3)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get property list\n");
-        goto error;
-    }
+    PASSED();
 
-    if ((dapl_id2 = H5Dget_access_plist(dset_id4)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get property list\n");
-        goto error;
-    }
+    return 0;
 
-    /* Ensure that property list 1 has the property set and property list 2 does not */
+error:
+    H5E_BEGIN_TRY
     {
-        ssize_t buf_size = 0;
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Ensuring that the property on the DAPL was received back correctly\n");
-#endif
+        H5Tclose(type_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
 
-        if ((buf_size = H5Pget_efile_prefix(dapl_id1, NULL, 0)) < 0) {
-            H5_FAILED();
-            printf("    couldn't retrieve size for property value buffer\n");
-            goto error;
-        }
+    return 1;
+}
 
-        if (NULL == (tmp_prefix = (char *)calloc(1, (size_t)buf_size + 1)))
-            TEST_ERROR
+static int
+test_unused_datatype_API_calls(void)
+{
+    TESTING("unused datatype API calls")
 
-        if (H5Pget_efile_prefix(dapl_id1, tmp_prefix, (size_t)buf_size + 1) < 0) {
-            H5_FAILED();
-            printf("    couldn't retrieve property list value\n");
-            goto error;
-        }
+    /* None currently that aren't planned to be used */
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Currently no API calls to test here\n");
+#endif
 
-        if (strcmp(tmp_prefix, path_prefix)) {
-            H5_FAILED();
-            printf("    DAPL values were incorrect!\n");
-            goto error;
-        }
+    SKIPPED();
 
-        memset(tmp_prefix, 0, (size_t)buf_size + 1);
+    return 0;
+}
 
-        if (H5Pget_efile_prefix(dapl_id2, tmp_prefix, (size_t)buf_size) < 0) {
-            H5_FAILED();
-            printf("    couldn't retrieve property list value\n");
-            goto error;
-        }
+static int
+test_datatype_property_lists(void)
+{
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1, group_id = -1;
+    hid_t type_id1 = -1, type_id2 = -1;
+    hid_t tcpl_id1 = -1, tcpl_id2 = -1;
 
-        if (!strcmp(tmp_prefix, path_prefix)) {
-            H5_FAILED();
-            printf("    DAPL property value was set!\n");
-            goto error;
-        }
-    }
+    TESTING("datatype property list operations")
 
-    /* Now close the property lists and datasets and see if we can still retrieve copies of
-     * the property lists upon opening (instead of creating) a dataset
-     */
-    if (H5Pclose(dcpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(dcpl_id2) < 0)
-        TEST_ERROR
-    if (H5Pclose(dapl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(dapl_id2) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id1) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
+    if (H5rest_init() < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id3) < 0)
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id4) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((dset_id1 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((dset_id2 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((dset_id3 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME3, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, DATATYPE_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't create container sub-group\n");
         goto error;
     }
 
-    if ((dset_id4 = H5Dopen2(group_id, DATASET_PROPERTY_LIST_TEST_DSET_NAME4, H5P_DEFAULT)) < 0) {
+    if ((type_id1 = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if ((dcpl_id1 = H5Dget_create_plist(dset_id1)) < 0) {
+    if ((type_id2 = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if ((dcpl_id2 = H5Dget_create_plist(dset_id2)) < 0) {
+    if ((tcpl_id1 = H5Pcreate(H5P_DATATYPE_CREATE)) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't create TCPL\n");
         goto error;
     }
 
-    if ((dapl_id1 = H5Dget_access_plist(dset_id3)) < 0) {
+    /* Currently no TCPL routines are defined */
+
+    if (H5Tcommit2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME1, type_id1, H5P_DEFAULT, tcpl_id1,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-    if ((dapl_id2 = H5Dget_create_plist(dset_id4)) < 0) {
+    if (H5Tcommit2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME2, type_id2, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't commit datatype\n");
+        goto error;
+    }
+
+    if (H5Pclose(tcpl_id1) < 0)
+        TEST_ERROR
+
+    /* Try to receive copies for the two property lists */
+    if ((tcpl_id1 = H5Tget_create_plist(type_id1)) < 0) {
         H5_FAILED();
         printf("    couldn't get property list\n");
         goto error;
     }
 
-    if (tmp_prefix) {
-        free(tmp_prefix);
-        tmp_prefix = NULL;
+    if ((tcpl_id2 = H5Tget_create_plist(type_id2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
     }
 
-    if (H5Pclose(dcpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(dcpl_id2) < 0)
-        TEST_ERROR
-    if (H5Pclose(dapl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(dapl_id2) < 0)
-        TEST_ERROR
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype1) < 0)
+    /* Now close the property lists and datatypes and see if we can still retrieve copies of
+     * the property lists upon opening (instead of creating) a datatype
+     */
+    if (H5Pclose(tcpl_id1) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype2) < 0)
+    if (H5Pclose(tcpl_id2) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype3) < 0)
+    if (H5Tclose(type_id1) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype4) < 0)
+    if (H5Tclose(type_id2) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id1) < 0)
+
+    if ((type_id1 = H5Topen2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open datatype\n");
+        goto error;
+    }
+
+    if ((type_id2 = H5Topen2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open datatype\n");
+        goto error;
+    }
+
+    if ((tcpl_id1 = H5Tget_create_plist(type_id1)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
+
+    if ((tcpl_id2 = H5Tget_create_plist(type_id2)) < 0) {
+        H5_FAILED();
+        printf("    couldn't get property list\n");
+        goto error;
+    }
+
+    if (H5Pclose(tcpl_id1) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
+    if (H5Pclose(tcpl_id2) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id3) < 0)
+    if (H5Tclose(type_id1) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id4) < 0)
+    if (H5Tclose(type_id2) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -9652,20 +14006,10 @@ test_dataset_property_lists(void)
 error:
     H5E_BEGIN_TRY
     {
-        free(tmp_prefix);
-        H5Pclose(dcpl_id1);
-        H5Pclose(dcpl_id2);
-        H5Pclose(dapl_id1);
-        H5Pclose(dapl_id2);
-        H5Sclose(space_id);
-        H5Tclose(dset_dtype1);
-        H5Tclose(dset_dtype2);
-        H5Tclose(dset_dtype3);
-        H5Tclose(dset_dtype4);
-        H5Dclose(dset_id1);
-        H5Dclose(dset_id2);
-        H5Dclose(dset_id3);
-        H5Dclose(dset_id4);
+        H5Pclose(tcpl_id1);
+        H5Pclose(tcpl_id2);
+        H5Tclose(type_id1);
+        H5Tclose(type_id2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -9677,29 +14021,20 @@ error:
     return 1;
 }
 
+/*****************************************************
+ *                                                   *
+ *                Plugin Link tests                  *
+ *                                                   *
+ *****************************************************/
+
 static int
-test_dataset_vlen_io(void)
+test_create_hard_link(void)
 {
-    hid_t file_id   = H5I_INVALID_HID;
-    hid_t dset_id   = H5I_INVALID_HID;
-    hid_t fapl_id   = H5I_INVALID_HID;
-    hid_t fspace_id = H5I_INVALID_HID;
-    hid_t dtype_id  = H5I_INVALID_HID;
-
-    hvl_t init[DATASET_VLEN_IO_TEST_EXTENT];
-    hvl_t wbuf[DATASET_VLEN_IO_TEST_EXTENT];
-    hvl_t rbuf[DATASET_VLEN_IO_TEST_EXTENT];
-
-    const hsize_t dims[]   = {DATASET_VLEN_IO_TEST_EXTENT};
-    const hsize_t points[] = {2, 3, 4, 5};
-
-    /* Hyperslab specification for elements at indices 2-5 */
-    hssize_t start[1]  = {2};
-    hssize_t stride[1] = {2};
-    hssize_t block[1]  = {2};
-    hssize_t count[1]  = {2};
+    htri_t link_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1;
 
-    TESTING("Reading and writing variable-length data to a dataset");
+    TESTING("create hard link")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -9709,346 +14044,195 @@ test_dataset_vlen_io(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
-        TEST_ERROR
-
-    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dtype_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create vlen datatype\n");
-        goto error;
-    }
-
-    if ((dset_id = H5Dcreate2(file_id, DATASET_VLEN_IO_TEST_DSET_NAME, dtype_id, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create vlen dataset\n");
-        goto error;
-    }
-
-    memset(wbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-    memset(init, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-
-    /* Test read and write to entire dataset with vlen data */
-
-    /* Generate data and allocate memory */
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        init[i].len = 0;
-        init[i].p   = NULL;
-
-        wbuf[i].len = i + 1;
-        wbuf[i].p   = calloc(i + 1, sizeof(int));
-
-        for (size_t j = 0; j < i + 1; j++) {
-            ((int *)wbuf[i].p)[j] = (int)((i)*1000 + j * 10);
-        }
-    }
-
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to entire vlen dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    /* Read back entire dataset */
-    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't read from entire vlen dataset\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    /* Verify data */
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        if (rbuf[i].len != wbuf[i].len) {
-            H5_FAILED();
-            printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len, rbuf[i].len);
-            goto error;
-        }
-
-        for (size_t j = 0; j < rbuf[i].len; j++) {
-            int actual   = ((int *)rbuf[i].p)[j];
-            int expected = ((int *)wbuf[i].p)[j];
-
-            if (actual != expected) {
-                H5_FAILED();
-                printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected, actual);
-                goto error;
-            }
-        }
-    }
-
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
-        TEST_ERROR
-
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-
-    /* Test read and write to hyperslab selections with vlen data */
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a hard link\n");
+#endif
 
-    /* Write to hyperslab, then read all */
-    /* Reset dataset */
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)init) < 0) {
+    if (H5Lcreate_hard(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_NAME,
+                       container_group, HARD_LINK_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't write to entire vlen dataset\n");
+        printf("    couldn't create hard link\n");
         goto error;
     }
 
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the link exists\n");
+#endif
 
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, (const void *)wbuf) < 0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(container_group, HARD_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to hyperslab selection in vlen dataset\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't read from entire vlen dataset\n");
+        printf("    link did not exist\n");
         goto error;
     }
 
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        if (i >= 2 && i <= 5) {
-            if (rbuf[i].len != wbuf[i].len) {
-                H5_FAILED();
-                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
-                       rbuf[i].len);
-                goto error;
-            }
-
-            for (size_t j = 0; j < rbuf[i].len; j++) {
-                int actual   = ((int *)rbuf[i].p)[j];
-                int expected = ((int *)wbuf[i].p)[j];
-
-                if (actual != expected) {
-                    H5_FAILED();
-                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
-                           actual);
-                    goto error;
-                }
-            }
-        }
-        else {
-            if (rbuf[i].len != init[i].len) {
-                H5_FAILED();
-                printf("    Wrong length for unread slab element!");
-                goto error;
-            }
-            if (rbuf[i].p != init[i].p) {
-                H5_FAILED();
-                printf("    Wrong pointer (non-NULL) for unread slab element!");
-                goto error;
-            }
-        }
-    }
-
-    if (H5Sselect_all(fspace_id) < 0)
+    if (H5Gclose(container_group) < 0)
         TEST_ERROR
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
         TEST_ERROR
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-
-    /* Write to all, then read from hyperslab */
 
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
-        H5_FAILED();
-        printf("    couldn't write to entire vlen dataset\n");
-        goto error;
-    }
+    PASSED();
 
-    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
-        TEST_ERROR
+    return 0;
 
-    if (H5Dread(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, rbuf) < 0) {
-        H5_FAILED();
-        printf("    couldn't read from hyperslab selection in vlen dataset\n");
-        goto error;
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        if (i >= 2 && i <= 5) {
-            if (rbuf[i].len != wbuf[i].len) {
-                H5_FAILED();
-                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
-                       rbuf[i].len);
-                goto error;
-            }
+    return 1;
+}
 
-            for (size_t j = 0; j < rbuf[i].len; j++) {
-                int actual   = ((int *)rbuf[i].p)[j];
-                int expected = ((int *)wbuf[i].p)[j];
+/*
+ * The following two tests ensure that behavior is correct when using
+ * the H5L_SAME_LOC macro for H5Lcreate_hard().
+ */
+static int
+test_create_hard_link_same_loc(void)
+{
+    hsize_t dims[H5L_SAME_LOC_TEST_DSET_SPACE_RANK];
+    size_t  i;
+    htri_t  link_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   space_id   = -1;
 
-                if (actual != expected) {
-                    H5_FAILED();
-                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
-                           actual);
-                    goto error;
-                }
-            }
-        }
-        else {
-            if (rbuf[i].len != init[i].len) {
-                H5_FAILED();
-                printf("    Wrong length for unread slab element!");
-                goto error;
-            }
-            if (rbuf[i].p != init[i].p) {
-                H5_FAILED();
-                printf("    Wrong pointer (non-NULL) for unread slab element!");
-                goto error;
-            }
-        }
-    }
+    TESTING("create hard link with H5L_SAME_LOC")
 
-    if (H5Sselect_all(fspace_id) < 0)
-        TEST_ERROR
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+    if (H5rest_init() < 0)
         TEST_ERROR
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
 
-    /* Test read and write to point selections with vlen data */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
 
-    /* Reset dataset */
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)init) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to entire vlen dataset\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_VLEN_IO_TEST_NUM_POINTS, points) < 0)
-        TEST_ERROR
-
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, (const void *)wbuf) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to point selection in vlen dataset\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    /* Read back entire dataset */
-    if (H5Dread(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+    if ((group_id = H5Gcreate2(container_group, H5L_SAME_LOC_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't read from entire vlen dataset\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-    /* Verify data */
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        if (i >= 2 && i <= 5) {
-            if (rbuf[i].len != wbuf[i].len) {
-                H5_FAILED();
-                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
-                       rbuf[i].len);
-                goto error;
-            }
-
-            for (size_t j = 0; j < rbuf[i].len; j++) {
-                int actual   = ((int *)rbuf[i].p)[j];
-                int expected = ((int *)wbuf[i].p)[j];
-
-                if (actual != expected) {
-                    H5_FAILED();
-                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
-                           actual);
-                    goto error;
-                }
-            }
-        }
-        else {
-            if (rbuf[i].len != init[i].len) {
-                H5_FAILED();
-                printf("    Wrong length for unread slab element!");
-                goto error;
-            }
-            if (rbuf[i].p != init[i].p) {
-                H5_FAILED();
-                printf("    Wrong pointer (non-NULL) for unread slab element!");
-                goto error;
-            }
-        }
-    }
+    memset(dims, 0, sizeof(dims));
+    for (i = 0; i < H5L_SAME_LOC_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if (H5Sselect_all(fspace_id) < 0)
+    if ((space_id = H5Screate_simple(H5L_SAME_LOC_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
 
-    /* Test point read */
+    if ((dset_id = H5Dcreate2(group_id, H5L_SAME_LOC_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
 
-    /* Write to entire dataset */
-    if (H5Dwrite(dset_id, dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, (const void *)wbuf) < 0) {
+/* Library functionality for this part of the test is broken */
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Calling H5Lcreate_hard with H5L_SAME_LOC as first parameter\n");
+#endif
+
+    if (H5Lcreate_hard(H5L_SAME_LOC, H5L_SAME_LOC_TEST_DSET_NAME, group_id, H5L_SAME_LOC_TEST_LINK_NAME1,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't write to entire vlen dataset\n");
+        printf("    couldn't create first link\n");
         goto error;
     }
 
-    /* Read back selected points */
-    if (H5Sselect_elements(fspace_id, H5S_SELECT_SET, DATASET_VLEN_IO_TEST_NUM_POINTS, points) < 0)
-        TEST_ERROR
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, H5L_SAME_LOC_TEST_LINK_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
 
-    if (H5Dread(dset_id, dtype_id, H5S_ALL, fspace_id, H5P_DEFAULT, rbuf) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't read from point selection in vlen dataset\n");
+        printf("    link did not exist\n");
         goto error;
     }
 
-    /* Verify data */
-    for (size_t i = 0; i < DATASET_VLEN_IO_TEST_EXTENT; i++) {
-        if (i >= 2 && i <= 5) {
-            if (rbuf[i].len != wbuf[i].len) {
-                H5_FAILED();
-                printf("    Wrong length! Seq #%zu expected len %zu, got len %zu\n", i, wbuf[i].len,
-                       rbuf[i].len);
-                goto error;
-            }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Calling H5Lcreate_hard with H5L_SAME_LOC as second parameter\n");
+#endif
 
-            for (size_t j = 0; j < rbuf[i].len; j++) {
-                int actual   = ((int *)rbuf[i].p)[j];
-                int expected = ((int *)wbuf[i].p)[j];
+    if (H5Lcreate_hard(group_id, H5L_SAME_LOC_TEST_DSET_NAME, H5L_SAME_LOC, H5L_SAME_LOC_TEST_LINK_NAME2,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create second link\n");
+        goto error;
+    }
 
-                if (actual != expected) {
-                    H5_FAILED();
-                    printf("    Wrong value! Seq %zu elem %zu expected %d but got %d\n", i, j, expected,
-                           actual);
-                    goto error;
-                }
-            }
-        }
-        else {
-            if (rbuf[i].len != init[i].len) {
-                H5_FAILED();
-                printf("    Wrong length for unread slab element!");
-                goto error;
-            }
-            if (rbuf[i].p != init[i].p) {
-                H5_FAILED();
-                printf("    Wrong pointer (non-NULL) for unread slab element!");
-                goto error;
-            }
-        }
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, H5L_SAME_LOC_TEST_LINK_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
     }
 
-    if (H5Sselect_all(fspace_id) < 0)
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link did not exist\n");
+        goto error;
+    }
+
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, wbuf) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-
-    memset(wbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-    memset(rbuf, 0, sizeof(hvl_t) * DATASET_VLEN_IO_TEST_EXTENT);
-
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dtype_id) < 0)
-        TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
     if (H5rest_term() < 0)
@@ -10061,13 +14245,12 @@ test_dataset_vlen_io(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sselect_all(fspace_id);
-        H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, rbuf);
-        H5Treclaim(dtype_id, fspace_id, H5P_DEFAULT, wbuf);
-        H5Sclose(fspace_id);
+        H5Sclose(space_id);
+        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
         H5Pclose(fapl_id);
-        H5Tclose(dtype_id);
         H5Fclose(file_id);
         H5rest_term();
     }
@@ -10076,20 +14259,19 @@ error:
     return 1;
 }
 
-/*****************************************************
- *                                                   *
- *          Plugin Committed Datatype tests          *
- *                                                   *
- *****************************************************/
-
 static int
-test_create_committed_datatype(void)
+test_create_soft_link_existing_relative(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1;
-    hid_t type_id         = -1;
+    hsize_t dims[SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK];
+    size_t  i;
+    htri_t  link_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id     = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
 
-    TESTING("creation of committed datatype")
+    TESTING("create soft link to existing object by relative path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10105,30 +14287,79 @@ test_create_committed_datatype(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_EXISTING_RELATIVE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create container subgroup\n");
+        goto error;
+    }
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_dspace = H5Screate_simple(SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_NAME, dset_dtype, dset_dspace,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Committing datatype\n");
+    puts("Creating soft link with relative path value to an existing object\n");
 #endif
 
-    if (H5Tcommit2(container_group, DATATYPE_CREATE_TEST_TYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
+    if (H5Lcreate_soft(SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_NAME, group_id,
+                       SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the link exists\n");
+#endif
+
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link did not exist\n");
+        goto error;
+    }
+
+    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open dataset through the soft link\n");
+        goto error;
+    }
+
+    if (H5Sclose(dset_dspace) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -10146,7 +14377,10 @@ test_create_committed_datatype(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
+        H5Sclose(dset_dspace);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -10158,13 +14392,13 @@ error:
 }
 
 static int
-test_create_anonymous_committed_datatype(void)
+test_create_soft_link_existing_absolute(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1;
-    hid_t type_id         = -1;
+    htri_t link_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, group_id = -1, root_id = -1;
 
-    TESTING("creation of anonymous committed datatype")
+    TESTING("create soft link to existing object by absolute path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10180,40 +14414,59 @@ test_create_anonymous_committed_datatype(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_EXISTING_ABSOLUTE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Committing anonymous datatype\n");
+    puts("Creating a soft link with absolute path value to an existing object\n");
 #endif
 
-    if (H5Tcommit_anon(container_group, type_id, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Lcreate_soft("/", group_id, SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) <
+        0) {
         H5_FAILED();
-        printf("    couldn't commit anonymous datatype\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Linking anonymous datatype into file structure\n");
+    puts("Verifying that the link exists\n");
 #endif
 
-    if (H5Olink(type_id, container_group, DATATYPE_CREATE_ANONYMOUS_TYPE_NAME, H5P_DEFAULT, H5P_DEFAULT) <
-        0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" LINK_TEST_GROUP_NAME "/" SOFT_LINK_EXISTING_ABSOLUTE_TEST_SUBGROUP_NAME
+                                 "/" SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME,
+                                 H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't link anonymous datatype into file structure\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link did not exist\n");
+        goto error;
+    }
+
+    if ((root_id = H5Gopen2(group_id, SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open object pointed to by soft link\n");
+        goto error;
+    }
+
+    if (H5Gclose(root_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -10231,7 +14484,8 @@ test_create_anonymous_committed_datatype(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
+        H5Gclose(root_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -10243,17 +14497,18 @@ error:
 }
 
 static int
-test_create_dataset_with_committed_type(void)
+test_create_soft_link_dangling_relative(void)
 {
-    hsize_t dims[DATASET_CREATE_WITH_DATATYPE_TEST_DATASET_DIMS];
+    hsize_t dims[SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK];
     size_t  i;
+    htri_t  link_exists;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   type_id         = -1;
-    hid_t   fspace_id       = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id     = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
 
-    TESTING("dataset creation w/ committed datatype")
+    TESTING("create dangling soft link to object by relative path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10269,82 +14524,90 @@ test_create_dataset_with_committed_type(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_DANGLING_RELATIVE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if (H5Tcommit2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_TYPE_NAME, type_id, H5P_DEFAULT,
-                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a dangling soft link with relative path value\n");
+#endif
+
+    if (H5Lcreate_soft(SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_NAME, group_id,
+                       SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the link exists\n");
+#endif
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    link did not exist\n");
         goto error;
     }
 
-    if ((type_id = H5Topen2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_TYPE_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open committed datatype\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        if (H5Dopen2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    opened target of dangling link!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
-    for (i = 0; i < DATATYPE_CREATE_TEST_DATASET_DIMS; i++)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(DATATYPE_CREATE_TEST_DATASET_DIMS, dims, NULL)) < 0)
+    if ((dset_dspace = H5Screate_simple(SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dataset with a committed type\n");
-#endif
-
-    if ((dset_id = H5Dcreate2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_DSET_NAME, type_id,
-                              fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_NAME, dset_dtype, dset_dspace,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset using variable-length string committed datatype\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dopen2(container_group, DATASET_CREATE_WITH_DATATYPE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    failed to open dataset\n");
+        printf("    couldn't open dataset pointed to by soft link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
+    if (H5Sclose(dset_dspace) < 0)
         TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -10361,9 +14624,10 @@ test_create_dataset_with_committed_type(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
-        H5Sclose(fspace_id);
+        H5Sclose(dset_dspace);
+        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -10375,18 +14639,18 @@ error:
 }
 
 static int
-test_create_attribute_with_committed_type(void)
+test_create_soft_link_dangling_absolute(void)
 {
-    hsize_t dims[ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK];
+    hsize_t dims[SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK];
     size_t  i;
-    htri_t  attr_exists;
+    htri_t  link_exists;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   attr_id         = -1;
-    hid_t   type_id         = -1;
-    hid_t   space_id        = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id     = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
 
-    TESTING("attribute creation w/ committed datatype")
+    TESTING("create dangling soft link to object by absolute path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10402,70 +14666,90 @@ test_create_attribute_with_committed_type(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_DANGLING_ABSOLUTE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if (H5Tcommit2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_DTYPE_NAME, type_id, H5P_DEFAULT,
-                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating dangling soft link with absolute path value\n");
+#endif
+
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" SOFT_LINK_DANGLING_ABSOLUTE_TEST_SUBGROUP_NAME
+                       "/" SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_NAME,
+                       group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the link exists\n");
+#endif
 
-    if ((type_id = H5Topen2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_DTYPE_NAME, H5P_DEFAULT)) <
-        0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open committed datatype\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    for (i = 0; i < ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link did not exist\n");
+        goto error;
+    }
 
-    if ((space_id = H5Screate_simple(ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    H5E_BEGIN_TRY
+    {
+        if (H5Dopen2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    opened target of dangling link!\n");
+            goto error;
+        }
+    }
+    H5E_END_TRY;
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating attribute with a committed type\n");
-#endif
+    for (i = 0; i < SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((attr_id = H5Acreate2(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_ATTR_NAME, type_id,
-                              space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create attribute\n");
-        goto error;
-    }
+    if ((dset_dspace = H5Screate_simple(SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
 
-    /* Verify the attribute has been created */
-    if ((attr_exists = H5Aexists(container_group, ATTRIBUTE_CREATE_WITH_DATATYPE_TEST_ATTR_NAME)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_NAME, dset_dtype, dset_dspace,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if attribute exists\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (!attr_exists) {
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    attribute did not exist\n");
+        printf("    couldn't open dataset pointed to by soft link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
+    if (H5Sclose(dset_dspace) < 0)
         TEST_ERROR
-    if (H5Sclose(space_id) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Aclose(attr_id) < 0)
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -10483,9 +14767,10 @@ test_create_attribute_with_committed_type(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
-        H5Sclose(space_id);
-        H5Aclose(attr_id);
+        H5Sclose(dset_dspace);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -10497,14 +14782,18 @@ error:
 }
 
 static int
-test_delete_committed_type(void)
+test_create_external_link(void)
 {
-    htri_t type_exists;
+    htri_t link_exists;
     hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1;
-    hid_t  type_id         = -1;
+    hid_t  container_group = -1, group_id = -1;
+    hid_t  root_id = -1;
+    char   ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("delete committed datatype")
+    TESTING("create external link to existing object")
+
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10514,66 +14803,71 @@ test_delete_committed_type(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if ((file_id = H5Fcreate(ext_link_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't create file for external link to reference\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
 
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if (H5Tcommit2(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_exists = H5Lexists(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, EXTERNAL_LINK_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if datatype exists\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if (!type_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating an external link to root group of other file\n");
+#endif
+
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    datatype didn't exist\n");
+        printf("    couldn't create external link\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Deleting committed type with H5Ldelete\n");
+    puts("Verifying that the link exists\n");
 #endif
 
-    if (H5Ldelete(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT) < 0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't delete datatype\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if ((type_exists = H5Lexists(container_group, DATATYPE_DELETE_TEST_DTYPE_NAME, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't determine if datatype exists\n");
+        printf("    link did not exist\n");
         goto error;
     }
 
-    if (type_exists) {
+    if ((root_id = H5Gopen2(group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    datatype exists\n");
+        printf("    couldn't open root group of other file using external link\n");
         goto error;
     }
 
-    if (H5Tclose(type_id) < 0)
+    if (H5Gclose(root_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -10591,7 +14885,8 @@ test_delete_committed_type(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
+        H5Gclose(root_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -10603,29 +14898,22 @@ error:
 }
 
 static int
-test_unused_datatype_API_calls(void)
+test_create_dangling_external_link(void)
 {
-    TESTING("unused datatype API calls")
-
-    /* None currently that aren't planned to be used */
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Currently no API calls to test here\n");
-#endif
-
-    SKIPPED();
-
-    return 0;
-}
+    hsize_t dims[EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK];
+    size_t  i;
+    htri_t  link_exists;
+    hid_t   file_id = -1, ext_file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id     = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
+    char    ext_link_filename[FILENAME_MAX_LENGTH];
 
-static int
-test_datatype_property_lists(void)
-{
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1, group_id = -1;
-    hid_t type_id1 = -1, type_id2 = -1;
-    hid_t tcpl_id1 = -1, tcpl_id2 = -1;
+    TESTING("create dangling external link")
 
-    TESTING("datatype property list operations")
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10635,118 +14923,111 @@ test_datatype_property_lists(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if ((ext_file_id = H5Fcreate(ext_link_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't create file for external link to reference\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATATYPE_PROPERTY_LIST_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((type_id1 = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, EXTERNAL_LINK_TEST_DANGLING_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((type_id2 = generate_random_datatype(H5T_NO_CLASS)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create datatype\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a dangling external link to a dataset in other file\n");
+#endif
 
-    if ((tcpl_id1 = H5Pcreate(H5P_DATATYPE_CREATE)) < 0) {
+    if (H5Lcreate_external(ext_link_filename, "/" EXTERNAL_LINK_TEST_DANGLING_DSET_NAME, group_id,
+                           EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create TCPL\n");
+        printf("    couldn't create dangling external link\n");
         goto error;
     }
 
-    /* Currently no TCPL routines are defined */
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that the link exists\n");
+#endif
 
-    if (H5Tcommit2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME1, type_id1, H5P_DEFAULT, tcpl_id1,
-                   H5P_DEFAULT) < 0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (H5Tcommit2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME2, type_id2, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    link did not exist\n");
         goto error;
     }
 
-    if (H5Pclose(tcpl_id1) < 0)
-        TEST_ERROR
-
-    /* Try to receive copies for the two property lists */
-    if ((tcpl_id1 = H5Tget_create_plist(type_id1)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get property list\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to open non-existent dataset using dangling external link\n");
+#endif
 
-    if ((tcpl_id2 = H5Tget_create_plist(type_id2)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get property list\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        if (H5Dopen2(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    opened non-existent dataset in other file using dangling external link!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
-    /* Now close the property lists and datatypes and see if we can still retrieve copies of
-     * the property lists upon opening (instead of creating) a datatype
-     */
-    if (H5Pclose(tcpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(tcpl_id2) < 0)
-        TEST_ERROR
-    if (H5Tclose(type_id1) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
-    if (H5Tclose(type_id2) < 0)
+
+    for (i = 0; i < EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_dspace = H5Screate_simple(EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((type_id1 = H5Topen2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open datatype\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating target dataset for dangling external link\n");
+#endif
 
-    if ((type_id2 = H5Topen2(group_id, DATATYPE_PROPERTY_LIST_TEST_DATATYPE_NAME2, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(ext_file_id, EXTERNAL_LINK_TEST_DANGLING_DSET_NAME, dset_dtype, dset_dspace,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open datatype\n");
+        printf("    couldn't create dataset in external file\n");
         goto error;
     }
 
-    if ((tcpl_id1 = H5Tget_create_plist(type_id1)) < 0) {
-        H5_FAILED();
-        printf("    couldn't get property list\n");
-        goto error;
-    }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
-    if ((tcpl_id2 = H5Tget_create_plist(type_id2)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Re-attempting to open dataset using external link\n");
+#endif
+
+    if ((dset_id = H5Dopen2(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't get property list\n");
+        printf("    couldn't open dataset in external file\n");
         goto error;
     }
 
-    if (H5Pclose(tcpl_id1) < 0)
-        TEST_ERROR
-    if (H5Pclose(tcpl_id2) < 0)
+    if (H5Sclose(dset_dspace) < 0)
         TEST_ERROR
-    if (H5Tclose(type_id1) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Tclose(type_id2) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -10756,6 +15037,8 @@ test_datatype_property_lists(void)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
+    if (H5Fclose(ext_file_id) < 0)
+        TEST_ERROR
     if (H5rest_term() < 0)
         TEST_ERROR
 
@@ -10766,14 +15049,14 @@ test_datatype_property_lists(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(tcpl_id1);
-        H5Pclose(tcpl_id2);
-        H5Tclose(type_id1);
-        H5Tclose(type_id2);
+        H5Sclose(dset_dspace);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5Fclose(ext_file_id);
         H5rest_term();
     }
     H5E_END_TRY;
@@ -10781,20 +15064,16 @@ error:
     return 1;
 }
 
-/*****************************************************
- *                                                   *
- *                Plugin Link tests                  *
- *                                                   *
- *****************************************************/
-
 static int
-test_create_hard_link(void)
+test_create_user_defined_link(void)
 {
-    htri_t link_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1;
+    ssize_t udata_size;
+    htri_t  link_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    char    udata[UD_LINK_TEST_UDATA_MAX_SIZE];
 
-    TESTING("create hard link")
+    TESTING("create user-defined link")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10816,31 +15095,38 @@ test_create_hard_link(void)
         goto error;
     }
 
+    if ((udata_size = snprintf(udata, UD_LINK_TEST_UDATA_MAX_SIZE, "udata")) < 0)
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a hard link\n");
+    puts("Creating user-defined link\n");
 #endif
 
-    if (H5Lcreate_hard(file_id, "/" DATASET_TEST_GROUP_NAME "/" DATASET_SMALL_WRITE_TEST_HYPERSLAB_DSET_NAME,
-                       container_group, HARD_LINK_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create hard link\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        if (H5Lcreate_ud(container_group, UD_LINK_TEST_LINK_NAME, H5L_TYPE_HARD, udata, (size_t)udata_size,
+                         H5P_DEFAULT, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
 #ifdef RV_CONNECTOR_DEBUG
     puts("Verifying that the link exists\n");
 #endif
 
     /* Verify the link has been created */
-    if ((link_exists = H5Lexists(container_group, HARD_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(container_group, UD_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (link_exists) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    link existed!\n");
         goto error;
     }
 
@@ -10870,23 +15156,23 @@ error:
     return 1;
 }
 
-/*
- * The following two tests ensure that behavior is correct when using
- * the H5L_SAME_LOC macro for H5Lcreate_hard().
- */
 static int
-test_create_hard_link_same_loc(void)
+test_delete_link(void)
 {
-    hsize_t dims[H5L_SAME_LOC_TEST_DSET_SPACE_RANK];
+    hsize_t dims[LINK_DELETE_TEST_DSET_SPACE_RANK];
     size_t  i;
     htri_t  link_exists;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   space_id   = -1;
+    hid_t   dset_id = -1, dset_id2 = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
+    char    ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("create hard link with H5L_SAME_LOC")
+    TESTING("delete link")
+
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -10908,208 +15194,261 @@ test_create_hard_link_same_loc(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, H5L_SAME_LOC_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, LINK_DELETE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create group\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    memset(dims, 0, sizeof(dims));
-    for (i = 0; i < H5L_SAME_LOC_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((space_id = H5Screate_simple(H5L_SAME_LOC_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    for (i = 0; i < LINK_DELETE_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_dspace = H5Screate_simple(LINK_DELETE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, H5L_SAME_LOC_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
+    if ((dset_id = H5Dcreate2(group_id, LINK_DELETE_TEST_DSET_NAME1, dset_dtype, dset_dspace, H5P_DEFAULT,
                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create first hard link\n");
         goto error;
     }
 
-/* Library functionality for this part of the test is broken */
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Calling H5Lcreate_hard with H5L_SAME_LOC as first parameter\n");
-#endif
+    if ((dset_id2 = H5Dcreate2(group_id, LINK_DELETE_TEST_DSET_NAME2, dset_dtype, dset_dspace, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create second hard link\n");
+        goto error;
+    }
 
-    if (H5Lcreate_hard(H5L_SAME_LOC, H5L_SAME_LOC_TEST_DSET_NAME, group_id, H5L_SAME_LOC_TEST_LINK_NAME1,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_DELETE_TEST_SUBGROUP_NAME
+                       "/" LINK_DELETE_TEST_DSET_NAME1,
+                       group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create first link\n");
+        printf("    couldn't create first soft link\n");
         goto error;
     }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, H5L_SAME_LOC_TEST_LINK_NAME1, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_DELETE_TEST_SUBGROUP_NAME
+                       "/" LINK_DELETE_TEST_DSET_NAME2,
+                       group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create second soft link\n");
+        goto error;
+    }
+
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create first external link\n");
+        goto error;
+    }
+
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2,
+                           H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create second external link\n");
+        goto error;
+    }
+
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if first hard link exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    first hard link did not exist\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Calling H5Lcreate_hard with H5L_SAME_LOC as second parameter\n");
-#endif
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if second hard link exists\n");
+        goto error;
+    }
 
-    if (H5Lcreate_hard(group_id, H5L_SAME_LOC_TEST_DSET_NAME, H5L_SAME_LOC, H5L_SAME_LOC_TEST_LINK_NAME2,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create second link\n");
+        printf("    second hard link did not exist\n");
         goto error;
     }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, H5L_SAME_LOC_TEST_LINK_NAME2, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't determine if first soft link exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    first soft link did not exist\n");
         goto error;
     }
 
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if second soft link exists\n");
+        goto error;
+    }
 
-    PASSED();
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    second soft link did not exist\n");
+        goto error;
+    }
 
-    return 0;
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if first external link exists\n");
+        goto error;
+    }
 
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(space_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    first external link did not exist\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    return 1;
-}
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if second external link exists\n");
+        goto error;
+    }
 
-static int
-test_create_soft_link_existing_relative(void)
-{
-    hsize_t dims[SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK];
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id     = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    second external link did not exist\n");
+        goto error;
+    }
 
-    TESTING("create soft link to existing object by relative path")
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Deleting links with H5Ldelete\n");
+#endif
 
-    if (H5rest_init() < 0)
-        TEST_ERROR
+    if (H5Ldelete(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't delete hard link using H5Ldelete\n");
+        goto error;
+    }
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+    if (H5Ldelete(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't delete soft link using H5Ldelete\n");
+        goto error;
+    }
+
+    if (H5Ldelete(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't delete external link using H5Ldelete\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Deleting links with H5Ldelete_by_idx\n");
+#endif
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+    }
+    H5E_END_TRY;
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that all links have been deleted\n");
+#endif
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Verify that all links have been deleted */
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't determine if first hard link exists\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if (link_exists) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    first hard link exists!\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_EXISTING_RELATIVE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't determine if second hard link exists\n");
         goto error;
     }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    for (i = 0; i < SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((dset_dspace = H5Screate_simple(SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    second hard link did not exist!\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_NAME, dset_dtype, dset_dspace,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't determine if first soft link exists\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+    if (link_exists) {
+        H5_FAILED();
+        printf("    first soft link exists!\n");
+        goto error;
+    }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating soft link with relative path value to an existing object\n");
-#endif
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if second soft link exists\n");
+        goto error;
+    }
 
-    if (H5Lcreate_soft(SOFT_LINK_EXISTING_RELATIVE_TEST_DSET_NAME, group_id,
-                       SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create soft link\n");
+        printf("    second soft link did not exist!\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if first external link exists\n");
+        goto error;
+    }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (link_exists) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    first external link exists!\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    couldn't determine if second external link exists\n");
         goto error;
     }
 
-    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_EXISTING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open dataset through the soft link\n");
+        printf("    second external link did not exist!\n");
         goto error;
     }
 
@@ -11119,6 +15458,8 @@ test_create_soft_link_existing_relative(void)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -11140,6 +15481,7 @@ error:
         H5Sclose(dset_dspace);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Dclose(dset_id2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -11152,13 +15494,18 @@ error:
 }
 
 static int
-test_create_soft_link_existing_absolute(void)
+test_copy_link(void)
 {
-    htri_t link_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1, root_id = -1;
+    hsize_t dims[COPY_LINK_TEST_DSET_SPACE_RANK];
+    size_t  i;
+    htri_t  link_exists;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   space_id   = -1;
 
-    TESTING("create soft link to existing object by absolute path")
+    TESTING("copy a link")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -11180,187 +15527,122 @@ test_create_soft_link_existing_absolute(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_EXISTING_ABSOLUTE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, COPY_LINK_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a soft link with absolute path value to an existing object\n");
-#endif
+    for (i = 0; i < COPY_LINK_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if (H5Lcreate_soft("/", group_id, SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) <
-        0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
+    if ((space_id = H5Screate_simple(COPY_LINK_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" LINK_TEST_GROUP_NAME "/" SOFT_LINK_EXISTING_ABSOLUTE_TEST_SUBGROUP_NAME
-                                 "/" SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME,
-                                 H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, COPY_LINK_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (!link_exists) {
+    /* Try to copy a hard link */
+    if (H5Lcreate_hard(group_id, COPY_LINK_TEST_DSET_NAME, group_id, COPY_LINK_TEST_HARD_LINK_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    couldn't create hard link\n");
         goto error;
     }
 
-    if ((root_id = H5Gopen2(group_id, SOFT_LINK_EXISTING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open object pointed to by soft link\n");
+        printf("    couldn't determine if hard link exists\n");
         goto error;
     }
 
-    if (H5Gclose(root_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Gclose(root_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    hard link did not exist\n");
+        goto error;
     }
-    H5E_END_TRY;
-
-    return 1;
-}
-
-static int
-test_create_soft_link_dangling_relative(void)
-{
-    hsize_t dims[SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK];
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id     = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
-
-    TESTING("create dangling soft link to object by relative path")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to copy a hard link to another location\n");
+#endif
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Copy the link */
+    if (H5Lcopy(group_id, COPY_LINK_TEST_HARD_LINK_NAME, group_id, COPY_LINK_TEST_HARD_LINK_COPY_NAME,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't copy hard link\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    /* Verify the link has been copied */
+    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_HARD_LINK_COPY_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't determine if hard link copy exists\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_DANGLING_RELATIVE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    hard link copy did not exist\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a dangling soft link with relative path value\n");
-#endif
-
-    if (H5Lcreate_soft(SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_NAME, group_id,
-                       SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    /* Try to copy a soft link */
+    if (H5Lcreate_soft(COPY_LINK_TEST_SOFT_LINK_TARGET_PATH, group_id, COPY_LINK_TEST_SOFT_LINK_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
         printf("    couldn't create soft link\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
-
     /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't determine if soft link exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    soft link did not exist\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Dopen2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    opened target of dangling link!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    for (i = 0; i < SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to copy a soft link to another location\n");
+#endif
 
-    if ((dset_dspace = H5Screate_simple(SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    /* Copy the link */
+    if (H5Lcopy(group_id, COPY_LINK_TEST_SOFT_LINK_NAME, group_id, COPY_LINK_TEST_SOFT_LINK_COPY_NAME,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't copy soft link\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_DSET_NAME, dset_dtype, dset_dspace,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Verify the link has been copied */
+    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_SOFT_LINK_COPY_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't determine if soft link copy exists\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_DANGLING_RELATIVE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open dataset pointed to by soft link\n");
+        printf("    soft link copy did not exist\n");
         goto error;
     }
 
-    if (H5Sclose(dset_dspace) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
@@ -11384,7 +15666,7 @@ test_create_soft_link_dangling_relative(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(dset_dspace);
+        H5Sclose(space_id);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
         H5Gclose(group_id);
@@ -11399,18 +15681,18 @@ error:
 }
 
 static int
-test_create_soft_link_dangling_absolute(void)
+test_move_link(void)
 {
-    hsize_t dims[SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK];
+    hsize_t dims[MOVE_LINK_TEST_DSET_SPACE_RANK];
     size_t  i;
     htri_t  link_exists;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id     = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   space_id   = -1;
 
-    TESTING("create dangling soft link to object by absolute path")
+    TESTING("move a link")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -11432,200 +15714,172 @@ test_create_soft_link_dangling_absolute(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, SOFT_LINK_DANGLING_ABSOLUTE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, MOVE_LINK_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating dangling soft link with absolute path value\n");
-#endif
+    for (i = 0; i < MOVE_LINK_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" SOFT_LINK_DANGLING_ABSOLUTE_TEST_SUBGROUP_NAME
-                       "/" SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_NAME,
-                       group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if ((space_id = H5Screate_simple(MOVE_LINK_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, MOVE_LINK_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create soft link\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
+    /* Try to move a hard link */
+    if (H5Lcreate_hard(group_id, MOVE_LINK_TEST_DSET_NAME, file_id, MOVE_LINK_TEST_HARD_LINK_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create hard link\n");
+        goto error;
+    }
 
     /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't determine if hard link exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    hard link did not exist\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Dopen2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    opened target of dangling link!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    for (i = 0; i < SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((dset_dspace = H5Screate_simple(SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to move a hard link to another location\n");
+#endif
 
-    if ((dset_id = H5Dcreate2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_DSET_NAME, dset_dtype, dset_dspace,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Move the link */
+    if (H5Lmove(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, group_id, MOVE_LINK_TEST_HARD_LINK_NAME,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't move hard link\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dopen2(group_id, SOFT_LINK_DANGLING_ABSOLUTE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    /* Verify the link has been moved */
+    if ((link_exists = H5Lexists(group_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset pointed to by soft link\n");
+        printf("    couldn't determine if hard link exists\n");
         goto error;
     }
 
-    if (H5Sclose(dset_dspace) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(dset_dspace);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    hard link did not exist\n");
+        goto error;
     }
-    H5E_END_TRY;
-
-    return 1;
-}
-
-static int
-test_create_external_link(void)
-{
-    htri_t link_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1;
-    hid_t  root_id = -1;
-    char   ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("create external link to existing object")
+    /* Verify the old link is gone */
+    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if old hard link exists\n");
+        goto error;
+    }
 
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
+    if (link_exists) {
+        H5_FAILED();
+        printf("    old hard link exists\n");
+        goto error;
+    }
 
-    if (H5rest_init() < 0)
-        TEST_ERROR
+    /* Try to move a soft link */
+    if (H5Lcreate_soft(MOVE_LINK_TEST_SOFT_LINK_TARGET_PATH, file_id, MOVE_LINK_TEST_SOFT_LINK_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create soft link\n");
+        goto error;
+    }
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+    /* Verify the link has been created */
+    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if soft link exists\n");
+        goto error;
+    }
 
-    if ((file_id = H5Fcreate(ext_link_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create file for external link to reference\n");
+        printf("    soft link did not exist\n");
         goto error;
     }
 
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Attempting to move a soft link to another location\n");
+#endif
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    /* Move the link */
+    if (H5Lmove(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, group_id, MOVE_LINK_TEST_SOFT_LINK_NAME,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't move soft link\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    /* Verify the link has been moved */
+    if ((link_exists = H5Lexists(group_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    couldn't determine if soft link exists\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, EXTERNAL_LINK_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    soft link did not exist\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating an external link to root group of other file\n");
-#endif
-
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
+    /* Verify the old link is gone */
+    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create external link\n");
+        printf("    couldn't determine if old soft link exists\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
+    if (link_exists) {
+        H5_FAILED();
+        printf("    old soft link exists\n");
+        goto error;
+    }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    /* Moving a link onto itself, named by a different path, must leave it in place */
+    if (H5Lmove(group_id, MOVE_LINK_TEST_HARD_LINK_NAME, file_id, MOVE_LINK_TEST_HARD_LINK_ABS_PATH,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't move hard link onto itself\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((link_exists = H5Lexists(group_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    couldn't determine if hard link exists\n");
         goto error;
     }
 
-    if ((root_id = H5Gopen2(group_id, EXTERNAL_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't open root group of other file using external link\n");
+        printf("    hard link moved onto itself was deleted\n");
         goto error;
     }
 
-    if (H5Gclose(root_id) < 0)
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -11645,7 +15899,9 @@ test_create_external_link(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Gclose(root_id);
+        H5Sclose(space_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -11658,19 +15914,20 @@ error:
 }
 
 static int
-test_create_dangling_external_link(void)
+test_get_link_info(void)
 {
-    hsize_t dims[EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK];
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, ext_file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id     = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
-    char    ext_link_filename[FILENAME_MAX_LENGTH];
+    H5L_info2_t link_info;
+    hsize_t     dims[GET_LINK_INFO_TEST_DSET_SPACE_RANK];
+    size_t      i;
+    htri_t      link_exists;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    hid_t       dset_id     = -1;
+    hid_t       dset_dtype  = -1;
+    hid_t       dset_dspace = -1;
+    char        ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("create dangling external link")
+    TESTING("get link info")
 
     snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
              EXTERNAL_LINK_TEST_FILE_NAME);
@@ -11683,12 +15940,6 @@ test_create_dangling_external_link(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((ext_file_id = H5Fcreate(ext_link_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create file for external link to reference\n");
-        goto error;
-    }
-
     if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't open file\n");
@@ -11701,195 +15952,211 @@ test_create_dangling_external_link(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, EXTERNAL_LINK_TEST_DANGLING_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, GET_LINK_INFO_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a dangling external link to a dataset in other file\n");
-#endif
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
-    if (H5Lcreate_external(ext_link_filename, "/" EXTERNAL_LINK_TEST_DANGLING_DSET_NAME, group_id,
-                           EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    for (i = 0; i < GET_LINK_INFO_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_dspace = H5Screate_simple(GET_LINK_INFO_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, GET_LINK_INFO_TEST_DSET_NAME, dset_dtype, dset_dspace, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dangling external link\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
-#endif
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME
+                       "/" GET_LINK_INFO_TEST_DSET_NAME,
+                       group_id, GET_LINK_INFO_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create soft link\n");
+        goto error;
+    }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create external link\n");
         goto error;
     }
 
-    if (!link_exists) {
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    couldn't determine if hard link exists\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to open non-existent dataset using dangling external link\n");
-#endif
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    hard link did not exist\n");
+        goto error;
+    }
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Dopen2(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    opened non-existent dataset in other file using dangling external link!\n");
-            goto error;
-        }
+    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if soft link exists\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    soft link did not exist\n");
+        goto error;
+    }
 
-    for (i = 0; i < EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if external link exists\n");
+        goto error;
+    }
 
-    if ((dset_dspace = H5Screate_simple(EXTERNAL_LINK_TEST_DANGLING_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    external link did not exist\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating target dataset for dangling external link\n");
+    puts("Retrieving hard link info with H5Lget_info\n");
 #endif
 
-    if ((dset_id = H5Dcreate2(ext_file_id, EXTERNAL_LINK_TEST_DANGLING_DSET_NAME, dset_dtype, dset_dspace,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    memset(&link_info, 0, sizeof(link_info));
+
+    if (H5Lget_info2(group_id, GET_LINK_INFO_TEST_DSET_NAME, &link_info, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset in external file\n");
+        printf("    couldn't get hard link info\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+    if (link_info.type != H5L_TYPE_HARD) {
+        H5_FAILED();
+        printf("    incorrect link type returned\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Re-attempting to open dataset using external link\n");
+    puts("Retrieving soft link info with H5Lget_info\n");
 #endif
 
-    if ((dset_id = H5Dopen2(group_id, EXTERNAL_LINK_TEST_DANGLING_LINK_NAME, H5P_DEFAULT)) < 0) {
+    memset(&link_info, 0, sizeof(link_info));
+
+    if (H5Lget_info2(file_id,
+                     "/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME
+                     "/" GET_LINK_INFO_TEST_SOFT_LINK_NAME,
+                     &link_info, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset in external file\n");
+        printf("    couldn't get soft link info\n");
         goto error;
     }
 
-    if (H5Sclose(dset_dspace) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(ext_file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Sclose(dset_dspace);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5Fclose(ext_file_id);
-        H5rest_term();
+    if (link_info.type != H5L_TYPE_SOFT) {
+        H5_FAILED();
+        printf("    incorrect link type returned\n");
+        goto error;
     }
-    H5E_END_TRY;
-
-    return 1;
-}
-
-static int
-test_create_user_defined_link(void)
-{
-    ssize_t udata_size;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    char    udata[UD_LINK_TEST_UDATA_MAX_SIZE];
-
-    TESTING("create user-defined link")
 
-    if (H5rest_init() < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving external link info with H5Lget_info\n");
+#endif
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+    memset(&link_info, 0, sizeof(link_info));
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if (H5Lget_info2(group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't get external link info\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if (link_info.type != H5L_TYPE_EXTERNAL) {
         H5_FAILED();
-        printf("    couldn't open container group\n");
+        printf("    incorrect link type returned\n");
         goto error;
     }
 
-    if ((udata_size = snprintf(udata, UD_LINK_TEST_UDATA_MAX_SIZE, "udata")) < 0)
-        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Retrieving hard link info with H5Lget_info_by_idx\n");
+#endif
+
+        memset(&link_info, 0, sizeof(link_info));
+
+        if (H5Lget_info_by_idx2(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, &link_info, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+#if 0
+        if (link_info.type != H5L_TYPE_HARD) {
+            H5_FAILED();
+            printf("    incorrect link type returned\n");
+            goto error;
+        }
+#endif
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating user-defined link\n");
+        puts("Retrieving soft link info with H5Lget_info_by_idx\n");
 #endif
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Lcreate_ud(container_group, UD_LINK_TEST_LINK_NAME, H5L_TYPE_HARD, udata, (size_t)udata_size,
-                         H5P_DEFAULT, H5P_DEFAULT) >= 0) {
+        memset(&link_info, 0, sizeof(link_info));
+
+        if (H5Lget_info_by_idx2(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME,
+                                H5_INDEX_CRT_ORDER, H5_ITER_DEC, 1, &link_info, H5P_DEFAULT) >= 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded\n");
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+#if 0
+        if (link_info.type != H5L_TYPE_SOFT) {
+            H5_FAILED();
+            printf("    incorrect link type returned\n");
+            goto error;
+        }
+#endif
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Retrieving external link info with H5Lget_info_by_idx\n");
+#endif
+
+        memset(&link_info, 0, sizeof(link_info));
+
+        if (H5Lget_info_by_idx2(group_id, ".", H5_INDEX_NAME, H5_ITER_DEC, 2, &link_info, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+#if 0
+        if (link_info.type != H5L_TYPE_EXTERNAL) {
+            H5_FAILED();
+            printf("    incorrect link type returned\n");
             goto error;
         }
-    }
-    H5E_END_TRY;
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that the link exists\n");
 #endif
-
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(container_group, UD_LINK_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
-
-    if (link_exists) {
-        H5_FAILED();
-        printf("    link existed!\n");
-        goto error;
     }
+    H5E_END_TRY;
 
+    if (H5Sclose(dset_dspace) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -11906,6 +16173,10 @@ test_create_user_defined_link(void)
 error:
     H5E_BEGIN_TRY
     {
+        H5Sclose(dset_dspace);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -11917,22 +16188,21 @@ error:
 }
 
 static int
-test_delete_link(void)
+test_get_link_name_by_index(void)
 {
-    hsize_t dims[LINK_DELETE_TEST_DSET_SPACE_RANK];
+    hsize_t dims[GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK];
+    ssize_t ret;
     size_t  i;
     htri_t  link_exists;
+    size_t  link_name_buf_size = 0;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id = -1, dset_id2 = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
-    char    ext_link_filename[FILENAME_MAX_LENGTH];
-
-    TESTING("delete link")
+    hid_t   dset_id       = -1;
+    hid_t   dset_dtype    = -1;
+    hid_t   dset_dspace   = -1;
+    char   *link_name_buf = NULL;
 
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
+    TESTING("get link name by index")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -11954,8 +16224,8 @@ test_delete_link(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, LINK_DELETE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
@@ -11964,253 +16234,304 @@ test_delete_link(void)
     if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    for (i = 0; i < LINK_DELETE_TEST_DSET_SPACE_RANK; i++)
+    for (i = 0; i < GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((dset_dspace = H5Screate_simple(LINK_DELETE_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dset_dspace = H5Screate_simple(GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, LINK_DELETE_TEST_DSET_NAME1, dset_dtype, dset_dspace, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, dset_dtype, dset_dspace,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create first hard link\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if ((dset_id2 = H5Dcreate2(group_id, LINK_DELETE_TEST_DSET_NAME2, dset_dtype, dset_dspace, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Verify that the hard link exists */
+    if ((link_exists = H5Lexists(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create second hard link\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_DELETE_TEST_SUBGROUP_NAME
-                       "/" LINK_DELETE_TEST_DSET_NAME1,
-                       group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create first soft link\n");
+        printf("    link '%s' did not exist\n", GET_LINK_NAME_BY_IDX_TEST_DSET_NAME);
         goto error;
     }
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_DELETE_TEST_SUBGROUP_NAME
-                       "/" LINK_DELETE_TEST_DSET_NAME2,
-                       group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create second soft link\n");
-        goto error;
-    }
+    /* Verify that retrieving the link name by index works with hard links; the dataset hard link
+     * should be the only link in the group currently.
+     */
 
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create first external link\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name of hard link to dataset\n");
+    puts("Retrieving size of link name\n");
+#endif
 
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2,
-                           H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if ((ret = H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, NULL, link_name_buf_size,
+                                  H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create second external link\n");
+        printf("    unable to retrieve link name size\n");
         goto error;
     }
 
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if first hard link exists\n");
-        goto error;
-    }
+    link_name_buf_size = (size_t)ret;
+    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+        TEST_ERROR
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    first hard link did not exist\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name\n");
+#endif
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
+    if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, link_name_buf,
+                           link_name_buf_size + 1, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if second hard link exists\n");
+        printf("    unable to retrieve link name\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME)) {
         H5_FAILED();
-        printf("    second hard link did not exist\n");
+        printf("    link name '%s' did not match '%s'\n", link_name_buf, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME);
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if first soft link exists\n");
-        goto error;
+    if (link_name_buf) {
+        free(link_name_buf);
+        link_name_buf = NULL;
     }
 
-    if (!link_exists) {
+    /*
+     * Delete the dataset hard link so the next tests won't be thrown off
+     */
+    if (H5Ldelete(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    first soft link did not exist\n");
+        printf("    couldn't delete hard link\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second soft link exists\n");
-        goto error;
-    }
+    /* Create 10 soft links for testing with; create links backwards to make sure sorting by creation order
+     * doesn't look the same as sorting by link name */
+    for (i = GET_LINK_NAME_BY_IDX_TEST_NUM_LINKS - 1; i >= 0; i--) {
+        char temp_link_name[GET_LINK_NAME_BY_IDX_TEST_MAX_LINK_NAME_LENGTH];
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    second soft link did not exist\n");
-        goto error;
-    }
+        snprintf(temp_link_name, GET_LINK_NAME_BY_IDX_TEST_MAX_LINK_NAME_LENGTH, "link%zu", i);
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if first external link exists\n");
-        goto error;
-    }
+        if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, group_id,
+                           temp_link_name, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to create soft link '%s'\n", temp_link_name);
+            goto error;
+        }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    first external link did not exist\n");
-        goto error;
-    }
+        if ((link_exists = H5Lexists(group_id, temp_link_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't determine if link exists\n");
+            goto error;
+        }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second external link exists\n");
-        goto error;
+        if (!link_exists) {
+            H5_FAILED();
+            printf("    link '%s' did not exist\n", temp_link_name);
+            goto error;
+        }
+
+        if (i == 0)
+            break;
     }
 
-    if (!link_exists) {
+    /*
+     * A variety of ways of reaching the same group are used below in order to test the
+     * capability of the function to correctly find the specified group by ID and path.
+     */
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name by index number; sorted by link name in increasing order\n");
+    puts("Retrieving size of link name\n");
+#endif
+
+    if ((ret = H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                                  GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_IDX, NULL, link_name_buf_size,
+                                  H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    second external link did not exist\n");
+        printf("    unable to retrieve link name size\n");
         goto error;
     }
 
+    link_name_buf_size = (size_t)ret;
+    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Deleting links with H5Ldelete\n");
+    puts("Retrieving link name\n");
 #endif
 
-    if (H5Ldelete(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT) < 0) {
+    if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                           GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_IDX, link_name_buf, link_name_buf_size + 1,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't delete hard link using H5Ldelete\n");
+        printf("    unable to retrieve link name\n");
         goto error;
     }
 
-    if (H5Ldelete(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT) < 0) {
+    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_NAME)) {
         H5_FAILED();
-        printf("    couldn't delete soft link using H5Ldelete\n");
+        printf("    link name '%s' did not match '%s'\n", link_name_buf,
+               GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_NAME);
         goto error;
     }
 
-    if (H5Ldelete(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't delete external link using H5Ldelete\n");
-        goto error;
+    if (link_name_buf) {
+        free(link_name_buf);
+        link_name_buf = NULL;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Deleting links with H5Ldelete_by_idx\n");
+    puts("Retrieving link name by index number; sorted by link name in decreasing order\n");
+    puts("Retrieving size of link name\n");
 #endif
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+    if ((ret =
+             H5Lget_name_by_idx(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
+                                H5_INDEX_NAME, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_IDX, NULL,
+                                link_name_buf_size, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    unable to retrieve link name size\n");
+        goto error;
     }
-    H5E_END_TRY;
+
+    link_name_buf_size = (size_t)ret;
+    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that all links have been deleted\n");
+    puts("Retrieving link name\n");
 #endif
 
-    /* Verify that all links have been deleted */
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME1, H5P_DEFAULT)) < 0) {
+    if (H5Lget_name_by_idx(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
+                           H5_INDEX_NAME, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_IDX,
+                           link_name_buf, link_name_buf_size + 1, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if first hard link exists\n");
+        printf("    unable to retrieve link name\n");
         goto error;
     }
 
-    if (link_exists) {
+    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_NAME)) {
         H5_FAILED();
-        printf("    first hard link exists!\n");
+        printf("    link name '%s' did not match '%s'\n", link_name_buf,
+               GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_NAME);
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second hard link exists\n");
-        goto error;
+    if (link_name_buf) {
+        free(link_name_buf);
+        link_name_buf = NULL;
     }
 
-    if (!link_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name by index number; sorted by link creation order in increasing order\n");
+    puts("Retrieving size of link name\n");
+#endif
+
+    if ((ret = H5Lget_name_by_idx(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
+                                  H5_INDEX_CRT_ORDER, H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_IDX,
+                                  NULL, link_name_buf_size, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    second hard link did not exist!\n");
+        printf("    unable to retrieve link name size\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    link_name_buf_size = (size_t)ret;
+    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name\n");
+#endif
+
+    if (H5Lget_name_by_idx(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, H5_INDEX_CRT_ORDER,
+                           H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_IDX, link_name_buf,
+                           link_name_buf_size + 1, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if first soft link exists\n");
+        printf("    unable to retrieve link name\n");
         goto error;
     }
 
-    if (link_exists) {
+    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_NAME)) {
         H5_FAILED();
-        printf("    first soft link exists!\n");
+        printf("    link name '%s' did not match '%s'\n", link_name_buf,
+               GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_NAME);
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_SOFT_LINK_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second soft link exists\n");
-        goto error;
+    if (link_name_buf) {
+        free(link_name_buf);
+        link_name_buf = NULL;
     }
 
-    if (!link_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name by index number; sorted by link creation order in decreasing order\n");
+    puts("Retrieving size of link name\n");
+#endif
+
+    if ((ret = H5Lget_name_by_idx(group_id,
+                                  "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
+                                  H5_INDEX_CRT_ORDER, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_IDX,
+                                  NULL, link_name_buf_size, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    second soft link did not exist!\n");
+        printf("    unable to retrieve link name size\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME, H5P_DEFAULT)) < 0) {
+    link_name_buf_size = (size_t)ret;
+    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving link name\n");
+#endif
+
+    if (H5Lget_name_by_idx(group_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_IDX,
+                           link_name_buf, link_name_buf_size + 1, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if first external link exists\n");
+        printf("    unable to retrieve link name\n");
         goto error;
     }
 
-    if (link_exists) {
+    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_NAME)) {
         H5_FAILED();
-        printf("    first external link exists!\n");
+        printf("    link name '%s' did not match '%s'\n", link_name_buf,
+               GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_NAME);
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_DELETE_TEST_EXTERNAL_LINK_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second external link exists\n");
-        goto error;
+    if (link_name_buf) {
+        free(link_name_buf);
+        link_name_buf = NULL;
     }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    second external link did not exist!\n");
-        goto error;
+    /* Check to make sure that using an index number beyond the number of links will fail */
+    H5E_BEGIN_TRY
+    {
+        link_name_buf_size = 256;
+        if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+            TEST_ERROR
+
+        if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_NUM_LINKS,
+                               link_name_buf, link_name_buf_size, H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    using an index number beyond the number of links didn't fail!\n");
+            goto error;
+        }
+
+        if (link_name_buf) {
+            free(link_name_buf);
+            link_name_buf = NULL;
+        }
     }
+    H5E_END_TRY;
 
     if (H5Sclose(dset_dspace) < 0)
         TEST_ERROR
@@ -12218,8 +16539,6 @@ test_delete_link(void)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
-        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -12238,10 +16557,11 @@ test_delete_link(void)
 error:
     H5E_BEGIN_TRY
     {
+        if (link_name_buf)
+            free(link_name_buf);
         H5Sclose(dset_dspace);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
-        H5Dclose(dset_id2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -12254,18 +16574,23 @@ error:
 }
 
 static int
-test_copy_link(void)
+test_get_link_val(void)
 {
-    hsize_t dims[COPY_LINK_TEST_DSET_SPACE_RANK];
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   space_id   = -1;
+    H5L_info2_t link_info;
+    const char *ext_link_filepath;
+    const char *ext_link_val;
+    unsigned    ext_link_flags;
+    htri_t      link_exists;
+    size_t      link_val_buf_size;
+    char       *link_val_buf = NULL;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    char        ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("copy a link")
+    TESTING("get link value")
+
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -12287,139 +16612,248 @@ test_copy_link(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, COPY_LINK_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, GET_LINK_VAL_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create group\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    for (i = 0; i < COPY_LINK_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME, group_id,
+                       GET_LINK_VAL_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create soft link\n");
+        goto error;
+    }
 
-    if ((space_id = H5Screate_simple(COPY_LINK_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create external link\n");
+        goto error;
+    }
+
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link did not exist\n");
+        goto error;
+    }
+
+    if ((link_exists = H5Lexists(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if external link exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    external link did not exist\n");
+        goto error;
+    }
+
+    memset(&link_info, 0, sizeof(link_info));
+
+    if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't get soft link info\n");
+        goto error;
+    }
+
+    if (link_info.type != H5L_TYPE_SOFT) {
+        H5_FAILED();
+        printf("    incorrect link type returned\n");
+        goto error;
+    }
+
+    link_val_buf_size = link_info.u.val_size;
+    if (NULL == (link_val_buf = (char *)malloc(link_val_buf_size)))
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving value of soft link with H5Lget_val\n");
+#endif
+
+    if (H5Lget_val(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, link_val_buf, link_val_buf_size, H5P_DEFAULT) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't get soft link val\n");
+        goto error;
+    }
+
+    if (strcmp(link_val_buf, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME)) {
+        H5_FAILED();
+        printf("    soft link value did not match\n");
+        goto error;
+    }
+
+    memset(&link_info, 0, sizeof(link_info));
+
+    if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't get external link info\n");
+        goto error;
+    }
+
+    if (link_info.type != H5L_TYPE_EXTERNAL) {
+        H5_FAILED();
+        printf("    incorrect link type returned\n");
+        goto error;
+    }
+
+    if (link_info.u.val_size > link_val_buf_size) {
+        char *tmp_realloc;
+
+        link_val_buf_size *= 2;
+
+        if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
+            TEST_ERROR
+        link_val_buf = tmp_realloc;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving value of external link with H5Lget_val\n");
+#endif
 
-    if ((dset_id = H5Dcreate2(group_id, COPY_LINK_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5Lget_val(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, link_val_buf, link_val_buf_size, H5P_DEFAULT) <
+        0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't get external link val\n");
         goto error;
     }
 
-    /* Try to copy a hard link */
-    if (H5Lcreate_hard(group_id, COPY_LINK_TEST_DSET_NAME, group_id, COPY_LINK_TEST_HARD_LINK_NAME,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Lunpack_elink_val(link_val_buf, link_val_buf_size, &ext_link_flags, &ext_link_filepath,
+                            &ext_link_val) < 0) {
         H5_FAILED();
-        printf("    couldn't create hard link\n");
+        printf("    couldn't unpack external link value buffer\n");
         goto error;
     }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (strcmp(ext_link_filepath, ext_link_filename)) {
         H5_FAILED();
-        printf("    couldn't determine if hard link exists\n");
+        printf("    external link target file did not match\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (strcmp(ext_link_val, "/")) {
         H5_FAILED();
-        printf("    hard link did not exist\n");
+        printf("    external link value did not match\n");
         goto error;
     }
 
+    H5E_BEGIN_TRY
+    {
+        memset(&link_info, 0, sizeof(link_info));
+
+        if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    couldn't get soft link info\n");
+            goto error;
+        }
+
+        if (link_info.type != H5L_TYPE_SOFT) {
+            H5_FAILED();
+            printf("    incorrect link type returned\n");
+            goto error;
+        }
+
+        if (link_info.u.val_size > link_val_buf_size) {
+            char *tmp_realloc;
+
+            link_val_buf_size *= 2;
+
+            if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
+                TEST_ERROR
+            link_val_buf = tmp_realloc;
+        }
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to copy a hard link to another location\n");
+        puts("Retrieving value of soft link with H5Lget_val_by_idx\n");
 #endif
 
-    /* Copy the link */
-    H5E_BEGIN_TRY
-    {
-        if (H5Lcopy(group_id, COPY_LINK_TEST_HARD_LINK_NAME, group_id, COPY_LINK_TEST_HARD_LINK_COPY_NAME,
-                    H5P_DEFAULT, H5P_DEFAULT) >= 0) {
+        if (H5Lget_val_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 0, link_val_buf,
+                              link_val_buf_size, H5P_DEFAULT) >= 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded\n");
+            printf("    unsupported API succeeded!\n");
             goto error;
         }
-    }
-    H5E_END_TRY;
 
 #if 0
-    /* Verify the link has been copied */
-    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_HARD_LINK_COPY_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if hard link copy exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    hard link copy did not exist\n");
-        goto error;
-    }
+        if (strcmp(link_val_buf, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME)) {
+            H5_FAILED();
+            printf("    soft link value did not match\n");
+            goto error;
+        }
 #endif
 
-    /* Try to copy a soft link */
-    if (H5Lcreate_soft(COPY_LINK_TEST_SOFT_LINK_TARGET_PATH, group_id, COPY_LINK_TEST_SOFT_LINK_NAME,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
+        memset(&link_info, 0, sizeof(link_info));
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if soft link exists\n");
-        goto error;
-    }
+        if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    couldn't get external link info\n");
+            goto error;
+        }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    soft link did not exist\n");
-        goto error;
-    }
+        if (link_info.type != H5L_TYPE_EXTERNAL) {
+            H5_FAILED();
+            printf("    incorrect link type returned\n");
+            goto error;
+        }
+
+        if (link_info.u.val_size > link_val_buf_size) {
+            char *tmp_realloc;
+
+            link_val_buf_size *= 2;
+
+            if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
+                TEST_ERROR
+            link_val_buf = tmp_realloc;
+        }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to copy a soft link to another location\n");
+        puts("Retrieving value of external link with H5Lget_val_by_idx\n");
 #endif
 
-    /* Copy the link */
-    H5E_BEGIN_TRY
-    {
-        if (H5Lcopy(group_id, COPY_LINK_TEST_SOFT_LINK_NAME, group_id, COPY_LINK_TEST_SOFT_LINK_COPY_NAME,
-                    H5P_DEFAULT, H5P_DEFAULT) >= 0) {
+        if (H5Lget_val_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 0, link_val_buf,
+                              link_val_buf_size, H5P_DEFAULT) >= 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded\n");
+            printf("    unsupported API succeeded!\n");
             goto error;
         }
-    }
-    H5E_END_TRY;
 
 #if 0
-    /* Verify the link has been copied */
-    if ((link_exists = H5Lexists(group_id, COPY_LINK_TEST_SOFT_LINK_COPY_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if soft link copy exists\n");
-        goto error;
+        if (H5Lunpack_elink_val(link_val_buf, link_val_buf_size, &ext_link_flags, &ext_link_filename, &ext_link_val) < 0) {
+            H5_FAILED();
+            printf("    couldn't unpack external link value buffer\n");
+            goto error;
+        }
+
+        if (strcmp(ext_link_filename, ext_link_filename)) {
+            H5_FAILED();
+            printf("    external link target file did not match\n");
+            goto error;
+        }
+
+        if (strcmp(ext_link_val, "/")) {
+            H5_FAILED();
+            printf("    external link value did not match\n");
+            goto error;
+        }
+#endif
     }
+    H5E_END_TRY;
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    soft link copy did not exist\n");
-        goto error;
+    if (link_val_buf) {
+        free(link_val_buf);
+        link_val_buf = NULL;
     }
-#endif
 
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -12438,9 +16872,8 @@ test_copy_link(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
+        if (link_val_buf)
+            free(link_val_buf);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -12453,18 +16886,24 @@ error:
 }
 
 static int
-test_move_link(void)
+test_link_iterate(void)
 {
-    hsize_t dims[MOVE_LINK_TEST_DSET_SPACE_RANK];
+    hsize_t dims[LINK_ITER_TEST_DSET_SPACE_RANK];
+    hsize_t saved_idx = 0;
     size_t  i;
     htri_t  link_exists;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   space_id   = -1;
+    hid_t   dset_id     = -1;
+    hid_t   dset_dtype  = -1;
+    hid_t   dset_dspace = -1;
+    int     halted      = 0;
+    char    ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("move a link")
+    TESTING("link iteration")
+
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -12486,160 +16925,217 @@ test_move_link(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, MOVE_LINK_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, LINK_ITER_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create group\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    for (i = 0; i < MOVE_LINK_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((space_id = H5Screate_simple(MOVE_LINK_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    for (i = 0; i < LINK_ITER_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((dset_dspace = H5Screate_simple(LINK_ITER_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, MOVE_LINK_TEST_DSET_NAME, dset_dtype, space_id, H5P_DEFAULT,
+    if ((dset_id = H5Dcreate2(group_id, LINK_ITER_TEST_HARD_LINK_NAME, dset_dtype, dset_dspace, H5P_DEFAULT,
                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create hard link\n");
         goto error;
     }
 
-    /* Try to move a hard link */
-    if (H5Lcreate_hard(group_id, MOVE_LINK_TEST_DSET_NAME, file_id, MOVE_LINK_TEST_HARD_LINK_NAME,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME
+                       "/" LINK_ITER_TEST_HARD_LINK_NAME,
+                       group_id, LINK_ITER_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create hard link\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_ITER_TEST_EXT_LINK_NAME, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if hard link exists\n");
+        printf("    couldn't create external link\n");
+        goto error;
+    }
+
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link 1 did not exist\n");
+        goto error;
+    }
+
+    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link 2 did not exist\n");
+        goto error;
+    }
+
+    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    hard link did not exist\n");
+        printf("    link 3 did not exist\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to move a hard link to another location\n");
+    puts("Iterating over links by link name in increasing order with H5Literate\n");
 #endif
 
-    /* Move the link */
-    H5E_BEGIN_TRY
-    {
-        if (H5Lmove(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, group_id, MOVE_LINK_TEST_HARD_LINK_NAME,
-                    H5P_DEFAULT, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded\n");
-            goto error;
-        }
+    /* Test basic link iteration capability using both index types and both index orders */
+    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback1, NULL) < 0) {
+        H5_FAILED();
+        printf("    H5Literate by index type name in increasing order failed\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-#if 0
-    /* Verify the link has been moved */
-    if ((link_exists = H5Lexists(group_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link name in decreasing order with H5Literate\n");
+#endif
+
+    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if hard link exists\n");
+        printf("    H5Literate by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if (!link_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link creation order in increasing order with H5Literate\n");
+#endif
+
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    hard link did not exist\n");
+        printf("    H5Literate by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    /* Verify the old link is gone */
-    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link creation order in decreasing order with H5Literate\n");
+#endif
+
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if old hard link exists\n");
+        printf("    H5Literate by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-    if (link_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link name in increasing order with H5Literate_by_name\n");
+#endif
+
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME, H5_INDEX_NAME,
+                           H5_ITER_INC, NULL, link_iter_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    old hard link exists\n");
+        printf("    H5Literate_by_name by index type name in increasing order failed\n");
         goto error;
     }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link name in decreasing order with H5Literate_by_name\n");
 #endif
 
-    /* Try to move a soft link */
-    if (H5Lcreate_soft(MOVE_LINK_TEST_SOFT_LINK_TARGET_PATH, file_id, MOVE_LINK_TEST_SOFT_LINK_NAME,
-                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME, H5_INDEX_NAME,
+                           H5_ITER_DEC, NULL, link_iter_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create soft link\n");
+        printf("    H5Literate_by_name by index type name in decreasing order failed\n");
         goto error;
     }
 
-    /* Verify the link has been created */
-    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link creation order in increasing order with H5Literate_by_name\n");
+#endif
+
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback1, NULL,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if soft link exists\n");
+        printf("    H5Literate_by_name by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    if (!link_exists) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link creation order in decreasing order with H5Literate_by_name\n");
+#endif
+
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback1, NULL,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    soft link did not exist\n");
+        printf("    H5Literate_by_name by index type creation order in decreasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Attempting to move a soft link to another location\n");
+    puts("Testing H5Literate's index-saving capability in increasing iteration order\n");
 #endif
 
-    /* Move the link */
-    H5E_BEGIN_TRY
-    {
-        if (H5Lmove(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, group_id, MOVE_LINK_TEST_SOFT_LINK_NAME,
-                    H5P_DEFAULT, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded\n");
-            goto error;
-        }
+    /* Test the H5Literate index-saving capabilities */
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, &saved_idx, link_iter_callback2, &halted) < 0) {
+        H5_FAILED();
+        printf("    H5Literate index-saving capability test failed\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-#if 0
-    /* Verify the link has been moved */
-    if ((link_exists = H5Lexists(group_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (saved_idx != 2) {
         H5_FAILED();
-        printf("    couldn't determine if soft link exists\n");
+        printf("    saved index after iteration was wrong\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, &saved_idx, link_iter_callback2, &halted) < 0) {
         H5_FAILED();
-        printf("    soft link did not exist\n");
+        printf("    couldn't finish iterating\n");
         goto error;
     }
 
-    /* Verify the old link is gone */
-    if ((link_exists = H5Lexists(file_id, MOVE_LINK_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    saved_idx = LINK_ITER_TEST_NUM_LINKS - 1;
+    halted    = 0;
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Testing H5Literate's index-saving capability in decreasing iteration order\n");
+#endif
+
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, &saved_idx, link_iter_callback2, &halted) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if old soft link exists\n");
+        printf("    H5Literate index-saving capability test failed\n");
         goto error;
     }
 
-    if (link_exists) {
+    if (saved_idx != 2) {
         H5_FAILED();
-        printf("    old soft link exists\n");
+        printf("    saved index after iteration was wrong\n");
         goto error;
     }
-#endif
 
-    if (H5Sclose(space_id) < 0)
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, &saved_idx, link_iter_callback2, &halted) < 0) {
+        H5_FAILED();
+        printf("    couldn't finish iterating\n");
+        goto error;
+    }
+
+    if (H5Sclose(dset_dspace) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
@@ -12663,7 +17159,7 @@ test_move_link(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space_id);
+        H5Sclose(dset_dspace);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
         H5Gclose(group_id);
@@ -12678,23 +17174,12 @@ error:
 }
 
 static int
-test_get_link_info(void)
+test_link_iterate_0_links(void)
 {
-    H5L_info2_t link_info;
-    hsize_t     dims[GET_LINK_INFO_TEST_DSET_SPACE_RANK];
-    size_t      i;
-    htri_t      link_exists;
-    hid_t       file_id = -1, fapl_id = -1;
-    hid_t       container_group = -1, group_id = -1;
-    hid_t       dset_id     = -1;
-    hid_t       dset_dtype  = -1;
-    hid_t       dset_dspace = -1;
-    char        ext_link_filename[FILENAME_MAX_LENGTH];
-
-    TESTING("get link info")
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1, group_id = -1;
 
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
+    TESTING("link iteration on group with 0 links")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -12716,209 +17201,100 @@ test_get_link_info(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, GET_LINK_INFO_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    for (i = 0; i < GET_LINK_INFO_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((dset_dspace = H5Screate_simple(GET_LINK_INFO_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dcreate2(group_id, GET_LINK_INFO_TEST_DSET_NAME, dset_dtype, dset_dspace, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create dataset\n");
-        goto error;
-    }
-
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME
-                       "/" GET_LINK_INFO_TEST_DSET_NAME,
-                       group_id, GET_LINK_INFO_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
-
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create external link\n");
-        goto error;
-    }
-
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if hard link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    hard link did not exist\n");
-        goto error;
-    }
-
-    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if soft link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    soft link did not exist\n");
-        goto error;
-    }
-
-    if ((link_exists = H5Lexists(group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if external link exists\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link name in increasing order with H5Literate\n");
+#endif
 
-    if (!link_exists) {
+    /* Test basic link iteration capability using both index types and both index orders */
+    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    external link did not exist\n");
+        printf("    H5Literate by index type name in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving hard link info with H5Lget_info\n");
+    puts("Iterating over links by link name in decreasing order with H5Literate\n");
 #endif
 
-    memset(&link_info, 0, sizeof(link_info));
-
-    if (H5Lget_info2(group_id, GET_LINK_INFO_TEST_DSET_NAME, &link_info, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't get hard link info\n");
-        goto error;
-    }
-
-    if (link_info.type != H5L_TYPE_HARD) {
+    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    incorrect link type returned\n");
+        printf("    H5Literate by index type name in decreasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving soft link info with H5Lget_info\n");
+    puts("Iterating over links by link creation order in increasing order with H5Literate\n");
 #endif
 
-    memset(&link_info, 0, sizeof(link_info));
-
-    if (H5Lget_info2(file_id,
-                     "/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME
-                     "/" GET_LINK_INFO_TEST_SOFT_LINK_NAME,
-                     &link_info, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't get soft link info\n");
-        goto error;
-    }
-
-    if (link_info.type != H5L_TYPE_SOFT) {
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    incorrect link type returned\n");
+        printf("    H5Literate by index type creation order in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving external link info with H5Lget_info\n");
+    puts("Iterating over links by link creation order in decreasing order with H5Literate\n");
 #endif
 
-    memset(&link_info, 0, sizeof(link_info));
-
-    if (H5Lget_info2(group_id, GET_LINK_INFO_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't get external link info\n");
+        printf("    H5Literate by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-    if (link_info.type != H5L_TYPE_EXTERNAL) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Iterating over links by link name in increasing order with H5Literate_by_name\n");
+#endif
+
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
+                           H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback3, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    incorrect link type returned\n");
+        printf("    H5Literate_by_name by index type name in increasing order failed\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving hard link info with H5Lget_info_by_idx\n");
+    puts("Iterating over links by link name in decreasing order with H5Literate_by_name\n");
 #endif
 
-        memset(&link_info, 0, sizeof(link_info));
-
-        if (H5Lget_info_by_idx2(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, &link_info, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (link_info.type != H5L_TYPE_HARD) {
-            H5_FAILED();
-            printf("    incorrect link type returned\n");
-            goto error;
-        }
-#endif
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
+                           H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback3, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Literate_by_name by index type name in decreasing order failed\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving soft link info with H5Lget_info_by_idx\n");
+    puts("Iterating over links by link creation order in increasing order with H5Literate_by_name\n");
 #endif
 
-        memset(&link_info, 0, sizeof(link_info));
-
-        if (H5Lget_info_by_idx2(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_INFO_TEST_SUBGROUP_NAME,
-                                H5_INDEX_CRT_ORDER, H5_ITER_DEC, 1, &link_info, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (link_info.type != H5L_TYPE_SOFT) {
-            H5_FAILED();
-            printf("    incorrect link type returned\n");
-            goto error;
-        }
-#endif
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback3, NULL,
+                           H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Literate_by_name by index type creation order in increasing order failed\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving external link info with H5Lget_info_by_idx\n");
+    puts("Iterating over links by link creation order in decreasing order with H5Literate_by_name\n");
 #endif
 
-        memset(&link_info, 0, sizeof(link_info));
-
-        if (H5Lget_info_by_idx2(group_id, ".", H5_INDEX_NAME, H5_ITER_DEC, 2, &link_info, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (link_info.type != H5L_TYPE_EXTERNAL) {
-            H5_FAILED();
-            printf("    incorrect link type returned\n");
-            goto error;
-        }
-#endif
+    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
+                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback3, NULL,
+                           H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Literate_by_name by index type creation order in decreasing order failed\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if (H5Sclose(dset_dspace) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -12937,9 +17313,6 @@ test_get_link_info(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(dset_dspace);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -12952,21 +17325,23 @@ error:
 }
 
 static int
-test_get_link_name_by_index(void)
+test_link_visit(void)
 {
-    hsize_t dims[GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK];
-    ssize_t ret;
+    hsize_t dims[LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK];
     size_t  i;
     htri_t  link_exists;
-    size_t  link_name_buf_size = 0;
     hid_t   file_id = -1, fapl_id = -1;
     hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id       = -1;
-    hid_t   dset_dtype    = -1;
-    hid_t   dset_dspace   = -1;
-    char   *link_name_buf = NULL;
+    hid_t   subgroup1 = -1, subgroup2 = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
+    hid_t   fspace_id  = -1;
+    char    ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("get link name by index")
+    TESTING("link visit without cycles")
+
+    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
+             EXTERNAL_LINK_TEST_FILE_NAME);
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -12988,320 +17363,225 @@ test_get_link_name_by_index(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    for (i = 0; i < GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((dset_dspace = H5Screate_simple(GET_LINK_NAME_BY_IDX_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dcreate2(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, dset_dtype, dset_dspace,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create first subgroup\n");
         goto error;
     }
 
-    /* Verify that the hard link exists */
-    if ((link_exists = H5Lexists(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create second subgroup\n");
         goto error;
     }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    link '%s' did not exist\n", GET_LINK_NAME_BY_IDX_TEST_DSET_NAME);
-        goto error;
-    }
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
-    /* Verify that retrieving the link name by index works with hard links; the dataset hard link
-     * should be the only link in the group currently.
-     */
+    for (i = 0; i < LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name of hard link to dataset\n");
-    puts("Retrieving size of link name\n");
-#endif
+    if ((fspace_id = H5Screate_simple(LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
 
-    if ((ret = H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, NULL, link_name_buf_size,
-                                  H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(subgroup1, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name size\n");
-        goto error;
+        printf("    couldn't create first dataset\n");
     }
 
-    link_name_buf_size = (size_t)ret;
-    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name\n");
-#endif
-
-    if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, 0, link_name_buf,
-                           link_name_buf_size + 1, H5P_DEFAULT) < 0) {
+    if ((dset_id = H5Dcreate2(subgroup2, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name\n");
-        goto error;
+        printf("    couldn't create second dataset\n");
     }
 
-    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME)) {
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if (H5Lcreate_hard(subgroup1, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, subgroup1,
+                       LINK_VISIT_TEST_NO_CYCLE_LINK_NAME1, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    link name '%s' did not match '%s'\n", link_name_buf, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME);
+        printf("    couldn't create first hard link\n");
         goto error;
     }
 
-    if (link_name_buf) {
-        free(link_name_buf);
-        link_name_buf = NULL;
-    }
-
-    /*
-     * Delete the dataset hard link so the next tests won't be thrown off
-     */
-    if (H5Ldelete(group_id, GET_LINK_NAME_BY_IDX_TEST_DSET_NAME, H5P_DEFAULT) < 0) {
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME
+                       "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME2 "/" LINK_VISIT_TEST_NO_CYCLE_DSET_NAME,
+                       subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't delete hard link\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    /* Create 10 soft links for testing with; create links backwards to make sure sorting by creation order
-     * doesn't look the same as sorting by link name */
-    for (i = GET_LINK_NAME_BY_IDX_TEST_NUM_LINKS - 1; i >= 0; i--) {
-        char temp_link_name[GET_LINK_NAME_BY_IDX_TEST_MAX_LINK_NAME_LENGTH];
-
-        snprintf(temp_link_name, GET_LINK_NAME_BY_IDX_TEST_MAX_LINK_NAME_LENGTH, "link%zu", i);
-
-        if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, group_id,
-                           temp_link_name, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-            H5_FAILED();
-            printf("    failed to create soft link '%s'\n", temp_link_name);
-            goto error;
-        }
-
-        if ((link_exists = H5Lexists(group_id, temp_link_name, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't determine if link exists\n");
-            goto error;
-        }
-
-        if (!link_exists) {
-            H5_FAILED();
-            printf("    link '%s' did not exist\n", temp_link_name);
-            goto error;
-        }
-
-        if (i == 0)
-            break;
+    if (H5Lcreate_external(ext_link_filename, "/", subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME3,
+                           H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create external link\n");
+        goto error;
     }
 
-    /*
-     * A variety of ways of reaching the same group are used below in order to test the
-     * capability of the function to correctly find the specified group by ID and path.
-     */
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name by index number; sorted by link name in increasing order\n");
-    puts("Retrieving size of link name\n");
-#endif
-
-    if ((ret = H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC,
-                                  GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_IDX, NULL, link_name_buf_size,
-                                  H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_hard(subgroup2, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, subgroup2,
+                       LINK_VISIT_TEST_NO_CYCLE_LINK_NAME4, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name size\n");
+        printf("    couldn't create second hard link\n");
         goto error;
     }
 
-    link_name_buf_size = (size_t)ret;
-    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name\n");
-#endif
-
-    if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC,
-                           GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_IDX, link_name_buf, link_name_buf_size + 1,
-                           H5P_DEFAULT) < 0) {
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME1, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name\n");
+        printf("    couldn't determine if first link exists\n");
         goto error;
     }
 
-    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_NAME)) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    link name '%s' did not match '%s'\n", link_name_buf,
-               GET_LINK_NAME_BY_IDX_TEST_FIRST_LINK_NAME);
+        printf("    link 1 did not exist\n");
         goto error;
     }
 
-    if (link_name_buf) {
-        free(link_name_buf);
-        link_name_buf = NULL;
+    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME2, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if second link exists\n");
+        goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name by index number; sorted by link name in decreasing order\n");
-    puts("Retrieving size of link name\n");
-#endif
-
-    if ((ret =
-             H5Lget_name_by_idx(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
-                                H5_INDEX_NAME, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_IDX, NULL,
-                                link_name_buf_size, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    unable to retrieve link name size\n");
+        printf("    link 2 did not exist\n");
         goto error;
     }
 
-    link_name_buf_size = (size_t)ret;
-    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name\n");
-#endif
+    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME3, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if third link exists\n");
+        goto error;
+    }
 
-    if (H5Lget_name_by_idx(file_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
-                           H5_INDEX_NAME, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_IDX,
-                           link_name_buf, link_name_buf_size + 1, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    unable to retrieve link name\n");
+        printf("    link 3 did not exist\n");
         goto error;
     }
 
-    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_NAME)) {
+    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME4, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link name '%s' did not match '%s'\n", link_name_buf,
-               GET_LINK_NAME_BY_IDX_TEST_SECOND_LINK_NAME);
+        printf("    couldn't determine if fourth link exists\n");
         goto error;
     }
 
-    if (link_name_buf) {
-        free(link_name_buf);
-        link_name_buf = NULL;
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link 4 did not exist\n");
+        goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name by index number; sorted by link creation order in increasing order\n");
-    puts("Retrieving size of link name\n");
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
 #endif
 
-    if ((ret = H5Lget_name_by_idx(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
-                                  H5_INDEX_CRT_ORDER, H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_IDX,
-                                  NULL, link_name_buf_size, H5P_DEFAULT)) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name size\n");
+        printf("    H5Lvisit by index type name in increasing order failed\n");
         goto error;
     }
 
-    link_name_buf_size = (size_t)ret;
-    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name\n");
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
 #endif
 
-    if (H5Lget_name_by_idx(container_group, GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME, H5_INDEX_CRT_ORDER,
-                           H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_IDX, link_name_buf,
-                           link_name_buf_size + 1, H5P_DEFAULT) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name\n");
+        printf("    H5Lvisit by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_NAME)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
+#endif
+
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    link name '%s' did not match '%s'\n", link_name_buf,
-               GET_LINK_NAME_BY_IDX_TEST_THIRD_LINK_NAME);
+        printf("    H5Lvisit by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    if (link_name_buf) {
-        free(link_name_buf);
-        link_name_buf = NULL;
-    }
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name by index number; sorted by link creation order in decreasing order\n");
-    puts("Retrieving size of link name\n");
+    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
 #endif
 
-    if ((ret = H5Lget_name_by_idx(group_id,
-                                  "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
-                                  H5_INDEX_CRT_ORDER, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_IDX,
-                                  NULL, link_name_buf_size, H5P_DEFAULT)) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback1, NULL) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name size\n");
+        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-    link_name_buf_size = (size_t)ret;
-    if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving link name\n");
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
 #endif
 
-    if (H5Lget_name_by_idx(group_id, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_NAME_BY_IDX_TEST_SUBGROUP_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_IDX,
-                           link_name_buf, link_name_buf_size + 1, H5P_DEFAULT) < 0) {
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    unable to retrieve link name\n");
+        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
         goto error;
     }
 
-    if (strcmp(link_name_buf, GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_NAME)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
+#endif
+
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    link name '%s' did not match '%s'\n", link_name_buf,
-               GET_LINK_NAME_BY_IDX_TEST_FOURTH_LINK_NAME);
+        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if (link_name_buf) {
-        free(link_name_buf);
-        link_name_buf = NULL;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in increasing order with "
+         "H5Lvisit_by_name\n");
+#endif
 
-    /* Check to make sure that using an index number beyond the number of links will fail */
-    H5E_BEGIN_TRY
-    {
-        link_name_buf_size = 256;
-        if (NULL == (link_name_buf = (char *)calloc(1, link_name_buf_size + 1)))
-            TEST_ERROR
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
+        goto error;
+    }
 
-        if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, GET_LINK_NAME_BY_IDX_TEST_NUM_LINKS,
-                               link_name_buf, link_name_buf_size, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    using an index number beyond the number of links didn't fail!\n");
-            goto error;
-        }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in decreasing order with "
+         "H5Lvisit_by_name\n");
+#endif
 
-        if (link_name_buf) {
-            free(link_name_buf);
-            link_name_buf = NULL;
-        }
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if (H5Sclose(dset_dspace) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Gclose(subgroup1) < 0)
+        TEST_ERROR
+    if (H5Gclose(subgroup2) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -13321,11 +17601,11 @@ test_get_link_name_by_index(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (link_name_buf)
-            free(link_name_buf);
-        H5Sclose(dset_dspace);
+        H5Sclose(fspace_id);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Gclose(subgroup1);
+        H5Gclose(subgroup2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -13338,20 +17618,15 @@ error:
 }
 
 static int
-test_get_link_val(void)
+test_link_visit_cycles(void)
 {
-    H5L_info2_t link_info;
-    const char *ext_link_filepath;
-    const char *ext_link_val;
-    unsigned    ext_link_flags;
-    htri_t      link_exists;
-    size_t      link_val_buf_size;
-    char       *link_val_buf = NULL;
-    hid_t       file_id = -1, fapl_id = -1;
-    hid_t       container_group = -1, group_id = -1;
-    char        ext_link_filename[FILENAME_MAX_LENGTH];
+    htri_t link_exists;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1, group_id = -1;
+    hid_t  subgroup1 = -1, subgroup2 = -1;
+    char   ext_link_filename[FILENAME_MAX_LENGTH];
 
-    TESTING("get link value")
+    TESTING("link visit with cycles")
 
     snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
              EXTERNAL_LINK_TEST_FILE_NAME);
@@ -13376,248 +17651,195 @@ test_get_link_val(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, GET_LINK_VAL_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME, group_id,
-                       GET_LINK_VAL_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create soft link\n");
+        printf("    couldn't create first subgroup\n");
         goto error;
     }
 
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
+    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create external link\n");
+        printf("    couldn't create second subgroup\n");
         goto error;
     }
 
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_hard(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2, subgroup1,
+                       LINK_VISIT_TEST_CYCLE_LINK_NAME1, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create first hard link\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME
+                       "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2,
+                       subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    link did not exist\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_external(ext_link_filename, "/", subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME3, H5P_DEFAULT,
+                           H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if external link exists\n");
+        printf("    couldn't create external link\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (H5Lcreate_hard(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME3, subgroup2,
+                       LINK_VISIT_TEST_CYCLE_LINK_NAME4, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    external link did not exist\n");
+        printf("    couldn't create second hard link\n");
         goto error;
     }
 
-    memset(&link_info, 0, sizeof(link_info));
+    /* Verify the links have been created */
+    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME1, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if first link exists\n");
+        goto error;
+    }
 
-    if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't get soft link info\n");
+        printf("    link 1 did not exist\n");
         goto error;
     }
 
-    if (link_info.type != H5L_TYPE_SOFT) {
+    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    incorrect link type returned\n");
+        printf("    couldn't determine if second link exists\n");
         goto error;
     }
 
-    link_val_buf_size = link_info.u.val_size;
-    if (NULL == (link_val_buf = (char *)malloc(link_val_buf_size)))
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving value of soft link with H5Lget_val\n");
-#endif
-
-    if (H5Lget_val(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, link_val_buf, link_val_buf_size, H5P_DEFAULT) <
-        0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't get soft link val\n");
+        printf("    link 2 did not exist\n");
         goto error;
     }
 
-    if (strcmp(link_val_buf, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME)) {
+    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME3, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    soft link value did not match\n");
+        printf("    couldn't determine if third link exists\n");
         goto error;
     }
 
-    memset(&link_info, 0, sizeof(link_info));
-
-    if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't get external link info\n");
+        printf("    link 3 did not exist\n");
         goto error;
     }
 
-    if (link_info.type != H5L_TYPE_EXTERNAL) {
+    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME4, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    incorrect link type returned\n");
+        printf("    couldn't determine if fourth link exists\n");
         goto error;
     }
 
-    if (link_info.u.val_size > link_val_buf_size) {
-        char *tmp_realloc;
-
-        link_val_buf_size *= 2;
-
-        if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
-            TEST_ERROR
-        link_val_buf = tmp_realloc;
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    link 4 did not exist\n");
+        goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving value of external link with H5Lget_val\n");
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
 #endif
 
-    if (H5Lget_val(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, link_val_buf, link_val_buf_size, H5P_DEFAULT) <
-        0) {
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback2, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't get external link val\n");
+        printf("    H5Lvisit by index type name in increasing order failed\n");
         goto error;
     }
 
-    if (H5Lunpack_elink_val(link_val_buf, link_val_buf_size, &ext_link_flags, &ext_link_filepath,
-                            &ext_link_val) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
+#endif
+
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback2, NULL) < 0) {
         H5_FAILED();
-        printf("    couldn't unpack external link value buffer\n");
+        printf("    H5Lvisit by index type name in decreasing order failed\n");
         goto error;
     }
 
-    if (strcmp(ext_link_filepath, ext_link_filename)) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
+#endif
+
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback2, NULL) < 0) {
         H5_FAILED();
-        printf("    external link target file did not match\n");
+        printf("    H5Lvisit by index type creation order in increasing order failed\n");
         goto error;
     }
 
-    if (strcmp(ext_link_val, "/")) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
+#endif
+
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback2, NULL) < 0) {
         H5_FAILED();
-        printf("    external link value did not match\n");
+        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-        memset(&link_info, 0, sizeof(link_info));
-
-        if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_SOFT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
-            H5_FAILED();
-            printf("    couldn't get soft link info\n");
-            goto error;
-        }
-
-        if (link_info.type != H5L_TYPE_SOFT) {
-            H5_FAILED();
-            printf("    incorrect link type returned\n");
-            goto error;
-        }
-
-        if (link_info.u.val_size > link_val_buf_size) {
-            char *tmp_realloc;
-
-            link_val_buf_size *= 2;
-
-            if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
-                TEST_ERROR
-            link_val_buf = tmp_realloc;
-        }
-
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving value of soft link with H5Lget_val_by_idx\n");
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
 #endif
 
-        if (H5Lget_val_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 0, link_val_buf,
-                              link_val_buf_size, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
+        goto error;
+    }
 
-#if 0
-        if (strcmp(link_val_buf, "/" LINK_TEST_GROUP_NAME "/" GET_LINK_VAL_TEST_SUBGROUP_NAME)) {
-            H5_FAILED();
-            printf("    soft link value did not match\n");
-            goto error;
-        }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
 #endif
 
-        memset(&link_info, 0, sizeof(link_info));
-
-        if (H5Lget_info2(group_id, GET_LINK_VAL_TEST_EXT_LINK_NAME, &link_info, H5P_DEFAULT) < 0) {
-            H5_FAILED();
-            printf("    couldn't get external link info\n");
-            goto error;
-        }
-
-        if (link_info.type != H5L_TYPE_EXTERNAL) {
-            H5_FAILED();
-            printf("    incorrect link type returned\n");
-            goto error;
-        }
-
-        if (link_info.u.val_size > link_val_buf_size) {
-            char *tmp_realloc;
-
-            link_val_buf_size *= 2;
-
-            if (NULL == (tmp_realloc = (char *)realloc(link_val_buf, link_val_buf_size)))
-                TEST_ERROR
-            link_val_buf = tmp_realloc;
-        }
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Retrieving value of external link with H5Lget_val_by_idx\n");
+    puts("Recursively iterating over links by link creation order in increasing order with "
+         "H5Lvisit_by_name\n");
 #endif
 
-        if (H5Lget_val_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 0, link_val_buf,
-                              link_val_buf_size, H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (H5Lunpack_elink_val(link_val_buf, link_val_buf_size, &ext_link_flags, &ext_link_filename, &ext_link_val) < 0) {
-            H5_FAILED();
-            printf("    couldn't unpack external link value buffer\n");
-            goto error;
-        }
-
-        if (strcmp(ext_link_filename, ext_link_filename)) {
-            H5_FAILED();
-            printf("    external link target file did not match\n");
-            goto error;
-        }
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
+        goto error;
+    }
 
-        if (strcmp(ext_link_val, "/")) {
-            H5_FAILED();
-            printf("    external link value did not match\n");
-            goto error;
-        }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link creation order in decreasing order with "
+         "H5Lvisit_by_name\n");
 #endif
-    }
-    H5E_END_TRY;
 
-    if (link_val_buf) {
-        free(link_val_buf);
-        link_val_buf = NULL;
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
+        goto error;
     }
 
+    if (H5Gclose(subgroup1) < 0)
+        TEST_ERROR
+    if (H5Gclose(subgroup2) < 0)
+        TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
@@ -13636,8 +17858,8 @@ test_get_link_val(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (link_val_buf)
-            free(link_val_buf);
+        H5Gclose(subgroup1);
+        H5Gclose(subgroup2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -13650,263 +17872,301 @@ error:
 }
 
 static int
-test_link_iterate(void)
-{
-    hsize_t dims[LINK_ITER_TEST_DSET_SPACE_RANK];
-    hsize_t saved_idx = 0;
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id     = -1;
-    hid_t   dset_dtype  = -1;
-    hid_t   dset_dspace = -1;
-    int     halted      = 0;
-    char    ext_link_filename[FILENAME_MAX_LENGTH];
-
-    TESTING("link iteration")
-
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
-
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
-
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open file\n");
-        goto error;
-    }
-
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
-
-    if ((group_id = H5Gcreate2(container_group, LINK_ITER_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
+test_link_visit_0_links(void)
+{
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1, group_id = -1;
+    hid_t subgroup1 = -1, subgroup2 = -1;
 
-    for (i = 0; i < LINK_ITER_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    TESTING("link visit on group with subgroups containing 0 links")
 
-    if ((dset_dspace = H5Screate_simple(LINK_ITER_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if (H5rest_init() < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, LINK_ITER_TEST_HARD_LINK_NAME, dset_dtype, dset_dspace, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create hard link\n");
-        goto error;
-    }
-
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME
-                       "/" LINK_ITER_TEST_HARD_LINK_NAME,
-                       group_id, LINK_ITER_TEST_SOFT_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
 
-    if (H5Lcreate_external(ext_link_filename, "/", group_id, LINK_ITER_TEST_EXT_LINK_NAME, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't create external link\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_HARD_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link 1 did not exist\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_SOFT_LINK_NAME, H5P_DEFAULT)) < 0) {
+    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't create first subgroup\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link 2 did not exist\n");
+        printf("    couldn't create second subgroup\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(group_id, LINK_ITER_TEST_EXT_LINK_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
+#endif
 
-    if (!link_exists) {
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    link 3 did not exist\n");
+        printf("    H5Lvisit by index type name in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in increasing order with H5Literate\n");
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
 #endif
 
-    /* Test basic link iteration capability using both index types and both index orders */
-    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback1, NULL) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type name in increasing order failed\n");
+        printf("    H5Lvisit by index type name in decreasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in decreasing order with H5Literate\n");
+    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
 #endif
 
-    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback1, NULL) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type name in decreasing order failed\n");
+        printf("    H5Lvisit by index type creation order in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in increasing order with H5Literate\n");
+    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
 #endif
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback1, NULL) < 0) {
+    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback3, NULL) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type creation order in increasing order failed\n");
+        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in decreasing order with H5Literate\n");
+    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
 #endif
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback1, NULL) < 0) {
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type creation order in decreasing order failed\n");
+        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in increasing order with H5Literate_by_name\n");
+    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME, H5_INDEX_NAME,
-                           H5_ITER_INC, NULL, link_iter_callback1, NULL, H5P_DEFAULT) < 0) {
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
+                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Literate_by_name by index type name in increasing order failed\n");
+        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in decreasing order with H5Literate_by_name\n");
+    puts("Recursively iterating over links by link creation order in increasing order with "
+         "H5Lvisit_by_name\n");
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME, H5_INDEX_NAME,
-                           H5_ITER_DEC, NULL, link_iter_callback1, NULL, H5P_DEFAULT) < 0) {
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Literate_by_name by index type name in decreasing order failed\n");
+        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in increasing order with H5Literate_by_name\n");
+    puts("Recursively iterating over links by link creation order in decreasing order with "
+         "H5Lvisit_by_name\n");
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback1, NULL,
-                           H5P_DEFAULT) < 0) {
+    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
+                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Literate_by_name by index type creation order in increasing order failed\n");
+        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in decreasing order with H5Literate_by_name\n");
-#endif
+    if (H5Gclose(subgroup1) < 0)
+        TEST_ERROR
+    if (H5Gclose(subgroup2) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_SUBGROUP_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback1, NULL,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Literate_by_name by index type creation order in decreasing order failed\n");
-        goto error;
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(subgroup1);
+        H5Gclose(subgroup2);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_unused_link_API_calls(void)
+{
+    TESTING("unused link API calls")
 
+    /* None currently that aren't planned to be used */
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Testing H5Literate's index-saving capability in increasing iteration order\n");
+    puts("Currently no API calls to test here\n");
 #endif
 
-    /* Test the H5Literate index-saving capabilities */
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, &saved_idx, link_iter_callback2, &halted) < 0) {
+    SKIPPED();
+
+    return 0;
+}
+
+/*****************************************************
+ *                                                   *
+ *           Plugin Object Interface tests           *
+ *                                                   *
+ *****************************************************/
+
+static int
+test_open_dataset_generically(void)
+{
+    hsize_t dims[GENERIC_DATASET_OPEN_TEST_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   dset_id         = -1;
+    hid_t   dset_dtype      = -1;
+    hid_t   fspace_id       = -1;
+
+    TESTING("open dataset generically w/ H5Oopen()")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    H5Literate index-saving capability test failed\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    if (saved_idx != 2) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    saved index after iteration was wrong\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, &saved_idx, link_iter_callback2, &halted) < 0) {
+    for (i = 0; i < GENERIC_DATASET_OPEN_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(GENERIC_DATASET_OPEN_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(container_group, GENERIC_DATASET_OPEN_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't finish iterating\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    saved_idx = LINK_ITER_TEST_NUM_LINKS - 1;
-    halted    = 0;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Testing H5Literate's index-saving capability in decreasing iteration order\n");
+    puts("Opening dataset with H5Oopen\n");
 #endif
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, &saved_idx, link_iter_callback2, &halted) < 0) {
+    if ((dset_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_DATASET_OPEN_TEST_DSET_NAME,
+                           H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Literate index-saving capability test failed\n");
+        printf("    couldn't open dataset with H5Oopen()\n");
         goto error;
     }
 
-    if (saved_idx != 2) {
-        H5_FAILED();
-        printf("    saved index after iteration was wrong\n");
-        goto error;
-    }
+    H5E_BEGIN_TRY
+    {
+#if 0
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+#endif
+
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Opening dataset with H5Oopen_by_idx\n");
+#endif
+
+        if ((/*dset_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
+                                           H5P_DEFAULT)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+#if 0
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+#endif
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, &saved_idx, link_iter_callback2, &halted) < 0) {
-        H5_FAILED();
-        printf("    couldn't finish iterating\n");
-        goto error;
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Opening dataset with H5Oopen_by_addr\n");
+#endif
+
+        if ((/*dset_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
-    if (H5Sclose(dset_dspace) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -13923,10 +18183,9 @@ test_link_iterate(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(dset_dspace);
+        H5Sclose(fspace_id);
         H5Tclose(dset_dtype);
         H5Dclose(dset_id);
-        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -13938,12 +18197,13 @@ error:
 }
 
 static int
-test_link_iterate_0_links(void)
+test_open_group_generically(void)
 {
     hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1, group_id = -1;
+    hid_t container_group = -1;
+    hid_t group_id        = -1;
 
-    TESTING("link iteration on group with 0 links")
+    TESTING("open group generically w/ H5Oopen()")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -13959,105 +18219,67 @@ test_link_iterate_0_links(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in increasing order with H5Literate\n");
-#endif
-
-    /* Test basic link iteration capability using both index types and both index orders */
-    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback3, NULL) < 0) {
-        H5_FAILED();
-        printf("    H5Literate by index type name in increasing order failed\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in decreasing order with H5Literate\n");
-#endif
-
-    if (H5Literate(group_id, H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback3, NULL) < 0) {
+    if ((group_id = H5Gcreate2(container_group, GENERIC_GROUP_OPEN_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type name in decreasing order failed\n");
+        printf("    couldn't create group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in increasing order with H5Literate\n");
-#endif
-
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback3, NULL) < 0) {
-        H5_FAILED();
-        printf("    H5Literate by index type creation order in increasing order failed\n");
-        goto error;
-    }
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in decreasing order with H5Literate\n");
+    puts("Opening group with H5Oopen\n");
 #endif
 
-    if (H5Literate(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback3, NULL) < 0) {
+    if ((group_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_GROUP_OPEN_TEST_GROUP_NAME,
+                            H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Literate by index type creation order in decreasing order failed\n");
+        printf("    couldn't open group with H5Oopen()\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in increasing order with H5Literate_by_name\n");
+    H5E_BEGIN_TRY
+    {
+#if 0
+        if (H5Gclose(group_id) < 0)
+            TEST_ERROR
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
-                           H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_callback3, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Literate_by_name by index type name in increasing order failed\n");
-        goto error;
-    }
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link name in decreasing order with H5Literate_by_name\n");
+        puts("Opening group with H5Oopen_by_idx\n");
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
-                           H5_INDEX_NAME, H5_ITER_DEC, NULL, link_iter_callback3, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Literate_by_name by index type name in decreasing order failed\n");
-        goto error;
-    }
+        if ((/*group_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC,
+                                            0, H5P_DEFAULT)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in increasing order with H5Literate_by_name\n");
+#if 0
+        if (H5Gclose(group_id) < 0)
+            TEST_ERROR
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_INC, NULL, link_iter_callback3, NULL,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Literate_by_name by index type creation order in increasing order failed\n");
-        goto error;
-    }
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Iterating over links by link creation order in decreasing order with H5Literate_by_name\n");
+        puts("Opening group with H5Oopen_by_addr\n");
 #endif
 
-    if (H5Literate_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_ITER_TEST_0_LINKS_SUBGROUP_NAME,
-                           H5_INDEX_CRT_ORDER, H5_ITER_DEC, NULL, link_iter_callback3, NULL,
-                           H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Literate_by_name by index type creation order in decreasing order failed\n");
-        goto error;
+        if ((/*group_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
 
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -14089,23 +18311,13 @@ error:
 }
 
 static int
-test_link_visit(void)
+test_open_datatype_generically(void)
 {
-    hsize_t dims[LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK];
-    size_t  i;
-    htri_t  link_exists;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   subgroup1 = -1, subgroup2 = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
-    hid_t   fspace_id  = -1;
-    char    ext_link_filename[FILENAME_MAX_LENGTH];
-
-    TESTING("link visit without cycles")
+    hid_t file_id = -1, fapl_id = -1;
+    hid_t container_group = -1;
+    hid_t type_id         = -1;
 
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
+    TESTING("open datatype generically w/ H5Oopen()")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -14121,231 +18333,215 @@ test_link_visit(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container subgroup\n");
-        goto error;
-    }
-
-    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
+    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't create first subgroup\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
+    if (H5Tcommit2(container_group, GENERIC_DATATYPE_OPEN_TEST_TYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create second subgroup\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Tclose(type_id) < 0)
         TEST_ERROR
 
-    for (i = 0; i < LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((fspace_id = H5Screate_simple(LINK_VISIT_TEST_NO_CYCLE_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Opening datatype with H5Oopen\n");
+#endif
 
-    if ((dset_id = H5Dcreate2(subgroup1, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((type_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_DATATYPE_OPEN_TEST_TYPE_NAME,
+                           H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create first dataset\n");
+        printf("    couldn't open datatype generically w/ H5Oopen()\n");
+        goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+#if 0
+        if (H5Tclose(type_id) < 0)
+            TEST_ERROR
+#endif
 
-    if ((dset_id = H5Dcreate2(subgroup2, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create second dataset\n");
-    }
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Opening datatype with H5Oopen_by_idx\n");
+#endif
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+        if ((/*type_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
+                                           H5P_DEFAULT)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
 
-    if (H5Lcreate_hard(subgroup1, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, subgroup1,
-                       LINK_VISIT_TEST_NO_CYCLE_LINK_NAME1, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create first hard link\n");
-        goto error;
-    }
+#if 0
+        if (H5Tclose(type_id) < 0)
+            TEST_ERROR
+#endif
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME
-                       "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME2 "/" LINK_VISIT_TEST_NO_CYCLE_DSET_NAME,
-                       subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
+#ifdef RV_CONNECTOR_DEBUG
+        puts("Opening datatype with H5Oopen_by_addr\n");
+#endif
 
-    if (H5Lcreate_external(ext_link_filename, "/", subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME3,
-                           H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create external link\n");
-        goto error;
+        if ((/*type_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
     }
+    H5E_END_TRY;
+
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-    if (H5Lcreate_hard(subgroup2, LINK_VISIT_TEST_NO_CYCLE_DSET_NAME, subgroup2,
-                       LINK_VISIT_TEST_NO_CYCLE_LINK_NAME4, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create second hard link\n");
-        goto error;
-    }
+    PASSED();
 
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME1, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if first link exists\n");
-        goto error;
-    }
+    return 0;
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    link 1 did not exist\n");
-        goto error;
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(type_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
     }
+    H5E_END_TRY;
 
-    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME2, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if second link exists\n");
-        goto error;
-    }
+    return 1;
+}
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    link 2 did not exist\n");
-        goto error;
-    }
+static int
+test_object_exists(void)
+{
+    hsize_t dims[OBJECT_EXISTS_TEST_DSET_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dtype_id   = -1;
+    hid_t   fspace_id  = -1;
+    hid_t   dset_dtype = -1;
 
-    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME3, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if third link exists\n");
-        goto error;
-    }
+    TESTING("object exists by name")
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    link 3 did not exist\n");
-        goto error;
-    }
+    if (H5rest_init() < 0)
+        TEST_ERROR
 
-    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_NO_CYCLE_LINK_NAME4, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if fourth link exists\n");
-        goto error;
-    }
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
 
-    if (!link_exists) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    link 4 did not exist\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback1, NULL) < 0) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in increasing order failed\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback1, NULL) < 0) {
+    if ((group_id = H5Gcreate2(container_group, OBJECT_EXISTS_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in decreasing order failed\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback1, NULL) < 0) {
+    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in increasing order failed\n");
-        goto error;
+        printf("    couldn't create datatype\n");
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback1, NULL) < 0) {
+    if (H5Tcommit2(group_id, OBJECT_EXISTS_TEST_DTYPE_NAME, dtype_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) <
+        0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
-#endif
+    for (i = 0; i < OBJECT_EXISTS_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
-        goto error;
-    }
+    if ((fspace_id = H5Screate_simple(OBJECT_EXISTS_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
-#endif
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, OBJECT_EXISTS_TEST_DSET_NAME, dset_dtype, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with "
-         "H5Lvisit_by_name\n");
-#endif
+    H5E_BEGIN_TRY
+    {
+        /* H5Oexists_by_name for hard links should always succeed. */
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
-        goto error;
-    }
+        /* Check if the group exists */
+        if (H5Oexists_by_name(file_id, OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME,
+                              H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with "
-         "H5Lvisit_by_name\n");
-#endif
+        /* Check if the datatype exists */
+        if (H5Oexists_by_name(file_id,
+                              OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME
+                                                     "/" OBJECT_EXISTS_TEST_DTYPE_NAME,
+                              H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_NO_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback1, NULL, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
-        goto error;
+        /* Check if the dataset exists */
+        if (H5Oexists_by_name(file_id,
+                              OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME
+                                                     "/" OBJECT_EXISTS_TEST_DSET_NAME,
+                              H5P_DEFAULT) >= 0) {
+            H5_FAILED();
+            printf("    unsupported API succeeded!\n");
+            goto error;
+        }
+
+        /* Checking for a soft link may fail if the link doesn't resolve. */
     }
+    H5E_END_TRY;
 
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Gclose(subgroup1) < 0)
+    if (H5Tclose(dtype_id) < 0)
         TEST_ERROR
-    if (H5Gclose(subgroup2) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -14367,9 +18563,8 @@ error:
     {
         H5Sclose(fspace_id);
         H5Tclose(dset_dtype);
+        H5Tclose(dtype_id);
         H5Dclose(dset_id);
-        H5Gclose(subgroup1);
-        H5Gclose(subgroup2);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -14382,18 +18577,82 @@ error:
 }
 
 static int
-test_link_visit_cycles(void)
+test_incr_decr_refcount(void)
 {
-    htri_t link_exists;
-    hid_t  file_id = -1, fapl_id = -1;
-    hid_t  container_group = -1, group_id = -1;
-    hid_t  subgroup1 = -1, subgroup2 = -1;
-    char   ext_link_filename[FILENAME_MAX_LENGTH];
+    hid_t file_id = -1, fapl_id = -1;
 
-    TESTING("link visit with cycles")
+    TESTING("H5Oincr/decr_refcount")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Testing unsupported APIs H5Oincr/decr_refcount\n");
+#endif
+
+    H5E_BEGIN_TRY
+    {
+        if (H5Oincr_refcount(file_id) >= 0)
+            TEST_ERROR
+        if (H5Odecr_refcount(file_id) >= 0)
+            TEST_ERROR
+    }
+    H5E_END_TRY;
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static int
+test_h5o_copy(void)
+{
+    hsize_t dims[OBJECT_COPY_TEST_SPACE_RANK];
+    hsize_t chunk_dims[OBJECT_COPY_TEST_SPACE_RANK];
+    size_t  i;
+    htri_t  attr_exists;
+    int     write_buf[OBJECT_COPY_TEST_DIM0 * OBJECT_COPY_TEST_DIM1];
+    int     read_buf[OBJECT_COPY_TEST_DIM0 * OBJECT_COPY_TEST_DIM1];
+    int     attr_value;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id = -1, copy_id = -1;
+    hid_t   attr_id    = -1;
+    hid_t   dcpl_id    = -1;
+    hid_t   ocpypl_id  = -1;
+    hid_t   space_id   = -1;
+    hid_t   attr_space = -1;
 
-    snprintf(ext_link_filename, FILENAME_MAX_LENGTH, "%s/%s/%s", TEST_DIR_PREFIX, username,
-             EXTERNAL_LINK_TEST_FILE_NAME);
+    TESTING("object copy")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -14409,200 +18668,198 @@ test_link_visit_cycles(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, OBJECT_COPY_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create first subgroup\n");
-        goto error;
-    }
+    dims[0] = OBJECT_COPY_TEST_DIM0;
+    dims[1] = OBJECT_COPY_TEST_DIM1;
 
-    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create second subgroup\n");
-        goto error;
-    }
+    if ((space_id = H5Screate_simple(OBJECT_COPY_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((attr_space = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
 
-    if (H5Lcreate_hard(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2, subgroup1,
-                       LINK_VISIT_TEST_CYCLE_LINK_NAME1, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create first hard link\n");
-        goto error;
-    }
+    /* Chunk the dataset so that copying its data without the server takes more than one batch of blocks,
+     * the last of them only partly filled */
+    for (i = 0; i < OBJECT_COPY_TEST_SPACE_RANK; i++)
+        chunk_dims[i] = OBJECT_COPY_TEST_CHUNK_DIM;
 
-    if (H5Lcreate_soft("/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME
-                       "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME2,
-                       subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME2, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create soft link\n");
-        goto error;
-    }
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, OBJECT_COPY_TEST_SPACE_RANK, chunk_dims) < 0)
+        TEST_ERROR
 
-    if (H5Lcreate_external(ext_link_filename, "/", subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME3, H5P_DEFAULT,
-                           H5P_DEFAULT) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, OBJECT_COPY_TEST_DSET_NAME, OBJECT_COPY_TEST_DSET_DTYPE, space_id,
+                              H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create external link\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if (H5Lcreate_hard(group_id, LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME3, subgroup2,
-                       LINK_VISIT_TEST_CYCLE_LINK_NAME4, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create second hard link\n");
-        goto error;
-    }
+    for (i = 0; i < OBJECT_COPY_TEST_DIM0 * OBJECT_COPY_TEST_DIM1; i++)
+        write_buf[i] = (int)i;
 
-    /* Verify the links have been created */
-    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME1, H5P_DEFAULT)) < 0) {
+    if (H5Dwrite(dset_id, OBJECT_COPY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if first link exists\n");
+        printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((attr_id = H5Acreate2(dset_id, OBJECT_COPY_TEST_ATTR_NAME, H5T_NATIVE_INT, attr_space, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    link 1 did not exist\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(subgroup1, LINK_VISIT_TEST_CYCLE_LINK_NAME2, H5P_DEFAULT)) < 0) {
+    attr_value = OBJECT_COPY_TEST_ATTR_VALUE;
+
+    if (H5Awrite(attr_id, H5T_NATIVE_INT, &attr_value) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if second link exists\n");
+        printf("    couldn't write to attribute\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Copying object with H5Ocopy\n");
+#endif
+
+    if (H5Ocopy(group_id, OBJECT_COPY_TEST_DSET_NAME, group_id, OBJECT_COPY_TEST_DSET_NAME2, H5P_DEFAULT,
+                H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    link 2 did not exist\n");
+        printf("    couldn't copy dataset\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME3, H5P_DEFAULT)) < 0) {
+    if ((copy_id = H5Dopen2(group_id, OBJECT_COPY_TEST_DSET_NAME2, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if third link exists\n");
+        printf("    couldn't open copy of dataset\n");
         goto error;
     }
 
-    if (!link_exists) {
+    memset(read_buf, 0, sizeof(read_buf));
+
+    if (H5Dread(copy_id, OBJECT_COPY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    link 3 did not exist\n");
+        printf("    couldn't read from copy of dataset\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(subgroup2, LINK_VISIT_TEST_CYCLE_LINK_NAME4, H5P_DEFAULT)) < 0) {
+    for (i = 0; i < OBJECT_COPY_TEST_DIM0 * OBJECT_COPY_TEST_DIM1; i++)
+        if (read_buf[i] != write_buf[i]) {
+            H5_FAILED();
+            printf("    copy of dataset had %d at index %zu instead of %d\n", read_buf[i], i, write_buf[i]);
+            goto error;
+        }
+
+    if ((attr_exists = H5Aexists(copy_id, OBJECT_COPY_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if fourth link exists\n");
+        printf("    couldn't determine if attribute exists on copy of dataset\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if (!attr_exists) {
         H5_FAILED();
-        printf("    link 4 did not exist\n");
+        printf("    attribute wasn't copied\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback2, NULL) < 0) {
+    if ((attr_id = H5Aopen(copy_id, OBJECT_COPY_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in increasing order failed\n");
+        printf("    couldn't open attribute on copy of dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
-#endif
+    attr_value = 0;
 
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback2, NULL) < 0) {
+    if (H5Aread(attr_id, H5T_NATIVE_INT, &attr_value) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in decreasing order failed\n");
+        printf("    couldn't read attribute on copy of dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback2, NULL) < 0) {
+    if (attr_value != OBJECT_COPY_TEST_ATTR_VALUE) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in increasing order failed\n");
+        printf("    copied attribute had value %d instead of %d\n", attr_value, OBJECT_COPY_TEST_ATTR_VALUE);
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
-#endif
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(copy_id) < 0)
+        TEST_ERROR
 
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback2, NULL) < 0) {
+    /* A copy without attributes can't be made by the server, so its data is read and written in blocks */
+    if ((ocpypl_id = H5Pcreate(H5P_OBJECT_COPY)) < 0)
+        TEST_ERROR
+    if (H5Pset_copy_object(ocpypl_id, H5O_COPY_WITHOUT_ATTR_FLAG) < 0)
+        TEST_ERROR
+
+    if (H5Ocopy(group_id, OBJECT_COPY_TEST_DSET_NAME, group_id, OBJECT_COPY_TEST_DSET_NAME3, ocpypl_id,
+                H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
+        printf("    couldn't copy dataset without attributes\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
-#endif
-
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+    if ((copy_id = H5Dopen2(group_id, OBJECT_COPY_TEST_DSET_NAME3, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
+        printf("    couldn't open copy of dataset without attributes\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
-#endif
+    memset(read_buf, 0, sizeof(read_buf));
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+    if (H5Dread(copy_id, OBJECT_COPY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
+        printf("    couldn't read from copy of dataset without attributes\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with "
-         "H5Lvisit_by_name\n");
-#endif
+    for (i = 0; i < OBJECT_COPY_TEST_DIM0 * OBJECT_COPY_TEST_DIM1; i++)
+        if (read_buf[i] != write_buf[i]) {
+            H5_FAILED();
+            printf("    copy of dataset without attributes had %d at index %zu instead of %d\n", read_buf[i],
+                   i, write_buf[i]);
+            goto error;
+        }
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+    if ((attr_exists = H5Aexists(copy_id, OBJECT_COPY_TEST_ATTR_NAME)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
+        printf("    couldn't determine if attribute exists on copy of dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with "
-         "H5Lvisit_by_name\n");
-#endif
-
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_CYCLE_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback2, NULL, H5P_DEFAULT) < 0) {
+    if (attr_exists) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
+        printf("    attribute was copied despite H5O_COPY_WITHOUT_ATTR_FLAG\n");
         goto error;
     }
 
-    if (H5Gclose(subgroup1) < 0)
+    if (H5Pclose(ocpypl_id) < 0)
         TEST_ERROR
-    if (H5Gclose(subgroup2) < 0)
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(attr_space) < 0)
+        TEST_ERROR
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(copy_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -14622,8 +18879,13 @@ test_link_visit_cycles(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Gclose(subgroup1);
-        H5Gclose(subgroup2);
+        H5Pclose(ocpypl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(attr_space);
+        H5Sclose(space_id);
+        H5Aclose(attr_id);
+        H5Dclose(copy_id);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -14636,13 +18898,21 @@ error:
 }
 
 static int
-test_link_visit_0_links(void)
+test_h5o_copy_group(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1, group_id = -1;
-    hid_t subgroup1 = -1, subgroup2 = -1;
+    hsize_t dims[OBJECT_COPY_GROUP_TEST_DSET_SPACE_RANK];
+    size_t  i;
+    htri_t  link_exists;
+    int     write_buf[OBJECT_COPY_GROUP_TEST_DSET_DIM];
+    int     read_buf[OBJECT_COPY_GROUP_TEST_DSET_DIM];
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   src_id = -1, sub_id = -1, inner_id = -1;
+    hid_t   dset_id   = -1;
+    hid_t   ocpypl_id = -1;
+    hid_t   space_id  = -1;
 
-    TESTING("link visit on group with subgroups containing 0 links")
+    TESTING("object copy of a group")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -14658,122 +18928,239 @@ test_link_visit_0_links(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, OBJECT_COPY_GROUP_TEST_SUBGROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    if ((subgroup1 = H5Gcreate2(group_id, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME2, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
+    /* Build the group to copy: a dataset with a second hard link to it, and a subgroup holding a group
+     * and a link back up to the group being copied */
+    if ((src_id = H5Gcreate2(group_id, OBJECT_COPY_GROUP_TEST_SRC_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                             H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create first subgroup\n");
+        printf("    couldn't create group to copy\n");
         goto error;
     }
 
-    if ((subgroup2 = H5Gcreate2(group_id, LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME3, H5P_DEFAULT, H5P_DEFAULT,
-                                H5P_DEFAULT)) < 0) {
+    dims[0] = OBJECT_COPY_GROUP_TEST_DSET_DIM;
+
+    if ((space_id = H5Screate_simple(OBJECT_COPY_GROUP_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(src_id, OBJECT_COPY_GROUP_TEST_DSET_NAME, OBJECT_COPY_GROUP_TEST_DSET_DTYPE,
+                              space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create second subgroup\n");
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < OBJECT_COPY_GROUP_TEST_DSET_DIM; i++)
+        write_buf[i] = (int)i;
+
+    if (H5Dwrite(dset_id, OBJECT_COPY_GROUP_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if (H5Lcreate_hard(src_id, OBJECT_COPY_GROUP_TEST_DSET_NAME, src_id, OBJECT_COPY_GROUP_TEST_LINK_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create second hard link to dataset\n");
+        goto error;
+    }
+
+    if ((sub_id = H5Gcreate2(src_id, OBJECT_COPY_GROUP_TEST_SUB_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                             H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create subgroup\n");
+        goto error;
+    }
+
+    if ((inner_id = H5Gcreate2(sub_id, OBJECT_COPY_GROUP_TEST_INNER_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create group in subgroup\n");
+        goto error;
+    }
+
+    if (H5Lcreate_hard(group_id, OBJECT_COPY_GROUP_TEST_SRC_NAME, sub_id, OBJECT_COPY_GROUP_TEST_PARENT_NAME,
+                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create hard link back to group to copy\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Copying group with H5Ocopy\n");
+#endif
+
+    if (H5Ocopy(group_id, OBJECT_COPY_GROUP_TEST_SRC_NAME, group_id, OBJECT_COPY_GROUP_TEST_COPY_NAME,
+                H5P_DEFAULT, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't copy group\n");
+        goto error;
+    }
+
+    if ((link_exists = H5Lexists(group_id, OBJECT_COPY_GROUP_TEST_COPY_INNER_PATH, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if group in copied subgroup exists\n");
+        goto error;
+    }
+
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    group in subgroup wasn't copied\n");
+        goto error;
+    }
+
+    /* Both links to the dataset, and the link back up through the copied subgroup, must reach a single
+     * copy of it, separate from the original */
+    for (i = 0; i < OBJECT_COPY_GROUP_TEST_DSET_DIM; i++)
+        write_buf[i] = (int)(i + OBJECT_COPY_GROUP_TEST_DSET_DIM);
+
+    if ((dset_id = H5Dopen2(group_id, OBJECT_COPY_GROUP_TEST_COPY_DSET_PATH, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open copy of dataset\n");
+        goto error;
+    }
+
+    if (H5Dwrite(dset_id, OBJECT_COPY_GROUP_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to copy of dataset\n");
+        goto error;
+    }
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(group_id, OBJECT_COPY_GROUP_TEST_COPY_LINK_PATH, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open copy of dataset through its second link\n");
+        goto error;
+    }
+
+    memset(read_buf, 0, sizeof(read_buf));
+
+    if (H5Dread(dset_id, OBJECT_COPY_GROUP_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from copy of dataset through its second link\n");
+        goto error;
+    }
+
+    if (memcmp(read_buf, write_buf, sizeof(read_buf))) {
+        H5_FAILED();
+        printf("    second link to dataset was copied as a separate dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit\n");
-#endif
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_INC, link_visit_callback3, NULL) < 0) {
+    if ((dset_id = H5Dopen2(group_id, OBJECT_COPY_GROUP_TEST_COPY_CYCLE_PATH, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in increasing order failed\n");
+        printf("    couldn't open dataset through copy of link back up to group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit\n");
-#endif
+    memset(read_buf, 0, sizeof(read_buf));
 
-    if (H5Lvisit(group_id, H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback3, NULL) < 0) {
+    if (H5Dread(dset_id, OBJECT_COPY_GROUP_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type name in decreasing order failed\n");
+        printf("    couldn't read from dataset through copy of link back up to group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with H5Lvisit\n");
-#endif
-
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback3, NULL) < 0) {
+    if (memcmp(read_buf, write_buf, sizeof(read_buf))) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in increasing order failed\n");
+        printf("    copy of link back up to group doesn't point to the copied group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with H5Lvisit\n");
-#endif
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
 
-    if (H5Lvisit(group_id, H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback3, NULL) < 0) {
+    if ((dset_id = H5Dopen2(group_id, OBJECT_COPY_GROUP_TEST_SRC_DSET_PATH, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit by index type creation order in decreasing order failed\n");
+        printf("    couldn't open original dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in increasing order with H5Lvisit_by_name\n");
-#endif
+    memset(read_buf, 0, sizeof(read_buf));
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_INC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
+    if (H5Dread(dset_id, OBJECT_COPY_GROUP_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in increasing order failed\n");
+        printf("    couldn't read from original dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link name in decreasing order with H5Lvisit_by_name\n");
-#endif
+    for (i = 0; i < OBJECT_COPY_GROUP_TEST_DSET_DIM; i++)
+        if (read_buf[i] != (int)i) {
+            H5_FAILED();
+            printf("    writing to copy of dataset changed the original\n");
+            goto error;
+        }
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
-                         H5_INDEX_NAME, H5_ITER_DEC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    /* A shallow copy copies the subgroup, but not the group in it */
+    if ((ocpypl_id = H5Pcreate(H5P_OBJECT_COPY)) < 0)
+        TEST_ERROR
+    if (H5Pset_copy_object(ocpypl_id, H5O_COPY_SHALLOW_HIERARCHY_FLAG) < 0)
+        TEST_ERROR
+
+    if (H5Ocopy(group_id, OBJECT_COPY_GROUP_TEST_SRC_NAME, group_id, OBJECT_COPY_GROUP_TEST_SHALLOW_NAME,
+                ocpypl_id, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type name in decreasing order failed\n");
+        printf("    couldn't make shallow copy of group\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in increasing order with "
-         "H5Lvisit_by_name\n");
-#endif
+    if ((link_exists = H5Lexists(group_id, OBJECT_COPY_GROUP_TEST_SHALLOW_SUB_PATH, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if subgroup exists in shallow copy\n");
+        goto error;
+    }
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_INC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in increasing order failed\n");
+        printf("    subgroup wasn't copied by shallow copy\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Recursively iterating over links by link creation order in decreasing order with "
-         "H5Lvisit_by_name\n");
-#endif
+    if ((link_exists = H5Lexists(group_id, OBJECT_COPY_GROUP_TEST_SHALLOW_INNER_PATH, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if group in subgroup exists in shallow copy\n");
+        goto error;
+    }
 
-    if (H5Lvisit_by_name(file_id, "/" LINK_TEST_GROUP_NAME "/" LINK_VISIT_TEST_0_LINKS_SUBGROUP_NAME,
-                         H5_INDEX_CRT_ORDER, H5_ITER_DEC, link_visit_callback3, NULL, H5P_DEFAULT) < 0) {
+    if (link_exists) {
         H5_FAILED();
-        printf("    H5Lvisit_by_name by index type creation order in decreasing order failed\n");
+        printf("    shallow copy copied members of subgroup\n");
         goto error;
     }
 
-    if (H5Gclose(subgroup1) < 0)
+    if (H5Pclose(ocpypl_id) < 0)
         TEST_ERROR
-    if (H5Gclose(subgroup2) < 0)
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(inner_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(sub_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(src_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -14793,8 +19180,12 @@ test_link_visit_0_links(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Gclose(subgroup1);
-        H5Gclose(subgroup2);
+        H5Pclose(ocpypl_id);
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
+        H5Gclose(inner_id);
+        H5Gclose(sub_id);
+        H5Gclose(src_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -14807,38 +19198,18 @@ error:
 }
 
 static int
-test_unused_link_API_calls(void)
-{
-    TESTING("unused link API calls")
-
-    /* None currently that aren't planned to be used */
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Currently no API calls to test here\n");
-#endif
-
-    SKIPPED();
-
-    return 0;
-}
-
-/*****************************************************
- *                                                   *
- *           Plugin Object Interface tests           *
- *                                                   *
- *****************************************************/
-
-static int
-test_open_dataset_generically(void)
+test_h5o_close(void)
 {
-    hsize_t dims[GENERIC_DATASET_OPEN_TEST_SPACE_RANK];
+    hsize_t dims[H5O_CLOSE_TEST_SPACE_RANK];
     size_t  i;
     hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   dset_id         = -1;
-    hid_t   dset_dtype      = -1;
-    hid_t   fspace_id       = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   fspace_id  = -1;
+    hid_t   dtype_id   = -1;
+    hid_t   dset_id    = -1;
+    hid_t   dset_dtype = -1;
 
-    TESTING("open dataset generically w/ H5Oopen()")
+    TESTING("H5Oclose")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -14860,77 +19231,74 @@ test_open_dataset_generically(void)
         goto error;
     }
 
-    for (i = 0; i < GENERIC_DATASET_OPEN_TEST_SPACE_RANK; i++)
+    for (i = 0; i < H5O_CLOSE_TEST_SPACE_RANK; i++)
         dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((fspace_id = H5Screate_simple(GENERIC_DATASET_OPEN_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(H5O_CLOSE_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
     if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, GENERIC_DATASET_OPEN_TEST_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(container_group, H5O_CLOSE_TEST_DSET_NAME, dset_dtype, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
+    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype\n");
+        goto error;
+    }
+
+    if (H5Tcommit2(container_group, H5O_CLOSE_TEST_TYPE_NAME, dtype_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't commit datatype\n");
+        goto error;
+    }
+
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
+    if (H5Tclose(dtype_id) < 0)
+        TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Opening dataset with H5Oopen\n");
-#endif
+    if ((group_id = H5Oopen(file_id, "/", H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open group with H5Oopen()\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_DATASET_OPEN_TEST_DSET_NAME,
-                           H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" H5O_CLOSE_TEST_DSET_NAME, H5P_DEFAULT)) <
+        0) {
         H5_FAILED();
         printf("    couldn't open dataset with H5Oopen()\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-#if 0
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-#endif
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Opening dataset with H5Oopen_by_idx\n");
-#endif
-
-        if ((/*dset_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
-                                           H5P_DEFAULT)) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (H5Dclose(dset_id) < 0)
-            TEST_ERROR
-#endif
+    if ((dtype_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" H5O_CLOSE_TEST_TYPE_NAME, H5P_DEFAULT)) <
+        0) {
+        H5_FAILED();
+        printf("    couldn't open datatype with H5Oopen()\n");
+        goto error;
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Opening dataset with H5Oopen_by_addr\n");
+    puts("Making sure H5Oclose does its job correctly\n");
 #endif
 
-        if ((/*dset_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
+    if (H5Oclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Oclose(dtype_id) < 0)
+        TEST_ERROR
+    if (H5Oclose(dset_id) < 0)
+        TEST_ERROR
     if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
     if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -14949,7 +19317,9 @@ error:
     {
         H5Sclose(fspace_id);
         H5Tclose(dset_dtype);
+        H5Tclose(dtype_id);
         H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -14961,13 +19331,12 @@ error:
 }
 
 static int
-test_open_group_generically(void)
+test_object_visit(void)
 {
     hid_t file_id = -1, fapl_id = -1;
     hid_t container_group = -1;
-    hid_t group_id        = -1;
 
-    TESTING("open group generically w/ H5Oopen()")
+    TESTING("H5Ovisit")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -14989,64 +19358,37 @@ test_open_group_generically(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, GENERIC_GROUP_OPEN_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create group\n");
-        goto error;
-    }
-
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Opening group with H5Oopen\n");
-#endif
-
-    if ((group_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_GROUP_OPEN_TEST_GROUP_NAME,
-                            H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open group with H5Oopen()\n");
-        goto error;
-    }
-
     H5E_BEGIN_TRY
     {
-#if 0
-        if (H5Gclose(group_id) < 0)
-            TEST_ERROR
-#endif
-
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Opening group with H5Oopen_by_idx\n");
+        puts("Visiting objects with H5Ovisit\n");
 #endif
 
-        if ((/*group_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC,
-                                            0, H5P_DEFAULT)) >= 0) {
+        if (H5Ovisit3(container_group, H5_INDEX_NAME, H5_ITER_INC, object_visit_callback, NULL,
+                      H5O_INFO_ALL) < 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded!\n");
+            printf("    H5Ovisit using container_group failed!\n");
+            goto error;
+        }
+        if (H5Ovisit(file_id, H5_INDEX_NAME, H5_ITER_DEC, object_visit_callback, NULL, H5O_INFO_ALL) < 0) {
+            H5_FAILED();
+            printf("    H5Ovisit using file_id failed!\n");
             goto error;
         }
-
-#if 0
-        if (H5Gclose(group_id) < 0)
-            TEST_ERROR
-#endif
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Opening group with H5Oopen_by_addr\n");
+        puts("Visiting objects with H5Ovisit_by_name\n");
 #endif
 
-        if ((/*group_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
+        if (H5Ovisit_by_name3(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC,
+                              object_visit_callback, NULL, H5O_INFO_ALL, H5P_DEFAULT) < 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded!\n");
+            printf("    H5Ovisit failed!\n");
             goto error;
         }
     }
     H5E_END_TRY;
 
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -15063,7 +19405,6 @@ test_open_group_generically(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -15075,13 +19416,15 @@ error:
 }
 
 static int
-test_open_datatype_generically(void)
+test_create_obj_ref(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1;
-    hid_t type_id         = -1;
+    rv_obj_ref_t ref;
+    hid_t        file_id = -1, fapl_id = -1;
 
-    TESTING("open datatype generically w/ H5Oopen()")
+    TESTING("create an object reference")
+
+    SKIPPED()
+    return 0;
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15097,78 +19440,23 @@ test_open_datatype_generically(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
-
-    if ((type_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create datatype\n");
-        goto error;
-    }
-
-    if (H5Tcommit2(container_group, GENERIC_DATATYPE_OPEN_TEST_TYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't commit datatype\n");
-        goto error;
-    }
-
-    if (H5Tclose(type_id) < 0)
-        TEST_ERROR
-
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Opening datatype with H5Oopen\n");
+    puts("Creating an object reference\n");
 #endif
 
-    if ((type_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" GENERIC_DATATYPE_OPEN_TEST_TYPE_NAME,
-                           H5P_DEFAULT)) < 0) {
+    if (H5Rcreate((void *)&ref, file_id, "/", H5R_OBJECT, -1) < 0) {
         H5_FAILED();
-        printf("    couldn't open datatype generically w/ H5Oopen()\n");
+        printf("    couldn't create obj. ref\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
-    {
-#if 0
-        if (H5Tclose(type_id) < 0)
-            TEST_ERROR
-#endif
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Opening datatype with H5Oopen_by_idx\n");
-#endif
-
-        if ((/*type_id = */ H5Oopen_by_idx(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC, 0,
-                                           H5P_DEFAULT)) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-
-#if 0
-        if (H5Tclose(type_id) < 0)
-            TEST_ERROR
-#endif
-
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Opening datatype with H5Oopen_by_addr\n");
-#endif
-
-        if ((/*type_id = */ H5Oopen_by_addr(file_id, 0)) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
-    }
-    H5E_END_TRY;
-
-    if (H5Tclose(type_id) < 0)
+    if (H5R_OBJECT != ref.ref_type)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
+    if (H5I_GROUP != ref.ref_obj_type)
         TEST_ERROR
+    if (strcmp(H5rest_get_object_uri(file_id), ref.ref_obj_URI))
+        TEST_ERROR
+
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
     if (H5Fclose(file_id) < 0)
@@ -15183,8 +19471,6 @@ test_open_datatype_generically(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Tclose(type_id);
-        H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
         H5rest_term();
@@ -15195,18 +19481,34 @@ error:
 }
 
 static int
-test_object_exists(void)
+test_dereference_reference(void)
 {
-    hsize_t dims[OBJECT_EXISTS_TEST_DSET_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dtype_id   = -1;
-    hid_t   fspace_id  = -1;
-    hid_t   dset_dtype = -1;
+    TESTING("dereference a reference")
 
-    TESTING("object exists by name")
+    /* H5Rdereference2 */
+
+    SKIPPED();
+
+    return 0;
+}
+
+static int
+test_get_ref_type(void)
+{
+    rv_obj_ref_t ref_array[3];
+    H5O_type_t   obj_type;
+    hsize_t      dims[OBJ_REF_GET_TYPE_TEST_SPACE_RANK];
+    size_t       i;
+    hid_t        file_id = -1, fapl_id = -1;
+    hid_t        container_group = -1, group_id = -1;
+    hid_t        ref_dset_id    = -1;
+    hid_t        ref_dtype_id   = -1;
+    hid_t        ref_dset_dtype = -1;
+    hid_t        space_id       = -1;
+
+    TESTING("retrieve type of object reference by an object/region reference")
+    SKIPPED()
+    return 0;
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15228,84 +19530,133 @@ test_object_exists(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, OBJECT_EXISTS_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, OBJ_REF_GET_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
                                H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't create container sub-group\n");
         goto error;
     }
 
-    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    for (i = 0; i < OBJ_REF_GET_TYPE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % 8 + 1);
+
+    if ((space_id = H5Screate_simple(OBJ_REF_GET_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    /* Create the dataset and datatype which will be referenced */
+    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_GET_TYPE_TEST_DSET_NAME, ref_dset_dtype, space_id,
+                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create dataset for referencing\n");
+        goto error;
     }
 
-    if (H5Tcommit2(group_id, OBJECT_EXISTS_TEST_DTYPE_NAME, dtype_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) <
-        0) {
+    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create datatype\n");
         goto error;
     }
 
-    for (i = 0; i < OBJECT_EXISTS_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((fspace_id = H5Screate_simple(OBJECT_EXISTS_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
-
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-
-    if ((dset_id = H5Dcreate2(group_id, OBJECT_EXISTS_TEST_DSET_NAME, dset_dtype, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5Tcommit2(group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create datatype for referencing\n");
         goto error;
     }
 
-    H5E_BEGIN_TRY
     {
-        /* H5Oexists_by_name for hard links should always succeed. */
+        /* TODO: Temporary workaround for datatypes */
+        if (H5Tclose(ref_dtype_id) < 0)
+            TEST_ERROR
 
-        /* Check if the group exists */
-        if (H5Oexists_by_name(file_id, OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME,
-                              H5P_DEFAULT) >= 0) {
+        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, H5P_DEFAULT)) < 0) {
             H5_FAILED();
-            printf("    unsupported API succeeded!\n");
+            printf("    couldn't open datatype for referencing\n");
             goto error;
         }
+    }
 
-        /* Check if the datatype exists */
-        if (H5Oexists_by_name(file_id,
-                              OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME
-                                                     "/" OBJECT_EXISTS_TEST_DTYPE_NAME,
-                              H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+    /* Create and check the group reference */
+    if (H5Rcreate(&ref_array[0], file_id, "/", H5R_OBJECT, -1) < 0) {
+        H5_FAILED();
+        printf("    couldn't create group object reference\n");
+        goto error;
+    }
 
-        /* Check if the dataset exists */
-        if (H5Oexists_by_name(file_id,
-                              OBJECT_TEST_GROUP_NAME "/" OBJECT_EXISTS_TEST_SUBGROUP_NAME
-                                                     "/" OBJECT_EXISTS_TEST_DSET_NAME,
-                              H5P_DEFAULT) >= 0) {
-            H5_FAILED();
-            printf("    unsupported API succeeded!\n");
-            goto error;
-        }
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving the type of the referenced object for this reference\n");
+#endif
 
-        /* Checking for a soft link may fail if the link doesn't resolve. */
+    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[0], &obj_type) < 0) {
+        H5_FAILED();
+        printf("    couldn't get object reference's object type\n");
+        goto error;
+    }
+
+    if (H5O_TYPE_GROUP != obj_type) {
+        H5_FAILED();
+        printf("    referenced object was not a group\n");
+        goto error;
+    }
+
+    /* Create and check the datatype reference */
+    if (H5Rcreate(&ref_array[1], group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, H5R_OBJECT, -1) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype object reference\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving the type of the referenced object for this reference\n");
+#endif
+
+    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[1], &obj_type) < 0) {
+        H5_FAILED();
+        printf("    couldn't get object reference's object type\n");
+        goto error;
+    }
+
+    if (H5O_TYPE_NAMED_DATATYPE != obj_type) {
+        H5_FAILED();
+        printf("    referenced object was not a datatype\n");
+        goto error;
+    }
+
+    /* Create and check the dataset reference */
+    if (H5Rcreate(&ref_array[2], group_id, OBJ_REF_GET_TYPE_TEST_DSET_NAME, H5R_OBJECT, -1) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset object reference\n");
+        goto error;
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Retrieving the type of the referenced object for this reference\n");
+#endif
+
+    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[2], &obj_type) < 0) {
+        H5_FAILED();
+        printf("    couldn't get object reference's object type\n");
+        goto error;
+    }
+
+    if (H5O_TYPE_DATASET != obj_type) {
+        H5_FAILED();
+        printf("    referenced object was not a dataset\n");
+        goto error;
     }
-    H5E_END_TRY;
 
-    if (H5Sclose(fspace_id) < 0)
+    /* TODO: Support for region references in this test */
+
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Tclose(ref_dset_dtype) < 0)
         TEST_ERROR
-    if (H5Tclose(dtype_id) < 0)
+    if (H5Tclose(ref_dtype_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Dclose(ref_dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -15325,10 +19676,10 @@ test_object_exists(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Tclose(dtype_id);
-        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Tclose(ref_dset_dtype);
+        H5Tclose(ref_dtype_id);
+        H5Dclose(ref_dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -15341,73 +19692,45 @@ error:
 }
 
 static int
-test_incr_decr_refcount(void)
+test_get_ref_name(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-
-    TESTING("H5Oincr/decr_refcount")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
+    TESTING("get ref. name")
 
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
+    /* H5Rget_name */
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open file\n");
-        goto error;
-    }
+    SKIPPED();
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Testing unsupported APIs H5Oincr/decr_refcount\n");
-#endif
+    return 0;
+}
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Oincr_refcount(file_id) >= 0)
-            TEST_ERROR
-        if (H5Odecr_refcount(file_id) >= 0)
-            TEST_ERROR
-    }
-    H5E_END_TRY;
+static int
+test_get_region(void)
+{
+    TESTING("get region for region reference")
 
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
+    /* H5Rget_region */
 
-    PASSED();
+    SKIPPED();
 
     return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Pclose(fapl_id);
-        H5Fclose(file_id);
-        H5rest_term();
-    }
-    H5E_END_TRY;
-
-    return 1;
 }
 
 static int
-test_h5o_copy(void)
+test_write_dataset_w_obj_refs(void)
 {
-    hsize_t dims[OBJECT_COPY_TEST_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id  = -1;
-    hid_t   space_id = -1;
+    rv_obj_ref_t *ref_array = NULL;
+    hsize_t       dims[OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK];
+    size_t        i, ref_array_size = 0;
+    hid_t         file_id = -1, fapl_id = -1;
+    hid_t         container_group = -1, group_id = -1;
+    hid_t         dset_id = -1, ref_dset_id = -1;
+    hid_t         ref_dtype_id   = -1;
+    hid_t         ref_dset_dtype = -1;
+    hid_t         space_id       = -1;
 
-    TESTING("object copy")
+    TESTING("write to a dataset w/ object reference type")
+    SKIPPED()
+    return 0;
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15429,43 +19752,145 @@ test_h5o_copy(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, OBJECT_COPY_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_WRITE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container subgroup\n");
+        printf("    couldn't create container sub-group\n");
         goto error;
     }
 
-    for (i = 0; i < OBJECT_COPY_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    for (i = 0; i < OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % 8 + 1);
 
-    if ((space_id = H5Screate_simple(OBJECT_COPY_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, OBJECT_COPY_TEST_DSET_NAME, OBJECT_COPY_TEST_DSET_DTYPE, space_id,
+    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+
+    /* Create the dataset and datatype which will be referenced */
+    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_DSET_NAME, ref_dset_dtype,
+                                  space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset for referencing\n");
+        goto error;
+    }
+
+    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype\n");
+        goto error;
+    }
+
+    if (H5Tcommit2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        printf("    couldn't create datatype for referencing\n");
+        goto error;
+    }
+
+    {
+        /* TODO: Temporary workaround for datatypes */
+        if (H5Tclose(ref_dtype_id) < 0)
+            TEST_ERROR
+
+        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open datatype for referencing\n");
+            goto error;
+        }
+    }
+
+    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_WRITE_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Copying object with H5Ocopy\n");
-#endif
+    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK; i++)
+        ref_array_size *= dims[i];
 
-    H5E_BEGIN_TRY
-    {
-        if (H5Ocopy(group_id, OBJECT_COPY_TEST_DSET_NAME, group_id, OBJECT_COPY_TEST_DSET_NAME2, H5P_DEFAULT,
-                    H5P_DEFAULT) >= 0) {
+    if (NULL == (ref_array = (rv_obj_ref_t *)malloc(ref_array_size * sizeof(*ref_array))))
+        TEST_ERROR
+
+    for (i = 0; i < dims[0]; i++) {
+        const char *URI;
+
+        /* Create a reference to either a group, datatype or dataset */
+        switch (rand() % 3) {
+            case 0:
+                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(file_id)))
+                    TEST_ERROR
+
+                break;
+
+            case 1:
+                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, H5R_OBJECT,
+                              -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(ref_dtype_id)))
+                    TEST_ERROR
+
+                break;
+
+            case 2:
+                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_WRITE_TEST_REF_DSET_NAME, H5R_OBJECT,
+                              -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(ref_dset_id)))
+                    TEST_ERROR
+
+                break;
+
+            default:
+                TEST_ERROR
+        }
+
+        if (strcmp(URI, ref_array[i].ref_obj_URI)) {
             H5_FAILED();
-            printf("    unsupported API succeeded\n");
+            printf("    ref type had mismatched URI\n");
             goto error;
         }
     }
-    H5E_END_TRY;
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Writing to dataset with buffer of object references\n");
+#endif
+
+    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
+    }
+
+    if (ref_array) {
+        free(ref_array);
+        ref_array = NULL;
+    }
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
+    if (H5Tclose(ref_dset_dtype) < 0)
+        TEST_ERROR
+    if (H5Tclose(ref_dtype_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(ref_dset_id) < 0)
+        TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
@@ -15486,7 +19911,12 @@ test_h5o_copy(void)
 error:
     H5E_BEGIN_TRY
     {
+        if (ref_array)
+            free(ref_array);
         H5Sclose(space_id);
+        H5Tclose(ref_dset_dtype);
+        H5Tclose(ref_dtype_id);
+        H5Dclose(ref_dset_id);
         H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
@@ -15500,18 +19930,22 @@ error:
 }
 
 static int
-test_h5o_close(void)
+test_read_dataset_w_obj_refs(void)
 {
-    hsize_t dims[H5O_CLOSE_TEST_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   fspace_id  = -1;
-    hid_t   dtype_id   = -1;
-    hid_t   dset_id    = -1;
-    hid_t   dset_dtype = -1;
+    rv_obj_ref_t *ref_array = NULL;
+    hsize_t       dims[OBJ_REF_DATASET_READ_TEST_SPACE_RANK];
+    size_t        i, ref_array_size = 0;
+    hid_t         file_id = -1, fapl_id = -1;
+    hid_t         container_group = -1, group_id = -1;
+    hid_t         dset_id = -1, ref_dset_id = -1;
+    hid_t         ref_dtype_id   = -1;
+    hid_t         ref_dset_dtype = -1;
+    hid_t         space_id       = -1;
 
-    TESTING("H5Oclose")
+    TESTING("read from a dataset w/ object reference type")
+
+    SKIPPED()
+    return 0;
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15533,73 +19967,195 @@ test_h5o_close(void)
         goto error;
     }
 
-    for (i = 0; i < H5O_CLOSE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_READ_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group\n");
+        goto error;
+    }
 
-    if ((fspace_id = H5Screate_simple(H5O_CLOSE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    for (i = 0; i < OBJ_REF_DATASET_READ_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % 8 + 1);
+
+    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_READ_TEST_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, H5O_CLOSE_TEST_DSET_NAME, dset_dtype, fspace_id, H5P_DEFAULT,
-                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Create the dataset and datatype which will be referenced */
+    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_READ_TEST_REF_DSET_NAME, ref_dset_dtype, space_id,
+                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create dataset for referencing\n");
         goto error;
     }
 
-    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
         printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if (H5Tcommit2(container_group, H5O_CLOSE_TEST_TYPE_NAME, dtype_id, H5P_DEFAULT, H5P_DEFAULT,
+    if (H5Tcommit2(group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
                    H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't commit datatype\n");
+        printf("    couldn't create datatype for referencing\n");
         goto error;
     }
 
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dtype_id) < 0)
-        TEST_ERROR
+    {
+        /* TODO: Temporary workaround for datatypes */
+        if (H5Tclose(ref_dtype_id) < 0)
+            TEST_ERROR
 
-    if ((group_id = H5Oopen(file_id, "/", H5P_DEFAULT)) < 0) {
+        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open datatype for referencing\n");
+            goto error;
+        }
+    }
+
+    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_READ_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open group with H5Oopen()\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if ((dset_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" H5O_CLOSE_TEST_DSET_NAME, H5P_DEFAULT)) <
-        0) {
+    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_READ_TEST_SPACE_RANK; i++)
+        ref_array_size *= dims[i];
+
+    if (NULL == (ref_array = (rv_obj_ref_t *)malloc(ref_array_size * sizeof(*ref_array))))
+        TEST_ERROR
+
+    for (i = 0; i < dims[0]; i++) {
+        const char *URI;
+
+        /* Create a reference to either a group, datatype or dataset */
+        switch (rand() % 3) {
+            case 0:
+                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(file_id)))
+                    TEST_ERROR
+
+                break;
+
+            case 1:
+                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, H5R_OBJECT,
+                              -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(ref_dtype_id)))
+                    TEST_ERROR
+
+                break;
+
+            case 2:
+                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_READ_TEST_REF_DSET_NAME, H5R_OBJECT,
+                              -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(ref_dset_id)))
+                    TEST_ERROR
+
+                break;
+
+            default:
+                TEST_ERROR
+        }
+
+        if (strcmp(URI, ref_array[i].ref_obj_URI)) {
+            H5_FAILED();
+            printf("    ref type had mismatched URI\n");
+            goto error;
+        }
+    }
+
+    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset with H5Oopen()\n");
+        printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    if ((dtype_id = H5Oopen(file_id, "/" OBJECT_TEST_GROUP_NAME "/" H5O_CLOSE_TEST_TYPE_NAME, H5P_DEFAULT)) <
-        0) {
+    /* Now read from the dataset */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dopen2(group_id, OBJ_REF_DATASET_READ_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open datatype with H5Oopen()\n");
+        printf("    couldn't open dataset\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Making sure H5Oclose does its job correctly\n");
+    puts("Reading from dataset with object reference type\n");
 #endif
 
-    if (H5Oclose(group_id) < 0)
+    memset(ref_array, 0, ref_array_size * sizeof(*ref_array));
+
+    if (H5Dread(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+        H5_FAILED();
+        printf("    couldn't read from dataset\n");
+        goto error;
+    }
+
+    for (i = 0; i < dims[0]; i++) {
+        /* Check the reference type */
+        if (H5R_OBJECT != ref_array[i].ref_type) {
+            H5_FAILED();
+            printf("    ref type was not H5R_OBJECT\n");
+            goto error;
+        }
+
+        /* Check the object type referenced */
+        if (H5I_FILE != ref_array[i].ref_obj_type && H5I_GROUP != ref_array[i].ref_obj_type &&
+            H5I_DATATYPE != ref_array[i].ref_obj_type && H5I_DATASET != ref_array[i].ref_obj_type) {
+            H5_FAILED();
+            printf("    ref object type mismatch\n");
+            goto error;
+        }
+
+        /* Check the URI of the referenced object according to
+         * the server spec where each URI is prefixed as
+         * 'X-', where X is a character denoting the type
+         * of object */
+        if ((ref_array[i].ref_obj_URI[1] != '-') ||
+            (ref_array[i].ref_obj_URI[0] != 'g' && ref_array[i].ref_obj_URI[0] != 't' &&
+             ref_array[i].ref_obj_URI[0] != 'd')) {
+            H5_FAILED();
+            printf("    ref URI mismatch\n");
+            goto error;
+        }
+    }
+
+    if (ref_array) {
+        free(ref_array);
+        ref_array = NULL;
+    }
+
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Oclose(dtype_id) < 0)
+    if (H5Tclose(ref_dset_dtype) < 0)
         TEST_ERROR
-    if (H5Oclose(dset_id) < 0)
+    if (H5Tclose(ref_dtype_id) < 0)
         TEST_ERROR
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Dclose(ref_dset_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
@@ -15617,9 +20173,12 @@ test_h5o_close(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Tclose(dtype_id);
+        if (ref_array)
+            free(ref_array);
+        H5Sclose(space_id);
+        H5Tclose(ref_dset_dtype);
+        H5Tclose(ref_dtype_id);
+        H5Dclose(ref_dset_id);
         H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
@@ -15633,12 +20192,20 @@ error:
 }
 
 static int
-test_object_visit(void)
+test_write_dataset_w_obj_refs_empty_data(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
-    hid_t container_group = -1;
+    rv_obj_ref_t *ref_array = NULL;
+    hsize_t       dims[OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK];
+    size_t        i, ref_array_size = 0;
+    hid_t         file_id = -1, fapl_id = -1;
+    hid_t         container_group = -1, group_id = -1;
+    hid_t         dset_id  = -1;
+    hid_t         space_id = -1;
 
-    TESTING("H5Ovisit")
+    TESTING("write to a dataset w/ object reference type and some empty data")
+
+    SKIPPED()
+    return 0;
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15654,43 +20221,89 @@ test_object_visit(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_EMPTY_WRITE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create container sub-group");
+        goto error;
+    }
+
+    for (i = 0; i < OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % 8 + 1);
+
+    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_EMPTY_WRITE_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset\n");
+        goto error;
+    }
+
+    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK; i++)
+        ref_array_size *= dims[i];
+
+    if (NULL == (ref_array = (rv_obj_ref_t *)calloc(1, ref_array_size * sizeof(*ref_array))))
+        TEST_ERROR
+
+    for (i = 0; i < dims[0]; i++) {
+        const char *URI;
+
+        switch (rand() % 2) {
+            case 0:
+                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
+                    H5_FAILED();
+                    printf("    couldn't create reference\n");
+                    goto error;
+                }
+
+                if (NULL == (URI = H5rest_get_object_uri(file_id)))
+                    TEST_ERROR
+
+                if (strcmp(URI, ref_array[i].ref_obj_URI)) {
+                    H5_FAILED();
+                    printf("    ref type had mismatched URI\n");
+                    goto error;
+                }
+
+                break;
 
-    H5E_BEGIN_TRY
-    {
-#ifdef RV_CONNECTOR_DEBUG
-        puts("Visiting objects with H5Ovisit\n");
-#endif
+            case 1:
+                break;
 
-        if (H5Ovisit3(container_group, H5_INDEX_NAME, H5_ITER_INC, object_visit_callback, NULL,
-                      H5O_INFO_ALL) < 0) {
-            H5_FAILED();
-            printf("    H5Ovisit using container_group failed!\n");
-            goto error;
-        }
-        if (H5Ovisit(file_id, H5_INDEX_NAME, H5_ITER_DEC, object_visit_callback, NULL, H5O_INFO_ALL) < 0) {
-            H5_FAILED();
-            printf("    H5Ovisit using file_id failed!\n");
-            goto error;
+            default:
+                TEST_ERROR
         }
+    }
 
 #ifdef RV_CONNECTOR_DEBUG
-        puts("Visiting objects with H5Ovisit_by_name\n");
+    puts("Writing to dataset with buffer of empty object references\n");
 #endif
 
-        if (H5Ovisit_by_name3(file_id, "/" OBJECT_TEST_GROUP_NAME, H5_INDEX_NAME, H5_ITER_INC,
-                              object_visit_callback, NULL, H5O_INFO_ALL, H5P_DEFAULT) < 0) {
-            H5_FAILED();
-            printf("    H5Ovisit failed!\n");
-            goto error;
-        }
+    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+        H5_FAILED();
+        printf("    couldn't write to dataset\n");
+        goto error;
     }
-    H5E_END_TRY;
 
+    if (ref_array) {
+        free(ref_array);
+        ref_array = NULL;
+    }
+
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
@@ -15707,6 +20320,9 @@ test_object_visit(void)
 error:
     H5E_BEGIN_TRY
     {
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
         H5Fclose(file_id);
@@ -15718,15 +20334,11 @@ error:
 }
 
 static int
-test_create_obj_ref(void)
+test_unused_object_API_calls(void)
 {
-    rv_obj_ref_t ref;
-    hid_t        file_id = -1, fapl_id = -1;
-
-    TESTING("create an object reference")
+    hid_t file_id = -1, fapl_id = -1;
 
-    SKIPPED()
-    return 0;
+    TESTING("unused object API calls")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15743,21 +20355,19 @@ test_create_obj_ref(void)
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Creating an object reference\n");
+    puts("Testing that all of the unused object API calls don't cause application issues\n");
 #endif
 
-    if (H5Rcreate((void *)&ref, file_id, "/", H5R_OBJECT, -1) < 0) {
-        H5_FAILED();
-        printf("    couldn't create obj. ref\n");
-        goto error;
-    }
+    H5E_BEGIN_TRY
+    {
+        const char *comment = "comment";
 
-    if (H5R_OBJECT != ref.ref_type)
-        TEST_ERROR
-    if (H5I_GROUP != ref.ref_obj_type)
-        TEST_ERROR
-    if (strcmp(H5rest_get_object_uri(file_id), ref.ref_obj_URI))
-        TEST_ERROR
+        if (H5Oset_comment(file_id, comment) >= 0)
+            TEST_ERROR
+        if (H5Oset_comment_by_name(file_id, "/", comment, H5P_DEFAULT) >= 0)
+            TEST_ERROR
+    }
+    H5E_END_TRY;
 
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
@@ -15782,35 +20392,25 @@ error:
     return 1;
 }
 
-static int
-test_dereference_reference(void)
-{
-    TESTING("dereference a reference")
-
-    /* H5Rdereference2 */
-
-    SKIPPED();
-
-    return 0;
-}
+/*****************************************************
+ *                                                   *
+ *                Miscellaneous tests                *
+ *                                                   *
+ *****************************************************/
 
 static int
-test_get_ref_type(void)
+test_open_link_without_leading_slash(void)
 {
-    rv_obj_ref_t ref_array[3];
-    H5O_type_t   obj_type;
-    hsize_t      dims[OBJ_REF_GET_TYPE_TEST_SPACE_RANK];
-    size_t       i;
-    hid_t        file_id = -1, fapl_id = -1;
-    hid_t        container_group = -1, group_id = -1;
-    hid_t        ref_dset_id    = -1;
-    hid_t        ref_dtype_id   = -1;
-    hid_t        ref_dset_dtype = -1;
-    hid_t        space_id       = -1;
+    hsize_t dims[OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1;
+    hid_t   group_id        = -1;
+    hid_t   dset_id         = -1;
+    hid_t   dset_dtype      = -1;
+    hid_t   space_id        = -1;
 
-    TESTING("retrieve type of object reference by an object/region reference")
-    SKIPPED()
-    return 0;
+    TESTING("opening a link without a leading slash")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -15826,143 +20426,70 @@ test_get_ref_type(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, OBJ_REF_GET_TYPE_TEST_SUBGROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
-                               H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container sub-group\n");
-        goto error;
-    }
-
-    for (i = 0; i < OBJ_REF_GET_TYPE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % 8 + 1);
+    for (i = 0; i < OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(OBJ_REF_GET_TYPE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((space_id = H5Screate_simple(OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    /* Create the dataset and datatype which will be referenced */
-    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_GET_TYPE_TEST_DSET_NAME, ref_dset_dtype, space_id,
-                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create dataset for referencing\n");
-        goto error;
-    }
-
-    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create datatype\n");
-        goto error;
-    }
-
-    if (H5Tcommit2(group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't create datatype for referencing\n");
-        goto error;
-    }
-
-    {
-        /* TODO: Temporary workaround for datatypes */
-        if (H5Tclose(ref_dtype_id) < 0)
-            TEST_ERROR
-
-        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't open datatype for referencing\n");
-            goto error;
-        }
-    }
-
-    /* Create and check the group reference */
-    if (H5Rcreate(&ref_array[0], file_id, "/", H5R_OBJECT, -1) < 0) {
-        H5_FAILED();
-        printf("    couldn't create group object reference\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving the type of the referenced object for this reference\n");
-#endif
-
-    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[0], &obj_type) < 0) {
-        H5_FAILED();
-        printf("    couldn't get object reference's object type\n");
-        goto error;
-    }
-
-    if (H5O_TYPE_GROUP != obj_type) {
-        H5_FAILED();
-        printf("    referenced object was not a group\n");
-        goto error;
-    }
-
-    /* Create and check the datatype reference */
-    if (H5Rcreate(&ref_array[1], group_id, OBJ_REF_GET_TYPE_TEST_TYPE_NAME, H5R_OBJECT, -1) < 0) {
+    if ((dset_id = H5Dcreate2(container_group, OPEN_LINK_WITHOUT_SLASH_DSET_NAME, dset_dtype, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype object reference\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving the type of the referenced object for this reference\n");
-#endif
-
-    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[1], &obj_type) < 0) {
-        H5_FAILED();
-        printf("    couldn't get object reference's object type\n");
-        goto error;
-    }
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
 
-    if (H5O_TYPE_NAMED_DATATYPE != obj_type) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    referenced object was not a datatype\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    /* Create and check the dataset reference */
-    if (H5Rcreate(&ref_array[2], group_id, OBJ_REF_GET_TYPE_TEST_DSET_NAME, H5R_OBJECT, -1) < 0) {
+    if ((group_id = H5Gopen2(file_id, "/", H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset object reference\n");
+        printf("    couldn't open root group\n");
         goto error;
     }
 
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Retrieving the type of the referenced object for this reference\n");
+    puts("Testing that an object can be opened by a relative path\n");
 #endif
 
-    if (H5Rget_obj_type2(file_id, H5R_OBJECT, &ref_array[2], &obj_type) < 0) {
-        H5_FAILED();
-        printf("    couldn't get object reference's object type\n");
-        goto error;
-    }
-
-    if (H5O_TYPE_DATASET != obj_type) {
+    if ((dset_id = H5Dopen2(group_id, MISCELLANEOUS_TEST_GROUP_NAME "/" OPEN_LINK_WITHOUT_SLASH_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    referenced object was not a dataset\n");
+        printf("    couldn't open dataset\n");
         goto error;
     }
 
-    /* TODO: Support for region references in this test */
+    if ((space_id = H5Dget_space(dset_id)) < 0)
+        TEST_ERROR
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Tclose(ref_dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Tclose(ref_dtype_id) < 0)
-        TEST_ERROR
-    if (H5Dclose(ref_dset_id) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Gclose(group_id) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
+    if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
@@ -15979,9 +20506,8 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(space_id);
-        H5Tclose(ref_dset_dtype);
-        H5Tclose(ref_dtype_id);
-        H5Dclose(ref_dset_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -15994,45 +20520,19 @@ error:
 }
 
 static int
-test_get_ref_name(void)
-{
-    TESTING("get ref. name")
-
-    /* H5Rget_name */
-
-    SKIPPED();
-
-    return 0;
-}
-
-static int
-test_get_region(void)
-{
-    TESTING("get region for region reference")
-
-    /* H5Rget_region */
-
-    SKIPPED();
-
-    return 0;
-}
-
-static int
-test_write_dataset_w_obj_refs(void)
+test_object_creation_by_absolute_path(void)
 {
-    rv_obj_ref_t *ref_array = NULL;
-    hsize_t       dims[OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK];
-    size_t        i, ref_array_size = 0;
-    hid_t         file_id = -1, fapl_id = -1;
-    hid_t         container_group = -1, group_id = -1;
-    hid_t         dset_id = -1, ref_dset_id = -1;
-    hid_t         ref_dtype_id   = -1;
-    hid_t         ref_dset_dtype = -1;
-    hid_t         space_id       = -1;
+    hsize_t dims[OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK];
+    htri_t  link_exists;
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1, sub_group_id = -1;
+    hid_t   dset_id    = -1;
+    hid_t   fspace_id  = -1;
+    hid_t   dtype_id   = -1;
+    hid_t   dset_dtype = -1;
 
-    TESTING("write to a dataset w/ object reference type")
-    SKIPPED()
-    return 0;
+    TESTING("object creation by absolute path")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -16048,152 +20548,153 @@ test_write_dataset_w_obj_refs(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_WRITE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Start by creating a group to hold all the objects for this test */
+    if ((group_id = H5Gcreate2(container_group, OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't create container group\n");
         goto error;
     }
 
-    for (i = 0; i < OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % 8 + 1);
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a variety of objects using absolute pathnames\n");
+#endif
 
-    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    /* Next try to create a group under the container group by using an absolute pathname */
+    if ((sub_group_id = H5Gcreate2(file_id,
+                                   "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME,
+                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create subgroup by absolute pathname\n");
+        goto error;
+    }
+
+    /* Next try to create a dataset nested at the end of this group chain by using an absolute pathname */
+    for (i = 0; i < OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+
+    if ((fspace_id = H5Screate_simple(OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    /* Create the dataset and datatype which will be referenced */
-    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_DSET_NAME, ref_dset_dtype,
-                                  space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(file_id,
+                              "/" MISCELLANEOUS_TEST_GROUP_NAME
+                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
+                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_NAME,
+                              dset_dtype, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset for referencing\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    /* Next try to create a committed datatype in the same fashion as the preceding dataset */
+    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
         H5_FAILED();
         printf("    couldn't create datatype\n");
         goto error;
     }
 
-    if (H5Tcommit2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
+    if (H5Tcommit2(file_id,
+                   "/" MISCELLANEOUS_TEST_GROUP_NAME
+                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
+                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DTYPE_NAME,
+                   dtype_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype for referencing\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-    {
-        /* TODO: Temporary workaround for datatypes */
-        if (H5Tclose(ref_dtype_id) < 0)
-            TEST_ERROR
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that all of the objects exist in the correct place\n");
+#endif
 
-        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't open datatype for referencing\n");
-            goto error;
-        }
+    /* Finally try to verify that all of the previously-created objects exist in the correct location */
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
     }
 
-    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_WRITE_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    container group didn't exist at the correct location\n");
         goto error;
     }
 
-    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_WRITE_TEST_SPACE_RANK; i++)
-        ref_array_size *= dims[i];
-
-    if (NULL == (ref_array = (rv_obj_ref_t *)malloc(ref_array_size * sizeof(*ref_array))))
-        TEST_ERROR
-
-    for (i = 0; i < dims[0]; i++) {
-        const char *URI;
-
-        /* Create a reference to either a group, datatype or dataset */
-        switch (rand() % 3) {
-            case 0:
-                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(file_id)))
-                    TEST_ERROR
-
-                break;
-
-            case 1:
-                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_WRITE_TEST_REF_TYPE_NAME, H5R_OBJECT,
-                              -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(ref_dtype_id)))
-                    TEST_ERROR
-
-                break;
-
-            case 2:
-                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_WRITE_TEST_REF_DSET_NAME, H5R_OBJECT,
-                              -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(ref_dset_id)))
-                    TEST_ERROR
-
-                break;
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
 
-            default:
-                TEST_ERROR
-        }
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    subgroup didn't exist at the correct location\n");
+        goto error;
+    }
 
-        if (strcmp(URI, ref_array[i].ref_obj_URI)) {
-            H5_FAILED();
-            printf("    ref type had mismatched URI\n");
-            goto error;
-        }
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset with buffer of object references\n");
-#endif
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    dataset didn't exist at the correct location\n");
+        goto error;
+    }
 
-    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
+                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DTYPE_NAME,
+                                 H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    if (ref_array) {
-        free(ref_array);
-        ref_array = NULL;
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    datatype didn't exist at the correct location\n");
+        goto error;
     }
 
-    if (H5Sclose(space_id) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Tclose(ref_dset_dtype) < 0)
+    if (H5Tclose(dset_dtype) < 0)
         TEST_ERROR
-    if (H5Tclose(ref_dtype_id) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Dclose(ref_dset_id) < 0)
+    if (H5Tclose(dtype_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Gclose(sub_group_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -16212,14 +20713,12 @@ test_write_dataset_w_obj_refs(void)
 
 error:
     H5E_BEGIN_TRY
-    {
-        if (ref_array)
-            free(ref_array);
-        H5Sclose(space_id);
-        H5Tclose(ref_dset_dtype);
-        H5Tclose(ref_dtype_id);
-        H5Dclose(ref_dset_id);
+    {
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
         H5Dclose(dset_id);
+        H5Tclose(dtype_id);
+        H5Gclose(sub_group_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -16232,22 +20731,19 @@ error:
 }
 
 static int
-test_read_dataset_w_obj_refs(void)
+test_absolute_vs_relative_path(void)
 {
-    rv_obj_ref_t *ref_array = NULL;
-    hsize_t       dims[OBJ_REF_DATASET_READ_TEST_SPACE_RANK];
-    size_t        i, ref_array_size = 0;
-    hid_t         file_id = -1, fapl_id = -1;
-    hid_t         container_group = -1, group_id = -1;
-    hid_t         dset_id = -1, ref_dset_id = -1;
-    hid_t         ref_dtype_id   = -1;
-    hid_t         ref_dset_dtype = -1;
-    hid_t         space_id       = -1;
-
-    TESTING("read from a dataset w/ object reference type")
+    hsize_t dims[ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK];
+    htri_t  link_exists;
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id1 = -1, dset_id2 = -1, dset_id3 = -1, dset_id4 = -1, dset_id5 = -1, dset_id6 = -1;
+    hid_t   dset_dtype1 = -1, dset_dtype2 = -1, dset_dtype3 = -1, dset_dtype4 = -1, dset_dtype5 = -1,
+          dset_dtype6 = -1;
+    hid_t fspace_id   = -1;
 
-    SKIPPED()
-    return 0;
+    TESTING("absolute vs. relative pathnames")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -16263,199 +20759,228 @@ test_read_dataset_w_obj_refs(void)
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't open container group\n");
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_READ_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Start by creating a group to be used during some of the dataset creation operations */
+    if ((group_id = H5Gcreate2(container_group, ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group\n");
+        printf("    couldn't create container group\n");
         goto error;
     }
 
-    for (i = 0; i < OBJ_REF_DATASET_READ_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % 8 + 1);
+    for (i = 0; i < ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK; i++)
+        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
 
-    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_READ_TEST_SPACE_RANK, dims, NULL)) < 0)
+    if ((fspace_id = H5Screate_simple(ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
         TEST_ERROR
 
-    if ((ref_dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((dset_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype3 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype4 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype5 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+        TEST_ERROR
+    if ((dset_dtype6 = generate_random_datatype(H5T_NO_CLASS)) < 0)
         TEST_ERROR
 
-    /* Create the dataset and datatype which will be referenced */
-    if ((ref_dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_READ_TEST_REF_DSET_NAME, ref_dset_dtype, space_id,
-                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Creating a variety of datasets using different forms of absolute and relative pathnames\n");
+#endif
+
+    /* Create a dataset by absolute path in the form "/group/dataset" starting from the root group */
+    if ((dset_id1 = H5Dcreate2(file_id,
+                               "/" MISCELLANEOUS_TEST_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET1_NAME,
+                               dset_dtype1, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset for referencing\n");
+        printf("    couldn't create dataset by absolute path from root\n");
         goto error;
     }
 
-    if ((ref_dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
+    /* Create a dataset by relative path in the form "group/dataset" starting from the container group */
+    if ((dset_id2 = H5Dcreate2(container_group,
+                               ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET2_NAME,
+                               dset_dtype2, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype\n");
+        printf("    couldn't create dataset by relative path from root\n");
         goto error;
     }
 
-    if (H5Tcommit2(group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, ref_dtype_id, H5P_DEFAULT, H5P_DEFAULT,
-                   H5P_DEFAULT) < 0) {
+    /* Create a dataset by relative path in the form "./group/dataset" starting from the root group */
+    if ((dset_id3 = H5Dcreate2(file_id,
+                               "./" MISCELLANEOUS_TEST_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET3_NAME,
+                               dset_dtype3, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create datatype for referencing\n");
+        printf("    couldn't create dataset by relative path from root with leading '.'\n");
         goto error;
     }
 
-    {
-        /* TODO: Temporary workaround for datatypes */
-        if (H5Tclose(ref_dtype_id) < 0)
-            TEST_ERROR
-
-        if ((ref_dtype_id = H5Topen2(group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, H5P_DEFAULT)) < 0) {
-            H5_FAILED();
-            printf("    couldn't open datatype for referencing\n");
-            goto error;
-        }
+    /* Create a dataset by absolute path in the form "/group/dataset" starting from the container group */
+    if ((dset_id4 = H5Dcreate2(container_group,
+                               "/" MISCELLANEOUS_TEST_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET4_NAME,
+                               dset_dtype4, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset by absolute path from container group\n");
+        goto error;
     }
 
-    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_READ_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    /* Create a dataset by relative path in the form "dataset" starting from the container group */
+    if ((dset_id5 = H5Dcreate2(group_id, ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET5_NAME, dset_dtype5, fspace_id,
+                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    couldn't create dataset by relative path from container group\n");
         goto error;
     }
 
-    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_READ_TEST_SPACE_RANK; i++)
-        ref_array_size *= dims[i];
-
-    if (NULL == (ref_array = (rv_obj_ref_t *)malloc(ref_array_size * sizeof(*ref_array))))
-        TEST_ERROR
-
-    for (i = 0; i < dims[0]; i++) {
-        const char *URI;
-
-        /* Create a reference to either a group, datatype or dataset */
-        switch (rand() % 3) {
-            case 0:
-                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(file_id)))
-                    TEST_ERROR
-
-                break;
-
-            case 1:
-                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_READ_TEST_REF_TYPE_NAME, H5R_OBJECT,
-                              -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(ref_dtype_id)))
-                    TEST_ERROR
-
-                break;
-
-            case 2:
-                if (H5Rcreate(&ref_array[i], group_id, OBJ_REF_DATASET_READ_TEST_REF_DSET_NAME, H5R_OBJECT,
-                              -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
-
-                if (NULL == (URI = H5rest_get_object_uri(ref_dset_id)))
-                    TEST_ERROR
+    /* Create a dataset by relative path in the form "./dataset" starting from the container group */
+    if ((dset_id6 = H5Dcreate2(group_id, "./" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET6_NAME, dset_dtype6,
+                               fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create dataset by relative path from container group with leading '.'\n");
+        goto error;
+    }
 
-                break;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Verifying that all of the datasets are in the correct place\n");
+#endif
 
-            default:
-                TEST_ERROR
-        }
+    /* Verify that all of the previously-created datasets exist in the correct locations */
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET1_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
 
-        if (strcmp(URI, ref_array[i].ref_obj_URI)) {
-            H5_FAILED();
-            printf("    ref type had mismatched URI\n");
-            goto error;
-        }
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    didn't exist at the correct location\n");
+        goto error;
     }
 
-    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET2_NAME,
+                                 H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-    /* Now read from the dataset */
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    didn't exist at the correct location\n");
+        goto error;
+    }
 
-    if ((dset_id = H5Dopen2(group_id, OBJ_REF_DATASET_READ_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET3_NAME,
+                                 H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    couldn't determine if link exists\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Reading from dataset with object reference type\n");
-#endif
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    didn't exist at the correct location\n");
+        goto error;
+    }
 
-    memset(ref_array, 0, ref_array_size * sizeof(*ref_array));
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET4_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
 
-    if (H5Dread(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+    if (!link_exists) {
         H5_FAILED();
-        printf("    couldn't read from dataset\n");
+        printf("    didn't exist at the correct location\n");
         goto error;
     }
 
-    for (i = 0; i < dims[0]; i++) {
-        /* Check the reference type */
-        if (H5R_OBJECT != ref_array[i].ref_type) {
-            H5_FAILED();
-            printf("    ref type was not H5R_OBJECT\n");
-            goto error;
-        }
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET5_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
+    }
 
-        /* Check the object type referenced */
-        if (H5I_FILE != ref_array[i].ref_obj_type && H5I_GROUP != ref_array[i].ref_obj_type &&
-            H5I_DATATYPE != ref_array[i].ref_obj_type && H5I_DATASET != ref_array[i].ref_obj_type) {
-            H5_FAILED();
-            printf("    ref object type mismatch\n");
-            goto error;
-        }
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    didn't exist at the correct location\n");
+        goto error;
+    }
 
-        /* Check the URI of the referenced object according to
-         * the server spec where each URI is prefixed as
-         * 'X-', where X is a character denoting the type
-         * of object */
-        if ((ref_array[i].ref_obj_URI[1] != '-') ||
-            (ref_array[i].ref_obj_URI[0] != 'g' && ref_array[i].ref_obj_URI[0] != 't' &&
-             ref_array[i].ref_obj_URI[0] != 'd')) {
-            H5_FAILED();
-            printf("    ref URI mismatch\n");
-            goto error;
-        }
+    if ((link_exists = H5Lexists(file_id,
+                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
+                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET6_NAME,
+                                 H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't determine if link exists\n");
+        goto error;
     }
 
-    if (ref_array) {
-        free(ref_array);
-        ref_array = NULL;
+    if (!link_exists) {
+        H5_FAILED();
+        printf("    didn't exist at the correct location\n");
+        goto error;
     }
 
-    if (H5Sclose(space_id) < 0)
+    if (H5Sclose(fspace_id) < 0)
         TEST_ERROR
-    if (H5Tclose(ref_dset_dtype) < 0)
+    if (H5Tclose(dset_dtype1) < 0)
         TEST_ERROR
-    if (H5Tclose(ref_dtype_id) < 0)
+    if (H5Tclose(dset_dtype2) < 0)
         TEST_ERROR
-    if (H5Dclose(ref_dset_id) < 0)
+    if (H5Tclose(dset_dtype3) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Tclose(dset_dtype4) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype5) < 0)
+        TEST_ERROR
+    if (H5Tclose(dset_dtype6) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id1) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id2) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id3) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id4) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id5) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id6) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
@@ -16475,13 +21000,19 @@ test_read_dataset_w_obj_refs(void)
 error:
     H5E_BEGIN_TRY
     {
-        if (ref_array)
-            free(ref_array);
-        H5Sclose(space_id);
-        H5Tclose(ref_dset_dtype);
-        H5Tclose(ref_dtype_id);
-        H5Dclose(ref_dset_id);
-        H5Dclose(dset_id);
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype1);
+        H5Tclose(dset_dtype2);
+        H5Tclose(dset_dtype3);
+        H5Tclose(dset_dtype4);
+        H5Tclose(dset_dtype5);
+        H5Tclose(dset_dtype6);
+        H5Dclose(dset_id1);
+        H5Dclose(dset_id2);
+        H5Dclose(dset_id3);
+        H5Dclose(dset_id4);
+        H5Dclose(dset_id5);
+        H5Dclose(dset_id6);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -16493,22 +21024,73 @@ error:
     return 1;
 }
 
+/* Simple test to ensure that calling H5rest_init() and
+ * H5rest_term() twice doesn't do anything bad
+ */
 static int
-test_write_dataset_w_obj_refs_empty_data(void)
+test_double_init_free(void)
 {
-    rv_obj_ref_t *ref_array = NULL;
-    hsize_t       dims[OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK];
-    size_t        i, ref_array_size = 0;
-    hid_t         file_id = -1, fapl_id = -1;
-    hid_t         container_group = -1, group_id = -1;
-    hid_t         dset_id  = -1;
-    hid_t         space_id = -1;
+    hid_t fapl_id = -1;
 
-    TESTING("write to a dataset w/ object reference type and some empty data")
+    TESTING("double init/free correctness")
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    PASSED();
 
-    SKIPPED()
     return 0;
 
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5rest_term();
+        H5rest_term();
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/* Test that recorded responses are replayed in place of sending requests, and that
+ * replay stops with an error when the application makes a request other than the
+ * one which was recorded next, or the capture was written in another format
+ */
+static int
+test_request_replay(void)
+{
+    char  *saved_endpoint = NULL;
+    hid_t  file_id = -1, fapl_id = -1;
+    herr_t init_ret = FAIL;
+
+    TESTING("replay of recorded requests")
+
+    /* The capture is replayed against a server which doesn't exist */
+    if (getenv("HSDS_ENDPOINT") && NULL == (saved_endpoint = strdup(getenv("HSDS_ENDPOINT"))))
+        TEST_ERROR
+    if (setenv("HSDS_ENDPOINT", REQUEST_REPLAY_TEST_ENDPOINT, 1) < 0)
+        TEST_ERROR
+    if (setenv("HSDS_REPLAY_FILE", REQUEST_REPLAY_TEST_CAPTURE_FILE_NAME, 1) < 0)
+        TEST_ERROR
+
+    if (write_replay_capture(REQUEST_REPLAY_TEST_ENDPOINT "/", 2) < 0)
+        TEST_ERROR
+
     if (H5rest_init() < 0)
         TEST_ERROR
 
@@ -16517,103 +21099,220 @@ test_write_dataset_w_obj_refs_empty_data(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't open file\n");
+        printf("    couldn't open file from replayed response\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
+    /* A request for a different URL than the recorded one must not be served its response */
+    if (write_replay_capture(REQUEST_REPLAY_TEST_ENDPOINT "/groups", 2) < 0)
+        TEST_ERROR
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    H5E_BEGIN_TRY
+    {
+        file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
     }
+    H5E_END_TRY;
 
-    if ((group_id = H5Gcreate2(container_group, OBJ_REF_DATASET_EMPTY_WRITE_TEST_SUBGROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (file_id >= 0) {
         H5_FAILED();
-        printf("    couldn't create container sub-group");
+        printf("    file was opened from the response to a different request\n");
         goto error;
     }
 
-    for (i = 0; i < OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % 8 + 1);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if (H5rest_term() < 0)
+        TEST_ERROR
 
-    if ((space_id = H5Screate_simple(OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK, dims, NULL)) < 0)
+    /* A capture in an unknown format must be refused */
+    if (write_replay_capture(REQUEST_REPLAY_TEST_ENDPOINT "/", 3) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(group_id, OBJ_REF_DATASET_EMPTY_WRITE_TEST_DSET_NAME, H5T_STD_REF_OBJ, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    H5E_BEGIN_TRY
+    {
+        init_ret = H5rest_init();
+    }
+    H5E_END_TRY;
+
+    if (init_ret >= 0) {
         H5_FAILED();
-        printf("    couldn't create dataset\n");
+        printf("    capture in an unknown format was replayed\n");
         goto error;
     }
 
-    for (i = 0, ref_array_size = 1; i < OBJ_REF_DATASET_EMPTY_WRITE_TEST_SPACE_RANK; i++)
-        ref_array_size *= dims[i];
-
-    if (NULL == (ref_array = (rv_obj_ref_t *)calloc(1, ref_array_size * sizeof(*ref_array))))
+    if (saved_endpoint && setenv("HSDS_ENDPOINT", saved_endpoint, 1) < 0)
+        TEST_ERROR
+    if (unsetenv("HSDS_REPLAY_FILE") < 0)
         TEST_ERROR
 
-    for (i = 0; i < dims[0]; i++) {
-        const char *URI;
+    remove(REQUEST_REPLAY_TEST_CAPTURE_FILE_NAME);
+    free(saved_endpoint);
 
-        switch (rand() % 2) {
-            case 0:
-                if (H5Rcreate(&ref_array[i], file_id, "/", H5R_OBJECT, -1) < 0) {
-                    H5_FAILED();
-                    printf("    couldn't create reference\n");
-                    goto error;
-                }
+    PASSED();
 
-                if (NULL == (URI = H5rest_get_object_uri(file_id)))
-                    TEST_ERROR
+    return 0;
 
-                if (strcmp(URI, ref_array[i].ref_obj_URI)) {
-                    H5_FAILED();
-                    printf("    ref type had mismatched URI\n");
-                    goto error;
-                }
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+        H5rest_term();
+    }
+    H5E_END_TRY;
 
-                break;
+    if (saved_endpoint)
+        setenv("HSDS_ENDPOINT", saved_endpoint, 1);
+    unsetenv("HSDS_REPLAY_FILE");
+    remove(REQUEST_REPLAY_TEST_CAPTURE_FILE_NAME);
+    free(saved_endpoint);
 
-            case 1:
-                break;
+    return 1;
+}
 
-            default:
-                TEST_ERROR
-        }
+/* Test that each request in the request trace is attributed to the HDF5 call which made it */
+static int
+test_request_trace(void)
+{
+    const char *expected_ops[REQUEST_TRACE_TEST_NUM_OPS] = {"H5Fopen", "H5Gcreate", "H5Acreate", "H5Awrite",
+                                                            "H5Aread"};
+    hbool_t     found_ops[REQUEST_TRACE_TEST_NUM_OPS]    = {0};
+    hsize_t     dims[1]                                  = {REQUEST_TRACE_TEST_ATTR_DIM};
+    FILE       *trace_file                               = NULL;
+    char        line[REQUEST_TRACE_TEST_LINE_MAX];
+    int         write_buf[REQUEST_TRACE_TEST_ATTR_DIM], read_buf[REQUEST_TRACE_TEST_ATTR_DIM];
+    size_t      i, num_lines = 0;
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    hid_t       attr_id = -1, space_id = -1;
+
+    TESTING("request trace names the HDF5 call of each request")
+
+    if (setenv("HSDS_TRACE_FILE", REQUEST_TRACE_TEST_FILE_NAME, 1) < 0)
+        TEST_ERROR
+    if (unsetenv("HSDS_TRACE_FORMAT") < 0)
+        TEST_ERROR
+
+    if (H5rest_init() < 0)
+        TEST_ERROR
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open file\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't open container group\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, REQUEST_TRACE_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        printf("    couldn't create group\n");
+        goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Writing to dataset with buffer of empty object references\n");
-#endif
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
 
-    if (H5Dwrite(dset_id, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref_array) < 0) {
+    if ((attr_id = H5Acreate2(group_id, REQUEST_TRACE_TEST_ATTR_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't write to dataset\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if (ref_array) {
-        free(ref_array);
-        ref_array = NULL;
-    }
+    for (i = 0; i < REQUEST_TRACE_TEST_ATTR_DIM; i++)
+        write_buf[i] = (int)i;
+
+    if (H5Awrite(attr_id, H5T_NATIVE_INT, write_buf) < 0)
+        TEST_ERROR
+    if (H5Aread(attr_id, H5T_NATIVE_INT, read_buf) < 0)
+        TEST_ERROR
 
     if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* The trace file is finished when the connector is terminated */
     if (H5rest_term() < 0)
         TEST_ERROR
+    if (unsetenv("HSDS_TRACE_FILE") < 0)
+        TEST_ERROR
+
+    if (NULL == (trace_file = fopen(REQUEST_TRACE_TEST_FILE_NAME, "r"))) {
+        H5_FAILED();
+        printf("    request trace file wasn't written\n");
+        goto error;
+    }
+
+    while (fgets(line, sizeof(line), trace_file)) {
+        num_lines++;
+
+        if (strstr(line, "\"operation\": \"\"")) {
+            H5_FAILED();
+            printf("    request wasn't attributed to an HDF5 call: %s", line);
+            goto error;
+        }
+
+        for (i = 0; i < REQUEST_TRACE_TEST_NUM_OPS; i++) {
+            char expected[64];
+
+            snprintf(expected, sizeof(expected), "\"operation\": \"%s\"", expected_ops[i]);
+            if (strstr(line, expected))
+                found_ops[i] = TRUE;
+        }
+    }
+
+    if (!num_lines) {
+        H5_FAILED();
+        printf("    request trace is empty\n");
+        goto error;
+    }
+
+    for (i = 0; i < REQUEST_TRACE_TEST_NUM_OPS; i++)
+        if (!found_ops[i]) {
+            H5_FAILED();
+            printf("    no request was attributed to %s\n", expected_ops[i]);
+            goto error;
+        }
+
+    fclose(trace_file);
+    remove(REQUEST_TRACE_TEST_FILE_NAME);
 
     PASSED();
 
@@ -16623,24 +21322,74 @@ error:
     H5E_BEGIN_TRY
     {
         H5Sclose(space_id);
-        H5Dclose(dset_id);
+        H5Aclose(attr_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
-        H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5Pclose(fapl_id);
         H5rest_term();
     }
     H5E_END_TRY;
 
+    if (trace_file)
+        fclose(trace_file);
+    unsetenv("HSDS_TRACE_FILE");
+    remove(REQUEST_TRACE_TEST_FILE_NAME);
+
     return 1;
 }
 
+/* Test that HSDS_LOG sets the level of each log category, that invalid log settings make
+ * initialization fail, and that each line of the JSON log format is a single JSON object */
 static int
-test_unused_object_API_calls(void)
+test_log_settings(void)
 {
-    hid_t file_id = -1, fapl_id = -1;
+    const char *bad_configs[LOG_FORMAT_TEST_NUM_BAD_CONFIGS][2] = {{"HSDS_LOG", "loud"},
+                                                                   {"HSDS_LOG", "nosuchcategory=debug"},
+                                                                   {"HSDS_LOG", "file=debug=trace"},
+                                                                   {"HSDS_LOG_FORMAT", "xml"}};
+    hbool_t     found_filename                                  = FALSE;
+    FILE       *log_file                                        = NULL;
+    char        line[LOG_FORMAT_TEST_LINE_MAX];
+    size_t      i, num_lines = 0;
+    herr_t      err_ret = -1;
+    hid_t       file_id = -1, fapl_id = -1;
 
-    TESTING("unused object API calls")
+    TESTING("log settings and JSON log format")
+
+    if (unsetenv("HSDS_LOG") < 0 || unsetenv("HSDS_LOG_FORMAT") < 0)
+        TEST_ERROR
+    if (setenv("HSDS_LOG_FILE", LOG_FORMAT_TEST_FILE_NAME, 1) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < LOG_FORMAT_TEST_NUM_BAD_CONFIGS; i++) {
+        if (setenv(bad_configs[i][0], bad_configs[i][1], 1) < 0)
+            TEST_ERROR
+
+        H5E_BEGIN_TRY
+        {
+            err_ret = H5rest_init();
+        }
+        H5E_END_TRY;
+
+        if (err_ret >= 0) {
+            H5_FAILED();
+            printf("    initialization succeeded with %s=%s\n", bad_configs[i][0], bad_configs[i][1]);
+            goto error;
+        }
+
+        if (unsetenv(bad_configs[i][0]) < 0)
+            TEST_ERROR
+    }
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Logging a file open with only the file category at the debug level\n");
+#endif
+
+    if (setenv("HSDS_LOG", LOG_FORMAT_TEST_SPEC, 1) < 0)
+        TEST_ERROR
+    if (setenv("HSDS_LOG_FORMAT", "json", 1) < 0)
+        TEST_ERROR
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -16650,33 +21399,60 @@ test_unused_object_API_calls(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't open file\n");
         goto error;
     }
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Testing that all of the unused object API calls don't cause application issues\n");
-#endif
-
-    H5E_BEGIN_TRY
-    {
-        const char *comment = "comment";
-
-        if (H5Oset_comment(file_id, comment) >= 0)
-            TEST_ERROR
-        if (H5Oset_comment_by_name(file_id, "/", comment, H5P_DEFAULT) >= 0)
-            TEST_ERROR
-    }
-    H5E_END_TRY;
-
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* The log file is closed when the connector is terminated */
     if (H5rest_term() < 0)
         TEST_ERROR
+    if (unsetenv("HSDS_LOG") < 0 || unsetenv("HSDS_LOG_FORMAT") < 0 || unsetenv("HSDS_LOG_FILE") < 0)
+        TEST_ERROR
+
+    if (NULL == (log_file = fopen(LOG_FORMAT_TEST_FILE_NAME, "r"))) {
+        H5_FAILED();
+        printf("    log file wasn't written\n");
+        goto error;
+    }
+
+    while (fgets(line, sizeof(line), log_file)) {
+        size_t  line_len  = strlen(line);
+        hbool_t is_detail = strstr(line, "\"level\": \"info\"") || strstr(line, "\"level\": \"debug\"");
+
+        num_lines++;
+
+        if (strncmp(line, "{\"ts_usec\": ", strlen("{\"ts_usec\": ")) || line_len < 2 ||
+            strcmp(line + line_len - 2, "}\n")) {
+            H5_FAILED();
+            printf("    log line isn't a single JSON object: %s", line);
+            goto error;
+        }
+
+        if (strstr(line, "\"level\": \"trace\"") || (is_detail && !strstr(line, "\"category\": \"file\""))) {
+            H5_FAILED();
+            printf("    message was logged above its category's level: %s", line);
+            goto error;
+        }
+
+        if (strstr(line, "\"category\": \"file\"") && strstr(line, "\"message\": \"Filename: "))
+            found_filename = TRUE;
+    }
+
+    if (!num_lines || !found_filename) {
+        H5_FAILED();
+        printf("    file category's debug messages weren't logged\n");
+        goto error;
+    }
+
+    fclose(log_file);
+    remove(LOG_FORMAT_TEST_FILE_NAME);
 
     PASSED();
 
@@ -16685,34 +21461,39 @@ test_unused_object_API_calls(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5Pclose(fapl_id);
         H5rest_term();
     }
     H5E_END_TRY;
 
+    if (log_file)
+        fclose(log_file);
+    unsetenv("HSDS_LOG");
+    unsetenv("HSDS_LOG_FORMAT");
+    unsetenv("HSDS_LOG_FILE");
+    remove(LOG_FORMAT_TEST_FILE_NAME);
+
     return 1;
 }
 
-/*****************************************************
- *                                                   *
- *                Miscellaneous tests                *
- *                                                   *
- *****************************************************/
-
+/* Test that the connection information is read once and reused by later file opens, even after
+ * the environment it was read from changes, and that terminating the connector forgets it */
 static int
-test_open_link_without_leading_slash(void)
+test_connection_info_caching(void)
 {
-    hsize_t dims[OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1;
-    hid_t   group_id        = -1;
-    hid_t   dset_id         = -1;
-    hid_t   dset_dtype      = -1;
-    hid_t   space_id        = -1;
+    size_t i;
+    char  *saved_endpoint = NULL;
+    char  *saved_home     = NULL;
+    hid_t  file_id = -1, fapl_id = -1;
+    hid_t  container_group = -1;
 
-    TESTING("opening a link without a leading slash")
+    TESTING("connection information caching")
+
+    if (NULL == (saved_endpoint = strdup(getenv("HSDS_ENDPOINT"))))
+        TEST_ERROR
+    if (getenv("HOME") && NULL == (saved_home = strdup(getenv("HOME"))))
+        TEST_ERROR
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -16722,84 +21503,85 @@ test_open_link_without_leading_slash(void)
     if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
         H5_FAILED();
         printf("    couldn't open file\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
-
-    for (i = 0; i < OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((space_id = H5Screate_simple(OPEN_LINK_WITHOUT_SLASH_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if (H5Fclose(file_id) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    /* Hide the endpoint and the config file, so that the connection information can only come
+     * from what the first open cached */
+    if (unsetenv("HSDS_ENDPOINT") < 0 || setenv("HOME", CONNECTION_INFO_CACHE_TEST_HOME, 1) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(container_group, OPEN_LINK_WITHOUT_SLASH_DSET_NAME, dset_dtype, space_id,
-                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create dataset\n");
-        goto error;
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Reopening the file with the connection information hidden\n");
+#endif
+
+    for (i = 0; i < CONNECTION_INFO_CACHE_TEST_NUM_OPENS; i++) {
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+            H5_FAILED();
+            printf("    couldn't reopen file %zu times with the cached connection information\n", i + 1);
+            goto error;
+        }
+
+        if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open container group\n");
+            goto error;
+        }
+
+        if (H5Gclose(container_group) < 0)
+            TEST_ERROR
+        if (H5Fclose(file_id) < 0)
+            TEST_ERROR
     }
 
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
+    if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
+    if (H5rest_term() < 0)
         TEST_ERROR
-    if (H5Fclose(file_id) < 0)
+
+#ifdef RV_CONNECTOR_DEBUG
+    puts("Checking that the connection information is read again after the connector is terminated\n");
+#endif
+
+    if (H5rest_init() < 0)
         TEST_ERROR
 
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open file\n");
-        goto error;
-    }
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
 
-    if ((group_id = H5Gopen2(file_id, "/", H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open root group\n");
-        goto error;
+    H5E_BEGIN_TRY
+    {
+        file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
     }
+    H5E_END_TRY;
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Testing that an object can be opened by a relative path\n");
-#endif
-
-    if ((dset_id = H5Dopen2(group_id, MISCELLANEOUS_TEST_GROUP_NAME "/" OPEN_LINK_WITHOUT_SLASH_DSET_NAME,
-                            H5P_DEFAULT)) < 0) {
+    if (file_id >= 0) {
         H5_FAILED();
-        printf("    couldn't open dataset\n");
+        printf("    file was opened with connection information cached before termination\n");
         goto error;
     }
 
-    if ((space_id = H5Dget_space(dset_id)) < 0)
-        TEST_ERROR
-
-    if (H5Sclose(space_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
     if (H5rest_term() < 0)
         TEST_ERROR
 
+    if (setenv("HSDS_ENDPOINT", saved_endpoint, 1) < 0)
+        TEST_ERROR
+    if ((saved_home ? setenv("HOME", saved_home, 1) : unsetenv("HOME")) < 0)
+        TEST_ERROR
+
+    free(saved_endpoint);
+    free(saved_home);
+
     PASSED();
 
     return 0;
@@ -16807,34 +21589,44 @@ test_open_link_without_leading_slash(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(space_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
         H5Gclose(container_group);
-        H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5Pclose(fapl_id);
         H5rest_term();
     }
     H5E_END_TRY;
 
-    return 1;
-}
+    if (saved_endpoint)
+        setenv("HSDS_ENDPOINT", saved_endpoint, 1);
+    if (saved_home)
+        setenv("HOME", saved_home, 1);
+    else
+        unsetenv("HOME");
+    free(saved_endpoint);
+    free(saved_home);
 
-static int
-test_object_creation_by_absolute_path(void)
-{
-    hsize_t dims[OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK];
-    htri_t  link_exists;
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1, sub_group_id = -1;
-    hid_t   dset_id    = -1;
-    hid_t   fspace_id  = -1;
-    hid_t   dtype_id   = -1;
-    hid_t   dset_dtype = -1;
+    return 1;
+}
 
-    TESTING("object creation by absolute path")
+/* Test that the tables of open objects, which are only created when the first object of each
+ * type is opened, work on first use after each initialization of the connector: the first
+ * dataset opened looks for other handles to it in a table which doesn't exist yet, and a second
+ * handle opened after it must find the first and share its extent */
+static int
+test_object_tables_first_use(void)
+{
+    hsize_t dims[]       = {OBJECT_TABLES_TEST_ROWS, OBJECT_TABLES_TEST_ROW_LEN};
+    hsize_t max_dims[]   = {H5S_UNLIMITED, OBJECT_TABLES_TEST_ROW_LEN};
+    hsize_t space_dims[] = {0, 0};
+    size_t  i;
+    hid_t   file_id = -1, fapl_id = -1, dcpl_id = -1;
+    hid_t   container_group = -1, group_id = -1;
+    hid_t   dset_id = -1, dset_id2 = -1;
+    hid_t   attr_id  = -1;
+    hid_t   dtype_id = -1;
+    hid_t   space_id = -1;
+
+    TESTING("object tables on first use")
 
     if (H5rest_init() < 0)
         TEST_ERROR
@@ -16856,159 +21648,158 @@ test_object_creation_by_absolute_path(void)
         goto error;
     }
 
-    /* Start by creating a group to hold all the objects for this test */
-    if ((group_id = H5Gcreate2(container_group, OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container group\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a variety of objects using absolute pathnames\n");
-#endif
-
-    /* Next try to create a group under the container group by using an absolute pathname */
-    if ((sub_group_id = H5Gcreate2(file_id,
-                                   "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME,
-                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, OBJECT_TABLES_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create subgroup by absolute pathname\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    /* Next try to create a dataset nested at the end of this group chain by using an absolute pathname */
-    for (i = 0; i < OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
-
-    if ((fspace_id = H5Screate_simple(OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl_id, 2, dims) < 0)
         TEST_ERROR
 
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if ((space_id = H5Screate_simple(2, dims, max_dims)) < 0)
         TEST_ERROR
 
-    if ((dset_id = H5Dcreate2(file_id,
-                              "/" MISCELLANEOUS_TEST_GROUP_NAME
-                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
-                              "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_NAME,
-                              dset_dtype, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, OBJECT_TABLES_TEST_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              dcpl_id, H5P_DEFAULT)) < 0) {
         H5_FAILED();
         printf("    couldn't create dataset\n");
         goto error;
     }
 
-    /* Next try to create a committed datatype in the same fashion as the preceding dataset */
-    if ((dtype_id = generate_random_datatype(H5T_NO_CLASS)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create datatype\n");
-        goto error;
-    }
-
-    if (H5Tcommit2(file_id,
-                   "/" MISCELLANEOUS_TEST_GROUP_NAME
-                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
-                   "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DTYPE_NAME,
-                   dtype_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) {
-        H5_FAILED();
-        printf("    couldn't commit datatype\n");
-        goto error;
-    }
-
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that all of the objects exist in the correct place\n");
-#endif
-
-    /* Finally try to verify that all of the previously-created objects exist in the correct location */
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    container group didn't exist at the correct location\n");
-        goto error;
-    }
-
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    subgroup didn't exist at the correct location\n");
-        goto error;
-    }
-
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DSET_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
+    if ((attr_id = H5Acreate2(group_id, OBJECT_TABLES_TEST_ATTR_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    dataset didn't exist at the correct location\n");
+        printf("    couldn't create attribute\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_SUBGROUP_NAME
-                                 "/" OBJECT_CREATE_BY_ABSOLUTE_PATH_TEST_DTYPE_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
+    if ((dtype_id = H5Tcopy(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR
 
-    if (!link_exists) {
+    if (H5Tcommit2(group_id, OBJECT_TABLES_TEST_DTYPE_NAME, dtype_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    datatype didn't exist at the correct location\n");
+        printf("    couldn't commit datatype\n");
         goto error;
     }
 
-    if (H5Sclose(fspace_id) < 0)
+    if (H5Tclose(dtype_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dset_dtype) < 0)
+    if (H5Aclose(attr_id) < 0)
         TEST_ERROR
     if (H5Dclose(dset_id) < 0)
         TEST_ERROR
-    if (H5Tclose(dtype_id) < 0)
+    if (H5Sclose(space_id) < 0)
         TEST_ERROR
-    if (H5Gclose(sub_group_id) < 0)
+    if (H5Pclose(dcpl_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
     if (H5Gclose(container_group) < 0)
         TEST_ERROR
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
     if (H5Fclose(file_id) < 0)
         TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Terminating the connector frees the tables, so each round starts without any */
     if (H5rest_term() < 0)
         TEST_ERROR
 
+    for (i = 0; i < OBJECT_TABLES_TEST_NUM_ROUNDS; i++) {
+#ifdef RV_CONNECTOR_DEBUG
+        printf("Opening each type of object first in round %zu\n\n", i);
+#endif
+
+        if (H5rest_init() < 0)
+            TEST_ERROR
+
+        if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR
+        if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+            TEST_ERROR
+
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open file\n");
+            goto error;
+        }
+
+        if ((group_id = H5Gopen2(file_id, OBJECT_TABLES_TEST_GROUP_PATH, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open container subgroup\n");
+            goto error;
+        }
+
+        if ((dset_id = H5Dopen2(group_id, OBJECT_TABLES_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open dataset as the first dataset in round %zu\n", i);
+            goto error;
+        }
+
+        if ((dset_id2 = H5Dopen2(group_id, OBJECT_TABLES_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open second handle to dataset in round %zu\n", i);
+            goto error;
+        }
+
+        /* Each round grows the dataset by another block of rows through the first handle */
+        dims[0] = (hsize_t)(OBJECT_TABLES_TEST_ROWS * (i + 2));
+
+        if (H5Dset_extent(dset_id, dims) < 0) {
+            H5_FAILED();
+            printf("    couldn't change extent of dataset\n");
+            goto error;
+        }
+
+        if ((space_id = H5Dget_space(dset_id2)) < 0)
+            TEST_ERROR
+        if (H5Sget_simple_extent_dims(space_id, space_dims, NULL) < 0)
+            TEST_ERROR
+
+        if (space_dims[0] != dims[0]) {
+            H5_FAILED();
+            printf("    second handle has %" PRIuHSIZE " rows instead of %" PRIuHSIZE " in round %zu\n",
+                   space_dims[0], dims[0], i);
+            goto error;
+        }
+
+        if ((attr_id = H5Aopen(group_id, OBJECT_TABLES_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open attribute as the first attribute in round %zu\n", i);
+            goto error;
+        }
+
+        if ((dtype_id = H5Topen2(group_id, OBJECT_TABLES_TEST_DTYPE_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            printf("    couldn't open datatype as the first datatype in round %zu\n", i);
+            goto error;
+        }
+
+        if (H5Tclose(dtype_id) < 0)
+            TEST_ERROR
+        if (H5Aclose(attr_id) < 0)
+            TEST_ERROR
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR
+        if (H5Dclose(dset_id2) < 0)
+            TEST_ERROR
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR
+        if (H5Gclose(group_id) < 0)
+            TEST_ERROR
+        if (H5Fclose(file_id) < 0)
+            TEST_ERROR
+        if (H5Pclose(fapl_id) < 0)
+            TEST_ERROR
+        if (H5rest_term() < 0)
+            TEST_ERROR
+    }
+
     PASSED();
 
     return 0;
@@ -17016,15 +21807,16 @@ test_object_creation_by_absolute_path(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
         H5Tclose(dtype_id);
-        H5Gclose(sub_group_id);
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+        H5Pclose(dcpl_id);
+        H5Dclose(dset_id2);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
-        H5Pclose(fapl_id);
         H5Fclose(file_id);
+        H5Pclose(fapl_id);
         H5rest_term();
     }
     H5E_END_TRY;
@@ -17032,266 +21824,170 @@ error:
     return 1;
 }
 
+/* Test that a local store kept in a directory saves its domains when the
+ * connector is terminated, and loads them again when it is next initialized
+ */
 static int
-test_absolute_vs_relative_path(void)
+test_local_store_persistence(void)
 {
-    hsize_t dims[ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK];
-    htri_t  link_exists;
-    size_t  i;
-    hid_t   file_id = -1, fapl_id = -1;
-    hid_t   container_group = -1, group_id = -1;
-    hid_t   dset_id1 = -1, dset_id2 = -1, dset_id3 = -1, dset_id4 = -1, dset_id5 = -1, dset_id6 = -1;
-    hid_t   dset_dtype1 = -1, dset_dtype2 = -1, dset_dtype3 = -1, dset_dtype4 = -1, dset_dtype5 = -1,
-          dset_dtype6 = -1;
-    hid_t fspace_id   = -1;
-
-    TESTING("absolute vs. relative pathnames")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
-
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
-
-    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open file\n");
-        goto error;
-    }
-
-    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't open container group\n");
-        goto error;
-    }
-
-    /* Start by creating a group to be used during some of the dataset creation operations */
-    if ((group_id = H5Gcreate2(container_group, ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't create container group\n");
-        goto error;
-    }
+    const char *endpoint   = getenv("HSDS_ENDPOINT");
+    size_t      prefix_len = strlen(LOCAL_STORE_PERSISTENCE_TEST_PREFIX);
+    hsize_t     dims[1]    = {LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM};
+    size_t      i;
+    htri_t      link_exists;
+    int         write_buf[LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM];
+    int         read_buf[LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM];
+    hid_t       file_id = -1, fapl_id = -1;
+    hid_t       container_group = -1, group_id = -1;
+    hid_t       dset_id  = -1;
+    hid_t       space_id = -1;
 
-    for (i = 0; i < ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK; i++)
-        dims[i] = (hsize_t)(rand() % MAX_DIM_SIZE + 1);
+    TESTING("local store persistence")
 
-    if ((fspace_id = H5Screate_simple(ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET_SPACE_RANK, dims, NULL)) < 0)
-        TEST_ERROR
+    /* Only a local store with a directory outlives the connector */
+    if (!endpoint || strncmp(endpoint, LOCAL_STORE_PERSISTENCE_TEST_PREFIX, prefix_len) ||
+        !strlen(endpoint + prefix_len)) {
+        SKIPPED();
+        return 0;
+    }
 
-    if ((dset_dtype1 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype2 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype3 = generate_random_datatype(H5T_NO_CLASS)) < 0)
-        TEST_ERROR
-    if ((dset_dtype4 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5rest_init() < 0)
         TEST_ERROR
-    if ((dset_dtype5 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         TEST_ERROR
-    if ((dset_dtype6 = generate_random_datatype(H5T_NO_CLASS)) < 0)
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
         TEST_ERROR
 
-#ifdef RV_CONNECTOR_DEBUG
-    puts("Creating a variety of datasets using different forms of absolute and relative pathnames\n");
-#endif
-
-    /* Create a dataset by absolute path in the form "/group/dataset" starting from the root group */
-    if ((dset_id1 = H5Dcreate2(file_id,
-                               "/" MISCELLANEOUS_TEST_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET1_NAME,
-                               dset_dtype1, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by absolute path from root\n");
+        printf("    couldn't open file\n");
         goto error;
     }
 
-    /* Create a dataset by relative path in the form "group/dataset" starting from the container group */
-    if ((dset_id2 = H5Dcreate2(container_group,
-                               ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET2_NAME,
-                               dset_dtype2, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((container_group = H5Gopen2(file_id, MISCELLANEOUS_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by relative path from root\n");
+        printf("    couldn't open container group\n");
         goto error;
     }
 
-    /* Create a dataset by relative path in the form "./group/dataset" starting from the root group */
-    if ((dset_id3 = H5Dcreate2(file_id,
-                               "./" MISCELLANEOUS_TEST_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET3_NAME,
-                               dset_dtype3, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((group_id = H5Gcreate2(container_group, LOCAL_STORE_PERSISTENCE_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by relative path from root with leading '.'\n");
+        printf("    couldn't create container subgroup\n");
         goto error;
     }
 
-    /* Create a dataset by absolute path in the form "/group/dataset" starting from the container group */
-    if ((dset_id4 = H5Dcreate2(container_group,
-                               "/" MISCELLANEOUS_TEST_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                               "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET4_NAME,
-                               dset_dtype4, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+
+    if ((dset_id = H5Dcreate2(group_id, LOCAL_STORE_PERSISTENCE_TEST_DSET_NAME, H5T_NATIVE_INT, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by absolute path from container group\n");
+        printf("    couldn't create dataset\n");
         goto error;
     }
 
-    /* Create a dataset by relative path in the form "dataset" starting from the container group */
-    if ((dset_id5 = H5Dcreate2(group_id, ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET5_NAME, dset_dtype5, fspace_id,
-                               H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    for (i = 0; i < LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM; i++)
+        write_buf[i] = (int)(i * i);
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, write_buf) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by relative path from container group\n");
+        printf("    couldn't write to dataset\n");
         goto error;
     }
 
-    /* Create a dataset by relative path in the form "./dataset" starting from the container group */
-    if ((dset_id6 = H5Dcreate2(group_id, "./" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET6_NAME, dset_dtype6,
-                               fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5Lcreate_soft(LOCAL_STORE_PERSISTENCE_TEST_DSET_PATH, group_id,
+                       LOCAL_STORE_PERSISTENCE_TEST_LINK_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0) {
         H5_FAILED();
-        printf("    couldn't create dataset by relative path from container group with leading '.'\n");
+        printf("    couldn't create soft link\n");
         goto error;
     }
 
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Terminating the connector closes the store, which must save what was written to it */
+    if (H5rest_term() < 0)
+        TEST_ERROR
+
 #ifdef RV_CONNECTOR_DEBUG
-    puts("Verifying that all of the datasets are in the correct place\n");
+    puts("Reopening the local store\n");
 #endif
 
-    /* Verify that all of the previously-created datasets exist in the correct locations */
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET1_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
-
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    didn't exist at the correct location\n");
-        goto error;
-    }
+    if (H5rest_init() < 0)
+        TEST_ERROR
 
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET2_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
-        goto error;
-    }
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
+        TEST_ERROR
 
-    if (!link_exists) {
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
         H5_FAILED();
-        printf("    didn't exist at the correct location\n");
+        printf("    couldn't reopen file from local store\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET3_NAME,
-                                 H5P_DEFAULT)) < 0) {
+    if ((link_exists = H5Lexists(file_id, LOCAL_STORE_PERSISTENCE_TEST_DSET_PATH, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't determine if dataset exists\n");
         goto error;
     }
 
     if (!link_exists) {
         H5_FAILED();
-        printf("    didn't exist at the correct location\n");
-        goto error;
-    }
-
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET4_NAME,
-                                 H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    dataset wasn't saved in local store\n");
         goto error;
     }
 
-    if (!link_exists) {
+    if ((group_id = H5Gopen2(file_id, LOCAL_STORE_PERSISTENCE_TEST_GROUP_PATH, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    didn't exist at the correct location\n");
+        printf("    couldn't open container subgroup\n");
         goto error;
     }
 
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET5_NAME,
-                                 H5P_DEFAULT)) < 0) {
+    /* Open the dataset through the soft link, so that the link is checked as well */
+    if ((dset_id = H5Dopen2(group_id, LOCAL_STORE_PERSISTENCE_TEST_LINK_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't open dataset through soft link\n");
         goto error;
     }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    didn't exist at the correct location\n");
-        goto error;
-    }
+    memset(read_buf, 0, sizeof(read_buf));
 
-    if ((link_exists = H5Lexists(file_id,
-                                 "/" MISCELLANEOUS_TEST_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_CONTAINER_GROUP_NAME
-                                 "/" ABSOLUTE_VS_RELATIVE_PATH_TEST_DSET6_NAME,
-                                 H5P_DEFAULT)) < 0) {
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0) {
         H5_FAILED();
-        printf("    couldn't determine if link exists\n");
+        printf("    couldn't read from dataset\n");
         goto error;
     }
 
-    if (!link_exists) {
-        H5_FAILED();
-        printf("    didn't exist at the correct location\n");
-        goto error;
-    }
+    for (i = 0; i < LOCAL_STORE_PERSISTENCE_TEST_DSET_DIM; i++)
+        if (read_buf[i] != write_buf[i]) {
+            H5_FAILED();
+            printf("    dataset had %d at index %zu after reopening instead of %d\n", read_buf[i], i,
+                   write_buf[i]);
+            goto error;
+        }
 
-    if (H5Sclose(fspace_id) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype1) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype2) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype3) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype4) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype5) < 0)
-        TEST_ERROR
-    if (H5Tclose(dset_dtype6) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id1) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id2) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id3) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id4) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id5) < 0)
-        TEST_ERROR
-    if (H5Dclose(dset_id6) < 0)
+    if (H5Dclose(dset_id) < 0)
         TEST_ERROR
     if (H5Gclose(group_id) < 0)
         TEST_ERROR
-    if (H5Gclose(container_group) < 0)
+    if (H5Fclose(file_id) < 0)
         TEST_ERROR
     if (H5Pclose(fapl_id) < 0)
         TEST_ERROR
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR
     if (H5rest_term() < 0)
         TEST_ERROR
 
@@ -17302,19 +21998,8 @@ test_absolute_vs_relative_path(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype1);
-        H5Tclose(dset_dtype2);
-        H5Tclose(dset_dtype3);
-        H5Tclose(dset_dtype4);
-        H5Tclose(dset_dtype5);
-        H5Tclose(dset_dtype6);
-        H5Dclose(dset_id1);
-        H5Dclose(dset_id2);
-        H5Dclose(dset_id3);
-        H5Dclose(dset_id4);
-        H5Dclose(dset_id5);
-        H5Dclose(dset_id6);
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
         H5Gclose(group_id);
         H5Gclose(container_group);
         H5Pclose(fapl_id);
@@ -17326,49 +22011,6 @@ error:
     return 1;
 }
 
-/* Simple test to ensure that calling H5rest_init() and
- * H5rest_term() twice doesn't do anything bad
- */
-static int
-test_double_init_free(void)
-{
-    hid_t fapl_id = -1;
-
-    TESTING("double init/free correctness")
-
-    if (H5rest_init() < 0)
-        TEST_ERROR
-    if (H5rest_init() < 0)
-        TEST_ERROR
-
-    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        TEST_ERROR
-    if (H5Pset_fapl_rest_vol(fapl_id) < 0)
-        TEST_ERROR
-
-    if (H5Pclose(fapl_id) < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-    if (H5rest_term() < 0)
-        TEST_ERROR
-
-    PASSED();
-
-    return 0;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Pclose(fapl_id);
-        H5rest_term();
-        H5rest_term();
-    }
-    H5E_END_TRY;
-
-    return 1;
-}
-
 /* Test to ensure that URL-encoding of attribute and link names works
  * correctly
  */
@@ -18040,6 +22682,49 @@ object_visit_callback(hid_t o_id, const char *name, const H5O_info2_t *object_in
 /* Helper function to generate a random HDF5 datatype in order to thoroughly
  * test the REST VOL connector's support for datatypes
  */
+/* Writes a request capture holding the given version of the capture format and a single
+ * recorded GET request of the given URL, whose response is that of opening the test file */
+static int
+write_replay_capture(const char *url, uint32_t version)
+{
+    const char *method   = "GET";
+    const char *body     = REQUEST_REPLAY_TEST_ROOT_RESPONSE;
+    uint64_t    fields[] = {0, 0, strlen(body), 0};
+    uint32_t    code_len[2];
+    uint8_t     buf[4 * 8 + 2 * 4 + 2 + 1 + 1];
+    uint8_t    *p    = buf;
+    FILE       *file = NULL;
+    size_t      i, j;
+
+    code_len[0] = 200;
+    code_len[1] = (uint32_t)strlen(url);
+
+    /* Every field of a capture record is little-endian */
+    for (i = 0; i < 4; i++)
+        for (j = 0; j < 8; j++)
+            *p++ = (uint8_t)(fields[i] >> (8 * j));
+    for (i = 0; i < 2; i++)
+        for (j = 0; j < 4; j++)
+            *p++ = (uint8_t)(code_len[i] >> (8 * j));
+    *p++ = (uint8_t)strlen(method);
+    *p++ = 0;
+    *p++ = 0; /* Requests made with the global cURL handle */
+    *p++ = 0; /* Response body stored inline */
+
+    if (NULL == (file = fopen(REQUEST_REPLAY_TEST_CAPTURE_FILE_NAME, "wb")))
+        return -1;
+
+    if (fwrite("RVCAP", 1, 5, file) != 5 || fputc((int)(version & 0xFF), file) == EOF ||
+        fwrite("\0\0\0", 1, 3, file) != 3 || fwrite(buf, 1, sizeof(buf), file) != sizeof(buf) ||
+        fwrite(method, 1, strlen(method), file) != strlen(method) ||
+        fwrite(url, 1, strlen(url), file) != strlen(url) || fwrite(body, 1, strlen(body), file) != strlen(body)) {
+        fclose(file);
+        return -1;
+    }
+
+    return fclose(file) ? -1 : 0;
+}
+
 static hid_t
 generate_random_datatype(H5T_class_t parent_class)
 {
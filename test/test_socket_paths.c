@@ -0,0 +1,280 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 REST VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Unit tests of the list of local sockets which the REST VOL
+ *          connector spreads requests across: that lists of socket paths are
+ *          split and glob patterns in them expanded, and that the sockets are
+ *          handed out in a round-robin rotation. These use the socket path
+ *          sources directly, so they need neither a server nor any sockets;
+ *          the patterns are expanded over empty files.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "hdf5.h"
+
+#include "util/rest_vol_err.h"
+#include "util/rest_vol_socket_paths.h"
+
+#define SOCKET_PATHS_TEST_DIR        "socket_paths_test"
+#define SOCKET_PATHS_TEST_NUM_ROUNDS 3
+
+/* Files which the glob test expands patterns over, in the sorted order glob() returns them */
+static const char *socket_files[] = {SOCKET_PATHS_TEST_DIR "/sn_1.sock", SOCKET_PATHS_TEST_DIR "/sn_10.sock",
+                                     SOCKET_PATHS_TEST_DIR "/sn_2.sock"};
+
+static int test_socket_path_list(void);
+static int test_socket_path_glob(void);
+static int test_socket_path_rotation(void);
+
+static int (*tests[])(void) = {
+    test_socket_path_list,
+    test_socket_path_glob,
+    test_socket_path_rotation,
+};
+
+/* Checks that the socket paths are the expected ones, in order */
+static int
+check_socket_paths(const RV_socket_paths_t *socket_paths, const char *const *expected, size_t num_expected)
+{
+    if (socket_paths->num_paths != num_expected) {
+        printf("    list has %zu socket paths instead of %zu\n", socket_paths->num_paths, num_expected);
+        return -1;
+    }
+
+    for (size_t i = 0; i < num_expected; i++)
+        if (strcmp(socket_paths->paths[i], expected[i])) {
+            printf("    socket path %zu is '%s' instead of '%s'\n", i, socket_paths->paths[i], expected[i]);
+            return -1;
+        }
+
+    return 0;
+}
+
+/*
+ * A test to check that a list of socket paths is split on the separator,
+ * skipping empty entries, and that later lists are appended.
+ */
+static int
+test_socket_path_list(void)
+{
+    const char       *expected[]   = {"/tmp/hs/sn_1.sock", "relative.sock", "/tmp/hs/sn_3.sock"};
+    RV_socket_paths_t socket_paths = {NULL, 0, 0};
+
+    TESTING("splitting lists of socket paths")
+
+    if (RV_socket_paths_add_list(&socket_paths, "", NULL) < 0 || socket_paths.num_paths != 0) {
+        H5_FAILED();
+        printf("    empty list didn't leave the socket paths empty\n");
+        goto error;
+    }
+
+    if (RV_socket_paths_add_list(&socket_paths, "::/tmp/hs/sn_1.sock:relative.sock:", NULL) < 0)
+        TEST_ERROR
+    if (RV_socket_paths_add_list(&socket_paths, "/tmp/hs/sn_3.sock", NULL) < 0)
+        TEST_ERROR
+
+    if (check_socket_paths(&socket_paths, expected, sizeof(expected) / sizeof(expected[0])) < 0) {
+        H5_FAILED();
+        goto error;
+    }
+
+    RV_socket_paths_free(&socket_paths);
+
+    if (socket_paths.paths || socket_paths.num_paths != 0 || RV_socket_paths_next(&socket_paths)) {
+        H5_FAILED();
+        printf("    freed list of socket paths isn't empty\n");
+        goto error;
+    }
+
+    PASSED();
+
+    return 0;
+
+error:
+    RV_socket_paths_free(&socket_paths);
+
+    return 1;
+}
+
+/*
+ * A test to check that glob patterns are expanded to every matching path in
+ * sorted order, and that patterns which match nothing are skipped. Where
+ * glob() is unavailable, every pattern must be skipped and counted instead.
+ */
+static int
+test_socket_path_glob(void)
+{
+    RV_socket_paths_t socket_paths = {NULL, 0, 0};
+    const char       *list =
+        SOCKET_PATHS_TEST_DIR "/sn_*.sock:" SOCKET_PATHS_TEST_DIR "/none_?.sock:/tmp/hs/explicit.sock";
+    size_t num_skipped = 0;
+    size_t i;
+
+    TESTING("expanding glob patterns in socket paths")
+
+    if (mkdir(SOCKET_PATHS_TEST_DIR, 0700) < 0) {
+        struct stat st;
+
+        if (stat(SOCKET_PATHS_TEST_DIR, &st) < 0)
+            TEST_ERROR
+    }
+
+    for (i = 0; i < sizeof(socket_files) / sizeof(socket_files[0]); i++) {
+        FILE *file;
+
+        if (NULL == (file = fopen(socket_files[i], "w")))
+            TEST_ERROR
+        fclose(file);
+    }
+
+    if (RV_socket_paths_add_list(&socket_paths, list, &num_skipped) < 0) {
+        H5_FAILED();
+        printf("    couldn't expand list of socket paths\n");
+        goto error;
+    }
+
+#ifdef RV_HAVE_GLOB
+    {
+        const char *expected[] = {SOCKET_PATHS_TEST_DIR "/sn_1.sock", SOCKET_PATHS_TEST_DIR "/sn_10.sock",
+                                  SOCKET_PATHS_TEST_DIR "/sn_2.sock", "/tmp/hs/explicit.sock"};
+
+        if (num_skipped != 0) {
+            H5_FAILED();
+            printf("    %zu patterns were skipped although glob() is available\n", num_skipped);
+            goto error;
+        }
+
+        if (check_socket_paths(&socket_paths, expected, sizeof(expected) / sizeof(expected[0])) < 0) {
+            H5_FAILED();
+            goto error;
+        }
+    }
+#else
+    {
+        const char *expected[] = {"/tmp/hs/explicit.sock"};
+
+        if (num_skipped != 2) {
+            H5_FAILED();
+            printf("    %zu patterns were skipped instead of 2\n", num_skipped);
+            goto error;
+        }
+
+        if (check_socket_paths(&socket_paths, expected, sizeof(expected) / sizeof(expected[0])) < 0) {
+            H5_FAILED();
+            goto error;
+        }
+    }
+#endif
+
+    RV_socket_paths_free(&socket_paths);
+
+    /* A list of patterns which match nothing adds nothing, so that the connector falls back
+     * to its default socket */
+    if (RV_socket_paths_add_list(&socket_paths, SOCKET_PATHS_TEST_DIR "/none_*.sock", NULL) < 0 ||
+        socket_paths.num_paths != 0) {
+        H5_FAILED();
+        printf("    pattern matching nothing added socket paths\n");
+        goto error;
+    }
+
+    for (i = 0; i < sizeof(socket_files) / sizeof(socket_files[0]); i++)
+        remove(socket_files[i]);
+    remove(SOCKET_PATHS_TEST_DIR);
+
+    PASSED();
+
+    return 0;
+
+error:
+    RV_socket_paths_free(&socket_paths);
+
+    for (i = 0; i < sizeof(socket_files) / sizeof(socket_files[0]); i++)
+        remove(socket_files[i]);
+    remove(SOCKET_PATHS_TEST_DIR);
+
+    return 1;
+}
+
+/*
+ * A test to check that socket paths are handed out in a round-robin rotation
+ * which wraps around, including over a single path.
+ */
+static int
+test_socket_path_rotation(void)
+{
+    RV_socket_paths_t socket_paths = {NULL, 0, 0};
+    const char       *path;
+
+    TESTING("round-robin rotation over socket paths")
+
+    if (RV_socket_paths_next(&socket_paths)) {
+        H5_FAILED();
+        printf("    empty list handed out a socket path\n");
+        goto error;
+    }
+
+    if (RV_socket_paths_add_list(&socket_paths, "a.sock:b.sock:c.sock", NULL) < 0)
+        TEST_ERROR
+
+    for (size_t round = 0; round < SOCKET_PATHS_TEST_NUM_ROUNDS; round++)
+        for (size_t i = 0; i < socket_paths.num_paths; i++)
+            if (NULL == (path = RV_socket_paths_next(&socket_paths)) || strcmp(path, socket_paths.paths[i])) {
+                H5_FAILED();
+                printf("    request %zu of round %zu went to '%s' instead of '%s'\n", i, round,
+                       path ? path : "(null)", socket_paths.paths[i]);
+                goto error;
+            }
+
+    RV_socket_paths_free(&socket_paths);
+
+    if (RV_socket_paths_add_list(&socket_paths, "only.sock", NULL) < 0)
+        TEST_ERROR
+
+    for (size_t i = 0; i < SOCKET_PATHS_TEST_NUM_ROUNDS; i++)
+        if (NULL == (path = RV_socket_paths_next(&socket_paths)) || strcmp(path, "only.sock")) {
+            H5_FAILED();
+            printf("    single socket path wasn't handed out every time\n");
+            goto error;
+        }
+
+    RV_socket_paths_free(&socket_paths);
+
+    PASSED();
+
+    return 0;
+
+error:
+    RV_socket_paths_free(&socket_paths);
+
+    return 1;
+}
+
+int
+main(void)
+{
+    int nerrors = 0;
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+        nerrors += tests[i]();
+
+    if (nerrors) {
+        printf("*** %d TEST%s FAILED ***\n", nerrors, nerrors > 1 ? "S" : "");
+        return 1;
+    }
+
+    puts("All socket path tests passed");
+
+    return 0;
+}